@@ -0,0 +1,1764 @@
+/**
+ * The internal assembler, this understands the subset of NASM syntax the code generator
+ * produces and encodes it straight into x86 machine code. The result is written as an
+ * ELF32 relocatable object (see elf.c) so we no longer have to spawn NASM for every file.
+ *
+ * Assembling happens in three steps:
+ * 1. Parse every line into statements, labels are defined and symbols are created.
+ * 2. Lay the statements out in their sections, jumps start short and are relaxed
+ *    to near jumps until everything fits.
+ * 3. Encode every statement into its section recording relocations as we go.
+ */
+#include "compiler.h"
+#include "helpers/buffer.h"
+#include "helpers/hashmap.h"
+#include <ctype.h>
+#include <stdint.h>
+
+#define ASSEMBLER_MAX_INSTRUCTION_SIZE 16
+#define ASSEMBLER_MAX_IDENTIFIER 256
+#define ASSEMBLER_MAX_OPERANDS 3
+
+enum
+{
+    X86_OPERAND_NONE,
+    X86_OPERAND_R8,
+    X86_OPERAND_R16,
+    X86_OPERAND_R32,
+    X86_OPERAND_RM8,
+    X86_OPERAND_RM16,
+    X86_OPERAND_RM32,
+    // Any memory operand, i.e the lea source
+    X86_OPERAND_M,
+    // Memory operand with only a displacement, used by the short accumulator moves
+    X86_OPERAND_MOFFS8,
+    X86_OPERAND_MOFFS16,
+    X86_OPERAND_MOFFS32,
+    X86_OPERAND_AL,
+    X86_OPERAND_AX,
+    X86_OPERAND_EAX,
+    X86_OPERAND_CL,
+    // The immediate value one, used by the short shift forms
+    X86_OPERAND_ONE,
+    // Byte immediate that is sign extended to the operand size
+    X86_OPERAND_IMM8,
+    // Byte immediate for byte sized operations, signed or unsigned
+    X86_OPERAND_UIMM8,
+    X86_OPERAND_IMM16,
+    X86_OPERAND_IMM32,
+    X86_OPERAND_REL8,
+    X86_OPERAND_REL32
+};
+
+enum
+{
+    // The modrm reg field holds a register operand
+    X86_ENCODING_MODRM = 0b00000001,
+    // The register operand is added onto the last opcode byte
+    X86_ENCODING_PLUS_REGISTER = 0b00000010,
+    // Emit the 0x66 operand size prefix, for 16 bit operations
+    X86_ENCODING_OPERAND_SIZE = 0b00000100
+};
+
+struct x86_instruction
+{
+    const char *mnemonic;
+    int operands[ASSEMBLER_MAX_OPERANDS];
+    unsigned char opcode[3];
+    int opcode_size;
+    // The value of the modrm reg field for "/digit" instructions, -1 otherwise
+    int digit;
+    int flags;
+};
+
+#define R8 X86_OPERAND_R8
+#define R16 X86_OPERAND_R16
+#define R32 X86_OPERAND_R32
+#define RM8 X86_OPERAND_RM8
+#define RM16 X86_OPERAND_RM16
+#define RM32 X86_OPERAND_RM32
+#define IMM8 X86_OPERAND_IMM8
+#define UIMM8 X86_OPERAND_UIMM8
+#define IMM16 X86_OPERAND_IMM16
+#define IMM32 X86_OPERAND_IMM32
+#define MODRM X86_ENCODING_MODRM
+#define PLUSR X86_ENCODING_PLUS_REGISTER
+#define OPSIZE X86_ENCODING_OPERAND_SIZE
+
+// The arithmetic group, add, or, adc, sbb, and, sub, xor and cmp all share the same layout.
+#define X86_ALU(name, n)                                          \
+    {name, {RM8, R8}, {0x00 + n * 8}, 1, -1, MODRM},              \
+    {name, {RM16, R16}, {0x01 + n * 8}, 1, -1, MODRM | OPSIZE},   \
+    {name, {RM32, R32}, {0x01 + n * 8}, 1, -1, MODRM},            \
+    {name, {R8, RM8}, {0x02 + n * 8}, 1, -1, MODRM},              \
+    {name, {R16, RM16}, {0x03 + n * 8}, 1, -1, MODRM | OPSIZE},   \
+    {name, {R32, RM32}, {0x03 + n * 8}, 1, -1, MODRM},            \
+    {name, {RM16, IMM8}, {0x83}, 1, n, OPSIZE},                   \
+    {name, {RM32, IMM8}, {0x83}, 1, n, 0},                        \
+    {name, {X86_OPERAND_AL, UIMM8}, {0x04 + n * 8}, 1, -1, 0},    \
+    {name, {X86_OPERAND_AX, IMM16}, {0x05 + n * 8}, 1, -1, OPSIZE}, \
+    {name, {X86_OPERAND_EAX, IMM32}, {0x05 + n * 8}, 1, -1, 0},   \
+    {name, {RM8, UIMM8}, {0x80}, 1, n, 0},                        \
+    {name, {RM16, IMM16}, {0x81}, 1, n, OPSIZE},                  \
+    {name, {RM32, IMM32}, {0x81}, 1, n, 0}
+
+#define X86_SHIFT(name, n)                                         \
+    {name, {RM8, X86_OPERAND_ONE}, {0xD0}, 1, n, 0},               \
+    {name, {RM8, X86_OPERAND_CL}, {0xD2}, 1, n, 0},                \
+    {name, {RM8, UIMM8}, {0xC0}, 1, n, 0},                         \
+    {name, {RM16, X86_OPERAND_ONE}, {0xD1}, 1, n, OPSIZE},         \
+    {name, {RM16, X86_OPERAND_CL}, {0xD3}, 1, n, OPSIZE},          \
+    {name, {RM16, UIMM8}, {0xC1}, 1, n, OPSIZE},                   \
+    {name, {RM32, X86_OPERAND_ONE}, {0xD1}, 1, n, 0},              \
+    {name, {RM32, X86_OPERAND_CL}, {0xD3}, 1, n, 0},               \
+    {name, {RM32, UIMM8}, {0xC1}, 1, n, 0}
+
+#define X86_UNARY(name, n)                   \
+    {name, {RM8}, {0xF6}, 1, n, 0},          \
+    {name, {RM16}, {0xF7}, 1, n, OPSIZE},    \
+    {name, {RM32}, {0xF7}, 1, n, 0}
+
+#define X86_CONDITION(suffix, cc)                                                \
+    {"j" suffix, {X86_OPERAND_REL8}, {0x70 + cc}, 1, -1, 0},                     \
+    {"j" suffix, {X86_OPERAND_REL32}, {0x0F, 0x80 + cc}, 2, -1, 0},              \
+    {"set" suffix, {RM8}, {0x0F, 0x90 + cc}, 2, 0, 0}
+
+/**
+ * Every instruction we can encode. Forms for the same mnemonic must be next to each other
+ * and are tried in order, so the shortest encoding for a mnemonic must come first.
+ * The order matches the choices NASM makes so the output is byte for byte the same.
+ */
+static const struct x86_instruction x86_instructions[] = {
+    X86_ALU("add", 0),
+    X86_ALU("or", 1),
+    X86_ALU("adc", 2),
+    X86_ALU("sbb", 3),
+    X86_ALU("and", 4),
+    X86_ALU("sub", 5),
+    X86_ALU("xor", 6),
+    X86_ALU("cmp", 7),
+
+    X86_SHIFT("rol", 0),
+    X86_SHIFT("ror", 1),
+    X86_SHIFT("rcl", 2),
+    X86_SHIFT("rcr", 3),
+    X86_SHIFT("shl", 4),
+    X86_SHIFT("sal", 4),
+    X86_SHIFT("shr", 5),
+    X86_SHIFT("sar", 7),
+
+    X86_UNARY("not", 2),
+    X86_UNARY("neg", 3),
+    X86_UNARY("mul", 4),
+    X86_UNARY("div", 6),
+    X86_UNARY("idiv", 7),
+
+    {"imul", {RM8}, {0xF6}, 1, 5, 0},
+    {"imul", {RM16}, {0xF7}, 1, 5, OPSIZE},
+    {"imul", {RM32}, {0xF7}, 1, 5, 0},
+    {"imul", {R16, RM16}, {0x0F, 0xAF}, 2, -1, MODRM | OPSIZE},
+    {"imul", {R32, RM32}, {0x0F, 0xAF}, 2, -1, MODRM},
+    {"imul", {R16, RM16, IMM8}, {0x6B}, 1, -1, MODRM | OPSIZE},
+    {"imul", {R32, RM32, IMM8}, {0x6B}, 1, -1, MODRM},
+    {"imul", {R16, RM16, IMM16}, {0x69}, 1, -1, MODRM | OPSIZE},
+    {"imul", {R32, RM32, IMM32}, {0x69}, 1, -1, MODRM},
+
+    {"test", {RM8, R8}, {0x84}, 1, -1, MODRM},
+    {"test", {RM16, R16}, {0x85}, 1, -1, MODRM | OPSIZE},
+    {"test", {RM32, R32}, {0x85}, 1, -1, MODRM},
+    {"test", {X86_OPERAND_AL, UIMM8}, {0xA8}, 1, -1, 0},
+    {"test", {X86_OPERAND_AX, IMM16}, {0xA9}, 1, -1, OPSIZE},
+    {"test", {X86_OPERAND_EAX, IMM32}, {0xA9}, 1, -1, 0},
+    {"test", {RM8, UIMM8}, {0xF6}, 1, 0, 0},
+    {"test", {RM16, IMM16}, {0xF7}, 1, 0, OPSIZE},
+    {"test", {RM32, IMM32}, {0xF7}, 1, 0, 0},
+
+    {"mov", {X86_OPERAND_AL, X86_OPERAND_MOFFS8}, {0xA0}, 1, -1, 0},
+    {"mov", {X86_OPERAND_AX, X86_OPERAND_MOFFS16}, {0xA1}, 1, -1, OPSIZE},
+    {"mov", {X86_OPERAND_EAX, X86_OPERAND_MOFFS32}, {0xA1}, 1, -1, 0},
+    {"mov", {X86_OPERAND_MOFFS8, X86_OPERAND_AL}, {0xA2}, 1, -1, 0},
+    {"mov", {X86_OPERAND_MOFFS16, X86_OPERAND_AX}, {0xA3}, 1, -1, OPSIZE},
+    {"mov", {X86_OPERAND_MOFFS32, X86_OPERAND_EAX}, {0xA3}, 1, -1, 0},
+    {"mov", {RM8, R8}, {0x88}, 1, -1, MODRM},
+    {"mov", {RM16, R16}, {0x89}, 1, -1, MODRM | OPSIZE},
+    {"mov", {RM32, R32}, {0x89}, 1, -1, MODRM},
+    {"mov", {R8, RM8}, {0x8A}, 1, -1, MODRM},
+    {"mov", {R16, RM16}, {0x8B}, 1, -1, MODRM | OPSIZE},
+    {"mov", {R32, RM32}, {0x8B}, 1, -1, MODRM},
+    {"mov", {R8, UIMM8}, {0xB0}, 1, -1, PLUSR},
+    {"mov", {R16, IMM16}, {0xB8}, 1, -1, PLUSR | OPSIZE},
+    {"mov", {R32, IMM32}, {0xB8}, 1, -1, PLUSR},
+    {"mov", {RM8, UIMM8}, {0xC6}, 1, 0, 0},
+    {"mov", {RM16, IMM16}, {0xC7}, 1, 0, OPSIZE},
+    {"mov", {RM32, IMM32}, {0xC7}, 1, 0, 0},
+
+    {"movzx", {R16, RM8}, {0x0F, 0xB6}, 2, -1, MODRM | OPSIZE},
+    {"movzx", {R32, RM8}, {0x0F, 0xB6}, 2, -1, MODRM},
+    {"movzx", {R32, RM16}, {0x0F, 0xB7}, 2, -1, MODRM},
+    {"movsx", {R16, RM8}, {0x0F, 0xBE}, 2, -1, MODRM | OPSIZE},
+    {"movsx", {R32, RM8}, {0x0F, 0xBE}, 2, -1, MODRM},
+    {"movsx", {R32, RM16}, {0x0F, 0xBF}, 2, -1, MODRM},
+
+    {"lea", {R32, X86_OPERAND_M}, {0x8D}, 1, -1, MODRM},
+
+    {"push", {R16}, {0x50}, 1, -1, PLUSR | OPSIZE},
+    {"push", {R32}, {0x50}, 1, -1, PLUSR},
+    {"push", {IMM8}, {0x6A}, 1, -1, 0},
+    {"push", {IMM32}, {0x68}, 1, -1, 0},
+    {"push", {RM16}, {0xFF}, 1, 6, OPSIZE},
+    {"push", {RM32}, {0xFF}, 1, 6, 0},
+    {"pop", {R16}, {0x58}, 1, -1, PLUSR | OPSIZE},
+    {"pop", {R32}, {0x58}, 1, -1, PLUSR},
+    {"pop", {RM16}, {0x8F}, 1, 0, OPSIZE},
+    {"pop", {RM32}, {0x8F}, 1, 0, 0},
+
+    {"inc", {R16}, {0x40}, 1, -1, PLUSR | OPSIZE},
+    {"inc", {R32}, {0x40}, 1, -1, PLUSR},
+    {"inc", {RM8}, {0xFE}, 1, 0, 0},
+    {"inc", {RM16}, {0xFF}, 1, 0, OPSIZE},
+    {"inc", {RM32}, {0xFF}, 1, 0, 0},
+    {"dec", {R16}, {0x48}, 1, -1, PLUSR | OPSIZE},
+    {"dec", {R32}, {0x48}, 1, -1, PLUSR},
+    {"dec", {RM8}, {0xFE}, 1, 1, 0},
+    {"dec", {RM16}, {0xFF}, 1, 1, OPSIZE},
+    {"dec", {RM32}, {0xFF}, 1, 1, 0},
+
+    {"jmp", {X86_OPERAND_REL8}, {0xEB}, 1, -1, 0},
+    {"jmp", {X86_OPERAND_REL32}, {0xE9}, 1, -1, 0},
+    {"jmp", {RM32}, {0xFF}, 1, 4, 0},
+    {"call", {X86_OPERAND_REL32}, {0xE8}, 1, -1, 0},
+    {"call", {RM32}, {0xFF}, 1, 2, 0},
+    {"ret", {}, {0xC3}, 1, -1, 0},
+    {"ret", {IMM16}, {0xC2}, 1, -1, 0},
+
+    X86_CONDITION("o", 0x0),
+    X86_CONDITION("no", 0x1),
+    X86_CONDITION("b", 0x2),
+    X86_CONDITION("c", 0x2),
+    X86_CONDITION("nae", 0x2),
+    X86_CONDITION("ae", 0x3),
+    X86_CONDITION("nb", 0x3),
+    X86_CONDITION("nc", 0x3),
+    X86_CONDITION("e", 0x4),
+    X86_CONDITION("z", 0x4),
+    X86_CONDITION("ne", 0x5),
+    X86_CONDITION("nz", 0x5),
+    X86_CONDITION("be", 0x6),
+    X86_CONDITION("na", 0x6),
+    X86_CONDITION("a", 0x7),
+    X86_CONDITION("nbe", 0x7),
+    X86_CONDITION("s", 0x8),
+    X86_CONDITION("ns", 0x9),
+    X86_CONDITION("p", 0xA),
+    X86_CONDITION("pe", 0xA),
+    X86_CONDITION("np", 0xB),
+    X86_CONDITION("po", 0xB),
+    X86_CONDITION("l", 0xC),
+    X86_CONDITION("nge", 0xC),
+    X86_CONDITION("ge", 0xD),
+    X86_CONDITION("nl", 0xD),
+    X86_CONDITION("le", 0xE),
+    X86_CONDITION("ng", 0xE),
+    X86_CONDITION("g", 0xF),
+    X86_CONDITION("nle", 0xF),
+
+    {"cbw", {}, {0x98}, 1, -1, OPSIZE},
+    {"cwde", {}, {0x98}, 1, -1, 0},
+    {"cwd", {}, {0x99}, 1, -1, OPSIZE},
+    {"cdq", {}, {0x99}, 1, -1, 0},
+    {"leave", {}, {0xC9}, 1, -1, 0},
+    {"nop", {}, {0x90}, 1, -1, 0},
+    {"hlt", {}, {0xF4}, 1, -1, 0},
+    {"int3", {}, {0xCC}, 1, -1, 0},
+    {"int", {UIMM8}, {0xCD}, 1, -1, 0}};
+
+#undef R8
+#undef R16
+#undef R32
+#undef RM8
+#undef RM16
+#undef RM32
+#undef IMM8
+#undef UIMM8
+#undef IMM16
+#undef IMM32
+#undef MODRM
+#undef PLUSR
+#undef OPSIZE
+
+struct x86_register
+{
+    const char *name;
+    int size;
+    int index;
+};
+
+static const struct x86_register x86_registers[] = {
+    {"eax", 4, 0}, {"ecx", 4, 1}, {"edx", 4, 2}, {"ebx", 4, 3}, {"esp", 4, 4}, {"ebp", 4, 5}, {"esi", 4, 6}, {"edi", 4, 7},
+    {"ax", 2, 0}, {"cx", 2, 1}, {"dx", 2, 2}, {"bx", 2, 3}, {"sp", 2, 4}, {"bp", 2, 5}, {"si", 2, 6}, {"di", 2, 7},
+    {"al", 1, 0}, {"cl", 1, 1}, {"dl", 1, 2}, {"bl", 1, 3}, {"ah", 1, 4}, {"ch", 1, 5}, {"dh", 1, 6}, {"bh", 1, 7}};
+
+enum
+{
+    ASSEMBLER_OPERAND_REGISTER,
+    ASSEMBLER_OPERAND_MEMORY,
+    ASSEMBLER_OPERAND_IMMEDIATE
+};
+
+struct assembler_expression
+{
+    long long value;
+    // NULL when the expression is just a number
+    struct assembler_symbol *symbol;
+};
+
+struct assembler_operand
+{
+    int type;
+    // Size in bytes, zero if the operand size was not given
+    int size;
+    // The register for register operands
+    int reg;
+
+    // Memory operands, -1 if not used.
+    int base;
+    int index;
+    int scale;
+
+    // The displacement of a memory operand or the value of an immediate
+    struct assembler_expression exp;
+};
+
+enum
+{
+    ASSEMBLER_STATEMENT_LABEL,
+    ASSEMBLER_STATEMENT_INSTRUCTION,
+    ASSEMBLER_STATEMENT_DATA
+};
+
+enum
+{
+    // Set once a jump no longer fits in a short jump
+    ASSEMBLER_STATEMENT_FLAG_NEAR_JUMP = 0b00000001
+};
+
+enum
+{
+    ASSEMBLER_DATA_VALUE_EXPRESSION,
+    ASSEMBLER_DATA_VALUE_STRING
+};
+
+struct assembler_data_value
+{
+    int type;
+    struct assembler_expression exp;
+
+    // Strings are not null terminated, they point into the source
+    const char *str;
+    size_t len;
+};
+
+struct assembler_statement
+{
+    int type;
+    int flags;
+    int line;
+    int section;
+    uint32_t offset;
+    uint32_t size;
+
+    union
+    {
+        struct assembler_symbol *label;
+
+        struct assembler_instruction
+        {
+            const char *mnemonic;
+            // The form we will encode with
+            const struct x86_instruction *form;
+            int total_operands;
+            struct assembler_operand operands[ASSEMBLER_MAX_OPERANDS];
+        } instruction;
+
+        struct assembler_data
+        {
+            // db, dw, dd, dq
+            int element_size;
+            long long times;
+            // Vector of struct assembler_data_value
+            struct vector *values;
+        } data;
+    };
+};
+
+// Maps a mnemonic to the index of its first form in x86_instructions
+static struct hashmap *x86_mnemonics = NULL;
+
+static const char *assembler_section_names[ASSEMBLER_TOTAL_SECTIONS] = {
+    ".text",
+    ".data",
+    ".rodata"};
+
+static void assembler_error(struct assembler *assembler, const char *msg, ...)
+{
+    va_list args;
+    va_start(args, msg);
+    vfprintf(stderr, msg, args);
+    va_end(args);
+
+    fprintf(stderr, " on line %i in file %s\n", assembler->line, assembler->filename);
+    exit(-1);
+}
+
+static void assembler_warning(struct assembler *assembler, const char *msg, ...)
+{
+    va_list args;
+    va_start(args, msg);
+    fprintf(stderr, "warning: ");
+    vfprintf(stderr, msg, args);
+    va_end(args);
+
+    fprintf(stderr, " on line %i in file %s\n", assembler->line, assembler->filename);
+}
+
+static void x86_mnemonics_init()
+{
+    if (x86_mnemonics)
+    {
+        return;
+    }
+
+    x86_mnemonics = hashmap_create(HASHMAP_DEFAULT_SIZE);
+    size_t total = sizeof(x86_instructions) / sizeof(struct x86_instruction);
+    for (size_t i = 0; i < total; i++)
+    {
+        if (!hashmap_data(x86_mnemonics, x86_instructions[i].mnemonic))
+        {
+            // Store index + 1 so the first instruction is not NULL
+            hashmap_insert(x86_mnemonics, x86_instructions[i].mnemonic, (void *)(i + 1));
+        }
+    }
+}
+
+static struct assembler *assembler_create(const char *filename)
+{
+    x86_mnemonics_init();
+    struct assembler *assembler = calloc(1, sizeof(struct assembler));
+    for (int i = 0; i < ASSEMBLER_TOTAL_SECTIONS; i++)
+    {
+        assembler->sections[i].name = assembler_section_names[i];
+        assembler->sections[i].data = buffer_create();
+        assembler->sections[i].relocations = vector_create(sizeof(struct assembler_relocation));
+    }
+
+    assembler->symbols = vector_create(sizeof(struct assembler_symbol *));
+    assembler->symbol_table = hashmap_create(HASHMAP_DEFAULT_SIZE);
+    assembler->statements = vector_create(sizeof(struct assembler_statement *));
+    assembler->filename = filename;
+    assembler->current_section = ASSEMBLER_SECTION_TEXT;
+    assembler->last_label = "";
+    return assembler;
+}
+
+static void assembler_free(struct assembler *assembler)
+{
+    vector_set_peek_pointer(assembler->statements, 0);
+    struct assembler_statement *statement = vector_peek_ptr(assembler->statements);
+    while (statement)
+    {
+        if (statement->type == ASSEMBLER_STATEMENT_DATA)
+        {
+            vector_free(statement->data.values);
+        }
+        free(statement);
+        statement = vector_peek_ptr(assembler->statements);
+    }
+
+    vector_set_peek_pointer(assembler->symbols, 0);
+    struct assembler_symbol *symbol = vector_peek_ptr(assembler->symbols);
+    while (symbol)
+    {
+        free((char *)symbol->name);
+        free(symbol);
+        symbol = vector_peek_ptr(assembler->symbols);
+    }
+
+    for (int i = 0; i < ASSEMBLER_TOTAL_SECTIONS; i++)
+    {
+        buffer_free(assembler->sections[i].data);
+        vector_free(assembler->sections[i].relocations);
+    }
+
+    vector_free(assembler->statements);
+    vector_free(assembler->symbols);
+    hashmap_free(assembler->symbol_table);
+    free(assembler);
+}
+
+/**
+ * Returns the symbol with the given name creating it if it does not exist yet.
+ * Local labels are expanded to the full name.
+ */
+static struct assembler_symbol *assembler_symbol(struct assembler *assembler, const char *name)
+{
+    char full_name[ASSEMBLER_MAX_IDENTIFIER * 2];
+    if (name[0] == '.')
+    {
+        snprintf(full_name, sizeof(full_name), "%s%s", assembler->last_label, name);
+        name = full_name;
+    }
+
+    struct assembler_symbol *symbol = hashmap_data(assembler->symbol_table, name);
+    if (symbol)
+    {
+        return symbol;
+    }
+
+    symbol = calloc(1, sizeof(struct assembler_symbol));
+    symbol->name = strdup(name);
+    vector_push(assembler->symbols, &symbol);
+    hashmap_insert(assembler->symbol_table, name, symbol);
+    return symbol;
+}
+
+static struct assembler_statement *assembler_statement_create(struct assembler *assembler, int type)
+{
+    struct assembler_statement *statement = calloc(1, sizeof(struct assembler_statement));
+    statement->type = type;
+    statement->line = assembler->line;
+    statement->section = assembler->current_section;
+    vector_push(assembler->statements, &statement);
+    return statement;
+}
+
+static void assembler_define_label(struct assembler *assembler, struct assembler_symbol *symbol)
+{
+    if (symbol->flags & ASSEMBLER_SYMBOL_FLAG_DEFINED)
+    {
+        assembler_error(assembler, "The symbol %s is already defined", symbol->name);
+    }
+
+    symbol->flags |= ASSEMBLER_SYMBOL_FLAG_DEFINED;
+    symbol->section = assembler->current_section;
+    struct assembler_statement *statement = assembler_statement_create(assembler, ASSEMBLER_STATEMENT_LABEL);
+    statement->label = symbol;
+}
+
+static bool assembler_is_identifier_char(char c, bool first)
+{
+    if (isalpha(c) || c == '_' || c == '.' || c == '?' || c == '@')
+    {
+        return true;
+    }
+
+    return !first && (isdigit(c) || c == '$' || c == '#' || c == '~');
+}
+
+static void assembler_skip_whitespace(char **ptr)
+{
+    while (**ptr == ' ' || **ptr == '\t' || **ptr == '\r')
+    {
+        (*ptr)++;
+    }
+}
+
+/**
+ * Reads an identifier into out, returns the length of the identifier, zero if there was none
+ */
+static size_t assembler_read_identifier(struct assembler *assembler, char **ptr, char *out)
+{
+    size_t len = 0;
+    assembler_skip_whitespace(ptr);
+    while (assembler_is_identifier_char(**ptr, len == 0))
+    {
+        if (len == ASSEMBLER_MAX_IDENTIFIER - 1)
+        {
+            assembler_error(assembler, "Identifier is too long");
+        }
+        out[len++] = **ptr;
+        (*ptr)++;
+    }
+    out[len] = 0x00;
+    return len;
+}
+
+static const struct x86_register *assembler_register(const char *name)
+{
+    size_t total = sizeof(x86_registers) / sizeof(struct x86_register);
+    for (size_t i = 0; i < total; i++)
+    {
+        if (S_EQ(x86_registers[i].name, name))
+        {
+            return &x86_registers[i];
+        }
+    }
+
+    return NULL;
+}
+
+static int assembler_size_keyword(const char *name)
+{
+    if (S_EQ(name, "byte"))
+        return 1;
+    if (S_EQ(name, "word"))
+        return 2;
+    if (S_EQ(name, "dword"))
+        return 4;
+    if (S_EQ(name, "qword"))
+        return 8;
+    return 0;
+}
+
+static long long assembler_read_number(struct assembler *assembler, char **ptr)
+{
+    char *start = *ptr;
+    char *end = NULL;
+    unsigned long long value = 0;
+    if (start[0] == '0' && (start[1] == 'x' || start[1] == 'X'))
+    {
+        value = strtoull(start + 2, &end, 16);
+    }
+    else if (start[0] == '0' && (start[1] == 'b' || start[1] == 'B'))
+    {
+        value = strtoull(start + 2, &end, 2);
+    }
+    else
+    {
+        value = strtoull(start, &end, 10);
+        // NASM also allows a trailing "h" for hexadecimal numbers
+        if (isxdigit(*end) || *end == 'h' || *end == 'H')
+        {
+            value = strtoull(start, &end, 16);
+            if (*end != 'h' && *end != 'H')
+            {
+                assembler_error(assembler, "Invalid number");
+            }
+            end++;
+        }
+    }
+
+    if (assembler_is_identifier_char(*end, false))
+    {
+        assembler_error(assembler, "Invalid number");
+    }
+
+    *ptr = end;
+    return (long long)value;
+}
+
+/**
+ * Reads a quoted string, returns a pointer to the first character and sets len
+ */
+static const char *assembler_read_string(struct assembler *assembler, char **ptr, size_t *len)
+{
+    char quote = **ptr;
+    (*ptr)++;
+    const char *start = *ptr;
+    while (**ptr != quote)
+    {
+        if (**ptr == 0x00)
+        {
+            assembler_error(assembler, "Unterminated string");
+        }
+        (*ptr)++;
+    }
+    *len = *ptr - start;
+    (*ptr)++;
+    return start;
+}
+
+/**
+ * Parses an expression made up of numbers, characters, symbols and registers joined by "+", "-" and "*".
+ * Registers are only allowed when a memory operand is passed, they become its base and index.
+ */
+static void assembler_parse_expression(struct assembler *assembler, char **ptr, struct assembler_expression *exp, struct assembler_operand *memory)
+{
+    exp->value = 0;
+    exp->symbol = NULL;
+    bool first = true;
+    while (1)
+    {
+        assembler_skip_whitespace(ptr);
+        int sign = 1;
+        if (!first)
+        {
+            if (**ptr != '+' && **ptr != '-')
+            {
+                break;
+            }
+        }
+
+        while (**ptr == '+' || **ptr == '-')
+        {
+            if (**ptr == '-')
+            {
+                sign = -sign;
+            }
+            (*ptr)++;
+            assembler_skip_whitespace(ptr);
+        }
+        first = false;
+
+        long long value = 1;
+        int reg = -1;
+        bool symbol_term = false;
+        char name[ASSEMBLER_MAX_IDENTIFIER];
+        // A term is one or more factors multiplied together
+        while (1)
+        {
+            assembler_skip_whitespace(ptr);
+            if (isdigit(**ptr))
+            {
+                value *= assembler_read_number(assembler, ptr);
+            }
+            else if (**ptr == '\'' || **ptr == '"')
+            {
+                size_t len = 0;
+                const char *str = assembler_read_string(assembler, ptr, &len);
+                long long chars = 0;
+                for (int i = len - 1; i >= 0; i--)
+                {
+                    chars = (chars << 8) | (unsigned char)str[i];
+                }
+                value *= chars;
+            }
+            else if (**ptr == '$' && !assembler_is_identifier_char((*ptr)[1], false))
+            {
+                // The current position, we drop a hidden label here
+                (*ptr)++;
+                char here[ASSEMBLER_MAX_IDENTIFIER];
+                sprintf(here, "..@here_%i", vector_count(assembler->statements));
+                struct assembler_symbol *symbol = assembler_symbol(assembler, here);
+                if (!(symbol->flags & ASSEMBLER_SYMBOL_FLAG_DEFINED))
+                {
+                    assembler_define_label(assembler, symbol);
+                }
+                if (exp->symbol || sign < 0)
+                {
+                    assembler_error(assembler, "Unsupported symbol expression");
+                }
+                exp->symbol = symbol;
+                symbol_term = true;
+            }
+            else if (assembler_read_identifier(assembler, ptr, name))
+            {
+                const struct x86_register *x86_reg = assembler_register(name);
+                if (x86_reg)
+                {
+                    if (!memory || x86_reg->size != 4 || reg != -1)
+                    {
+                        assembler_error(assembler, "Unexpected register %s", name);
+                    }
+                    reg = x86_reg->index;
+                }
+                else
+                {
+                    if (exp->symbol || sign < 0)
+                    {
+                        assembler_error(assembler, "Unsupported symbol expression %s", name);
+                    }
+                    exp->symbol = assembler_symbol(assembler, name);
+                    symbol_term = true;
+                }
+            }
+            else
+            {
+                assembler_error(assembler, "Unexpected character \"%c\" in expression", **ptr);
+            }
+
+            assembler_skip_whitespace(ptr);
+            if (**ptr != '*')
+            {
+                break;
+            }
+            (*ptr)++;
+        }
+
+        if (symbol_term && (reg != -1 || value != 1))
+        {
+            assembler_error(assembler, "Unsupported symbol expression");
+        }
+
+        if (reg == -1)
+        {
+            // The symbol itself is tracked separately
+            if (!symbol_term)
+            {
+                exp->value += sign * value;
+            }
+            continue;
+        }
+
+        if (sign < 0)
+        {
+            assembler_error(assembler, "Registers cannot be subtracted");
+        }
+
+        if (value == 1 && memory->base == -1)
+        {
+            memory->base = reg;
+        }
+        else if (memory->index == -1 && (value == 1 || value == 2 || value == 4 || value == 8))
+        {
+            memory->index = reg;
+            memory->scale = value;
+        }
+        else
+        {
+            assembler_error(assembler, "Invalid effective address");
+        }
+    }
+}
+
+static void assembler_parse_operand(struct assembler *assembler, char *str, struct assembler_operand *operand)
+{
+    memset(operand, 0, sizeof(struct assembler_operand));
+    operand->base = -1;
+    operand->index = -1;
+
+    char name[ASSEMBLER_MAX_IDENTIFIER];
+    char *ptr = str;
+    char *before = ptr;
+    // Size keywords and the jump distance keywords
+    while (assembler_read_identifier(assembler, &ptr, name))
+    {
+        int size = assembler_size_keyword(name);
+        if (size)
+        {
+            operand->size = size;
+        }
+        else if (!S_EQ(name, "short") && !S_EQ(name, "near") && !S_EQ(name, "strict"))
+        {
+            ptr = before;
+            break;
+        }
+        before = ptr;
+    }
+
+    assembler_skip_whitespace(&ptr);
+    if (*ptr == '[')
+    {
+        ptr++;
+        operand->type = ASSEMBLER_OPERAND_MEMORY;
+        assembler_parse_expression(assembler, &ptr, &operand->exp, operand);
+        if (*ptr != ']')
+        {
+            assembler_error(assembler, "Expecting \"]\"");
+        }
+        ptr++;
+    }
+    else
+    {
+        char *start = ptr;
+        if (assembler_read_identifier(assembler, &ptr, name))
+        {
+            const struct x86_register *x86_reg = assembler_register(name);
+            assembler_skip_whitespace(&ptr);
+            if (x86_reg && *ptr == 0x00)
+            {
+                operand->type = ASSEMBLER_OPERAND_REGISTER;
+                operand->size = x86_reg->size;
+                operand->reg = x86_reg->index;
+                return;
+            }
+        }
+        ptr = start;
+        operand->type = ASSEMBLER_OPERAND_IMMEDIATE;
+        assembler_parse_expression(assembler, &ptr, &operand->exp, NULL);
+    }
+
+    assembler_skip_whitespace(&ptr);
+    if (*ptr != 0x00)
+    {
+        assembler_error(assembler, "Unexpected \"%s\" after operand", ptr);
+    }
+}
+
+/**
+ * Splits the given string on commas that are not inside of quotes or brackets.
+ * Each part is null terminated in place. Returns the total parts
+ */
+static int assembler_split_operands(char *str, char **parts, int max)
+{
+    int total = 0;
+    assembler_skip_whitespace(&str);
+    if (*str == 0x00)
+    {
+        return 0;
+    }
+
+    parts[total++] = str;
+    char quote = 0;
+    int depth = 0;
+    for (; *str; str++)
+    {
+        if (quote)
+        {
+            if (*str == quote)
+                quote = 0;
+            continue;
+        }
+
+        switch (*str)
+        {
+        case '\'':
+        case '"':
+            quote = *str;
+            break;
+        case '[':
+            depth++;
+            break;
+        case ']':
+            depth--;
+            break;
+        case ',':
+            if (depth == 0)
+            {
+                if (total == max)
+                {
+                    return -1;
+                }
+                *str = 0x00;
+                parts[total++] = str + 1;
+            }
+            break;
+        }
+    }
+
+    return total;
+}
+
+static bool assembler_operand_fits(struct assembler_operand *operand, long long min, long long max)
+{
+    return operand->type == ASSEMBLER_OPERAND_IMMEDIATE && !operand->exp.symbol && operand->exp.value >= min && operand->exp.value <= max;
+}
+
+static bool assembler_operand_is_rm(struct assembler_operand *operand, int size)
+{
+    if (operand->type == ASSEMBLER_OPERAND_REGISTER)
+    {
+        return operand->size == size;
+    }
+
+    return operand->type == ASSEMBLER_OPERAND_MEMORY && (operand->size == size || operand->size == 0);
+}
+
+static bool assembler_operand_is_moffs(struct assembler_operand *operand, int size)
+{
+    return assembler_operand_is_rm(operand, size) && operand->type == ASSEMBLER_OPERAND_MEMORY && operand->base == -1 && operand->index == -1;
+}
+
+static bool assembler_operand_is_register(struct assembler_operand *operand, int size, int reg)
+{
+    return operand->type == ASSEMBLER_OPERAND_REGISTER && operand->size == size && (reg == -1 || operand->reg == reg);
+}
+
+/**
+ * Returns true if the operand can be used as the kind. With truncate byte and word immediates
+ * accept any number, NASM truncates those that are out of range rather than rejecting them.
+ */
+static bool assembler_operand_matches(struct assembler_statement *statement, struct assembler_operand *operand, int kind, bool truncate)
+{
+    if (truncate && (kind == X86_OPERAND_UIMM8 || kind == X86_OPERAND_IMM16))
+    {
+        return operand->type == ASSEMBLER_OPERAND_IMMEDIATE && !operand->exp.symbol;
+    }
+
+    switch (kind)
+    {
+    case X86_OPERAND_R8:
+        return assembler_operand_is_register(operand, 1, -1);
+    case X86_OPERAND_R16:
+        return assembler_operand_is_register(operand, 2, -1);
+    case X86_OPERAND_R32:
+        return assembler_operand_is_register(operand, 4, -1);
+    case X86_OPERAND_RM8:
+        return assembler_operand_is_rm(operand, 1);
+    case X86_OPERAND_RM16:
+        return assembler_operand_is_rm(operand, 2);
+    case X86_OPERAND_RM32:
+        return assembler_operand_is_rm(operand, 4);
+    case X86_OPERAND_M:
+        return operand->type == ASSEMBLER_OPERAND_MEMORY;
+    case X86_OPERAND_MOFFS8:
+        return assembler_operand_is_moffs(operand, 1);
+    case X86_OPERAND_MOFFS16:
+        return assembler_operand_is_moffs(operand, 2);
+    case X86_OPERAND_MOFFS32:
+        return assembler_operand_is_moffs(operand, 4);
+    case X86_OPERAND_AL:
+        return assembler_operand_is_register(operand, 1, 0);
+    case X86_OPERAND_AX:
+        return assembler_operand_is_register(operand, 2, 0);
+    case X86_OPERAND_EAX:
+        return assembler_operand_is_register(operand, 4, 0);
+    case X86_OPERAND_CL:
+        return assembler_operand_is_register(operand, 1, 1);
+    case X86_OPERAND_ONE:
+        return assembler_operand_fits(operand, 1, 1);
+    case X86_OPERAND_IMM8:
+        return assembler_operand_fits(operand, -128, 127);
+    case X86_OPERAND_UIMM8:
+        return assembler_operand_fits(operand, -128, 255);
+    case X86_OPERAND_IMM16:
+        return assembler_operand_fits(operand, -32768, 65535);
+    case X86_OPERAND_IMM32:
+        return operand->type == ASSEMBLER_OPERAND_IMMEDIATE;
+    case X86_OPERAND_REL8:
+        return operand->type == ASSEMBLER_OPERAND_IMMEDIATE && operand->exp.symbol && !(statement->flags & ASSEMBLER_STATEMENT_FLAG_NEAR_JUMP);
+    case X86_OPERAND_REL32:
+        return operand->type == ASSEMBLER_OPERAND_IMMEDIATE && operand->exp.symbol;
+    }
+
+    return false;
+}
+
+static const struct x86_instruction *assembler_match_form(struct assembler_statement *statement, bool truncate)
+{
+    struct assembler_instruction *instruction = &statement->instruction;
+    size_t index = (size_t)hashmap_data(x86_mnemonics, instruction->mnemonic);
+    size_t total = sizeof(x86_instructions) / sizeof(struct x86_instruction);
+    for (size_t i = index - 1; i < total && S_EQ(x86_instructions[i].mnemonic, instruction->mnemonic); i++)
+    {
+        const struct x86_instruction *form = &x86_instructions[i];
+        bool matches = true;
+        for (int op = 0; op < ASSEMBLER_MAX_OPERANDS; op++)
+        {
+            if (op >= instruction->total_operands)
+            {
+                matches = matches && form->operands[op] == X86_OPERAND_NONE;
+                continue;
+            }
+
+            matches = matches && assembler_operand_matches(statement, &instruction->operands[op], form->operands[op], truncate);
+        }
+
+        if (matches)
+        {
+            return form;
+        }
+    }
+
+    return NULL;
+}
+
+static int assembler_operand_kind_size(int kind);
+
+/**
+ * Finds the first instruction form that accepts the operands of the statement. Like NASM a byte
+ * or word immediate that is out of range is truncated to the operand size with a warning.
+ */
+static const struct x86_instruction *assembler_match(struct assembler *assembler, struct assembler_statement *statement)
+{
+    struct assembler_instruction *instruction = &statement->instruction;
+    const struct x86_instruction *form = assembler_match_form(statement, false);
+    if (form)
+    {
+        return form;
+    }
+
+    form = assembler_match_form(statement, true);
+    if (!form)
+    {
+        assembler_error(assembler, "Invalid combination of operands for %s", instruction->mnemonic);
+    }
+
+    for (int op = 0; op < instruction->total_operands; op++)
+    {
+        int kind = form->operands[op];
+        if (kind != X86_OPERAND_UIMM8 && kind != X86_OPERAND_IMM16)
+        {
+            continue;
+        }
+
+        struct assembler_operand *operand = &instruction->operands[op];
+        if (!assembler_operand_matches(statement, operand, kind, false))
+        {
+            int size = assembler_operand_kind_size(kind);
+            long long truncated = operand->exp.value & ((1LL << (size * 8)) - 1);
+            assembler_warning(assembler, "%s value %lli exceeds bounds, truncated to %lli", size == 1 ? "byte" : "word", operand->exp.value, truncated);
+        }
+    }
+    return form;
+}
+
+static int assembler_operand_kind_size(int kind)
+{
+    switch (kind)
+    {
+    case X86_OPERAND_IMM8:
+    case X86_OPERAND_UIMM8:
+    case X86_OPERAND_REL8:
+        return 1;
+    case X86_OPERAND_IMM16:
+        return 2;
+    case X86_OPERAND_IMM32:
+    case X86_OPERAND_REL32:
+    case X86_OPERAND_MOFFS8:
+    case X86_OPERAND_MOFFS16:
+    case X86_OPERAND_MOFFS32:
+        return 4;
+    }
+    return 0;
+}
+
+/**
+ * Records a relocation for the value at the given offset of the statement, returns the addend
+ * that should be written in place.
+ */
+static long long assembler_relocate(struct assembler *assembler, struct assembler_statement *statement, uint32_t offset, int type, struct assembler_expression *exp)
+{
+    struct assembler_symbol *symbol = exp->symbol;
+    if (!(symbol->flags & (ASSEMBLER_SYMBOL_FLAG_DEFINED | ASSEMBLER_SYMBOL_FLAG_EXTERN)))
+    {
+        assembler->line = statement->line;
+        assembler_error(assembler, "Symbol %s is not defined", symbol->name);
+    }
+
+    symbol->flags |= ASSEMBLER_SYMBOL_FLAG_REFERENCED;
+    struct assembler_relocation relocation;
+    relocation.type = type;
+    relocation.offset = statement->offset + offset;
+    relocation.symbol = symbol;
+    vector_push(assembler->sections[statement->section].relocations, &relocation);
+
+    if (!(symbol->flags & ASSEMBLER_SYMBOL_FLAG_EXTERN) && !(symbol->flags & ASSEMBLER_SYMBOL_FLAG_GLOBAL))
+    {
+        // Relocated against the section so the addend must include the symbol offset
+        return exp->value + symbol->offset;
+    }
+
+    return exp->value;
+}
+
+static size_t assembler_write_value(unsigned char *out, size_t pos, long long value, int size)
+{
+    for (int i = 0; i < size; i++)
+    {
+        out[pos++] = (value >> (i * 8)) & 0xff;
+    }
+    return pos;
+}
+
+/**
+ * Writes an immediate or displacement, when emitting a relocation is recorded for symbols.
+ */
+static size_t assembler_write_expression(struct assembler *assembler, struct assembler_statement *statement, unsigned char *out, size_t pos, struct assembler_expression *exp, int size, bool emit)
+{
+    long long value = exp->value;
+    if (emit && exp->symbol)
+    {
+        if (size != 4)
+        {
+            assembler->line = statement->line;
+            assembler_error(assembler, "Only dword sized relocations are supported");
+        }
+        value = assembler_relocate(assembler, statement, pos, ASSEMBLER_RELOCATION_ABSOLUTE, exp);
+    }
+
+    return assembler_write_value(out, pos, value, size);
+}
+
+static size_t assembler_write_modrm(struct assembler *assembler, struct assembler_statement *statement, unsigned char *out, size_t pos, int reg, struct assembler_operand *rm, bool emit)
+{
+    if (rm->type == ASSEMBLER_OPERAND_REGISTER)
+    {
+        out[pos++] = 0xC0 | (reg << 3) | rm->reg;
+        return pos;
+    }
+
+    int scale_bits = 0;
+    switch (rm->scale)
+    {
+    case 2:
+        scale_bits = 1;
+        break;
+    case 4:
+        scale_bits = 2;
+        break;
+    case 8:
+        scale_bits = 3;
+        break;
+    }
+
+    if (rm->index == 4)
+    {
+        assembler->line = statement->line;
+        assembler_error(assembler, "esp cannot be used as an index register");
+    }
+
+    if (rm->base == -1)
+    {
+        if (rm->index == -1)
+        {
+            out[pos++] = (reg << 3) | 0b101;
+        }
+        else
+        {
+            out[pos++] = (reg << 3) | 0b100;
+            out[pos++] = (scale_bits << 6) | (rm->index << 3) | 0b101;
+        }
+        return assembler_write_expression(assembler, statement, out, pos, &rm->exp, 4, emit);
+    }
+
+    int mod = 0b10;
+    int disp_size = 4;
+    if (!rm->exp.symbol && rm->exp.value == 0 && rm->base != 5)
+    {
+        mod = 0b00;
+        disp_size = 0;
+    }
+    else if (!rm->exp.symbol && rm->exp.value >= -128 && rm->exp.value <= 127)
+    {
+        mod = 0b01;
+        disp_size = 1;
+    }
+
+    if (rm->index == -1 && rm->base != 4)
+    {
+        out[pos++] = (mod << 6) | (reg << 3) | rm->base;
+    }
+    else
+    {
+        out[pos++] = (mod << 6) | (reg << 3) | 0b100;
+        out[pos++] = (scale_bits << 6) | ((rm->index == -1 ? 4 : rm->index) << 3) | rm->base;
+    }
+
+    if (disp_size)
+    {
+        pos = assembler_write_expression(assembler, statement, out, pos, &rm->exp, disp_size, emit);
+    }
+    return pos;
+}
+
+static bool assembler_kind_is_register(int kind)
+{
+    return kind == X86_OPERAND_R8 || kind == X86_OPERAND_R16 || kind == X86_OPERAND_R32;
+}
+
+static bool assembler_kind_is_rm(int kind)
+{
+    return kind == X86_OPERAND_RM8 || kind == X86_OPERAND_RM16 || kind == X86_OPERAND_RM32 || kind == X86_OPERAND_M;
+}
+
+/**
+ * Encodes the instruction into out, returns the size of the instruction.
+ * When emit is false nothing is resolved, this is used to find the size of the instruction.
+ */
+static size_t assembler_encode_instruction(struct assembler *assembler, struct assembler_statement *statement, unsigned char *out, bool emit)
+{
+    struct assembler_instruction *instruction = &statement->instruction;
+    const struct x86_instruction *form = instruction->form;
+    size_t pos = 0;
+
+    if (form->flags & X86_ENCODING_OPERAND_SIZE)
+    {
+        out[pos++] = 0x66;
+    }
+
+    struct assembler_operand *reg = NULL;
+    struct assembler_operand *rm = NULL;
+    for (int i = 0; i < instruction->total_operands; i++)
+    {
+        if (assembler_kind_is_register(form->operands[i]) && !reg)
+        {
+            reg = &instruction->operands[i];
+        }
+        else if (assembler_kind_is_rm(form->operands[i]))
+        {
+            rm = &instruction->operands[i];
+        }
+    }
+
+    memcpy(&out[pos], form->opcode, form->opcode_size);
+    pos += form->opcode_size;
+    if (form->flags & X86_ENCODING_PLUS_REGISTER)
+    {
+        out[pos - 1] += reg->reg;
+    }
+
+    if (form->flags & X86_ENCODING_MODRM)
+    {
+        pos = assembler_write_modrm(assembler, statement, out, pos, reg->reg, rm, emit);
+    }
+    else if (form->digit != -1)
+    {
+        pos = assembler_write_modrm(assembler, statement, out, pos, form->digit, rm, emit);
+    }
+
+    for (int i = 0; i < instruction->total_operands; i++)
+    {
+        struct assembler_operand *operand = &instruction->operands[i];
+        int kind = form->operands[i];
+        int size = assembler_operand_kind_size(kind);
+        if (!size)
+        {
+            continue;
+        }
+
+        if (kind != X86_OPERAND_REL8 && kind != X86_OPERAND_REL32)
+        {
+            pos = assembler_write_expression(assembler, statement, out, pos, &operand->exp, size, emit);
+            continue;
+        }
+
+        long long value = 0;
+        struct assembler_symbol *target = operand->exp.symbol;
+        if (emit)
+        {
+            // Jumps within the same section are resolved right away
+            if ((target->flags & ASSEMBLER_SYMBOL_FLAG_DEFINED) && target->section == statement->section)
+            {
+                value = target->offset + operand->exp.value - (statement->offset + statement->size);
+            }
+            else
+            {
+                value = assembler_relocate(assembler, statement, pos, ASSEMBLER_RELOCATION_PC_RELATIVE, &operand->exp) - size;
+            }
+        }
+        pos = assembler_write_value(out, pos, value, size);
+    }
+
+    return pos;
+}
+
+/**
+ * Returns true if the short jump in this statement reaches its target
+ */
+static bool assembler_short_jump_fits(struct assembler_statement *statement)
+{
+    struct assembler_expression *exp = &statement->instruction.operands[0].exp;
+    struct assembler_symbol *target = exp->symbol;
+    if (!(target->flags & ASSEMBLER_SYMBOL_FLAG_DEFINED) || target->section != statement->section)
+    {
+        return false;
+    }
+
+    long long distance = (long long)target->offset + exp->value - (statement->offset + statement->size);
+    return distance >= -128 && distance <= 127;
+}
+
+static void assembler_statement_resize(struct assembler *assembler, struct assembler_statement *statement)
+{
+    unsigned char out[ASSEMBLER_MAX_INSTRUCTION_SIZE];
+    statement->instruction.form = assembler_match(assembler, statement);
+    statement->size = assembler_encode_instruction(assembler, statement, out, false);
+}
+
+static void assembler_parse_instruction(struct assembler *assembler, const char *mnemonic, char *operands)
+{
+    size_t index = (size_t)hashmap_data(x86_mnemonics, mnemonic);
+    if (!index)
+    {
+        assembler_error(assembler, "Unknown instruction %s", mnemonic);
+    }
+
+    char *parts[ASSEMBLER_MAX_OPERANDS];
+    struct assembler_operand parsed[ASSEMBLER_MAX_OPERANDS];
+    int total = assembler_split_operands(operands, parts, ASSEMBLER_MAX_OPERANDS);
+    if (total < 0)
+    {
+        assembler_error(assembler, "Too many operands");
+    }
+
+    for (int i = 0; i < total; i++)
+    {
+        assembler_parse_operand(assembler, parts[i], &parsed[i]);
+    }
+
+    // Must be created after the operands are parsed, "$" defines a label before this statement.
+    struct assembler_statement *statement = assembler_statement_create(assembler, ASSEMBLER_STATEMENT_INSTRUCTION);
+    struct assembler_instruction *instruction = &statement->instruction;
+    // The mnemonic must live as long as the statement
+    instruction->mnemonic = x86_instructions[index - 1].mnemonic;
+    instruction->total_operands = total;
+    memcpy(instruction->operands, parsed, sizeof(parsed));
+
+    // "imul eax, 4" is short for "imul eax, eax, 4"
+    if (S_EQ(mnemonic, "imul") && total == 2 && parsed[1].type == ASSEMBLER_OPERAND_IMMEDIATE)
+    {
+        instruction->operands[1] = parsed[0];
+        instruction->operands[2] = parsed[1];
+        instruction->total_operands = 3;
+    }
+
+    // Jumps to external symbols can never be short
+    if (total == 1 && parsed[0].type == ASSEMBLER_OPERAND_IMMEDIATE && parsed[0].exp.symbol &&
+        (parsed[0].exp.symbol->flags & ASSEMBLER_SYMBOL_FLAG_EXTERN))
+    {
+        statement->flags |= ASSEMBLER_STATEMENT_FLAG_NEAR_JUMP;
+    }
+
+    assembler_statement_resize(assembler, statement);
+}
+
+static void assembler_parse_data(struct assembler *assembler, int element_size, long long times, char *values)
+{
+    struct assembler_statement *statement = assembler_statement_create(assembler, ASSEMBLER_STATEMENT_DATA);
+    statement->data.element_size = element_size;
+    statement->data.times = times;
+    statement->data.values = vector_create(sizeof(struct assembler_data_value));
+
+    size_t size = 0;
+    char *ptr = values;
+    while (1)
+    {
+        struct assembler_data_value value = {};
+        assembler_skip_whitespace(&ptr);
+        if (*ptr == '\'' || *ptr == '"')
+        {
+            char *start = ptr;
+            value.type = ASSEMBLER_DATA_VALUE_STRING;
+            value.str = assembler_read_string(assembler, &ptr, &value.len);
+            assembler_skip_whitespace(&ptr);
+            if (*ptr != ',' && *ptr != 0x00)
+            {
+                // A character used in an expression i.e 'a'+1
+                ptr = start;
+                value.type = ASSEMBLER_DATA_VALUE_EXPRESSION;
+                assembler_parse_expression(assembler, &ptr, &value.exp, NULL);
+            }
+        }
+        else
+        {
+            value.type = ASSEMBLER_DATA_VALUE_EXPRESSION;
+            assembler_parse_expression(assembler, &ptr, &value.exp, NULL);
+        }
+
+        if (value.type == ASSEMBLER_DATA_VALUE_STRING)
+        {
+            // Strings are padded to a multiple of the element size
+            size += (value.len + element_size - 1) / element_size * element_size;
+        }
+        else
+        {
+            size += element_size;
+        }
+        vector_push(statement->data.values, &value);
+
+        assembler_skip_whitespace(&ptr);
+        if (*ptr == 0x00)
+        {
+            break;
+        }
+        if (*ptr != ',')
+        {
+            assembler_error(assembler, "Expecting \",\" between data values");
+        }
+        ptr++;
+    }
+
+    statement->size = size * times;
+}
+
+static int assembler_data_element_size(const char *name)
+{
+    if (S_EQ(name, "db"))
+        return 1;
+    if (S_EQ(name, "dw"))
+        return 2;
+    if (S_EQ(name, "dd"))
+        return 4;
+    if (S_EQ(name, "dq"))
+        return 8;
+    return 0;
+}
+
+static void assembler_parse_section(struct assembler *assembler, char *ptr)
+{
+    char name[ASSEMBLER_MAX_IDENTIFIER];
+    assembler_read_identifier(assembler, &ptr, name);
+    for (int i = 0; i < ASSEMBLER_TOTAL_SECTIONS; i++)
+    {
+        if (S_EQ(assembler_section_names[i], name))
+        {
+            assembler->current_section = i;
+            return;
+        }
+    }
+
+    assembler_error(assembler, "Unknown section %s", name);
+}
+
+static void assembler_parse_symbol_flags(struct assembler *assembler, char *ptr, int flags)
+{
+    char name[ASSEMBLER_MAX_IDENTIFIER];
+    while (assembler_read_identifier(assembler, &ptr, name))
+    {
+        assembler_symbol(assembler, name)->flags |= flags;
+        assembler_skip_whitespace(&ptr);
+        if (*ptr != ',')
+        {
+            break;
+        }
+        ptr++;
+    }
+}
+
+/**
+ * Removes the comment from the line, semicolons inside strings are left alone.
+ */
+static void assembler_strip_comment(char *line)
+{
+    char quote = 0;
+    for (; *line; line++)
+    {
+        if (quote)
+        {
+            if (*line == quote)
+                quote = 0;
+        }
+        else if (*line == '\'' || *line == '"')
+        {
+            quote = *line;
+        }
+        else if (*line == ';')
+        {
+            *line = 0x00;
+            return;
+        }
+    }
+}
+
+static void assembler_parse_line(struct assembler *assembler, char *line)
+{
+    char word[ASSEMBLER_MAX_IDENTIFIER];
+    char *ptr = line;
+    assembler_strip_comment(line);
+    assembler_skip_whitespace(&ptr);
+    if (*ptr == 0x00)
+    {
+        return;
+    }
+
+    if (!assembler_read_identifier(assembler, &ptr, word))
+    {
+        assembler_error(assembler, "Unexpected character \"%c\"", *ptr);
+    }
+
+    assembler_skip_whitespace(&ptr);
+    if (*ptr == ':')
+    {
+        ptr++;
+        struct assembler_symbol *symbol = assembler_symbol(assembler, word);
+        assembler_define_label(assembler, symbol);
+        if (word[0] != '.')
+        {
+            assembler->last_label = symbol->name;
+        }
+
+        assembler_skip_whitespace(&ptr);
+        if (*ptr == 0x00)
+        {
+            return;
+        }
+
+        if (!assembler_read_identifier(assembler, &ptr, word))
+        {
+            assembler_error(assembler, "Unexpected character \"%c\"", *ptr);
+        }
+    }
+
+    if (S_EQ(word, "section") || S_EQ(word, "segment"))
+    {
+        assembler_parse_section(assembler, ptr);
+        return;
+    }
+
+    if (S_EQ(word, "global"))
+    {
+        assembler_parse_symbol_flags(assembler, ptr, ASSEMBLER_SYMBOL_FLAG_GLOBAL);
+        return;
+    }
+
+    if (S_EQ(word, "extern"))
+    {
+        assembler_parse_symbol_flags(assembler, ptr, ASSEMBLER_SYMBOL_FLAG_EXTERN);
+        return;
+    }
+
+    long long times = 1;
+    if (S_EQ(word, "times"))
+    {
+        struct assembler_expression exp;
+        assembler_parse_expression(assembler, &ptr, &exp, NULL);
+        if (exp.symbol || exp.value < 0)
+        {
+            assembler_error(assembler, "Invalid times count");
+        }
+        times = exp.value;
+        assembler_read_identifier(assembler, &ptr, word);
+    }
+
+    int element_size = assembler_data_element_size(word);
+    if (element_size)
+    {
+        assembler_parse_data(assembler, element_size, times, ptr);
+        return;
+    }
+
+    if (times != 1)
+    {
+        assembler_error(assembler, "times is only supported for data");
+    }
+
+    assembler_parse_instruction(assembler, word, ptr);
+}
+
+/**
+ * Assigns every statement its offset, short jumps that do not reach are made near jumps.
+ * Jumps only ever grow so this will always finish.
+ */
+static void assembler_layout(struct assembler *assembler)
+{
+    bool changed = true;
+    while (changed)
+    {
+        uint32_t offsets[ASSEMBLER_TOTAL_SECTIONS] = {};
+        vector_set_peek_pointer(assembler->statements, 0);
+        struct assembler_statement *statement = vector_peek_ptr(assembler->statements);
+        while (statement)
+        {
+            statement->offset = offsets[statement->section];
+            if (statement->type == ASSEMBLER_STATEMENT_LABEL)
+            {
+                statement->label->offset = statement->offset;
+            }
+            offsets[statement->section] += statement->size;
+            statement = vector_peek_ptr(assembler->statements);
+        }
+
+        changed = false;
+        vector_set_peek_pointer(assembler->statements, 0);
+        statement = vector_peek_ptr(assembler->statements);
+        while (statement)
+        {
+            if (statement->type == ASSEMBLER_STATEMENT_INSTRUCTION &&
+                statement->instruction.form->operands[0] == X86_OPERAND_REL8 &&
+                !assembler_short_jump_fits(statement))
+            {
+                assembler->line = statement->line;
+                statement->flags |= ASSEMBLER_STATEMENT_FLAG_NEAR_JUMP;
+                assembler_statement_resize(assembler, statement);
+                changed = true;
+            }
+            statement = vector_peek_ptr(assembler->statements);
+        }
+    }
+}
+
+static void assembler_emit_data(struct assembler *assembler, struct assembler_statement *statement, struct buffer *buffer)
+{
+    unsigned char out[8];
+    size_t offset = statement->offset;
+    for (long long i = 0; i < statement->data.times; i++)
+    {
+        vector_set_peek_pointer(statement->data.values, 0);
+        struct assembler_data_value *value = vector_peek(statement->data.values);
+        while (value)
+        {
+            if (value->type == ASSEMBLER_DATA_VALUE_STRING)
+            {
+                size_t padded = (value->len + statement->data.element_size - 1) / statement->data.element_size * statement->data.element_size;
+                for (size_t c = 0; c < padded; c++)
+                {
+                    buffer_write(buffer, c < value->len ? value->str[c] : 0x00);
+                }
+            }
+            else
+            {
+                // Relocations are relative to the statement so pretend it starts here.
+                statement->offset = buffer->len;
+                size_t size = assembler_write_expression(assembler, statement, out, 0, &value->exp, statement->data.element_size, true);
+                for (size_t c = 0; c < size; c++)
+                {
+                    buffer_write(buffer, out[c]);
+                }
+            }
+            value = vector_peek(statement->data.values);
+        }
+    }
+    statement->offset = offset;
+}
+
+static void assembler_emit(struct assembler *assembler)
+{
+    unsigned char out[ASSEMBLER_MAX_INSTRUCTION_SIZE];
+    vector_set_peek_pointer(assembler->statements, 0);
+    struct assembler_statement *statement = vector_peek_ptr(assembler->statements);
+    while (statement)
+    {
+        struct buffer *buffer = assembler->sections[statement->section].data;
+        assert(buffer->len == statement->offset);
+        assembler->line = statement->line;
+        if (statement->type == ASSEMBLER_STATEMENT_INSTRUCTION)
+        {
+            size_t size = assembler_encode_instruction(assembler, statement, out, true);
+            for (size_t i = 0; i < size; i++)
+            {
+                buffer_write(buffer, out[i]);
+            }
+        }
+        else if (statement->type == ASSEMBLER_STATEMENT_DATA)
+        {
+            assembler_emit_data(assembler, statement, buffer);
+        }
+        statement = vector_peek_ptr(assembler->statements);
+    }
+}
+
+int assembler_assemble(const char *source, const char *filename, const char *obj_filename)
+{
+    struct assembler *assembler = assembler_create(filename);
+
+    // We parse the source in place so we need our own copy
+    char *text = strdup(source);
+    char *line = text;
+    while (line)
+    {
+        assembler->line++;
+        char *next = strchr(line, '\n');
+        if (next)
+        {
+            *next = 0x00;
+            next++;
+        }
+        assembler_parse_line(assembler, line);
+        line = next;
+    }
+
+    assembler_layout(assembler);
+    assembler_emit(assembler);
+    int res = assembler_elf_write(assembler, obj_filename);
+
+    // Data statements point into the source so we cant free it any earlier
+    free(text);
+    assembler_free(assembler);
+    return res;
+}
+
+int assembler_assemble_file(const char *asm_filename, const char *obj_filename)
+{
+    FILE *file = fopen(asm_filename, "r");
+    if (!file)
+    {
+        return -1;
+    }
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    char *source = malloc(size + 1);
+    if (fread(source, 1, size, file) != size)
+    {
+        free(source);
+        fclose(file);
+        return -1;
+    }
+    source[size] = 0x00;
+    fclose(file);
+
+    int res = assembler_assemble(source, asm_filename, obj_filename);
+    free(source);
+    return res;
+}
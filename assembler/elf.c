@@ -0,0 +1,262 @@
+/**
+ * Writes the output of the assembler as an ELF32 relocatable object file
+ * that can be passed straight to the linker.
+ */
+#include "compiler.h"
+#include "helpers/buffer.h"
+#include <elf.h>
+
+enum
+{
+    ELF_SECTION_NULL,
+    ELF_SECTION_TEXT,
+    ELF_SECTION_DATA,
+    ELF_SECTION_RODATA,
+    ELF_SECTION_SHSTRTAB,
+    ELF_SECTION_SYMTAB,
+    ELF_SECTION_STRTAB,
+    // The relocation sections come last, only sections with relocations get one.
+    ELF_SECTION_REL_START
+};
+
+static void elf_write(struct buffer *buffer, const void *data, size_t size)
+{
+    const char *ptr = data;
+    for (size_t i = 0; i < size; i++)
+    {
+        buffer_write(buffer, ptr[i]);
+    }
+}
+
+static void elf_align(struct buffer *buffer, size_t alignment)
+{
+    while (buffer->len % alignment)
+    {
+        buffer_write(buffer, 0x00);
+    }
+}
+
+/**
+ * Adds the string to the string table and returns its offset
+ */
+static uint32_t elf_string(struct buffer *strtab, const char *str)
+{
+    uint32_t offset = strtab->len;
+    elf_write(strtab, str, strlen(str) + 1);
+    return offset;
+}
+
+static int elf_section_index(int assembler_section)
+{
+    return ELF_SECTION_TEXT + assembler_section;
+}
+
+static void elf_write_symbol(struct buffer *symtab, uint32_t name, uint32_t value, int bind, int type, int shndx)
+{
+    Elf32_Sym sym = {};
+    sym.st_name = name;
+    sym.st_value = value;
+    sym.st_info = ELF32_ST_INFO(bind, type);
+    sym.st_shndx = shndx;
+    elf_write(symtab, &sym, sizeof(sym));
+}
+
+static bool elf_symbol_is_local(struct assembler_symbol *symbol)
+{
+    return !(symbol->flags & (ASSEMBLER_SYMBOL_FLAG_GLOBAL | ASSEMBLER_SYMBOL_FLAG_EXTERN));
+}
+
+/**
+ * Builds the symbol table. Local symbols must come before the global ones,
+ * returns the index of the first global symbol.
+ */
+static int elf_build_symbols(struct assembler *assembler, struct buffer *symtab, struct buffer *strtab)
+{
+    int index = 0;
+    elf_string(strtab, "");
+    elf_write_symbol(symtab, 0, 0, STB_LOCAL, STT_NOTYPE, SHN_UNDEF);
+    index++;
+
+    elf_write_symbol(symtab, elf_string(strtab, assembler->filename), 0, STB_LOCAL, STT_FILE, SHN_ABS);
+    index++;
+
+    // Section symbols, local symbols are relocated against these.
+    for (int i = 0; i < ASSEMBLER_TOTAL_SECTIONS; i++)
+    {
+        elf_write_symbol(symtab, 0, 0, STB_LOCAL, STT_SECTION, elf_section_index(i));
+        index++;
+    }
+
+    vector_set_peek_pointer(assembler->symbols, 0);
+    struct assembler_symbol *symbol = vector_peek_ptr(assembler->symbols);
+    while (symbol)
+    {
+        // Hidden labels such as "$" are left out just like NASM does
+        if (elf_symbol_is_local(symbol) && (symbol->flags & ASSEMBLER_SYMBOL_FLAG_DEFINED) && strncmp(symbol->name, "..@", 3) != 0)
+        {
+            symbol->index = index++;
+            elf_write_symbol(symtab, elf_string(strtab, symbol->name), symbol->offset, STB_LOCAL, STT_NOTYPE, elf_section_index(symbol->section));
+        }
+        symbol = vector_peek_ptr(assembler->symbols);
+    }
+
+    int first_global = index;
+    vector_set_peek_pointer(assembler->symbols, 0);
+    symbol = vector_peek_ptr(assembler->symbols);
+    while (symbol)
+    {
+        if (!elf_symbol_is_local(symbol))
+        {
+            bool defined = symbol->flags & ASSEMBLER_SYMBOL_FLAG_DEFINED;
+            // Every prototype is declared extern, we only want the ones that are used
+            if (defined || (symbol->flags & ASSEMBLER_SYMBOL_FLAG_REFERENCED))
+            {
+                symbol->index = index++;
+                elf_write_symbol(symtab, elf_string(strtab, symbol->name), defined ? symbol->offset : 0, STB_GLOBAL, STT_NOTYPE, defined ? elf_section_index(symbol->section) : SHN_UNDEF);
+            }
+        }
+        symbol = vector_peek_ptr(assembler->symbols);
+    }
+
+    return first_global;
+}
+
+static void elf_build_relocations(struct assembler_section *section, struct buffer *rel)
+{
+    vector_set_peek_pointer(section->relocations, 0);
+    struct assembler_relocation *relocation = vector_peek(section->relocations);
+    while (relocation)
+    {
+        int type = relocation->type == ASSEMBLER_RELOCATION_PC_RELATIVE ? R_386_PC32 : R_386_32;
+        int symbol_index = relocation->symbol->index;
+        if (elf_symbol_is_local(relocation->symbol))
+        {
+            // The section symbols follow the null and file symbols
+            symbol_index = 2 + relocation->symbol->section;
+        }
+
+        Elf32_Rel rel_entry;
+        rel_entry.r_offset = relocation->offset;
+        rel_entry.r_info = ELF32_R_INFO(symbol_index, type);
+        elf_write(rel, &rel_entry, sizeof(rel_entry));
+        relocation = vector_peek(section->relocations);
+    }
+}
+
+static void elf_section_header(Elf32_Shdr *header, uint32_t name, int type, int flags, uint32_t offset, uint32_t size, int align)
+{
+    memset(header, 0, sizeof(Elf32_Shdr));
+    header->sh_name = name;
+    header->sh_type = type;
+    header->sh_flags = flags;
+    header->sh_offset = offset;
+    header->sh_size = size;
+    header->sh_addralign = align;
+}
+
+int assembler_elf_write(struct assembler *assembler, const char *obj_filename)
+{
+    Elf32_Shdr headers[ELF_SECTION_REL_START + ASSEMBLER_TOTAL_SECTIONS] = {};
+    int total_sections = ELF_SECTION_REL_START;
+    struct buffer *shstrtab = buffer_create();
+    struct buffer *symtab = buffer_create();
+    struct buffer *strtab = buffer_create();
+    struct buffer *out = buffer_create();
+
+    elf_string(shstrtab, "");
+    int first_global = elf_build_symbols(assembler, symtab, strtab);
+
+    // Reserve room for the ELF header, we fill it in at the end
+    Elf32_Ehdr ehdr = {};
+    elf_write(out, &ehdr, sizeof(ehdr));
+
+    static const int section_flags[ASSEMBLER_TOTAL_SECTIONS] = {
+        SHF_ALLOC | SHF_EXECINSTR,
+        SHF_ALLOC | SHF_WRITE,
+        SHF_ALLOC};
+    static const int section_alignment[ASSEMBLER_TOTAL_SECTIONS] = {16, 4, 4};
+
+    for (int i = 0; i < ASSEMBLER_TOTAL_SECTIONS; i++)
+    {
+        struct assembler_section *section = &assembler->sections[i];
+        elf_align(out, section_alignment[i]);
+        elf_section_header(&headers[elf_section_index(i)], elf_string(shstrtab, section->name), SHT_PROGBITS, section_flags[i], out->len, section->data->len, section_alignment[i]);
+        elf_write(out, buffer_ptr(section->data), section->data->len);
+    }
+
+    for (int i = 0; i < ASSEMBLER_TOTAL_SECTIONS; i++)
+    {
+        struct assembler_section *section = &assembler->sections[i];
+        if (vector_count(section->relocations) == 0)
+        {
+            continue;
+        }
+
+        char name[32];
+        sprintf(name, ".rel%s", section->name);
+        struct buffer *rel = buffer_create();
+        elf_build_relocations(section, rel);
+
+        elf_align(out, 4);
+        Elf32_Shdr *header = &headers[total_sections++];
+        elf_section_header(header, elf_string(shstrtab, name), SHT_REL, 0, out->len, rel->len, 4);
+        header->sh_link = ELF_SECTION_SYMTAB;
+        header->sh_info = elf_section_index(i);
+        header->sh_entsize = sizeof(Elf32_Rel);
+        elf_write(out, buffer_ptr(rel), rel->len);
+        buffer_free(rel);
+    }
+
+    elf_align(out, 4);
+    Elf32_Shdr *header = &headers[ELF_SECTION_SYMTAB];
+    elf_section_header(header, elf_string(shstrtab, ".symtab"), SHT_SYMTAB, 0, out->len, symtab->len, 4);
+    header->sh_link = ELF_SECTION_STRTAB;
+    header->sh_info = first_global;
+    header->sh_entsize = sizeof(Elf32_Sym);
+    elf_write(out, buffer_ptr(symtab), symtab->len);
+
+    elf_section_header(&headers[ELF_SECTION_STRTAB], elf_string(shstrtab, ".strtab"), SHT_STRTAB, 0, out->len, strtab->len, 1);
+    elf_write(out, buffer_ptr(strtab), strtab->len);
+
+    // The name of the section header string table must be in the table before we write it.
+    uint32_t shstrtab_name = elf_string(shstrtab, ".shstrtab");
+    elf_section_header(&headers[ELF_SECTION_SHSTRTAB], shstrtab_name, SHT_STRTAB, 0, out->len, shstrtab->len, 1);
+    elf_write(out, buffer_ptr(shstrtab), shstrtab->len);
+
+    elf_align(out, 16);
+    uint32_t shoff = out->len;
+    elf_write(out, headers, sizeof(Elf32_Shdr) * total_sections);
+
+    memcpy(ehdr.e_ident, ELFMAG, SELFMAG);
+    ehdr.e_ident[EI_CLASS] = ELFCLASS32;
+    ehdr.e_ident[EI_DATA] = ELFDATA2LSB;
+    ehdr.e_ident[EI_VERSION] = EV_CURRENT;
+    ehdr.e_ident[EI_OSABI] = ELFOSABI_SYSV;
+    ehdr.e_type = ET_REL;
+    ehdr.e_machine = EM_386;
+    ehdr.e_version = EV_CURRENT;
+    ehdr.e_shoff = shoff;
+    ehdr.e_ehsize = sizeof(Elf32_Ehdr);
+    ehdr.e_shentsize = sizeof(Elf32_Shdr);
+    ehdr.e_shnum = total_sections;
+    ehdr.e_shstrndx = ELF_SECTION_SHSTRTAB;
+    memcpy(buffer_ptr(out), &ehdr, sizeof(ehdr));
+
+    int res = 0;
+    FILE *file = fopen(obj_filename, "wb");
+    if (!file || fwrite(buffer_ptr(out), 1, out->len, file) != out->len)
+    {
+        res = -1;
+    }
+
+    if (file)
+    {
+        fclose(file);
+    }
+
+    buffer_free(shstrtab);
+    buffer_free(symtab);
+    buffer_free(strtab);
+    buffer_free(out);
+    return res;
+}
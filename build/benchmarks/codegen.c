@@ -0,0 +1,20004 @@
+int function_0(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 0;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 0;
+}
+int function_1(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1;
+}
+int function_2(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 2;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 2;
+}
+int function_3(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 3;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 3;
+}
+int function_4(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 4;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 4;
+}
+int function_5(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 5;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 5;
+}
+int function_6(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 6;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 6;
+}
+int function_7(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 7;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 7;
+}
+int function_8(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 8;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 8;
+}
+int function_9(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 9;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 9;
+}
+int function_10(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 10;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 10;
+}
+int function_11(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 11;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 11;
+}
+int function_12(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 12;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 12;
+}
+int function_13(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 13;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 13;
+}
+int function_14(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 14;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 14;
+}
+int function_15(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 15;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 15;
+}
+int function_16(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 16;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 16;
+}
+int function_17(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 17;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 17;
+}
+int function_18(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 18;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 18;
+}
+int function_19(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 19;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 19;
+}
+int function_20(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 20;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 20;
+}
+int function_21(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 21;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 21;
+}
+int function_22(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 22;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 22;
+}
+int function_23(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 23;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 23;
+}
+int function_24(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 24;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 24;
+}
+int function_25(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 25;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 25;
+}
+int function_26(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 26;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 26;
+}
+int function_27(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 27;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 27;
+}
+int function_28(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 28;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 28;
+}
+int function_29(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 29;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 29;
+}
+int function_30(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 30;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 30;
+}
+int function_31(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 31;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 31;
+}
+int function_32(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 32;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 32;
+}
+int function_33(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 33;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 33;
+}
+int function_34(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 34;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 34;
+}
+int function_35(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 35;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 35;
+}
+int function_36(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 36;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 36;
+}
+int function_37(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 37;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 37;
+}
+int function_38(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 38;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 38;
+}
+int function_39(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 39;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 39;
+}
+int function_40(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 40;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 40;
+}
+int function_41(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 41;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 41;
+}
+int function_42(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 42;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 42;
+}
+int function_43(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 43;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 43;
+}
+int function_44(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 44;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 44;
+}
+int function_45(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 45;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 45;
+}
+int function_46(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 46;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 46;
+}
+int function_47(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 47;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 47;
+}
+int function_48(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 48;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 48;
+}
+int function_49(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 49;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 49;
+}
+int function_50(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 50;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 50;
+}
+int function_51(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 51;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 51;
+}
+int function_52(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 52;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 52;
+}
+int function_53(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 53;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 53;
+}
+int function_54(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 54;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 54;
+}
+int function_55(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 55;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 55;
+}
+int function_56(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 56;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 56;
+}
+int function_57(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 57;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 57;
+}
+int function_58(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 58;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 58;
+}
+int function_59(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 59;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 59;
+}
+int function_60(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 60;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 60;
+}
+int function_61(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 61;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 61;
+}
+int function_62(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 62;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 62;
+}
+int function_63(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 63;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 63;
+}
+int function_64(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 64;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 64;
+}
+int function_65(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 65;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 65;
+}
+int function_66(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 66;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 66;
+}
+int function_67(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 67;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 67;
+}
+int function_68(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 68;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 68;
+}
+int function_69(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 69;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 69;
+}
+int function_70(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 70;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 70;
+}
+int function_71(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 71;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 71;
+}
+int function_72(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 72;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 72;
+}
+int function_73(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 73;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 73;
+}
+int function_74(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 74;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 74;
+}
+int function_75(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 75;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 75;
+}
+int function_76(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 76;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 76;
+}
+int function_77(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 77;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 77;
+}
+int function_78(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 78;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 78;
+}
+int function_79(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 79;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 79;
+}
+int function_80(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 80;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 80;
+}
+int function_81(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 81;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 81;
+}
+int function_82(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 82;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 82;
+}
+int function_83(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 83;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 83;
+}
+int function_84(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 84;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 84;
+}
+int function_85(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 85;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 85;
+}
+int function_86(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 86;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 86;
+}
+int function_87(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 87;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 87;
+}
+int function_88(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 88;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 88;
+}
+int function_89(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 89;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 89;
+}
+int function_90(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 90;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 90;
+}
+int function_91(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 91;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 91;
+}
+int function_92(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 92;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 92;
+}
+int function_93(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 93;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 93;
+}
+int function_94(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 94;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 94;
+}
+int function_95(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 95;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 95;
+}
+int function_96(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 96;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 96;
+}
+int function_97(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 97;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 97;
+}
+int function_98(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 98;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 98;
+}
+int function_99(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 99;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 99;
+}
+int function_100(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 100;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 100;
+}
+int function_101(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 101;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 101;
+}
+int function_102(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 102;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 102;
+}
+int function_103(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 103;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 103;
+}
+int function_104(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 104;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 104;
+}
+int function_105(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 105;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 105;
+}
+int function_106(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 106;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 106;
+}
+int function_107(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 107;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 107;
+}
+int function_108(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 108;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 108;
+}
+int function_109(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 109;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 109;
+}
+int function_110(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 110;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 110;
+}
+int function_111(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 111;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 111;
+}
+int function_112(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 112;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 112;
+}
+int function_113(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 113;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 113;
+}
+int function_114(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 114;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 114;
+}
+int function_115(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 115;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 115;
+}
+int function_116(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 116;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 116;
+}
+int function_117(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 117;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 117;
+}
+int function_118(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 118;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 118;
+}
+int function_119(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 119;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 119;
+}
+int function_120(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 120;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 120;
+}
+int function_121(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 121;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 121;
+}
+int function_122(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 122;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 122;
+}
+int function_123(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 123;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 123;
+}
+int function_124(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 124;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 124;
+}
+int function_125(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 125;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 125;
+}
+int function_126(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 126;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 126;
+}
+int function_127(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 127;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 127;
+}
+int function_128(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 128;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 128;
+}
+int function_129(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 129;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 129;
+}
+int function_130(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 130;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 130;
+}
+int function_131(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 131;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 131;
+}
+int function_132(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 132;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 132;
+}
+int function_133(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 133;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 133;
+}
+int function_134(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 134;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 134;
+}
+int function_135(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 135;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 135;
+}
+int function_136(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 136;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 136;
+}
+int function_137(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 137;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 137;
+}
+int function_138(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 138;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 138;
+}
+int function_139(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 139;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 139;
+}
+int function_140(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 140;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 140;
+}
+int function_141(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 141;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 141;
+}
+int function_142(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 142;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 142;
+}
+int function_143(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 143;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 143;
+}
+int function_144(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 144;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 144;
+}
+int function_145(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 145;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 145;
+}
+int function_146(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 146;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 146;
+}
+int function_147(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 147;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 147;
+}
+int function_148(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 148;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 148;
+}
+int function_149(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 149;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 149;
+}
+int function_150(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 150;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 150;
+}
+int function_151(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 151;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 151;
+}
+int function_152(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 152;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 152;
+}
+int function_153(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 153;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 153;
+}
+int function_154(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 154;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 154;
+}
+int function_155(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 155;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 155;
+}
+int function_156(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 156;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 156;
+}
+int function_157(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 157;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 157;
+}
+int function_158(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 158;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 158;
+}
+int function_159(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 159;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 159;
+}
+int function_160(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 160;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 160;
+}
+int function_161(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 161;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 161;
+}
+int function_162(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 162;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 162;
+}
+int function_163(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 163;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 163;
+}
+int function_164(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 164;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 164;
+}
+int function_165(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 165;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 165;
+}
+int function_166(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 166;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 166;
+}
+int function_167(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 167;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 167;
+}
+int function_168(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 168;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 168;
+}
+int function_169(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 169;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 169;
+}
+int function_170(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 170;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 170;
+}
+int function_171(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 171;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 171;
+}
+int function_172(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 172;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 172;
+}
+int function_173(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 173;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 173;
+}
+int function_174(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 174;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 174;
+}
+int function_175(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 175;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 175;
+}
+int function_176(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 176;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 176;
+}
+int function_177(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 177;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 177;
+}
+int function_178(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 178;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 178;
+}
+int function_179(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 179;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 179;
+}
+int function_180(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 180;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 180;
+}
+int function_181(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 181;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 181;
+}
+int function_182(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 182;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 182;
+}
+int function_183(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 183;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 183;
+}
+int function_184(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 184;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 184;
+}
+int function_185(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 185;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 185;
+}
+int function_186(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 186;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 186;
+}
+int function_187(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 187;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 187;
+}
+int function_188(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 188;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 188;
+}
+int function_189(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 189;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 189;
+}
+int function_190(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 190;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 190;
+}
+int function_191(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 191;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 191;
+}
+int function_192(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 192;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 192;
+}
+int function_193(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 193;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 193;
+}
+int function_194(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 194;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 194;
+}
+int function_195(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 195;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 195;
+}
+int function_196(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 196;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 196;
+}
+int function_197(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 197;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 197;
+}
+int function_198(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 198;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 198;
+}
+int function_199(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 199;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 199;
+}
+int function_200(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 200;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 200;
+}
+int function_201(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 201;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 201;
+}
+int function_202(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 202;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 202;
+}
+int function_203(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 203;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 203;
+}
+int function_204(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 204;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 204;
+}
+int function_205(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 205;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 205;
+}
+int function_206(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 206;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 206;
+}
+int function_207(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 207;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 207;
+}
+int function_208(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 208;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 208;
+}
+int function_209(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 209;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 209;
+}
+int function_210(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 210;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 210;
+}
+int function_211(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 211;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 211;
+}
+int function_212(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 212;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 212;
+}
+int function_213(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 213;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 213;
+}
+int function_214(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 214;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 214;
+}
+int function_215(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 215;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 215;
+}
+int function_216(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 216;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 216;
+}
+int function_217(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 217;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 217;
+}
+int function_218(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 218;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 218;
+}
+int function_219(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 219;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 219;
+}
+int function_220(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 220;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 220;
+}
+int function_221(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 221;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 221;
+}
+int function_222(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 222;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 222;
+}
+int function_223(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 223;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 223;
+}
+int function_224(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 224;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 224;
+}
+int function_225(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 225;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 225;
+}
+int function_226(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 226;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 226;
+}
+int function_227(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 227;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 227;
+}
+int function_228(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 228;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 228;
+}
+int function_229(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 229;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 229;
+}
+int function_230(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 230;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 230;
+}
+int function_231(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 231;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 231;
+}
+int function_232(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 232;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 232;
+}
+int function_233(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 233;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 233;
+}
+int function_234(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 234;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 234;
+}
+int function_235(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 235;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 235;
+}
+int function_236(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 236;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 236;
+}
+int function_237(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 237;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 237;
+}
+int function_238(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 238;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 238;
+}
+int function_239(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 239;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 239;
+}
+int function_240(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 240;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 240;
+}
+int function_241(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 241;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 241;
+}
+int function_242(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 242;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 242;
+}
+int function_243(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 243;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 243;
+}
+int function_244(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 244;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 244;
+}
+int function_245(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 245;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 245;
+}
+int function_246(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 246;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 246;
+}
+int function_247(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 247;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 247;
+}
+int function_248(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 248;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 248;
+}
+int function_249(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 249;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 249;
+}
+int function_250(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 250;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 250;
+}
+int function_251(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 251;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 251;
+}
+int function_252(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 252;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 252;
+}
+int function_253(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 253;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 253;
+}
+int function_254(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 254;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 254;
+}
+int function_255(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 255;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 255;
+}
+int function_256(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 256;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 256;
+}
+int function_257(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 257;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 257;
+}
+int function_258(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 258;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 258;
+}
+int function_259(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 259;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 259;
+}
+int function_260(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 260;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 260;
+}
+int function_261(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 261;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 261;
+}
+int function_262(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 262;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 262;
+}
+int function_263(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 263;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 263;
+}
+int function_264(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 264;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 264;
+}
+int function_265(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 265;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 265;
+}
+int function_266(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 266;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 266;
+}
+int function_267(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 267;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 267;
+}
+int function_268(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 268;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 268;
+}
+int function_269(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 269;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 269;
+}
+int function_270(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 270;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 270;
+}
+int function_271(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 271;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 271;
+}
+int function_272(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 272;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 272;
+}
+int function_273(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 273;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 273;
+}
+int function_274(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 274;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 274;
+}
+int function_275(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 275;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 275;
+}
+int function_276(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 276;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 276;
+}
+int function_277(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 277;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 277;
+}
+int function_278(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 278;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 278;
+}
+int function_279(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 279;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 279;
+}
+int function_280(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 280;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 280;
+}
+int function_281(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 281;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 281;
+}
+int function_282(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 282;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 282;
+}
+int function_283(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 283;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 283;
+}
+int function_284(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 284;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 284;
+}
+int function_285(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 285;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 285;
+}
+int function_286(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 286;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 286;
+}
+int function_287(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 287;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 287;
+}
+int function_288(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 288;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 288;
+}
+int function_289(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 289;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 289;
+}
+int function_290(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 290;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 290;
+}
+int function_291(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 291;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 291;
+}
+int function_292(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 292;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 292;
+}
+int function_293(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 293;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 293;
+}
+int function_294(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 294;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 294;
+}
+int function_295(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 295;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 295;
+}
+int function_296(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 296;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 296;
+}
+int function_297(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 297;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 297;
+}
+int function_298(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 298;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 298;
+}
+int function_299(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 299;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 299;
+}
+int function_300(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 300;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 300;
+}
+int function_301(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 301;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 301;
+}
+int function_302(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 302;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 302;
+}
+int function_303(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 303;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 303;
+}
+int function_304(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 304;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 304;
+}
+int function_305(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 305;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 305;
+}
+int function_306(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 306;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 306;
+}
+int function_307(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 307;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 307;
+}
+int function_308(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 308;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 308;
+}
+int function_309(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 309;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 309;
+}
+int function_310(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 310;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 310;
+}
+int function_311(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 311;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 311;
+}
+int function_312(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 312;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 312;
+}
+int function_313(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 313;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 313;
+}
+int function_314(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 314;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 314;
+}
+int function_315(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 315;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 315;
+}
+int function_316(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 316;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 316;
+}
+int function_317(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 317;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 317;
+}
+int function_318(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 318;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 318;
+}
+int function_319(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 319;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 319;
+}
+int function_320(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 320;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 320;
+}
+int function_321(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 321;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 321;
+}
+int function_322(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 322;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 322;
+}
+int function_323(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 323;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 323;
+}
+int function_324(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 324;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 324;
+}
+int function_325(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 325;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 325;
+}
+int function_326(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 326;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 326;
+}
+int function_327(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 327;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 327;
+}
+int function_328(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 328;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 328;
+}
+int function_329(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 329;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 329;
+}
+int function_330(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 330;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 330;
+}
+int function_331(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 331;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 331;
+}
+int function_332(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 332;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 332;
+}
+int function_333(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 333;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 333;
+}
+int function_334(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 334;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 334;
+}
+int function_335(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 335;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 335;
+}
+int function_336(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 336;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 336;
+}
+int function_337(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 337;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 337;
+}
+int function_338(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 338;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 338;
+}
+int function_339(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 339;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 339;
+}
+int function_340(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 340;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 340;
+}
+int function_341(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 341;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 341;
+}
+int function_342(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 342;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 342;
+}
+int function_343(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 343;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 343;
+}
+int function_344(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 344;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 344;
+}
+int function_345(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 345;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 345;
+}
+int function_346(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 346;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 346;
+}
+int function_347(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 347;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 347;
+}
+int function_348(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 348;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 348;
+}
+int function_349(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 349;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 349;
+}
+int function_350(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 350;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 350;
+}
+int function_351(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 351;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 351;
+}
+int function_352(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 352;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 352;
+}
+int function_353(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 353;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 353;
+}
+int function_354(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 354;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 354;
+}
+int function_355(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 355;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 355;
+}
+int function_356(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 356;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 356;
+}
+int function_357(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 357;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 357;
+}
+int function_358(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 358;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 358;
+}
+int function_359(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 359;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 359;
+}
+int function_360(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 360;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 360;
+}
+int function_361(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 361;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 361;
+}
+int function_362(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 362;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 362;
+}
+int function_363(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 363;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 363;
+}
+int function_364(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 364;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 364;
+}
+int function_365(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 365;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 365;
+}
+int function_366(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 366;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 366;
+}
+int function_367(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 367;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 367;
+}
+int function_368(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 368;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 368;
+}
+int function_369(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 369;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 369;
+}
+int function_370(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 370;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 370;
+}
+int function_371(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 371;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 371;
+}
+int function_372(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 372;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 372;
+}
+int function_373(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 373;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 373;
+}
+int function_374(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 374;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 374;
+}
+int function_375(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 375;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 375;
+}
+int function_376(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 376;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 376;
+}
+int function_377(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 377;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 377;
+}
+int function_378(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 378;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 378;
+}
+int function_379(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 379;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 379;
+}
+int function_380(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 380;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 380;
+}
+int function_381(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 381;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 381;
+}
+int function_382(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 382;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 382;
+}
+int function_383(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 383;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 383;
+}
+int function_384(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 384;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 384;
+}
+int function_385(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 385;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 385;
+}
+int function_386(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 386;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 386;
+}
+int function_387(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 387;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 387;
+}
+int function_388(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 388;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 388;
+}
+int function_389(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 389;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 389;
+}
+int function_390(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 390;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 390;
+}
+int function_391(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 391;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 391;
+}
+int function_392(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 392;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 392;
+}
+int function_393(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 393;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 393;
+}
+int function_394(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 394;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 394;
+}
+int function_395(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 395;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 395;
+}
+int function_396(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 396;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 396;
+}
+int function_397(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 397;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 397;
+}
+int function_398(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 398;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 398;
+}
+int function_399(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 399;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 399;
+}
+int function_400(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 400;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 400;
+}
+int function_401(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 401;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 401;
+}
+int function_402(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 402;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 402;
+}
+int function_403(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 403;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 403;
+}
+int function_404(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 404;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 404;
+}
+int function_405(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 405;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 405;
+}
+int function_406(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 406;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 406;
+}
+int function_407(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 407;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 407;
+}
+int function_408(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 408;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 408;
+}
+int function_409(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 409;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 409;
+}
+int function_410(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 410;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 410;
+}
+int function_411(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 411;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 411;
+}
+int function_412(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 412;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 412;
+}
+int function_413(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 413;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 413;
+}
+int function_414(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 414;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 414;
+}
+int function_415(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 415;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 415;
+}
+int function_416(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 416;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 416;
+}
+int function_417(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 417;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 417;
+}
+int function_418(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 418;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 418;
+}
+int function_419(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 419;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 419;
+}
+int function_420(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 420;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 420;
+}
+int function_421(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 421;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 421;
+}
+int function_422(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 422;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 422;
+}
+int function_423(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 423;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 423;
+}
+int function_424(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 424;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 424;
+}
+int function_425(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 425;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 425;
+}
+int function_426(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 426;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 426;
+}
+int function_427(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 427;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 427;
+}
+int function_428(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 428;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 428;
+}
+int function_429(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 429;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 429;
+}
+int function_430(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 430;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 430;
+}
+int function_431(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 431;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 431;
+}
+int function_432(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 432;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 432;
+}
+int function_433(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 433;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 433;
+}
+int function_434(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 434;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 434;
+}
+int function_435(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 435;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 435;
+}
+int function_436(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 436;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 436;
+}
+int function_437(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 437;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 437;
+}
+int function_438(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 438;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 438;
+}
+int function_439(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 439;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 439;
+}
+int function_440(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 440;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 440;
+}
+int function_441(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 441;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 441;
+}
+int function_442(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 442;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 442;
+}
+int function_443(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 443;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 443;
+}
+int function_444(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 444;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 444;
+}
+int function_445(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 445;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 445;
+}
+int function_446(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 446;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 446;
+}
+int function_447(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 447;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 447;
+}
+int function_448(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 448;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 448;
+}
+int function_449(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 449;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 449;
+}
+int function_450(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 450;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 450;
+}
+int function_451(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 451;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 451;
+}
+int function_452(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 452;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 452;
+}
+int function_453(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 453;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 453;
+}
+int function_454(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 454;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 454;
+}
+int function_455(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 455;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 455;
+}
+int function_456(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 456;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 456;
+}
+int function_457(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 457;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 457;
+}
+int function_458(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 458;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 458;
+}
+int function_459(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 459;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 459;
+}
+int function_460(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 460;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 460;
+}
+int function_461(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 461;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 461;
+}
+int function_462(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 462;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 462;
+}
+int function_463(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 463;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 463;
+}
+int function_464(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 464;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 464;
+}
+int function_465(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 465;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 465;
+}
+int function_466(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 466;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 466;
+}
+int function_467(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 467;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 467;
+}
+int function_468(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 468;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 468;
+}
+int function_469(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 469;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 469;
+}
+int function_470(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 470;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 470;
+}
+int function_471(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 471;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 471;
+}
+int function_472(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 472;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 472;
+}
+int function_473(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 473;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 473;
+}
+int function_474(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 474;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 474;
+}
+int function_475(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 475;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 475;
+}
+int function_476(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 476;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 476;
+}
+int function_477(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 477;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 477;
+}
+int function_478(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 478;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 478;
+}
+int function_479(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 479;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 479;
+}
+int function_480(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 480;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 480;
+}
+int function_481(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 481;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 481;
+}
+int function_482(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 482;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 482;
+}
+int function_483(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 483;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 483;
+}
+int function_484(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 484;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 484;
+}
+int function_485(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 485;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 485;
+}
+int function_486(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 486;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 486;
+}
+int function_487(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 487;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 487;
+}
+int function_488(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 488;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 488;
+}
+int function_489(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 489;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 489;
+}
+int function_490(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 490;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 490;
+}
+int function_491(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 491;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 491;
+}
+int function_492(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 492;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 492;
+}
+int function_493(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 493;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 493;
+}
+int function_494(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 494;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 494;
+}
+int function_495(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 495;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 495;
+}
+int function_496(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 496;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 496;
+}
+int function_497(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 497;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 497;
+}
+int function_498(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 498;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 498;
+}
+int function_499(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 499;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 499;
+}
+int function_500(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 500;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 500;
+}
+int function_501(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 501;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 501;
+}
+int function_502(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 502;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 502;
+}
+int function_503(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 503;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 503;
+}
+int function_504(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 504;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 504;
+}
+int function_505(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 505;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 505;
+}
+int function_506(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 506;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 506;
+}
+int function_507(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 507;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 507;
+}
+int function_508(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 508;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 508;
+}
+int function_509(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 509;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 509;
+}
+int function_510(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 510;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 510;
+}
+int function_511(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 511;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 511;
+}
+int function_512(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 512;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 512;
+}
+int function_513(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 513;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 513;
+}
+int function_514(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 514;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 514;
+}
+int function_515(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 515;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 515;
+}
+int function_516(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 516;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 516;
+}
+int function_517(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 517;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 517;
+}
+int function_518(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 518;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 518;
+}
+int function_519(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 519;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 519;
+}
+int function_520(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 520;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 520;
+}
+int function_521(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 521;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 521;
+}
+int function_522(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 522;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 522;
+}
+int function_523(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 523;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 523;
+}
+int function_524(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 524;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 524;
+}
+int function_525(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 525;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 525;
+}
+int function_526(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 526;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 526;
+}
+int function_527(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 527;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 527;
+}
+int function_528(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 528;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 528;
+}
+int function_529(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 529;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 529;
+}
+int function_530(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 530;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 530;
+}
+int function_531(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 531;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 531;
+}
+int function_532(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 532;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 532;
+}
+int function_533(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 533;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 533;
+}
+int function_534(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 534;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 534;
+}
+int function_535(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 535;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 535;
+}
+int function_536(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 536;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 536;
+}
+int function_537(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 537;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 537;
+}
+int function_538(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 538;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 538;
+}
+int function_539(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 539;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 539;
+}
+int function_540(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 540;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 540;
+}
+int function_541(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 541;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 541;
+}
+int function_542(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 542;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 542;
+}
+int function_543(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 543;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 543;
+}
+int function_544(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 544;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 544;
+}
+int function_545(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 545;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 545;
+}
+int function_546(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 546;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 546;
+}
+int function_547(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 547;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 547;
+}
+int function_548(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 548;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 548;
+}
+int function_549(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 549;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 549;
+}
+int function_550(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 550;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 550;
+}
+int function_551(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 551;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 551;
+}
+int function_552(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 552;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 552;
+}
+int function_553(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 553;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 553;
+}
+int function_554(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 554;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 554;
+}
+int function_555(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 555;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 555;
+}
+int function_556(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 556;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 556;
+}
+int function_557(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 557;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 557;
+}
+int function_558(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 558;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 558;
+}
+int function_559(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 559;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 559;
+}
+int function_560(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 560;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 560;
+}
+int function_561(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 561;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 561;
+}
+int function_562(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 562;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 562;
+}
+int function_563(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 563;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 563;
+}
+int function_564(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 564;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 564;
+}
+int function_565(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 565;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 565;
+}
+int function_566(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 566;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 566;
+}
+int function_567(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 567;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 567;
+}
+int function_568(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 568;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 568;
+}
+int function_569(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 569;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 569;
+}
+int function_570(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 570;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 570;
+}
+int function_571(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 571;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 571;
+}
+int function_572(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 572;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 572;
+}
+int function_573(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 573;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 573;
+}
+int function_574(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 574;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 574;
+}
+int function_575(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 575;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 575;
+}
+int function_576(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 576;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 576;
+}
+int function_577(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 577;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 577;
+}
+int function_578(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 578;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 578;
+}
+int function_579(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 579;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 579;
+}
+int function_580(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 580;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 580;
+}
+int function_581(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 581;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 581;
+}
+int function_582(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 582;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 582;
+}
+int function_583(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 583;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 583;
+}
+int function_584(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 584;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 584;
+}
+int function_585(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 585;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 585;
+}
+int function_586(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 586;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 586;
+}
+int function_587(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 587;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 587;
+}
+int function_588(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 588;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 588;
+}
+int function_589(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 589;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 589;
+}
+int function_590(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 590;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 590;
+}
+int function_591(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 591;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 591;
+}
+int function_592(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 592;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 592;
+}
+int function_593(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 593;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 593;
+}
+int function_594(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 594;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 594;
+}
+int function_595(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 595;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 595;
+}
+int function_596(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 596;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 596;
+}
+int function_597(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 597;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 597;
+}
+int function_598(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 598;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 598;
+}
+int function_599(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 599;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 599;
+}
+int function_600(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 600;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 600;
+}
+int function_601(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 601;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 601;
+}
+int function_602(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 602;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 602;
+}
+int function_603(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 603;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 603;
+}
+int function_604(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 604;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 604;
+}
+int function_605(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 605;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 605;
+}
+int function_606(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 606;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 606;
+}
+int function_607(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 607;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 607;
+}
+int function_608(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 608;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 608;
+}
+int function_609(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 609;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 609;
+}
+int function_610(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 610;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 610;
+}
+int function_611(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 611;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 611;
+}
+int function_612(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 612;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 612;
+}
+int function_613(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 613;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 613;
+}
+int function_614(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 614;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 614;
+}
+int function_615(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 615;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 615;
+}
+int function_616(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 616;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 616;
+}
+int function_617(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 617;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 617;
+}
+int function_618(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 618;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 618;
+}
+int function_619(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 619;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 619;
+}
+int function_620(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 620;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 620;
+}
+int function_621(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 621;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 621;
+}
+int function_622(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 622;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 622;
+}
+int function_623(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 623;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 623;
+}
+int function_624(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 624;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 624;
+}
+int function_625(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 625;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 625;
+}
+int function_626(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 626;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 626;
+}
+int function_627(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 627;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 627;
+}
+int function_628(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 628;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 628;
+}
+int function_629(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 629;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 629;
+}
+int function_630(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 630;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 630;
+}
+int function_631(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 631;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 631;
+}
+int function_632(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 632;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 632;
+}
+int function_633(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 633;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 633;
+}
+int function_634(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 634;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 634;
+}
+int function_635(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 635;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 635;
+}
+int function_636(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 636;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 636;
+}
+int function_637(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 637;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 637;
+}
+int function_638(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 638;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 638;
+}
+int function_639(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 639;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 639;
+}
+int function_640(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 640;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 640;
+}
+int function_641(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 641;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 641;
+}
+int function_642(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 642;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 642;
+}
+int function_643(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 643;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 643;
+}
+int function_644(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 644;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 644;
+}
+int function_645(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 645;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 645;
+}
+int function_646(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 646;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 646;
+}
+int function_647(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 647;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 647;
+}
+int function_648(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 648;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 648;
+}
+int function_649(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 649;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 649;
+}
+int function_650(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 650;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 650;
+}
+int function_651(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 651;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 651;
+}
+int function_652(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 652;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 652;
+}
+int function_653(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 653;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 653;
+}
+int function_654(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 654;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 654;
+}
+int function_655(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 655;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 655;
+}
+int function_656(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 656;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 656;
+}
+int function_657(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 657;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 657;
+}
+int function_658(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 658;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 658;
+}
+int function_659(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 659;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 659;
+}
+int function_660(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 660;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 660;
+}
+int function_661(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 661;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 661;
+}
+int function_662(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 662;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 662;
+}
+int function_663(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 663;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 663;
+}
+int function_664(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 664;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 664;
+}
+int function_665(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 665;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 665;
+}
+int function_666(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 666;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 666;
+}
+int function_667(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 667;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 667;
+}
+int function_668(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 668;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 668;
+}
+int function_669(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 669;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 669;
+}
+int function_670(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 670;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 670;
+}
+int function_671(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 671;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 671;
+}
+int function_672(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 672;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 672;
+}
+int function_673(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 673;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 673;
+}
+int function_674(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 674;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 674;
+}
+int function_675(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 675;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 675;
+}
+int function_676(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 676;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 676;
+}
+int function_677(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 677;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 677;
+}
+int function_678(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 678;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 678;
+}
+int function_679(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 679;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 679;
+}
+int function_680(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 680;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 680;
+}
+int function_681(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 681;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 681;
+}
+int function_682(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 682;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 682;
+}
+int function_683(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 683;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 683;
+}
+int function_684(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 684;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 684;
+}
+int function_685(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 685;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 685;
+}
+int function_686(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 686;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 686;
+}
+int function_687(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 687;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 687;
+}
+int function_688(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 688;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 688;
+}
+int function_689(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 689;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 689;
+}
+int function_690(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 690;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 690;
+}
+int function_691(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 691;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 691;
+}
+int function_692(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 692;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 692;
+}
+int function_693(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 693;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 693;
+}
+int function_694(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 694;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 694;
+}
+int function_695(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 695;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 695;
+}
+int function_696(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 696;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 696;
+}
+int function_697(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 697;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 697;
+}
+int function_698(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 698;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 698;
+}
+int function_699(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 699;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 699;
+}
+int function_700(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 700;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 700;
+}
+int function_701(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 701;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 701;
+}
+int function_702(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 702;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 702;
+}
+int function_703(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 703;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 703;
+}
+int function_704(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 704;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 704;
+}
+int function_705(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 705;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 705;
+}
+int function_706(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 706;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 706;
+}
+int function_707(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 707;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 707;
+}
+int function_708(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 708;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 708;
+}
+int function_709(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 709;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 709;
+}
+int function_710(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 710;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 710;
+}
+int function_711(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 711;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 711;
+}
+int function_712(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 712;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 712;
+}
+int function_713(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 713;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 713;
+}
+int function_714(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 714;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 714;
+}
+int function_715(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 715;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 715;
+}
+int function_716(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 716;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 716;
+}
+int function_717(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 717;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 717;
+}
+int function_718(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 718;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 718;
+}
+int function_719(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 719;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 719;
+}
+int function_720(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 720;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 720;
+}
+int function_721(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 721;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 721;
+}
+int function_722(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 722;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 722;
+}
+int function_723(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 723;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 723;
+}
+int function_724(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 724;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 724;
+}
+int function_725(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 725;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 725;
+}
+int function_726(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 726;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 726;
+}
+int function_727(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 727;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 727;
+}
+int function_728(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 728;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 728;
+}
+int function_729(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 729;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 729;
+}
+int function_730(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 730;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 730;
+}
+int function_731(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 731;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 731;
+}
+int function_732(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 732;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 732;
+}
+int function_733(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 733;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 733;
+}
+int function_734(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 734;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 734;
+}
+int function_735(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 735;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 735;
+}
+int function_736(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 736;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 736;
+}
+int function_737(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 737;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 737;
+}
+int function_738(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 738;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 738;
+}
+int function_739(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 739;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 739;
+}
+int function_740(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 740;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 740;
+}
+int function_741(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 741;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 741;
+}
+int function_742(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 742;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 742;
+}
+int function_743(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 743;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 743;
+}
+int function_744(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 744;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 744;
+}
+int function_745(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 745;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 745;
+}
+int function_746(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 746;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 746;
+}
+int function_747(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 747;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 747;
+}
+int function_748(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 748;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 748;
+}
+int function_749(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 749;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 749;
+}
+int function_750(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 750;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 750;
+}
+int function_751(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 751;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 751;
+}
+int function_752(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 752;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 752;
+}
+int function_753(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 753;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 753;
+}
+int function_754(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 754;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 754;
+}
+int function_755(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 755;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 755;
+}
+int function_756(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 756;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 756;
+}
+int function_757(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 757;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 757;
+}
+int function_758(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 758;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 758;
+}
+int function_759(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 759;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 759;
+}
+int function_760(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 760;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 760;
+}
+int function_761(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 761;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 761;
+}
+int function_762(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 762;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 762;
+}
+int function_763(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 763;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 763;
+}
+int function_764(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 764;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 764;
+}
+int function_765(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 765;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 765;
+}
+int function_766(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 766;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 766;
+}
+int function_767(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 767;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 767;
+}
+int function_768(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 768;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 768;
+}
+int function_769(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 769;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 769;
+}
+int function_770(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 770;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 770;
+}
+int function_771(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 771;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 771;
+}
+int function_772(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 772;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 772;
+}
+int function_773(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 773;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 773;
+}
+int function_774(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 774;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 774;
+}
+int function_775(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 775;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 775;
+}
+int function_776(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 776;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 776;
+}
+int function_777(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 777;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 777;
+}
+int function_778(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 778;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 778;
+}
+int function_779(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 779;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 779;
+}
+int function_780(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 780;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 780;
+}
+int function_781(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 781;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 781;
+}
+int function_782(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 782;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 782;
+}
+int function_783(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 783;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 783;
+}
+int function_784(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 784;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 784;
+}
+int function_785(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 785;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 785;
+}
+int function_786(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 786;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 786;
+}
+int function_787(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 787;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 787;
+}
+int function_788(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 788;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 788;
+}
+int function_789(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 789;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 789;
+}
+int function_790(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 790;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 790;
+}
+int function_791(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 791;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 791;
+}
+int function_792(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 792;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 792;
+}
+int function_793(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 793;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 793;
+}
+int function_794(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 794;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 794;
+}
+int function_795(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 795;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 795;
+}
+int function_796(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 796;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 796;
+}
+int function_797(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 797;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 797;
+}
+int function_798(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 798;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 798;
+}
+int function_799(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 799;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 799;
+}
+int function_800(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 800;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 800;
+}
+int function_801(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 801;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 801;
+}
+int function_802(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 802;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 802;
+}
+int function_803(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 803;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 803;
+}
+int function_804(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 804;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 804;
+}
+int function_805(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 805;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 805;
+}
+int function_806(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 806;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 806;
+}
+int function_807(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 807;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 807;
+}
+int function_808(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 808;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 808;
+}
+int function_809(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 809;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 809;
+}
+int function_810(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 810;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 810;
+}
+int function_811(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 811;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 811;
+}
+int function_812(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 812;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 812;
+}
+int function_813(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 813;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 813;
+}
+int function_814(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 814;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 814;
+}
+int function_815(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 815;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 815;
+}
+int function_816(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 816;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 816;
+}
+int function_817(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 817;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 817;
+}
+int function_818(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 818;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 818;
+}
+int function_819(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 819;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 819;
+}
+int function_820(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 820;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 820;
+}
+int function_821(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 821;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 821;
+}
+int function_822(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 822;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 822;
+}
+int function_823(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 823;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 823;
+}
+int function_824(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 824;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 824;
+}
+int function_825(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 825;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 825;
+}
+int function_826(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 826;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 826;
+}
+int function_827(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 827;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 827;
+}
+int function_828(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 828;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 828;
+}
+int function_829(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 829;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 829;
+}
+int function_830(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 830;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 830;
+}
+int function_831(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 831;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 831;
+}
+int function_832(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 832;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 832;
+}
+int function_833(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 833;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 833;
+}
+int function_834(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 834;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 834;
+}
+int function_835(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 835;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 835;
+}
+int function_836(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 836;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 836;
+}
+int function_837(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 837;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 837;
+}
+int function_838(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 838;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 838;
+}
+int function_839(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 839;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 839;
+}
+int function_840(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 840;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 840;
+}
+int function_841(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 841;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 841;
+}
+int function_842(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 842;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 842;
+}
+int function_843(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 843;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 843;
+}
+int function_844(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 844;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 844;
+}
+int function_845(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 845;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 845;
+}
+int function_846(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 846;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 846;
+}
+int function_847(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 847;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 847;
+}
+int function_848(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 848;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 848;
+}
+int function_849(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 849;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 849;
+}
+int function_850(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 850;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 850;
+}
+int function_851(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 851;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 851;
+}
+int function_852(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 852;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 852;
+}
+int function_853(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 853;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 853;
+}
+int function_854(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 854;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 854;
+}
+int function_855(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 855;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 855;
+}
+int function_856(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 856;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 856;
+}
+int function_857(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 857;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 857;
+}
+int function_858(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 858;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 858;
+}
+int function_859(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 859;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 859;
+}
+int function_860(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 860;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 860;
+}
+int function_861(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 861;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 861;
+}
+int function_862(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 862;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 862;
+}
+int function_863(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 863;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 863;
+}
+int function_864(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 864;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 864;
+}
+int function_865(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 865;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 865;
+}
+int function_866(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 866;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 866;
+}
+int function_867(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 867;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 867;
+}
+int function_868(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 868;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 868;
+}
+int function_869(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 869;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 869;
+}
+int function_870(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 870;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 870;
+}
+int function_871(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 871;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 871;
+}
+int function_872(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 872;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 872;
+}
+int function_873(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 873;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 873;
+}
+int function_874(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 874;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 874;
+}
+int function_875(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 875;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 875;
+}
+int function_876(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 876;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 876;
+}
+int function_877(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 877;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 877;
+}
+int function_878(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 878;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 878;
+}
+int function_879(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 879;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 879;
+}
+int function_880(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 880;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 880;
+}
+int function_881(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 881;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 881;
+}
+int function_882(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 882;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 882;
+}
+int function_883(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 883;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 883;
+}
+int function_884(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 884;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 884;
+}
+int function_885(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 885;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 885;
+}
+int function_886(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 886;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 886;
+}
+int function_887(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 887;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 887;
+}
+int function_888(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 888;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 888;
+}
+int function_889(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 889;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 889;
+}
+int function_890(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 890;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 890;
+}
+int function_891(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 891;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 891;
+}
+int function_892(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 892;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 892;
+}
+int function_893(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 893;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 893;
+}
+int function_894(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 894;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 894;
+}
+int function_895(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 895;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 895;
+}
+int function_896(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 896;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 896;
+}
+int function_897(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 897;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 897;
+}
+int function_898(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 898;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 898;
+}
+int function_899(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 899;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 899;
+}
+int function_900(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 900;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 900;
+}
+int function_901(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 901;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 901;
+}
+int function_902(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 902;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 902;
+}
+int function_903(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 903;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 903;
+}
+int function_904(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 904;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 904;
+}
+int function_905(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 905;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 905;
+}
+int function_906(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 906;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 906;
+}
+int function_907(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 907;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 907;
+}
+int function_908(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 908;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 908;
+}
+int function_909(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 909;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 909;
+}
+int function_910(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 910;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 910;
+}
+int function_911(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 911;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 911;
+}
+int function_912(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 912;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 912;
+}
+int function_913(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 913;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 913;
+}
+int function_914(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 914;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 914;
+}
+int function_915(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 915;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 915;
+}
+int function_916(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 916;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 916;
+}
+int function_917(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 917;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 917;
+}
+int function_918(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 918;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 918;
+}
+int function_919(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 919;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 919;
+}
+int function_920(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 920;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 920;
+}
+int function_921(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 921;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 921;
+}
+int function_922(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 922;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 922;
+}
+int function_923(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 923;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 923;
+}
+int function_924(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 924;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 924;
+}
+int function_925(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 925;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 925;
+}
+int function_926(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 926;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 926;
+}
+int function_927(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 927;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 927;
+}
+int function_928(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 928;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 928;
+}
+int function_929(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 929;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 929;
+}
+int function_930(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 930;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 930;
+}
+int function_931(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 931;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 931;
+}
+int function_932(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 932;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 932;
+}
+int function_933(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 933;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 933;
+}
+int function_934(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 934;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 934;
+}
+int function_935(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 935;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 935;
+}
+int function_936(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 936;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 936;
+}
+int function_937(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 937;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 937;
+}
+int function_938(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 938;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 938;
+}
+int function_939(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 939;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 939;
+}
+int function_940(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 940;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 940;
+}
+int function_941(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 941;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 941;
+}
+int function_942(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 942;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 942;
+}
+int function_943(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 943;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 943;
+}
+int function_944(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 944;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 944;
+}
+int function_945(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 945;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 945;
+}
+int function_946(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 946;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 946;
+}
+int function_947(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 947;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 947;
+}
+int function_948(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 948;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 948;
+}
+int function_949(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 949;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 949;
+}
+int function_950(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 950;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 950;
+}
+int function_951(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 951;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 951;
+}
+int function_952(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 952;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 952;
+}
+int function_953(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 953;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 953;
+}
+int function_954(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 954;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 954;
+}
+int function_955(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 955;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 955;
+}
+int function_956(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 956;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 956;
+}
+int function_957(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 957;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 957;
+}
+int function_958(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 958;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 958;
+}
+int function_959(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 959;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 959;
+}
+int function_960(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 960;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 960;
+}
+int function_961(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 961;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 961;
+}
+int function_962(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 962;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 962;
+}
+int function_963(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 963;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 963;
+}
+int function_964(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 964;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 964;
+}
+int function_965(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 965;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 965;
+}
+int function_966(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 966;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 966;
+}
+int function_967(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 967;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 967;
+}
+int function_968(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 968;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 968;
+}
+int function_969(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 969;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 969;
+}
+int function_970(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 970;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 970;
+}
+int function_971(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 971;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 971;
+}
+int function_972(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 972;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 972;
+}
+int function_973(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 973;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 973;
+}
+int function_974(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 974;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 974;
+}
+int function_975(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 975;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 975;
+}
+int function_976(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 976;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 976;
+}
+int function_977(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 977;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 977;
+}
+int function_978(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 978;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 978;
+}
+int function_979(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 979;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 979;
+}
+int function_980(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 980;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 980;
+}
+int function_981(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 981;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 981;
+}
+int function_982(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 982;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 982;
+}
+int function_983(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 983;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 983;
+}
+int function_984(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 984;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 984;
+}
+int function_985(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 985;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 985;
+}
+int function_986(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 986;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 986;
+}
+int function_987(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 987;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 987;
+}
+int function_988(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 988;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 988;
+}
+int function_989(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 989;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 989;
+}
+int function_990(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 990;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 990;
+}
+int function_991(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 991;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 991;
+}
+int function_992(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 992;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 992;
+}
+int function_993(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 993;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 993;
+}
+int function_994(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 994;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 994;
+}
+int function_995(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 995;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 995;
+}
+int function_996(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 996;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 996;
+}
+int function_997(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 997;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 997;
+}
+int function_998(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 998;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 998;
+}
+int function_999(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 999;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 999;
+}
+int function_1000(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1000;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1000;
+}
+int function_1001(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1001;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1001;
+}
+int function_1002(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1002;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1002;
+}
+int function_1003(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1003;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1003;
+}
+int function_1004(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1004;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1004;
+}
+int function_1005(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1005;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1005;
+}
+int function_1006(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1006;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1006;
+}
+int function_1007(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1007;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1007;
+}
+int function_1008(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1008;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1008;
+}
+int function_1009(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1009;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1009;
+}
+int function_1010(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1010;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1010;
+}
+int function_1011(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1011;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1011;
+}
+int function_1012(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1012;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1012;
+}
+int function_1013(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1013;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1013;
+}
+int function_1014(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1014;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1014;
+}
+int function_1015(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1015;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1015;
+}
+int function_1016(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1016;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1016;
+}
+int function_1017(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1017;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1017;
+}
+int function_1018(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1018;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1018;
+}
+int function_1019(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1019;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1019;
+}
+int function_1020(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1020;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1020;
+}
+int function_1021(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1021;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1021;
+}
+int function_1022(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1022;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1022;
+}
+int function_1023(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1023;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1023;
+}
+int function_1024(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1024;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1024;
+}
+int function_1025(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1025;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1025;
+}
+int function_1026(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1026;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1026;
+}
+int function_1027(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1027;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1027;
+}
+int function_1028(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1028;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1028;
+}
+int function_1029(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1029;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1029;
+}
+int function_1030(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1030;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1030;
+}
+int function_1031(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1031;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1031;
+}
+int function_1032(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1032;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1032;
+}
+int function_1033(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1033;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1033;
+}
+int function_1034(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1034;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1034;
+}
+int function_1035(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1035;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1035;
+}
+int function_1036(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1036;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1036;
+}
+int function_1037(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1037;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1037;
+}
+int function_1038(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1038;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1038;
+}
+int function_1039(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1039;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1039;
+}
+int function_1040(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1040;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1040;
+}
+int function_1041(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1041;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1041;
+}
+int function_1042(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1042;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1042;
+}
+int function_1043(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1043;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1043;
+}
+int function_1044(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1044;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1044;
+}
+int function_1045(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1045;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1045;
+}
+int function_1046(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1046;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1046;
+}
+int function_1047(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1047;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1047;
+}
+int function_1048(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1048;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1048;
+}
+int function_1049(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1049;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1049;
+}
+int function_1050(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1050;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1050;
+}
+int function_1051(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1051;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1051;
+}
+int function_1052(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1052;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1052;
+}
+int function_1053(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1053;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1053;
+}
+int function_1054(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1054;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1054;
+}
+int function_1055(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1055;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1055;
+}
+int function_1056(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1056;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1056;
+}
+int function_1057(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1057;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1057;
+}
+int function_1058(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1058;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1058;
+}
+int function_1059(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1059;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1059;
+}
+int function_1060(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1060;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1060;
+}
+int function_1061(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1061;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1061;
+}
+int function_1062(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1062;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1062;
+}
+int function_1063(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1063;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1063;
+}
+int function_1064(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1064;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1064;
+}
+int function_1065(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1065;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1065;
+}
+int function_1066(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1066;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1066;
+}
+int function_1067(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1067;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1067;
+}
+int function_1068(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1068;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1068;
+}
+int function_1069(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1069;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1069;
+}
+int function_1070(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1070;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1070;
+}
+int function_1071(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1071;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1071;
+}
+int function_1072(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1072;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1072;
+}
+int function_1073(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1073;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1073;
+}
+int function_1074(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1074;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1074;
+}
+int function_1075(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1075;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1075;
+}
+int function_1076(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1076;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1076;
+}
+int function_1077(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1077;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1077;
+}
+int function_1078(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1078;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1078;
+}
+int function_1079(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1079;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1079;
+}
+int function_1080(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1080;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1080;
+}
+int function_1081(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1081;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1081;
+}
+int function_1082(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1082;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1082;
+}
+int function_1083(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1083;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1083;
+}
+int function_1084(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1084;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1084;
+}
+int function_1085(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1085;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1085;
+}
+int function_1086(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1086;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1086;
+}
+int function_1087(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1087;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1087;
+}
+int function_1088(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1088;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1088;
+}
+int function_1089(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1089;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1089;
+}
+int function_1090(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1090;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1090;
+}
+int function_1091(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1091;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1091;
+}
+int function_1092(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1092;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1092;
+}
+int function_1093(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1093;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1093;
+}
+int function_1094(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1094;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1094;
+}
+int function_1095(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1095;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1095;
+}
+int function_1096(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1096;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1096;
+}
+int function_1097(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1097;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1097;
+}
+int function_1098(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1098;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1098;
+}
+int function_1099(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1099;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1099;
+}
+int function_1100(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1100;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1100;
+}
+int function_1101(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1101;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1101;
+}
+int function_1102(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1102;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1102;
+}
+int function_1103(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1103;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1103;
+}
+int function_1104(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1104;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1104;
+}
+int function_1105(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1105;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1105;
+}
+int function_1106(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1106;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1106;
+}
+int function_1107(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1107;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1107;
+}
+int function_1108(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1108;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1108;
+}
+int function_1109(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1109;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1109;
+}
+int function_1110(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1110;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1110;
+}
+int function_1111(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1111;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1111;
+}
+int function_1112(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1112;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1112;
+}
+int function_1113(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1113;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1113;
+}
+int function_1114(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1114;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1114;
+}
+int function_1115(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1115;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1115;
+}
+int function_1116(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1116;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1116;
+}
+int function_1117(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1117;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1117;
+}
+int function_1118(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1118;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1118;
+}
+int function_1119(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1119;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1119;
+}
+int function_1120(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1120;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1120;
+}
+int function_1121(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1121;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1121;
+}
+int function_1122(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1122;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1122;
+}
+int function_1123(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1123;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1123;
+}
+int function_1124(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1124;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1124;
+}
+int function_1125(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1125;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1125;
+}
+int function_1126(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1126;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1126;
+}
+int function_1127(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1127;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1127;
+}
+int function_1128(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1128;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1128;
+}
+int function_1129(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1129;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1129;
+}
+int function_1130(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1130;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1130;
+}
+int function_1131(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1131;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1131;
+}
+int function_1132(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1132;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1132;
+}
+int function_1133(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1133;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1133;
+}
+int function_1134(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1134;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1134;
+}
+int function_1135(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1135;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1135;
+}
+int function_1136(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1136;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1136;
+}
+int function_1137(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1137;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1137;
+}
+int function_1138(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1138;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1138;
+}
+int function_1139(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1139;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1139;
+}
+int function_1140(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1140;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1140;
+}
+int function_1141(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1141;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1141;
+}
+int function_1142(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1142;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1142;
+}
+int function_1143(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1143;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1143;
+}
+int function_1144(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1144;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1144;
+}
+int function_1145(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1145;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1145;
+}
+int function_1146(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1146;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1146;
+}
+int function_1147(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1147;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1147;
+}
+int function_1148(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1148;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1148;
+}
+int function_1149(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1149;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1149;
+}
+int function_1150(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1150;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1150;
+}
+int function_1151(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1151;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1151;
+}
+int function_1152(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1152;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1152;
+}
+int function_1153(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1153;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1153;
+}
+int function_1154(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1154;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1154;
+}
+int function_1155(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1155;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1155;
+}
+int function_1156(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1156;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1156;
+}
+int function_1157(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1157;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1157;
+}
+int function_1158(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1158;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1158;
+}
+int function_1159(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1159;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1159;
+}
+int function_1160(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1160;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1160;
+}
+int function_1161(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1161;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1161;
+}
+int function_1162(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1162;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1162;
+}
+int function_1163(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1163;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1163;
+}
+int function_1164(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1164;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1164;
+}
+int function_1165(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1165;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1165;
+}
+int function_1166(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1166;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1166;
+}
+int function_1167(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1167;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1167;
+}
+int function_1168(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1168;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1168;
+}
+int function_1169(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1169;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1169;
+}
+int function_1170(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1170;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1170;
+}
+int function_1171(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1171;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1171;
+}
+int function_1172(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1172;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1172;
+}
+int function_1173(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1173;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1173;
+}
+int function_1174(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1174;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1174;
+}
+int function_1175(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1175;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1175;
+}
+int function_1176(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1176;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1176;
+}
+int function_1177(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1177;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1177;
+}
+int function_1178(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1178;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1178;
+}
+int function_1179(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1179;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1179;
+}
+int function_1180(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1180;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1180;
+}
+int function_1181(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1181;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1181;
+}
+int function_1182(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1182;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1182;
+}
+int function_1183(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1183;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1183;
+}
+int function_1184(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1184;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1184;
+}
+int function_1185(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1185;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1185;
+}
+int function_1186(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1186;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1186;
+}
+int function_1187(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1187;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1187;
+}
+int function_1188(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1188;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1188;
+}
+int function_1189(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1189;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1189;
+}
+int function_1190(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1190;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1190;
+}
+int function_1191(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1191;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1191;
+}
+int function_1192(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1192;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1192;
+}
+int function_1193(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1193;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1193;
+}
+int function_1194(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1194;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1194;
+}
+int function_1195(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1195;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1195;
+}
+int function_1196(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1196;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1196;
+}
+int function_1197(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1197;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1197;
+}
+int function_1198(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1198;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1198;
+}
+int function_1199(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1199;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1199;
+}
+int function_1200(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1200;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1200;
+}
+int function_1201(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1201;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1201;
+}
+int function_1202(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1202;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1202;
+}
+int function_1203(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1203;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1203;
+}
+int function_1204(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1204;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1204;
+}
+int function_1205(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1205;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1205;
+}
+int function_1206(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1206;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1206;
+}
+int function_1207(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1207;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1207;
+}
+int function_1208(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1208;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1208;
+}
+int function_1209(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1209;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1209;
+}
+int function_1210(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1210;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1210;
+}
+int function_1211(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1211;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1211;
+}
+int function_1212(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1212;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1212;
+}
+int function_1213(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1213;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1213;
+}
+int function_1214(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1214;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1214;
+}
+int function_1215(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1215;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1215;
+}
+int function_1216(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1216;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1216;
+}
+int function_1217(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1217;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1217;
+}
+int function_1218(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1218;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1218;
+}
+int function_1219(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1219;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1219;
+}
+int function_1220(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1220;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1220;
+}
+int function_1221(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1221;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1221;
+}
+int function_1222(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1222;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1222;
+}
+int function_1223(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1223;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1223;
+}
+int function_1224(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1224;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1224;
+}
+int function_1225(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1225;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1225;
+}
+int function_1226(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1226;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1226;
+}
+int function_1227(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1227;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1227;
+}
+int function_1228(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1228;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1228;
+}
+int function_1229(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1229;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1229;
+}
+int function_1230(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1230;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1230;
+}
+int function_1231(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1231;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1231;
+}
+int function_1232(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1232;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1232;
+}
+int function_1233(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1233;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1233;
+}
+int function_1234(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1234;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1234;
+}
+int function_1235(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1235;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1235;
+}
+int function_1236(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1236;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1236;
+}
+int function_1237(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1237;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1237;
+}
+int function_1238(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1238;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1238;
+}
+int function_1239(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1239;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1239;
+}
+int function_1240(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1240;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1240;
+}
+int function_1241(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1241;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1241;
+}
+int function_1242(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1242;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1242;
+}
+int function_1243(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1243;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1243;
+}
+int function_1244(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1244;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1244;
+}
+int function_1245(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1245;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1245;
+}
+int function_1246(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1246;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1246;
+}
+int function_1247(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1247;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1247;
+}
+int function_1248(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1248;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1248;
+}
+int function_1249(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1249;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1249;
+}
+int function_1250(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1250;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1250;
+}
+int function_1251(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1251;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1251;
+}
+int function_1252(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1252;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1252;
+}
+int function_1253(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1253;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1253;
+}
+int function_1254(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1254;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1254;
+}
+int function_1255(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1255;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1255;
+}
+int function_1256(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1256;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1256;
+}
+int function_1257(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1257;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1257;
+}
+int function_1258(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1258;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1258;
+}
+int function_1259(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1259;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1259;
+}
+int function_1260(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1260;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1260;
+}
+int function_1261(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1261;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1261;
+}
+int function_1262(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1262;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1262;
+}
+int function_1263(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1263;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1263;
+}
+int function_1264(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1264;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1264;
+}
+int function_1265(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1265;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1265;
+}
+int function_1266(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1266;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1266;
+}
+int function_1267(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1267;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1267;
+}
+int function_1268(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1268;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1268;
+}
+int function_1269(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1269;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1269;
+}
+int function_1270(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1270;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1270;
+}
+int function_1271(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1271;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1271;
+}
+int function_1272(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1272;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1272;
+}
+int function_1273(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1273;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1273;
+}
+int function_1274(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1274;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1274;
+}
+int function_1275(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1275;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1275;
+}
+int function_1276(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1276;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1276;
+}
+int function_1277(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1277;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1277;
+}
+int function_1278(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1278;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1278;
+}
+int function_1279(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1279;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1279;
+}
+int function_1280(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1280;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1280;
+}
+int function_1281(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1281;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1281;
+}
+int function_1282(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1282;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1282;
+}
+int function_1283(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1283;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1283;
+}
+int function_1284(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1284;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1284;
+}
+int function_1285(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1285;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1285;
+}
+int function_1286(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1286;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1286;
+}
+int function_1287(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1287;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1287;
+}
+int function_1288(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1288;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1288;
+}
+int function_1289(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1289;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1289;
+}
+int function_1290(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1290;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1290;
+}
+int function_1291(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1291;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1291;
+}
+int function_1292(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1292;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1292;
+}
+int function_1293(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1293;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1293;
+}
+int function_1294(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1294;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1294;
+}
+int function_1295(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1295;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1295;
+}
+int function_1296(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1296;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1296;
+}
+int function_1297(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1297;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1297;
+}
+int function_1298(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1298;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1298;
+}
+int function_1299(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1299;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1299;
+}
+int function_1300(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1300;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1300;
+}
+int function_1301(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1301;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1301;
+}
+int function_1302(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1302;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1302;
+}
+int function_1303(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1303;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1303;
+}
+int function_1304(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1304;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1304;
+}
+int function_1305(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1305;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1305;
+}
+int function_1306(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1306;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1306;
+}
+int function_1307(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1307;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1307;
+}
+int function_1308(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1308;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1308;
+}
+int function_1309(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1309;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1309;
+}
+int function_1310(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1310;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1310;
+}
+int function_1311(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1311;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1311;
+}
+int function_1312(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1312;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1312;
+}
+int function_1313(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1313;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1313;
+}
+int function_1314(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1314;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1314;
+}
+int function_1315(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1315;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1315;
+}
+int function_1316(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1316;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1316;
+}
+int function_1317(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1317;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1317;
+}
+int function_1318(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1318;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1318;
+}
+int function_1319(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1319;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1319;
+}
+int function_1320(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1320;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1320;
+}
+int function_1321(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1321;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1321;
+}
+int function_1322(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1322;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1322;
+}
+int function_1323(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1323;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1323;
+}
+int function_1324(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1324;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1324;
+}
+int function_1325(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1325;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1325;
+}
+int function_1326(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1326;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1326;
+}
+int function_1327(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1327;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1327;
+}
+int function_1328(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1328;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1328;
+}
+int function_1329(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1329;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1329;
+}
+int function_1330(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1330;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1330;
+}
+int function_1331(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1331;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1331;
+}
+int function_1332(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1332;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1332;
+}
+int function_1333(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1333;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1333;
+}
+int function_1334(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1334;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1334;
+}
+int function_1335(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1335;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1335;
+}
+int function_1336(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1336;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1336;
+}
+int function_1337(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1337;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1337;
+}
+int function_1338(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1338;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1338;
+}
+int function_1339(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1339;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1339;
+}
+int function_1340(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1340;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1340;
+}
+int function_1341(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1341;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1341;
+}
+int function_1342(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1342;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1342;
+}
+int function_1343(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1343;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1343;
+}
+int function_1344(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1344;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1344;
+}
+int function_1345(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1345;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1345;
+}
+int function_1346(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1346;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1346;
+}
+int function_1347(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1347;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1347;
+}
+int function_1348(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1348;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1348;
+}
+int function_1349(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1349;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1349;
+}
+int function_1350(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1350;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1350;
+}
+int function_1351(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1351;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1351;
+}
+int function_1352(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1352;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1352;
+}
+int function_1353(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1353;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1353;
+}
+int function_1354(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1354;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1354;
+}
+int function_1355(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1355;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1355;
+}
+int function_1356(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1356;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1356;
+}
+int function_1357(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1357;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1357;
+}
+int function_1358(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1358;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1358;
+}
+int function_1359(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1359;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1359;
+}
+int function_1360(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1360;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1360;
+}
+int function_1361(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1361;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1361;
+}
+int function_1362(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1362;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1362;
+}
+int function_1363(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1363;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1363;
+}
+int function_1364(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1364;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1364;
+}
+int function_1365(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1365;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1365;
+}
+int function_1366(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1366;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1366;
+}
+int function_1367(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1367;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1367;
+}
+int function_1368(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1368;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1368;
+}
+int function_1369(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1369;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1369;
+}
+int function_1370(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1370;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1370;
+}
+int function_1371(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1371;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1371;
+}
+int function_1372(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1372;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1372;
+}
+int function_1373(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1373;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1373;
+}
+int function_1374(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1374;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1374;
+}
+int function_1375(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1375;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1375;
+}
+int function_1376(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1376;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1376;
+}
+int function_1377(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1377;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1377;
+}
+int function_1378(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1378;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1378;
+}
+int function_1379(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1379;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1379;
+}
+int function_1380(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1380;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1380;
+}
+int function_1381(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1381;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1381;
+}
+int function_1382(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1382;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1382;
+}
+int function_1383(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1383;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1383;
+}
+int function_1384(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1384;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1384;
+}
+int function_1385(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1385;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1385;
+}
+int function_1386(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1386;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1386;
+}
+int function_1387(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1387;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1387;
+}
+int function_1388(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1388;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1388;
+}
+int function_1389(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1389;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1389;
+}
+int function_1390(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1390;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1390;
+}
+int function_1391(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1391;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1391;
+}
+int function_1392(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1392;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1392;
+}
+int function_1393(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1393;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1393;
+}
+int function_1394(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1394;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1394;
+}
+int function_1395(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1395;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1395;
+}
+int function_1396(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1396;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1396;
+}
+int function_1397(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1397;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1397;
+}
+int function_1398(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1398;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1398;
+}
+int function_1399(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1399;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1399;
+}
+int function_1400(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1400;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1400;
+}
+int function_1401(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1401;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1401;
+}
+int function_1402(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1402;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1402;
+}
+int function_1403(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1403;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1403;
+}
+int function_1404(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1404;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1404;
+}
+int function_1405(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1405;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1405;
+}
+int function_1406(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1406;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1406;
+}
+int function_1407(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1407;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1407;
+}
+int function_1408(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1408;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1408;
+}
+int function_1409(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1409;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1409;
+}
+int function_1410(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1410;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1410;
+}
+int function_1411(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1411;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1411;
+}
+int function_1412(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1412;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1412;
+}
+int function_1413(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1413;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1413;
+}
+int function_1414(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1414;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1414;
+}
+int function_1415(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1415;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1415;
+}
+int function_1416(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1416;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1416;
+}
+int function_1417(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1417;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1417;
+}
+int function_1418(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1418;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1418;
+}
+int function_1419(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1419;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1419;
+}
+int function_1420(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1420;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1420;
+}
+int function_1421(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1421;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1421;
+}
+int function_1422(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1422;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1422;
+}
+int function_1423(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1423;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1423;
+}
+int function_1424(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1424;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1424;
+}
+int function_1425(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1425;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1425;
+}
+int function_1426(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1426;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1426;
+}
+int function_1427(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1427;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1427;
+}
+int function_1428(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1428;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1428;
+}
+int function_1429(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1429;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1429;
+}
+int function_1430(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1430;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1430;
+}
+int function_1431(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1431;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1431;
+}
+int function_1432(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1432;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1432;
+}
+int function_1433(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1433;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1433;
+}
+int function_1434(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1434;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1434;
+}
+int function_1435(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1435;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1435;
+}
+int function_1436(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1436;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1436;
+}
+int function_1437(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1437;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1437;
+}
+int function_1438(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1438;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1438;
+}
+int function_1439(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1439;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1439;
+}
+int function_1440(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1440;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1440;
+}
+int function_1441(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1441;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1441;
+}
+int function_1442(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1442;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1442;
+}
+int function_1443(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1443;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1443;
+}
+int function_1444(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1444;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1444;
+}
+int function_1445(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1445;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1445;
+}
+int function_1446(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1446;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1446;
+}
+int function_1447(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1447;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1447;
+}
+int function_1448(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1448;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1448;
+}
+int function_1449(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1449;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1449;
+}
+int function_1450(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1450;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1450;
+}
+int function_1451(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1451;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1451;
+}
+int function_1452(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1452;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1452;
+}
+int function_1453(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1453;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1453;
+}
+int function_1454(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1454;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1454;
+}
+int function_1455(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1455;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1455;
+}
+int function_1456(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1456;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1456;
+}
+int function_1457(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1457;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1457;
+}
+int function_1458(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1458;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1458;
+}
+int function_1459(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1459;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1459;
+}
+int function_1460(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1460;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1460;
+}
+int function_1461(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1461;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1461;
+}
+int function_1462(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1462;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1462;
+}
+int function_1463(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1463;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1463;
+}
+int function_1464(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1464;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1464;
+}
+int function_1465(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1465;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1465;
+}
+int function_1466(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1466;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1466;
+}
+int function_1467(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1467;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1467;
+}
+int function_1468(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1468;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1468;
+}
+int function_1469(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1469;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1469;
+}
+int function_1470(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1470;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1470;
+}
+int function_1471(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1471;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1471;
+}
+int function_1472(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1472;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1472;
+}
+int function_1473(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1473;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1473;
+}
+int function_1474(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1474;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1474;
+}
+int function_1475(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1475;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1475;
+}
+int function_1476(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1476;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1476;
+}
+int function_1477(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1477;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1477;
+}
+int function_1478(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1478;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1478;
+}
+int function_1479(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1479;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1479;
+}
+int function_1480(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1480;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1480;
+}
+int function_1481(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1481;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1481;
+}
+int function_1482(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1482;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1482;
+}
+int function_1483(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1483;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1483;
+}
+int function_1484(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1484;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1484;
+}
+int function_1485(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1485;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1485;
+}
+int function_1486(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1486;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1486;
+}
+int function_1487(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1487;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1487;
+}
+int function_1488(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1488;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1488;
+}
+int function_1489(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1489;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1489;
+}
+int function_1490(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1490;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1490;
+}
+int function_1491(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1491;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1491;
+}
+int function_1492(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1492;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1492;
+}
+int function_1493(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1493;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1493;
+}
+int function_1494(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1494;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1494;
+}
+int function_1495(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1495;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1495;
+}
+int function_1496(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1496;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1496;
+}
+int function_1497(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1497;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1497;
+}
+int function_1498(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1498;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1498;
+}
+int function_1499(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1499;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1499;
+}
+int function_1500(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1500;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1500;
+}
+int function_1501(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1501;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1501;
+}
+int function_1502(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1502;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1502;
+}
+int function_1503(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1503;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1503;
+}
+int function_1504(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1504;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1504;
+}
+int function_1505(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1505;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1505;
+}
+int function_1506(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1506;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1506;
+}
+int function_1507(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1507;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1507;
+}
+int function_1508(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1508;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1508;
+}
+int function_1509(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1509;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1509;
+}
+int function_1510(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1510;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1510;
+}
+int function_1511(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1511;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1511;
+}
+int function_1512(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1512;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1512;
+}
+int function_1513(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1513;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1513;
+}
+int function_1514(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1514;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1514;
+}
+int function_1515(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1515;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1515;
+}
+int function_1516(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1516;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1516;
+}
+int function_1517(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1517;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1517;
+}
+int function_1518(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1518;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1518;
+}
+int function_1519(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1519;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1519;
+}
+int function_1520(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1520;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1520;
+}
+int function_1521(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1521;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1521;
+}
+int function_1522(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1522;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1522;
+}
+int function_1523(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1523;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1523;
+}
+int function_1524(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1524;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1524;
+}
+int function_1525(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1525;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1525;
+}
+int function_1526(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1526;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1526;
+}
+int function_1527(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1527;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1527;
+}
+int function_1528(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1528;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1528;
+}
+int function_1529(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1529;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1529;
+}
+int function_1530(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1530;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1530;
+}
+int function_1531(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1531;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1531;
+}
+int function_1532(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1532;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1532;
+}
+int function_1533(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1533;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1533;
+}
+int function_1534(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1534;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1534;
+}
+int function_1535(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1535;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1535;
+}
+int function_1536(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1536;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1536;
+}
+int function_1537(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1537;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1537;
+}
+int function_1538(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1538;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1538;
+}
+int function_1539(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1539;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1539;
+}
+int function_1540(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1540;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1540;
+}
+int function_1541(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1541;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1541;
+}
+int function_1542(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1542;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1542;
+}
+int function_1543(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1543;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1543;
+}
+int function_1544(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1544;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1544;
+}
+int function_1545(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1545;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1545;
+}
+int function_1546(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1546;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1546;
+}
+int function_1547(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1547;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1547;
+}
+int function_1548(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1548;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1548;
+}
+int function_1549(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1549;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1549;
+}
+int function_1550(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1550;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1550;
+}
+int function_1551(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1551;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1551;
+}
+int function_1552(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1552;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1552;
+}
+int function_1553(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1553;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1553;
+}
+int function_1554(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1554;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1554;
+}
+int function_1555(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1555;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1555;
+}
+int function_1556(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1556;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1556;
+}
+int function_1557(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1557;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1557;
+}
+int function_1558(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1558;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1558;
+}
+int function_1559(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1559;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1559;
+}
+int function_1560(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1560;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1560;
+}
+int function_1561(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1561;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1561;
+}
+int function_1562(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1562;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1562;
+}
+int function_1563(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1563;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1563;
+}
+int function_1564(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1564;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1564;
+}
+int function_1565(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1565;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1565;
+}
+int function_1566(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1566;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1566;
+}
+int function_1567(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1567;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1567;
+}
+int function_1568(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1568;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1568;
+}
+int function_1569(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1569;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1569;
+}
+int function_1570(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1570;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1570;
+}
+int function_1571(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1571;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1571;
+}
+int function_1572(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1572;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1572;
+}
+int function_1573(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1573;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1573;
+}
+int function_1574(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1574;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1574;
+}
+int function_1575(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1575;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1575;
+}
+int function_1576(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1576;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1576;
+}
+int function_1577(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1577;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1577;
+}
+int function_1578(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1578;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1578;
+}
+int function_1579(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1579;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1579;
+}
+int function_1580(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1580;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1580;
+}
+int function_1581(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1581;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1581;
+}
+int function_1582(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1582;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1582;
+}
+int function_1583(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1583;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1583;
+}
+int function_1584(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1584;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1584;
+}
+int function_1585(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1585;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1585;
+}
+int function_1586(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1586;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1586;
+}
+int function_1587(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1587;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1587;
+}
+int function_1588(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1588;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1588;
+}
+int function_1589(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1589;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1589;
+}
+int function_1590(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1590;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1590;
+}
+int function_1591(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1591;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1591;
+}
+int function_1592(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1592;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1592;
+}
+int function_1593(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1593;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1593;
+}
+int function_1594(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1594;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1594;
+}
+int function_1595(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1595;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1595;
+}
+int function_1596(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1596;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1596;
+}
+int function_1597(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1597;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1597;
+}
+int function_1598(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1598;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1598;
+}
+int function_1599(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1599;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1599;
+}
+int function_1600(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1600;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1600;
+}
+int function_1601(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1601;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1601;
+}
+int function_1602(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1602;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1602;
+}
+int function_1603(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1603;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1603;
+}
+int function_1604(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1604;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1604;
+}
+int function_1605(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1605;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1605;
+}
+int function_1606(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1606;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1606;
+}
+int function_1607(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1607;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1607;
+}
+int function_1608(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1608;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1608;
+}
+int function_1609(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1609;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1609;
+}
+int function_1610(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1610;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1610;
+}
+int function_1611(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1611;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1611;
+}
+int function_1612(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1612;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1612;
+}
+int function_1613(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1613;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1613;
+}
+int function_1614(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1614;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1614;
+}
+int function_1615(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1615;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1615;
+}
+int function_1616(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1616;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1616;
+}
+int function_1617(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1617;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1617;
+}
+int function_1618(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1618;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1618;
+}
+int function_1619(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1619;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1619;
+}
+int function_1620(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1620;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1620;
+}
+int function_1621(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1621;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1621;
+}
+int function_1622(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1622;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1622;
+}
+int function_1623(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1623;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1623;
+}
+int function_1624(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1624;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1624;
+}
+int function_1625(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1625;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1625;
+}
+int function_1626(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1626;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1626;
+}
+int function_1627(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1627;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1627;
+}
+int function_1628(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1628;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1628;
+}
+int function_1629(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1629;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1629;
+}
+int function_1630(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1630;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1630;
+}
+int function_1631(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1631;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1631;
+}
+int function_1632(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1632;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1632;
+}
+int function_1633(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1633;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1633;
+}
+int function_1634(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1634;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1634;
+}
+int function_1635(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1635;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1635;
+}
+int function_1636(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1636;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1636;
+}
+int function_1637(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1637;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1637;
+}
+int function_1638(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1638;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1638;
+}
+int function_1639(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1639;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1639;
+}
+int function_1640(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1640;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1640;
+}
+int function_1641(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1641;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1641;
+}
+int function_1642(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1642;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1642;
+}
+int function_1643(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1643;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1643;
+}
+int function_1644(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1644;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1644;
+}
+int function_1645(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1645;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1645;
+}
+int function_1646(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1646;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1646;
+}
+int function_1647(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1647;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1647;
+}
+int function_1648(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1648;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1648;
+}
+int function_1649(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1649;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1649;
+}
+int function_1650(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1650;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1650;
+}
+int function_1651(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1651;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1651;
+}
+int function_1652(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1652;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1652;
+}
+int function_1653(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1653;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1653;
+}
+int function_1654(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1654;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1654;
+}
+int function_1655(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1655;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1655;
+}
+int function_1656(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1656;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1656;
+}
+int function_1657(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1657;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1657;
+}
+int function_1658(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1658;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1658;
+}
+int function_1659(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1659;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1659;
+}
+int function_1660(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1660;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1660;
+}
+int function_1661(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1661;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1661;
+}
+int function_1662(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1662;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1662;
+}
+int function_1663(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1663;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1663;
+}
+int function_1664(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1664;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1664;
+}
+int function_1665(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1665;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1665;
+}
+int function_1666(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1666;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1666;
+}
+int function_1667(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1667;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1667;
+}
+int function_1668(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1668;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1668;
+}
+int function_1669(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1669;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1669;
+}
+int function_1670(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1670;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1670;
+}
+int function_1671(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1671;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1671;
+}
+int function_1672(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1672;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1672;
+}
+int function_1673(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1673;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1673;
+}
+int function_1674(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1674;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1674;
+}
+int function_1675(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1675;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1675;
+}
+int function_1676(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1676;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1676;
+}
+int function_1677(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1677;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1677;
+}
+int function_1678(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1678;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1678;
+}
+int function_1679(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1679;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1679;
+}
+int function_1680(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1680;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1680;
+}
+int function_1681(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1681;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1681;
+}
+int function_1682(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1682;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1682;
+}
+int function_1683(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1683;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1683;
+}
+int function_1684(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1684;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1684;
+}
+int function_1685(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1685;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1685;
+}
+int function_1686(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1686;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1686;
+}
+int function_1687(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1687;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1687;
+}
+int function_1688(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1688;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1688;
+}
+int function_1689(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1689;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1689;
+}
+int function_1690(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1690;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1690;
+}
+int function_1691(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1691;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1691;
+}
+int function_1692(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1692;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1692;
+}
+int function_1693(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1693;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1693;
+}
+int function_1694(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1694;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1694;
+}
+int function_1695(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1695;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1695;
+}
+int function_1696(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1696;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1696;
+}
+int function_1697(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1697;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1697;
+}
+int function_1698(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1698;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1698;
+}
+int function_1699(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1699;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1699;
+}
+int function_1700(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1700;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1700;
+}
+int function_1701(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1701;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1701;
+}
+int function_1702(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1702;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1702;
+}
+int function_1703(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1703;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1703;
+}
+int function_1704(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1704;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1704;
+}
+int function_1705(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1705;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1705;
+}
+int function_1706(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1706;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1706;
+}
+int function_1707(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1707;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1707;
+}
+int function_1708(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1708;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1708;
+}
+int function_1709(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1709;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1709;
+}
+int function_1710(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1710;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1710;
+}
+int function_1711(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1711;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1711;
+}
+int function_1712(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1712;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1712;
+}
+int function_1713(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1713;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1713;
+}
+int function_1714(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1714;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1714;
+}
+int function_1715(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1715;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1715;
+}
+int function_1716(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1716;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1716;
+}
+int function_1717(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1717;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1717;
+}
+int function_1718(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1718;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1718;
+}
+int function_1719(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1719;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1719;
+}
+int function_1720(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1720;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1720;
+}
+int function_1721(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1721;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1721;
+}
+int function_1722(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1722;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1722;
+}
+int function_1723(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1723;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1723;
+}
+int function_1724(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1724;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1724;
+}
+int function_1725(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1725;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1725;
+}
+int function_1726(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1726;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1726;
+}
+int function_1727(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1727;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1727;
+}
+int function_1728(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1728;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1728;
+}
+int function_1729(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1729;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1729;
+}
+int function_1730(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1730;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1730;
+}
+int function_1731(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1731;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1731;
+}
+int function_1732(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1732;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1732;
+}
+int function_1733(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1733;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1733;
+}
+int function_1734(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1734;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1734;
+}
+int function_1735(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1735;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1735;
+}
+int function_1736(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1736;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1736;
+}
+int function_1737(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1737;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1737;
+}
+int function_1738(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1738;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1738;
+}
+int function_1739(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1739;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1739;
+}
+int function_1740(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1740;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1740;
+}
+int function_1741(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1741;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1741;
+}
+int function_1742(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1742;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1742;
+}
+int function_1743(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1743;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1743;
+}
+int function_1744(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1744;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1744;
+}
+int function_1745(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1745;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1745;
+}
+int function_1746(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1746;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1746;
+}
+int function_1747(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1747;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1747;
+}
+int function_1748(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1748;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1748;
+}
+int function_1749(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1749;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1749;
+}
+int function_1750(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1750;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1750;
+}
+int function_1751(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1751;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1751;
+}
+int function_1752(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1752;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1752;
+}
+int function_1753(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1753;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1753;
+}
+int function_1754(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1754;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1754;
+}
+int function_1755(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1755;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1755;
+}
+int function_1756(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1756;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1756;
+}
+int function_1757(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1757;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1757;
+}
+int function_1758(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1758;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1758;
+}
+int function_1759(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1759;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1759;
+}
+int function_1760(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1760;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1760;
+}
+int function_1761(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1761;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1761;
+}
+int function_1762(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1762;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1762;
+}
+int function_1763(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1763;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1763;
+}
+int function_1764(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1764;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1764;
+}
+int function_1765(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1765;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1765;
+}
+int function_1766(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1766;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1766;
+}
+int function_1767(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1767;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1767;
+}
+int function_1768(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1768;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1768;
+}
+int function_1769(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1769;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1769;
+}
+int function_1770(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1770;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1770;
+}
+int function_1771(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1771;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1771;
+}
+int function_1772(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1772;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1772;
+}
+int function_1773(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1773;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1773;
+}
+int function_1774(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1774;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1774;
+}
+int function_1775(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1775;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1775;
+}
+int function_1776(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1776;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1776;
+}
+int function_1777(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1777;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1777;
+}
+int function_1778(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1778;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1778;
+}
+int function_1779(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1779;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1779;
+}
+int function_1780(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1780;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1780;
+}
+int function_1781(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1781;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1781;
+}
+int function_1782(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1782;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1782;
+}
+int function_1783(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1783;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1783;
+}
+int function_1784(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1784;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1784;
+}
+int function_1785(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1785;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1785;
+}
+int function_1786(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1786;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1786;
+}
+int function_1787(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1787;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1787;
+}
+int function_1788(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1788;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1788;
+}
+int function_1789(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1789;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1789;
+}
+int function_1790(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1790;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1790;
+}
+int function_1791(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1791;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1791;
+}
+int function_1792(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1792;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1792;
+}
+int function_1793(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1793;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1793;
+}
+int function_1794(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1794;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1794;
+}
+int function_1795(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1795;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1795;
+}
+int function_1796(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1796;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1796;
+}
+int function_1797(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1797;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1797;
+}
+int function_1798(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1798;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1798;
+}
+int function_1799(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1799;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1799;
+}
+int function_1800(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1800;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1800;
+}
+int function_1801(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1801;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1801;
+}
+int function_1802(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1802;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1802;
+}
+int function_1803(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1803;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1803;
+}
+int function_1804(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1804;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1804;
+}
+int function_1805(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1805;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1805;
+}
+int function_1806(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1806;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1806;
+}
+int function_1807(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1807;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1807;
+}
+int function_1808(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1808;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1808;
+}
+int function_1809(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1809;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1809;
+}
+int function_1810(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1810;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1810;
+}
+int function_1811(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1811;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1811;
+}
+int function_1812(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1812;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1812;
+}
+int function_1813(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1813;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1813;
+}
+int function_1814(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1814;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1814;
+}
+int function_1815(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1815;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1815;
+}
+int function_1816(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1816;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1816;
+}
+int function_1817(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1817;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1817;
+}
+int function_1818(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1818;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1818;
+}
+int function_1819(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1819;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1819;
+}
+int function_1820(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1820;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1820;
+}
+int function_1821(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1821;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1821;
+}
+int function_1822(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1822;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1822;
+}
+int function_1823(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1823;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1823;
+}
+int function_1824(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1824;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1824;
+}
+int function_1825(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1825;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1825;
+}
+int function_1826(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1826;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1826;
+}
+int function_1827(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1827;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1827;
+}
+int function_1828(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1828;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1828;
+}
+int function_1829(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1829;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1829;
+}
+int function_1830(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1830;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1830;
+}
+int function_1831(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1831;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1831;
+}
+int function_1832(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1832;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1832;
+}
+int function_1833(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1833;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1833;
+}
+int function_1834(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1834;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1834;
+}
+int function_1835(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1835;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1835;
+}
+int function_1836(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1836;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1836;
+}
+int function_1837(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1837;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1837;
+}
+int function_1838(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1838;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1838;
+}
+int function_1839(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1839;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1839;
+}
+int function_1840(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1840;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1840;
+}
+int function_1841(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1841;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1841;
+}
+int function_1842(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1842;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1842;
+}
+int function_1843(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1843;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1843;
+}
+int function_1844(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1844;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1844;
+}
+int function_1845(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1845;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1845;
+}
+int function_1846(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1846;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1846;
+}
+int function_1847(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1847;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1847;
+}
+int function_1848(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1848;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1848;
+}
+int function_1849(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1849;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1849;
+}
+int function_1850(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1850;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1850;
+}
+int function_1851(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1851;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1851;
+}
+int function_1852(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1852;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1852;
+}
+int function_1853(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1853;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1853;
+}
+int function_1854(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1854;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1854;
+}
+int function_1855(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1855;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1855;
+}
+int function_1856(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1856;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1856;
+}
+int function_1857(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1857;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1857;
+}
+int function_1858(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1858;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1858;
+}
+int function_1859(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1859;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1859;
+}
+int function_1860(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1860;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1860;
+}
+int function_1861(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1861;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1861;
+}
+int function_1862(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1862;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1862;
+}
+int function_1863(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1863;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1863;
+}
+int function_1864(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1864;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1864;
+}
+int function_1865(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1865;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1865;
+}
+int function_1866(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1866;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1866;
+}
+int function_1867(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1867;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1867;
+}
+int function_1868(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1868;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1868;
+}
+int function_1869(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1869;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1869;
+}
+int function_1870(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1870;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1870;
+}
+int function_1871(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1871;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1871;
+}
+int function_1872(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1872;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1872;
+}
+int function_1873(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1873;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1873;
+}
+int function_1874(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1874;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1874;
+}
+int function_1875(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1875;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1875;
+}
+int function_1876(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1876;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1876;
+}
+int function_1877(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1877;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1877;
+}
+int function_1878(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1878;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1878;
+}
+int function_1879(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1879;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1879;
+}
+int function_1880(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1880;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1880;
+}
+int function_1881(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1881;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1881;
+}
+int function_1882(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1882;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1882;
+}
+int function_1883(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1883;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1883;
+}
+int function_1884(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1884;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1884;
+}
+int function_1885(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1885;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1885;
+}
+int function_1886(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1886;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1886;
+}
+int function_1887(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1887;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1887;
+}
+int function_1888(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1888;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1888;
+}
+int function_1889(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1889;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1889;
+}
+int function_1890(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1890;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1890;
+}
+int function_1891(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1891;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1891;
+}
+int function_1892(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1892;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1892;
+}
+int function_1893(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1893;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1893;
+}
+int function_1894(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1894;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1894;
+}
+int function_1895(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1895;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1895;
+}
+int function_1896(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1896;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1896;
+}
+int function_1897(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1897;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1897;
+}
+int function_1898(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1898;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1898;
+}
+int function_1899(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1899;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1899;
+}
+int function_1900(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1900;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1900;
+}
+int function_1901(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1901;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1901;
+}
+int function_1902(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1902;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1902;
+}
+int function_1903(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1903;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1903;
+}
+int function_1904(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1904;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1904;
+}
+int function_1905(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1905;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1905;
+}
+int function_1906(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1906;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1906;
+}
+int function_1907(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1907;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1907;
+}
+int function_1908(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1908;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1908;
+}
+int function_1909(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1909;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1909;
+}
+int function_1910(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1910;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1910;
+}
+int function_1911(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1911;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1911;
+}
+int function_1912(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1912;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1912;
+}
+int function_1913(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1913;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1913;
+}
+int function_1914(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1914;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1914;
+}
+int function_1915(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1915;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1915;
+}
+int function_1916(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1916;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1916;
+}
+int function_1917(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1917;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1917;
+}
+int function_1918(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1918;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1918;
+}
+int function_1919(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1919;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1919;
+}
+int function_1920(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1920;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1920;
+}
+int function_1921(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1921;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1921;
+}
+int function_1922(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1922;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1922;
+}
+int function_1923(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1923;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1923;
+}
+int function_1924(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1924;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1924;
+}
+int function_1925(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1925;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1925;
+}
+int function_1926(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1926;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1926;
+}
+int function_1927(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1927;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1927;
+}
+int function_1928(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1928;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1928;
+}
+int function_1929(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1929;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1929;
+}
+int function_1930(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1930;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1930;
+}
+int function_1931(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1931;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1931;
+}
+int function_1932(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1932;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1932;
+}
+int function_1933(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1933;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1933;
+}
+int function_1934(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1934;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1934;
+}
+int function_1935(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1935;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1935;
+}
+int function_1936(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1936;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1936;
+}
+int function_1937(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1937;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1937;
+}
+int function_1938(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1938;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1938;
+}
+int function_1939(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1939;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1939;
+}
+int function_1940(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1940;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1940;
+}
+int function_1941(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1941;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1941;
+}
+int function_1942(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1942;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1942;
+}
+int function_1943(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1943;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1943;
+}
+int function_1944(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1944;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1944;
+}
+int function_1945(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1945;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1945;
+}
+int function_1946(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1946;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1946;
+}
+int function_1947(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1947;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1947;
+}
+int function_1948(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1948;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1948;
+}
+int function_1949(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1949;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1949;
+}
+int function_1950(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1950;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1950;
+}
+int function_1951(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1951;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1951;
+}
+int function_1952(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1952;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1952;
+}
+int function_1953(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1953;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1953;
+}
+int function_1954(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1954;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1954;
+}
+int function_1955(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1955;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1955;
+}
+int function_1956(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1956;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1956;
+}
+int function_1957(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1957;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1957;
+}
+int function_1958(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1958;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1958;
+}
+int function_1959(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1959;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1959;
+}
+int function_1960(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1960;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1960;
+}
+int function_1961(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1961;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1961;
+}
+int function_1962(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1962;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1962;
+}
+int function_1963(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1963;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1963;
+}
+int function_1964(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1964;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1964;
+}
+int function_1965(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1965;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1965;
+}
+int function_1966(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1966;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1966;
+}
+int function_1967(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1967;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1967;
+}
+int function_1968(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1968;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1968;
+}
+int function_1969(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1969;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1969;
+}
+int function_1970(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1970;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1970;
+}
+int function_1971(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1971;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1971;
+}
+int function_1972(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1972;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1972;
+}
+int function_1973(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1973;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1973;
+}
+int function_1974(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1974;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1974;
+}
+int function_1975(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1975;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1975;
+}
+int function_1976(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1976;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1976;
+}
+int function_1977(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1977;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1977;
+}
+int function_1978(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1978;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1978;
+}
+int function_1979(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1979;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1979;
+}
+int function_1980(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1980;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1980;
+}
+int function_1981(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1981;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1981;
+}
+int function_1982(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1982;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1982;
+}
+int function_1983(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1983;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1983;
+}
+int function_1984(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1984;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1984;
+}
+int function_1985(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1985;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1985;
+}
+int function_1986(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1986;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1986;
+}
+int function_1987(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1987;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1987;
+}
+int function_1988(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1988;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1988;
+}
+int function_1989(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1989;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1989;
+}
+int function_1990(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1990;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1990;
+}
+int function_1991(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1991;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1991;
+}
+int function_1992(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1992;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1992;
+}
+int function_1993(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1993;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1993;
+}
+int function_1994(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1994;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1994;
+}
+int function_1995(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1995;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1995;
+}
+int function_1996(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1996;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1996;
+}
+int function_1997(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1997;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1997;
+}
+int function_1998(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1998;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1998;
+}
+int function_1999(int a, int b)
+{
+    int x;
+    x = a * 50 + b / 20 - 1999;
+    if (x > 100)
+    {
+        x = x - a * b;
+    }
+    return x + a + b + 1999;
+}
+int main()
+{
+    return function_0(1, 2);
+}
@@ -0,0 +1,4004 @@
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+#include <stdio.h>
+#include "/root/repo/build/benchmarks/includes_once.h"
+int main()
+{
+    return 0;
+}
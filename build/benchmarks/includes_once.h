@@ -0,0 +1,2 @@
+#pragma once
+int includes_once(int x);
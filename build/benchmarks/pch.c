@@ -0,0 +1,5 @@
+#include "/root/repo/./build/benchmarks/pch.h"
+int main()
+{
+    return PCH_ADD_7(3, 1) + PCH_VALUE_3;
+}
@@ -0,0 +1,8004 @@
+#ifndef PCH_BENCHMARK_H
+#define PCH_BENCHMARK_H
+#include <stdio.h>
+#define PCH_VALUE_0 (0 * 2 + 1)
+#define PCH_ADD_0(a, b) ((a) + (b) + 0)
+typedef int pch_int_0;
+int pch_function_0(pch_int_0 a, int b);
+#define PCH_VALUE_1 (1 * 2 + 1)
+#define PCH_ADD_1(a, b) ((a) + (b) + 1)
+typedef int pch_int_1;
+int pch_function_1(pch_int_1 a, int b);
+#define PCH_VALUE_2 (2 * 2 + 1)
+#define PCH_ADD_2(a, b) ((a) + (b) + 2)
+typedef int pch_int_2;
+int pch_function_2(pch_int_2 a, int b);
+#define PCH_VALUE_3 (3 * 2 + 1)
+#define PCH_ADD_3(a, b) ((a) + (b) + 3)
+typedef int pch_int_3;
+int pch_function_3(pch_int_3 a, int b);
+#define PCH_VALUE_4 (4 * 2 + 1)
+#define PCH_ADD_4(a, b) ((a) + (b) + 4)
+typedef int pch_int_4;
+int pch_function_4(pch_int_4 a, int b);
+#define PCH_VALUE_5 (5 * 2 + 1)
+#define PCH_ADD_5(a, b) ((a) + (b) + 5)
+typedef int pch_int_5;
+int pch_function_5(pch_int_5 a, int b);
+#define PCH_VALUE_6 (6 * 2 + 1)
+#define PCH_ADD_6(a, b) ((a) + (b) + 6)
+typedef int pch_int_6;
+int pch_function_6(pch_int_6 a, int b);
+#define PCH_VALUE_7 (7 * 2 + 1)
+#define PCH_ADD_7(a, b) ((a) + (b) + 7)
+typedef int pch_int_7;
+int pch_function_7(pch_int_7 a, int b);
+#define PCH_VALUE_8 (8 * 2 + 1)
+#define PCH_ADD_8(a, b) ((a) + (b) + 8)
+typedef int pch_int_8;
+int pch_function_8(pch_int_8 a, int b);
+#define PCH_VALUE_9 (9 * 2 + 1)
+#define PCH_ADD_9(a, b) ((a) + (b) + 9)
+typedef int pch_int_9;
+int pch_function_9(pch_int_9 a, int b);
+#define PCH_VALUE_10 (10 * 2 + 1)
+#define PCH_ADD_10(a, b) ((a) + (b) + 10)
+typedef int pch_int_10;
+int pch_function_10(pch_int_10 a, int b);
+#define PCH_VALUE_11 (11 * 2 + 1)
+#define PCH_ADD_11(a, b) ((a) + (b) + 11)
+typedef int pch_int_11;
+int pch_function_11(pch_int_11 a, int b);
+#define PCH_VALUE_12 (12 * 2 + 1)
+#define PCH_ADD_12(a, b) ((a) + (b) + 12)
+typedef int pch_int_12;
+int pch_function_12(pch_int_12 a, int b);
+#define PCH_VALUE_13 (13 * 2 + 1)
+#define PCH_ADD_13(a, b) ((a) + (b) + 13)
+typedef int pch_int_13;
+int pch_function_13(pch_int_13 a, int b);
+#define PCH_VALUE_14 (14 * 2 + 1)
+#define PCH_ADD_14(a, b) ((a) + (b) + 14)
+typedef int pch_int_14;
+int pch_function_14(pch_int_14 a, int b);
+#define PCH_VALUE_15 (15 * 2 + 1)
+#define PCH_ADD_15(a, b) ((a) + (b) + 15)
+typedef int pch_int_15;
+int pch_function_15(pch_int_15 a, int b);
+#define PCH_VALUE_16 (16 * 2 + 1)
+#define PCH_ADD_16(a, b) ((a) + (b) + 16)
+typedef int pch_int_16;
+int pch_function_16(pch_int_16 a, int b);
+#define PCH_VALUE_17 (17 * 2 + 1)
+#define PCH_ADD_17(a, b) ((a) + (b) + 17)
+typedef int pch_int_17;
+int pch_function_17(pch_int_17 a, int b);
+#define PCH_VALUE_18 (18 * 2 + 1)
+#define PCH_ADD_18(a, b) ((a) + (b) + 18)
+typedef int pch_int_18;
+int pch_function_18(pch_int_18 a, int b);
+#define PCH_VALUE_19 (19 * 2 + 1)
+#define PCH_ADD_19(a, b) ((a) + (b) + 19)
+typedef int pch_int_19;
+int pch_function_19(pch_int_19 a, int b);
+#define PCH_VALUE_20 (20 * 2 + 1)
+#define PCH_ADD_20(a, b) ((a) + (b) + 20)
+typedef int pch_int_20;
+int pch_function_20(pch_int_20 a, int b);
+#define PCH_VALUE_21 (21 * 2 + 1)
+#define PCH_ADD_21(a, b) ((a) + (b) + 21)
+typedef int pch_int_21;
+int pch_function_21(pch_int_21 a, int b);
+#define PCH_VALUE_22 (22 * 2 + 1)
+#define PCH_ADD_22(a, b) ((a) + (b) + 22)
+typedef int pch_int_22;
+int pch_function_22(pch_int_22 a, int b);
+#define PCH_VALUE_23 (23 * 2 + 1)
+#define PCH_ADD_23(a, b) ((a) + (b) + 23)
+typedef int pch_int_23;
+int pch_function_23(pch_int_23 a, int b);
+#define PCH_VALUE_24 (24 * 2 + 1)
+#define PCH_ADD_24(a, b) ((a) + (b) + 24)
+typedef int pch_int_24;
+int pch_function_24(pch_int_24 a, int b);
+#define PCH_VALUE_25 (25 * 2 + 1)
+#define PCH_ADD_25(a, b) ((a) + (b) + 25)
+typedef int pch_int_25;
+int pch_function_25(pch_int_25 a, int b);
+#define PCH_VALUE_26 (26 * 2 + 1)
+#define PCH_ADD_26(a, b) ((a) + (b) + 26)
+typedef int pch_int_26;
+int pch_function_26(pch_int_26 a, int b);
+#define PCH_VALUE_27 (27 * 2 + 1)
+#define PCH_ADD_27(a, b) ((a) + (b) + 27)
+typedef int pch_int_27;
+int pch_function_27(pch_int_27 a, int b);
+#define PCH_VALUE_28 (28 * 2 + 1)
+#define PCH_ADD_28(a, b) ((a) + (b) + 28)
+typedef int pch_int_28;
+int pch_function_28(pch_int_28 a, int b);
+#define PCH_VALUE_29 (29 * 2 + 1)
+#define PCH_ADD_29(a, b) ((a) + (b) + 29)
+typedef int pch_int_29;
+int pch_function_29(pch_int_29 a, int b);
+#define PCH_VALUE_30 (30 * 2 + 1)
+#define PCH_ADD_30(a, b) ((a) + (b) + 30)
+typedef int pch_int_30;
+int pch_function_30(pch_int_30 a, int b);
+#define PCH_VALUE_31 (31 * 2 + 1)
+#define PCH_ADD_31(a, b) ((a) + (b) + 31)
+typedef int pch_int_31;
+int pch_function_31(pch_int_31 a, int b);
+#define PCH_VALUE_32 (32 * 2 + 1)
+#define PCH_ADD_32(a, b) ((a) + (b) + 32)
+typedef int pch_int_32;
+int pch_function_32(pch_int_32 a, int b);
+#define PCH_VALUE_33 (33 * 2 + 1)
+#define PCH_ADD_33(a, b) ((a) + (b) + 33)
+typedef int pch_int_33;
+int pch_function_33(pch_int_33 a, int b);
+#define PCH_VALUE_34 (34 * 2 + 1)
+#define PCH_ADD_34(a, b) ((a) + (b) + 34)
+typedef int pch_int_34;
+int pch_function_34(pch_int_34 a, int b);
+#define PCH_VALUE_35 (35 * 2 + 1)
+#define PCH_ADD_35(a, b) ((a) + (b) + 35)
+typedef int pch_int_35;
+int pch_function_35(pch_int_35 a, int b);
+#define PCH_VALUE_36 (36 * 2 + 1)
+#define PCH_ADD_36(a, b) ((a) + (b) + 36)
+typedef int pch_int_36;
+int pch_function_36(pch_int_36 a, int b);
+#define PCH_VALUE_37 (37 * 2 + 1)
+#define PCH_ADD_37(a, b) ((a) + (b) + 37)
+typedef int pch_int_37;
+int pch_function_37(pch_int_37 a, int b);
+#define PCH_VALUE_38 (38 * 2 + 1)
+#define PCH_ADD_38(a, b) ((a) + (b) + 38)
+typedef int pch_int_38;
+int pch_function_38(pch_int_38 a, int b);
+#define PCH_VALUE_39 (39 * 2 + 1)
+#define PCH_ADD_39(a, b) ((a) + (b) + 39)
+typedef int pch_int_39;
+int pch_function_39(pch_int_39 a, int b);
+#define PCH_VALUE_40 (40 * 2 + 1)
+#define PCH_ADD_40(a, b) ((a) + (b) + 40)
+typedef int pch_int_40;
+int pch_function_40(pch_int_40 a, int b);
+#define PCH_VALUE_41 (41 * 2 + 1)
+#define PCH_ADD_41(a, b) ((a) + (b) + 41)
+typedef int pch_int_41;
+int pch_function_41(pch_int_41 a, int b);
+#define PCH_VALUE_42 (42 * 2 + 1)
+#define PCH_ADD_42(a, b) ((a) + (b) + 42)
+typedef int pch_int_42;
+int pch_function_42(pch_int_42 a, int b);
+#define PCH_VALUE_43 (43 * 2 + 1)
+#define PCH_ADD_43(a, b) ((a) + (b) + 43)
+typedef int pch_int_43;
+int pch_function_43(pch_int_43 a, int b);
+#define PCH_VALUE_44 (44 * 2 + 1)
+#define PCH_ADD_44(a, b) ((a) + (b) + 44)
+typedef int pch_int_44;
+int pch_function_44(pch_int_44 a, int b);
+#define PCH_VALUE_45 (45 * 2 + 1)
+#define PCH_ADD_45(a, b) ((a) + (b) + 45)
+typedef int pch_int_45;
+int pch_function_45(pch_int_45 a, int b);
+#define PCH_VALUE_46 (46 * 2 + 1)
+#define PCH_ADD_46(a, b) ((a) + (b) + 46)
+typedef int pch_int_46;
+int pch_function_46(pch_int_46 a, int b);
+#define PCH_VALUE_47 (47 * 2 + 1)
+#define PCH_ADD_47(a, b) ((a) + (b) + 47)
+typedef int pch_int_47;
+int pch_function_47(pch_int_47 a, int b);
+#define PCH_VALUE_48 (48 * 2 + 1)
+#define PCH_ADD_48(a, b) ((a) + (b) + 48)
+typedef int pch_int_48;
+int pch_function_48(pch_int_48 a, int b);
+#define PCH_VALUE_49 (49 * 2 + 1)
+#define PCH_ADD_49(a, b) ((a) + (b) + 49)
+typedef int pch_int_49;
+int pch_function_49(pch_int_49 a, int b);
+#define PCH_VALUE_50 (50 * 2 + 1)
+#define PCH_ADD_50(a, b) ((a) + (b) + 50)
+typedef int pch_int_50;
+int pch_function_50(pch_int_50 a, int b);
+#define PCH_VALUE_51 (51 * 2 + 1)
+#define PCH_ADD_51(a, b) ((a) + (b) + 51)
+typedef int pch_int_51;
+int pch_function_51(pch_int_51 a, int b);
+#define PCH_VALUE_52 (52 * 2 + 1)
+#define PCH_ADD_52(a, b) ((a) + (b) + 52)
+typedef int pch_int_52;
+int pch_function_52(pch_int_52 a, int b);
+#define PCH_VALUE_53 (53 * 2 + 1)
+#define PCH_ADD_53(a, b) ((a) + (b) + 53)
+typedef int pch_int_53;
+int pch_function_53(pch_int_53 a, int b);
+#define PCH_VALUE_54 (54 * 2 + 1)
+#define PCH_ADD_54(a, b) ((a) + (b) + 54)
+typedef int pch_int_54;
+int pch_function_54(pch_int_54 a, int b);
+#define PCH_VALUE_55 (55 * 2 + 1)
+#define PCH_ADD_55(a, b) ((a) + (b) + 55)
+typedef int pch_int_55;
+int pch_function_55(pch_int_55 a, int b);
+#define PCH_VALUE_56 (56 * 2 + 1)
+#define PCH_ADD_56(a, b) ((a) + (b) + 56)
+typedef int pch_int_56;
+int pch_function_56(pch_int_56 a, int b);
+#define PCH_VALUE_57 (57 * 2 + 1)
+#define PCH_ADD_57(a, b) ((a) + (b) + 57)
+typedef int pch_int_57;
+int pch_function_57(pch_int_57 a, int b);
+#define PCH_VALUE_58 (58 * 2 + 1)
+#define PCH_ADD_58(a, b) ((a) + (b) + 58)
+typedef int pch_int_58;
+int pch_function_58(pch_int_58 a, int b);
+#define PCH_VALUE_59 (59 * 2 + 1)
+#define PCH_ADD_59(a, b) ((a) + (b) + 59)
+typedef int pch_int_59;
+int pch_function_59(pch_int_59 a, int b);
+#define PCH_VALUE_60 (60 * 2 + 1)
+#define PCH_ADD_60(a, b) ((a) + (b) + 60)
+typedef int pch_int_60;
+int pch_function_60(pch_int_60 a, int b);
+#define PCH_VALUE_61 (61 * 2 + 1)
+#define PCH_ADD_61(a, b) ((a) + (b) + 61)
+typedef int pch_int_61;
+int pch_function_61(pch_int_61 a, int b);
+#define PCH_VALUE_62 (62 * 2 + 1)
+#define PCH_ADD_62(a, b) ((a) + (b) + 62)
+typedef int pch_int_62;
+int pch_function_62(pch_int_62 a, int b);
+#define PCH_VALUE_63 (63 * 2 + 1)
+#define PCH_ADD_63(a, b) ((a) + (b) + 63)
+typedef int pch_int_63;
+int pch_function_63(pch_int_63 a, int b);
+#define PCH_VALUE_64 (64 * 2 + 1)
+#define PCH_ADD_64(a, b) ((a) + (b) + 64)
+typedef int pch_int_64;
+int pch_function_64(pch_int_64 a, int b);
+#define PCH_VALUE_65 (65 * 2 + 1)
+#define PCH_ADD_65(a, b) ((a) + (b) + 65)
+typedef int pch_int_65;
+int pch_function_65(pch_int_65 a, int b);
+#define PCH_VALUE_66 (66 * 2 + 1)
+#define PCH_ADD_66(a, b) ((a) + (b) + 66)
+typedef int pch_int_66;
+int pch_function_66(pch_int_66 a, int b);
+#define PCH_VALUE_67 (67 * 2 + 1)
+#define PCH_ADD_67(a, b) ((a) + (b) + 67)
+typedef int pch_int_67;
+int pch_function_67(pch_int_67 a, int b);
+#define PCH_VALUE_68 (68 * 2 + 1)
+#define PCH_ADD_68(a, b) ((a) + (b) + 68)
+typedef int pch_int_68;
+int pch_function_68(pch_int_68 a, int b);
+#define PCH_VALUE_69 (69 * 2 + 1)
+#define PCH_ADD_69(a, b) ((a) + (b) + 69)
+typedef int pch_int_69;
+int pch_function_69(pch_int_69 a, int b);
+#define PCH_VALUE_70 (70 * 2 + 1)
+#define PCH_ADD_70(a, b) ((a) + (b) + 70)
+typedef int pch_int_70;
+int pch_function_70(pch_int_70 a, int b);
+#define PCH_VALUE_71 (71 * 2 + 1)
+#define PCH_ADD_71(a, b) ((a) + (b) + 71)
+typedef int pch_int_71;
+int pch_function_71(pch_int_71 a, int b);
+#define PCH_VALUE_72 (72 * 2 + 1)
+#define PCH_ADD_72(a, b) ((a) + (b) + 72)
+typedef int pch_int_72;
+int pch_function_72(pch_int_72 a, int b);
+#define PCH_VALUE_73 (73 * 2 + 1)
+#define PCH_ADD_73(a, b) ((a) + (b) + 73)
+typedef int pch_int_73;
+int pch_function_73(pch_int_73 a, int b);
+#define PCH_VALUE_74 (74 * 2 + 1)
+#define PCH_ADD_74(a, b) ((a) + (b) + 74)
+typedef int pch_int_74;
+int pch_function_74(pch_int_74 a, int b);
+#define PCH_VALUE_75 (75 * 2 + 1)
+#define PCH_ADD_75(a, b) ((a) + (b) + 75)
+typedef int pch_int_75;
+int pch_function_75(pch_int_75 a, int b);
+#define PCH_VALUE_76 (76 * 2 + 1)
+#define PCH_ADD_76(a, b) ((a) + (b) + 76)
+typedef int pch_int_76;
+int pch_function_76(pch_int_76 a, int b);
+#define PCH_VALUE_77 (77 * 2 + 1)
+#define PCH_ADD_77(a, b) ((a) + (b) + 77)
+typedef int pch_int_77;
+int pch_function_77(pch_int_77 a, int b);
+#define PCH_VALUE_78 (78 * 2 + 1)
+#define PCH_ADD_78(a, b) ((a) + (b) + 78)
+typedef int pch_int_78;
+int pch_function_78(pch_int_78 a, int b);
+#define PCH_VALUE_79 (79 * 2 + 1)
+#define PCH_ADD_79(a, b) ((a) + (b) + 79)
+typedef int pch_int_79;
+int pch_function_79(pch_int_79 a, int b);
+#define PCH_VALUE_80 (80 * 2 + 1)
+#define PCH_ADD_80(a, b) ((a) + (b) + 80)
+typedef int pch_int_80;
+int pch_function_80(pch_int_80 a, int b);
+#define PCH_VALUE_81 (81 * 2 + 1)
+#define PCH_ADD_81(a, b) ((a) + (b) + 81)
+typedef int pch_int_81;
+int pch_function_81(pch_int_81 a, int b);
+#define PCH_VALUE_82 (82 * 2 + 1)
+#define PCH_ADD_82(a, b) ((a) + (b) + 82)
+typedef int pch_int_82;
+int pch_function_82(pch_int_82 a, int b);
+#define PCH_VALUE_83 (83 * 2 + 1)
+#define PCH_ADD_83(a, b) ((a) + (b) + 83)
+typedef int pch_int_83;
+int pch_function_83(pch_int_83 a, int b);
+#define PCH_VALUE_84 (84 * 2 + 1)
+#define PCH_ADD_84(a, b) ((a) + (b) + 84)
+typedef int pch_int_84;
+int pch_function_84(pch_int_84 a, int b);
+#define PCH_VALUE_85 (85 * 2 + 1)
+#define PCH_ADD_85(a, b) ((a) + (b) + 85)
+typedef int pch_int_85;
+int pch_function_85(pch_int_85 a, int b);
+#define PCH_VALUE_86 (86 * 2 + 1)
+#define PCH_ADD_86(a, b) ((a) + (b) + 86)
+typedef int pch_int_86;
+int pch_function_86(pch_int_86 a, int b);
+#define PCH_VALUE_87 (87 * 2 + 1)
+#define PCH_ADD_87(a, b) ((a) + (b) + 87)
+typedef int pch_int_87;
+int pch_function_87(pch_int_87 a, int b);
+#define PCH_VALUE_88 (88 * 2 + 1)
+#define PCH_ADD_88(a, b) ((a) + (b) + 88)
+typedef int pch_int_88;
+int pch_function_88(pch_int_88 a, int b);
+#define PCH_VALUE_89 (89 * 2 + 1)
+#define PCH_ADD_89(a, b) ((a) + (b) + 89)
+typedef int pch_int_89;
+int pch_function_89(pch_int_89 a, int b);
+#define PCH_VALUE_90 (90 * 2 + 1)
+#define PCH_ADD_90(a, b) ((a) + (b) + 90)
+typedef int pch_int_90;
+int pch_function_90(pch_int_90 a, int b);
+#define PCH_VALUE_91 (91 * 2 + 1)
+#define PCH_ADD_91(a, b) ((a) + (b) + 91)
+typedef int pch_int_91;
+int pch_function_91(pch_int_91 a, int b);
+#define PCH_VALUE_92 (92 * 2 + 1)
+#define PCH_ADD_92(a, b) ((a) + (b) + 92)
+typedef int pch_int_92;
+int pch_function_92(pch_int_92 a, int b);
+#define PCH_VALUE_93 (93 * 2 + 1)
+#define PCH_ADD_93(a, b) ((a) + (b) + 93)
+typedef int pch_int_93;
+int pch_function_93(pch_int_93 a, int b);
+#define PCH_VALUE_94 (94 * 2 + 1)
+#define PCH_ADD_94(a, b) ((a) + (b) + 94)
+typedef int pch_int_94;
+int pch_function_94(pch_int_94 a, int b);
+#define PCH_VALUE_95 (95 * 2 + 1)
+#define PCH_ADD_95(a, b) ((a) + (b) + 95)
+typedef int pch_int_95;
+int pch_function_95(pch_int_95 a, int b);
+#define PCH_VALUE_96 (96 * 2 + 1)
+#define PCH_ADD_96(a, b) ((a) + (b) + 96)
+typedef int pch_int_96;
+int pch_function_96(pch_int_96 a, int b);
+#define PCH_VALUE_97 (97 * 2 + 1)
+#define PCH_ADD_97(a, b) ((a) + (b) + 97)
+typedef int pch_int_97;
+int pch_function_97(pch_int_97 a, int b);
+#define PCH_VALUE_98 (98 * 2 + 1)
+#define PCH_ADD_98(a, b) ((a) + (b) + 98)
+typedef int pch_int_98;
+int pch_function_98(pch_int_98 a, int b);
+#define PCH_VALUE_99 (99 * 2 + 1)
+#define PCH_ADD_99(a, b) ((a) + (b) + 99)
+typedef int pch_int_99;
+int pch_function_99(pch_int_99 a, int b);
+#define PCH_VALUE_100 (100 * 2 + 1)
+#define PCH_ADD_100(a, b) ((a) + (b) + 100)
+typedef int pch_int_100;
+int pch_function_100(pch_int_100 a, int b);
+#define PCH_VALUE_101 (101 * 2 + 1)
+#define PCH_ADD_101(a, b) ((a) + (b) + 101)
+typedef int pch_int_101;
+int pch_function_101(pch_int_101 a, int b);
+#define PCH_VALUE_102 (102 * 2 + 1)
+#define PCH_ADD_102(a, b) ((a) + (b) + 102)
+typedef int pch_int_102;
+int pch_function_102(pch_int_102 a, int b);
+#define PCH_VALUE_103 (103 * 2 + 1)
+#define PCH_ADD_103(a, b) ((a) + (b) + 103)
+typedef int pch_int_103;
+int pch_function_103(pch_int_103 a, int b);
+#define PCH_VALUE_104 (104 * 2 + 1)
+#define PCH_ADD_104(a, b) ((a) + (b) + 104)
+typedef int pch_int_104;
+int pch_function_104(pch_int_104 a, int b);
+#define PCH_VALUE_105 (105 * 2 + 1)
+#define PCH_ADD_105(a, b) ((a) + (b) + 105)
+typedef int pch_int_105;
+int pch_function_105(pch_int_105 a, int b);
+#define PCH_VALUE_106 (106 * 2 + 1)
+#define PCH_ADD_106(a, b) ((a) + (b) + 106)
+typedef int pch_int_106;
+int pch_function_106(pch_int_106 a, int b);
+#define PCH_VALUE_107 (107 * 2 + 1)
+#define PCH_ADD_107(a, b) ((a) + (b) + 107)
+typedef int pch_int_107;
+int pch_function_107(pch_int_107 a, int b);
+#define PCH_VALUE_108 (108 * 2 + 1)
+#define PCH_ADD_108(a, b) ((a) + (b) + 108)
+typedef int pch_int_108;
+int pch_function_108(pch_int_108 a, int b);
+#define PCH_VALUE_109 (109 * 2 + 1)
+#define PCH_ADD_109(a, b) ((a) + (b) + 109)
+typedef int pch_int_109;
+int pch_function_109(pch_int_109 a, int b);
+#define PCH_VALUE_110 (110 * 2 + 1)
+#define PCH_ADD_110(a, b) ((a) + (b) + 110)
+typedef int pch_int_110;
+int pch_function_110(pch_int_110 a, int b);
+#define PCH_VALUE_111 (111 * 2 + 1)
+#define PCH_ADD_111(a, b) ((a) + (b) + 111)
+typedef int pch_int_111;
+int pch_function_111(pch_int_111 a, int b);
+#define PCH_VALUE_112 (112 * 2 + 1)
+#define PCH_ADD_112(a, b) ((a) + (b) + 112)
+typedef int pch_int_112;
+int pch_function_112(pch_int_112 a, int b);
+#define PCH_VALUE_113 (113 * 2 + 1)
+#define PCH_ADD_113(a, b) ((a) + (b) + 113)
+typedef int pch_int_113;
+int pch_function_113(pch_int_113 a, int b);
+#define PCH_VALUE_114 (114 * 2 + 1)
+#define PCH_ADD_114(a, b) ((a) + (b) + 114)
+typedef int pch_int_114;
+int pch_function_114(pch_int_114 a, int b);
+#define PCH_VALUE_115 (115 * 2 + 1)
+#define PCH_ADD_115(a, b) ((a) + (b) + 115)
+typedef int pch_int_115;
+int pch_function_115(pch_int_115 a, int b);
+#define PCH_VALUE_116 (116 * 2 + 1)
+#define PCH_ADD_116(a, b) ((a) + (b) + 116)
+typedef int pch_int_116;
+int pch_function_116(pch_int_116 a, int b);
+#define PCH_VALUE_117 (117 * 2 + 1)
+#define PCH_ADD_117(a, b) ((a) + (b) + 117)
+typedef int pch_int_117;
+int pch_function_117(pch_int_117 a, int b);
+#define PCH_VALUE_118 (118 * 2 + 1)
+#define PCH_ADD_118(a, b) ((a) + (b) + 118)
+typedef int pch_int_118;
+int pch_function_118(pch_int_118 a, int b);
+#define PCH_VALUE_119 (119 * 2 + 1)
+#define PCH_ADD_119(a, b) ((a) + (b) + 119)
+typedef int pch_int_119;
+int pch_function_119(pch_int_119 a, int b);
+#define PCH_VALUE_120 (120 * 2 + 1)
+#define PCH_ADD_120(a, b) ((a) + (b) + 120)
+typedef int pch_int_120;
+int pch_function_120(pch_int_120 a, int b);
+#define PCH_VALUE_121 (121 * 2 + 1)
+#define PCH_ADD_121(a, b) ((a) + (b) + 121)
+typedef int pch_int_121;
+int pch_function_121(pch_int_121 a, int b);
+#define PCH_VALUE_122 (122 * 2 + 1)
+#define PCH_ADD_122(a, b) ((a) + (b) + 122)
+typedef int pch_int_122;
+int pch_function_122(pch_int_122 a, int b);
+#define PCH_VALUE_123 (123 * 2 + 1)
+#define PCH_ADD_123(a, b) ((a) + (b) + 123)
+typedef int pch_int_123;
+int pch_function_123(pch_int_123 a, int b);
+#define PCH_VALUE_124 (124 * 2 + 1)
+#define PCH_ADD_124(a, b) ((a) + (b) + 124)
+typedef int pch_int_124;
+int pch_function_124(pch_int_124 a, int b);
+#define PCH_VALUE_125 (125 * 2 + 1)
+#define PCH_ADD_125(a, b) ((a) + (b) + 125)
+typedef int pch_int_125;
+int pch_function_125(pch_int_125 a, int b);
+#define PCH_VALUE_126 (126 * 2 + 1)
+#define PCH_ADD_126(a, b) ((a) + (b) + 126)
+typedef int pch_int_126;
+int pch_function_126(pch_int_126 a, int b);
+#define PCH_VALUE_127 (127 * 2 + 1)
+#define PCH_ADD_127(a, b) ((a) + (b) + 127)
+typedef int pch_int_127;
+int pch_function_127(pch_int_127 a, int b);
+#define PCH_VALUE_128 (128 * 2 + 1)
+#define PCH_ADD_128(a, b) ((a) + (b) + 128)
+typedef int pch_int_128;
+int pch_function_128(pch_int_128 a, int b);
+#define PCH_VALUE_129 (129 * 2 + 1)
+#define PCH_ADD_129(a, b) ((a) + (b) + 129)
+typedef int pch_int_129;
+int pch_function_129(pch_int_129 a, int b);
+#define PCH_VALUE_130 (130 * 2 + 1)
+#define PCH_ADD_130(a, b) ((a) + (b) + 130)
+typedef int pch_int_130;
+int pch_function_130(pch_int_130 a, int b);
+#define PCH_VALUE_131 (131 * 2 + 1)
+#define PCH_ADD_131(a, b) ((a) + (b) + 131)
+typedef int pch_int_131;
+int pch_function_131(pch_int_131 a, int b);
+#define PCH_VALUE_132 (132 * 2 + 1)
+#define PCH_ADD_132(a, b) ((a) + (b) + 132)
+typedef int pch_int_132;
+int pch_function_132(pch_int_132 a, int b);
+#define PCH_VALUE_133 (133 * 2 + 1)
+#define PCH_ADD_133(a, b) ((a) + (b) + 133)
+typedef int pch_int_133;
+int pch_function_133(pch_int_133 a, int b);
+#define PCH_VALUE_134 (134 * 2 + 1)
+#define PCH_ADD_134(a, b) ((a) + (b) + 134)
+typedef int pch_int_134;
+int pch_function_134(pch_int_134 a, int b);
+#define PCH_VALUE_135 (135 * 2 + 1)
+#define PCH_ADD_135(a, b) ((a) + (b) + 135)
+typedef int pch_int_135;
+int pch_function_135(pch_int_135 a, int b);
+#define PCH_VALUE_136 (136 * 2 + 1)
+#define PCH_ADD_136(a, b) ((a) + (b) + 136)
+typedef int pch_int_136;
+int pch_function_136(pch_int_136 a, int b);
+#define PCH_VALUE_137 (137 * 2 + 1)
+#define PCH_ADD_137(a, b) ((a) + (b) + 137)
+typedef int pch_int_137;
+int pch_function_137(pch_int_137 a, int b);
+#define PCH_VALUE_138 (138 * 2 + 1)
+#define PCH_ADD_138(a, b) ((a) + (b) + 138)
+typedef int pch_int_138;
+int pch_function_138(pch_int_138 a, int b);
+#define PCH_VALUE_139 (139 * 2 + 1)
+#define PCH_ADD_139(a, b) ((a) + (b) + 139)
+typedef int pch_int_139;
+int pch_function_139(pch_int_139 a, int b);
+#define PCH_VALUE_140 (140 * 2 + 1)
+#define PCH_ADD_140(a, b) ((a) + (b) + 140)
+typedef int pch_int_140;
+int pch_function_140(pch_int_140 a, int b);
+#define PCH_VALUE_141 (141 * 2 + 1)
+#define PCH_ADD_141(a, b) ((a) + (b) + 141)
+typedef int pch_int_141;
+int pch_function_141(pch_int_141 a, int b);
+#define PCH_VALUE_142 (142 * 2 + 1)
+#define PCH_ADD_142(a, b) ((a) + (b) + 142)
+typedef int pch_int_142;
+int pch_function_142(pch_int_142 a, int b);
+#define PCH_VALUE_143 (143 * 2 + 1)
+#define PCH_ADD_143(a, b) ((a) + (b) + 143)
+typedef int pch_int_143;
+int pch_function_143(pch_int_143 a, int b);
+#define PCH_VALUE_144 (144 * 2 + 1)
+#define PCH_ADD_144(a, b) ((a) + (b) + 144)
+typedef int pch_int_144;
+int pch_function_144(pch_int_144 a, int b);
+#define PCH_VALUE_145 (145 * 2 + 1)
+#define PCH_ADD_145(a, b) ((a) + (b) + 145)
+typedef int pch_int_145;
+int pch_function_145(pch_int_145 a, int b);
+#define PCH_VALUE_146 (146 * 2 + 1)
+#define PCH_ADD_146(a, b) ((a) + (b) + 146)
+typedef int pch_int_146;
+int pch_function_146(pch_int_146 a, int b);
+#define PCH_VALUE_147 (147 * 2 + 1)
+#define PCH_ADD_147(a, b) ((a) + (b) + 147)
+typedef int pch_int_147;
+int pch_function_147(pch_int_147 a, int b);
+#define PCH_VALUE_148 (148 * 2 + 1)
+#define PCH_ADD_148(a, b) ((a) + (b) + 148)
+typedef int pch_int_148;
+int pch_function_148(pch_int_148 a, int b);
+#define PCH_VALUE_149 (149 * 2 + 1)
+#define PCH_ADD_149(a, b) ((a) + (b) + 149)
+typedef int pch_int_149;
+int pch_function_149(pch_int_149 a, int b);
+#define PCH_VALUE_150 (150 * 2 + 1)
+#define PCH_ADD_150(a, b) ((a) + (b) + 150)
+typedef int pch_int_150;
+int pch_function_150(pch_int_150 a, int b);
+#define PCH_VALUE_151 (151 * 2 + 1)
+#define PCH_ADD_151(a, b) ((a) + (b) + 151)
+typedef int pch_int_151;
+int pch_function_151(pch_int_151 a, int b);
+#define PCH_VALUE_152 (152 * 2 + 1)
+#define PCH_ADD_152(a, b) ((a) + (b) + 152)
+typedef int pch_int_152;
+int pch_function_152(pch_int_152 a, int b);
+#define PCH_VALUE_153 (153 * 2 + 1)
+#define PCH_ADD_153(a, b) ((a) + (b) + 153)
+typedef int pch_int_153;
+int pch_function_153(pch_int_153 a, int b);
+#define PCH_VALUE_154 (154 * 2 + 1)
+#define PCH_ADD_154(a, b) ((a) + (b) + 154)
+typedef int pch_int_154;
+int pch_function_154(pch_int_154 a, int b);
+#define PCH_VALUE_155 (155 * 2 + 1)
+#define PCH_ADD_155(a, b) ((a) + (b) + 155)
+typedef int pch_int_155;
+int pch_function_155(pch_int_155 a, int b);
+#define PCH_VALUE_156 (156 * 2 + 1)
+#define PCH_ADD_156(a, b) ((a) + (b) + 156)
+typedef int pch_int_156;
+int pch_function_156(pch_int_156 a, int b);
+#define PCH_VALUE_157 (157 * 2 + 1)
+#define PCH_ADD_157(a, b) ((a) + (b) + 157)
+typedef int pch_int_157;
+int pch_function_157(pch_int_157 a, int b);
+#define PCH_VALUE_158 (158 * 2 + 1)
+#define PCH_ADD_158(a, b) ((a) + (b) + 158)
+typedef int pch_int_158;
+int pch_function_158(pch_int_158 a, int b);
+#define PCH_VALUE_159 (159 * 2 + 1)
+#define PCH_ADD_159(a, b) ((a) + (b) + 159)
+typedef int pch_int_159;
+int pch_function_159(pch_int_159 a, int b);
+#define PCH_VALUE_160 (160 * 2 + 1)
+#define PCH_ADD_160(a, b) ((a) + (b) + 160)
+typedef int pch_int_160;
+int pch_function_160(pch_int_160 a, int b);
+#define PCH_VALUE_161 (161 * 2 + 1)
+#define PCH_ADD_161(a, b) ((a) + (b) + 161)
+typedef int pch_int_161;
+int pch_function_161(pch_int_161 a, int b);
+#define PCH_VALUE_162 (162 * 2 + 1)
+#define PCH_ADD_162(a, b) ((a) + (b) + 162)
+typedef int pch_int_162;
+int pch_function_162(pch_int_162 a, int b);
+#define PCH_VALUE_163 (163 * 2 + 1)
+#define PCH_ADD_163(a, b) ((a) + (b) + 163)
+typedef int pch_int_163;
+int pch_function_163(pch_int_163 a, int b);
+#define PCH_VALUE_164 (164 * 2 + 1)
+#define PCH_ADD_164(a, b) ((a) + (b) + 164)
+typedef int pch_int_164;
+int pch_function_164(pch_int_164 a, int b);
+#define PCH_VALUE_165 (165 * 2 + 1)
+#define PCH_ADD_165(a, b) ((a) + (b) + 165)
+typedef int pch_int_165;
+int pch_function_165(pch_int_165 a, int b);
+#define PCH_VALUE_166 (166 * 2 + 1)
+#define PCH_ADD_166(a, b) ((a) + (b) + 166)
+typedef int pch_int_166;
+int pch_function_166(pch_int_166 a, int b);
+#define PCH_VALUE_167 (167 * 2 + 1)
+#define PCH_ADD_167(a, b) ((a) + (b) + 167)
+typedef int pch_int_167;
+int pch_function_167(pch_int_167 a, int b);
+#define PCH_VALUE_168 (168 * 2 + 1)
+#define PCH_ADD_168(a, b) ((a) + (b) + 168)
+typedef int pch_int_168;
+int pch_function_168(pch_int_168 a, int b);
+#define PCH_VALUE_169 (169 * 2 + 1)
+#define PCH_ADD_169(a, b) ((a) + (b) + 169)
+typedef int pch_int_169;
+int pch_function_169(pch_int_169 a, int b);
+#define PCH_VALUE_170 (170 * 2 + 1)
+#define PCH_ADD_170(a, b) ((a) + (b) + 170)
+typedef int pch_int_170;
+int pch_function_170(pch_int_170 a, int b);
+#define PCH_VALUE_171 (171 * 2 + 1)
+#define PCH_ADD_171(a, b) ((a) + (b) + 171)
+typedef int pch_int_171;
+int pch_function_171(pch_int_171 a, int b);
+#define PCH_VALUE_172 (172 * 2 + 1)
+#define PCH_ADD_172(a, b) ((a) + (b) + 172)
+typedef int pch_int_172;
+int pch_function_172(pch_int_172 a, int b);
+#define PCH_VALUE_173 (173 * 2 + 1)
+#define PCH_ADD_173(a, b) ((a) + (b) + 173)
+typedef int pch_int_173;
+int pch_function_173(pch_int_173 a, int b);
+#define PCH_VALUE_174 (174 * 2 + 1)
+#define PCH_ADD_174(a, b) ((a) + (b) + 174)
+typedef int pch_int_174;
+int pch_function_174(pch_int_174 a, int b);
+#define PCH_VALUE_175 (175 * 2 + 1)
+#define PCH_ADD_175(a, b) ((a) + (b) + 175)
+typedef int pch_int_175;
+int pch_function_175(pch_int_175 a, int b);
+#define PCH_VALUE_176 (176 * 2 + 1)
+#define PCH_ADD_176(a, b) ((a) + (b) + 176)
+typedef int pch_int_176;
+int pch_function_176(pch_int_176 a, int b);
+#define PCH_VALUE_177 (177 * 2 + 1)
+#define PCH_ADD_177(a, b) ((a) + (b) + 177)
+typedef int pch_int_177;
+int pch_function_177(pch_int_177 a, int b);
+#define PCH_VALUE_178 (178 * 2 + 1)
+#define PCH_ADD_178(a, b) ((a) + (b) + 178)
+typedef int pch_int_178;
+int pch_function_178(pch_int_178 a, int b);
+#define PCH_VALUE_179 (179 * 2 + 1)
+#define PCH_ADD_179(a, b) ((a) + (b) + 179)
+typedef int pch_int_179;
+int pch_function_179(pch_int_179 a, int b);
+#define PCH_VALUE_180 (180 * 2 + 1)
+#define PCH_ADD_180(a, b) ((a) + (b) + 180)
+typedef int pch_int_180;
+int pch_function_180(pch_int_180 a, int b);
+#define PCH_VALUE_181 (181 * 2 + 1)
+#define PCH_ADD_181(a, b) ((a) + (b) + 181)
+typedef int pch_int_181;
+int pch_function_181(pch_int_181 a, int b);
+#define PCH_VALUE_182 (182 * 2 + 1)
+#define PCH_ADD_182(a, b) ((a) + (b) + 182)
+typedef int pch_int_182;
+int pch_function_182(pch_int_182 a, int b);
+#define PCH_VALUE_183 (183 * 2 + 1)
+#define PCH_ADD_183(a, b) ((a) + (b) + 183)
+typedef int pch_int_183;
+int pch_function_183(pch_int_183 a, int b);
+#define PCH_VALUE_184 (184 * 2 + 1)
+#define PCH_ADD_184(a, b) ((a) + (b) + 184)
+typedef int pch_int_184;
+int pch_function_184(pch_int_184 a, int b);
+#define PCH_VALUE_185 (185 * 2 + 1)
+#define PCH_ADD_185(a, b) ((a) + (b) + 185)
+typedef int pch_int_185;
+int pch_function_185(pch_int_185 a, int b);
+#define PCH_VALUE_186 (186 * 2 + 1)
+#define PCH_ADD_186(a, b) ((a) + (b) + 186)
+typedef int pch_int_186;
+int pch_function_186(pch_int_186 a, int b);
+#define PCH_VALUE_187 (187 * 2 + 1)
+#define PCH_ADD_187(a, b) ((a) + (b) + 187)
+typedef int pch_int_187;
+int pch_function_187(pch_int_187 a, int b);
+#define PCH_VALUE_188 (188 * 2 + 1)
+#define PCH_ADD_188(a, b) ((a) + (b) + 188)
+typedef int pch_int_188;
+int pch_function_188(pch_int_188 a, int b);
+#define PCH_VALUE_189 (189 * 2 + 1)
+#define PCH_ADD_189(a, b) ((a) + (b) + 189)
+typedef int pch_int_189;
+int pch_function_189(pch_int_189 a, int b);
+#define PCH_VALUE_190 (190 * 2 + 1)
+#define PCH_ADD_190(a, b) ((a) + (b) + 190)
+typedef int pch_int_190;
+int pch_function_190(pch_int_190 a, int b);
+#define PCH_VALUE_191 (191 * 2 + 1)
+#define PCH_ADD_191(a, b) ((a) + (b) + 191)
+typedef int pch_int_191;
+int pch_function_191(pch_int_191 a, int b);
+#define PCH_VALUE_192 (192 * 2 + 1)
+#define PCH_ADD_192(a, b) ((a) + (b) + 192)
+typedef int pch_int_192;
+int pch_function_192(pch_int_192 a, int b);
+#define PCH_VALUE_193 (193 * 2 + 1)
+#define PCH_ADD_193(a, b) ((a) + (b) + 193)
+typedef int pch_int_193;
+int pch_function_193(pch_int_193 a, int b);
+#define PCH_VALUE_194 (194 * 2 + 1)
+#define PCH_ADD_194(a, b) ((a) + (b) + 194)
+typedef int pch_int_194;
+int pch_function_194(pch_int_194 a, int b);
+#define PCH_VALUE_195 (195 * 2 + 1)
+#define PCH_ADD_195(a, b) ((a) + (b) + 195)
+typedef int pch_int_195;
+int pch_function_195(pch_int_195 a, int b);
+#define PCH_VALUE_196 (196 * 2 + 1)
+#define PCH_ADD_196(a, b) ((a) + (b) + 196)
+typedef int pch_int_196;
+int pch_function_196(pch_int_196 a, int b);
+#define PCH_VALUE_197 (197 * 2 + 1)
+#define PCH_ADD_197(a, b) ((a) + (b) + 197)
+typedef int pch_int_197;
+int pch_function_197(pch_int_197 a, int b);
+#define PCH_VALUE_198 (198 * 2 + 1)
+#define PCH_ADD_198(a, b) ((a) + (b) + 198)
+typedef int pch_int_198;
+int pch_function_198(pch_int_198 a, int b);
+#define PCH_VALUE_199 (199 * 2 + 1)
+#define PCH_ADD_199(a, b) ((a) + (b) + 199)
+typedef int pch_int_199;
+int pch_function_199(pch_int_199 a, int b);
+#define PCH_VALUE_200 (200 * 2 + 1)
+#define PCH_ADD_200(a, b) ((a) + (b) + 200)
+typedef int pch_int_200;
+int pch_function_200(pch_int_200 a, int b);
+#define PCH_VALUE_201 (201 * 2 + 1)
+#define PCH_ADD_201(a, b) ((a) + (b) + 201)
+typedef int pch_int_201;
+int pch_function_201(pch_int_201 a, int b);
+#define PCH_VALUE_202 (202 * 2 + 1)
+#define PCH_ADD_202(a, b) ((a) + (b) + 202)
+typedef int pch_int_202;
+int pch_function_202(pch_int_202 a, int b);
+#define PCH_VALUE_203 (203 * 2 + 1)
+#define PCH_ADD_203(a, b) ((a) + (b) + 203)
+typedef int pch_int_203;
+int pch_function_203(pch_int_203 a, int b);
+#define PCH_VALUE_204 (204 * 2 + 1)
+#define PCH_ADD_204(a, b) ((a) + (b) + 204)
+typedef int pch_int_204;
+int pch_function_204(pch_int_204 a, int b);
+#define PCH_VALUE_205 (205 * 2 + 1)
+#define PCH_ADD_205(a, b) ((a) + (b) + 205)
+typedef int pch_int_205;
+int pch_function_205(pch_int_205 a, int b);
+#define PCH_VALUE_206 (206 * 2 + 1)
+#define PCH_ADD_206(a, b) ((a) + (b) + 206)
+typedef int pch_int_206;
+int pch_function_206(pch_int_206 a, int b);
+#define PCH_VALUE_207 (207 * 2 + 1)
+#define PCH_ADD_207(a, b) ((a) + (b) + 207)
+typedef int pch_int_207;
+int pch_function_207(pch_int_207 a, int b);
+#define PCH_VALUE_208 (208 * 2 + 1)
+#define PCH_ADD_208(a, b) ((a) + (b) + 208)
+typedef int pch_int_208;
+int pch_function_208(pch_int_208 a, int b);
+#define PCH_VALUE_209 (209 * 2 + 1)
+#define PCH_ADD_209(a, b) ((a) + (b) + 209)
+typedef int pch_int_209;
+int pch_function_209(pch_int_209 a, int b);
+#define PCH_VALUE_210 (210 * 2 + 1)
+#define PCH_ADD_210(a, b) ((a) + (b) + 210)
+typedef int pch_int_210;
+int pch_function_210(pch_int_210 a, int b);
+#define PCH_VALUE_211 (211 * 2 + 1)
+#define PCH_ADD_211(a, b) ((a) + (b) + 211)
+typedef int pch_int_211;
+int pch_function_211(pch_int_211 a, int b);
+#define PCH_VALUE_212 (212 * 2 + 1)
+#define PCH_ADD_212(a, b) ((a) + (b) + 212)
+typedef int pch_int_212;
+int pch_function_212(pch_int_212 a, int b);
+#define PCH_VALUE_213 (213 * 2 + 1)
+#define PCH_ADD_213(a, b) ((a) + (b) + 213)
+typedef int pch_int_213;
+int pch_function_213(pch_int_213 a, int b);
+#define PCH_VALUE_214 (214 * 2 + 1)
+#define PCH_ADD_214(a, b) ((a) + (b) + 214)
+typedef int pch_int_214;
+int pch_function_214(pch_int_214 a, int b);
+#define PCH_VALUE_215 (215 * 2 + 1)
+#define PCH_ADD_215(a, b) ((a) + (b) + 215)
+typedef int pch_int_215;
+int pch_function_215(pch_int_215 a, int b);
+#define PCH_VALUE_216 (216 * 2 + 1)
+#define PCH_ADD_216(a, b) ((a) + (b) + 216)
+typedef int pch_int_216;
+int pch_function_216(pch_int_216 a, int b);
+#define PCH_VALUE_217 (217 * 2 + 1)
+#define PCH_ADD_217(a, b) ((a) + (b) + 217)
+typedef int pch_int_217;
+int pch_function_217(pch_int_217 a, int b);
+#define PCH_VALUE_218 (218 * 2 + 1)
+#define PCH_ADD_218(a, b) ((a) + (b) + 218)
+typedef int pch_int_218;
+int pch_function_218(pch_int_218 a, int b);
+#define PCH_VALUE_219 (219 * 2 + 1)
+#define PCH_ADD_219(a, b) ((a) + (b) + 219)
+typedef int pch_int_219;
+int pch_function_219(pch_int_219 a, int b);
+#define PCH_VALUE_220 (220 * 2 + 1)
+#define PCH_ADD_220(a, b) ((a) + (b) + 220)
+typedef int pch_int_220;
+int pch_function_220(pch_int_220 a, int b);
+#define PCH_VALUE_221 (221 * 2 + 1)
+#define PCH_ADD_221(a, b) ((a) + (b) + 221)
+typedef int pch_int_221;
+int pch_function_221(pch_int_221 a, int b);
+#define PCH_VALUE_222 (222 * 2 + 1)
+#define PCH_ADD_222(a, b) ((a) + (b) + 222)
+typedef int pch_int_222;
+int pch_function_222(pch_int_222 a, int b);
+#define PCH_VALUE_223 (223 * 2 + 1)
+#define PCH_ADD_223(a, b) ((a) + (b) + 223)
+typedef int pch_int_223;
+int pch_function_223(pch_int_223 a, int b);
+#define PCH_VALUE_224 (224 * 2 + 1)
+#define PCH_ADD_224(a, b) ((a) + (b) + 224)
+typedef int pch_int_224;
+int pch_function_224(pch_int_224 a, int b);
+#define PCH_VALUE_225 (225 * 2 + 1)
+#define PCH_ADD_225(a, b) ((a) + (b) + 225)
+typedef int pch_int_225;
+int pch_function_225(pch_int_225 a, int b);
+#define PCH_VALUE_226 (226 * 2 + 1)
+#define PCH_ADD_226(a, b) ((a) + (b) + 226)
+typedef int pch_int_226;
+int pch_function_226(pch_int_226 a, int b);
+#define PCH_VALUE_227 (227 * 2 + 1)
+#define PCH_ADD_227(a, b) ((a) + (b) + 227)
+typedef int pch_int_227;
+int pch_function_227(pch_int_227 a, int b);
+#define PCH_VALUE_228 (228 * 2 + 1)
+#define PCH_ADD_228(a, b) ((a) + (b) + 228)
+typedef int pch_int_228;
+int pch_function_228(pch_int_228 a, int b);
+#define PCH_VALUE_229 (229 * 2 + 1)
+#define PCH_ADD_229(a, b) ((a) + (b) + 229)
+typedef int pch_int_229;
+int pch_function_229(pch_int_229 a, int b);
+#define PCH_VALUE_230 (230 * 2 + 1)
+#define PCH_ADD_230(a, b) ((a) + (b) + 230)
+typedef int pch_int_230;
+int pch_function_230(pch_int_230 a, int b);
+#define PCH_VALUE_231 (231 * 2 + 1)
+#define PCH_ADD_231(a, b) ((a) + (b) + 231)
+typedef int pch_int_231;
+int pch_function_231(pch_int_231 a, int b);
+#define PCH_VALUE_232 (232 * 2 + 1)
+#define PCH_ADD_232(a, b) ((a) + (b) + 232)
+typedef int pch_int_232;
+int pch_function_232(pch_int_232 a, int b);
+#define PCH_VALUE_233 (233 * 2 + 1)
+#define PCH_ADD_233(a, b) ((a) + (b) + 233)
+typedef int pch_int_233;
+int pch_function_233(pch_int_233 a, int b);
+#define PCH_VALUE_234 (234 * 2 + 1)
+#define PCH_ADD_234(a, b) ((a) + (b) + 234)
+typedef int pch_int_234;
+int pch_function_234(pch_int_234 a, int b);
+#define PCH_VALUE_235 (235 * 2 + 1)
+#define PCH_ADD_235(a, b) ((a) + (b) + 235)
+typedef int pch_int_235;
+int pch_function_235(pch_int_235 a, int b);
+#define PCH_VALUE_236 (236 * 2 + 1)
+#define PCH_ADD_236(a, b) ((a) + (b) + 236)
+typedef int pch_int_236;
+int pch_function_236(pch_int_236 a, int b);
+#define PCH_VALUE_237 (237 * 2 + 1)
+#define PCH_ADD_237(a, b) ((a) + (b) + 237)
+typedef int pch_int_237;
+int pch_function_237(pch_int_237 a, int b);
+#define PCH_VALUE_238 (238 * 2 + 1)
+#define PCH_ADD_238(a, b) ((a) + (b) + 238)
+typedef int pch_int_238;
+int pch_function_238(pch_int_238 a, int b);
+#define PCH_VALUE_239 (239 * 2 + 1)
+#define PCH_ADD_239(a, b) ((a) + (b) + 239)
+typedef int pch_int_239;
+int pch_function_239(pch_int_239 a, int b);
+#define PCH_VALUE_240 (240 * 2 + 1)
+#define PCH_ADD_240(a, b) ((a) + (b) + 240)
+typedef int pch_int_240;
+int pch_function_240(pch_int_240 a, int b);
+#define PCH_VALUE_241 (241 * 2 + 1)
+#define PCH_ADD_241(a, b) ((a) + (b) + 241)
+typedef int pch_int_241;
+int pch_function_241(pch_int_241 a, int b);
+#define PCH_VALUE_242 (242 * 2 + 1)
+#define PCH_ADD_242(a, b) ((a) + (b) + 242)
+typedef int pch_int_242;
+int pch_function_242(pch_int_242 a, int b);
+#define PCH_VALUE_243 (243 * 2 + 1)
+#define PCH_ADD_243(a, b) ((a) + (b) + 243)
+typedef int pch_int_243;
+int pch_function_243(pch_int_243 a, int b);
+#define PCH_VALUE_244 (244 * 2 + 1)
+#define PCH_ADD_244(a, b) ((a) + (b) + 244)
+typedef int pch_int_244;
+int pch_function_244(pch_int_244 a, int b);
+#define PCH_VALUE_245 (245 * 2 + 1)
+#define PCH_ADD_245(a, b) ((a) + (b) + 245)
+typedef int pch_int_245;
+int pch_function_245(pch_int_245 a, int b);
+#define PCH_VALUE_246 (246 * 2 + 1)
+#define PCH_ADD_246(a, b) ((a) + (b) + 246)
+typedef int pch_int_246;
+int pch_function_246(pch_int_246 a, int b);
+#define PCH_VALUE_247 (247 * 2 + 1)
+#define PCH_ADD_247(a, b) ((a) + (b) + 247)
+typedef int pch_int_247;
+int pch_function_247(pch_int_247 a, int b);
+#define PCH_VALUE_248 (248 * 2 + 1)
+#define PCH_ADD_248(a, b) ((a) + (b) + 248)
+typedef int pch_int_248;
+int pch_function_248(pch_int_248 a, int b);
+#define PCH_VALUE_249 (249 * 2 + 1)
+#define PCH_ADD_249(a, b) ((a) + (b) + 249)
+typedef int pch_int_249;
+int pch_function_249(pch_int_249 a, int b);
+#define PCH_VALUE_250 (250 * 2 + 1)
+#define PCH_ADD_250(a, b) ((a) + (b) + 250)
+typedef int pch_int_250;
+int pch_function_250(pch_int_250 a, int b);
+#define PCH_VALUE_251 (251 * 2 + 1)
+#define PCH_ADD_251(a, b) ((a) + (b) + 251)
+typedef int pch_int_251;
+int pch_function_251(pch_int_251 a, int b);
+#define PCH_VALUE_252 (252 * 2 + 1)
+#define PCH_ADD_252(a, b) ((a) + (b) + 252)
+typedef int pch_int_252;
+int pch_function_252(pch_int_252 a, int b);
+#define PCH_VALUE_253 (253 * 2 + 1)
+#define PCH_ADD_253(a, b) ((a) + (b) + 253)
+typedef int pch_int_253;
+int pch_function_253(pch_int_253 a, int b);
+#define PCH_VALUE_254 (254 * 2 + 1)
+#define PCH_ADD_254(a, b) ((a) + (b) + 254)
+typedef int pch_int_254;
+int pch_function_254(pch_int_254 a, int b);
+#define PCH_VALUE_255 (255 * 2 + 1)
+#define PCH_ADD_255(a, b) ((a) + (b) + 255)
+typedef int pch_int_255;
+int pch_function_255(pch_int_255 a, int b);
+#define PCH_VALUE_256 (256 * 2 + 1)
+#define PCH_ADD_256(a, b) ((a) + (b) + 256)
+typedef int pch_int_256;
+int pch_function_256(pch_int_256 a, int b);
+#define PCH_VALUE_257 (257 * 2 + 1)
+#define PCH_ADD_257(a, b) ((a) + (b) + 257)
+typedef int pch_int_257;
+int pch_function_257(pch_int_257 a, int b);
+#define PCH_VALUE_258 (258 * 2 + 1)
+#define PCH_ADD_258(a, b) ((a) + (b) + 258)
+typedef int pch_int_258;
+int pch_function_258(pch_int_258 a, int b);
+#define PCH_VALUE_259 (259 * 2 + 1)
+#define PCH_ADD_259(a, b) ((a) + (b) + 259)
+typedef int pch_int_259;
+int pch_function_259(pch_int_259 a, int b);
+#define PCH_VALUE_260 (260 * 2 + 1)
+#define PCH_ADD_260(a, b) ((a) + (b) + 260)
+typedef int pch_int_260;
+int pch_function_260(pch_int_260 a, int b);
+#define PCH_VALUE_261 (261 * 2 + 1)
+#define PCH_ADD_261(a, b) ((a) + (b) + 261)
+typedef int pch_int_261;
+int pch_function_261(pch_int_261 a, int b);
+#define PCH_VALUE_262 (262 * 2 + 1)
+#define PCH_ADD_262(a, b) ((a) + (b) + 262)
+typedef int pch_int_262;
+int pch_function_262(pch_int_262 a, int b);
+#define PCH_VALUE_263 (263 * 2 + 1)
+#define PCH_ADD_263(a, b) ((a) + (b) + 263)
+typedef int pch_int_263;
+int pch_function_263(pch_int_263 a, int b);
+#define PCH_VALUE_264 (264 * 2 + 1)
+#define PCH_ADD_264(a, b) ((a) + (b) + 264)
+typedef int pch_int_264;
+int pch_function_264(pch_int_264 a, int b);
+#define PCH_VALUE_265 (265 * 2 + 1)
+#define PCH_ADD_265(a, b) ((a) + (b) + 265)
+typedef int pch_int_265;
+int pch_function_265(pch_int_265 a, int b);
+#define PCH_VALUE_266 (266 * 2 + 1)
+#define PCH_ADD_266(a, b) ((a) + (b) + 266)
+typedef int pch_int_266;
+int pch_function_266(pch_int_266 a, int b);
+#define PCH_VALUE_267 (267 * 2 + 1)
+#define PCH_ADD_267(a, b) ((a) + (b) + 267)
+typedef int pch_int_267;
+int pch_function_267(pch_int_267 a, int b);
+#define PCH_VALUE_268 (268 * 2 + 1)
+#define PCH_ADD_268(a, b) ((a) + (b) + 268)
+typedef int pch_int_268;
+int pch_function_268(pch_int_268 a, int b);
+#define PCH_VALUE_269 (269 * 2 + 1)
+#define PCH_ADD_269(a, b) ((a) + (b) + 269)
+typedef int pch_int_269;
+int pch_function_269(pch_int_269 a, int b);
+#define PCH_VALUE_270 (270 * 2 + 1)
+#define PCH_ADD_270(a, b) ((a) + (b) + 270)
+typedef int pch_int_270;
+int pch_function_270(pch_int_270 a, int b);
+#define PCH_VALUE_271 (271 * 2 + 1)
+#define PCH_ADD_271(a, b) ((a) + (b) + 271)
+typedef int pch_int_271;
+int pch_function_271(pch_int_271 a, int b);
+#define PCH_VALUE_272 (272 * 2 + 1)
+#define PCH_ADD_272(a, b) ((a) + (b) + 272)
+typedef int pch_int_272;
+int pch_function_272(pch_int_272 a, int b);
+#define PCH_VALUE_273 (273 * 2 + 1)
+#define PCH_ADD_273(a, b) ((a) + (b) + 273)
+typedef int pch_int_273;
+int pch_function_273(pch_int_273 a, int b);
+#define PCH_VALUE_274 (274 * 2 + 1)
+#define PCH_ADD_274(a, b) ((a) + (b) + 274)
+typedef int pch_int_274;
+int pch_function_274(pch_int_274 a, int b);
+#define PCH_VALUE_275 (275 * 2 + 1)
+#define PCH_ADD_275(a, b) ((a) + (b) + 275)
+typedef int pch_int_275;
+int pch_function_275(pch_int_275 a, int b);
+#define PCH_VALUE_276 (276 * 2 + 1)
+#define PCH_ADD_276(a, b) ((a) + (b) + 276)
+typedef int pch_int_276;
+int pch_function_276(pch_int_276 a, int b);
+#define PCH_VALUE_277 (277 * 2 + 1)
+#define PCH_ADD_277(a, b) ((a) + (b) + 277)
+typedef int pch_int_277;
+int pch_function_277(pch_int_277 a, int b);
+#define PCH_VALUE_278 (278 * 2 + 1)
+#define PCH_ADD_278(a, b) ((a) + (b) + 278)
+typedef int pch_int_278;
+int pch_function_278(pch_int_278 a, int b);
+#define PCH_VALUE_279 (279 * 2 + 1)
+#define PCH_ADD_279(a, b) ((a) + (b) + 279)
+typedef int pch_int_279;
+int pch_function_279(pch_int_279 a, int b);
+#define PCH_VALUE_280 (280 * 2 + 1)
+#define PCH_ADD_280(a, b) ((a) + (b) + 280)
+typedef int pch_int_280;
+int pch_function_280(pch_int_280 a, int b);
+#define PCH_VALUE_281 (281 * 2 + 1)
+#define PCH_ADD_281(a, b) ((a) + (b) + 281)
+typedef int pch_int_281;
+int pch_function_281(pch_int_281 a, int b);
+#define PCH_VALUE_282 (282 * 2 + 1)
+#define PCH_ADD_282(a, b) ((a) + (b) + 282)
+typedef int pch_int_282;
+int pch_function_282(pch_int_282 a, int b);
+#define PCH_VALUE_283 (283 * 2 + 1)
+#define PCH_ADD_283(a, b) ((a) + (b) + 283)
+typedef int pch_int_283;
+int pch_function_283(pch_int_283 a, int b);
+#define PCH_VALUE_284 (284 * 2 + 1)
+#define PCH_ADD_284(a, b) ((a) + (b) + 284)
+typedef int pch_int_284;
+int pch_function_284(pch_int_284 a, int b);
+#define PCH_VALUE_285 (285 * 2 + 1)
+#define PCH_ADD_285(a, b) ((a) + (b) + 285)
+typedef int pch_int_285;
+int pch_function_285(pch_int_285 a, int b);
+#define PCH_VALUE_286 (286 * 2 + 1)
+#define PCH_ADD_286(a, b) ((a) + (b) + 286)
+typedef int pch_int_286;
+int pch_function_286(pch_int_286 a, int b);
+#define PCH_VALUE_287 (287 * 2 + 1)
+#define PCH_ADD_287(a, b) ((a) + (b) + 287)
+typedef int pch_int_287;
+int pch_function_287(pch_int_287 a, int b);
+#define PCH_VALUE_288 (288 * 2 + 1)
+#define PCH_ADD_288(a, b) ((a) + (b) + 288)
+typedef int pch_int_288;
+int pch_function_288(pch_int_288 a, int b);
+#define PCH_VALUE_289 (289 * 2 + 1)
+#define PCH_ADD_289(a, b) ((a) + (b) + 289)
+typedef int pch_int_289;
+int pch_function_289(pch_int_289 a, int b);
+#define PCH_VALUE_290 (290 * 2 + 1)
+#define PCH_ADD_290(a, b) ((a) + (b) + 290)
+typedef int pch_int_290;
+int pch_function_290(pch_int_290 a, int b);
+#define PCH_VALUE_291 (291 * 2 + 1)
+#define PCH_ADD_291(a, b) ((a) + (b) + 291)
+typedef int pch_int_291;
+int pch_function_291(pch_int_291 a, int b);
+#define PCH_VALUE_292 (292 * 2 + 1)
+#define PCH_ADD_292(a, b) ((a) + (b) + 292)
+typedef int pch_int_292;
+int pch_function_292(pch_int_292 a, int b);
+#define PCH_VALUE_293 (293 * 2 + 1)
+#define PCH_ADD_293(a, b) ((a) + (b) + 293)
+typedef int pch_int_293;
+int pch_function_293(pch_int_293 a, int b);
+#define PCH_VALUE_294 (294 * 2 + 1)
+#define PCH_ADD_294(a, b) ((a) + (b) + 294)
+typedef int pch_int_294;
+int pch_function_294(pch_int_294 a, int b);
+#define PCH_VALUE_295 (295 * 2 + 1)
+#define PCH_ADD_295(a, b) ((a) + (b) + 295)
+typedef int pch_int_295;
+int pch_function_295(pch_int_295 a, int b);
+#define PCH_VALUE_296 (296 * 2 + 1)
+#define PCH_ADD_296(a, b) ((a) + (b) + 296)
+typedef int pch_int_296;
+int pch_function_296(pch_int_296 a, int b);
+#define PCH_VALUE_297 (297 * 2 + 1)
+#define PCH_ADD_297(a, b) ((a) + (b) + 297)
+typedef int pch_int_297;
+int pch_function_297(pch_int_297 a, int b);
+#define PCH_VALUE_298 (298 * 2 + 1)
+#define PCH_ADD_298(a, b) ((a) + (b) + 298)
+typedef int pch_int_298;
+int pch_function_298(pch_int_298 a, int b);
+#define PCH_VALUE_299 (299 * 2 + 1)
+#define PCH_ADD_299(a, b) ((a) + (b) + 299)
+typedef int pch_int_299;
+int pch_function_299(pch_int_299 a, int b);
+#define PCH_VALUE_300 (300 * 2 + 1)
+#define PCH_ADD_300(a, b) ((a) + (b) + 300)
+typedef int pch_int_300;
+int pch_function_300(pch_int_300 a, int b);
+#define PCH_VALUE_301 (301 * 2 + 1)
+#define PCH_ADD_301(a, b) ((a) + (b) + 301)
+typedef int pch_int_301;
+int pch_function_301(pch_int_301 a, int b);
+#define PCH_VALUE_302 (302 * 2 + 1)
+#define PCH_ADD_302(a, b) ((a) + (b) + 302)
+typedef int pch_int_302;
+int pch_function_302(pch_int_302 a, int b);
+#define PCH_VALUE_303 (303 * 2 + 1)
+#define PCH_ADD_303(a, b) ((a) + (b) + 303)
+typedef int pch_int_303;
+int pch_function_303(pch_int_303 a, int b);
+#define PCH_VALUE_304 (304 * 2 + 1)
+#define PCH_ADD_304(a, b) ((a) + (b) + 304)
+typedef int pch_int_304;
+int pch_function_304(pch_int_304 a, int b);
+#define PCH_VALUE_305 (305 * 2 + 1)
+#define PCH_ADD_305(a, b) ((a) + (b) + 305)
+typedef int pch_int_305;
+int pch_function_305(pch_int_305 a, int b);
+#define PCH_VALUE_306 (306 * 2 + 1)
+#define PCH_ADD_306(a, b) ((a) + (b) + 306)
+typedef int pch_int_306;
+int pch_function_306(pch_int_306 a, int b);
+#define PCH_VALUE_307 (307 * 2 + 1)
+#define PCH_ADD_307(a, b) ((a) + (b) + 307)
+typedef int pch_int_307;
+int pch_function_307(pch_int_307 a, int b);
+#define PCH_VALUE_308 (308 * 2 + 1)
+#define PCH_ADD_308(a, b) ((a) + (b) + 308)
+typedef int pch_int_308;
+int pch_function_308(pch_int_308 a, int b);
+#define PCH_VALUE_309 (309 * 2 + 1)
+#define PCH_ADD_309(a, b) ((a) + (b) + 309)
+typedef int pch_int_309;
+int pch_function_309(pch_int_309 a, int b);
+#define PCH_VALUE_310 (310 * 2 + 1)
+#define PCH_ADD_310(a, b) ((a) + (b) + 310)
+typedef int pch_int_310;
+int pch_function_310(pch_int_310 a, int b);
+#define PCH_VALUE_311 (311 * 2 + 1)
+#define PCH_ADD_311(a, b) ((a) + (b) + 311)
+typedef int pch_int_311;
+int pch_function_311(pch_int_311 a, int b);
+#define PCH_VALUE_312 (312 * 2 + 1)
+#define PCH_ADD_312(a, b) ((a) + (b) + 312)
+typedef int pch_int_312;
+int pch_function_312(pch_int_312 a, int b);
+#define PCH_VALUE_313 (313 * 2 + 1)
+#define PCH_ADD_313(a, b) ((a) + (b) + 313)
+typedef int pch_int_313;
+int pch_function_313(pch_int_313 a, int b);
+#define PCH_VALUE_314 (314 * 2 + 1)
+#define PCH_ADD_314(a, b) ((a) + (b) + 314)
+typedef int pch_int_314;
+int pch_function_314(pch_int_314 a, int b);
+#define PCH_VALUE_315 (315 * 2 + 1)
+#define PCH_ADD_315(a, b) ((a) + (b) + 315)
+typedef int pch_int_315;
+int pch_function_315(pch_int_315 a, int b);
+#define PCH_VALUE_316 (316 * 2 + 1)
+#define PCH_ADD_316(a, b) ((a) + (b) + 316)
+typedef int pch_int_316;
+int pch_function_316(pch_int_316 a, int b);
+#define PCH_VALUE_317 (317 * 2 + 1)
+#define PCH_ADD_317(a, b) ((a) + (b) + 317)
+typedef int pch_int_317;
+int pch_function_317(pch_int_317 a, int b);
+#define PCH_VALUE_318 (318 * 2 + 1)
+#define PCH_ADD_318(a, b) ((a) + (b) + 318)
+typedef int pch_int_318;
+int pch_function_318(pch_int_318 a, int b);
+#define PCH_VALUE_319 (319 * 2 + 1)
+#define PCH_ADD_319(a, b) ((a) + (b) + 319)
+typedef int pch_int_319;
+int pch_function_319(pch_int_319 a, int b);
+#define PCH_VALUE_320 (320 * 2 + 1)
+#define PCH_ADD_320(a, b) ((a) + (b) + 320)
+typedef int pch_int_320;
+int pch_function_320(pch_int_320 a, int b);
+#define PCH_VALUE_321 (321 * 2 + 1)
+#define PCH_ADD_321(a, b) ((a) + (b) + 321)
+typedef int pch_int_321;
+int pch_function_321(pch_int_321 a, int b);
+#define PCH_VALUE_322 (322 * 2 + 1)
+#define PCH_ADD_322(a, b) ((a) + (b) + 322)
+typedef int pch_int_322;
+int pch_function_322(pch_int_322 a, int b);
+#define PCH_VALUE_323 (323 * 2 + 1)
+#define PCH_ADD_323(a, b) ((a) + (b) + 323)
+typedef int pch_int_323;
+int pch_function_323(pch_int_323 a, int b);
+#define PCH_VALUE_324 (324 * 2 + 1)
+#define PCH_ADD_324(a, b) ((a) + (b) + 324)
+typedef int pch_int_324;
+int pch_function_324(pch_int_324 a, int b);
+#define PCH_VALUE_325 (325 * 2 + 1)
+#define PCH_ADD_325(a, b) ((a) + (b) + 325)
+typedef int pch_int_325;
+int pch_function_325(pch_int_325 a, int b);
+#define PCH_VALUE_326 (326 * 2 + 1)
+#define PCH_ADD_326(a, b) ((a) + (b) + 326)
+typedef int pch_int_326;
+int pch_function_326(pch_int_326 a, int b);
+#define PCH_VALUE_327 (327 * 2 + 1)
+#define PCH_ADD_327(a, b) ((a) + (b) + 327)
+typedef int pch_int_327;
+int pch_function_327(pch_int_327 a, int b);
+#define PCH_VALUE_328 (328 * 2 + 1)
+#define PCH_ADD_328(a, b) ((a) + (b) + 328)
+typedef int pch_int_328;
+int pch_function_328(pch_int_328 a, int b);
+#define PCH_VALUE_329 (329 * 2 + 1)
+#define PCH_ADD_329(a, b) ((a) + (b) + 329)
+typedef int pch_int_329;
+int pch_function_329(pch_int_329 a, int b);
+#define PCH_VALUE_330 (330 * 2 + 1)
+#define PCH_ADD_330(a, b) ((a) + (b) + 330)
+typedef int pch_int_330;
+int pch_function_330(pch_int_330 a, int b);
+#define PCH_VALUE_331 (331 * 2 + 1)
+#define PCH_ADD_331(a, b) ((a) + (b) + 331)
+typedef int pch_int_331;
+int pch_function_331(pch_int_331 a, int b);
+#define PCH_VALUE_332 (332 * 2 + 1)
+#define PCH_ADD_332(a, b) ((a) + (b) + 332)
+typedef int pch_int_332;
+int pch_function_332(pch_int_332 a, int b);
+#define PCH_VALUE_333 (333 * 2 + 1)
+#define PCH_ADD_333(a, b) ((a) + (b) + 333)
+typedef int pch_int_333;
+int pch_function_333(pch_int_333 a, int b);
+#define PCH_VALUE_334 (334 * 2 + 1)
+#define PCH_ADD_334(a, b) ((a) + (b) + 334)
+typedef int pch_int_334;
+int pch_function_334(pch_int_334 a, int b);
+#define PCH_VALUE_335 (335 * 2 + 1)
+#define PCH_ADD_335(a, b) ((a) + (b) + 335)
+typedef int pch_int_335;
+int pch_function_335(pch_int_335 a, int b);
+#define PCH_VALUE_336 (336 * 2 + 1)
+#define PCH_ADD_336(a, b) ((a) + (b) + 336)
+typedef int pch_int_336;
+int pch_function_336(pch_int_336 a, int b);
+#define PCH_VALUE_337 (337 * 2 + 1)
+#define PCH_ADD_337(a, b) ((a) + (b) + 337)
+typedef int pch_int_337;
+int pch_function_337(pch_int_337 a, int b);
+#define PCH_VALUE_338 (338 * 2 + 1)
+#define PCH_ADD_338(a, b) ((a) + (b) + 338)
+typedef int pch_int_338;
+int pch_function_338(pch_int_338 a, int b);
+#define PCH_VALUE_339 (339 * 2 + 1)
+#define PCH_ADD_339(a, b) ((a) + (b) + 339)
+typedef int pch_int_339;
+int pch_function_339(pch_int_339 a, int b);
+#define PCH_VALUE_340 (340 * 2 + 1)
+#define PCH_ADD_340(a, b) ((a) + (b) + 340)
+typedef int pch_int_340;
+int pch_function_340(pch_int_340 a, int b);
+#define PCH_VALUE_341 (341 * 2 + 1)
+#define PCH_ADD_341(a, b) ((a) + (b) + 341)
+typedef int pch_int_341;
+int pch_function_341(pch_int_341 a, int b);
+#define PCH_VALUE_342 (342 * 2 + 1)
+#define PCH_ADD_342(a, b) ((a) + (b) + 342)
+typedef int pch_int_342;
+int pch_function_342(pch_int_342 a, int b);
+#define PCH_VALUE_343 (343 * 2 + 1)
+#define PCH_ADD_343(a, b) ((a) + (b) + 343)
+typedef int pch_int_343;
+int pch_function_343(pch_int_343 a, int b);
+#define PCH_VALUE_344 (344 * 2 + 1)
+#define PCH_ADD_344(a, b) ((a) + (b) + 344)
+typedef int pch_int_344;
+int pch_function_344(pch_int_344 a, int b);
+#define PCH_VALUE_345 (345 * 2 + 1)
+#define PCH_ADD_345(a, b) ((a) + (b) + 345)
+typedef int pch_int_345;
+int pch_function_345(pch_int_345 a, int b);
+#define PCH_VALUE_346 (346 * 2 + 1)
+#define PCH_ADD_346(a, b) ((a) + (b) + 346)
+typedef int pch_int_346;
+int pch_function_346(pch_int_346 a, int b);
+#define PCH_VALUE_347 (347 * 2 + 1)
+#define PCH_ADD_347(a, b) ((a) + (b) + 347)
+typedef int pch_int_347;
+int pch_function_347(pch_int_347 a, int b);
+#define PCH_VALUE_348 (348 * 2 + 1)
+#define PCH_ADD_348(a, b) ((a) + (b) + 348)
+typedef int pch_int_348;
+int pch_function_348(pch_int_348 a, int b);
+#define PCH_VALUE_349 (349 * 2 + 1)
+#define PCH_ADD_349(a, b) ((a) + (b) + 349)
+typedef int pch_int_349;
+int pch_function_349(pch_int_349 a, int b);
+#define PCH_VALUE_350 (350 * 2 + 1)
+#define PCH_ADD_350(a, b) ((a) + (b) + 350)
+typedef int pch_int_350;
+int pch_function_350(pch_int_350 a, int b);
+#define PCH_VALUE_351 (351 * 2 + 1)
+#define PCH_ADD_351(a, b) ((a) + (b) + 351)
+typedef int pch_int_351;
+int pch_function_351(pch_int_351 a, int b);
+#define PCH_VALUE_352 (352 * 2 + 1)
+#define PCH_ADD_352(a, b) ((a) + (b) + 352)
+typedef int pch_int_352;
+int pch_function_352(pch_int_352 a, int b);
+#define PCH_VALUE_353 (353 * 2 + 1)
+#define PCH_ADD_353(a, b) ((a) + (b) + 353)
+typedef int pch_int_353;
+int pch_function_353(pch_int_353 a, int b);
+#define PCH_VALUE_354 (354 * 2 + 1)
+#define PCH_ADD_354(a, b) ((a) + (b) + 354)
+typedef int pch_int_354;
+int pch_function_354(pch_int_354 a, int b);
+#define PCH_VALUE_355 (355 * 2 + 1)
+#define PCH_ADD_355(a, b) ((a) + (b) + 355)
+typedef int pch_int_355;
+int pch_function_355(pch_int_355 a, int b);
+#define PCH_VALUE_356 (356 * 2 + 1)
+#define PCH_ADD_356(a, b) ((a) + (b) + 356)
+typedef int pch_int_356;
+int pch_function_356(pch_int_356 a, int b);
+#define PCH_VALUE_357 (357 * 2 + 1)
+#define PCH_ADD_357(a, b) ((a) + (b) + 357)
+typedef int pch_int_357;
+int pch_function_357(pch_int_357 a, int b);
+#define PCH_VALUE_358 (358 * 2 + 1)
+#define PCH_ADD_358(a, b) ((a) + (b) + 358)
+typedef int pch_int_358;
+int pch_function_358(pch_int_358 a, int b);
+#define PCH_VALUE_359 (359 * 2 + 1)
+#define PCH_ADD_359(a, b) ((a) + (b) + 359)
+typedef int pch_int_359;
+int pch_function_359(pch_int_359 a, int b);
+#define PCH_VALUE_360 (360 * 2 + 1)
+#define PCH_ADD_360(a, b) ((a) + (b) + 360)
+typedef int pch_int_360;
+int pch_function_360(pch_int_360 a, int b);
+#define PCH_VALUE_361 (361 * 2 + 1)
+#define PCH_ADD_361(a, b) ((a) + (b) + 361)
+typedef int pch_int_361;
+int pch_function_361(pch_int_361 a, int b);
+#define PCH_VALUE_362 (362 * 2 + 1)
+#define PCH_ADD_362(a, b) ((a) + (b) + 362)
+typedef int pch_int_362;
+int pch_function_362(pch_int_362 a, int b);
+#define PCH_VALUE_363 (363 * 2 + 1)
+#define PCH_ADD_363(a, b) ((a) + (b) + 363)
+typedef int pch_int_363;
+int pch_function_363(pch_int_363 a, int b);
+#define PCH_VALUE_364 (364 * 2 + 1)
+#define PCH_ADD_364(a, b) ((a) + (b) + 364)
+typedef int pch_int_364;
+int pch_function_364(pch_int_364 a, int b);
+#define PCH_VALUE_365 (365 * 2 + 1)
+#define PCH_ADD_365(a, b) ((a) + (b) + 365)
+typedef int pch_int_365;
+int pch_function_365(pch_int_365 a, int b);
+#define PCH_VALUE_366 (366 * 2 + 1)
+#define PCH_ADD_366(a, b) ((a) + (b) + 366)
+typedef int pch_int_366;
+int pch_function_366(pch_int_366 a, int b);
+#define PCH_VALUE_367 (367 * 2 + 1)
+#define PCH_ADD_367(a, b) ((a) + (b) + 367)
+typedef int pch_int_367;
+int pch_function_367(pch_int_367 a, int b);
+#define PCH_VALUE_368 (368 * 2 + 1)
+#define PCH_ADD_368(a, b) ((a) + (b) + 368)
+typedef int pch_int_368;
+int pch_function_368(pch_int_368 a, int b);
+#define PCH_VALUE_369 (369 * 2 + 1)
+#define PCH_ADD_369(a, b) ((a) + (b) + 369)
+typedef int pch_int_369;
+int pch_function_369(pch_int_369 a, int b);
+#define PCH_VALUE_370 (370 * 2 + 1)
+#define PCH_ADD_370(a, b) ((a) + (b) + 370)
+typedef int pch_int_370;
+int pch_function_370(pch_int_370 a, int b);
+#define PCH_VALUE_371 (371 * 2 + 1)
+#define PCH_ADD_371(a, b) ((a) + (b) + 371)
+typedef int pch_int_371;
+int pch_function_371(pch_int_371 a, int b);
+#define PCH_VALUE_372 (372 * 2 + 1)
+#define PCH_ADD_372(a, b) ((a) + (b) + 372)
+typedef int pch_int_372;
+int pch_function_372(pch_int_372 a, int b);
+#define PCH_VALUE_373 (373 * 2 + 1)
+#define PCH_ADD_373(a, b) ((a) + (b) + 373)
+typedef int pch_int_373;
+int pch_function_373(pch_int_373 a, int b);
+#define PCH_VALUE_374 (374 * 2 + 1)
+#define PCH_ADD_374(a, b) ((a) + (b) + 374)
+typedef int pch_int_374;
+int pch_function_374(pch_int_374 a, int b);
+#define PCH_VALUE_375 (375 * 2 + 1)
+#define PCH_ADD_375(a, b) ((a) + (b) + 375)
+typedef int pch_int_375;
+int pch_function_375(pch_int_375 a, int b);
+#define PCH_VALUE_376 (376 * 2 + 1)
+#define PCH_ADD_376(a, b) ((a) + (b) + 376)
+typedef int pch_int_376;
+int pch_function_376(pch_int_376 a, int b);
+#define PCH_VALUE_377 (377 * 2 + 1)
+#define PCH_ADD_377(a, b) ((a) + (b) + 377)
+typedef int pch_int_377;
+int pch_function_377(pch_int_377 a, int b);
+#define PCH_VALUE_378 (378 * 2 + 1)
+#define PCH_ADD_378(a, b) ((a) + (b) + 378)
+typedef int pch_int_378;
+int pch_function_378(pch_int_378 a, int b);
+#define PCH_VALUE_379 (379 * 2 + 1)
+#define PCH_ADD_379(a, b) ((a) + (b) + 379)
+typedef int pch_int_379;
+int pch_function_379(pch_int_379 a, int b);
+#define PCH_VALUE_380 (380 * 2 + 1)
+#define PCH_ADD_380(a, b) ((a) + (b) + 380)
+typedef int pch_int_380;
+int pch_function_380(pch_int_380 a, int b);
+#define PCH_VALUE_381 (381 * 2 + 1)
+#define PCH_ADD_381(a, b) ((a) + (b) + 381)
+typedef int pch_int_381;
+int pch_function_381(pch_int_381 a, int b);
+#define PCH_VALUE_382 (382 * 2 + 1)
+#define PCH_ADD_382(a, b) ((a) + (b) + 382)
+typedef int pch_int_382;
+int pch_function_382(pch_int_382 a, int b);
+#define PCH_VALUE_383 (383 * 2 + 1)
+#define PCH_ADD_383(a, b) ((a) + (b) + 383)
+typedef int pch_int_383;
+int pch_function_383(pch_int_383 a, int b);
+#define PCH_VALUE_384 (384 * 2 + 1)
+#define PCH_ADD_384(a, b) ((a) + (b) + 384)
+typedef int pch_int_384;
+int pch_function_384(pch_int_384 a, int b);
+#define PCH_VALUE_385 (385 * 2 + 1)
+#define PCH_ADD_385(a, b) ((a) + (b) + 385)
+typedef int pch_int_385;
+int pch_function_385(pch_int_385 a, int b);
+#define PCH_VALUE_386 (386 * 2 + 1)
+#define PCH_ADD_386(a, b) ((a) + (b) + 386)
+typedef int pch_int_386;
+int pch_function_386(pch_int_386 a, int b);
+#define PCH_VALUE_387 (387 * 2 + 1)
+#define PCH_ADD_387(a, b) ((a) + (b) + 387)
+typedef int pch_int_387;
+int pch_function_387(pch_int_387 a, int b);
+#define PCH_VALUE_388 (388 * 2 + 1)
+#define PCH_ADD_388(a, b) ((a) + (b) + 388)
+typedef int pch_int_388;
+int pch_function_388(pch_int_388 a, int b);
+#define PCH_VALUE_389 (389 * 2 + 1)
+#define PCH_ADD_389(a, b) ((a) + (b) + 389)
+typedef int pch_int_389;
+int pch_function_389(pch_int_389 a, int b);
+#define PCH_VALUE_390 (390 * 2 + 1)
+#define PCH_ADD_390(a, b) ((a) + (b) + 390)
+typedef int pch_int_390;
+int pch_function_390(pch_int_390 a, int b);
+#define PCH_VALUE_391 (391 * 2 + 1)
+#define PCH_ADD_391(a, b) ((a) + (b) + 391)
+typedef int pch_int_391;
+int pch_function_391(pch_int_391 a, int b);
+#define PCH_VALUE_392 (392 * 2 + 1)
+#define PCH_ADD_392(a, b) ((a) + (b) + 392)
+typedef int pch_int_392;
+int pch_function_392(pch_int_392 a, int b);
+#define PCH_VALUE_393 (393 * 2 + 1)
+#define PCH_ADD_393(a, b) ((a) + (b) + 393)
+typedef int pch_int_393;
+int pch_function_393(pch_int_393 a, int b);
+#define PCH_VALUE_394 (394 * 2 + 1)
+#define PCH_ADD_394(a, b) ((a) + (b) + 394)
+typedef int pch_int_394;
+int pch_function_394(pch_int_394 a, int b);
+#define PCH_VALUE_395 (395 * 2 + 1)
+#define PCH_ADD_395(a, b) ((a) + (b) + 395)
+typedef int pch_int_395;
+int pch_function_395(pch_int_395 a, int b);
+#define PCH_VALUE_396 (396 * 2 + 1)
+#define PCH_ADD_396(a, b) ((a) + (b) + 396)
+typedef int pch_int_396;
+int pch_function_396(pch_int_396 a, int b);
+#define PCH_VALUE_397 (397 * 2 + 1)
+#define PCH_ADD_397(a, b) ((a) + (b) + 397)
+typedef int pch_int_397;
+int pch_function_397(pch_int_397 a, int b);
+#define PCH_VALUE_398 (398 * 2 + 1)
+#define PCH_ADD_398(a, b) ((a) + (b) + 398)
+typedef int pch_int_398;
+int pch_function_398(pch_int_398 a, int b);
+#define PCH_VALUE_399 (399 * 2 + 1)
+#define PCH_ADD_399(a, b) ((a) + (b) + 399)
+typedef int pch_int_399;
+int pch_function_399(pch_int_399 a, int b);
+#define PCH_VALUE_400 (400 * 2 + 1)
+#define PCH_ADD_400(a, b) ((a) + (b) + 400)
+typedef int pch_int_400;
+int pch_function_400(pch_int_400 a, int b);
+#define PCH_VALUE_401 (401 * 2 + 1)
+#define PCH_ADD_401(a, b) ((a) + (b) + 401)
+typedef int pch_int_401;
+int pch_function_401(pch_int_401 a, int b);
+#define PCH_VALUE_402 (402 * 2 + 1)
+#define PCH_ADD_402(a, b) ((a) + (b) + 402)
+typedef int pch_int_402;
+int pch_function_402(pch_int_402 a, int b);
+#define PCH_VALUE_403 (403 * 2 + 1)
+#define PCH_ADD_403(a, b) ((a) + (b) + 403)
+typedef int pch_int_403;
+int pch_function_403(pch_int_403 a, int b);
+#define PCH_VALUE_404 (404 * 2 + 1)
+#define PCH_ADD_404(a, b) ((a) + (b) + 404)
+typedef int pch_int_404;
+int pch_function_404(pch_int_404 a, int b);
+#define PCH_VALUE_405 (405 * 2 + 1)
+#define PCH_ADD_405(a, b) ((a) + (b) + 405)
+typedef int pch_int_405;
+int pch_function_405(pch_int_405 a, int b);
+#define PCH_VALUE_406 (406 * 2 + 1)
+#define PCH_ADD_406(a, b) ((a) + (b) + 406)
+typedef int pch_int_406;
+int pch_function_406(pch_int_406 a, int b);
+#define PCH_VALUE_407 (407 * 2 + 1)
+#define PCH_ADD_407(a, b) ((a) + (b) + 407)
+typedef int pch_int_407;
+int pch_function_407(pch_int_407 a, int b);
+#define PCH_VALUE_408 (408 * 2 + 1)
+#define PCH_ADD_408(a, b) ((a) + (b) + 408)
+typedef int pch_int_408;
+int pch_function_408(pch_int_408 a, int b);
+#define PCH_VALUE_409 (409 * 2 + 1)
+#define PCH_ADD_409(a, b) ((a) + (b) + 409)
+typedef int pch_int_409;
+int pch_function_409(pch_int_409 a, int b);
+#define PCH_VALUE_410 (410 * 2 + 1)
+#define PCH_ADD_410(a, b) ((a) + (b) + 410)
+typedef int pch_int_410;
+int pch_function_410(pch_int_410 a, int b);
+#define PCH_VALUE_411 (411 * 2 + 1)
+#define PCH_ADD_411(a, b) ((a) + (b) + 411)
+typedef int pch_int_411;
+int pch_function_411(pch_int_411 a, int b);
+#define PCH_VALUE_412 (412 * 2 + 1)
+#define PCH_ADD_412(a, b) ((a) + (b) + 412)
+typedef int pch_int_412;
+int pch_function_412(pch_int_412 a, int b);
+#define PCH_VALUE_413 (413 * 2 + 1)
+#define PCH_ADD_413(a, b) ((a) + (b) + 413)
+typedef int pch_int_413;
+int pch_function_413(pch_int_413 a, int b);
+#define PCH_VALUE_414 (414 * 2 + 1)
+#define PCH_ADD_414(a, b) ((a) + (b) + 414)
+typedef int pch_int_414;
+int pch_function_414(pch_int_414 a, int b);
+#define PCH_VALUE_415 (415 * 2 + 1)
+#define PCH_ADD_415(a, b) ((a) + (b) + 415)
+typedef int pch_int_415;
+int pch_function_415(pch_int_415 a, int b);
+#define PCH_VALUE_416 (416 * 2 + 1)
+#define PCH_ADD_416(a, b) ((a) + (b) + 416)
+typedef int pch_int_416;
+int pch_function_416(pch_int_416 a, int b);
+#define PCH_VALUE_417 (417 * 2 + 1)
+#define PCH_ADD_417(a, b) ((a) + (b) + 417)
+typedef int pch_int_417;
+int pch_function_417(pch_int_417 a, int b);
+#define PCH_VALUE_418 (418 * 2 + 1)
+#define PCH_ADD_418(a, b) ((a) + (b) + 418)
+typedef int pch_int_418;
+int pch_function_418(pch_int_418 a, int b);
+#define PCH_VALUE_419 (419 * 2 + 1)
+#define PCH_ADD_419(a, b) ((a) + (b) + 419)
+typedef int pch_int_419;
+int pch_function_419(pch_int_419 a, int b);
+#define PCH_VALUE_420 (420 * 2 + 1)
+#define PCH_ADD_420(a, b) ((a) + (b) + 420)
+typedef int pch_int_420;
+int pch_function_420(pch_int_420 a, int b);
+#define PCH_VALUE_421 (421 * 2 + 1)
+#define PCH_ADD_421(a, b) ((a) + (b) + 421)
+typedef int pch_int_421;
+int pch_function_421(pch_int_421 a, int b);
+#define PCH_VALUE_422 (422 * 2 + 1)
+#define PCH_ADD_422(a, b) ((a) + (b) + 422)
+typedef int pch_int_422;
+int pch_function_422(pch_int_422 a, int b);
+#define PCH_VALUE_423 (423 * 2 + 1)
+#define PCH_ADD_423(a, b) ((a) + (b) + 423)
+typedef int pch_int_423;
+int pch_function_423(pch_int_423 a, int b);
+#define PCH_VALUE_424 (424 * 2 + 1)
+#define PCH_ADD_424(a, b) ((a) + (b) + 424)
+typedef int pch_int_424;
+int pch_function_424(pch_int_424 a, int b);
+#define PCH_VALUE_425 (425 * 2 + 1)
+#define PCH_ADD_425(a, b) ((a) + (b) + 425)
+typedef int pch_int_425;
+int pch_function_425(pch_int_425 a, int b);
+#define PCH_VALUE_426 (426 * 2 + 1)
+#define PCH_ADD_426(a, b) ((a) + (b) + 426)
+typedef int pch_int_426;
+int pch_function_426(pch_int_426 a, int b);
+#define PCH_VALUE_427 (427 * 2 + 1)
+#define PCH_ADD_427(a, b) ((a) + (b) + 427)
+typedef int pch_int_427;
+int pch_function_427(pch_int_427 a, int b);
+#define PCH_VALUE_428 (428 * 2 + 1)
+#define PCH_ADD_428(a, b) ((a) + (b) + 428)
+typedef int pch_int_428;
+int pch_function_428(pch_int_428 a, int b);
+#define PCH_VALUE_429 (429 * 2 + 1)
+#define PCH_ADD_429(a, b) ((a) + (b) + 429)
+typedef int pch_int_429;
+int pch_function_429(pch_int_429 a, int b);
+#define PCH_VALUE_430 (430 * 2 + 1)
+#define PCH_ADD_430(a, b) ((a) + (b) + 430)
+typedef int pch_int_430;
+int pch_function_430(pch_int_430 a, int b);
+#define PCH_VALUE_431 (431 * 2 + 1)
+#define PCH_ADD_431(a, b) ((a) + (b) + 431)
+typedef int pch_int_431;
+int pch_function_431(pch_int_431 a, int b);
+#define PCH_VALUE_432 (432 * 2 + 1)
+#define PCH_ADD_432(a, b) ((a) + (b) + 432)
+typedef int pch_int_432;
+int pch_function_432(pch_int_432 a, int b);
+#define PCH_VALUE_433 (433 * 2 + 1)
+#define PCH_ADD_433(a, b) ((a) + (b) + 433)
+typedef int pch_int_433;
+int pch_function_433(pch_int_433 a, int b);
+#define PCH_VALUE_434 (434 * 2 + 1)
+#define PCH_ADD_434(a, b) ((a) + (b) + 434)
+typedef int pch_int_434;
+int pch_function_434(pch_int_434 a, int b);
+#define PCH_VALUE_435 (435 * 2 + 1)
+#define PCH_ADD_435(a, b) ((a) + (b) + 435)
+typedef int pch_int_435;
+int pch_function_435(pch_int_435 a, int b);
+#define PCH_VALUE_436 (436 * 2 + 1)
+#define PCH_ADD_436(a, b) ((a) + (b) + 436)
+typedef int pch_int_436;
+int pch_function_436(pch_int_436 a, int b);
+#define PCH_VALUE_437 (437 * 2 + 1)
+#define PCH_ADD_437(a, b) ((a) + (b) + 437)
+typedef int pch_int_437;
+int pch_function_437(pch_int_437 a, int b);
+#define PCH_VALUE_438 (438 * 2 + 1)
+#define PCH_ADD_438(a, b) ((a) + (b) + 438)
+typedef int pch_int_438;
+int pch_function_438(pch_int_438 a, int b);
+#define PCH_VALUE_439 (439 * 2 + 1)
+#define PCH_ADD_439(a, b) ((a) + (b) + 439)
+typedef int pch_int_439;
+int pch_function_439(pch_int_439 a, int b);
+#define PCH_VALUE_440 (440 * 2 + 1)
+#define PCH_ADD_440(a, b) ((a) + (b) + 440)
+typedef int pch_int_440;
+int pch_function_440(pch_int_440 a, int b);
+#define PCH_VALUE_441 (441 * 2 + 1)
+#define PCH_ADD_441(a, b) ((a) + (b) + 441)
+typedef int pch_int_441;
+int pch_function_441(pch_int_441 a, int b);
+#define PCH_VALUE_442 (442 * 2 + 1)
+#define PCH_ADD_442(a, b) ((a) + (b) + 442)
+typedef int pch_int_442;
+int pch_function_442(pch_int_442 a, int b);
+#define PCH_VALUE_443 (443 * 2 + 1)
+#define PCH_ADD_443(a, b) ((a) + (b) + 443)
+typedef int pch_int_443;
+int pch_function_443(pch_int_443 a, int b);
+#define PCH_VALUE_444 (444 * 2 + 1)
+#define PCH_ADD_444(a, b) ((a) + (b) + 444)
+typedef int pch_int_444;
+int pch_function_444(pch_int_444 a, int b);
+#define PCH_VALUE_445 (445 * 2 + 1)
+#define PCH_ADD_445(a, b) ((a) + (b) + 445)
+typedef int pch_int_445;
+int pch_function_445(pch_int_445 a, int b);
+#define PCH_VALUE_446 (446 * 2 + 1)
+#define PCH_ADD_446(a, b) ((a) + (b) + 446)
+typedef int pch_int_446;
+int pch_function_446(pch_int_446 a, int b);
+#define PCH_VALUE_447 (447 * 2 + 1)
+#define PCH_ADD_447(a, b) ((a) + (b) + 447)
+typedef int pch_int_447;
+int pch_function_447(pch_int_447 a, int b);
+#define PCH_VALUE_448 (448 * 2 + 1)
+#define PCH_ADD_448(a, b) ((a) + (b) + 448)
+typedef int pch_int_448;
+int pch_function_448(pch_int_448 a, int b);
+#define PCH_VALUE_449 (449 * 2 + 1)
+#define PCH_ADD_449(a, b) ((a) + (b) + 449)
+typedef int pch_int_449;
+int pch_function_449(pch_int_449 a, int b);
+#define PCH_VALUE_450 (450 * 2 + 1)
+#define PCH_ADD_450(a, b) ((a) + (b) + 450)
+typedef int pch_int_450;
+int pch_function_450(pch_int_450 a, int b);
+#define PCH_VALUE_451 (451 * 2 + 1)
+#define PCH_ADD_451(a, b) ((a) + (b) + 451)
+typedef int pch_int_451;
+int pch_function_451(pch_int_451 a, int b);
+#define PCH_VALUE_452 (452 * 2 + 1)
+#define PCH_ADD_452(a, b) ((a) + (b) + 452)
+typedef int pch_int_452;
+int pch_function_452(pch_int_452 a, int b);
+#define PCH_VALUE_453 (453 * 2 + 1)
+#define PCH_ADD_453(a, b) ((a) + (b) + 453)
+typedef int pch_int_453;
+int pch_function_453(pch_int_453 a, int b);
+#define PCH_VALUE_454 (454 * 2 + 1)
+#define PCH_ADD_454(a, b) ((a) + (b) + 454)
+typedef int pch_int_454;
+int pch_function_454(pch_int_454 a, int b);
+#define PCH_VALUE_455 (455 * 2 + 1)
+#define PCH_ADD_455(a, b) ((a) + (b) + 455)
+typedef int pch_int_455;
+int pch_function_455(pch_int_455 a, int b);
+#define PCH_VALUE_456 (456 * 2 + 1)
+#define PCH_ADD_456(a, b) ((a) + (b) + 456)
+typedef int pch_int_456;
+int pch_function_456(pch_int_456 a, int b);
+#define PCH_VALUE_457 (457 * 2 + 1)
+#define PCH_ADD_457(a, b) ((a) + (b) + 457)
+typedef int pch_int_457;
+int pch_function_457(pch_int_457 a, int b);
+#define PCH_VALUE_458 (458 * 2 + 1)
+#define PCH_ADD_458(a, b) ((a) + (b) + 458)
+typedef int pch_int_458;
+int pch_function_458(pch_int_458 a, int b);
+#define PCH_VALUE_459 (459 * 2 + 1)
+#define PCH_ADD_459(a, b) ((a) + (b) + 459)
+typedef int pch_int_459;
+int pch_function_459(pch_int_459 a, int b);
+#define PCH_VALUE_460 (460 * 2 + 1)
+#define PCH_ADD_460(a, b) ((a) + (b) + 460)
+typedef int pch_int_460;
+int pch_function_460(pch_int_460 a, int b);
+#define PCH_VALUE_461 (461 * 2 + 1)
+#define PCH_ADD_461(a, b) ((a) + (b) + 461)
+typedef int pch_int_461;
+int pch_function_461(pch_int_461 a, int b);
+#define PCH_VALUE_462 (462 * 2 + 1)
+#define PCH_ADD_462(a, b) ((a) + (b) + 462)
+typedef int pch_int_462;
+int pch_function_462(pch_int_462 a, int b);
+#define PCH_VALUE_463 (463 * 2 + 1)
+#define PCH_ADD_463(a, b) ((a) + (b) + 463)
+typedef int pch_int_463;
+int pch_function_463(pch_int_463 a, int b);
+#define PCH_VALUE_464 (464 * 2 + 1)
+#define PCH_ADD_464(a, b) ((a) + (b) + 464)
+typedef int pch_int_464;
+int pch_function_464(pch_int_464 a, int b);
+#define PCH_VALUE_465 (465 * 2 + 1)
+#define PCH_ADD_465(a, b) ((a) + (b) + 465)
+typedef int pch_int_465;
+int pch_function_465(pch_int_465 a, int b);
+#define PCH_VALUE_466 (466 * 2 + 1)
+#define PCH_ADD_466(a, b) ((a) + (b) + 466)
+typedef int pch_int_466;
+int pch_function_466(pch_int_466 a, int b);
+#define PCH_VALUE_467 (467 * 2 + 1)
+#define PCH_ADD_467(a, b) ((a) + (b) + 467)
+typedef int pch_int_467;
+int pch_function_467(pch_int_467 a, int b);
+#define PCH_VALUE_468 (468 * 2 + 1)
+#define PCH_ADD_468(a, b) ((a) + (b) + 468)
+typedef int pch_int_468;
+int pch_function_468(pch_int_468 a, int b);
+#define PCH_VALUE_469 (469 * 2 + 1)
+#define PCH_ADD_469(a, b) ((a) + (b) + 469)
+typedef int pch_int_469;
+int pch_function_469(pch_int_469 a, int b);
+#define PCH_VALUE_470 (470 * 2 + 1)
+#define PCH_ADD_470(a, b) ((a) + (b) + 470)
+typedef int pch_int_470;
+int pch_function_470(pch_int_470 a, int b);
+#define PCH_VALUE_471 (471 * 2 + 1)
+#define PCH_ADD_471(a, b) ((a) + (b) + 471)
+typedef int pch_int_471;
+int pch_function_471(pch_int_471 a, int b);
+#define PCH_VALUE_472 (472 * 2 + 1)
+#define PCH_ADD_472(a, b) ((a) + (b) + 472)
+typedef int pch_int_472;
+int pch_function_472(pch_int_472 a, int b);
+#define PCH_VALUE_473 (473 * 2 + 1)
+#define PCH_ADD_473(a, b) ((a) + (b) + 473)
+typedef int pch_int_473;
+int pch_function_473(pch_int_473 a, int b);
+#define PCH_VALUE_474 (474 * 2 + 1)
+#define PCH_ADD_474(a, b) ((a) + (b) + 474)
+typedef int pch_int_474;
+int pch_function_474(pch_int_474 a, int b);
+#define PCH_VALUE_475 (475 * 2 + 1)
+#define PCH_ADD_475(a, b) ((a) + (b) + 475)
+typedef int pch_int_475;
+int pch_function_475(pch_int_475 a, int b);
+#define PCH_VALUE_476 (476 * 2 + 1)
+#define PCH_ADD_476(a, b) ((a) + (b) + 476)
+typedef int pch_int_476;
+int pch_function_476(pch_int_476 a, int b);
+#define PCH_VALUE_477 (477 * 2 + 1)
+#define PCH_ADD_477(a, b) ((a) + (b) + 477)
+typedef int pch_int_477;
+int pch_function_477(pch_int_477 a, int b);
+#define PCH_VALUE_478 (478 * 2 + 1)
+#define PCH_ADD_478(a, b) ((a) + (b) + 478)
+typedef int pch_int_478;
+int pch_function_478(pch_int_478 a, int b);
+#define PCH_VALUE_479 (479 * 2 + 1)
+#define PCH_ADD_479(a, b) ((a) + (b) + 479)
+typedef int pch_int_479;
+int pch_function_479(pch_int_479 a, int b);
+#define PCH_VALUE_480 (480 * 2 + 1)
+#define PCH_ADD_480(a, b) ((a) + (b) + 480)
+typedef int pch_int_480;
+int pch_function_480(pch_int_480 a, int b);
+#define PCH_VALUE_481 (481 * 2 + 1)
+#define PCH_ADD_481(a, b) ((a) + (b) + 481)
+typedef int pch_int_481;
+int pch_function_481(pch_int_481 a, int b);
+#define PCH_VALUE_482 (482 * 2 + 1)
+#define PCH_ADD_482(a, b) ((a) + (b) + 482)
+typedef int pch_int_482;
+int pch_function_482(pch_int_482 a, int b);
+#define PCH_VALUE_483 (483 * 2 + 1)
+#define PCH_ADD_483(a, b) ((a) + (b) + 483)
+typedef int pch_int_483;
+int pch_function_483(pch_int_483 a, int b);
+#define PCH_VALUE_484 (484 * 2 + 1)
+#define PCH_ADD_484(a, b) ((a) + (b) + 484)
+typedef int pch_int_484;
+int pch_function_484(pch_int_484 a, int b);
+#define PCH_VALUE_485 (485 * 2 + 1)
+#define PCH_ADD_485(a, b) ((a) + (b) + 485)
+typedef int pch_int_485;
+int pch_function_485(pch_int_485 a, int b);
+#define PCH_VALUE_486 (486 * 2 + 1)
+#define PCH_ADD_486(a, b) ((a) + (b) + 486)
+typedef int pch_int_486;
+int pch_function_486(pch_int_486 a, int b);
+#define PCH_VALUE_487 (487 * 2 + 1)
+#define PCH_ADD_487(a, b) ((a) + (b) + 487)
+typedef int pch_int_487;
+int pch_function_487(pch_int_487 a, int b);
+#define PCH_VALUE_488 (488 * 2 + 1)
+#define PCH_ADD_488(a, b) ((a) + (b) + 488)
+typedef int pch_int_488;
+int pch_function_488(pch_int_488 a, int b);
+#define PCH_VALUE_489 (489 * 2 + 1)
+#define PCH_ADD_489(a, b) ((a) + (b) + 489)
+typedef int pch_int_489;
+int pch_function_489(pch_int_489 a, int b);
+#define PCH_VALUE_490 (490 * 2 + 1)
+#define PCH_ADD_490(a, b) ((a) + (b) + 490)
+typedef int pch_int_490;
+int pch_function_490(pch_int_490 a, int b);
+#define PCH_VALUE_491 (491 * 2 + 1)
+#define PCH_ADD_491(a, b) ((a) + (b) + 491)
+typedef int pch_int_491;
+int pch_function_491(pch_int_491 a, int b);
+#define PCH_VALUE_492 (492 * 2 + 1)
+#define PCH_ADD_492(a, b) ((a) + (b) + 492)
+typedef int pch_int_492;
+int pch_function_492(pch_int_492 a, int b);
+#define PCH_VALUE_493 (493 * 2 + 1)
+#define PCH_ADD_493(a, b) ((a) + (b) + 493)
+typedef int pch_int_493;
+int pch_function_493(pch_int_493 a, int b);
+#define PCH_VALUE_494 (494 * 2 + 1)
+#define PCH_ADD_494(a, b) ((a) + (b) + 494)
+typedef int pch_int_494;
+int pch_function_494(pch_int_494 a, int b);
+#define PCH_VALUE_495 (495 * 2 + 1)
+#define PCH_ADD_495(a, b) ((a) + (b) + 495)
+typedef int pch_int_495;
+int pch_function_495(pch_int_495 a, int b);
+#define PCH_VALUE_496 (496 * 2 + 1)
+#define PCH_ADD_496(a, b) ((a) + (b) + 496)
+typedef int pch_int_496;
+int pch_function_496(pch_int_496 a, int b);
+#define PCH_VALUE_497 (497 * 2 + 1)
+#define PCH_ADD_497(a, b) ((a) + (b) + 497)
+typedef int pch_int_497;
+int pch_function_497(pch_int_497 a, int b);
+#define PCH_VALUE_498 (498 * 2 + 1)
+#define PCH_ADD_498(a, b) ((a) + (b) + 498)
+typedef int pch_int_498;
+int pch_function_498(pch_int_498 a, int b);
+#define PCH_VALUE_499 (499 * 2 + 1)
+#define PCH_ADD_499(a, b) ((a) + (b) + 499)
+typedef int pch_int_499;
+int pch_function_499(pch_int_499 a, int b);
+#define PCH_VALUE_500 (500 * 2 + 1)
+#define PCH_ADD_500(a, b) ((a) + (b) + 500)
+typedef int pch_int_500;
+int pch_function_500(pch_int_500 a, int b);
+#define PCH_VALUE_501 (501 * 2 + 1)
+#define PCH_ADD_501(a, b) ((a) + (b) + 501)
+typedef int pch_int_501;
+int pch_function_501(pch_int_501 a, int b);
+#define PCH_VALUE_502 (502 * 2 + 1)
+#define PCH_ADD_502(a, b) ((a) + (b) + 502)
+typedef int pch_int_502;
+int pch_function_502(pch_int_502 a, int b);
+#define PCH_VALUE_503 (503 * 2 + 1)
+#define PCH_ADD_503(a, b) ((a) + (b) + 503)
+typedef int pch_int_503;
+int pch_function_503(pch_int_503 a, int b);
+#define PCH_VALUE_504 (504 * 2 + 1)
+#define PCH_ADD_504(a, b) ((a) + (b) + 504)
+typedef int pch_int_504;
+int pch_function_504(pch_int_504 a, int b);
+#define PCH_VALUE_505 (505 * 2 + 1)
+#define PCH_ADD_505(a, b) ((a) + (b) + 505)
+typedef int pch_int_505;
+int pch_function_505(pch_int_505 a, int b);
+#define PCH_VALUE_506 (506 * 2 + 1)
+#define PCH_ADD_506(a, b) ((a) + (b) + 506)
+typedef int pch_int_506;
+int pch_function_506(pch_int_506 a, int b);
+#define PCH_VALUE_507 (507 * 2 + 1)
+#define PCH_ADD_507(a, b) ((a) + (b) + 507)
+typedef int pch_int_507;
+int pch_function_507(pch_int_507 a, int b);
+#define PCH_VALUE_508 (508 * 2 + 1)
+#define PCH_ADD_508(a, b) ((a) + (b) + 508)
+typedef int pch_int_508;
+int pch_function_508(pch_int_508 a, int b);
+#define PCH_VALUE_509 (509 * 2 + 1)
+#define PCH_ADD_509(a, b) ((a) + (b) + 509)
+typedef int pch_int_509;
+int pch_function_509(pch_int_509 a, int b);
+#define PCH_VALUE_510 (510 * 2 + 1)
+#define PCH_ADD_510(a, b) ((a) + (b) + 510)
+typedef int pch_int_510;
+int pch_function_510(pch_int_510 a, int b);
+#define PCH_VALUE_511 (511 * 2 + 1)
+#define PCH_ADD_511(a, b) ((a) + (b) + 511)
+typedef int pch_int_511;
+int pch_function_511(pch_int_511 a, int b);
+#define PCH_VALUE_512 (512 * 2 + 1)
+#define PCH_ADD_512(a, b) ((a) + (b) + 512)
+typedef int pch_int_512;
+int pch_function_512(pch_int_512 a, int b);
+#define PCH_VALUE_513 (513 * 2 + 1)
+#define PCH_ADD_513(a, b) ((a) + (b) + 513)
+typedef int pch_int_513;
+int pch_function_513(pch_int_513 a, int b);
+#define PCH_VALUE_514 (514 * 2 + 1)
+#define PCH_ADD_514(a, b) ((a) + (b) + 514)
+typedef int pch_int_514;
+int pch_function_514(pch_int_514 a, int b);
+#define PCH_VALUE_515 (515 * 2 + 1)
+#define PCH_ADD_515(a, b) ((a) + (b) + 515)
+typedef int pch_int_515;
+int pch_function_515(pch_int_515 a, int b);
+#define PCH_VALUE_516 (516 * 2 + 1)
+#define PCH_ADD_516(a, b) ((a) + (b) + 516)
+typedef int pch_int_516;
+int pch_function_516(pch_int_516 a, int b);
+#define PCH_VALUE_517 (517 * 2 + 1)
+#define PCH_ADD_517(a, b) ((a) + (b) + 517)
+typedef int pch_int_517;
+int pch_function_517(pch_int_517 a, int b);
+#define PCH_VALUE_518 (518 * 2 + 1)
+#define PCH_ADD_518(a, b) ((a) + (b) + 518)
+typedef int pch_int_518;
+int pch_function_518(pch_int_518 a, int b);
+#define PCH_VALUE_519 (519 * 2 + 1)
+#define PCH_ADD_519(a, b) ((a) + (b) + 519)
+typedef int pch_int_519;
+int pch_function_519(pch_int_519 a, int b);
+#define PCH_VALUE_520 (520 * 2 + 1)
+#define PCH_ADD_520(a, b) ((a) + (b) + 520)
+typedef int pch_int_520;
+int pch_function_520(pch_int_520 a, int b);
+#define PCH_VALUE_521 (521 * 2 + 1)
+#define PCH_ADD_521(a, b) ((a) + (b) + 521)
+typedef int pch_int_521;
+int pch_function_521(pch_int_521 a, int b);
+#define PCH_VALUE_522 (522 * 2 + 1)
+#define PCH_ADD_522(a, b) ((a) + (b) + 522)
+typedef int pch_int_522;
+int pch_function_522(pch_int_522 a, int b);
+#define PCH_VALUE_523 (523 * 2 + 1)
+#define PCH_ADD_523(a, b) ((a) + (b) + 523)
+typedef int pch_int_523;
+int pch_function_523(pch_int_523 a, int b);
+#define PCH_VALUE_524 (524 * 2 + 1)
+#define PCH_ADD_524(a, b) ((a) + (b) + 524)
+typedef int pch_int_524;
+int pch_function_524(pch_int_524 a, int b);
+#define PCH_VALUE_525 (525 * 2 + 1)
+#define PCH_ADD_525(a, b) ((a) + (b) + 525)
+typedef int pch_int_525;
+int pch_function_525(pch_int_525 a, int b);
+#define PCH_VALUE_526 (526 * 2 + 1)
+#define PCH_ADD_526(a, b) ((a) + (b) + 526)
+typedef int pch_int_526;
+int pch_function_526(pch_int_526 a, int b);
+#define PCH_VALUE_527 (527 * 2 + 1)
+#define PCH_ADD_527(a, b) ((a) + (b) + 527)
+typedef int pch_int_527;
+int pch_function_527(pch_int_527 a, int b);
+#define PCH_VALUE_528 (528 * 2 + 1)
+#define PCH_ADD_528(a, b) ((a) + (b) + 528)
+typedef int pch_int_528;
+int pch_function_528(pch_int_528 a, int b);
+#define PCH_VALUE_529 (529 * 2 + 1)
+#define PCH_ADD_529(a, b) ((a) + (b) + 529)
+typedef int pch_int_529;
+int pch_function_529(pch_int_529 a, int b);
+#define PCH_VALUE_530 (530 * 2 + 1)
+#define PCH_ADD_530(a, b) ((a) + (b) + 530)
+typedef int pch_int_530;
+int pch_function_530(pch_int_530 a, int b);
+#define PCH_VALUE_531 (531 * 2 + 1)
+#define PCH_ADD_531(a, b) ((a) + (b) + 531)
+typedef int pch_int_531;
+int pch_function_531(pch_int_531 a, int b);
+#define PCH_VALUE_532 (532 * 2 + 1)
+#define PCH_ADD_532(a, b) ((a) + (b) + 532)
+typedef int pch_int_532;
+int pch_function_532(pch_int_532 a, int b);
+#define PCH_VALUE_533 (533 * 2 + 1)
+#define PCH_ADD_533(a, b) ((a) + (b) + 533)
+typedef int pch_int_533;
+int pch_function_533(pch_int_533 a, int b);
+#define PCH_VALUE_534 (534 * 2 + 1)
+#define PCH_ADD_534(a, b) ((a) + (b) + 534)
+typedef int pch_int_534;
+int pch_function_534(pch_int_534 a, int b);
+#define PCH_VALUE_535 (535 * 2 + 1)
+#define PCH_ADD_535(a, b) ((a) + (b) + 535)
+typedef int pch_int_535;
+int pch_function_535(pch_int_535 a, int b);
+#define PCH_VALUE_536 (536 * 2 + 1)
+#define PCH_ADD_536(a, b) ((a) + (b) + 536)
+typedef int pch_int_536;
+int pch_function_536(pch_int_536 a, int b);
+#define PCH_VALUE_537 (537 * 2 + 1)
+#define PCH_ADD_537(a, b) ((a) + (b) + 537)
+typedef int pch_int_537;
+int pch_function_537(pch_int_537 a, int b);
+#define PCH_VALUE_538 (538 * 2 + 1)
+#define PCH_ADD_538(a, b) ((a) + (b) + 538)
+typedef int pch_int_538;
+int pch_function_538(pch_int_538 a, int b);
+#define PCH_VALUE_539 (539 * 2 + 1)
+#define PCH_ADD_539(a, b) ((a) + (b) + 539)
+typedef int pch_int_539;
+int pch_function_539(pch_int_539 a, int b);
+#define PCH_VALUE_540 (540 * 2 + 1)
+#define PCH_ADD_540(a, b) ((a) + (b) + 540)
+typedef int pch_int_540;
+int pch_function_540(pch_int_540 a, int b);
+#define PCH_VALUE_541 (541 * 2 + 1)
+#define PCH_ADD_541(a, b) ((a) + (b) + 541)
+typedef int pch_int_541;
+int pch_function_541(pch_int_541 a, int b);
+#define PCH_VALUE_542 (542 * 2 + 1)
+#define PCH_ADD_542(a, b) ((a) + (b) + 542)
+typedef int pch_int_542;
+int pch_function_542(pch_int_542 a, int b);
+#define PCH_VALUE_543 (543 * 2 + 1)
+#define PCH_ADD_543(a, b) ((a) + (b) + 543)
+typedef int pch_int_543;
+int pch_function_543(pch_int_543 a, int b);
+#define PCH_VALUE_544 (544 * 2 + 1)
+#define PCH_ADD_544(a, b) ((a) + (b) + 544)
+typedef int pch_int_544;
+int pch_function_544(pch_int_544 a, int b);
+#define PCH_VALUE_545 (545 * 2 + 1)
+#define PCH_ADD_545(a, b) ((a) + (b) + 545)
+typedef int pch_int_545;
+int pch_function_545(pch_int_545 a, int b);
+#define PCH_VALUE_546 (546 * 2 + 1)
+#define PCH_ADD_546(a, b) ((a) + (b) + 546)
+typedef int pch_int_546;
+int pch_function_546(pch_int_546 a, int b);
+#define PCH_VALUE_547 (547 * 2 + 1)
+#define PCH_ADD_547(a, b) ((a) + (b) + 547)
+typedef int pch_int_547;
+int pch_function_547(pch_int_547 a, int b);
+#define PCH_VALUE_548 (548 * 2 + 1)
+#define PCH_ADD_548(a, b) ((a) + (b) + 548)
+typedef int pch_int_548;
+int pch_function_548(pch_int_548 a, int b);
+#define PCH_VALUE_549 (549 * 2 + 1)
+#define PCH_ADD_549(a, b) ((a) + (b) + 549)
+typedef int pch_int_549;
+int pch_function_549(pch_int_549 a, int b);
+#define PCH_VALUE_550 (550 * 2 + 1)
+#define PCH_ADD_550(a, b) ((a) + (b) + 550)
+typedef int pch_int_550;
+int pch_function_550(pch_int_550 a, int b);
+#define PCH_VALUE_551 (551 * 2 + 1)
+#define PCH_ADD_551(a, b) ((a) + (b) + 551)
+typedef int pch_int_551;
+int pch_function_551(pch_int_551 a, int b);
+#define PCH_VALUE_552 (552 * 2 + 1)
+#define PCH_ADD_552(a, b) ((a) + (b) + 552)
+typedef int pch_int_552;
+int pch_function_552(pch_int_552 a, int b);
+#define PCH_VALUE_553 (553 * 2 + 1)
+#define PCH_ADD_553(a, b) ((a) + (b) + 553)
+typedef int pch_int_553;
+int pch_function_553(pch_int_553 a, int b);
+#define PCH_VALUE_554 (554 * 2 + 1)
+#define PCH_ADD_554(a, b) ((a) + (b) + 554)
+typedef int pch_int_554;
+int pch_function_554(pch_int_554 a, int b);
+#define PCH_VALUE_555 (555 * 2 + 1)
+#define PCH_ADD_555(a, b) ((a) + (b) + 555)
+typedef int pch_int_555;
+int pch_function_555(pch_int_555 a, int b);
+#define PCH_VALUE_556 (556 * 2 + 1)
+#define PCH_ADD_556(a, b) ((a) + (b) + 556)
+typedef int pch_int_556;
+int pch_function_556(pch_int_556 a, int b);
+#define PCH_VALUE_557 (557 * 2 + 1)
+#define PCH_ADD_557(a, b) ((a) + (b) + 557)
+typedef int pch_int_557;
+int pch_function_557(pch_int_557 a, int b);
+#define PCH_VALUE_558 (558 * 2 + 1)
+#define PCH_ADD_558(a, b) ((a) + (b) + 558)
+typedef int pch_int_558;
+int pch_function_558(pch_int_558 a, int b);
+#define PCH_VALUE_559 (559 * 2 + 1)
+#define PCH_ADD_559(a, b) ((a) + (b) + 559)
+typedef int pch_int_559;
+int pch_function_559(pch_int_559 a, int b);
+#define PCH_VALUE_560 (560 * 2 + 1)
+#define PCH_ADD_560(a, b) ((a) + (b) + 560)
+typedef int pch_int_560;
+int pch_function_560(pch_int_560 a, int b);
+#define PCH_VALUE_561 (561 * 2 + 1)
+#define PCH_ADD_561(a, b) ((a) + (b) + 561)
+typedef int pch_int_561;
+int pch_function_561(pch_int_561 a, int b);
+#define PCH_VALUE_562 (562 * 2 + 1)
+#define PCH_ADD_562(a, b) ((a) + (b) + 562)
+typedef int pch_int_562;
+int pch_function_562(pch_int_562 a, int b);
+#define PCH_VALUE_563 (563 * 2 + 1)
+#define PCH_ADD_563(a, b) ((a) + (b) + 563)
+typedef int pch_int_563;
+int pch_function_563(pch_int_563 a, int b);
+#define PCH_VALUE_564 (564 * 2 + 1)
+#define PCH_ADD_564(a, b) ((a) + (b) + 564)
+typedef int pch_int_564;
+int pch_function_564(pch_int_564 a, int b);
+#define PCH_VALUE_565 (565 * 2 + 1)
+#define PCH_ADD_565(a, b) ((a) + (b) + 565)
+typedef int pch_int_565;
+int pch_function_565(pch_int_565 a, int b);
+#define PCH_VALUE_566 (566 * 2 + 1)
+#define PCH_ADD_566(a, b) ((a) + (b) + 566)
+typedef int pch_int_566;
+int pch_function_566(pch_int_566 a, int b);
+#define PCH_VALUE_567 (567 * 2 + 1)
+#define PCH_ADD_567(a, b) ((a) + (b) + 567)
+typedef int pch_int_567;
+int pch_function_567(pch_int_567 a, int b);
+#define PCH_VALUE_568 (568 * 2 + 1)
+#define PCH_ADD_568(a, b) ((a) + (b) + 568)
+typedef int pch_int_568;
+int pch_function_568(pch_int_568 a, int b);
+#define PCH_VALUE_569 (569 * 2 + 1)
+#define PCH_ADD_569(a, b) ((a) + (b) + 569)
+typedef int pch_int_569;
+int pch_function_569(pch_int_569 a, int b);
+#define PCH_VALUE_570 (570 * 2 + 1)
+#define PCH_ADD_570(a, b) ((a) + (b) + 570)
+typedef int pch_int_570;
+int pch_function_570(pch_int_570 a, int b);
+#define PCH_VALUE_571 (571 * 2 + 1)
+#define PCH_ADD_571(a, b) ((a) + (b) + 571)
+typedef int pch_int_571;
+int pch_function_571(pch_int_571 a, int b);
+#define PCH_VALUE_572 (572 * 2 + 1)
+#define PCH_ADD_572(a, b) ((a) + (b) + 572)
+typedef int pch_int_572;
+int pch_function_572(pch_int_572 a, int b);
+#define PCH_VALUE_573 (573 * 2 + 1)
+#define PCH_ADD_573(a, b) ((a) + (b) + 573)
+typedef int pch_int_573;
+int pch_function_573(pch_int_573 a, int b);
+#define PCH_VALUE_574 (574 * 2 + 1)
+#define PCH_ADD_574(a, b) ((a) + (b) + 574)
+typedef int pch_int_574;
+int pch_function_574(pch_int_574 a, int b);
+#define PCH_VALUE_575 (575 * 2 + 1)
+#define PCH_ADD_575(a, b) ((a) + (b) + 575)
+typedef int pch_int_575;
+int pch_function_575(pch_int_575 a, int b);
+#define PCH_VALUE_576 (576 * 2 + 1)
+#define PCH_ADD_576(a, b) ((a) + (b) + 576)
+typedef int pch_int_576;
+int pch_function_576(pch_int_576 a, int b);
+#define PCH_VALUE_577 (577 * 2 + 1)
+#define PCH_ADD_577(a, b) ((a) + (b) + 577)
+typedef int pch_int_577;
+int pch_function_577(pch_int_577 a, int b);
+#define PCH_VALUE_578 (578 * 2 + 1)
+#define PCH_ADD_578(a, b) ((a) + (b) + 578)
+typedef int pch_int_578;
+int pch_function_578(pch_int_578 a, int b);
+#define PCH_VALUE_579 (579 * 2 + 1)
+#define PCH_ADD_579(a, b) ((a) + (b) + 579)
+typedef int pch_int_579;
+int pch_function_579(pch_int_579 a, int b);
+#define PCH_VALUE_580 (580 * 2 + 1)
+#define PCH_ADD_580(a, b) ((a) + (b) + 580)
+typedef int pch_int_580;
+int pch_function_580(pch_int_580 a, int b);
+#define PCH_VALUE_581 (581 * 2 + 1)
+#define PCH_ADD_581(a, b) ((a) + (b) + 581)
+typedef int pch_int_581;
+int pch_function_581(pch_int_581 a, int b);
+#define PCH_VALUE_582 (582 * 2 + 1)
+#define PCH_ADD_582(a, b) ((a) + (b) + 582)
+typedef int pch_int_582;
+int pch_function_582(pch_int_582 a, int b);
+#define PCH_VALUE_583 (583 * 2 + 1)
+#define PCH_ADD_583(a, b) ((a) + (b) + 583)
+typedef int pch_int_583;
+int pch_function_583(pch_int_583 a, int b);
+#define PCH_VALUE_584 (584 * 2 + 1)
+#define PCH_ADD_584(a, b) ((a) + (b) + 584)
+typedef int pch_int_584;
+int pch_function_584(pch_int_584 a, int b);
+#define PCH_VALUE_585 (585 * 2 + 1)
+#define PCH_ADD_585(a, b) ((a) + (b) + 585)
+typedef int pch_int_585;
+int pch_function_585(pch_int_585 a, int b);
+#define PCH_VALUE_586 (586 * 2 + 1)
+#define PCH_ADD_586(a, b) ((a) + (b) + 586)
+typedef int pch_int_586;
+int pch_function_586(pch_int_586 a, int b);
+#define PCH_VALUE_587 (587 * 2 + 1)
+#define PCH_ADD_587(a, b) ((a) + (b) + 587)
+typedef int pch_int_587;
+int pch_function_587(pch_int_587 a, int b);
+#define PCH_VALUE_588 (588 * 2 + 1)
+#define PCH_ADD_588(a, b) ((a) + (b) + 588)
+typedef int pch_int_588;
+int pch_function_588(pch_int_588 a, int b);
+#define PCH_VALUE_589 (589 * 2 + 1)
+#define PCH_ADD_589(a, b) ((a) + (b) + 589)
+typedef int pch_int_589;
+int pch_function_589(pch_int_589 a, int b);
+#define PCH_VALUE_590 (590 * 2 + 1)
+#define PCH_ADD_590(a, b) ((a) + (b) + 590)
+typedef int pch_int_590;
+int pch_function_590(pch_int_590 a, int b);
+#define PCH_VALUE_591 (591 * 2 + 1)
+#define PCH_ADD_591(a, b) ((a) + (b) + 591)
+typedef int pch_int_591;
+int pch_function_591(pch_int_591 a, int b);
+#define PCH_VALUE_592 (592 * 2 + 1)
+#define PCH_ADD_592(a, b) ((a) + (b) + 592)
+typedef int pch_int_592;
+int pch_function_592(pch_int_592 a, int b);
+#define PCH_VALUE_593 (593 * 2 + 1)
+#define PCH_ADD_593(a, b) ((a) + (b) + 593)
+typedef int pch_int_593;
+int pch_function_593(pch_int_593 a, int b);
+#define PCH_VALUE_594 (594 * 2 + 1)
+#define PCH_ADD_594(a, b) ((a) + (b) + 594)
+typedef int pch_int_594;
+int pch_function_594(pch_int_594 a, int b);
+#define PCH_VALUE_595 (595 * 2 + 1)
+#define PCH_ADD_595(a, b) ((a) + (b) + 595)
+typedef int pch_int_595;
+int pch_function_595(pch_int_595 a, int b);
+#define PCH_VALUE_596 (596 * 2 + 1)
+#define PCH_ADD_596(a, b) ((a) + (b) + 596)
+typedef int pch_int_596;
+int pch_function_596(pch_int_596 a, int b);
+#define PCH_VALUE_597 (597 * 2 + 1)
+#define PCH_ADD_597(a, b) ((a) + (b) + 597)
+typedef int pch_int_597;
+int pch_function_597(pch_int_597 a, int b);
+#define PCH_VALUE_598 (598 * 2 + 1)
+#define PCH_ADD_598(a, b) ((a) + (b) + 598)
+typedef int pch_int_598;
+int pch_function_598(pch_int_598 a, int b);
+#define PCH_VALUE_599 (599 * 2 + 1)
+#define PCH_ADD_599(a, b) ((a) + (b) + 599)
+typedef int pch_int_599;
+int pch_function_599(pch_int_599 a, int b);
+#define PCH_VALUE_600 (600 * 2 + 1)
+#define PCH_ADD_600(a, b) ((a) + (b) + 600)
+typedef int pch_int_600;
+int pch_function_600(pch_int_600 a, int b);
+#define PCH_VALUE_601 (601 * 2 + 1)
+#define PCH_ADD_601(a, b) ((a) + (b) + 601)
+typedef int pch_int_601;
+int pch_function_601(pch_int_601 a, int b);
+#define PCH_VALUE_602 (602 * 2 + 1)
+#define PCH_ADD_602(a, b) ((a) + (b) + 602)
+typedef int pch_int_602;
+int pch_function_602(pch_int_602 a, int b);
+#define PCH_VALUE_603 (603 * 2 + 1)
+#define PCH_ADD_603(a, b) ((a) + (b) + 603)
+typedef int pch_int_603;
+int pch_function_603(pch_int_603 a, int b);
+#define PCH_VALUE_604 (604 * 2 + 1)
+#define PCH_ADD_604(a, b) ((a) + (b) + 604)
+typedef int pch_int_604;
+int pch_function_604(pch_int_604 a, int b);
+#define PCH_VALUE_605 (605 * 2 + 1)
+#define PCH_ADD_605(a, b) ((a) + (b) + 605)
+typedef int pch_int_605;
+int pch_function_605(pch_int_605 a, int b);
+#define PCH_VALUE_606 (606 * 2 + 1)
+#define PCH_ADD_606(a, b) ((a) + (b) + 606)
+typedef int pch_int_606;
+int pch_function_606(pch_int_606 a, int b);
+#define PCH_VALUE_607 (607 * 2 + 1)
+#define PCH_ADD_607(a, b) ((a) + (b) + 607)
+typedef int pch_int_607;
+int pch_function_607(pch_int_607 a, int b);
+#define PCH_VALUE_608 (608 * 2 + 1)
+#define PCH_ADD_608(a, b) ((a) + (b) + 608)
+typedef int pch_int_608;
+int pch_function_608(pch_int_608 a, int b);
+#define PCH_VALUE_609 (609 * 2 + 1)
+#define PCH_ADD_609(a, b) ((a) + (b) + 609)
+typedef int pch_int_609;
+int pch_function_609(pch_int_609 a, int b);
+#define PCH_VALUE_610 (610 * 2 + 1)
+#define PCH_ADD_610(a, b) ((a) + (b) + 610)
+typedef int pch_int_610;
+int pch_function_610(pch_int_610 a, int b);
+#define PCH_VALUE_611 (611 * 2 + 1)
+#define PCH_ADD_611(a, b) ((a) + (b) + 611)
+typedef int pch_int_611;
+int pch_function_611(pch_int_611 a, int b);
+#define PCH_VALUE_612 (612 * 2 + 1)
+#define PCH_ADD_612(a, b) ((a) + (b) + 612)
+typedef int pch_int_612;
+int pch_function_612(pch_int_612 a, int b);
+#define PCH_VALUE_613 (613 * 2 + 1)
+#define PCH_ADD_613(a, b) ((a) + (b) + 613)
+typedef int pch_int_613;
+int pch_function_613(pch_int_613 a, int b);
+#define PCH_VALUE_614 (614 * 2 + 1)
+#define PCH_ADD_614(a, b) ((a) + (b) + 614)
+typedef int pch_int_614;
+int pch_function_614(pch_int_614 a, int b);
+#define PCH_VALUE_615 (615 * 2 + 1)
+#define PCH_ADD_615(a, b) ((a) + (b) + 615)
+typedef int pch_int_615;
+int pch_function_615(pch_int_615 a, int b);
+#define PCH_VALUE_616 (616 * 2 + 1)
+#define PCH_ADD_616(a, b) ((a) + (b) + 616)
+typedef int pch_int_616;
+int pch_function_616(pch_int_616 a, int b);
+#define PCH_VALUE_617 (617 * 2 + 1)
+#define PCH_ADD_617(a, b) ((a) + (b) + 617)
+typedef int pch_int_617;
+int pch_function_617(pch_int_617 a, int b);
+#define PCH_VALUE_618 (618 * 2 + 1)
+#define PCH_ADD_618(a, b) ((a) + (b) + 618)
+typedef int pch_int_618;
+int pch_function_618(pch_int_618 a, int b);
+#define PCH_VALUE_619 (619 * 2 + 1)
+#define PCH_ADD_619(a, b) ((a) + (b) + 619)
+typedef int pch_int_619;
+int pch_function_619(pch_int_619 a, int b);
+#define PCH_VALUE_620 (620 * 2 + 1)
+#define PCH_ADD_620(a, b) ((a) + (b) + 620)
+typedef int pch_int_620;
+int pch_function_620(pch_int_620 a, int b);
+#define PCH_VALUE_621 (621 * 2 + 1)
+#define PCH_ADD_621(a, b) ((a) + (b) + 621)
+typedef int pch_int_621;
+int pch_function_621(pch_int_621 a, int b);
+#define PCH_VALUE_622 (622 * 2 + 1)
+#define PCH_ADD_622(a, b) ((a) + (b) + 622)
+typedef int pch_int_622;
+int pch_function_622(pch_int_622 a, int b);
+#define PCH_VALUE_623 (623 * 2 + 1)
+#define PCH_ADD_623(a, b) ((a) + (b) + 623)
+typedef int pch_int_623;
+int pch_function_623(pch_int_623 a, int b);
+#define PCH_VALUE_624 (624 * 2 + 1)
+#define PCH_ADD_624(a, b) ((a) + (b) + 624)
+typedef int pch_int_624;
+int pch_function_624(pch_int_624 a, int b);
+#define PCH_VALUE_625 (625 * 2 + 1)
+#define PCH_ADD_625(a, b) ((a) + (b) + 625)
+typedef int pch_int_625;
+int pch_function_625(pch_int_625 a, int b);
+#define PCH_VALUE_626 (626 * 2 + 1)
+#define PCH_ADD_626(a, b) ((a) + (b) + 626)
+typedef int pch_int_626;
+int pch_function_626(pch_int_626 a, int b);
+#define PCH_VALUE_627 (627 * 2 + 1)
+#define PCH_ADD_627(a, b) ((a) + (b) + 627)
+typedef int pch_int_627;
+int pch_function_627(pch_int_627 a, int b);
+#define PCH_VALUE_628 (628 * 2 + 1)
+#define PCH_ADD_628(a, b) ((a) + (b) + 628)
+typedef int pch_int_628;
+int pch_function_628(pch_int_628 a, int b);
+#define PCH_VALUE_629 (629 * 2 + 1)
+#define PCH_ADD_629(a, b) ((a) + (b) + 629)
+typedef int pch_int_629;
+int pch_function_629(pch_int_629 a, int b);
+#define PCH_VALUE_630 (630 * 2 + 1)
+#define PCH_ADD_630(a, b) ((a) + (b) + 630)
+typedef int pch_int_630;
+int pch_function_630(pch_int_630 a, int b);
+#define PCH_VALUE_631 (631 * 2 + 1)
+#define PCH_ADD_631(a, b) ((a) + (b) + 631)
+typedef int pch_int_631;
+int pch_function_631(pch_int_631 a, int b);
+#define PCH_VALUE_632 (632 * 2 + 1)
+#define PCH_ADD_632(a, b) ((a) + (b) + 632)
+typedef int pch_int_632;
+int pch_function_632(pch_int_632 a, int b);
+#define PCH_VALUE_633 (633 * 2 + 1)
+#define PCH_ADD_633(a, b) ((a) + (b) + 633)
+typedef int pch_int_633;
+int pch_function_633(pch_int_633 a, int b);
+#define PCH_VALUE_634 (634 * 2 + 1)
+#define PCH_ADD_634(a, b) ((a) + (b) + 634)
+typedef int pch_int_634;
+int pch_function_634(pch_int_634 a, int b);
+#define PCH_VALUE_635 (635 * 2 + 1)
+#define PCH_ADD_635(a, b) ((a) + (b) + 635)
+typedef int pch_int_635;
+int pch_function_635(pch_int_635 a, int b);
+#define PCH_VALUE_636 (636 * 2 + 1)
+#define PCH_ADD_636(a, b) ((a) + (b) + 636)
+typedef int pch_int_636;
+int pch_function_636(pch_int_636 a, int b);
+#define PCH_VALUE_637 (637 * 2 + 1)
+#define PCH_ADD_637(a, b) ((a) + (b) + 637)
+typedef int pch_int_637;
+int pch_function_637(pch_int_637 a, int b);
+#define PCH_VALUE_638 (638 * 2 + 1)
+#define PCH_ADD_638(a, b) ((a) + (b) + 638)
+typedef int pch_int_638;
+int pch_function_638(pch_int_638 a, int b);
+#define PCH_VALUE_639 (639 * 2 + 1)
+#define PCH_ADD_639(a, b) ((a) + (b) + 639)
+typedef int pch_int_639;
+int pch_function_639(pch_int_639 a, int b);
+#define PCH_VALUE_640 (640 * 2 + 1)
+#define PCH_ADD_640(a, b) ((a) + (b) + 640)
+typedef int pch_int_640;
+int pch_function_640(pch_int_640 a, int b);
+#define PCH_VALUE_641 (641 * 2 + 1)
+#define PCH_ADD_641(a, b) ((a) + (b) + 641)
+typedef int pch_int_641;
+int pch_function_641(pch_int_641 a, int b);
+#define PCH_VALUE_642 (642 * 2 + 1)
+#define PCH_ADD_642(a, b) ((a) + (b) + 642)
+typedef int pch_int_642;
+int pch_function_642(pch_int_642 a, int b);
+#define PCH_VALUE_643 (643 * 2 + 1)
+#define PCH_ADD_643(a, b) ((a) + (b) + 643)
+typedef int pch_int_643;
+int pch_function_643(pch_int_643 a, int b);
+#define PCH_VALUE_644 (644 * 2 + 1)
+#define PCH_ADD_644(a, b) ((a) + (b) + 644)
+typedef int pch_int_644;
+int pch_function_644(pch_int_644 a, int b);
+#define PCH_VALUE_645 (645 * 2 + 1)
+#define PCH_ADD_645(a, b) ((a) + (b) + 645)
+typedef int pch_int_645;
+int pch_function_645(pch_int_645 a, int b);
+#define PCH_VALUE_646 (646 * 2 + 1)
+#define PCH_ADD_646(a, b) ((a) + (b) + 646)
+typedef int pch_int_646;
+int pch_function_646(pch_int_646 a, int b);
+#define PCH_VALUE_647 (647 * 2 + 1)
+#define PCH_ADD_647(a, b) ((a) + (b) + 647)
+typedef int pch_int_647;
+int pch_function_647(pch_int_647 a, int b);
+#define PCH_VALUE_648 (648 * 2 + 1)
+#define PCH_ADD_648(a, b) ((a) + (b) + 648)
+typedef int pch_int_648;
+int pch_function_648(pch_int_648 a, int b);
+#define PCH_VALUE_649 (649 * 2 + 1)
+#define PCH_ADD_649(a, b) ((a) + (b) + 649)
+typedef int pch_int_649;
+int pch_function_649(pch_int_649 a, int b);
+#define PCH_VALUE_650 (650 * 2 + 1)
+#define PCH_ADD_650(a, b) ((a) + (b) + 650)
+typedef int pch_int_650;
+int pch_function_650(pch_int_650 a, int b);
+#define PCH_VALUE_651 (651 * 2 + 1)
+#define PCH_ADD_651(a, b) ((a) + (b) + 651)
+typedef int pch_int_651;
+int pch_function_651(pch_int_651 a, int b);
+#define PCH_VALUE_652 (652 * 2 + 1)
+#define PCH_ADD_652(a, b) ((a) + (b) + 652)
+typedef int pch_int_652;
+int pch_function_652(pch_int_652 a, int b);
+#define PCH_VALUE_653 (653 * 2 + 1)
+#define PCH_ADD_653(a, b) ((a) + (b) + 653)
+typedef int pch_int_653;
+int pch_function_653(pch_int_653 a, int b);
+#define PCH_VALUE_654 (654 * 2 + 1)
+#define PCH_ADD_654(a, b) ((a) + (b) + 654)
+typedef int pch_int_654;
+int pch_function_654(pch_int_654 a, int b);
+#define PCH_VALUE_655 (655 * 2 + 1)
+#define PCH_ADD_655(a, b) ((a) + (b) + 655)
+typedef int pch_int_655;
+int pch_function_655(pch_int_655 a, int b);
+#define PCH_VALUE_656 (656 * 2 + 1)
+#define PCH_ADD_656(a, b) ((a) + (b) + 656)
+typedef int pch_int_656;
+int pch_function_656(pch_int_656 a, int b);
+#define PCH_VALUE_657 (657 * 2 + 1)
+#define PCH_ADD_657(a, b) ((a) + (b) + 657)
+typedef int pch_int_657;
+int pch_function_657(pch_int_657 a, int b);
+#define PCH_VALUE_658 (658 * 2 + 1)
+#define PCH_ADD_658(a, b) ((a) + (b) + 658)
+typedef int pch_int_658;
+int pch_function_658(pch_int_658 a, int b);
+#define PCH_VALUE_659 (659 * 2 + 1)
+#define PCH_ADD_659(a, b) ((a) + (b) + 659)
+typedef int pch_int_659;
+int pch_function_659(pch_int_659 a, int b);
+#define PCH_VALUE_660 (660 * 2 + 1)
+#define PCH_ADD_660(a, b) ((a) + (b) + 660)
+typedef int pch_int_660;
+int pch_function_660(pch_int_660 a, int b);
+#define PCH_VALUE_661 (661 * 2 + 1)
+#define PCH_ADD_661(a, b) ((a) + (b) + 661)
+typedef int pch_int_661;
+int pch_function_661(pch_int_661 a, int b);
+#define PCH_VALUE_662 (662 * 2 + 1)
+#define PCH_ADD_662(a, b) ((a) + (b) + 662)
+typedef int pch_int_662;
+int pch_function_662(pch_int_662 a, int b);
+#define PCH_VALUE_663 (663 * 2 + 1)
+#define PCH_ADD_663(a, b) ((a) + (b) + 663)
+typedef int pch_int_663;
+int pch_function_663(pch_int_663 a, int b);
+#define PCH_VALUE_664 (664 * 2 + 1)
+#define PCH_ADD_664(a, b) ((a) + (b) + 664)
+typedef int pch_int_664;
+int pch_function_664(pch_int_664 a, int b);
+#define PCH_VALUE_665 (665 * 2 + 1)
+#define PCH_ADD_665(a, b) ((a) + (b) + 665)
+typedef int pch_int_665;
+int pch_function_665(pch_int_665 a, int b);
+#define PCH_VALUE_666 (666 * 2 + 1)
+#define PCH_ADD_666(a, b) ((a) + (b) + 666)
+typedef int pch_int_666;
+int pch_function_666(pch_int_666 a, int b);
+#define PCH_VALUE_667 (667 * 2 + 1)
+#define PCH_ADD_667(a, b) ((a) + (b) + 667)
+typedef int pch_int_667;
+int pch_function_667(pch_int_667 a, int b);
+#define PCH_VALUE_668 (668 * 2 + 1)
+#define PCH_ADD_668(a, b) ((a) + (b) + 668)
+typedef int pch_int_668;
+int pch_function_668(pch_int_668 a, int b);
+#define PCH_VALUE_669 (669 * 2 + 1)
+#define PCH_ADD_669(a, b) ((a) + (b) + 669)
+typedef int pch_int_669;
+int pch_function_669(pch_int_669 a, int b);
+#define PCH_VALUE_670 (670 * 2 + 1)
+#define PCH_ADD_670(a, b) ((a) + (b) + 670)
+typedef int pch_int_670;
+int pch_function_670(pch_int_670 a, int b);
+#define PCH_VALUE_671 (671 * 2 + 1)
+#define PCH_ADD_671(a, b) ((a) + (b) + 671)
+typedef int pch_int_671;
+int pch_function_671(pch_int_671 a, int b);
+#define PCH_VALUE_672 (672 * 2 + 1)
+#define PCH_ADD_672(a, b) ((a) + (b) + 672)
+typedef int pch_int_672;
+int pch_function_672(pch_int_672 a, int b);
+#define PCH_VALUE_673 (673 * 2 + 1)
+#define PCH_ADD_673(a, b) ((a) + (b) + 673)
+typedef int pch_int_673;
+int pch_function_673(pch_int_673 a, int b);
+#define PCH_VALUE_674 (674 * 2 + 1)
+#define PCH_ADD_674(a, b) ((a) + (b) + 674)
+typedef int pch_int_674;
+int pch_function_674(pch_int_674 a, int b);
+#define PCH_VALUE_675 (675 * 2 + 1)
+#define PCH_ADD_675(a, b) ((a) + (b) + 675)
+typedef int pch_int_675;
+int pch_function_675(pch_int_675 a, int b);
+#define PCH_VALUE_676 (676 * 2 + 1)
+#define PCH_ADD_676(a, b) ((a) + (b) + 676)
+typedef int pch_int_676;
+int pch_function_676(pch_int_676 a, int b);
+#define PCH_VALUE_677 (677 * 2 + 1)
+#define PCH_ADD_677(a, b) ((a) + (b) + 677)
+typedef int pch_int_677;
+int pch_function_677(pch_int_677 a, int b);
+#define PCH_VALUE_678 (678 * 2 + 1)
+#define PCH_ADD_678(a, b) ((a) + (b) + 678)
+typedef int pch_int_678;
+int pch_function_678(pch_int_678 a, int b);
+#define PCH_VALUE_679 (679 * 2 + 1)
+#define PCH_ADD_679(a, b) ((a) + (b) + 679)
+typedef int pch_int_679;
+int pch_function_679(pch_int_679 a, int b);
+#define PCH_VALUE_680 (680 * 2 + 1)
+#define PCH_ADD_680(a, b) ((a) + (b) + 680)
+typedef int pch_int_680;
+int pch_function_680(pch_int_680 a, int b);
+#define PCH_VALUE_681 (681 * 2 + 1)
+#define PCH_ADD_681(a, b) ((a) + (b) + 681)
+typedef int pch_int_681;
+int pch_function_681(pch_int_681 a, int b);
+#define PCH_VALUE_682 (682 * 2 + 1)
+#define PCH_ADD_682(a, b) ((a) + (b) + 682)
+typedef int pch_int_682;
+int pch_function_682(pch_int_682 a, int b);
+#define PCH_VALUE_683 (683 * 2 + 1)
+#define PCH_ADD_683(a, b) ((a) + (b) + 683)
+typedef int pch_int_683;
+int pch_function_683(pch_int_683 a, int b);
+#define PCH_VALUE_684 (684 * 2 + 1)
+#define PCH_ADD_684(a, b) ((a) + (b) + 684)
+typedef int pch_int_684;
+int pch_function_684(pch_int_684 a, int b);
+#define PCH_VALUE_685 (685 * 2 + 1)
+#define PCH_ADD_685(a, b) ((a) + (b) + 685)
+typedef int pch_int_685;
+int pch_function_685(pch_int_685 a, int b);
+#define PCH_VALUE_686 (686 * 2 + 1)
+#define PCH_ADD_686(a, b) ((a) + (b) + 686)
+typedef int pch_int_686;
+int pch_function_686(pch_int_686 a, int b);
+#define PCH_VALUE_687 (687 * 2 + 1)
+#define PCH_ADD_687(a, b) ((a) + (b) + 687)
+typedef int pch_int_687;
+int pch_function_687(pch_int_687 a, int b);
+#define PCH_VALUE_688 (688 * 2 + 1)
+#define PCH_ADD_688(a, b) ((a) + (b) + 688)
+typedef int pch_int_688;
+int pch_function_688(pch_int_688 a, int b);
+#define PCH_VALUE_689 (689 * 2 + 1)
+#define PCH_ADD_689(a, b) ((a) + (b) + 689)
+typedef int pch_int_689;
+int pch_function_689(pch_int_689 a, int b);
+#define PCH_VALUE_690 (690 * 2 + 1)
+#define PCH_ADD_690(a, b) ((a) + (b) + 690)
+typedef int pch_int_690;
+int pch_function_690(pch_int_690 a, int b);
+#define PCH_VALUE_691 (691 * 2 + 1)
+#define PCH_ADD_691(a, b) ((a) + (b) + 691)
+typedef int pch_int_691;
+int pch_function_691(pch_int_691 a, int b);
+#define PCH_VALUE_692 (692 * 2 + 1)
+#define PCH_ADD_692(a, b) ((a) + (b) + 692)
+typedef int pch_int_692;
+int pch_function_692(pch_int_692 a, int b);
+#define PCH_VALUE_693 (693 * 2 + 1)
+#define PCH_ADD_693(a, b) ((a) + (b) + 693)
+typedef int pch_int_693;
+int pch_function_693(pch_int_693 a, int b);
+#define PCH_VALUE_694 (694 * 2 + 1)
+#define PCH_ADD_694(a, b) ((a) + (b) + 694)
+typedef int pch_int_694;
+int pch_function_694(pch_int_694 a, int b);
+#define PCH_VALUE_695 (695 * 2 + 1)
+#define PCH_ADD_695(a, b) ((a) + (b) + 695)
+typedef int pch_int_695;
+int pch_function_695(pch_int_695 a, int b);
+#define PCH_VALUE_696 (696 * 2 + 1)
+#define PCH_ADD_696(a, b) ((a) + (b) + 696)
+typedef int pch_int_696;
+int pch_function_696(pch_int_696 a, int b);
+#define PCH_VALUE_697 (697 * 2 + 1)
+#define PCH_ADD_697(a, b) ((a) + (b) + 697)
+typedef int pch_int_697;
+int pch_function_697(pch_int_697 a, int b);
+#define PCH_VALUE_698 (698 * 2 + 1)
+#define PCH_ADD_698(a, b) ((a) + (b) + 698)
+typedef int pch_int_698;
+int pch_function_698(pch_int_698 a, int b);
+#define PCH_VALUE_699 (699 * 2 + 1)
+#define PCH_ADD_699(a, b) ((a) + (b) + 699)
+typedef int pch_int_699;
+int pch_function_699(pch_int_699 a, int b);
+#define PCH_VALUE_700 (700 * 2 + 1)
+#define PCH_ADD_700(a, b) ((a) + (b) + 700)
+typedef int pch_int_700;
+int pch_function_700(pch_int_700 a, int b);
+#define PCH_VALUE_701 (701 * 2 + 1)
+#define PCH_ADD_701(a, b) ((a) + (b) + 701)
+typedef int pch_int_701;
+int pch_function_701(pch_int_701 a, int b);
+#define PCH_VALUE_702 (702 * 2 + 1)
+#define PCH_ADD_702(a, b) ((a) + (b) + 702)
+typedef int pch_int_702;
+int pch_function_702(pch_int_702 a, int b);
+#define PCH_VALUE_703 (703 * 2 + 1)
+#define PCH_ADD_703(a, b) ((a) + (b) + 703)
+typedef int pch_int_703;
+int pch_function_703(pch_int_703 a, int b);
+#define PCH_VALUE_704 (704 * 2 + 1)
+#define PCH_ADD_704(a, b) ((a) + (b) + 704)
+typedef int pch_int_704;
+int pch_function_704(pch_int_704 a, int b);
+#define PCH_VALUE_705 (705 * 2 + 1)
+#define PCH_ADD_705(a, b) ((a) + (b) + 705)
+typedef int pch_int_705;
+int pch_function_705(pch_int_705 a, int b);
+#define PCH_VALUE_706 (706 * 2 + 1)
+#define PCH_ADD_706(a, b) ((a) + (b) + 706)
+typedef int pch_int_706;
+int pch_function_706(pch_int_706 a, int b);
+#define PCH_VALUE_707 (707 * 2 + 1)
+#define PCH_ADD_707(a, b) ((a) + (b) + 707)
+typedef int pch_int_707;
+int pch_function_707(pch_int_707 a, int b);
+#define PCH_VALUE_708 (708 * 2 + 1)
+#define PCH_ADD_708(a, b) ((a) + (b) + 708)
+typedef int pch_int_708;
+int pch_function_708(pch_int_708 a, int b);
+#define PCH_VALUE_709 (709 * 2 + 1)
+#define PCH_ADD_709(a, b) ((a) + (b) + 709)
+typedef int pch_int_709;
+int pch_function_709(pch_int_709 a, int b);
+#define PCH_VALUE_710 (710 * 2 + 1)
+#define PCH_ADD_710(a, b) ((a) + (b) + 710)
+typedef int pch_int_710;
+int pch_function_710(pch_int_710 a, int b);
+#define PCH_VALUE_711 (711 * 2 + 1)
+#define PCH_ADD_711(a, b) ((a) + (b) + 711)
+typedef int pch_int_711;
+int pch_function_711(pch_int_711 a, int b);
+#define PCH_VALUE_712 (712 * 2 + 1)
+#define PCH_ADD_712(a, b) ((a) + (b) + 712)
+typedef int pch_int_712;
+int pch_function_712(pch_int_712 a, int b);
+#define PCH_VALUE_713 (713 * 2 + 1)
+#define PCH_ADD_713(a, b) ((a) + (b) + 713)
+typedef int pch_int_713;
+int pch_function_713(pch_int_713 a, int b);
+#define PCH_VALUE_714 (714 * 2 + 1)
+#define PCH_ADD_714(a, b) ((a) + (b) + 714)
+typedef int pch_int_714;
+int pch_function_714(pch_int_714 a, int b);
+#define PCH_VALUE_715 (715 * 2 + 1)
+#define PCH_ADD_715(a, b) ((a) + (b) + 715)
+typedef int pch_int_715;
+int pch_function_715(pch_int_715 a, int b);
+#define PCH_VALUE_716 (716 * 2 + 1)
+#define PCH_ADD_716(a, b) ((a) + (b) + 716)
+typedef int pch_int_716;
+int pch_function_716(pch_int_716 a, int b);
+#define PCH_VALUE_717 (717 * 2 + 1)
+#define PCH_ADD_717(a, b) ((a) + (b) + 717)
+typedef int pch_int_717;
+int pch_function_717(pch_int_717 a, int b);
+#define PCH_VALUE_718 (718 * 2 + 1)
+#define PCH_ADD_718(a, b) ((a) + (b) + 718)
+typedef int pch_int_718;
+int pch_function_718(pch_int_718 a, int b);
+#define PCH_VALUE_719 (719 * 2 + 1)
+#define PCH_ADD_719(a, b) ((a) + (b) + 719)
+typedef int pch_int_719;
+int pch_function_719(pch_int_719 a, int b);
+#define PCH_VALUE_720 (720 * 2 + 1)
+#define PCH_ADD_720(a, b) ((a) + (b) + 720)
+typedef int pch_int_720;
+int pch_function_720(pch_int_720 a, int b);
+#define PCH_VALUE_721 (721 * 2 + 1)
+#define PCH_ADD_721(a, b) ((a) + (b) + 721)
+typedef int pch_int_721;
+int pch_function_721(pch_int_721 a, int b);
+#define PCH_VALUE_722 (722 * 2 + 1)
+#define PCH_ADD_722(a, b) ((a) + (b) + 722)
+typedef int pch_int_722;
+int pch_function_722(pch_int_722 a, int b);
+#define PCH_VALUE_723 (723 * 2 + 1)
+#define PCH_ADD_723(a, b) ((a) + (b) + 723)
+typedef int pch_int_723;
+int pch_function_723(pch_int_723 a, int b);
+#define PCH_VALUE_724 (724 * 2 + 1)
+#define PCH_ADD_724(a, b) ((a) + (b) + 724)
+typedef int pch_int_724;
+int pch_function_724(pch_int_724 a, int b);
+#define PCH_VALUE_725 (725 * 2 + 1)
+#define PCH_ADD_725(a, b) ((a) + (b) + 725)
+typedef int pch_int_725;
+int pch_function_725(pch_int_725 a, int b);
+#define PCH_VALUE_726 (726 * 2 + 1)
+#define PCH_ADD_726(a, b) ((a) + (b) + 726)
+typedef int pch_int_726;
+int pch_function_726(pch_int_726 a, int b);
+#define PCH_VALUE_727 (727 * 2 + 1)
+#define PCH_ADD_727(a, b) ((a) + (b) + 727)
+typedef int pch_int_727;
+int pch_function_727(pch_int_727 a, int b);
+#define PCH_VALUE_728 (728 * 2 + 1)
+#define PCH_ADD_728(a, b) ((a) + (b) + 728)
+typedef int pch_int_728;
+int pch_function_728(pch_int_728 a, int b);
+#define PCH_VALUE_729 (729 * 2 + 1)
+#define PCH_ADD_729(a, b) ((a) + (b) + 729)
+typedef int pch_int_729;
+int pch_function_729(pch_int_729 a, int b);
+#define PCH_VALUE_730 (730 * 2 + 1)
+#define PCH_ADD_730(a, b) ((a) + (b) + 730)
+typedef int pch_int_730;
+int pch_function_730(pch_int_730 a, int b);
+#define PCH_VALUE_731 (731 * 2 + 1)
+#define PCH_ADD_731(a, b) ((a) + (b) + 731)
+typedef int pch_int_731;
+int pch_function_731(pch_int_731 a, int b);
+#define PCH_VALUE_732 (732 * 2 + 1)
+#define PCH_ADD_732(a, b) ((a) + (b) + 732)
+typedef int pch_int_732;
+int pch_function_732(pch_int_732 a, int b);
+#define PCH_VALUE_733 (733 * 2 + 1)
+#define PCH_ADD_733(a, b) ((a) + (b) + 733)
+typedef int pch_int_733;
+int pch_function_733(pch_int_733 a, int b);
+#define PCH_VALUE_734 (734 * 2 + 1)
+#define PCH_ADD_734(a, b) ((a) + (b) + 734)
+typedef int pch_int_734;
+int pch_function_734(pch_int_734 a, int b);
+#define PCH_VALUE_735 (735 * 2 + 1)
+#define PCH_ADD_735(a, b) ((a) + (b) + 735)
+typedef int pch_int_735;
+int pch_function_735(pch_int_735 a, int b);
+#define PCH_VALUE_736 (736 * 2 + 1)
+#define PCH_ADD_736(a, b) ((a) + (b) + 736)
+typedef int pch_int_736;
+int pch_function_736(pch_int_736 a, int b);
+#define PCH_VALUE_737 (737 * 2 + 1)
+#define PCH_ADD_737(a, b) ((a) + (b) + 737)
+typedef int pch_int_737;
+int pch_function_737(pch_int_737 a, int b);
+#define PCH_VALUE_738 (738 * 2 + 1)
+#define PCH_ADD_738(a, b) ((a) + (b) + 738)
+typedef int pch_int_738;
+int pch_function_738(pch_int_738 a, int b);
+#define PCH_VALUE_739 (739 * 2 + 1)
+#define PCH_ADD_739(a, b) ((a) + (b) + 739)
+typedef int pch_int_739;
+int pch_function_739(pch_int_739 a, int b);
+#define PCH_VALUE_740 (740 * 2 + 1)
+#define PCH_ADD_740(a, b) ((a) + (b) + 740)
+typedef int pch_int_740;
+int pch_function_740(pch_int_740 a, int b);
+#define PCH_VALUE_741 (741 * 2 + 1)
+#define PCH_ADD_741(a, b) ((a) + (b) + 741)
+typedef int pch_int_741;
+int pch_function_741(pch_int_741 a, int b);
+#define PCH_VALUE_742 (742 * 2 + 1)
+#define PCH_ADD_742(a, b) ((a) + (b) + 742)
+typedef int pch_int_742;
+int pch_function_742(pch_int_742 a, int b);
+#define PCH_VALUE_743 (743 * 2 + 1)
+#define PCH_ADD_743(a, b) ((a) + (b) + 743)
+typedef int pch_int_743;
+int pch_function_743(pch_int_743 a, int b);
+#define PCH_VALUE_744 (744 * 2 + 1)
+#define PCH_ADD_744(a, b) ((a) + (b) + 744)
+typedef int pch_int_744;
+int pch_function_744(pch_int_744 a, int b);
+#define PCH_VALUE_745 (745 * 2 + 1)
+#define PCH_ADD_745(a, b) ((a) + (b) + 745)
+typedef int pch_int_745;
+int pch_function_745(pch_int_745 a, int b);
+#define PCH_VALUE_746 (746 * 2 + 1)
+#define PCH_ADD_746(a, b) ((a) + (b) + 746)
+typedef int pch_int_746;
+int pch_function_746(pch_int_746 a, int b);
+#define PCH_VALUE_747 (747 * 2 + 1)
+#define PCH_ADD_747(a, b) ((a) + (b) + 747)
+typedef int pch_int_747;
+int pch_function_747(pch_int_747 a, int b);
+#define PCH_VALUE_748 (748 * 2 + 1)
+#define PCH_ADD_748(a, b) ((a) + (b) + 748)
+typedef int pch_int_748;
+int pch_function_748(pch_int_748 a, int b);
+#define PCH_VALUE_749 (749 * 2 + 1)
+#define PCH_ADD_749(a, b) ((a) + (b) + 749)
+typedef int pch_int_749;
+int pch_function_749(pch_int_749 a, int b);
+#define PCH_VALUE_750 (750 * 2 + 1)
+#define PCH_ADD_750(a, b) ((a) + (b) + 750)
+typedef int pch_int_750;
+int pch_function_750(pch_int_750 a, int b);
+#define PCH_VALUE_751 (751 * 2 + 1)
+#define PCH_ADD_751(a, b) ((a) + (b) + 751)
+typedef int pch_int_751;
+int pch_function_751(pch_int_751 a, int b);
+#define PCH_VALUE_752 (752 * 2 + 1)
+#define PCH_ADD_752(a, b) ((a) + (b) + 752)
+typedef int pch_int_752;
+int pch_function_752(pch_int_752 a, int b);
+#define PCH_VALUE_753 (753 * 2 + 1)
+#define PCH_ADD_753(a, b) ((a) + (b) + 753)
+typedef int pch_int_753;
+int pch_function_753(pch_int_753 a, int b);
+#define PCH_VALUE_754 (754 * 2 + 1)
+#define PCH_ADD_754(a, b) ((a) + (b) + 754)
+typedef int pch_int_754;
+int pch_function_754(pch_int_754 a, int b);
+#define PCH_VALUE_755 (755 * 2 + 1)
+#define PCH_ADD_755(a, b) ((a) + (b) + 755)
+typedef int pch_int_755;
+int pch_function_755(pch_int_755 a, int b);
+#define PCH_VALUE_756 (756 * 2 + 1)
+#define PCH_ADD_756(a, b) ((a) + (b) + 756)
+typedef int pch_int_756;
+int pch_function_756(pch_int_756 a, int b);
+#define PCH_VALUE_757 (757 * 2 + 1)
+#define PCH_ADD_757(a, b) ((a) + (b) + 757)
+typedef int pch_int_757;
+int pch_function_757(pch_int_757 a, int b);
+#define PCH_VALUE_758 (758 * 2 + 1)
+#define PCH_ADD_758(a, b) ((a) + (b) + 758)
+typedef int pch_int_758;
+int pch_function_758(pch_int_758 a, int b);
+#define PCH_VALUE_759 (759 * 2 + 1)
+#define PCH_ADD_759(a, b) ((a) + (b) + 759)
+typedef int pch_int_759;
+int pch_function_759(pch_int_759 a, int b);
+#define PCH_VALUE_760 (760 * 2 + 1)
+#define PCH_ADD_760(a, b) ((a) + (b) + 760)
+typedef int pch_int_760;
+int pch_function_760(pch_int_760 a, int b);
+#define PCH_VALUE_761 (761 * 2 + 1)
+#define PCH_ADD_761(a, b) ((a) + (b) + 761)
+typedef int pch_int_761;
+int pch_function_761(pch_int_761 a, int b);
+#define PCH_VALUE_762 (762 * 2 + 1)
+#define PCH_ADD_762(a, b) ((a) + (b) + 762)
+typedef int pch_int_762;
+int pch_function_762(pch_int_762 a, int b);
+#define PCH_VALUE_763 (763 * 2 + 1)
+#define PCH_ADD_763(a, b) ((a) + (b) + 763)
+typedef int pch_int_763;
+int pch_function_763(pch_int_763 a, int b);
+#define PCH_VALUE_764 (764 * 2 + 1)
+#define PCH_ADD_764(a, b) ((a) + (b) + 764)
+typedef int pch_int_764;
+int pch_function_764(pch_int_764 a, int b);
+#define PCH_VALUE_765 (765 * 2 + 1)
+#define PCH_ADD_765(a, b) ((a) + (b) + 765)
+typedef int pch_int_765;
+int pch_function_765(pch_int_765 a, int b);
+#define PCH_VALUE_766 (766 * 2 + 1)
+#define PCH_ADD_766(a, b) ((a) + (b) + 766)
+typedef int pch_int_766;
+int pch_function_766(pch_int_766 a, int b);
+#define PCH_VALUE_767 (767 * 2 + 1)
+#define PCH_ADD_767(a, b) ((a) + (b) + 767)
+typedef int pch_int_767;
+int pch_function_767(pch_int_767 a, int b);
+#define PCH_VALUE_768 (768 * 2 + 1)
+#define PCH_ADD_768(a, b) ((a) + (b) + 768)
+typedef int pch_int_768;
+int pch_function_768(pch_int_768 a, int b);
+#define PCH_VALUE_769 (769 * 2 + 1)
+#define PCH_ADD_769(a, b) ((a) + (b) + 769)
+typedef int pch_int_769;
+int pch_function_769(pch_int_769 a, int b);
+#define PCH_VALUE_770 (770 * 2 + 1)
+#define PCH_ADD_770(a, b) ((a) + (b) + 770)
+typedef int pch_int_770;
+int pch_function_770(pch_int_770 a, int b);
+#define PCH_VALUE_771 (771 * 2 + 1)
+#define PCH_ADD_771(a, b) ((a) + (b) + 771)
+typedef int pch_int_771;
+int pch_function_771(pch_int_771 a, int b);
+#define PCH_VALUE_772 (772 * 2 + 1)
+#define PCH_ADD_772(a, b) ((a) + (b) + 772)
+typedef int pch_int_772;
+int pch_function_772(pch_int_772 a, int b);
+#define PCH_VALUE_773 (773 * 2 + 1)
+#define PCH_ADD_773(a, b) ((a) + (b) + 773)
+typedef int pch_int_773;
+int pch_function_773(pch_int_773 a, int b);
+#define PCH_VALUE_774 (774 * 2 + 1)
+#define PCH_ADD_774(a, b) ((a) + (b) + 774)
+typedef int pch_int_774;
+int pch_function_774(pch_int_774 a, int b);
+#define PCH_VALUE_775 (775 * 2 + 1)
+#define PCH_ADD_775(a, b) ((a) + (b) + 775)
+typedef int pch_int_775;
+int pch_function_775(pch_int_775 a, int b);
+#define PCH_VALUE_776 (776 * 2 + 1)
+#define PCH_ADD_776(a, b) ((a) + (b) + 776)
+typedef int pch_int_776;
+int pch_function_776(pch_int_776 a, int b);
+#define PCH_VALUE_777 (777 * 2 + 1)
+#define PCH_ADD_777(a, b) ((a) + (b) + 777)
+typedef int pch_int_777;
+int pch_function_777(pch_int_777 a, int b);
+#define PCH_VALUE_778 (778 * 2 + 1)
+#define PCH_ADD_778(a, b) ((a) + (b) + 778)
+typedef int pch_int_778;
+int pch_function_778(pch_int_778 a, int b);
+#define PCH_VALUE_779 (779 * 2 + 1)
+#define PCH_ADD_779(a, b) ((a) + (b) + 779)
+typedef int pch_int_779;
+int pch_function_779(pch_int_779 a, int b);
+#define PCH_VALUE_780 (780 * 2 + 1)
+#define PCH_ADD_780(a, b) ((a) + (b) + 780)
+typedef int pch_int_780;
+int pch_function_780(pch_int_780 a, int b);
+#define PCH_VALUE_781 (781 * 2 + 1)
+#define PCH_ADD_781(a, b) ((a) + (b) + 781)
+typedef int pch_int_781;
+int pch_function_781(pch_int_781 a, int b);
+#define PCH_VALUE_782 (782 * 2 + 1)
+#define PCH_ADD_782(a, b) ((a) + (b) + 782)
+typedef int pch_int_782;
+int pch_function_782(pch_int_782 a, int b);
+#define PCH_VALUE_783 (783 * 2 + 1)
+#define PCH_ADD_783(a, b) ((a) + (b) + 783)
+typedef int pch_int_783;
+int pch_function_783(pch_int_783 a, int b);
+#define PCH_VALUE_784 (784 * 2 + 1)
+#define PCH_ADD_784(a, b) ((a) + (b) + 784)
+typedef int pch_int_784;
+int pch_function_784(pch_int_784 a, int b);
+#define PCH_VALUE_785 (785 * 2 + 1)
+#define PCH_ADD_785(a, b) ((a) + (b) + 785)
+typedef int pch_int_785;
+int pch_function_785(pch_int_785 a, int b);
+#define PCH_VALUE_786 (786 * 2 + 1)
+#define PCH_ADD_786(a, b) ((a) + (b) + 786)
+typedef int pch_int_786;
+int pch_function_786(pch_int_786 a, int b);
+#define PCH_VALUE_787 (787 * 2 + 1)
+#define PCH_ADD_787(a, b) ((a) + (b) + 787)
+typedef int pch_int_787;
+int pch_function_787(pch_int_787 a, int b);
+#define PCH_VALUE_788 (788 * 2 + 1)
+#define PCH_ADD_788(a, b) ((a) + (b) + 788)
+typedef int pch_int_788;
+int pch_function_788(pch_int_788 a, int b);
+#define PCH_VALUE_789 (789 * 2 + 1)
+#define PCH_ADD_789(a, b) ((a) + (b) + 789)
+typedef int pch_int_789;
+int pch_function_789(pch_int_789 a, int b);
+#define PCH_VALUE_790 (790 * 2 + 1)
+#define PCH_ADD_790(a, b) ((a) + (b) + 790)
+typedef int pch_int_790;
+int pch_function_790(pch_int_790 a, int b);
+#define PCH_VALUE_791 (791 * 2 + 1)
+#define PCH_ADD_791(a, b) ((a) + (b) + 791)
+typedef int pch_int_791;
+int pch_function_791(pch_int_791 a, int b);
+#define PCH_VALUE_792 (792 * 2 + 1)
+#define PCH_ADD_792(a, b) ((a) + (b) + 792)
+typedef int pch_int_792;
+int pch_function_792(pch_int_792 a, int b);
+#define PCH_VALUE_793 (793 * 2 + 1)
+#define PCH_ADD_793(a, b) ((a) + (b) + 793)
+typedef int pch_int_793;
+int pch_function_793(pch_int_793 a, int b);
+#define PCH_VALUE_794 (794 * 2 + 1)
+#define PCH_ADD_794(a, b) ((a) + (b) + 794)
+typedef int pch_int_794;
+int pch_function_794(pch_int_794 a, int b);
+#define PCH_VALUE_795 (795 * 2 + 1)
+#define PCH_ADD_795(a, b) ((a) + (b) + 795)
+typedef int pch_int_795;
+int pch_function_795(pch_int_795 a, int b);
+#define PCH_VALUE_796 (796 * 2 + 1)
+#define PCH_ADD_796(a, b) ((a) + (b) + 796)
+typedef int pch_int_796;
+int pch_function_796(pch_int_796 a, int b);
+#define PCH_VALUE_797 (797 * 2 + 1)
+#define PCH_ADD_797(a, b) ((a) + (b) + 797)
+typedef int pch_int_797;
+int pch_function_797(pch_int_797 a, int b);
+#define PCH_VALUE_798 (798 * 2 + 1)
+#define PCH_ADD_798(a, b) ((a) + (b) + 798)
+typedef int pch_int_798;
+int pch_function_798(pch_int_798 a, int b);
+#define PCH_VALUE_799 (799 * 2 + 1)
+#define PCH_ADD_799(a, b) ((a) + (b) + 799)
+typedef int pch_int_799;
+int pch_function_799(pch_int_799 a, int b);
+#define PCH_VALUE_800 (800 * 2 + 1)
+#define PCH_ADD_800(a, b) ((a) + (b) + 800)
+typedef int pch_int_800;
+int pch_function_800(pch_int_800 a, int b);
+#define PCH_VALUE_801 (801 * 2 + 1)
+#define PCH_ADD_801(a, b) ((a) + (b) + 801)
+typedef int pch_int_801;
+int pch_function_801(pch_int_801 a, int b);
+#define PCH_VALUE_802 (802 * 2 + 1)
+#define PCH_ADD_802(a, b) ((a) + (b) + 802)
+typedef int pch_int_802;
+int pch_function_802(pch_int_802 a, int b);
+#define PCH_VALUE_803 (803 * 2 + 1)
+#define PCH_ADD_803(a, b) ((a) + (b) + 803)
+typedef int pch_int_803;
+int pch_function_803(pch_int_803 a, int b);
+#define PCH_VALUE_804 (804 * 2 + 1)
+#define PCH_ADD_804(a, b) ((a) + (b) + 804)
+typedef int pch_int_804;
+int pch_function_804(pch_int_804 a, int b);
+#define PCH_VALUE_805 (805 * 2 + 1)
+#define PCH_ADD_805(a, b) ((a) + (b) + 805)
+typedef int pch_int_805;
+int pch_function_805(pch_int_805 a, int b);
+#define PCH_VALUE_806 (806 * 2 + 1)
+#define PCH_ADD_806(a, b) ((a) + (b) + 806)
+typedef int pch_int_806;
+int pch_function_806(pch_int_806 a, int b);
+#define PCH_VALUE_807 (807 * 2 + 1)
+#define PCH_ADD_807(a, b) ((a) + (b) + 807)
+typedef int pch_int_807;
+int pch_function_807(pch_int_807 a, int b);
+#define PCH_VALUE_808 (808 * 2 + 1)
+#define PCH_ADD_808(a, b) ((a) + (b) + 808)
+typedef int pch_int_808;
+int pch_function_808(pch_int_808 a, int b);
+#define PCH_VALUE_809 (809 * 2 + 1)
+#define PCH_ADD_809(a, b) ((a) + (b) + 809)
+typedef int pch_int_809;
+int pch_function_809(pch_int_809 a, int b);
+#define PCH_VALUE_810 (810 * 2 + 1)
+#define PCH_ADD_810(a, b) ((a) + (b) + 810)
+typedef int pch_int_810;
+int pch_function_810(pch_int_810 a, int b);
+#define PCH_VALUE_811 (811 * 2 + 1)
+#define PCH_ADD_811(a, b) ((a) + (b) + 811)
+typedef int pch_int_811;
+int pch_function_811(pch_int_811 a, int b);
+#define PCH_VALUE_812 (812 * 2 + 1)
+#define PCH_ADD_812(a, b) ((a) + (b) + 812)
+typedef int pch_int_812;
+int pch_function_812(pch_int_812 a, int b);
+#define PCH_VALUE_813 (813 * 2 + 1)
+#define PCH_ADD_813(a, b) ((a) + (b) + 813)
+typedef int pch_int_813;
+int pch_function_813(pch_int_813 a, int b);
+#define PCH_VALUE_814 (814 * 2 + 1)
+#define PCH_ADD_814(a, b) ((a) + (b) + 814)
+typedef int pch_int_814;
+int pch_function_814(pch_int_814 a, int b);
+#define PCH_VALUE_815 (815 * 2 + 1)
+#define PCH_ADD_815(a, b) ((a) + (b) + 815)
+typedef int pch_int_815;
+int pch_function_815(pch_int_815 a, int b);
+#define PCH_VALUE_816 (816 * 2 + 1)
+#define PCH_ADD_816(a, b) ((a) + (b) + 816)
+typedef int pch_int_816;
+int pch_function_816(pch_int_816 a, int b);
+#define PCH_VALUE_817 (817 * 2 + 1)
+#define PCH_ADD_817(a, b) ((a) + (b) + 817)
+typedef int pch_int_817;
+int pch_function_817(pch_int_817 a, int b);
+#define PCH_VALUE_818 (818 * 2 + 1)
+#define PCH_ADD_818(a, b) ((a) + (b) + 818)
+typedef int pch_int_818;
+int pch_function_818(pch_int_818 a, int b);
+#define PCH_VALUE_819 (819 * 2 + 1)
+#define PCH_ADD_819(a, b) ((a) + (b) + 819)
+typedef int pch_int_819;
+int pch_function_819(pch_int_819 a, int b);
+#define PCH_VALUE_820 (820 * 2 + 1)
+#define PCH_ADD_820(a, b) ((a) + (b) + 820)
+typedef int pch_int_820;
+int pch_function_820(pch_int_820 a, int b);
+#define PCH_VALUE_821 (821 * 2 + 1)
+#define PCH_ADD_821(a, b) ((a) + (b) + 821)
+typedef int pch_int_821;
+int pch_function_821(pch_int_821 a, int b);
+#define PCH_VALUE_822 (822 * 2 + 1)
+#define PCH_ADD_822(a, b) ((a) + (b) + 822)
+typedef int pch_int_822;
+int pch_function_822(pch_int_822 a, int b);
+#define PCH_VALUE_823 (823 * 2 + 1)
+#define PCH_ADD_823(a, b) ((a) + (b) + 823)
+typedef int pch_int_823;
+int pch_function_823(pch_int_823 a, int b);
+#define PCH_VALUE_824 (824 * 2 + 1)
+#define PCH_ADD_824(a, b) ((a) + (b) + 824)
+typedef int pch_int_824;
+int pch_function_824(pch_int_824 a, int b);
+#define PCH_VALUE_825 (825 * 2 + 1)
+#define PCH_ADD_825(a, b) ((a) + (b) + 825)
+typedef int pch_int_825;
+int pch_function_825(pch_int_825 a, int b);
+#define PCH_VALUE_826 (826 * 2 + 1)
+#define PCH_ADD_826(a, b) ((a) + (b) + 826)
+typedef int pch_int_826;
+int pch_function_826(pch_int_826 a, int b);
+#define PCH_VALUE_827 (827 * 2 + 1)
+#define PCH_ADD_827(a, b) ((a) + (b) + 827)
+typedef int pch_int_827;
+int pch_function_827(pch_int_827 a, int b);
+#define PCH_VALUE_828 (828 * 2 + 1)
+#define PCH_ADD_828(a, b) ((a) + (b) + 828)
+typedef int pch_int_828;
+int pch_function_828(pch_int_828 a, int b);
+#define PCH_VALUE_829 (829 * 2 + 1)
+#define PCH_ADD_829(a, b) ((a) + (b) + 829)
+typedef int pch_int_829;
+int pch_function_829(pch_int_829 a, int b);
+#define PCH_VALUE_830 (830 * 2 + 1)
+#define PCH_ADD_830(a, b) ((a) + (b) + 830)
+typedef int pch_int_830;
+int pch_function_830(pch_int_830 a, int b);
+#define PCH_VALUE_831 (831 * 2 + 1)
+#define PCH_ADD_831(a, b) ((a) + (b) + 831)
+typedef int pch_int_831;
+int pch_function_831(pch_int_831 a, int b);
+#define PCH_VALUE_832 (832 * 2 + 1)
+#define PCH_ADD_832(a, b) ((a) + (b) + 832)
+typedef int pch_int_832;
+int pch_function_832(pch_int_832 a, int b);
+#define PCH_VALUE_833 (833 * 2 + 1)
+#define PCH_ADD_833(a, b) ((a) + (b) + 833)
+typedef int pch_int_833;
+int pch_function_833(pch_int_833 a, int b);
+#define PCH_VALUE_834 (834 * 2 + 1)
+#define PCH_ADD_834(a, b) ((a) + (b) + 834)
+typedef int pch_int_834;
+int pch_function_834(pch_int_834 a, int b);
+#define PCH_VALUE_835 (835 * 2 + 1)
+#define PCH_ADD_835(a, b) ((a) + (b) + 835)
+typedef int pch_int_835;
+int pch_function_835(pch_int_835 a, int b);
+#define PCH_VALUE_836 (836 * 2 + 1)
+#define PCH_ADD_836(a, b) ((a) + (b) + 836)
+typedef int pch_int_836;
+int pch_function_836(pch_int_836 a, int b);
+#define PCH_VALUE_837 (837 * 2 + 1)
+#define PCH_ADD_837(a, b) ((a) + (b) + 837)
+typedef int pch_int_837;
+int pch_function_837(pch_int_837 a, int b);
+#define PCH_VALUE_838 (838 * 2 + 1)
+#define PCH_ADD_838(a, b) ((a) + (b) + 838)
+typedef int pch_int_838;
+int pch_function_838(pch_int_838 a, int b);
+#define PCH_VALUE_839 (839 * 2 + 1)
+#define PCH_ADD_839(a, b) ((a) + (b) + 839)
+typedef int pch_int_839;
+int pch_function_839(pch_int_839 a, int b);
+#define PCH_VALUE_840 (840 * 2 + 1)
+#define PCH_ADD_840(a, b) ((a) + (b) + 840)
+typedef int pch_int_840;
+int pch_function_840(pch_int_840 a, int b);
+#define PCH_VALUE_841 (841 * 2 + 1)
+#define PCH_ADD_841(a, b) ((a) + (b) + 841)
+typedef int pch_int_841;
+int pch_function_841(pch_int_841 a, int b);
+#define PCH_VALUE_842 (842 * 2 + 1)
+#define PCH_ADD_842(a, b) ((a) + (b) + 842)
+typedef int pch_int_842;
+int pch_function_842(pch_int_842 a, int b);
+#define PCH_VALUE_843 (843 * 2 + 1)
+#define PCH_ADD_843(a, b) ((a) + (b) + 843)
+typedef int pch_int_843;
+int pch_function_843(pch_int_843 a, int b);
+#define PCH_VALUE_844 (844 * 2 + 1)
+#define PCH_ADD_844(a, b) ((a) + (b) + 844)
+typedef int pch_int_844;
+int pch_function_844(pch_int_844 a, int b);
+#define PCH_VALUE_845 (845 * 2 + 1)
+#define PCH_ADD_845(a, b) ((a) + (b) + 845)
+typedef int pch_int_845;
+int pch_function_845(pch_int_845 a, int b);
+#define PCH_VALUE_846 (846 * 2 + 1)
+#define PCH_ADD_846(a, b) ((a) + (b) + 846)
+typedef int pch_int_846;
+int pch_function_846(pch_int_846 a, int b);
+#define PCH_VALUE_847 (847 * 2 + 1)
+#define PCH_ADD_847(a, b) ((a) + (b) + 847)
+typedef int pch_int_847;
+int pch_function_847(pch_int_847 a, int b);
+#define PCH_VALUE_848 (848 * 2 + 1)
+#define PCH_ADD_848(a, b) ((a) + (b) + 848)
+typedef int pch_int_848;
+int pch_function_848(pch_int_848 a, int b);
+#define PCH_VALUE_849 (849 * 2 + 1)
+#define PCH_ADD_849(a, b) ((a) + (b) + 849)
+typedef int pch_int_849;
+int pch_function_849(pch_int_849 a, int b);
+#define PCH_VALUE_850 (850 * 2 + 1)
+#define PCH_ADD_850(a, b) ((a) + (b) + 850)
+typedef int pch_int_850;
+int pch_function_850(pch_int_850 a, int b);
+#define PCH_VALUE_851 (851 * 2 + 1)
+#define PCH_ADD_851(a, b) ((a) + (b) + 851)
+typedef int pch_int_851;
+int pch_function_851(pch_int_851 a, int b);
+#define PCH_VALUE_852 (852 * 2 + 1)
+#define PCH_ADD_852(a, b) ((a) + (b) + 852)
+typedef int pch_int_852;
+int pch_function_852(pch_int_852 a, int b);
+#define PCH_VALUE_853 (853 * 2 + 1)
+#define PCH_ADD_853(a, b) ((a) + (b) + 853)
+typedef int pch_int_853;
+int pch_function_853(pch_int_853 a, int b);
+#define PCH_VALUE_854 (854 * 2 + 1)
+#define PCH_ADD_854(a, b) ((a) + (b) + 854)
+typedef int pch_int_854;
+int pch_function_854(pch_int_854 a, int b);
+#define PCH_VALUE_855 (855 * 2 + 1)
+#define PCH_ADD_855(a, b) ((a) + (b) + 855)
+typedef int pch_int_855;
+int pch_function_855(pch_int_855 a, int b);
+#define PCH_VALUE_856 (856 * 2 + 1)
+#define PCH_ADD_856(a, b) ((a) + (b) + 856)
+typedef int pch_int_856;
+int pch_function_856(pch_int_856 a, int b);
+#define PCH_VALUE_857 (857 * 2 + 1)
+#define PCH_ADD_857(a, b) ((a) + (b) + 857)
+typedef int pch_int_857;
+int pch_function_857(pch_int_857 a, int b);
+#define PCH_VALUE_858 (858 * 2 + 1)
+#define PCH_ADD_858(a, b) ((a) + (b) + 858)
+typedef int pch_int_858;
+int pch_function_858(pch_int_858 a, int b);
+#define PCH_VALUE_859 (859 * 2 + 1)
+#define PCH_ADD_859(a, b) ((a) + (b) + 859)
+typedef int pch_int_859;
+int pch_function_859(pch_int_859 a, int b);
+#define PCH_VALUE_860 (860 * 2 + 1)
+#define PCH_ADD_860(a, b) ((a) + (b) + 860)
+typedef int pch_int_860;
+int pch_function_860(pch_int_860 a, int b);
+#define PCH_VALUE_861 (861 * 2 + 1)
+#define PCH_ADD_861(a, b) ((a) + (b) + 861)
+typedef int pch_int_861;
+int pch_function_861(pch_int_861 a, int b);
+#define PCH_VALUE_862 (862 * 2 + 1)
+#define PCH_ADD_862(a, b) ((a) + (b) + 862)
+typedef int pch_int_862;
+int pch_function_862(pch_int_862 a, int b);
+#define PCH_VALUE_863 (863 * 2 + 1)
+#define PCH_ADD_863(a, b) ((a) + (b) + 863)
+typedef int pch_int_863;
+int pch_function_863(pch_int_863 a, int b);
+#define PCH_VALUE_864 (864 * 2 + 1)
+#define PCH_ADD_864(a, b) ((a) + (b) + 864)
+typedef int pch_int_864;
+int pch_function_864(pch_int_864 a, int b);
+#define PCH_VALUE_865 (865 * 2 + 1)
+#define PCH_ADD_865(a, b) ((a) + (b) + 865)
+typedef int pch_int_865;
+int pch_function_865(pch_int_865 a, int b);
+#define PCH_VALUE_866 (866 * 2 + 1)
+#define PCH_ADD_866(a, b) ((a) + (b) + 866)
+typedef int pch_int_866;
+int pch_function_866(pch_int_866 a, int b);
+#define PCH_VALUE_867 (867 * 2 + 1)
+#define PCH_ADD_867(a, b) ((a) + (b) + 867)
+typedef int pch_int_867;
+int pch_function_867(pch_int_867 a, int b);
+#define PCH_VALUE_868 (868 * 2 + 1)
+#define PCH_ADD_868(a, b) ((a) + (b) + 868)
+typedef int pch_int_868;
+int pch_function_868(pch_int_868 a, int b);
+#define PCH_VALUE_869 (869 * 2 + 1)
+#define PCH_ADD_869(a, b) ((a) + (b) + 869)
+typedef int pch_int_869;
+int pch_function_869(pch_int_869 a, int b);
+#define PCH_VALUE_870 (870 * 2 + 1)
+#define PCH_ADD_870(a, b) ((a) + (b) + 870)
+typedef int pch_int_870;
+int pch_function_870(pch_int_870 a, int b);
+#define PCH_VALUE_871 (871 * 2 + 1)
+#define PCH_ADD_871(a, b) ((a) + (b) + 871)
+typedef int pch_int_871;
+int pch_function_871(pch_int_871 a, int b);
+#define PCH_VALUE_872 (872 * 2 + 1)
+#define PCH_ADD_872(a, b) ((a) + (b) + 872)
+typedef int pch_int_872;
+int pch_function_872(pch_int_872 a, int b);
+#define PCH_VALUE_873 (873 * 2 + 1)
+#define PCH_ADD_873(a, b) ((a) + (b) + 873)
+typedef int pch_int_873;
+int pch_function_873(pch_int_873 a, int b);
+#define PCH_VALUE_874 (874 * 2 + 1)
+#define PCH_ADD_874(a, b) ((a) + (b) + 874)
+typedef int pch_int_874;
+int pch_function_874(pch_int_874 a, int b);
+#define PCH_VALUE_875 (875 * 2 + 1)
+#define PCH_ADD_875(a, b) ((a) + (b) + 875)
+typedef int pch_int_875;
+int pch_function_875(pch_int_875 a, int b);
+#define PCH_VALUE_876 (876 * 2 + 1)
+#define PCH_ADD_876(a, b) ((a) + (b) + 876)
+typedef int pch_int_876;
+int pch_function_876(pch_int_876 a, int b);
+#define PCH_VALUE_877 (877 * 2 + 1)
+#define PCH_ADD_877(a, b) ((a) + (b) + 877)
+typedef int pch_int_877;
+int pch_function_877(pch_int_877 a, int b);
+#define PCH_VALUE_878 (878 * 2 + 1)
+#define PCH_ADD_878(a, b) ((a) + (b) + 878)
+typedef int pch_int_878;
+int pch_function_878(pch_int_878 a, int b);
+#define PCH_VALUE_879 (879 * 2 + 1)
+#define PCH_ADD_879(a, b) ((a) + (b) + 879)
+typedef int pch_int_879;
+int pch_function_879(pch_int_879 a, int b);
+#define PCH_VALUE_880 (880 * 2 + 1)
+#define PCH_ADD_880(a, b) ((a) + (b) + 880)
+typedef int pch_int_880;
+int pch_function_880(pch_int_880 a, int b);
+#define PCH_VALUE_881 (881 * 2 + 1)
+#define PCH_ADD_881(a, b) ((a) + (b) + 881)
+typedef int pch_int_881;
+int pch_function_881(pch_int_881 a, int b);
+#define PCH_VALUE_882 (882 * 2 + 1)
+#define PCH_ADD_882(a, b) ((a) + (b) + 882)
+typedef int pch_int_882;
+int pch_function_882(pch_int_882 a, int b);
+#define PCH_VALUE_883 (883 * 2 + 1)
+#define PCH_ADD_883(a, b) ((a) + (b) + 883)
+typedef int pch_int_883;
+int pch_function_883(pch_int_883 a, int b);
+#define PCH_VALUE_884 (884 * 2 + 1)
+#define PCH_ADD_884(a, b) ((a) + (b) + 884)
+typedef int pch_int_884;
+int pch_function_884(pch_int_884 a, int b);
+#define PCH_VALUE_885 (885 * 2 + 1)
+#define PCH_ADD_885(a, b) ((a) + (b) + 885)
+typedef int pch_int_885;
+int pch_function_885(pch_int_885 a, int b);
+#define PCH_VALUE_886 (886 * 2 + 1)
+#define PCH_ADD_886(a, b) ((a) + (b) + 886)
+typedef int pch_int_886;
+int pch_function_886(pch_int_886 a, int b);
+#define PCH_VALUE_887 (887 * 2 + 1)
+#define PCH_ADD_887(a, b) ((a) + (b) + 887)
+typedef int pch_int_887;
+int pch_function_887(pch_int_887 a, int b);
+#define PCH_VALUE_888 (888 * 2 + 1)
+#define PCH_ADD_888(a, b) ((a) + (b) + 888)
+typedef int pch_int_888;
+int pch_function_888(pch_int_888 a, int b);
+#define PCH_VALUE_889 (889 * 2 + 1)
+#define PCH_ADD_889(a, b) ((a) + (b) + 889)
+typedef int pch_int_889;
+int pch_function_889(pch_int_889 a, int b);
+#define PCH_VALUE_890 (890 * 2 + 1)
+#define PCH_ADD_890(a, b) ((a) + (b) + 890)
+typedef int pch_int_890;
+int pch_function_890(pch_int_890 a, int b);
+#define PCH_VALUE_891 (891 * 2 + 1)
+#define PCH_ADD_891(a, b) ((a) + (b) + 891)
+typedef int pch_int_891;
+int pch_function_891(pch_int_891 a, int b);
+#define PCH_VALUE_892 (892 * 2 + 1)
+#define PCH_ADD_892(a, b) ((a) + (b) + 892)
+typedef int pch_int_892;
+int pch_function_892(pch_int_892 a, int b);
+#define PCH_VALUE_893 (893 * 2 + 1)
+#define PCH_ADD_893(a, b) ((a) + (b) + 893)
+typedef int pch_int_893;
+int pch_function_893(pch_int_893 a, int b);
+#define PCH_VALUE_894 (894 * 2 + 1)
+#define PCH_ADD_894(a, b) ((a) + (b) + 894)
+typedef int pch_int_894;
+int pch_function_894(pch_int_894 a, int b);
+#define PCH_VALUE_895 (895 * 2 + 1)
+#define PCH_ADD_895(a, b) ((a) + (b) + 895)
+typedef int pch_int_895;
+int pch_function_895(pch_int_895 a, int b);
+#define PCH_VALUE_896 (896 * 2 + 1)
+#define PCH_ADD_896(a, b) ((a) + (b) + 896)
+typedef int pch_int_896;
+int pch_function_896(pch_int_896 a, int b);
+#define PCH_VALUE_897 (897 * 2 + 1)
+#define PCH_ADD_897(a, b) ((a) + (b) + 897)
+typedef int pch_int_897;
+int pch_function_897(pch_int_897 a, int b);
+#define PCH_VALUE_898 (898 * 2 + 1)
+#define PCH_ADD_898(a, b) ((a) + (b) + 898)
+typedef int pch_int_898;
+int pch_function_898(pch_int_898 a, int b);
+#define PCH_VALUE_899 (899 * 2 + 1)
+#define PCH_ADD_899(a, b) ((a) + (b) + 899)
+typedef int pch_int_899;
+int pch_function_899(pch_int_899 a, int b);
+#define PCH_VALUE_900 (900 * 2 + 1)
+#define PCH_ADD_900(a, b) ((a) + (b) + 900)
+typedef int pch_int_900;
+int pch_function_900(pch_int_900 a, int b);
+#define PCH_VALUE_901 (901 * 2 + 1)
+#define PCH_ADD_901(a, b) ((a) + (b) + 901)
+typedef int pch_int_901;
+int pch_function_901(pch_int_901 a, int b);
+#define PCH_VALUE_902 (902 * 2 + 1)
+#define PCH_ADD_902(a, b) ((a) + (b) + 902)
+typedef int pch_int_902;
+int pch_function_902(pch_int_902 a, int b);
+#define PCH_VALUE_903 (903 * 2 + 1)
+#define PCH_ADD_903(a, b) ((a) + (b) + 903)
+typedef int pch_int_903;
+int pch_function_903(pch_int_903 a, int b);
+#define PCH_VALUE_904 (904 * 2 + 1)
+#define PCH_ADD_904(a, b) ((a) + (b) + 904)
+typedef int pch_int_904;
+int pch_function_904(pch_int_904 a, int b);
+#define PCH_VALUE_905 (905 * 2 + 1)
+#define PCH_ADD_905(a, b) ((a) + (b) + 905)
+typedef int pch_int_905;
+int pch_function_905(pch_int_905 a, int b);
+#define PCH_VALUE_906 (906 * 2 + 1)
+#define PCH_ADD_906(a, b) ((a) + (b) + 906)
+typedef int pch_int_906;
+int pch_function_906(pch_int_906 a, int b);
+#define PCH_VALUE_907 (907 * 2 + 1)
+#define PCH_ADD_907(a, b) ((a) + (b) + 907)
+typedef int pch_int_907;
+int pch_function_907(pch_int_907 a, int b);
+#define PCH_VALUE_908 (908 * 2 + 1)
+#define PCH_ADD_908(a, b) ((a) + (b) + 908)
+typedef int pch_int_908;
+int pch_function_908(pch_int_908 a, int b);
+#define PCH_VALUE_909 (909 * 2 + 1)
+#define PCH_ADD_909(a, b) ((a) + (b) + 909)
+typedef int pch_int_909;
+int pch_function_909(pch_int_909 a, int b);
+#define PCH_VALUE_910 (910 * 2 + 1)
+#define PCH_ADD_910(a, b) ((a) + (b) + 910)
+typedef int pch_int_910;
+int pch_function_910(pch_int_910 a, int b);
+#define PCH_VALUE_911 (911 * 2 + 1)
+#define PCH_ADD_911(a, b) ((a) + (b) + 911)
+typedef int pch_int_911;
+int pch_function_911(pch_int_911 a, int b);
+#define PCH_VALUE_912 (912 * 2 + 1)
+#define PCH_ADD_912(a, b) ((a) + (b) + 912)
+typedef int pch_int_912;
+int pch_function_912(pch_int_912 a, int b);
+#define PCH_VALUE_913 (913 * 2 + 1)
+#define PCH_ADD_913(a, b) ((a) + (b) + 913)
+typedef int pch_int_913;
+int pch_function_913(pch_int_913 a, int b);
+#define PCH_VALUE_914 (914 * 2 + 1)
+#define PCH_ADD_914(a, b) ((a) + (b) + 914)
+typedef int pch_int_914;
+int pch_function_914(pch_int_914 a, int b);
+#define PCH_VALUE_915 (915 * 2 + 1)
+#define PCH_ADD_915(a, b) ((a) + (b) + 915)
+typedef int pch_int_915;
+int pch_function_915(pch_int_915 a, int b);
+#define PCH_VALUE_916 (916 * 2 + 1)
+#define PCH_ADD_916(a, b) ((a) + (b) + 916)
+typedef int pch_int_916;
+int pch_function_916(pch_int_916 a, int b);
+#define PCH_VALUE_917 (917 * 2 + 1)
+#define PCH_ADD_917(a, b) ((a) + (b) + 917)
+typedef int pch_int_917;
+int pch_function_917(pch_int_917 a, int b);
+#define PCH_VALUE_918 (918 * 2 + 1)
+#define PCH_ADD_918(a, b) ((a) + (b) + 918)
+typedef int pch_int_918;
+int pch_function_918(pch_int_918 a, int b);
+#define PCH_VALUE_919 (919 * 2 + 1)
+#define PCH_ADD_919(a, b) ((a) + (b) + 919)
+typedef int pch_int_919;
+int pch_function_919(pch_int_919 a, int b);
+#define PCH_VALUE_920 (920 * 2 + 1)
+#define PCH_ADD_920(a, b) ((a) + (b) + 920)
+typedef int pch_int_920;
+int pch_function_920(pch_int_920 a, int b);
+#define PCH_VALUE_921 (921 * 2 + 1)
+#define PCH_ADD_921(a, b) ((a) + (b) + 921)
+typedef int pch_int_921;
+int pch_function_921(pch_int_921 a, int b);
+#define PCH_VALUE_922 (922 * 2 + 1)
+#define PCH_ADD_922(a, b) ((a) + (b) + 922)
+typedef int pch_int_922;
+int pch_function_922(pch_int_922 a, int b);
+#define PCH_VALUE_923 (923 * 2 + 1)
+#define PCH_ADD_923(a, b) ((a) + (b) + 923)
+typedef int pch_int_923;
+int pch_function_923(pch_int_923 a, int b);
+#define PCH_VALUE_924 (924 * 2 + 1)
+#define PCH_ADD_924(a, b) ((a) + (b) + 924)
+typedef int pch_int_924;
+int pch_function_924(pch_int_924 a, int b);
+#define PCH_VALUE_925 (925 * 2 + 1)
+#define PCH_ADD_925(a, b) ((a) + (b) + 925)
+typedef int pch_int_925;
+int pch_function_925(pch_int_925 a, int b);
+#define PCH_VALUE_926 (926 * 2 + 1)
+#define PCH_ADD_926(a, b) ((a) + (b) + 926)
+typedef int pch_int_926;
+int pch_function_926(pch_int_926 a, int b);
+#define PCH_VALUE_927 (927 * 2 + 1)
+#define PCH_ADD_927(a, b) ((a) + (b) + 927)
+typedef int pch_int_927;
+int pch_function_927(pch_int_927 a, int b);
+#define PCH_VALUE_928 (928 * 2 + 1)
+#define PCH_ADD_928(a, b) ((a) + (b) + 928)
+typedef int pch_int_928;
+int pch_function_928(pch_int_928 a, int b);
+#define PCH_VALUE_929 (929 * 2 + 1)
+#define PCH_ADD_929(a, b) ((a) + (b) + 929)
+typedef int pch_int_929;
+int pch_function_929(pch_int_929 a, int b);
+#define PCH_VALUE_930 (930 * 2 + 1)
+#define PCH_ADD_930(a, b) ((a) + (b) + 930)
+typedef int pch_int_930;
+int pch_function_930(pch_int_930 a, int b);
+#define PCH_VALUE_931 (931 * 2 + 1)
+#define PCH_ADD_931(a, b) ((a) + (b) + 931)
+typedef int pch_int_931;
+int pch_function_931(pch_int_931 a, int b);
+#define PCH_VALUE_932 (932 * 2 + 1)
+#define PCH_ADD_932(a, b) ((a) + (b) + 932)
+typedef int pch_int_932;
+int pch_function_932(pch_int_932 a, int b);
+#define PCH_VALUE_933 (933 * 2 + 1)
+#define PCH_ADD_933(a, b) ((a) + (b) + 933)
+typedef int pch_int_933;
+int pch_function_933(pch_int_933 a, int b);
+#define PCH_VALUE_934 (934 * 2 + 1)
+#define PCH_ADD_934(a, b) ((a) + (b) + 934)
+typedef int pch_int_934;
+int pch_function_934(pch_int_934 a, int b);
+#define PCH_VALUE_935 (935 * 2 + 1)
+#define PCH_ADD_935(a, b) ((a) + (b) + 935)
+typedef int pch_int_935;
+int pch_function_935(pch_int_935 a, int b);
+#define PCH_VALUE_936 (936 * 2 + 1)
+#define PCH_ADD_936(a, b) ((a) + (b) + 936)
+typedef int pch_int_936;
+int pch_function_936(pch_int_936 a, int b);
+#define PCH_VALUE_937 (937 * 2 + 1)
+#define PCH_ADD_937(a, b) ((a) + (b) + 937)
+typedef int pch_int_937;
+int pch_function_937(pch_int_937 a, int b);
+#define PCH_VALUE_938 (938 * 2 + 1)
+#define PCH_ADD_938(a, b) ((a) + (b) + 938)
+typedef int pch_int_938;
+int pch_function_938(pch_int_938 a, int b);
+#define PCH_VALUE_939 (939 * 2 + 1)
+#define PCH_ADD_939(a, b) ((a) + (b) + 939)
+typedef int pch_int_939;
+int pch_function_939(pch_int_939 a, int b);
+#define PCH_VALUE_940 (940 * 2 + 1)
+#define PCH_ADD_940(a, b) ((a) + (b) + 940)
+typedef int pch_int_940;
+int pch_function_940(pch_int_940 a, int b);
+#define PCH_VALUE_941 (941 * 2 + 1)
+#define PCH_ADD_941(a, b) ((a) + (b) + 941)
+typedef int pch_int_941;
+int pch_function_941(pch_int_941 a, int b);
+#define PCH_VALUE_942 (942 * 2 + 1)
+#define PCH_ADD_942(a, b) ((a) + (b) + 942)
+typedef int pch_int_942;
+int pch_function_942(pch_int_942 a, int b);
+#define PCH_VALUE_943 (943 * 2 + 1)
+#define PCH_ADD_943(a, b) ((a) + (b) + 943)
+typedef int pch_int_943;
+int pch_function_943(pch_int_943 a, int b);
+#define PCH_VALUE_944 (944 * 2 + 1)
+#define PCH_ADD_944(a, b) ((a) + (b) + 944)
+typedef int pch_int_944;
+int pch_function_944(pch_int_944 a, int b);
+#define PCH_VALUE_945 (945 * 2 + 1)
+#define PCH_ADD_945(a, b) ((a) + (b) + 945)
+typedef int pch_int_945;
+int pch_function_945(pch_int_945 a, int b);
+#define PCH_VALUE_946 (946 * 2 + 1)
+#define PCH_ADD_946(a, b) ((a) + (b) + 946)
+typedef int pch_int_946;
+int pch_function_946(pch_int_946 a, int b);
+#define PCH_VALUE_947 (947 * 2 + 1)
+#define PCH_ADD_947(a, b) ((a) + (b) + 947)
+typedef int pch_int_947;
+int pch_function_947(pch_int_947 a, int b);
+#define PCH_VALUE_948 (948 * 2 + 1)
+#define PCH_ADD_948(a, b) ((a) + (b) + 948)
+typedef int pch_int_948;
+int pch_function_948(pch_int_948 a, int b);
+#define PCH_VALUE_949 (949 * 2 + 1)
+#define PCH_ADD_949(a, b) ((a) + (b) + 949)
+typedef int pch_int_949;
+int pch_function_949(pch_int_949 a, int b);
+#define PCH_VALUE_950 (950 * 2 + 1)
+#define PCH_ADD_950(a, b) ((a) + (b) + 950)
+typedef int pch_int_950;
+int pch_function_950(pch_int_950 a, int b);
+#define PCH_VALUE_951 (951 * 2 + 1)
+#define PCH_ADD_951(a, b) ((a) + (b) + 951)
+typedef int pch_int_951;
+int pch_function_951(pch_int_951 a, int b);
+#define PCH_VALUE_952 (952 * 2 + 1)
+#define PCH_ADD_952(a, b) ((a) + (b) + 952)
+typedef int pch_int_952;
+int pch_function_952(pch_int_952 a, int b);
+#define PCH_VALUE_953 (953 * 2 + 1)
+#define PCH_ADD_953(a, b) ((a) + (b) + 953)
+typedef int pch_int_953;
+int pch_function_953(pch_int_953 a, int b);
+#define PCH_VALUE_954 (954 * 2 + 1)
+#define PCH_ADD_954(a, b) ((a) + (b) + 954)
+typedef int pch_int_954;
+int pch_function_954(pch_int_954 a, int b);
+#define PCH_VALUE_955 (955 * 2 + 1)
+#define PCH_ADD_955(a, b) ((a) + (b) + 955)
+typedef int pch_int_955;
+int pch_function_955(pch_int_955 a, int b);
+#define PCH_VALUE_956 (956 * 2 + 1)
+#define PCH_ADD_956(a, b) ((a) + (b) + 956)
+typedef int pch_int_956;
+int pch_function_956(pch_int_956 a, int b);
+#define PCH_VALUE_957 (957 * 2 + 1)
+#define PCH_ADD_957(a, b) ((a) + (b) + 957)
+typedef int pch_int_957;
+int pch_function_957(pch_int_957 a, int b);
+#define PCH_VALUE_958 (958 * 2 + 1)
+#define PCH_ADD_958(a, b) ((a) + (b) + 958)
+typedef int pch_int_958;
+int pch_function_958(pch_int_958 a, int b);
+#define PCH_VALUE_959 (959 * 2 + 1)
+#define PCH_ADD_959(a, b) ((a) + (b) + 959)
+typedef int pch_int_959;
+int pch_function_959(pch_int_959 a, int b);
+#define PCH_VALUE_960 (960 * 2 + 1)
+#define PCH_ADD_960(a, b) ((a) + (b) + 960)
+typedef int pch_int_960;
+int pch_function_960(pch_int_960 a, int b);
+#define PCH_VALUE_961 (961 * 2 + 1)
+#define PCH_ADD_961(a, b) ((a) + (b) + 961)
+typedef int pch_int_961;
+int pch_function_961(pch_int_961 a, int b);
+#define PCH_VALUE_962 (962 * 2 + 1)
+#define PCH_ADD_962(a, b) ((a) + (b) + 962)
+typedef int pch_int_962;
+int pch_function_962(pch_int_962 a, int b);
+#define PCH_VALUE_963 (963 * 2 + 1)
+#define PCH_ADD_963(a, b) ((a) + (b) + 963)
+typedef int pch_int_963;
+int pch_function_963(pch_int_963 a, int b);
+#define PCH_VALUE_964 (964 * 2 + 1)
+#define PCH_ADD_964(a, b) ((a) + (b) + 964)
+typedef int pch_int_964;
+int pch_function_964(pch_int_964 a, int b);
+#define PCH_VALUE_965 (965 * 2 + 1)
+#define PCH_ADD_965(a, b) ((a) + (b) + 965)
+typedef int pch_int_965;
+int pch_function_965(pch_int_965 a, int b);
+#define PCH_VALUE_966 (966 * 2 + 1)
+#define PCH_ADD_966(a, b) ((a) + (b) + 966)
+typedef int pch_int_966;
+int pch_function_966(pch_int_966 a, int b);
+#define PCH_VALUE_967 (967 * 2 + 1)
+#define PCH_ADD_967(a, b) ((a) + (b) + 967)
+typedef int pch_int_967;
+int pch_function_967(pch_int_967 a, int b);
+#define PCH_VALUE_968 (968 * 2 + 1)
+#define PCH_ADD_968(a, b) ((a) + (b) + 968)
+typedef int pch_int_968;
+int pch_function_968(pch_int_968 a, int b);
+#define PCH_VALUE_969 (969 * 2 + 1)
+#define PCH_ADD_969(a, b) ((a) + (b) + 969)
+typedef int pch_int_969;
+int pch_function_969(pch_int_969 a, int b);
+#define PCH_VALUE_970 (970 * 2 + 1)
+#define PCH_ADD_970(a, b) ((a) + (b) + 970)
+typedef int pch_int_970;
+int pch_function_970(pch_int_970 a, int b);
+#define PCH_VALUE_971 (971 * 2 + 1)
+#define PCH_ADD_971(a, b) ((a) + (b) + 971)
+typedef int pch_int_971;
+int pch_function_971(pch_int_971 a, int b);
+#define PCH_VALUE_972 (972 * 2 + 1)
+#define PCH_ADD_972(a, b) ((a) + (b) + 972)
+typedef int pch_int_972;
+int pch_function_972(pch_int_972 a, int b);
+#define PCH_VALUE_973 (973 * 2 + 1)
+#define PCH_ADD_973(a, b) ((a) + (b) + 973)
+typedef int pch_int_973;
+int pch_function_973(pch_int_973 a, int b);
+#define PCH_VALUE_974 (974 * 2 + 1)
+#define PCH_ADD_974(a, b) ((a) + (b) + 974)
+typedef int pch_int_974;
+int pch_function_974(pch_int_974 a, int b);
+#define PCH_VALUE_975 (975 * 2 + 1)
+#define PCH_ADD_975(a, b) ((a) + (b) + 975)
+typedef int pch_int_975;
+int pch_function_975(pch_int_975 a, int b);
+#define PCH_VALUE_976 (976 * 2 + 1)
+#define PCH_ADD_976(a, b) ((a) + (b) + 976)
+typedef int pch_int_976;
+int pch_function_976(pch_int_976 a, int b);
+#define PCH_VALUE_977 (977 * 2 + 1)
+#define PCH_ADD_977(a, b) ((a) + (b) + 977)
+typedef int pch_int_977;
+int pch_function_977(pch_int_977 a, int b);
+#define PCH_VALUE_978 (978 * 2 + 1)
+#define PCH_ADD_978(a, b) ((a) + (b) + 978)
+typedef int pch_int_978;
+int pch_function_978(pch_int_978 a, int b);
+#define PCH_VALUE_979 (979 * 2 + 1)
+#define PCH_ADD_979(a, b) ((a) + (b) + 979)
+typedef int pch_int_979;
+int pch_function_979(pch_int_979 a, int b);
+#define PCH_VALUE_980 (980 * 2 + 1)
+#define PCH_ADD_980(a, b) ((a) + (b) + 980)
+typedef int pch_int_980;
+int pch_function_980(pch_int_980 a, int b);
+#define PCH_VALUE_981 (981 * 2 + 1)
+#define PCH_ADD_981(a, b) ((a) + (b) + 981)
+typedef int pch_int_981;
+int pch_function_981(pch_int_981 a, int b);
+#define PCH_VALUE_982 (982 * 2 + 1)
+#define PCH_ADD_982(a, b) ((a) + (b) + 982)
+typedef int pch_int_982;
+int pch_function_982(pch_int_982 a, int b);
+#define PCH_VALUE_983 (983 * 2 + 1)
+#define PCH_ADD_983(a, b) ((a) + (b) + 983)
+typedef int pch_int_983;
+int pch_function_983(pch_int_983 a, int b);
+#define PCH_VALUE_984 (984 * 2 + 1)
+#define PCH_ADD_984(a, b) ((a) + (b) + 984)
+typedef int pch_int_984;
+int pch_function_984(pch_int_984 a, int b);
+#define PCH_VALUE_985 (985 * 2 + 1)
+#define PCH_ADD_985(a, b) ((a) + (b) + 985)
+typedef int pch_int_985;
+int pch_function_985(pch_int_985 a, int b);
+#define PCH_VALUE_986 (986 * 2 + 1)
+#define PCH_ADD_986(a, b) ((a) + (b) + 986)
+typedef int pch_int_986;
+int pch_function_986(pch_int_986 a, int b);
+#define PCH_VALUE_987 (987 * 2 + 1)
+#define PCH_ADD_987(a, b) ((a) + (b) + 987)
+typedef int pch_int_987;
+int pch_function_987(pch_int_987 a, int b);
+#define PCH_VALUE_988 (988 * 2 + 1)
+#define PCH_ADD_988(a, b) ((a) + (b) + 988)
+typedef int pch_int_988;
+int pch_function_988(pch_int_988 a, int b);
+#define PCH_VALUE_989 (989 * 2 + 1)
+#define PCH_ADD_989(a, b) ((a) + (b) + 989)
+typedef int pch_int_989;
+int pch_function_989(pch_int_989 a, int b);
+#define PCH_VALUE_990 (990 * 2 + 1)
+#define PCH_ADD_990(a, b) ((a) + (b) + 990)
+typedef int pch_int_990;
+int pch_function_990(pch_int_990 a, int b);
+#define PCH_VALUE_991 (991 * 2 + 1)
+#define PCH_ADD_991(a, b) ((a) + (b) + 991)
+typedef int pch_int_991;
+int pch_function_991(pch_int_991 a, int b);
+#define PCH_VALUE_992 (992 * 2 + 1)
+#define PCH_ADD_992(a, b) ((a) + (b) + 992)
+typedef int pch_int_992;
+int pch_function_992(pch_int_992 a, int b);
+#define PCH_VALUE_993 (993 * 2 + 1)
+#define PCH_ADD_993(a, b) ((a) + (b) + 993)
+typedef int pch_int_993;
+int pch_function_993(pch_int_993 a, int b);
+#define PCH_VALUE_994 (994 * 2 + 1)
+#define PCH_ADD_994(a, b) ((a) + (b) + 994)
+typedef int pch_int_994;
+int pch_function_994(pch_int_994 a, int b);
+#define PCH_VALUE_995 (995 * 2 + 1)
+#define PCH_ADD_995(a, b) ((a) + (b) + 995)
+typedef int pch_int_995;
+int pch_function_995(pch_int_995 a, int b);
+#define PCH_VALUE_996 (996 * 2 + 1)
+#define PCH_ADD_996(a, b) ((a) + (b) + 996)
+typedef int pch_int_996;
+int pch_function_996(pch_int_996 a, int b);
+#define PCH_VALUE_997 (997 * 2 + 1)
+#define PCH_ADD_997(a, b) ((a) + (b) + 997)
+typedef int pch_int_997;
+int pch_function_997(pch_int_997 a, int b);
+#define PCH_VALUE_998 (998 * 2 + 1)
+#define PCH_ADD_998(a, b) ((a) + (b) + 998)
+typedef int pch_int_998;
+int pch_function_998(pch_int_998 a, int b);
+#define PCH_VALUE_999 (999 * 2 + 1)
+#define PCH_ADD_999(a, b) ((a) + (b) + 999)
+typedef int pch_int_999;
+int pch_function_999(pch_int_999 a, int b);
+#define PCH_VALUE_1000 (1000 * 2 + 1)
+#define PCH_ADD_1000(a, b) ((a) + (b) + 1000)
+typedef int pch_int_1000;
+int pch_function_1000(pch_int_1000 a, int b);
+#define PCH_VALUE_1001 (1001 * 2 + 1)
+#define PCH_ADD_1001(a, b) ((a) + (b) + 1001)
+typedef int pch_int_1001;
+int pch_function_1001(pch_int_1001 a, int b);
+#define PCH_VALUE_1002 (1002 * 2 + 1)
+#define PCH_ADD_1002(a, b) ((a) + (b) + 1002)
+typedef int pch_int_1002;
+int pch_function_1002(pch_int_1002 a, int b);
+#define PCH_VALUE_1003 (1003 * 2 + 1)
+#define PCH_ADD_1003(a, b) ((a) + (b) + 1003)
+typedef int pch_int_1003;
+int pch_function_1003(pch_int_1003 a, int b);
+#define PCH_VALUE_1004 (1004 * 2 + 1)
+#define PCH_ADD_1004(a, b) ((a) + (b) + 1004)
+typedef int pch_int_1004;
+int pch_function_1004(pch_int_1004 a, int b);
+#define PCH_VALUE_1005 (1005 * 2 + 1)
+#define PCH_ADD_1005(a, b) ((a) + (b) + 1005)
+typedef int pch_int_1005;
+int pch_function_1005(pch_int_1005 a, int b);
+#define PCH_VALUE_1006 (1006 * 2 + 1)
+#define PCH_ADD_1006(a, b) ((a) + (b) + 1006)
+typedef int pch_int_1006;
+int pch_function_1006(pch_int_1006 a, int b);
+#define PCH_VALUE_1007 (1007 * 2 + 1)
+#define PCH_ADD_1007(a, b) ((a) + (b) + 1007)
+typedef int pch_int_1007;
+int pch_function_1007(pch_int_1007 a, int b);
+#define PCH_VALUE_1008 (1008 * 2 + 1)
+#define PCH_ADD_1008(a, b) ((a) + (b) + 1008)
+typedef int pch_int_1008;
+int pch_function_1008(pch_int_1008 a, int b);
+#define PCH_VALUE_1009 (1009 * 2 + 1)
+#define PCH_ADD_1009(a, b) ((a) + (b) + 1009)
+typedef int pch_int_1009;
+int pch_function_1009(pch_int_1009 a, int b);
+#define PCH_VALUE_1010 (1010 * 2 + 1)
+#define PCH_ADD_1010(a, b) ((a) + (b) + 1010)
+typedef int pch_int_1010;
+int pch_function_1010(pch_int_1010 a, int b);
+#define PCH_VALUE_1011 (1011 * 2 + 1)
+#define PCH_ADD_1011(a, b) ((a) + (b) + 1011)
+typedef int pch_int_1011;
+int pch_function_1011(pch_int_1011 a, int b);
+#define PCH_VALUE_1012 (1012 * 2 + 1)
+#define PCH_ADD_1012(a, b) ((a) + (b) + 1012)
+typedef int pch_int_1012;
+int pch_function_1012(pch_int_1012 a, int b);
+#define PCH_VALUE_1013 (1013 * 2 + 1)
+#define PCH_ADD_1013(a, b) ((a) + (b) + 1013)
+typedef int pch_int_1013;
+int pch_function_1013(pch_int_1013 a, int b);
+#define PCH_VALUE_1014 (1014 * 2 + 1)
+#define PCH_ADD_1014(a, b) ((a) + (b) + 1014)
+typedef int pch_int_1014;
+int pch_function_1014(pch_int_1014 a, int b);
+#define PCH_VALUE_1015 (1015 * 2 + 1)
+#define PCH_ADD_1015(a, b) ((a) + (b) + 1015)
+typedef int pch_int_1015;
+int pch_function_1015(pch_int_1015 a, int b);
+#define PCH_VALUE_1016 (1016 * 2 + 1)
+#define PCH_ADD_1016(a, b) ((a) + (b) + 1016)
+typedef int pch_int_1016;
+int pch_function_1016(pch_int_1016 a, int b);
+#define PCH_VALUE_1017 (1017 * 2 + 1)
+#define PCH_ADD_1017(a, b) ((a) + (b) + 1017)
+typedef int pch_int_1017;
+int pch_function_1017(pch_int_1017 a, int b);
+#define PCH_VALUE_1018 (1018 * 2 + 1)
+#define PCH_ADD_1018(a, b) ((a) + (b) + 1018)
+typedef int pch_int_1018;
+int pch_function_1018(pch_int_1018 a, int b);
+#define PCH_VALUE_1019 (1019 * 2 + 1)
+#define PCH_ADD_1019(a, b) ((a) + (b) + 1019)
+typedef int pch_int_1019;
+int pch_function_1019(pch_int_1019 a, int b);
+#define PCH_VALUE_1020 (1020 * 2 + 1)
+#define PCH_ADD_1020(a, b) ((a) + (b) + 1020)
+typedef int pch_int_1020;
+int pch_function_1020(pch_int_1020 a, int b);
+#define PCH_VALUE_1021 (1021 * 2 + 1)
+#define PCH_ADD_1021(a, b) ((a) + (b) + 1021)
+typedef int pch_int_1021;
+int pch_function_1021(pch_int_1021 a, int b);
+#define PCH_VALUE_1022 (1022 * 2 + 1)
+#define PCH_ADD_1022(a, b) ((a) + (b) + 1022)
+typedef int pch_int_1022;
+int pch_function_1022(pch_int_1022 a, int b);
+#define PCH_VALUE_1023 (1023 * 2 + 1)
+#define PCH_ADD_1023(a, b) ((a) + (b) + 1023)
+typedef int pch_int_1023;
+int pch_function_1023(pch_int_1023 a, int b);
+#define PCH_VALUE_1024 (1024 * 2 + 1)
+#define PCH_ADD_1024(a, b) ((a) + (b) + 1024)
+typedef int pch_int_1024;
+int pch_function_1024(pch_int_1024 a, int b);
+#define PCH_VALUE_1025 (1025 * 2 + 1)
+#define PCH_ADD_1025(a, b) ((a) + (b) + 1025)
+typedef int pch_int_1025;
+int pch_function_1025(pch_int_1025 a, int b);
+#define PCH_VALUE_1026 (1026 * 2 + 1)
+#define PCH_ADD_1026(a, b) ((a) + (b) + 1026)
+typedef int pch_int_1026;
+int pch_function_1026(pch_int_1026 a, int b);
+#define PCH_VALUE_1027 (1027 * 2 + 1)
+#define PCH_ADD_1027(a, b) ((a) + (b) + 1027)
+typedef int pch_int_1027;
+int pch_function_1027(pch_int_1027 a, int b);
+#define PCH_VALUE_1028 (1028 * 2 + 1)
+#define PCH_ADD_1028(a, b) ((a) + (b) + 1028)
+typedef int pch_int_1028;
+int pch_function_1028(pch_int_1028 a, int b);
+#define PCH_VALUE_1029 (1029 * 2 + 1)
+#define PCH_ADD_1029(a, b) ((a) + (b) + 1029)
+typedef int pch_int_1029;
+int pch_function_1029(pch_int_1029 a, int b);
+#define PCH_VALUE_1030 (1030 * 2 + 1)
+#define PCH_ADD_1030(a, b) ((a) + (b) + 1030)
+typedef int pch_int_1030;
+int pch_function_1030(pch_int_1030 a, int b);
+#define PCH_VALUE_1031 (1031 * 2 + 1)
+#define PCH_ADD_1031(a, b) ((a) + (b) + 1031)
+typedef int pch_int_1031;
+int pch_function_1031(pch_int_1031 a, int b);
+#define PCH_VALUE_1032 (1032 * 2 + 1)
+#define PCH_ADD_1032(a, b) ((a) + (b) + 1032)
+typedef int pch_int_1032;
+int pch_function_1032(pch_int_1032 a, int b);
+#define PCH_VALUE_1033 (1033 * 2 + 1)
+#define PCH_ADD_1033(a, b) ((a) + (b) + 1033)
+typedef int pch_int_1033;
+int pch_function_1033(pch_int_1033 a, int b);
+#define PCH_VALUE_1034 (1034 * 2 + 1)
+#define PCH_ADD_1034(a, b) ((a) + (b) + 1034)
+typedef int pch_int_1034;
+int pch_function_1034(pch_int_1034 a, int b);
+#define PCH_VALUE_1035 (1035 * 2 + 1)
+#define PCH_ADD_1035(a, b) ((a) + (b) + 1035)
+typedef int pch_int_1035;
+int pch_function_1035(pch_int_1035 a, int b);
+#define PCH_VALUE_1036 (1036 * 2 + 1)
+#define PCH_ADD_1036(a, b) ((a) + (b) + 1036)
+typedef int pch_int_1036;
+int pch_function_1036(pch_int_1036 a, int b);
+#define PCH_VALUE_1037 (1037 * 2 + 1)
+#define PCH_ADD_1037(a, b) ((a) + (b) + 1037)
+typedef int pch_int_1037;
+int pch_function_1037(pch_int_1037 a, int b);
+#define PCH_VALUE_1038 (1038 * 2 + 1)
+#define PCH_ADD_1038(a, b) ((a) + (b) + 1038)
+typedef int pch_int_1038;
+int pch_function_1038(pch_int_1038 a, int b);
+#define PCH_VALUE_1039 (1039 * 2 + 1)
+#define PCH_ADD_1039(a, b) ((a) + (b) + 1039)
+typedef int pch_int_1039;
+int pch_function_1039(pch_int_1039 a, int b);
+#define PCH_VALUE_1040 (1040 * 2 + 1)
+#define PCH_ADD_1040(a, b) ((a) + (b) + 1040)
+typedef int pch_int_1040;
+int pch_function_1040(pch_int_1040 a, int b);
+#define PCH_VALUE_1041 (1041 * 2 + 1)
+#define PCH_ADD_1041(a, b) ((a) + (b) + 1041)
+typedef int pch_int_1041;
+int pch_function_1041(pch_int_1041 a, int b);
+#define PCH_VALUE_1042 (1042 * 2 + 1)
+#define PCH_ADD_1042(a, b) ((a) + (b) + 1042)
+typedef int pch_int_1042;
+int pch_function_1042(pch_int_1042 a, int b);
+#define PCH_VALUE_1043 (1043 * 2 + 1)
+#define PCH_ADD_1043(a, b) ((a) + (b) + 1043)
+typedef int pch_int_1043;
+int pch_function_1043(pch_int_1043 a, int b);
+#define PCH_VALUE_1044 (1044 * 2 + 1)
+#define PCH_ADD_1044(a, b) ((a) + (b) + 1044)
+typedef int pch_int_1044;
+int pch_function_1044(pch_int_1044 a, int b);
+#define PCH_VALUE_1045 (1045 * 2 + 1)
+#define PCH_ADD_1045(a, b) ((a) + (b) + 1045)
+typedef int pch_int_1045;
+int pch_function_1045(pch_int_1045 a, int b);
+#define PCH_VALUE_1046 (1046 * 2 + 1)
+#define PCH_ADD_1046(a, b) ((a) + (b) + 1046)
+typedef int pch_int_1046;
+int pch_function_1046(pch_int_1046 a, int b);
+#define PCH_VALUE_1047 (1047 * 2 + 1)
+#define PCH_ADD_1047(a, b) ((a) + (b) + 1047)
+typedef int pch_int_1047;
+int pch_function_1047(pch_int_1047 a, int b);
+#define PCH_VALUE_1048 (1048 * 2 + 1)
+#define PCH_ADD_1048(a, b) ((a) + (b) + 1048)
+typedef int pch_int_1048;
+int pch_function_1048(pch_int_1048 a, int b);
+#define PCH_VALUE_1049 (1049 * 2 + 1)
+#define PCH_ADD_1049(a, b) ((a) + (b) + 1049)
+typedef int pch_int_1049;
+int pch_function_1049(pch_int_1049 a, int b);
+#define PCH_VALUE_1050 (1050 * 2 + 1)
+#define PCH_ADD_1050(a, b) ((a) + (b) + 1050)
+typedef int pch_int_1050;
+int pch_function_1050(pch_int_1050 a, int b);
+#define PCH_VALUE_1051 (1051 * 2 + 1)
+#define PCH_ADD_1051(a, b) ((a) + (b) + 1051)
+typedef int pch_int_1051;
+int pch_function_1051(pch_int_1051 a, int b);
+#define PCH_VALUE_1052 (1052 * 2 + 1)
+#define PCH_ADD_1052(a, b) ((a) + (b) + 1052)
+typedef int pch_int_1052;
+int pch_function_1052(pch_int_1052 a, int b);
+#define PCH_VALUE_1053 (1053 * 2 + 1)
+#define PCH_ADD_1053(a, b) ((a) + (b) + 1053)
+typedef int pch_int_1053;
+int pch_function_1053(pch_int_1053 a, int b);
+#define PCH_VALUE_1054 (1054 * 2 + 1)
+#define PCH_ADD_1054(a, b) ((a) + (b) + 1054)
+typedef int pch_int_1054;
+int pch_function_1054(pch_int_1054 a, int b);
+#define PCH_VALUE_1055 (1055 * 2 + 1)
+#define PCH_ADD_1055(a, b) ((a) + (b) + 1055)
+typedef int pch_int_1055;
+int pch_function_1055(pch_int_1055 a, int b);
+#define PCH_VALUE_1056 (1056 * 2 + 1)
+#define PCH_ADD_1056(a, b) ((a) + (b) + 1056)
+typedef int pch_int_1056;
+int pch_function_1056(pch_int_1056 a, int b);
+#define PCH_VALUE_1057 (1057 * 2 + 1)
+#define PCH_ADD_1057(a, b) ((a) + (b) + 1057)
+typedef int pch_int_1057;
+int pch_function_1057(pch_int_1057 a, int b);
+#define PCH_VALUE_1058 (1058 * 2 + 1)
+#define PCH_ADD_1058(a, b) ((a) + (b) + 1058)
+typedef int pch_int_1058;
+int pch_function_1058(pch_int_1058 a, int b);
+#define PCH_VALUE_1059 (1059 * 2 + 1)
+#define PCH_ADD_1059(a, b) ((a) + (b) + 1059)
+typedef int pch_int_1059;
+int pch_function_1059(pch_int_1059 a, int b);
+#define PCH_VALUE_1060 (1060 * 2 + 1)
+#define PCH_ADD_1060(a, b) ((a) + (b) + 1060)
+typedef int pch_int_1060;
+int pch_function_1060(pch_int_1060 a, int b);
+#define PCH_VALUE_1061 (1061 * 2 + 1)
+#define PCH_ADD_1061(a, b) ((a) + (b) + 1061)
+typedef int pch_int_1061;
+int pch_function_1061(pch_int_1061 a, int b);
+#define PCH_VALUE_1062 (1062 * 2 + 1)
+#define PCH_ADD_1062(a, b) ((a) + (b) + 1062)
+typedef int pch_int_1062;
+int pch_function_1062(pch_int_1062 a, int b);
+#define PCH_VALUE_1063 (1063 * 2 + 1)
+#define PCH_ADD_1063(a, b) ((a) + (b) + 1063)
+typedef int pch_int_1063;
+int pch_function_1063(pch_int_1063 a, int b);
+#define PCH_VALUE_1064 (1064 * 2 + 1)
+#define PCH_ADD_1064(a, b) ((a) + (b) + 1064)
+typedef int pch_int_1064;
+int pch_function_1064(pch_int_1064 a, int b);
+#define PCH_VALUE_1065 (1065 * 2 + 1)
+#define PCH_ADD_1065(a, b) ((a) + (b) + 1065)
+typedef int pch_int_1065;
+int pch_function_1065(pch_int_1065 a, int b);
+#define PCH_VALUE_1066 (1066 * 2 + 1)
+#define PCH_ADD_1066(a, b) ((a) + (b) + 1066)
+typedef int pch_int_1066;
+int pch_function_1066(pch_int_1066 a, int b);
+#define PCH_VALUE_1067 (1067 * 2 + 1)
+#define PCH_ADD_1067(a, b) ((a) + (b) + 1067)
+typedef int pch_int_1067;
+int pch_function_1067(pch_int_1067 a, int b);
+#define PCH_VALUE_1068 (1068 * 2 + 1)
+#define PCH_ADD_1068(a, b) ((a) + (b) + 1068)
+typedef int pch_int_1068;
+int pch_function_1068(pch_int_1068 a, int b);
+#define PCH_VALUE_1069 (1069 * 2 + 1)
+#define PCH_ADD_1069(a, b) ((a) + (b) + 1069)
+typedef int pch_int_1069;
+int pch_function_1069(pch_int_1069 a, int b);
+#define PCH_VALUE_1070 (1070 * 2 + 1)
+#define PCH_ADD_1070(a, b) ((a) + (b) + 1070)
+typedef int pch_int_1070;
+int pch_function_1070(pch_int_1070 a, int b);
+#define PCH_VALUE_1071 (1071 * 2 + 1)
+#define PCH_ADD_1071(a, b) ((a) + (b) + 1071)
+typedef int pch_int_1071;
+int pch_function_1071(pch_int_1071 a, int b);
+#define PCH_VALUE_1072 (1072 * 2 + 1)
+#define PCH_ADD_1072(a, b) ((a) + (b) + 1072)
+typedef int pch_int_1072;
+int pch_function_1072(pch_int_1072 a, int b);
+#define PCH_VALUE_1073 (1073 * 2 + 1)
+#define PCH_ADD_1073(a, b) ((a) + (b) + 1073)
+typedef int pch_int_1073;
+int pch_function_1073(pch_int_1073 a, int b);
+#define PCH_VALUE_1074 (1074 * 2 + 1)
+#define PCH_ADD_1074(a, b) ((a) + (b) + 1074)
+typedef int pch_int_1074;
+int pch_function_1074(pch_int_1074 a, int b);
+#define PCH_VALUE_1075 (1075 * 2 + 1)
+#define PCH_ADD_1075(a, b) ((a) + (b) + 1075)
+typedef int pch_int_1075;
+int pch_function_1075(pch_int_1075 a, int b);
+#define PCH_VALUE_1076 (1076 * 2 + 1)
+#define PCH_ADD_1076(a, b) ((a) + (b) + 1076)
+typedef int pch_int_1076;
+int pch_function_1076(pch_int_1076 a, int b);
+#define PCH_VALUE_1077 (1077 * 2 + 1)
+#define PCH_ADD_1077(a, b) ((a) + (b) + 1077)
+typedef int pch_int_1077;
+int pch_function_1077(pch_int_1077 a, int b);
+#define PCH_VALUE_1078 (1078 * 2 + 1)
+#define PCH_ADD_1078(a, b) ((a) + (b) + 1078)
+typedef int pch_int_1078;
+int pch_function_1078(pch_int_1078 a, int b);
+#define PCH_VALUE_1079 (1079 * 2 + 1)
+#define PCH_ADD_1079(a, b) ((a) + (b) + 1079)
+typedef int pch_int_1079;
+int pch_function_1079(pch_int_1079 a, int b);
+#define PCH_VALUE_1080 (1080 * 2 + 1)
+#define PCH_ADD_1080(a, b) ((a) + (b) + 1080)
+typedef int pch_int_1080;
+int pch_function_1080(pch_int_1080 a, int b);
+#define PCH_VALUE_1081 (1081 * 2 + 1)
+#define PCH_ADD_1081(a, b) ((a) + (b) + 1081)
+typedef int pch_int_1081;
+int pch_function_1081(pch_int_1081 a, int b);
+#define PCH_VALUE_1082 (1082 * 2 + 1)
+#define PCH_ADD_1082(a, b) ((a) + (b) + 1082)
+typedef int pch_int_1082;
+int pch_function_1082(pch_int_1082 a, int b);
+#define PCH_VALUE_1083 (1083 * 2 + 1)
+#define PCH_ADD_1083(a, b) ((a) + (b) + 1083)
+typedef int pch_int_1083;
+int pch_function_1083(pch_int_1083 a, int b);
+#define PCH_VALUE_1084 (1084 * 2 + 1)
+#define PCH_ADD_1084(a, b) ((a) + (b) + 1084)
+typedef int pch_int_1084;
+int pch_function_1084(pch_int_1084 a, int b);
+#define PCH_VALUE_1085 (1085 * 2 + 1)
+#define PCH_ADD_1085(a, b) ((a) + (b) + 1085)
+typedef int pch_int_1085;
+int pch_function_1085(pch_int_1085 a, int b);
+#define PCH_VALUE_1086 (1086 * 2 + 1)
+#define PCH_ADD_1086(a, b) ((a) + (b) + 1086)
+typedef int pch_int_1086;
+int pch_function_1086(pch_int_1086 a, int b);
+#define PCH_VALUE_1087 (1087 * 2 + 1)
+#define PCH_ADD_1087(a, b) ((a) + (b) + 1087)
+typedef int pch_int_1087;
+int pch_function_1087(pch_int_1087 a, int b);
+#define PCH_VALUE_1088 (1088 * 2 + 1)
+#define PCH_ADD_1088(a, b) ((a) + (b) + 1088)
+typedef int pch_int_1088;
+int pch_function_1088(pch_int_1088 a, int b);
+#define PCH_VALUE_1089 (1089 * 2 + 1)
+#define PCH_ADD_1089(a, b) ((a) + (b) + 1089)
+typedef int pch_int_1089;
+int pch_function_1089(pch_int_1089 a, int b);
+#define PCH_VALUE_1090 (1090 * 2 + 1)
+#define PCH_ADD_1090(a, b) ((a) + (b) + 1090)
+typedef int pch_int_1090;
+int pch_function_1090(pch_int_1090 a, int b);
+#define PCH_VALUE_1091 (1091 * 2 + 1)
+#define PCH_ADD_1091(a, b) ((a) + (b) + 1091)
+typedef int pch_int_1091;
+int pch_function_1091(pch_int_1091 a, int b);
+#define PCH_VALUE_1092 (1092 * 2 + 1)
+#define PCH_ADD_1092(a, b) ((a) + (b) + 1092)
+typedef int pch_int_1092;
+int pch_function_1092(pch_int_1092 a, int b);
+#define PCH_VALUE_1093 (1093 * 2 + 1)
+#define PCH_ADD_1093(a, b) ((a) + (b) + 1093)
+typedef int pch_int_1093;
+int pch_function_1093(pch_int_1093 a, int b);
+#define PCH_VALUE_1094 (1094 * 2 + 1)
+#define PCH_ADD_1094(a, b) ((a) + (b) + 1094)
+typedef int pch_int_1094;
+int pch_function_1094(pch_int_1094 a, int b);
+#define PCH_VALUE_1095 (1095 * 2 + 1)
+#define PCH_ADD_1095(a, b) ((a) + (b) + 1095)
+typedef int pch_int_1095;
+int pch_function_1095(pch_int_1095 a, int b);
+#define PCH_VALUE_1096 (1096 * 2 + 1)
+#define PCH_ADD_1096(a, b) ((a) + (b) + 1096)
+typedef int pch_int_1096;
+int pch_function_1096(pch_int_1096 a, int b);
+#define PCH_VALUE_1097 (1097 * 2 + 1)
+#define PCH_ADD_1097(a, b) ((a) + (b) + 1097)
+typedef int pch_int_1097;
+int pch_function_1097(pch_int_1097 a, int b);
+#define PCH_VALUE_1098 (1098 * 2 + 1)
+#define PCH_ADD_1098(a, b) ((a) + (b) + 1098)
+typedef int pch_int_1098;
+int pch_function_1098(pch_int_1098 a, int b);
+#define PCH_VALUE_1099 (1099 * 2 + 1)
+#define PCH_ADD_1099(a, b) ((a) + (b) + 1099)
+typedef int pch_int_1099;
+int pch_function_1099(pch_int_1099 a, int b);
+#define PCH_VALUE_1100 (1100 * 2 + 1)
+#define PCH_ADD_1100(a, b) ((a) + (b) + 1100)
+typedef int pch_int_1100;
+int pch_function_1100(pch_int_1100 a, int b);
+#define PCH_VALUE_1101 (1101 * 2 + 1)
+#define PCH_ADD_1101(a, b) ((a) + (b) + 1101)
+typedef int pch_int_1101;
+int pch_function_1101(pch_int_1101 a, int b);
+#define PCH_VALUE_1102 (1102 * 2 + 1)
+#define PCH_ADD_1102(a, b) ((a) + (b) + 1102)
+typedef int pch_int_1102;
+int pch_function_1102(pch_int_1102 a, int b);
+#define PCH_VALUE_1103 (1103 * 2 + 1)
+#define PCH_ADD_1103(a, b) ((a) + (b) + 1103)
+typedef int pch_int_1103;
+int pch_function_1103(pch_int_1103 a, int b);
+#define PCH_VALUE_1104 (1104 * 2 + 1)
+#define PCH_ADD_1104(a, b) ((a) + (b) + 1104)
+typedef int pch_int_1104;
+int pch_function_1104(pch_int_1104 a, int b);
+#define PCH_VALUE_1105 (1105 * 2 + 1)
+#define PCH_ADD_1105(a, b) ((a) + (b) + 1105)
+typedef int pch_int_1105;
+int pch_function_1105(pch_int_1105 a, int b);
+#define PCH_VALUE_1106 (1106 * 2 + 1)
+#define PCH_ADD_1106(a, b) ((a) + (b) + 1106)
+typedef int pch_int_1106;
+int pch_function_1106(pch_int_1106 a, int b);
+#define PCH_VALUE_1107 (1107 * 2 + 1)
+#define PCH_ADD_1107(a, b) ((a) + (b) + 1107)
+typedef int pch_int_1107;
+int pch_function_1107(pch_int_1107 a, int b);
+#define PCH_VALUE_1108 (1108 * 2 + 1)
+#define PCH_ADD_1108(a, b) ((a) + (b) + 1108)
+typedef int pch_int_1108;
+int pch_function_1108(pch_int_1108 a, int b);
+#define PCH_VALUE_1109 (1109 * 2 + 1)
+#define PCH_ADD_1109(a, b) ((a) + (b) + 1109)
+typedef int pch_int_1109;
+int pch_function_1109(pch_int_1109 a, int b);
+#define PCH_VALUE_1110 (1110 * 2 + 1)
+#define PCH_ADD_1110(a, b) ((a) + (b) + 1110)
+typedef int pch_int_1110;
+int pch_function_1110(pch_int_1110 a, int b);
+#define PCH_VALUE_1111 (1111 * 2 + 1)
+#define PCH_ADD_1111(a, b) ((a) + (b) + 1111)
+typedef int pch_int_1111;
+int pch_function_1111(pch_int_1111 a, int b);
+#define PCH_VALUE_1112 (1112 * 2 + 1)
+#define PCH_ADD_1112(a, b) ((a) + (b) + 1112)
+typedef int pch_int_1112;
+int pch_function_1112(pch_int_1112 a, int b);
+#define PCH_VALUE_1113 (1113 * 2 + 1)
+#define PCH_ADD_1113(a, b) ((a) + (b) + 1113)
+typedef int pch_int_1113;
+int pch_function_1113(pch_int_1113 a, int b);
+#define PCH_VALUE_1114 (1114 * 2 + 1)
+#define PCH_ADD_1114(a, b) ((a) + (b) + 1114)
+typedef int pch_int_1114;
+int pch_function_1114(pch_int_1114 a, int b);
+#define PCH_VALUE_1115 (1115 * 2 + 1)
+#define PCH_ADD_1115(a, b) ((a) + (b) + 1115)
+typedef int pch_int_1115;
+int pch_function_1115(pch_int_1115 a, int b);
+#define PCH_VALUE_1116 (1116 * 2 + 1)
+#define PCH_ADD_1116(a, b) ((a) + (b) + 1116)
+typedef int pch_int_1116;
+int pch_function_1116(pch_int_1116 a, int b);
+#define PCH_VALUE_1117 (1117 * 2 + 1)
+#define PCH_ADD_1117(a, b) ((a) + (b) + 1117)
+typedef int pch_int_1117;
+int pch_function_1117(pch_int_1117 a, int b);
+#define PCH_VALUE_1118 (1118 * 2 + 1)
+#define PCH_ADD_1118(a, b) ((a) + (b) + 1118)
+typedef int pch_int_1118;
+int pch_function_1118(pch_int_1118 a, int b);
+#define PCH_VALUE_1119 (1119 * 2 + 1)
+#define PCH_ADD_1119(a, b) ((a) + (b) + 1119)
+typedef int pch_int_1119;
+int pch_function_1119(pch_int_1119 a, int b);
+#define PCH_VALUE_1120 (1120 * 2 + 1)
+#define PCH_ADD_1120(a, b) ((a) + (b) + 1120)
+typedef int pch_int_1120;
+int pch_function_1120(pch_int_1120 a, int b);
+#define PCH_VALUE_1121 (1121 * 2 + 1)
+#define PCH_ADD_1121(a, b) ((a) + (b) + 1121)
+typedef int pch_int_1121;
+int pch_function_1121(pch_int_1121 a, int b);
+#define PCH_VALUE_1122 (1122 * 2 + 1)
+#define PCH_ADD_1122(a, b) ((a) + (b) + 1122)
+typedef int pch_int_1122;
+int pch_function_1122(pch_int_1122 a, int b);
+#define PCH_VALUE_1123 (1123 * 2 + 1)
+#define PCH_ADD_1123(a, b) ((a) + (b) + 1123)
+typedef int pch_int_1123;
+int pch_function_1123(pch_int_1123 a, int b);
+#define PCH_VALUE_1124 (1124 * 2 + 1)
+#define PCH_ADD_1124(a, b) ((a) + (b) + 1124)
+typedef int pch_int_1124;
+int pch_function_1124(pch_int_1124 a, int b);
+#define PCH_VALUE_1125 (1125 * 2 + 1)
+#define PCH_ADD_1125(a, b) ((a) + (b) + 1125)
+typedef int pch_int_1125;
+int pch_function_1125(pch_int_1125 a, int b);
+#define PCH_VALUE_1126 (1126 * 2 + 1)
+#define PCH_ADD_1126(a, b) ((a) + (b) + 1126)
+typedef int pch_int_1126;
+int pch_function_1126(pch_int_1126 a, int b);
+#define PCH_VALUE_1127 (1127 * 2 + 1)
+#define PCH_ADD_1127(a, b) ((a) + (b) + 1127)
+typedef int pch_int_1127;
+int pch_function_1127(pch_int_1127 a, int b);
+#define PCH_VALUE_1128 (1128 * 2 + 1)
+#define PCH_ADD_1128(a, b) ((a) + (b) + 1128)
+typedef int pch_int_1128;
+int pch_function_1128(pch_int_1128 a, int b);
+#define PCH_VALUE_1129 (1129 * 2 + 1)
+#define PCH_ADD_1129(a, b) ((a) + (b) + 1129)
+typedef int pch_int_1129;
+int pch_function_1129(pch_int_1129 a, int b);
+#define PCH_VALUE_1130 (1130 * 2 + 1)
+#define PCH_ADD_1130(a, b) ((a) + (b) + 1130)
+typedef int pch_int_1130;
+int pch_function_1130(pch_int_1130 a, int b);
+#define PCH_VALUE_1131 (1131 * 2 + 1)
+#define PCH_ADD_1131(a, b) ((a) + (b) + 1131)
+typedef int pch_int_1131;
+int pch_function_1131(pch_int_1131 a, int b);
+#define PCH_VALUE_1132 (1132 * 2 + 1)
+#define PCH_ADD_1132(a, b) ((a) + (b) + 1132)
+typedef int pch_int_1132;
+int pch_function_1132(pch_int_1132 a, int b);
+#define PCH_VALUE_1133 (1133 * 2 + 1)
+#define PCH_ADD_1133(a, b) ((a) + (b) + 1133)
+typedef int pch_int_1133;
+int pch_function_1133(pch_int_1133 a, int b);
+#define PCH_VALUE_1134 (1134 * 2 + 1)
+#define PCH_ADD_1134(a, b) ((a) + (b) + 1134)
+typedef int pch_int_1134;
+int pch_function_1134(pch_int_1134 a, int b);
+#define PCH_VALUE_1135 (1135 * 2 + 1)
+#define PCH_ADD_1135(a, b) ((a) + (b) + 1135)
+typedef int pch_int_1135;
+int pch_function_1135(pch_int_1135 a, int b);
+#define PCH_VALUE_1136 (1136 * 2 + 1)
+#define PCH_ADD_1136(a, b) ((a) + (b) + 1136)
+typedef int pch_int_1136;
+int pch_function_1136(pch_int_1136 a, int b);
+#define PCH_VALUE_1137 (1137 * 2 + 1)
+#define PCH_ADD_1137(a, b) ((a) + (b) + 1137)
+typedef int pch_int_1137;
+int pch_function_1137(pch_int_1137 a, int b);
+#define PCH_VALUE_1138 (1138 * 2 + 1)
+#define PCH_ADD_1138(a, b) ((a) + (b) + 1138)
+typedef int pch_int_1138;
+int pch_function_1138(pch_int_1138 a, int b);
+#define PCH_VALUE_1139 (1139 * 2 + 1)
+#define PCH_ADD_1139(a, b) ((a) + (b) + 1139)
+typedef int pch_int_1139;
+int pch_function_1139(pch_int_1139 a, int b);
+#define PCH_VALUE_1140 (1140 * 2 + 1)
+#define PCH_ADD_1140(a, b) ((a) + (b) + 1140)
+typedef int pch_int_1140;
+int pch_function_1140(pch_int_1140 a, int b);
+#define PCH_VALUE_1141 (1141 * 2 + 1)
+#define PCH_ADD_1141(a, b) ((a) + (b) + 1141)
+typedef int pch_int_1141;
+int pch_function_1141(pch_int_1141 a, int b);
+#define PCH_VALUE_1142 (1142 * 2 + 1)
+#define PCH_ADD_1142(a, b) ((a) + (b) + 1142)
+typedef int pch_int_1142;
+int pch_function_1142(pch_int_1142 a, int b);
+#define PCH_VALUE_1143 (1143 * 2 + 1)
+#define PCH_ADD_1143(a, b) ((a) + (b) + 1143)
+typedef int pch_int_1143;
+int pch_function_1143(pch_int_1143 a, int b);
+#define PCH_VALUE_1144 (1144 * 2 + 1)
+#define PCH_ADD_1144(a, b) ((a) + (b) + 1144)
+typedef int pch_int_1144;
+int pch_function_1144(pch_int_1144 a, int b);
+#define PCH_VALUE_1145 (1145 * 2 + 1)
+#define PCH_ADD_1145(a, b) ((a) + (b) + 1145)
+typedef int pch_int_1145;
+int pch_function_1145(pch_int_1145 a, int b);
+#define PCH_VALUE_1146 (1146 * 2 + 1)
+#define PCH_ADD_1146(a, b) ((a) + (b) + 1146)
+typedef int pch_int_1146;
+int pch_function_1146(pch_int_1146 a, int b);
+#define PCH_VALUE_1147 (1147 * 2 + 1)
+#define PCH_ADD_1147(a, b) ((a) + (b) + 1147)
+typedef int pch_int_1147;
+int pch_function_1147(pch_int_1147 a, int b);
+#define PCH_VALUE_1148 (1148 * 2 + 1)
+#define PCH_ADD_1148(a, b) ((a) + (b) + 1148)
+typedef int pch_int_1148;
+int pch_function_1148(pch_int_1148 a, int b);
+#define PCH_VALUE_1149 (1149 * 2 + 1)
+#define PCH_ADD_1149(a, b) ((a) + (b) + 1149)
+typedef int pch_int_1149;
+int pch_function_1149(pch_int_1149 a, int b);
+#define PCH_VALUE_1150 (1150 * 2 + 1)
+#define PCH_ADD_1150(a, b) ((a) + (b) + 1150)
+typedef int pch_int_1150;
+int pch_function_1150(pch_int_1150 a, int b);
+#define PCH_VALUE_1151 (1151 * 2 + 1)
+#define PCH_ADD_1151(a, b) ((a) + (b) + 1151)
+typedef int pch_int_1151;
+int pch_function_1151(pch_int_1151 a, int b);
+#define PCH_VALUE_1152 (1152 * 2 + 1)
+#define PCH_ADD_1152(a, b) ((a) + (b) + 1152)
+typedef int pch_int_1152;
+int pch_function_1152(pch_int_1152 a, int b);
+#define PCH_VALUE_1153 (1153 * 2 + 1)
+#define PCH_ADD_1153(a, b) ((a) + (b) + 1153)
+typedef int pch_int_1153;
+int pch_function_1153(pch_int_1153 a, int b);
+#define PCH_VALUE_1154 (1154 * 2 + 1)
+#define PCH_ADD_1154(a, b) ((a) + (b) + 1154)
+typedef int pch_int_1154;
+int pch_function_1154(pch_int_1154 a, int b);
+#define PCH_VALUE_1155 (1155 * 2 + 1)
+#define PCH_ADD_1155(a, b) ((a) + (b) + 1155)
+typedef int pch_int_1155;
+int pch_function_1155(pch_int_1155 a, int b);
+#define PCH_VALUE_1156 (1156 * 2 + 1)
+#define PCH_ADD_1156(a, b) ((a) + (b) + 1156)
+typedef int pch_int_1156;
+int pch_function_1156(pch_int_1156 a, int b);
+#define PCH_VALUE_1157 (1157 * 2 + 1)
+#define PCH_ADD_1157(a, b) ((a) + (b) + 1157)
+typedef int pch_int_1157;
+int pch_function_1157(pch_int_1157 a, int b);
+#define PCH_VALUE_1158 (1158 * 2 + 1)
+#define PCH_ADD_1158(a, b) ((a) + (b) + 1158)
+typedef int pch_int_1158;
+int pch_function_1158(pch_int_1158 a, int b);
+#define PCH_VALUE_1159 (1159 * 2 + 1)
+#define PCH_ADD_1159(a, b) ((a) + (b) + 1159)
+typedef int pch_int_1159;
+int pch_function_1159(pch_int_1159 a, int b);
+#define PCH_VALUE_1160 (1160 * 2 + 1)
+#define PCH_ADD_1160(a, b) ((a) + (b) + 1160)
+typedef int pch_int_1160;
+int pch_function_1160(pch_int_1160 a, int b);
+#define PCH_VALUE_1161 (1161 * 2 + 1)
+#define PCH_ADD_1161(a, b) ((a) + (b) + 1161)
+typedef int pch_int_1161;
+int pch_function_1161(pch_int_1161 a, int b);
+#define PCH_VALUE_1162 (1162 * 2 + 1)
+#define PCH_ADD_1162(a, b) ((a) + (b) + 1162)
+typedef int pch_int_1162;
+int pch_function_1162(pch_int_1162 a, int b);
+#define PCH_VALUE_1163 (1163 * 2 + 1)
+#define PCH_ADD_1163(a, b) ((a) + (b) + 1163)
+typedef int pch_int_1163;
+int pch_function_1163(pch_int_1163 a, int b);
+#define PCH_VALUE_1164 (1164 * 2 + 1)
+#define PCH_ADD_1164(a, b) ((a) + (b) + 1164)
+typedef int pch_int_1164;
+int pch_function_1164(pch_int_1164 a, int b);
+#define PCH_VALUE_1165 (1165 * 2 + 1)
+#define PCH_ADD_1165(a, b) ((a) + (b) + 1165)
+typedef int pch_int_1165;
+int pch_function_1165(pch_int_1165 a, int b);
+#define PCH_VALUE_1166 (1166 * 2 + 1)
+#define PCH_ADD_1166(a, b) ((a) + (b) + 1166)
+typedef int pch_int_1166;
+int pch_function_1166(pch_int_1166 a, int b);
+#define PCH_VALUE_1167 (1167 * 2 + 1)
+#define PCH_ADD_1167(a, b) ((a) + (b) + 1167)
+typedef int pch_int_1167;
+int pch_function_1167(pch_int_1167 a, int b);
+#define PCH_VALUE_1168 (1168 * 2 + 1)
+#define PCH_ADD_1168(a, b) ((a) + (b) + 1168)
+typedef int pch_int_1168;
+int pch_function_1168(pch_int_1168 a, int b);
+#define PCH_VALUE_1169 (1169 * 2 + 1)
+#define PCH_ADD_1169(a, b) ((a) + (b) + 1169)
+typedef int pch_int_1169;
+int pch_function_1169(pch_int_1169 a, int b);
+#define PCH_VALUE_1170 (1170 * 2 + 1)
+#define PCH_ADD_1170(a, b) ((a) + (b) + 1170)
+typedef int pch_int_1170;
+int pch_function_1170(pch_int_1170 a, int b);
+#define PCH_VALUE_1171 (1171 * 2 + 1)
+#define PCH_ADD_1171(a, b) ((a) + (b) + 1171)
+typedef int pch_int_1171;
+int pch_function_1171(pch_int_1171 a, int b);
+#define PCH_VALUE_1172 (1172 * 2 + 1)
+#define PCH_ADD_1172(a, b) ((a) + (b) + 1172)
+typedef int pch_int_1172;
+int pch_function_1172(pch_int_1172 a, int b);
+#define PCH_VALUE_1173 (1173 * 2 + 1)
+#define PCH_ADD_1173(a, b) ((a) + (b) + 1173)
+typedef int pch_int_1173;
+int pch_function_1173(pch_int_1173 a, int b);
+#define PCH_VALUE_1174 (1174 * 2 + 1)
+#define PCH_ADD_1174(a, b) ((a) + (b) + 1174)
+typedef int pch_int_1174;
+int pch_function_1174(pch_int_1174 a, int b);
+#define PCH_VALUE_1175 (1175 * 2 + 1)
+#define PCH_ADD_1175(a, b) ((a) + (b) + 1175)
+typedef int pch_int_1175;
+int pch_function_1175(pch_int_1175 a, int b);
+#define PCH_VALUE_1176 (1176 * 2 + 1)
+#define PCH_ADD_1176(a, b) ((a) + (b) + 1176)
+typedef int pch_int_1176;
+int pch_function_1176(pch_int_1176 a, int b);
+#define PCH_VALUE_1177 (1177 * 2 + 1)
+#define PCH_ADD_1177(a, b) ((a) + (b) + 1177)
+typedef int pch_int_1177;
+int pch_function_1177(pch_int_1177 a, int b);
+#define PCH_VALUE_1178 (1178 * 2 + 1)
+#define PCH_ADD_1178(a, b) ((a) + (b) + 1178)
+typedef int pch_int_1178;
+int pch_function_1178(pch_int_1178 a, int b);
+#define PCH_VALUE_1179 (1179 * 2 + 1)
+#define PCH_ADD_1179(a, b) ((a) + (b) + 1179)
+typedef int pch_int_1179;
+int pch_function_1179(pch_int_1179 a, int b);
+#define PCH_VALUE_1180 (1180 * 2 + 1)
+#define PCH_ADD_1180(a, b) ((a) + (b) + 1180)
+typedef int pch_int_1180;
+int pch_function_1180(pch_int_1180 a, int b);
+#define PCH_VALUE_1181 (1181 * 2 + 1)
+#define PCH_ADD_1181(a, b) ((a) + (b) + 1181)
+typedef int pch_int_1181;
+int pch_function_1181(pch_int_1181 a, int b);
+#define PCH_VALUE_1182 (1182 * 2 + 1)
+#define PCH_ADD_1182(a, b) ((a) + (b) + 1182)
+typedef int pch_int_1182;
+int pch_function_1182(pch_int_1182 a, int b);
+#define PCH_VALUE_1183 (1183 * 2 + 1)
+#define PCH_ADD_1183(a, b) ((a) + (b) + 1183)
+typedef int pch_int_1183;
+int pch_function_1183(pch_int_1183 a, int b);
+#define PCH_VALUE_1184 (1184 * 2 + 1)
+#define PCH_ADD_1184(a, b) ((a) + (b) + 1184)
+typedef int pch_int_1184;
+int pch_function_1184(pch_int_1184 a, int b);
+#define PCH_VALUE_1185 (1185 * 2 + 1)
+#define PCH_ADD_1185(a, b) ((a) + (b) + 1185)
+typedef int pch_int_1185;
+int pch_function_1185(pch_int_1185 a, int b);
+#define PCH_VALUE_1186 (1186 * 2 + 1)
+#define PCH_ADD_1186(a, b) ((a) + (b) + 1186)
+typedef int pch_int_1186;
+int pch_function_1186(pch_int_1186 a, int b);
+#define PCH_VALUE_1187 (1187 * 2 + 1)
+#define PCH_ADD_1187(a, b) ((a) + (b) + 1187)
+typedef int pch_int_1187;
+int pch_function_1187(pch_int_1187 a, int b);
+#define PCH_VALUE_1188 (1188 * 2 + 1)
+#define PCH_ADD_1188(a, b) ((a) + (b) + 1188)
+typedef int pch_int_1188;
+int pch_function_1188(pch_int_1188 a, int b);
+#define PCH_VALUE_1189 (1189 * 2 + 1)
+#define PCH_ADD_1189(a, b) ((a) + (b) + 1189)
+typedef int pch_int_1189;
+int pch_function_1189(pch_int_1189 a, int b);
+#define PCH_VALUE_1190 (1190 * 2 + 1)
+#define PCH_ADD_1190(a, b) ((a) + (b) + 1190)
+typedef int pch_int_1190;
+int pch_function_1190(pch_int_1190 a, int b);
+#define PCH_VALUE_1191 (1191 * 2 + 1)
+#define PCH_ADD_1191(a, b) ((a) + (b) + 1191)
+typedef int pch_int_1191;
+int pch_function_1191(pch_int_1191 a, int b);
+#define PCH_VALUE_1192 (1192 * 2 + 1)
+#define PCH_ADD_1192(a, b) ((a) + (b) + 1192)
+typedef int pch_int_1192;
+int pch_function_1192(pch_int_1192 a, int b);
+#define PCH_VALUE_1193 (1193 * 2 + 1)
+#define PCH_ADD_1193(a, b) ((a) + (b) + 1193)
+typedef int pch_int_1193;
+int pch_function_1193(pch_int_1193 a, int b);
+#define PCH_VALUE_1194 (1194 * 2 + 1)
+#define PCH_ADD_1194(a, b) ((a) + (b) + 1194)
+typedef int pch_int_1194;
+int pch_function_1194(pch_int_1194 a, int b);
+#define PCH_VALUE_1195 (1195 * 2 + 1)
+#define PCH_ADD_1195(a, b) ((a) + (b) + 1195)
+typedef int pch_int_1195;
+int pch_function_1195(pch_int_1195 a, int b);
+#define PCH_VALUE_1196 (1196 * 2 + 1)
+#define PCH_ADD_1196(a, b) ((a) + (b) + 1196)
+typedef int pch_int_1196;
+int pch_function_1196(pch_int_1196 a, int b);
+#define PCH_VALUE_1197 (1197 * 2 + 1)
+#define PCH_ADD_1197(a, b) ((a) + (b) + 1197)
+typedef int pch_int_1197;
+int pch_function_1197(pch_int_1197 a, int b);
+#define PCH_VALUE_1198 (1198 * 2 + 1)
+#define PCH_ADD_1198(a, b) ((a) + (b) + 1198)
+typedef int pch_int_1198;
+int pch_function_1198(pch_int_1198 a, int b);
+#define PCH_VALUE_1199 (1199 * 2 + 1)
+#define PCH_ADD_1199(a, b) ((a) + (b) + 1199)
+typedef int pch_int_1199;
+int pch_function_1199(pch_int_1199 a, int b);
+#define PCH_VALUE_1200 (1200 * 2 + 1)
+#define PCH_ADD_1200(a, b) ((a) + (b) + 1200)
+typedef int pch_int_1200;
+int pch_function_1200(pch_int_1200 a, int b);
+#define PCH_VALUE_1201 (1201 * 2 + 1)
+#define PCH_ADD_1201(a, b) ((a) + (b) + 1201)
+typedef int pch_int_1201;
+int pch_function_1201(pch_int_1201 a, int b);
+#define PCH_VALUE_1202 (1202 * 2 + 1)
+#define PCH_ADD_1202(a, b) ((a) + (b) + 1202)
+typedef int pch_int_1202;
+int pch_function_1202(pch_int_1202 a, int b);
+#define PCH_VALUE_1203 (1203 * 2 + 1)
+#define PCH_ADD_1203(a, b) ((a) + (b) + 1203)
+typedef int pch_int_1203;
+int pch_function_1203(pch_int_1203 a, int b);
+#define PCH_VALUE_1204 (1204 * 2 + 1)
+#define PCH_ADD_1204(a, b) ((a) + (b) + 1204)
+typedef int pch_int_1204;
+int pch_function_1204(pch_int_1204 a, int b);
+#define PCH_VALUE_1205 (1205 * 2 + 1)
+#define PCH_ADD_1205(a, b) ((a) + (b) + 1205)
+typedef int pch_int_1205;
+int pch_function_1205(pch_int_1205 a, int b);
+#define PCH_VALUE_1206 (1206 * 2 + 1)
+#define PCH_ADD_1206(a, b) ((a) + (b) + 1206)
+typedef int pch_int_1206;
+int pch_function_1206(pch_int_1206 a, int b);
+#define PCH_VALUE_1207 (1207 * 2 + 1)
+#define PCH_ADD_1207(a, b) ((a) + (b) + 1207)
+typedef int pch_int_1207;
+int pch_function_1207(pch_int_1207 a, int b);
+#define PCH_VALUE_1208 (1208 * 2 + 1)
+#define PCH_ADD_1208(a, b) ((a) + (b) + 1208)
+typedef int pch_int_1208;
+int pch_function_1208(pch_int_1208 a, int b);
+#define PCH_VALUE_1209 (1209 * 2 + 1)
+#define PCH_ADD_1209(a, b) ((a) + (b) + 1209)
+typedef int pch_int_1209;
+int pch_function_1209(pch_int_1209 a, int b);
+#define PCH_VALUE_1210 (1210 * 2 + 1)
+#define PCH_ADD_1210(a, b) ((a) + (b) + 1210)
+typedef int pch_int_1210;
+int pch_function_1210(pch_int_1210 a, int b);
+#define PCH_VALUE_1211 (1211 * 2 + 1)
+#define PCH_ADD_1211(a, b) ((a) + (b) + 1211)
+typedef int pch_int_1211;
+int pch_function_1211(pch_int_1211 a, int b);
+#define PCH_VALUE_1212 (1212 * 2 + 1)
+#define PCH_ADD_1212(a, b) ((a) + (b) + 1212)
+typedef int pch_int_1212;
+int pch_function_1212(pch_int_1212 a, int b);
+#define PCH_VALUE_1213 (1213 * 2 + 1)
+#define PCH_ADD_1213(a, b) ((a) + (b) + 1213)
+typedef int pch_int_1213;
+int pch_function_1213(pch_int_1213 a, int b);
+#define PCH_VALUE_1214 (1214 * 2 + 1)
+#define PCH_ADD_1214(a, b) ((a) + (b) + 1214)
+typedef int pch_int_1214;
+int pch_function_1214(pch_int_1214 a, int b);
+#define PCH_VALUE_1215 (1215 * 2 + 1)
+#define PCH_ADD_1215(a, b) ((a) + (b) + 1215)
+typedef int pch_int_1215;
+int pch_function_1215(pch_int_1215 a, int b);
+#define PCH_VALUE_1216 (1216 * 2 + 1)
+#define PCH_ADD_1216(a, b) ((a) + (b) + 1216)
+typedef int pch_int_1216;
+int pch_function_1216(pch_int_1216 a, int b);
+#define PCH_VALUE_1217 (1217 * 2 + 1)
+#define PCH_ADD_1217(a, b) ((a) + (b) + 1217)
+typedef int pch_int_1217;
+int pch_function_1217(pch_int_1217 a, int b);
+#define PCH_VALUE_1218 (1218 * 2 + 1)
+#define PCH_ADD_1218(a, b) ((a) + (b) + 1218)
+typedef int pch_int_1218;
+int pch_function_1218(pch_int_1218 a, int b);
+#define PCH_VALUE_1219 (1219 * 2 + 1)
+#define PCH_ADD_1219(a, b) ((a) + (b) + 1219)
+typedef int pch_int_1219;
+int pch_function_1219(pch_int_1219 a, int b);
+#define PCH_VALUE_1220 (1220 * 2 + 1)
+#define PCH_ADD_1220(a, b) ((a) + (b) + 1220)
+typedef int pch_int_1220;
+int pch_function_1220(pch_int_1220 a, int b);
+#define PCH_VALUE_1221 (1221 * 2 + 1)
+#define PCH_ADD_1221(a, b) ((a) + (b) + 1221)
+typedef int pch_int_1221;
+int pch_function_1221(pch_int_1221 a, int b);
+#define PCH_VALUE_1222 (1222 * 2 + 1)
+#define PCH_ADD_1222(a, b) ((a) + (b) + 1222)
+typedef int pch_int_1222;
+int pch_function_1222(pch_int_1222 a, int b);
+#define PCH_VALUE_1223 (1223 * 2 + 1)
+#define PCH_ADD_1223(a, b) ((a) + (b) + 1223)
+typedef int pch_int_1223;
+int pch_function_1223(pch_int_1223 a, int b);
+#define PCH_VALUE_1224 (1224 * 2 + 1)
+#define PCH_ADD_1224(a, b) ((a) + (b) + 1224)
+typedef int pch_int_1224;
+int pch_function_1224(pch_int_1224 a, int b);
+#define PCH_VALUE_1225 (1225 * 2 + 1)
+#define PCH_ADD_1225(a, b) ((a) + (b) + 1225)
+typedef int pch_int_1225;
+int pch_function_1225(pch_int_1225 a, int b);
+#define PCH_VALUE_1226 (1226 * 2 + 1)
+#define PCH_ADD_1226(a, b) ((a) + (b) + 1226)
+typedef int pch_int_1226;
+int pch_function_1226(pch_int_1226 a, int b);
+#define PCH_VALUE_1227 (1227 * 2 + 1)
+#define PCH_ADD_1227(a, b) ((a) + (b) + 1227)
+typedef int pch_int_1227;
+int pch_function_1227(pch_int_1227 a, int b);
+#define PCH_VALUE_1228 (1228 * 2 + 1)
+#define PCH_ADD_1228(a, b) ((a) + (b) + 1228)
+typedef int pch_int_1228;
+int pch_function_1228(pch_int_1228 a, int b);
+#define PCH_VALUE_1229 (1229 * 2 + 1)
+#define PCH_ADD_1229(a, b) ((a) + (b) + 1229)
+typedef int pch_int_1229;
+int pch_function_1229(pch_int_1229 a, int b);
+#define PCH_VALUE_1230 (1230 * 2 + 1)
+#define PCH_ADD_1230(a, b) ((a) + (b) + 1230)
+typedef int pch_int_1230;
+int pch_function_1230(pch_int_1230 a, int b);
+#define PCH_VALUE_1231 (1231 * 2 + 1)
+#define PCH_ADD_1231(a, b) ((a) + (b) + 1231)
+typedef int pch_int_1231;
+int pch_function_1231(pch_int_1231 a, int b);
+#define PCH_VALUE_1232 (1232 * 2 + 1)
+#define PCH_ADD_1232(a, b) ((a) + (b) + 1232)
+typedef int pch_int_1232;
+int pch_function_1232(pch_int_1232 a, int b);
+#define PCH_VALUE_1233 (1233 * 2 + 1)
+#define PCH_ADD_1233(a, b) ((a) + (b) + 1233)
+typedef int pch_int_1233;
+int pch_function_1233(pch_int_1233 a, int b);
+#define PCH_VALUE_1234 (1234 * 2 + 1)
+#define PCH_ADD_1234(a, b) ((a) + (b) + 1234)
+typedef int pch_int_1234;
+int pch_function_1234(pch_int_1234 a, int b);
+#define PCH_VALUE_1235 (1235 * 2 + 1)
+#define PCH_ADD_1235(a, b) ((a) + (b) + 1235)
+typedef int pch_int_1235;
+int pch_function_1235(pch_int_1235 a, int b);
+#define PCH_VALUE_1236 (1236 * 2 + 1)
+#define PCH_ADD_1236(a, b) ((a) + (b) + 1236)
+typedef int pch_int_1236;
+int pch_function_1236(pch_int_1236 a, int b);
+#define PCH_VALUE_1237 (1237 * 2 + 1)
+#define PCH_ADD_1237(a, b) ((a) + (b) + 1237)
+typedef int pch_int_1237;
+int pch_function_1237(pch_int_1237 a, int b);
+#define PCH_VALUE_1238 (1238 * 2 + 1)
+#define PCH_ADD_1238(a, b) ((a) + (b) + 1238)
+typedef int pch_int_1238;
+int pch_function_1238(pch_int_1238 a, int b);
+#define PCH_VALUE_1239 (1239 * 2 + 1)
+#define PCH_ADD_1239(a, b) ((a) + (b) + 1239)
+typedef int pch_int_1239;
+int pch_function_1239(pch_int_1239 a, int b);
+#define PCH_VALUE_1240 (1240 * 2 + 1)
+#define PCH_ADD_1240(a, b) ((a) + (b) + 1240)
+typedef int pch_int_1240;
+int pch_function_1240(pch_int_1240 a, int b);
+#define PCH_VALUE_1241 (1241 * 2 + 1)
+#define PCH_ADD_1241(a, b) ((a) + (b) + 1241)
+typedef int pch_int_1241;
+int pch_function_1241(pch_int_1241 a, int b);
+#define PCH_VALUE_1242 (1242 * 2 + 1)
+#define PCH_ADD_1242(a, b) ((a) + (b) + 1242)
+typedef int pch_int_1242;
+int pch_function_1242(pch_int_1242 a, int b);
+#define PCH_VALUE_1243 (1243 * 2 + 1)
+#define PCH_ADD_1243(a, b) ((a) + (b) + 1243)
+typedef int pch_int_1243;
+int pch_function_1243(pch_int_1243 a, int b);
+#define PCH_VALUE_1244 (1244 * 2 + 1)
+#define PCH_ADD_1244(a, b) ((a) + (b) + 1244)
+typedef int pch_int_1244;
+int pch_function_1244(pch_int_1244 a, int b);
+#define PCH_VALUE_1245 (1245 * 2 + 1)
+#define PCH_ADD_1245(a, b) ((a) + (b) + 1245)
+typedef int pch_int_1245;
+int pch_function_1245(pch_int_1245 a, int b);
+#define PCH_VALUE_1246 (1246 * 2 + 1)
+#define PCH_ADD_1246(a, b) ((a) + (b) + 1246)
+typedef int pch_int_1246;
+int pch_function_1246(pch_int_1246 a, int b);
+#define PCH_VALUE_1247 (1247 * 2 + 1)
+#define PCH_ADD_1247(a, b) ((a) + (b) + 1247)
+typedef int pch_int_1247;
+int pch_function_1247(pch_int_1247 a, int b);
+#define PCH_VALUE_1248 (1248 * 2 + 1)
+#define PCH_ADD_1248(a, b) ((a) + (b) + 1248)
+typedef int pch_int_1248;
+int pch_function_1248(pch_int_1248 a, int b);
+#define PCH_VALUE_1249 (1249 * 2 + 1)
+#define PCH_ADD_1249(a, b) ((a) + (b) + 1249)
+typedef int pch_int_1249;
+int pch_function_1249(pch_int_1249 a, int b);
+#define PCH_VALUE_1250 (1250 * 2 + 1)
+#define PCH_ADD_1250(a, b) ((a) + (b) + 1250)
+typedef int pch_int_1250;
+int pch_function_1250(pch_int_1250 a, int b);
+#define PCH_VALUE_1251 (1251 * 2 + 1)
+#define PCH_ADD_1251(a, b) ((a) + (b) + 1251)
+typedef int pch_int_1251;
+int pch_function_1251(pch_int_1251 a, int b);
+#define PCH_VALUE_1252 (1252 * 2 + 1)
+#define PCH_ADD_1252(a, b) ((a) + (b) + 1252)
+typedef int pch_int_1252;
+int pch_function_1252(pch_int_1252 a, int b);
+#define PCH_VALUE_1253 (1253 * 2 + 1)
+#define PCH_ADD_1253(a, b) ((a) + (b) + 1253)
+typedef int pch_int_1253;
+int pch_function_1253(pch_int_1253 a, int b);
+#define PCH_VALUE_1254 (1254 * 2 + 1)
+#define PCH_ADD_1254(a, b) ((a) + (b) + 1254)
+typedef int pch_int_1254;
+int pch_function_1254(pch_int_1254 a, int b);
+#define PCH_VALUE_1255 (1255 * 2 + 1)
+#define PCH_ADD_1255(a, b) ((a) + (b) + 1255)
+typedef int pch_int_1255;
+int pch_function_1255(pch_int_1255 a, int b);
+#define PCH_VALUE_1256 (1256 * 2 + 1)
+#define PCH_ADD_1256(a, b) ((a) + (b) + 1256)
+typedef int pch_int_1256;
+int pch_function_1256(pch_int_1256 a, int b);
+#define PCH_VALUE_1257 (1257 * 2 + 1)
+#define PCH_ADD_1257(a, b) ((a) + (b) + 1257)
+typedef int pch_int_1257;
+int pch_function_1257(pch_int_1257 a, int b);
+#define PCH_VALUE_1258 (1258 * 2 + 1)
+#define PCH_ADD_1258(a, b) ((a) + (b) + 1258)
+typedef int pch_int_1258;
+int pch_function_1258(pch_int_1258 a, int b);
+#define PCH_VALUE_1259 (1259 * 2 + 1)
+#define PCH_ADD_1259(a, b) ((a) + (b) + 1259)
+typedef int pch_int_1259;
+int pch_function_1259(pch_int_1259 a, int b);
+#define PCH_VALUE_1260 (1260 * 2 + 1)
+#define PCH_ADD_1260(a, b) ((a) + (b) + 1260)
+typedef int pch_int_1260;
+int pch_function_1260(pch_int_1260 a, int b);
+#define PCH_VALUE_1261 (1261 * 2 + 1)
+#define PCH_ADD_1261(a, b) ((a) + (b) + 1261)
+typedef int pch_int_1261;
+int pch_function_1261(pch_int_1261 a, int b);
+#define PCH_VALUE_1262 (1262 * 2 + 1)
+#define PCH_ADD_1262(a, b) ((a) + (b) + 1262)
+typedef int pch_int_1262;
+int pch_function_1262(pch_int_1262 a, int b);
+#define PCH_VALUE_1263 (1263 * 2 + 1)
+#define PCH_ADD_1263(a, b) ((a) + (b) + 1263)
+typedef int pch_int_1263;
+int pch_function_1263(pch_int_1263 a, int b);
+#define PCH_VALUE_1264 (1264 * 2 + 1)
+#define PCH_ADD_1264(a, b) ((a) + (b) + 1264)
+typedef int pch_int_1264;
+int pch_function_1264(pch_int_1264 a, int b);
+#define PCH_VALUE_1265 (1265 * 2 + 1)
+#define PCH_ADD_1265(a, b) ((a) + (b) + 1265)
+typedef int pch_int_1265;
+int pch_function_1265(pch_int_1265 a, int b);
+#define PCH_VALUE_1266 (1266 * 2 + 1)
+#define PCH_ADD_1266(a, b) ((a) + (b) + 1266)
+typedef int pch_int_1266;
+int pch_function_1266(pch_int_1266 a, int b);
+#define PCH_VALUE_1267 (1267 * 2 + 1)
+#define PCH_ADD_1267(a, b) ((a) + (b) + 1267)
+typedef int pch_int_1267;
+int pch_function_1267(pch_int_1267 a, int b);
+#define PCH_VALUE_1268 (1268 * 2 + 1)
+#define PCH_ADD_1268(a, b) ((a) + (b) + 1268)
+typedef int pch_int_1268;
+int pch_function_1268(pch_int_1268 a, int b);
+#define PCH_VALUE_1269 (1269 * 2 + 1)
+#define PCH_ADD_1269(a, b) ((a) + (b) + 1269)
+typedef int pch_int_1269;
+int pch_function_1269(pch_int_1269 a, int b);
+#define PCH_VALUE_1270 (1270 * 2 + 1)
+#define PCH_ADD_1270(a, b) ((a) + (b) + 1270)
+typedef int pch_int_1270;
+int pch_function_1270(pch_int_1270 a, int b);
+#define PCH_VALUE_1271 (1271 * 2 + 1)
+#define PCH_ADD_1271(a, b) ((a) + (b) + 1271)
+typedef int pch_int_1271;
+int pch_function_1271(pch_int_1271 a, int b);
+#define PCH_VALUE_1272 (1272 * 2 + 1)
+#define PCH_ADD_1272(a, b) ((a) + (b) + 1272)
+typedef int pch_int_1272;
+int pch_function_1272(pch_int_1272 a, int b);
+#define PCH_VALUE_1273 (1273 * 2 + 1)
+#define PCH_ADD_1273(a, b) ((a) + (b) + 1273)
+typedef int pch_int_1273;
+int pch_function_1273(pch_int_1273 a, int b);
+#define PCH_VALUE_1274 (1274 * 2 + 1)
+#define PCH_ADD_1274(a, b) ((a) + (b) + 1274)
+typedef int pch_int_1274;
+int pch_function_1274(pch_int_1274 a, int b);
+#define PCH_VALUE_1275 (1275 * 2 + 1)
+#define PCH_ADD_1275(a, b) ((a) + (b) + 1275)
+typedef int pch_int_1275;
+int pch_function_1275(pch_int_1275 a, int b);
+#define PCH_VALUE_1276 (1276 * 2 + 1)
+#define PCH_ADD_1276(a, b) ((a) + (b) + 1276)
+typedef int pch_int_1276;
+int pch_function_1276(pch_int_1276 a, int b);
+#define PCH_VALUE_1277 (1277 * 2 + 1)
+#define PCH_ADD_1277(a, b) ((a) + (b) + 1277)
+typedef int pch_int_1277;
+int pch_function_1277(pch_int_1277 a, int b);
+#define PCH_VALUE_1278 (1278 * 2 + 1)
+#define PCH_ADD_1278(a, b) ((a) + (b) + 1278)
+typedef int pch_int_1278;
+int pch_function_1278(pch_int_1278 a, int b);
+#define PCH_VALUE_1279 (1279 * 2 + 1)
+#define PCH_ADD_1279(a, b) ((a) + (b) + 1279)
+typedef int pch_int_1279;
+int pch_function_1279(pch_int_1279 a, int b);
+#define PCH_VALUE_1280 (1280 * 2 + 1)
+#define PCH_ADD_1280(a, b) ((a) + (b) + 1280)
+typedef int pch_int_1280;
+int pch_function_1280(pch_int_1280 a, int b);
+#define PCH_VALUE_1281 (1281 * 2 + 1)
+#define PCH_ADD_1281(a, b) ((a) + (b) + 1281)
+typedef int pch_int_1281;
+int pch_function_1281(pch_int_1281 a, int b);
+#define PCH_VALUE_1282 (1282 * 2 + 1)
+#define PCH_ADD_1282(a, b) ((a) + (b) + 1282)
+typedef int pch_int_1282;
+int pch_function_1282(pch_int_1282 a, int b);
+#define PCH_VALUE_1283 (1283 * 2 + 1)
+#define PCH_ADD_1283(a, b) ((a) + (b) + 1283)
+typedef int pch_int_1283;
+int pch_function_1283(pch_int_1283 a, int b);
+#define PCH_VALUE_1284 (1284 * 2 + 1)
+#define PCH_ADD_1284(a, b) ((a) + (b) + 1284)
+typedef int pch_int_1284;
+int pch_function_1284(pch_int_1284 a, int b);
+#define PCH_VALUE_1285 (1285 * 2 + 1)
+#define PCH_ADD_1285(a, b) ((a) + (b) + 1285)
+typedef int pch_int_1285;
+int pch_function_1285(pch_int_1285 a, int b);
+#define PCH_VALUE_1286 (1286 * 2 + 1)
+#define PCH_ADD_1286(a, b) ((a) + (b) + 1286)
+typedef int pch_int_1286;
+int pch_function_1286(pch_int_1286 a, int b);
+#define PCH_VALUE_1287 (1287 * 2 + 1)
+#define PCH_ADD_1287(a, b) ((a) + (b) + 1287)
+typedef int pch_int_1287;
+int pch_function_1287(pch_int_1287 a, int b);
+#define PCH_VALUE_1288 (1288 * 2 + 1)
+#define PCH_ADD_1288(a, b) ((a) + (b) + 1288)
+typedef int pch_int_1288;
+int pch_function_1288(pch_int_1288 a, int b);
+#define PCH_VALUE_1289 (1289 * 2 + 1)
+#define PCH_ADD_1289(a, b) ((a) + (b) + 1289)
+typedef int pch_int_1289;
+int pch_function_1289(pch_int_1289 a, int b);
+#define PCH_VALUE_1290 (1290 * 2 + 1)
+#define PCH_ADD_1290(a, b) ((a) + (b) + 1290)
+typedef int pch_int_1290;
+int pch_function_1290(pch_int_1290 a, int b);
+#define PCH_VALUE_1291 (1291 * 2 + 1)
+#define PCH_ADD_1291(a, b) ((a) + (b) + 1291)
+typedef int pch_int_1291;
+int pch_function_1291(pch_int_1291 a, int b);
+#define PCH_VALUE_1292 (1292 * 2 + 1)
+#define PCH_ADD_1292(a, b) ((a) + (b) + 1292)
+typedef int pch_int_1292;
+int pch_function_1292(pch_int_1292 a, int b);
+#define PCH_VALUE_1293 (1293 * 2 + 1)
+#define PCH_ADD_1293(a, b) ((a) + (b) + 1293)
+typedef int pch_int_1293;
+int pch_function_1293(pch_int_1293 a, int b);
+#define PCH_VALUE_1294 (1294 * 2 + 1)
+#define PCH_ADD_1294(a, b) ((a) + (b) + 1294)
+typedef int pch_int_1294;
+int pch_function_1294(pch_int_1294 a, int b);
+#define PCH_VALUE_1295 (1295 * 2 + 1)
+#define PCH_ADD_1295(a, b) ((a) + (b) + 1295)
+typedef int pch_int_1295;
+int pch_function_1295(pch_int_1295 a, int b);
+#define PCH_VALUE_1296 (1296 * 2 + 1)
+#define PCH_ADD_1296(a, b) ((a) + (b) + 1296)
+typedef int pch_int_1296;
+int pch_function_1296(pch_int_1296 a, int b);
+#define PCH_VALUE_1297 (1297 * 2 + 1)
+#define PCH_ADD_1297(a, b) ((a) + (b) + 1297)
+typedef int pch_int_1297;
+int pch_function_1297(pch_int_1297 a, int b);
+#define PCH_VALUE_1298 (1298 * 2 + 1)
+#define PCH_ADD_1298(a, b) ((a) + (b) + 1298)
+typedef int pch_int_1298;
+int pch_function_1298(pch_int_1298 a, int b);
+#define PCH_VALUE_1299 (1299 * 2 + 1)
+#define PCH_ADD_1299(a, b) ((a) + (b) + 1299)
+typedef int pch_int_1299;
+int pch_function_1299(pch_int_1299 a, int b);
+#define PCH_VALUE_1300 (1300 * 2 + 1)
+#define PCH_ADD_1300(a, b) ((a) + (b) + 1300)
+typedef int pch_int_1300;
+int pch_function_1300(pch_int_1300 a, int b);
+#define PCH_VALUE_1301 (1301 * 2 + 1)
+#define PCH_ADD_1301(a, b) ((a) + (b) + 1301)
+typedef int pch_int_1301;
+int pch_function_1301(pch_int_1301 a, int b);
+#define PCH_VALUE_1302 (1302 * 2 + 1)
+#define PCH_ADD_1302(a, b) ((a) + (b) + 1302)
+typedef int pch_int_1302;
+int pch_function_1302(pch_int_1302 a, int b);
+#define PCH_VALUE_1303 (1303 * 2 + 1)
+#define PCH_ADD_1303(a, b) ((a) + (b) + 1303)
+typedef int pch_int_1303;
+int pch_function_1303(pch_int_1303 a, int b);
+#define PCH_VALUE_1304 (1304 * 2 + 1)
+#define PCH_ADD_1304(a, b) ((a) + (b) + 1304)
+typedef int pch_int_1304;
+int pch_function_1304(pch_int_1304 a, int b);
+#define PCH_VALUE_1305 (1305 * 2 + 1)
+#define PCH_ADD_1305(a, b) ((a) + (b) + 1305)
+typedef int pch_int_1305;
+int pch_function_1305(pch_int_1305 a, int b);
+#define PCH_VALUE_1306 (1306 * 2 + 1)
+#define PCH_ADD_1306(a, b) ((a) + (b) + 1306)
+typedef int pch_int_1306;
+int pch_function_1306(pch_int_1306 a, int b);
+#define PCH_VALUE_1307 (1307 * 2 + 1)
+#define PCH_ADD_1307(a, b) ((a) + (b) + 1307)
+typedef int pch_int_1307;
+int pch_function_1307(pch_int_1307 a, int b);
+#define PCH_VALUE_1308 (1308 * 2 + 1)
+#define PCH_ADD_1308(a, b) ((a) + (b) + 1308)
+typedef int pch_int_1308;
+int pch_function_1308(pch_int_1308 a, int b);
+#define PCH_VALUE_1309 (1309 * 2 + 1)
+#define PCH_ADD_1309(a, b) ((a) + (b) + 1309)
+typedef int pch_int_1309;
+int pch_function_1309(pch_int_1309 a, int b);
+#define PCH_VALUE_1310 (1310 * 2 + 1)
+#define PCH_ADD_1310(a, b) ((a) + (b) + 1310)
+typedef int pch_int_1310;
+int pch_function_1310(pch_int_1310 a, int b);
+#define PCH_VALUE_1311 (1311 * 2 + 1)
+#define PCH_ADD_1311(a, b) ((a) + (b) + 1311)
+typedef int pch_int_1311;
+int pch_function_1311(pch_int_1311 a, int b);
+#define PCH_VALUE_1312 (1312 * 2 + 1)
+#define PCH_ADD_1312(a, b) ((a) + (b) + 1312)
+typedef int pch_int_1312;
+int pch_function_1312(pch_int_1312 a, int b);
+#define PCH_VALUE_1313 (1313 * 2 + 1)
+#define PCH_ADD_1313(a, b) ((a) + (b) + 1313)
+typedef int pch_int_1313;
+int pch_function_1313(pch_int_1313 a, int b);
+#define PCH_VALUE_1314 (1314 * 2 + 1)
+#define PCH_ADD_1314(a, b) ((a) + (b) + 1314)
+typedef int pch_int_1314;
+int pch_function_1314(pch_int_1314 a, int b);
+#define PCH_VALUE_1315 (1315 * 2 + 1)
+#define PCH_ADD_1315(a, b) ((a) + (b) + 1315)
+typedef int pch_int_1315;
+int pch_function_1315(pch_int_1315 a, int b);
+#define PCH_VALUE_1316 (1316 * 2 + 1)
+#define PCH_ADD_1316(a, b) ((a) + (b) + 1316)
+typedef int pch_int_1316;
+int pch_function_1316(pch_int_1316 a, int b);
+#define PCH_VALUE_1317 (1317 * 2 + 1)
+#define PCH_ADD_1317(a, b) ((a) + (b) + 1317)
+typedef int pch_int_1317;
+int pch_function_1317(pch_int_1317 a, int b);
+#define PCH_VALUE_1318 (1318 * 2 + 1)
+#define PCH_ADD_1318(a, b) ((a) + (b) + 1318)
+typedef int pch_int_1318;
+int pch_function_1318(pch_int_1318 a, int b);
+#define PCH_VALUE_1319 (1319 * 2 + 1)
+#define PCH_ADD_1319(a, b) ((a) + (b) + 1319)
+typedef int pch_int_1319;
+int pch_function_1319(pch_int_1319 a, int b);
+#define PCH_VALUE_1320 (1320 * 2 + 1)
+#define PCH_ADD_1320(a, b) ((a) + (b) + 1320)
+typedef int pch_int_1320;
+int pch_function_1320(pch_int_1320 a, int b);
+#define PCH_VALUE_1321 (1321 * 2 + 1)
+#define PCH_ADD_1321(a, b) ((a) + (b) + 1321)
+typedef int pch_int_1321;
+int pch_function_1321(pch_int_1321 a, int b);
+#define PCH_VALUE_1322 (1322 * 2 + 1)
+#define PCH_ADD_1322(a, b) ((a) + (b) + 1322)
+typedef int pch_int_1322;
+int pch_function_1322(pch_int_1322 a, int b);
+#define PCH_VALUE_1323 (1323 * 2 + 1)
+#define PCH_ADD_1323(a, b) ((a) + (b) + 1323)
+typedef int pch_int_1323;
+int pch_function_1323(pch_int_1323 a, int b);
+#define PCH_VALUE_1324 (1324 * 2 + 1)
+#define PCH_ADD_1324(a, b) ((a) + (b) + 1324)
+typedef int pch_int_1324;
+int pch_function_1324(pch_int_1324 a, int b);
+#define PCH_VALUE_1325 (1325 * 2 + 1)
+#define PCH_ADD_1325(a, b) ((a) + (b) + 1325)
+typedef int pch_int_1325;
+int pch_function_1325(pch_int_1325 a, int b);
+#define PCH_VALUE_1326 (1326 * 2 + 1)
+#define PCH_ADD_1326(a, b) ((a) + (b) + 1326)
+typedef int pch_int_1326;
+int pch_function_1326(pch_int_1326 a, int b);
+#define PCH_VALUE_1327 (1327 * 2 + 1)
+#define PCH_ADD_1327(a, b) ((a) + (b) + 1327)
+typedef int pch_int_1327;
+int pch_function_1327(pch_int_1327 a, int b);
+#define PCH_VALUE_1328 (1328 * 2 + 1)
+#define PCH_ADD_1328(a, b) ((a) + (b) + 1328)
+typedef int pch_int_1328;
+int pch_function_1328(pch_int_1328 a, int b);
+#define PCH_VALUE_1329 (1329 * 2 + 1)
+#define PCH_ADD_1329(a, b) ((a) + (b) + 1329)
+typedef int pch_int_1329;
+int pch_function_1329(pch_int_1329 a, int b);
+#define PCH_VALUE_1330 (1330 * 2 + 1)
+#define PCH_ADD_1330(a, b) ((a) + (b) + 1330)
+typedef int pch_int_1330;
+int pch_function_1330(pch_int_1330 a, int b);
+#define PCH_VALUE_1331 (1331 * 2 + 1)
+#define PCH_ADD_1331(a, b) ((a) + (b) + 1331)
+typedef int pch_int_1331;
+int pch_function_1331(pch_int_1331 a, int b);
+#define PCH_VALUE_1332 (1332 * 2 + 1)
+#define PCH_ADD_1332(a, b) ((a) + (b) + 1332)
+typedef int pch_int_1332;
+int pch_function_1332(pch_int_1332 a, int b);
+#define PCH_VALUE_1333 (1333 * 2 + 1)
+#define PCH_ADD_1333(a, b) ((a) + (b) + 1333)
+typedef int pch_int_1333;
+int pch_function_1333(pch_int_1333 a, int b);
+#define PCH_VALUE_1334 (1334 * 2 + 1)
+#define PCH_ADD_1334(a, b) ((a) + (b) + 1334)
+typedef int pch_int_1334;
+int pch_function_1334(pch_int_1334 a, int b);
+#define PCH_VALUE_1335 (1335 * 2 + 1)
+#define PCH_ADD_1335(a, b) ((a) + (b) + 1335)
+typedef int pch_int_1335;
+int pch_function_1335(pch_int_1335 a, int b);
+#define PCH_VALUE_1336 (1336 * 2 + 1)
+#define PCH_ADD_1336(a, b) ((a) + (b) + 1336)
+typedef int pch_int_1336;
+int pch_function_1336(pch_int_1336 a, int b);
+#define PCH_VALUE_1337 (1337 * 2 + 1)
+#define PCH_ADD_1337(a, b) ((a) + (b) + 1337)
+typedef int pch_int_1337;
+int pch_function_1337(pch_int_1337 a, int b);
+#define PCH_VALUE_1338 (1338 * 2 + 1)
+#define PCH_ADD_1338(a, b) ((a) + (b) + 1338)
+typedef int pch_int_1338;
+int pch_function_1338(pch_int_1338 a, int b);
+#define PCH_VALUE_1339 (1339 * 2 + 1)
+#define PCH_ADD_1339(a, b) ((a) + (b) + 1339)
+typedef int pch_int_1339;
+int pch_function_1339(pch_int_1339 a, int b);
+#define PCH_VALUE_1340 (1340 * 2 + 1)
+#define PCH_ADD_1340(a, b) ((a) + (b) + 1340)
+typedef int pch_int_1340;
+int pch_function_1340(pch_int_1340 a, int b);
+#define PCH_VALUE_1341 (1341 * 2 + 1)
+#define PCH_ADD_1341(a, b) ((a) + (b) + 1341)
+typedef int pch_int_1341;
+int pch_function_1341(pch_int_1341 a, int b);
+#define PCH_VALUE_1342 (1342 * 2 + 1)
+#define PCH_ADD_1342(a, b) ((a) + (b) + 1342)
+typedef int pch_int_1342;
+int pch_function_1342(pch_int_1342 a, int b);
+#define PCH_VALUE_1343 (1343 * 2 + 1)
+#define PCH_ADD_1343(a, b) ((a) + (b) + 1343)
+typedef int pch_int_1343;
+int pch_function_1343(pch_int_1343 a, int b);
+#define PCH_VALUE_1344 (1344 * 2 + 1)
+#define PCH_ADD_1344(a, b) ((a) + (b) + 1344)
+typedef int pch_int_1344;
+int pch_function_1344(pch_int_1344 a, int b);
+#define PCH_VALUE_1345 (1345 * 2 + 1)
+#define PCH_ADD_1345(a, b) ((a) + (b) + 1345)
+typedef int pch_int_1345;
+int pch_function_1345(pch_int_1345 a, int b);
+#define PCH_VALUE_1346 (1346 * 2 + 1)
+#define PCH_ADD_1346(a, b) ((a) + (b) + 1346)
+typedef int pch_int_1346;
+int pch_function_1346(pch_int_1346 a, int b);
+#define PCH_VALUE_1347 (1347 * 2 + 1)
+#define PCH_ADD_1347(a, b) ((a) + (b) + 1347)
+typedef int pch_int_1347;
+int pch_function_1347(pch_int_1347 a, int b);
+#define PCH_VALUE_1348 (1348 * 2 + 1)
+#define PCH_ADD_1348(a, b) ((a) + (b) + 1348)
+typedef int pch_int_1348;
+int pch_function_1348(pch_int_1348 a, int b);
+#define PCH_VALUE_1349 (1349 * 2 + 1)
+#define PCH_ADD_1349(a, b) ((a) + (b) + 1349)
+typedef int pch_int_1349;
+int pch_function_1349(pch_int_1349 a, int b);
+#define PCH_VALUE_1350 (1350 * 2 + 1)
+#define PCH_ADD_1350(a, b) ((a) + (b) + 1350)
+typedef int pch_int_1350;
+int pch_function_1350(pch_int_1350 a, int b);
+#define PCH_VALUE_1351 (1351 * 2 + 1)
+#define PCH_ADD_1351(a, b) ((a) + (b) + 1351)
+typedef int pch_int_1351;
+int pch_function_1351(pch_int_1351 a, int b);
+#define PCH_VALUE_1352 (1352 * 2 + 1)
+#define PCH_ADD_1352(a, b) ((a) + (b) + 1352)
+typedef int pch_int_1352;
+int pch_function_1352(pch_int_1352 a, int b);
+#define PCH_VALUE_1353 (1353 * 2 + 1)
+#define PCH_ADD_1353(a, b) ((a) + (b) + 1353)
+typedef int pch_int_1353;
+int pch_function_1353(pch_int_1353 a, int b);
+#define PCH_VALUE_1354 (1354 * 2 + 1)
+#define PCH_ADD_1354(a, b) ((a) + (b) + 1354)
+typedef int pch_int_1354;
+int pch_function_1354(pch_int_1354 a, int b);
+#define PCH_VALUE_1355 (1355 * 2 + 1)
+#define PCH_ADD_1355(a, b) ((a) + (b) + 1355)
+typedef int pch_int_1355;
+int pch_function_1355(pch_int_1355 a, int b);
+#define PCH_VALUE_1356 (1356 * 2 + 1)
+#define PCH_ADD_1356(a, b) ((a) + (b) + 1356)
+typedef int pch_int_1356;
+int pch_function_1356(pch_int_1356 a, int b);
+#define PCH_VALUE_1357 (1357 * 2 + 1)
+#define PCH_ADD_1357(a, b) ((a) + (b) + 1357)
+typedef int pch_int_1357;
+int pch_function_1357(pch_int_1357 a, int b);
+#define PCH_VALUE_1358 (1358 * 2 + 1)
+#define PCH_ADD_1358(a, b) ((a) + (b) + 1358)
+typedef int pch_int_1358;
+int pch_function_1358(pch_int_1358 a, int b);
+#define PCH_VALUE_1359 (1359 * 2 + 1)
+#define PCH_ADD_1359(a, b) ((a) + (b) + 1359)
+typedef int pch_int_1359;
+int pch_function_1359(pch_int_1359 a, int b);
+#define PCH_VALUE_1360 (1360 * 2 + 1)
+#define PCH_ADD_1360(a, b) ((a) + (b) + 1360)
+typedef int pch_int_1360;
+int pch_function_1360(pch_int_1360 a, int b);
+#define PCH_VALUE_1361 (1361 * 2 + 1)
+#define PCH_ADD_1361(a, b) ((a) + (b) + 1361)
+typedef int pch_int_1361;
+int pch_function_1361(pch_int_1361 a, int b);
+#define PCH_VALUE_1362 (1362 * 2 + 1)
+#define PCH_ADD_1362(a, b) ((a) + (b) + 1362)
+typedef int pch_int_1362;
+int pch_function_1362(pch_int_1362 a, int b);
+#define PCH_VALUE_1363 (1363 * 2 + 1)
+#define PCH_ADD_1363(a, b) ((a) + (b) + 1363)
+typedef int pch_int_1363;
+int pch_function_1363(pch_int_1363 a, int b);
+#define PCH_VALUE_1364 (1364 * 2 + 1)
+#define PCH_ADD_1364(a, b) ((a) + (b) + 1364)
+typedef int pch_int_1364;
+int pch_function_1364(pch_int_1364 a, int b);
+#define PCH_VALUE_1365 (1365 * 2 + 1)
+#define PCH_ADD_1365(a, b) ((a) + (b) + 1365)
+typedef int pch_int_1365;
+int pch_function_1365(pch_int_1365 a, int b);
+#define PCH_VALUE_1366 (1366 * 2 + 1)
+#define PCH_ADD_1366(a, b) ((a) + (b) + 1366)
+typedef int pch_int_1366;
+int pch_function_1366(pch_int_1366 a, int b);
+#define PCH_VALUE_1367 (1367 * 2 + 1)
+#define PCH_ADD_1367(a, b) ((a) + (b) + 1367)
+typedef int pch_int_1367;
+int pch_function_1367(pch_int_1367 a, int b);
+#define PCH_VALUE_1368 (1368 * 2 + 1)
+#define PCH_ADD_1368(a, b) ((a) + (b) + 1368)
+typedef int pch_int_1368;
+int pch_function_1368(pch_int_1368 a, int b);
+#define PCH_VALUE_1369 (1369 * 2 + 1)
+#define PCH_ADD_1369(a, b) ((a) + (b) + 1369)
+typedef int pch_int_1369;
+int pch_function_1369(pch_int_1369 a, int b);
+#define PCH_VALUE_1370 (1370 * 2 + 1)
+#define PCH_ADD_1370(a, b) ((a) + (b) + 1370)
+typedef int pch_int_1370;
+int pch_function_1370(pch_int_1370 a, int b);
+#define PCH_VALUE_1371 (1371 * 2 + 1)
+#define PCH_ADD_1371(a, b) ((a) + (b) + 1371)
+typedef int pch_int_1371;
+int pch_function_1371(pch_int_1371 a, int b);
+#define PCH_VALUE_1372 (1372 * 2 + 1)
+#define PCH_ADD_1372(a, b) ((a) + (b) + 1372)
+typedef int pch_int_1372;
+int pch_function_1372(pch_int_1372 a, int b);
+#define PCH_VALUE_1373 (1373 * 2 + 1)
+#define PCH_ADD_1373(a, b) ((a) + (b) + 1373)
+typedef int pch_int_1373;
+int pch_function_1373(pch_int_1373 a, int b);
+#define PCH_VALUE_1374 (1374 * 2 + 1)
+#define PCH_ADD_1374(a, b) ((a) + (b) + 1374)
+typedef int pch_int_1374;
+int pch_function_1374(pch_int_1374 a, int b);
+#define PCH_VALUE_1375 (1375 * 2 + 1)
+#define PCH_ADD_1375(a, b) ((a) + (b) + 1375)
+typedef int pch_int_1375;
+int pch_function_1375(pch_int_1375 a, int b);
+#define PCH_VALUE_1376 (1376 * 2 + 1)
+#define PCH_ADD_1376(a, b) ((a) + (b) + 1376)
+typedef int pch_int_1376;
+int pch_function_1376(pch_int_1376 a, int b);
+#define PCH_VALUE_1377 (1377 * 2 + 1)
+#define PCH_ADD_1377(a, b) ((a) + (b) + 1377)
+typedef int pch_int_1377;
+int pch_function_1377(pch_int_1377 a, int b);
+#define PCH_VALUE_1378 (1378 * 2 + 1)
+#define PCH_ADD_1378(a, b) ((a) + (b) + 1378)
+typedef int pch_int_1378;
+int pch_function_1378(pch_int_1378 a, int b);
+#define PCH_VALUE_1379 (1379 * 2 + 1)
+#define PCH_ADD_1379(a, b) ((a) + (b) + 1379)
+typedef int pch_int_1379;
+int pch_function_1379(pch_int_1379 a, int b);
+#define PCH_VALUE_1380 (1380 * 2 + 1)
+#define PCH_ADD_1380(a, b) ((a) + (b) + 1380)
+typedef int pch_int_1380;
+int pch_function_1380(pch_int_1380 a, int b);
+#define PCH_VALUE_1381 (1381 * 2 + 1)
+#define PCH_ADD_1381(a, b) ((a) + (b) + 1381)
+typedef int pch_int_1381;
+int pch_function_1381(pch_int_1381 a, int b);
+#define PCH_VALUE_1382 (1382 * 2 + 1)
+#define PCH_ADD_1382(a, b) ((a) + (b) + 1382)
+typedef int pch_int_1382;
+int pch_function_1382(pch_int_1382 a, int b);
+#define PCH_VALUE_1383 (1383 * 2 + 1)
+#define PCH_ADD_1383(a, b) ((a) + (b) + 1383)
+typedef int pch_int_1383;
+int pch_function_1383(pch_int_1383 a, int b);
+#define PCH_VALUE_1384 (1384 * 2 + 1)
+#define PCH_ADD_1384(a, b) ((a) + (b) + 1384)
+typedef int pch_int_1384;
+int pch_function_1384(pch_int_1384 a, int b);
+#define PCH_VALUE_1385 (1385 * 2 + 1)
+#define PCH_ADD_1385(a, b) ((a) + (b) + 1385)
+typedef int pch_int_1385;
+int pch_function_1385(pch_int_1385 a, int b);
+#define PCH_VALUE_1386 (1386 * 2 + 1)
+#define PCH_ADD_1386(a, b) ((a) + (b) + 1386)
+typedef int pch_int_1386;
+int pch_function_1386(pch_int_1386 a, int b);
+#define PCH_VALUE_1387 (1387 * 2 + 1)
+#define PCH_ADD_1387(a, b) ((a) + (b) + 1387)
+typedef int pch_int_1387;
+int pch_function_1387(pch_int_1387 a, int b);
+#define PCH_VALUE_1388 (1388 * 2 + 1)
+#define PCH_ADD_1388(a, b) ((a) + (b) + 1388)
+typedef int pch_int_1388;
+int pch_function_1388(pch_int_1388 a, int b);
+#define PCH_VALUE_1389 (1389 * 2 + 1)
+#define PCH_ADD_1389(a, b) ((a) + (b) + 1389)
+typedef int pch_int_1389;
+int pch_function_1389(pch_int_1389 a, int b);
+#define PCH_VALUE_1390 (1390 * 2 + 1)
+#define PCH_ADD_1390(a, b) ((a) + (b) + 1390)
+typedef int pch_int_1390;
+int pch_function_1390(pch_int_1390 a, int b);
+#define PCH_VALUE_1391 (1391 * 2 + 1)
+#define PCH_ADD_1391(a, b) ((a) + (b) + 1391)
+typedef int pch_int_1391;
+int pch_function_1391(pch_int_1391 a, int b);
+#define PCH_VALUE_1392 (1392 * 2 + 1)
+#define PCH_ADD_1392(a, b) ((a) + (b) + 1392)
+typedef int pch_int_1392;
+int pch_function_1392(pch_int_1392 a, int b);
+#define PCH_VALUE_1393 (1393 * 2 + 1)
+#define PCH_ADD_1393(a, b) ((a) + (b) + 1393)
+typedef int pch_int_1393;
+int pch_function_1393(pch_int_1393 a, int b);
+#define PCH_VALUE_1394 (1394 * 2 + 1)
+#define PCH_ADD_1394(a, b) ((a) + (b) + 1394)
+typedef int pch_int_1394;
+int pch_function_1394(pch_int_1394 a, int b);
+#define PCH_VALUE_1395 (1395 * 2 + 1)
+#define PCH_ADD_1395(a, b) ((a) + (b) + 1395)
+typedef int pch_int_1395;
+int pch_function_1395(pch_int_1395 a, int b);
+#define PCH_VALUE_1396 (1396 * 2 + 1)
+#define PCH_ADD_1396(a, b) ((a) + (b) + 1396)
+typedef int pch_int_1396;
+int pch_function_1396(pch_int_1396 a, int b);
+#define PCH_VALUE_1397 (1397 * 2 + 1)
+#define PCH_ADD_1397(a, b) ((a) + (b) + 1397)
+typedef int pch_int_1397;
+int pch_function_1397(pch_int_1397 a, int b);
+#define PCH_VALUE_1398 (1398 * 2 + 1)
+#define PCH_ADD_1398(a, b) ((a) + (b) + 1398)
+typedef int pch_int_1398;
+int pch_function_1398(pch_int_1398 a, int b);
+#define PCH_VALUE_1399 (1399 * 2 + 1)
+#define PCH_ADD_1399(a, b) ((a) + (b) + 1399)
+typedef int pch_int_1399;
+int pch_function_1399(pch_int_1399 a, int b);
+#define PCH_VALUE_1400 (1400 * 2 + 1)
+#define PCH_ADD_1400(a, b) ((a) + (b) + 1400)
+typedef int pch_int_1400;
+int pch_function_1400(pch_int_1400 a, int b);
+#define PCH_VALUE_1401 (1401 * 2 + 1)
+#define PCH_ADD_1401(a, b) ((a) + (b) + 1401)
+typedef int pch_int_1401;
+int pch_function_1401(pch_int_1401 a, int b);
+#define PCH_VALUE_1402 (1402 * 2 + 1)
+#define PCH_ADD_1402(a, b) ((a) + (b) + 1402)
+typedef int pch_int_1402;
+int pch_function_1402(pch_int_1402 a, int b);
+#define PCH_VALUE_1403 (1403 * 2 + 1)
+#define PCH_ADD_1403(a, b) ((a) + (b) + 1403)
+typedef int pch_int_1403;
+int pch_function_1403(pch_int_1403 a, int b);
+#define PCH_VALUE_1404 (1404 * 2 + 1)
+#define PCH_ADD_1404(a, b) ((a) + (b) + 1404)
+typedef int pch_int_1404;
+int pch_function_1404(pch_int_1404 a, int b);
+#define PCH_VALUE_1405 (1405 * 2 + 1)
+#define PCH_ADD_1405(a, b) ((a) + (b) + 1405)
+typedef int pch_int_1405;
+int pch_function_1405(pch_int_1405 a, int b);
+#define PCH_VALUE_1406 (1406 * 2 + 1)
+#define PCH_ADD_1406(a, b) ((a) + (b) + 1406)
+typedef int pch_int_1406;
+int pch_function_1406(pch_int_1406 a, int b);
+#define PCH_VALUE_1407 (1407 * 2 + 1)
+#define PCH_ADD_1407(a, b) ((a) + (b) + 1407)
+typedef int pch_int_1407;
+int pch_function_1407(pch_int_1407 a, int b);
+#define PCH_VALUE_1408 (1408 * 2 + 1)
+#define PCH_ADD_1408(a, b) ((a) + (b) + 1408)
+typedef int pch_int_1408;
+int pch_function_1408(pch_int_1408 a, int b);
+#define PCH_VALUE_1409 (1409 * 2 + 1)
+#define PCH_ADD_1409(a, b) ((a) + (b) + 1409)
+typedef int pch_int_1409;
+int pch_function_1409(pch_int_1409 a, int b);
+#define PCH_VALUE_1410 (1410 * 2 + 1)
+#define PCH_ADD_1410(a, b) ((a) + (b) + 1410)
+typedef int pch_int_1410;
+int pch_function_1410(pch_int_1410 a, int b);
+#define PCH_VALUE_1411 (1411 * 2 + 1)
+#define PCH_ADD_1411(a, b) ((a) + (b) + 1411)
+typedef int pch_int_1411;
+int pch_function_1411(pch_int_1411 a, int b);
+#define PCH_VALUE_1412 (1412 * 2 + 1)
+#define PCH_ADD_1412(a, b) ((a) + (b) + 1412)
+typedef int pch_int_1412;
+int pch_function_1412(pch_int_1412 a, int b);
+#define PCH_VALUE_1413 (1413 * 2 + 1)
+#define PCH_ADD_1413(a, b) ((a) + (b) + 1413)
+typedef int pch_int_1413;
+int pch_function_1413(pch_int_1413 a, int b);
+#define PCH_VALUE_1414 (1414 * 2 + 1)
+#define PCH_ADD_1414(a, b) ((a) + (b) + 1414)
+typedef int pch_int_1414;
+int pch_function_1414(pch_int_1414 a, int b);
+#define PCH_VALUE_1415 (1415 * 2 + 1)
+#define PCH_ADD_1415(a, b) ((a) + (b) + 1415)
+typedef int pch_int_1415;
+int pch_function_1415(pch_int_1415 a, int b);
+#define PCH_VALUE_1416 (1416 * 2 + 1)
+#define PCH_ADD_1416(a, b) ((a) + (b) + 1416)
+typedef int pch_int_1416;
+int pch_function_1416(pch_int_1416 a, int b);
+#define PCH_VALUE_1417 (1417 * 2 + 1)
+#define PCH_ADD_1417(a, b) ((a) + (b) + 1417)
+typedef int pch_int_1417;
+int pch_function_1417(pch_int_1417 a, int b);
+#define PCH_VALUE_1418 (1418 * 2 + 1)
+#define PCH_ADD_1418(a, b) ((a) + (b) + 1418)
+typedef int pch_int_1418;
+int pch_function_1418(pch_int_1418 a, int b);
+#define PCH_VALUE_1419 (1419 * 2 + 1)
+#define PCH_ADD_1419(a, b) ((a) + (b) + 1419)
+typedef int pch_int_1419;
+int pch_function_1419(pch_int_1419 a, int b);
+#define PCH_VALUE_1420 (1420 * 2 + 1)
+#define PCH_ADD_1420(a, b) ((a) + (b) + 1420)
+typedef int pch_int_1420;
+int pch_function_1420(pch_int_1420 a, int b);
+#define PCH_VALUE_1421 (1421 * 2 + 1)
+#define PCH_ADD_1421(a, b) ((a) + (b) + 1421)
+typedef int pch_int_1421;
+int pch_function_1421(pch_int_1421 a, int b);
+#define PCH_VALUE_1422 (1422 * 2 + 1)
+#define PCH_ADD_1422(a, b) ((a) + (b) + 1422)
+typedef int pch_int_1422;
+int pch_function_1422(pch_int_1422 a, int b);
+#define PCH_VALUE_1423 (1423 * 2 + 1)
+#define PCH_ADD_1423(a, b) ((a) + (b) + 1423)
+typedef int pch_int_1423;
+int pch_function_1423(pch_int_1423 a, int b);
+#define PCH_VALUE_1424 (1424 * 2 + 1)
+#define PCH_ADD_1424(a, b) ((a) + (b) + 1424)
+typedef int pch_int_1424;
+int pch_function_1424(pch_int_1424 a, int b);
+#define PCH_VALUE_1425 (1425 * 2 + 1)
+#define PCH_ADD_1425(a, b) ((a) + (b) + 1425)
+typedef int pch_int_1425;
+int pch_function_1425(pch_int_1425 a, int b);
+#define PCH_VALUE_1426 (1426 * 2 + 1)
+#define PCH_ADD_1426(a, b) ((a) + (b) + 1426)
+typedef int pch_int_1426;
+int pch_function_1426(pch_int_1426 a, int b);
+#define PCH_VALUE_1427 (1427 * 2 + 1)
+#define PCH_ADD_1427(a, b) ((a) + (b) + 1427)
+typedef int pch_int_1427;
+int pch_function_1427(pch_int_1427 a, int b);
+#define PCH_VALUE_1428 (1428 * 2 + 1)
+#define PCH_ADD_1428(a, b) ((a) + (b) + 1428)
+typedef int pch_int_1428;
+int pch_function_1428(pch_int_1428 a, int b);
+#define PCH_VALUE_1429 (1429 * 2 + 1)
+#define PCH_ADD_1429(a, b) ((a) + (b) + 1429)
+typedef int pch_int_1429;
+int pch_function_1429(pch_int_1429 a, int b);
+#define PCH_VALUE_1430 (1430 * 2 + 1)
+#define PCH_ADD_1430(a, b) ((a) + (b) + 1430)
+typedef int pch_int_1430;
+int pch_function_1430(pch_int_1430 a, int b);
+#define PCH_VALUE_1431 (1431 * 2 + 1)
+#define PCH_ADD_1431(a, b) ((a) + (b) + 1431)
+typedef int pch_int_1431;
+int pch_function_1431(pch_int_1431 a, int b);
+#define PCH_VALUE_1432 (1432 * 2 + 1)
+#define PCH_ADD_1432(a, b) ((a) + (b) + 1432)
+typedef int pch_int_1432;
+int pch_function_1432(pch_int_1432 a, int b);
+#define PCH_VALUE_1433 (1433 * 2 + 1)
+#define PCH_ADD_1433(a, b) ((a) + (b) + 1433)
+typedef int pch_int_1433;
+int pch_function_1433(pch_int_1433 a, int b);
+#define PCH_VALUE_1434 (1434 * 2 + 1)
+#define PCH_ADD_1434(a, b) ((a) + (b) + 1434)
+typedef int pch_int_1434;
+int pch_function_1434(pch_int_1434 a, int b);
+#define PCH_VALUE_1435 (1435 * 2 + 1)
+#define PCH_ADD_1435(a, b) ((a) + (b) + 1435)
+typedef int pch_int_1435;
+int pch_function_1435(pch_int_1435 a, int b);
+#define PCH_VALUE_1436 (1436 * 2 + 1)
+#define PCH_ADD_1436(a, b) ((a) + (b) + 1436)
+typedef int pch_int_1436;
+int pch_function_1436(pch_int_1436 a, int b);
+#define PCH_VALUE_1437 (1437 * 2 + 1)
+#define PCH_ADD_1437(a, b) ((a) + (b) + 1437)
+typedef int pch_int_1437;
+int pch_function_1437(pch_int_1437 a, int b);
+#define PCH_VALUE_1438 (1438 * 2 + 1)
+#define PCH_ADD_1438(a, b) ((a) + (b) + 1438)
+typedef int pch_int_1438;
+int pch_function_1438(pch_int_1438 a, int b);
+#define PCH_VALUE_1439 (1439 * 2 + 1)
+#define PCH_ADD_1439(a, b) ((a) + (b) + 1439)
+typedef int pch_int_1439;
+int pch_function_1439(pch_int_1439 a, int b);
+#define PCH_VALUE_1440 (1440 * 2 + 1)
+#define PCH_ADD_1440(a, b) ((a) + (b) + 1440)
+typedef int pch_int_1440;
+int pch_function_1440(pch_int_1440 a, int b);
+#define PCH_VALUE_1441 (1441 * 2 + 1)
+#define PCH_ADD_1441(a, b) ((a) + (b) + 1441)
+typedef int pch_int_1441;
+int pch_function_1441(pch_int_1441 a, int b);
+#define PCH_VALUE_1442 (1442 * 2 + 1)
+#define PCH_ADD_1442(a, b) ((a) + (b) + 1442)
+typedef int pch_int_1442;
+int pch_function_1442(pch_int_1442 a, int b);
+#define PCH_VALUE_1443 (1443 * 2 + 1)
+#define PCH_ADD_1443(a, b) ((a) + (b) + 1443)
+typedef int pch_int_1443;
+int pch_function_1443(pch_int_1443 a, int b);
+#define PCH_VALUE_1444 (1444 * 2 + 1)
+#define PCH_ADD_1444(a, b) ((a) + (b) + 1444)
+typedef int pch_int_1444;
+int pch_function_1444(pch_int_1444 a, int b);
+#define PCH_VALUE_1445 (1445 * 2 + 1)
+#define PCH_ADD_1445(a, b) ((a) + (b) + 1445)
+typedef int pch_int_1445;
+int pch_function_1445(pch_int_1445 a, int b);
+#define PCH_VALUE_1446 (1446 * 2 + 1)
+#define PCH_ADD_1446(a, b) ((a) + (b) + 1446)
+typedef int pch_int_1446;
+int pch_function_1446(pch_int_1446 a, int b);
+#define PCH_VALUE_1447 (1447 * 2 + 1)
+#define PCH_ADD_1447(a, b) ((a) + (b) + 1447)
+typedef int pch_int_1447;
+int pch_function_1447(pch_int_1447 a, int b);
+#define PCH_VALUE_1448 (1448 * 2 + 1)
+#define PCH_ADD_1448(a, b) ((a) + (b) + 1448)
+typedef int pch_int_1448;
+int pch_function_1448(pch_int_1448 a, int b);
+#define PCH_VALUE_1449 (1449 * 2 + 1)
+#define PCH_ADD_1449(a, b) ((a) + (b) + 1449)
+typedef int pch_int_1449;
+int pch_function_1449(pch_int_1449 a, int b);
+#define PCH_VALUE_1450 (1450 * 2 + 1)
+#define PCH_ADD_1450(a, b) ((a) + (b) + 1450)
+typedef int pch_int_1450;
+int pch_function_1450(pch_int_1450 a, int b);
+#define PCH_VALUE_1451 (1451 * 2 + 1)
+#define PCH_ADD_1451(a, b) ((a) + (b) + 1451)
+typedef int pch_int_1451;
+int pch_function_1451(pch_int_1451 a, int b);
+#define PCH_VALUE_1452 (1452 * 2 + 1)
+#define PCH_ADD_1452(a, b) ((a) + (b) + 1452)
+typedef int pch_int_1452;
+int pch_function_1452(pch_int_1452 a, int b);
+#define PCH_VALUE_1453 (1453 * 2 + 1)
+#define PCH_ADD_1453(a, b) ((a) + (b) + 1453)
+typedef int pch_int_1453;
+int pch_function_1453(pch_int_1453 a, int b);
+#define PCH_VALUE_1454 (1454 * 2 + 1)
+#define PCH_ADD_1454(a, b) ((a) + (b) + 1454)
+typedef int pch_int_1454;
+int pch_function_1454(pch_int_1454 a, int b);
+#define PCH_VALUE_1455 (1455 * 2 + 1)
+#define PCH_ADD_1455(a, b) ((a) + (b) + 1455)
+typedef int pch_int_1455;
+int pch_function_1455(pch_int_1455 a, int b);
+#define PCH_VALUE_1456 (1456 * 2 + 1)
+#define PCH_ADD_1456(a, b) ((a) + (b) + 1456)
+typedef int pch_int_1456;
+int pch_function_1456(pch_int_1456 a, int b);
+#define PCH_VALUE_1457 (1457 * 2 + 1)
+#define PCH_ADD_1457(a, b) ((a) + (b) + 1457)
+typedef int pch_int_1457;
+int pch_function_1457(pch_int_1457 a, int b);
+#define PCH_VALUE_1458 (1458 * 2 + 1)
+#define PCH_ADD_1458(a, b) ((a) + (b) + 1458)
+typedef int pch_int_1458;
+int pch_function_1458(pch_int_1458 a, int b);
+#define PCH_VALUE_1459 (1459 * 2 + 1)
+#define PCH_ADD_1459(a, b) ((a) + (b) + 1459)
+typedef int pch_int_1459;
+int pch_function_1459(pch_int_1459 a, int b);
+#define PCH_VALUE_1460 (1460 * 2 + 1)
+#define PCH_ADD_1460(a, b) ((a) + (b) + 1460)
+typedef int pch_int_1460;
+int pch_function_1460(pch_int_1460 a, int b);
+#define PCH_VALUE_1461 (1461 * 2 + 1)
+#define PCH_ADD_1461(a, b) ((a) + (b) + 1461)
+typedef int pch_int_1461;
+int pch_function_1461(pch_int_1461 a, int b);
+#define PCH_VALUE_1462 (1462 * 2 + 1)
+#define PCH_ADD_1462(a, b) ((a) + (b) + 1462)
+typedef int pch_int_1462;
+int pch_function_1462(pch_int_1462 a, int b);
+#define PCH_VALUE_1463 (1463 * 2 + 1)
+#define PCH_ADD_1463(a, b) ((a) + (b) + 1463)
+typedef int pch_int_1463;
+int pch_function_1463(pch_int_1463 a, int b);
+#define PCH_VALUE_1464 (1464 * 2 + 1)
+#define PCH_ADD_1464(a, b) ((a) + (b) + 1464)
+typedef int pch_int_1464;
+int pch_function_1464(pch_int_1464 a, int b);
+#define PCH_VALUE_1465 (1465 * 2 + 1)
+#define PCH_ADD_1465(a, b) ((a) + (b) + 1465)
+typedef int pch_int_1465;
+int pch_function_1465(pch_int_1465 a, int b);
+#define PCH_VALUE_1466 (1466 * 2 + 1)
+#define PCH_ADD_1466(a, b) ((a) + (b) + 1466)
+typedef int pch_int_1466;
+int pch_function_1466(pch_int_1466 a, int b);
+#define PCH_VALUE_1467 (1467 * 2 + 1)
+#define PCH_ADD_1467(a, b) ((a) + (b) + 1467)
+typedef int pch_int_1467;
+int pch_function_1467(pch_int_1467 a, int b);
+#define PCH_VALUE_1468 (1468 * 2 + 1)
+#define PCH_ADD_1468(a, b) ((a) + (b) + 1468)
+typedef int pch_int_1468;
+int pch_function_1468(pch_int_1468 a, int b);
+#define PCH_VALUE_1469 (1469 * 2 + 1)
+#define PCH_ADD_1469(a, b) ((a) + (b) + 1469)
+typedef int pch_int_1469;
+int pch_function_1469(pch_int_1469 a, int b);
+#define PCH_VALUE_1470 (1470 * 2 + 1)
+#define PCH_ADD_1470(a, b) ((a) + (b) + 1470)
+typedef int pch_int_1470;
+int pch_function_1470(pch_int_1470 a, int b);
+#define PCH_VALUE_1471 (1471 * 2 + 1)
+#define PCH_ADD_1471(a, b) ((a) + (b) + 1471)
+typedef int pch_int_1471;
+int pch_function_1471(pch_int_1471 a, int b);
+#define PCH_VALUE_1472 (1472 * 2 + 1)
+#define PCH_ADD_1472(a, b) ((a) + (b) + 1472)
+typedef int pch_int_1472;
+int pch_function_1472(pch_int_1472 a, int b);
+#define PCH_VALUE_1473 (1473 * 2 + 1)
+#define PCH_ADD_1473(a, b) ((a) + (b) + 1473)
+typedef int pch_int_1473;
+int pch_function_1473(pch_int_1473 a, int b);
+#define PCH_VALUE_1474 (1474 * 2 + 1)
+#define PCH_ADD_1474(a, b) ((a) + (b) + 1474)
+typedef int pch_int_1474;
+int pch_function_1474(pch_int_1474 a, int b);
+#define PCH_VALUE_1475 (1475 * 2 + 1)
+#define PCH_ADD_1475(a, b) ((a) + (b) + 1475)
+typedef int pch_int_1475;
+int pch_function_1475(pch_int_1475 a, int b);
+#define PCH_VALUE_1476 (1476 * 2 + 1)
+#define PCH_ADD_1476(a, b) ((a) + (b) + 1476)
+typedef int pch_int_1476;
+int pch_function_1476(pch_int_1476 a, int b);
+#define PCH_VALUE_1477 (1477 * 2 + 1)
+#define PCH_ADD_1477(a, b) ((a) + (b) + 1477)
+typedef int pch_int_1477;
+int pch_function_1477(pch_int_1477 a, int b);
+#define PCH_VALUE_1478 (1478 * 2 + 1)
+#define PCH_ADD_1478(a, b) ((a) + (b) + 1478)
+typedef int pch_int_1478;
+int pch_function_1478(pch_int_1478 a, int b);
+#define PCH_VALUE_1479 (1479 * 2 + 1)
+#define PCH_ADD_1479(a, b) ((a) + (b) + 1479)
+typedef int pch_int_1479;
+int pch_function_1479(pch_int_1479 a, int b);
+#define PCH_VALUE_1480 (1480 * 2 + 1)
+#define PCH_ADD_1480(a, b) ((a) + (b) + 1480)
+typedef int pch_int_1480;
+int pch_function_1480(pch_int_1480 a, int b);
+#define PCH_VALUE_1481 (1481 * 2 + 1)
+#define PCH_ADD_1481(a, b) ((a) + (b) + 1481)
+typedef int pch_int_1481;
+int pch_function_1481(pch_int_1481 a, int b);
+#define PCH_VALUE_1482 (1482 * 2 + 1)
+#define PCH_ADD_1482(a, b) ((a) + (b) + 1482)
+typedef int pch_int_1482;
+int pch_function_1482(pch_int_1482 a, int b);
+#define PCH_VALUE_1483 (1483 * 2 + 1)
+#define PCH_ADD_1483(a, b) ((a) + (b) + 1483)
+typedef int pch_int_1483;
+int pch_function_1483(pch_int_1483 a, int b);
+#define PCH_VALUE_1484 (1484 * 2 + 1)
+#define PCH_ADD_1484(a, b) ((a) + (b) + 1484)
+typedef int pch_int_1484;
+int pch_function_1484(pch_int_1484 a, int b);
+#define PCH_VALUE_1485 (1485 * 2 + 1)
+#define PCH_ADD_1485(a, b) ((a) + (b) + 1485)
+typedef int pch_int_1485;
+int pch_function_1485(pch_int_1485 a, int b);
+#define PCH_VALUE_1486 (1486 * 2 + 1)
+#define PCH_ADD_1486(a, b) ((a) + (b) + 1486)
+typedef int pch_int_1486;
+int pch_function_1486(pch_int_1486 a, int b);
+#define PCH_VALUE_1487 (1487 * 2 + 1)
+#define PCH_ADD_1487(a, b) ((a) + (b) + 1487)
+typedef int pch_int_1487;
+int pch_function_1487(pch_int_1487 a, int b);
+#define PCH_VALUE_1488 (1488 * 2 + 1)
+#define PCH_ADD_1488(a, b) ((a) + (b) + 1488)
+typedef int pch_int_1488;
+int pch_function_1488(pch_int_1488 a, int b);
+#define PCH_VALUE_1489 (1489 * 2 + 1)
+#define PCH_ADD_1489(a, b) ((a) + (b) + 1489)
+typedef int pch_int_1489;
+int pch_function_1489(pch_int_1489 a, int b);
+#define PCH_VALUE_1490 (1490 * 2 + 1)
+#define PCH_ADD_1490(a, b) ((a) + (b) + 1490)
+typedef int pch_int_1490;
+int pch_function_1490(pch_int_1490 a, int b);
+#define PCH_VALUE_1491 (1491 * 2 + 1)
+#define PCH_ADD_1491(a, b) ((a) + (b) + 1491)
+typedef int pch_int_1491;
+int pch_function_1491(pch_int_1491 a, int b);
+#define PCH_VALUE_1492 (1492 * 2 + 1)
+#define PCH_ADD_1492(a, b) ((a) + (b) + 1492)
+typedef int pch_int_1492;
+int pch_function_1492(pch_int_1492 a, int b);
+#define PCH_VALUE_1493 (1493 * 2 + 1)
+#define PCH_ADD_1493(a, b) ((a) + (b) + 1493)
+typedef int pch_int_1493;
+int pch_function_1493(pch_int_1493 a, int b);
+#define PCH_VALUE_1494 (1494 * 2 + 1)
+#define PCH_ADD_1494(a, b) ((a) + (b) + 1494)
+typedef int pch_int_1494;
+int pch_function_1494(pch_int_1494 a, int b);
+#define PCH_VALUE_1495 (1495 * 2 + 1)
+#define PCH_ADD_1495(a, b) ((a) + (b) + 1495)
+typedef int pch_int_1495;
+int pch_function_1495(pch_int_1495 a, int b);
+#define PCH_VALUE_1496 (1496 * 2 + 1)
+#define PCH_ADD_1496(a, b) ((a) + (b) + 1496)
+typedef int pch_int_1496;
+int pch_function_1496(pch_int_1496 a, int b);
+#define PCH_VALUE_1497 (1497 * 2 + 1)
+#define PCH_ADD_1497(a, b) ((a) + (b) + 1497)
+typedef int pch_int_1497;
+int pch_function_1497(pch_int_1497 a, int b);
+#define PCH_VALUE_1498 (1498 * 2 + 1)
+#define PCH_ADD_1498(a, b) ((a) + (b) + 1498)
+typedef int pch_int_1498;
+int pch_function_1498(pch_int_1498 a, int b);
+#define PCH_VALUE_1499 (1499 * 2 + 1)
+#define PCH_ADD_1499(a, b) ((a) + (b) + 1499)
+typedef int pch_int_1499;
+int pch_function_1499(pch_int_1499 a, int b);
+#define PCH_VALUE_1500 (1500 * 2 + 1)
+#define PCH_ADD_1500(a, b) ((a) + (b) + 1500)
+typedef int pch_int_1500;
+int pch_function_1500(pch_int_1500 a, int b);
+#define PCH_VALUE_1501 (1501 * 2 + 1)
+#define PCH_ADD_1501(a, b) ((a) + (b) + 1501)
+typedef int pch_int_1501;
+int pch_function_1501(pch_int_1501 a, int b);
+#define PCH_VALUE_1502 (1502 * 2 + 1)
+#define PCH_ADD_1502(a, b) ((a) + (b) + 1502)
+typedef int pch_int_1502;
+int pch_function_1502(pch_int_1502 a, int b);
+#define PCH_VALUE_1503 (1503 * 2 + 1)
+#define PCH_ADD_1503(a, b) ((a) + (b) + 1503)
+typedef int pch_int_1503;
+int pch_function_1503(pch_int_1503 a, int b);
+#define PCH_VALUE_1504 (1504 * 2 + 1)
+#define PCH_ADD_1504(a, b) ((a) + (b) + 1504)
+typedef int pch_int_1504;
+int pch_function_1504(pch_int_1504 a, int b);
+#define PCH_VALUE_1505 (1505 * 2 + 1)
+#define PCH_ADD_1505(a, b) ((a) + (b) + 1505)
+typedef int pch_int_1505;
+int pch_function_1505(pch_int_1505 a, int b);
+#define PCH_VALUE_1506 (1506 * 2 + 1)
+#define PCH_ADD_1506(a, b) ((a) + (b) + 1506)
+typedef int pch_int_1506;
+int pch_function_1506(pch_int_1506 a, int b);
+#define PCH_VALUE_1507 (1507 * 2 + 1)
+#define PCH_ADD_1507(a, b) ((a) + (b) + 1507)
+typedef int pch_int_1507;
+int pch_function_1507(pch_int_1507 a, int b);
+#define PCH_VALUE_1508 (1508 * 2 + 1)
+#define PCH_ADD_1508(a, b) ((a) + (b) + 1508)
+typedef int pch_int_1508;
+int pch_function_1508(pch_int_1508 a, int b);
+#define PCH_VALUE_1509 (1509 * 2 + 1)
+#define PCH_ADD_1509(a, b) ((a) + (b) + 1509)
+typedef int pch_int_1509;
+int pch_function_1509(pch_int_1509 a, int b);
+#define PCH_VALUE_1510 (1510 * 2 + 1)
+#define PCH_ADD_1510(a, b) ((a) + (b) + 1510)
+typedef int pch_int_1510;
+int pch_function_1510(pch_int_1510 a, int b);
+#define PCH_VALUE_1511 (1511 * 2 + 1)
+#define PCH_ADD_1511(a, b) ((a) + (b) + 1511)
+typedef int pch_int_1511;
+int pch_function_1511(pch_int_1511 a, int b);
+#define PCH_VALUE_1512 (1512 * 2 + 1)
+#define PCH_ADD_1512(a, b) ((a) + (b) + 1512)
+typedef int pch_int_1512;
+int pch_function_1512(pch_int_1512 a, int b);
+#define PCH_VALUE_1513 (1513 * 2 + 1)
+#define PCH_ADD_1513(a, b) ((a) + (b) + 1513)
+typedef int pch_int_1513;
+int pch_function_1513(pch_int_1513 a, int b);
+#define PCH_VALUE_1514 (1514 * 2 + 1)
+#define PCH_ADD_1514(a, b) ((a) + (b) + 1514)
+typedef int pch_int_1514;
+int pch_function_1514(pch_int_1514 a, int b);
+#define PCH_VALUE_1515 (1515 * 2 + 1)
+#define PCH_ADD_1515(a, b) ((a) + (b) + 1515)
+typedef int pch_int_1515;
+int pch_function_1515(pch_int_1515 a, int b);
+#define PCH_VALUE_1516 (1516 * 2 + 1)
+#define PCH_ADD_1516(a, b) ((a) + (b) + 1516)
+typedef int pch_int_1516;
+int pch_function_1516(pch_int_1516 a, int b);
+#define PCH_VALUE_1517 (1517 * 2 + 1)
+#define PCH_ADD_1517(a, b) ((a) + (b) + 1517)
+typedef int pch_int_1517;
+int pch_function_1517(pch_int_1517 a, int b);
+#define PCH_VALUE_1518 (1518 * 2 + 1)
+#define PCH_ADD_1518(a, b) ((a) + (b) + 1518)
+typedef int pch_int_1518;
+int pch_function_1518(pch_int_1518 a, int b);
+#define PCH_VALUE_1519 (1519 * 2 + 1)
+#define PCH_ADD_1519(a, b) ((a) + (b) + 1519)
+typedef int pch_int_1519;
+int pch_function_1519(pch_int_1519 a, int b);
+#define PCH_VALUE_1520 (1520 * 2 + 1)
+#define PCH_ADD_1520(a, b) ((a) + (b) + 1520)
+typedef int pch_int_1520;
+int pch_function_1520(pch_int_1520 a, int b);
+#define PCH_VALUE_1521 (1521 * 2 + 1)
+#define PCH_ADD_1521(a, b) ((a) + (b) + 1521)
+typedef int pch_int_1521;
+int pch_function_1521(pch_int_1521 a, int b);
+#define PCH_VALUE_1522 (1522 * 2 + 1)
+#define PCH_ADD_1522(a, b) ((a) + (b) + 1522)
+typedef int pch_int_1522;
+int pch_function_1522(pch_int_1522 a, int b);
+#define PCH_VALUE_1523 (1523 * 2 + 1)
+#define PCH_ADD_1523(a, b) ((a) + (b) + 1523)
+typedef int pch_int_1523;
+int pch_function_1523(pch_int_1523 a, int b);
+#define PCH_VALUE_1524 (1524 * 2 + 1)
+#define PCH_ADD_1524(a, b) ((a) + (b) + 1524)
+typedef int pch_int_1524;
+int pch_function_1524(pch_int_1524 a, int b);
+#define PCH_VALUE_1525 (1525 * 2 + 1)
+#define PCH_ADD_1525(a, b) ((a) + (b) + 1525)
+typedef int pch_int_1525;
+int pch_function_1525(pch_int_1525 a, int b);
+#define PCH_VALUE_1526 (1526 * 2 + 1)
+#define PCH_ADD_1526(a, b) ((a) + (b) + 1526)
+typedef int pch_int_1526;
+int pch_function_1526(pch_int_1526 a, int b);
+#define PCH_VALUE_1527 (1527 * 2 + 1)
+#define PCH_ADD_1527(a, b) ((a) + (b) + 1527)
+typedef int pch_int_1527;
+int pch_function_1527(pch_int_1527 a, int b);
+#define PCH_VALUE_1528 (1528 * 2 + 1)
+#define PCH_ADD_1528(a, b) ((a) + (b) + 1528)
+typedef int pch_int_1528;
+int pch_function_1528(pch_int_1528 a, int b);
+#define PCH_VALUE_1529 (1529 * 2 + 1)
+#define PCH_ADD_1529(a, b) ((a) + (b) + 1529)
+typedef int pch_int_1529;
+int pch_function_1529(pch_int_1529 a, int b);
+#define PCH_VALUE_1530 (1530 * 2 + 1)
+#define PCH_ADD_1530(a, b) ((a) + (b) + 1530)
+typedef int pch_int_1530;
+int pch_function_1530(pch_int_1530 a, int b);
+#define PCH_VALUE_1531 (1531 * 2 + 1)
+#define PCH_ADD_1531(a, b) ((a) + (b) + 1531)
+typedef int pch_int_1531;
+int pch_function_1531(pch_int_1531 a, int b);
+#define PCH_VALUE_1532 (1532 * 2 + 1)
+#define PCH_ADD_1532(a, b) ((a) + (b) + 1532)
+typedef int pch_int_1532;
+int pch_function_1532(pch_int_1532 a, int b);
+#define PCH_VALUE_1533 (1533 * 2 + 1)
+#define PCH_ADD_1533(a, b) ((a) + (b) + 1533)
+typedef int pch_int_1533;
+int pch_function_1533(pch_int_1533 a, int b);
+#define PCH_VALUE_1534 (1534 * 2 + 1)
+#define PCH_ADD_1534(a, b) ((a) + (b) + 1534)
+typedef int pch_int_1534;
+int pch_function_1534(pch_int_1534 a, int b);
+#define PCH_VALUE_1535 (1535 * 2 + 1)
+#define PCH_ADD_1535(a, b) ((a) + (b) + 1535)
+typedef int pch_int_1535;
+int pch_function_1535(pch_int_1535 a, int b);
+#define PCH_VALUE_1536 (1536 * 2 + 1)
+#define PCH_ADD_1536(a, b) ((a) + (b) + 1536)
+typedef int pch_int_1536;
+int pch_function_1536(pch_int_1536 a, int b);
+#define PCH_VALUE_1537 (1537 * 2 + 1)
+#define PCH_ADD_1537(a, b) ((a) + (b) + 1537)
+typedef int pch_int_1537;
+int pch_function_1537(pch_int_1537 a, int b);
+#define PCH_VALUE_1538 (1538 * 2 + 1)
+#define PCH_ADD_1538(a, b) ((a) + (b) + 1538)
+typedef int pch_int_1538;
+int pch_function_1538(pch_int_1538 a, int b);
+#define PCH_VALUE_1539 (1539 * 2 + 1)
+#define PCH_ADD_1539(a, b) ((a) + (b) + 1539)
+typedef int pch_int_1539;
+int pch_function_1539(pch_int_1539 a, int b);
+#define PCH_VALUE_1540 (1540 * 2 + 1)
+#define PCH_ADD_1540(a, b) ((a) + (b) + 1540)
+typedef int pch_int_1540;
+int pch_function_1540(pch_int_1540 a, int b);
+#define PCH_VALUE_1541 (1541 * 2 + 1)
+#define PCH_ADD_1541(a, b) ((a) + (b) + 1541)
+typedef int pch_int_1541;
+int pch_function_1541(pch_int_1541 a, int b);
+#define PCH_VALUE_1542 (1542 * 2 + 1)
+#define PCH_ADD_1542(a, b) ((a) + (b) + 1542)
+typedef int pch_int_1542;
+int pch_function_1542(pch_int_1542 a, int b);
+#define PCH_VALUE_1543 (1543 * 2 + 1)
+#define PCH_ADD_1543(a, b) ((a) + (b) + 1543)
+typedef int pch_int_1543;
+int pch_function_1543(pch_int_1543 a, int b);
+#define PCH_VALUE_1544 (1544 * 2 + 1)
+#define PCH_ADD_1544(a, b) ((a) + (b) + 1544)
+typedef int pch_int_1544;
+int pch_function_1544(pch_int_1544 a, int b);
+#define PCH_VALUE_1545 (1545 * 2 + 1)
+#define PCH_ADD_1545(a, b) ((a) + (b) + 1545)
+typedef int pch_int_1545;
+int pch_function_1545(pch_int_1545 a, int b);
+#define PCH_VALUE_1546 (1546 * 2 + 1)
+#define PCH_ADD_1546(a, b) ((a) + (b) + 1546)
+typedef int pch_int_1546;
+int pch_function_1546(pch_int_1546 a, int b);
+#define PCH_VALUE_1547 (1547 * 2 + 1)
+#define PCH_ADD_1547(a, b) ((a) + (b) + 1547)
+typedef int pch_int_1547;
+int pch_function_1547(pch_int_1547 a, int b);
+#define PCH_VALUE_1548 (1548 * 2 + 1)
+#define PCH_ADD_1548(a, b) ((a) + (b) + 1548)
+typedef int pch_int_1548;
+int pch_function_1548(pch_int_1548 a, int b);
+#define PCH_VALUE_1549 (1549 * 2 + 1)
+#define PCH_ADD_1549(a, b) ((a) + (b) + 1549)
+typedef int pch_int_1549;
+int pch_function_1549(pch_int_1549 a, int b);
+#define PCH_VALUE_1550 (1550 * 2 + 1)
+#define PCH_ADD_1550(a, b) ((a) + (b) + 1550)
+typedef int pch_int_1550;
+int pch_function_1550(pch_int_1550 a, int b);
+#define PCH_VALUE_1551 (1551 * 2 + 1)
+#define PCH_ADD_1551(a, b) ((a) + (b) + 1551)
+typedef int pch_int_1551;
+int pch_function_1551(pch_int_1551 a, int b);
+#define PCH_VALUE_1552 (1552 * 2 + 1)
+#define PCH_ADD_1552(a, b) ((a) + (b) + 1552)
+typedef int pch_int_1552;
+int pch_function_1552(pch_int_1552 a, int b);
+#define PCH_VALUE_1553 (1553 * 2 + 1)
+#define PCH_ADD_1553(a, b) ((a) + (b) + 1553)
+typedef int pch_int_1553;
+int pch_function_1553(pch_int_1553 a, int b);
+#define PCH_VALUE_1554 (1554 * 2 + 1)
+#define PCH_ADD_1554(a, b) ((a) + (b) + 1554)
+typedef int pch_int_1554;
+int pch_function_1554(pch_int_1554 a, int b);
+#define PCH_VALUE_1555 (1555 * 2 + 1)
+#define PCH_ADD_1555(a, b) ((a) + (b) + 1555)
+typedef int pch_int_1555;
+int pch_function_1555(pch_int_1555 a, int b);
+#define PCH_VALUE_1556 (1556 * 2 + 1)
+#define PCH_ADD_1556(a, b) ((a) + (b) + 1556)
+typedef int pch_int_1556;
+int pch_function_1556(pch_int_1556 a, int b);
+#define PCH_VALUE_1557 (1557 * 2 + 1)
+#define PCH_ADD_1557(a, b) ((a) + (b) + 1557)
+typedef int pch_int_1557;
+int pch_function_1557(pch_int_1557 a, int b);
+#define PCH_VALUE_1558 (1558 * 2 + 1)
+#define PCH_ADD_1558(a, b) ((a) + (b) + 1558)
+typedef int pch_int_1558;
+int pch_function_1558(pch_int_1558 a, int b);
+#define PCH_VALUE_1559 (1559 * 2 + 1)
+#define PCH_ADD_1559(a, b) ((a) + (b) + 1559)
+typedef int pch_int_1559;
+int pch_function_1559(pch_int_1559 a, int b);
+#define PCH_VALUE_1560 (1560 * 2 + 1)
+#define PCH_ADD_1560(a, b) ((a) + (b) + 1560)
+typedef int pch_int_1560;
+int pch_function_1560(pch_int_1560 a, int b);
+#define PCH_VALUE_1561 (1561 * 2 + 1)
+#define PCH_ADD_1561(a, b) ((a) + (b) + 1561)
+typedef int pch_int_1561;
+int pch_function_1561(pch_int_1561 a, int b);
+#define PCH_VALUE_1562 (1562 * 2 + 1)
+#define PCH_ADD_1562(a, b) ((a) + (b) + 1562)
+typedef int pch_int_1562;
+int pch_function_1562(pch_int_1562 a, int b);
+#define PCH_VALUE_1563 (1563 * 2 + 1)
+#define PCH_ADD_1563(a, b) ((a) + (b) + 1563)
+typedef int pch_int_1563;
+int pch_function_1563(pch_int_1563 a, int b);
+#define PCH_VALUE_1564 (1564 * 2 + 1)
+#define PCH_ADD_1564(a, b) ((a) + (b) + 1564)
+typedef int pch_int_1564;
+int pch_function_1564(pch_int_1564 a, int b);
+#define PCH_VALUE_1565 (1565 * 2 + 1)
+#define PCH_ADD_1565(a, b) ((a) + (b) + 1565)
+typedef int pch_int_1565;
+int pch_function_1565(pch_int_1565 a, int b);
+#define PCH_VALUE_1566 (1566 * 2 + 1)
+#define PCH_ADD_1566(a, b) ((a) + (b) + 1566)
+typedef int pch_int_1566;
+int pch_function_1566(pch_int_1566 a, int b);
+#define PCH_VALUE_1567 (1567 * 2 + 1)
+#define PCH_ADD_1567(a, b) ((a) + (b) + 1567)
+typedef int pch_int_1567;
+int pch_function_1567(pch_int_1567 a, int b);
+#define PCH_VALUE_1568 (1568 * 2 + 1)
+#define PCH_ADD_1568(a, b) ((a) + (b) + 1568)
+typedef int pch_int_1568;
+int pch_function_1568(pch_int_1568 a, int b);
+#define PCH_VALUE_1569 (1569 * 2 + 1)
+#define PCH_ADD_1569(a, b) ((a) + (b) + 1569)
+typedef int pch_int_1569;
+int pch_function_1569(pch_int_1569 a, int b);
+#define PCH_VALUE_1570 (1570 * 2 + 1)
+#define PCH_ADD_1570(a, b) ((a) + (b) + 1570)
+typedef int pch_int_1570;
+int pch_function_1570(pch_int_1570 a, int b);
+#define PCH_VALUE_1571 (1571 * 2 + 1)
+#define PCH_ADD_1571(a, b) ((a) + (b) + 1571)
+typedef int pch_int_1571;
+int pch_function_1571(pch_int_1571 a, int b);
+#define PCH_VALUE_1572 (1572 * 2 + 1)
+#define PCH_ADD_1572(a, b) ((a) + (b) + 1572)
+typedef int pch_int_1572;
+int pch_function_1572(pch_int_1572 a, int b);
+#define PCH_VALUE_1573 (1573 * 2 + 1)
+#define PCH_ADD_1573(a, b) ((a) + (b) + 1573)
+typedef int pch_int_1573;
+int pch_function_1573(pch_int_1573 a, int b);
+#define PCH_VALUE_1574 (1574 * 2 + 1)
+#define PCH_ADD_1574(a, b) ((a) + (b) + 1574)
+typedef int pch_int_1574;
+int pch_function_1574(pch_int_1574 a, int b);
+#define PCH_VALUE_1575 (1575 * 2 + 1)
+#define PCH_ADD_1575(a, b) ((a) + (b) + 1575)
+typedef int pch_int_1575;
+int pch_function_1575(pch_int_1575 a, int b);
+#define PCH_VALUE_1576 (1576 * 2 + 1)
+#define PCH_ADD_1576(a, b) ((a) + (b) + 1576)
+typedef int pch_int_1576;
+int pch_function_1576(pch_int_1576 a, int b);
+#define PCH_VALUE_1577 (1577 * 2 + 1)
+#define PCH_ADD_1577(a, b) ((a) + (b) + 1577)
+typedef int pch_int_1577;
+int pch_function_1577(pch_int_1577 a, int b);
+#define PCH_VALUE_1578 (1578 * 2 + 1)
+#define PCH_ADD_1578(a, b) ((a) + (b) + 1578)
+typedef int pch_int_1578;
+int pch_function_1578(pch_int_1578 a, int b);
+#define PCH_VALUE_1579 (1579 * 2 + 1)
+#define PCH_ADD_1579(a, b) ((a) + (b) + 1579)
+typedef int pch_int_1579;
+int pch_function_1579(pch_int_1579 a, int b);
+#define PCH_VALUE_1580 (1580 * 2 + 1)
+#define PCH_ADD_1580(a, b) ((a) + (b) + 1580)
+typedef int pch_int_1580;
+int pch_function_1580(pch_int_1580 a, int b);
+#define PCH_VALUE_1581 (1581 * 2 + 1)
+#define PCH_ADD_1581(a, b) ((a) + (b) + 1581)
+typedef int pch_int_1581;
+int pch_function_1581(pch_int_1581 a, int b);
+#define PCH_VALUE_1582 (1582 * 2 + 1)
+#define PCH_ADD_1582(a, b) ((a) + (b) + 1582)
+typedef int pch_int_1582;
+int pch_function_1582(pch_int_1582 a, int b);
+#define PCH_VALUE_1583 (1583 * 2 + 1)
+#define PCH_ADD_1583(a, b) ((a) + (b) + 1583)
+typedef int pch_int_1583;
+int pch_function_1583(pch_int_1583 a, int b);
+#define PCH_VALUE_1584 (1584 * 2 + 1)
+#define PCH_ADD_1584(a, b) ((a) + (b) + 1584)
+typedef int pch_int_1584;
+int pch_function_1584(pch_int_1584 a, int b);
+#define PCH_VALUE_1585 (1585 * 2 + 1)
+#define PCH_ADD_1585(a, b) ((a) + (b) + 1585)
+typedef int pch_int_1585;
+int pch_function_1585(pch_int_1585 a, int b);
+#define PCH_VALUE_1586 (1586 * 2 + 1)
+#define PCH_ADD_1586(a, b) ((a) + (b) + 1586)
+typedef int pch_int_1586;
+int pch_function_1586(pch_int_1586 a, int b);
+#define PCH_VALUE_1587 (1587 * 2 + 1)
+#define PCH_ADD_1587(a, b) ((a) + (b) + 1587)
+typedef int pch_int_1587;
+int pch_function_1587(pch_int_1587 a, int b);
+#define PCH_VALUE_1588 (1588 * 2 + 1)
+#define PCH_ADD_1588(a, b) ((a) + (b) + 1588)
+typedef int pch_int_1588;
+int pch_function_1588(pch_int_1588 a, int b);
+#define PCH_VALUE_1589 (1589 * 2 + 1)
+#define PCH_ADD_1589(a, b) ((a) + (b) + 1589)
+typedef int pch_int_1589;
+int pch_function_1589(pch_int_1589 a, int b);
+#define PCH_VALUE_1590 (1590 * 2 + 1)
+#define PCH_ADD_1590(a, b) ((a) + (b) + 1590)
+typedef int pch_int_1590;
+int pch_function_1590(pch_int_1590 a, int b);
+#define PCH_VALUE_1591 (1591 * 2 + 1)
+#define PCH_ADD_1591(a, b) ((a) + (b) + 1591)
+typedef int pch_int_1591;
+int pch_function_1591(pch_int_1591 a, int b);
+#define PCH_VALUE_1592 (1592 * 2 + 1)
+#define PCH_ADD_1592(a, b) ((a) + (b) + 1592)
+typedef int pch_int_1592;
+int pch_function_1592(pch_int_1592 a, int b);
+#define PCH_VALUE_1593 (1593 * 2 + 1)
+#define PCH_ADD_1593(a, b) ((a) + (b) + 1593)
+typedef int pch_int_1593;
+int pch_function_1593(pch_int_1593 a, int b);
+#define PCH_VALUE_1594 (1594 * 2 + 1)
+#define PCH_ADD_1594(a, b) ((a) + (b) + 1594)
+typedef int pch_int_1594;
+int pch_function_1594(pch_int_1594 a, int b);
+#define PCH_VALUE_1595 (1595 * 2 + 1)
+#define PCH_ADD_1595(a, b) ((a) + (b) + 1595)
+typedef int pch_int_1595;
+int pch_function_1595(pch_int_1595 a, int b);
+#define PCH_VALUE_1596 (1596 * 2 + 1)
+#define PCH_ADD_1596(a, b) ((a) + (b) + 1596)
+typedef int pch_int_1596;
+int pch_function_1596(pch_int_1596 a, int b);
+#define PCH_VALUE_1597 (1597 * 2 + 1)
+#define PCH_ADD_1597(a, b) ((a) + (b) + 1597)
+typedef int pch_int_1597;
+int pch_function_1597(pch_int_1597 a, int b);
+#define PCH_VALUE_1598 (1598 * 2 + 1)
+#define PCH_ADD_1598(a, b) ((a) + (b) + 1598)
+typedef int pch_int_1598;
+int pch_function_1598(pch_int_1598 a, int b);
+#define PCH_VALUE_1599 (1599 * 2 + 1)
+#define PCH_ADD_1599(a, b) ((a) + (b) + 1599)
+typedef int pch_int_1599;
+int pch_function_1599(pch_int_1599 a, int b);
+#define PCH_VALUE_1600 (1600 * 2 + 1)
+#define PCH_ADD_1600(a, b) ((a) + (b) + 1600)
+typedef int pch_int_1600;
+int pch_function_1600(pch_int_1600 a, int b);
+#define PCH_VALUE_1601 (1601 * 2 + 1)
+#define PCH_ADD_1601(a, b) ((a) + (b) + 1601)
+typedef int pch_int_1601;
+int pch_function_1601(pch_int_1601 a, int b);
+#define PCH_VALUE_1602 (1602 * 2 + 1)
+#define PCH_ADD_1602(a, b) ((a) + (b) + 1602)
+typedef int pch_int_1602;
+int pch_function_1602(pch_int_1602 a, int b);
+#define PCH_VALUE_1603 (1603 * 2 + 1)
+#define PCH_ADD_1603(a, b) ((a) + (b) + 1603)
+typedef int pch_int_1603;
+int pch_function_1603(pch_int_1603 a, int b);
+#define PCH_VALUE_1604 (1604 * 2 + 1)
+#define PCH_ADD_1604(a, b) ((a) + (b) + 1604)
+typedef int pch_int_1604;
+int pch_function_1604(pch_int_1604 a, int b);
+#define PCH_VALUE_1605 (1605 * 2 + 1)
+#define PCH_ADD_1605(a, b) ((a) + (b) + 1605)
+typedef int pch_int_1605;
+int pch_function_1605(pch_int_1605 a, int b);
+#define PCH_VALUE_1606 (1606 * 2 + 1)
+#define PCH_ADD_1606(a, b) ((a) + (b) + 1606)
+typedef int pch_int_1606;
+int pch_function_1606(pch_int_1606 a, int b);
+#define PCH_VALUE_1607 (1607 * 2 + 1)
+#define PCH_ADD_1607(a, b) ((a) + (b) + 1607)
+typedef int pch_int_1607;
+int pch_function_1607(pch_int_1607 a, int b);
+#define PCH_VALUE_1608 (1608 * 2 + 1)
+#define PCH_ADD_1608(a, b) ((a) + (b) + 1608)
+typedef int pch_int_1608;
+int pch_function_1608(pch_int_1608 a, int b);
+#define PCH_VALUE_1609 (1609 * 2 + 1)
+#define PCH_ADD_1609(a, b) ((a) + (b) + 1609)
+typedef int pch_int_1609;
+int pch_function_1609(pch_int_1609 a, int b);
+#define PCH_VALUE_1610 (1610 * 2 + 1)
+#define PCH_ADD_1610(a, b) ((a) + (b) + 1610)
+typedef int pch_int_1610;
+int pch_function_1610(pch_int_1610 a, int b);
+#define PCH_VALUE_1611 (1611 * 2 + 1)
+#define PCH_ADD_1611(a, b) ((a) + (b) + 1611)
+typedef int pch_int_1611;
+int pch_function_1611(pch_int_1611 a, int b);
+#define PCH_VALUE_1612 (1612 * 2 + 1)
+#define PCH_ADD_1612(a, b) ((a) + (b) + 1612)
+typedef int pch_int_1612;
+int pch_function_1612(pch_int_1612 a, int b);
+#define PCH_VALUE_1613 (1613 * 2 + 1)
+#define PCH_ADD_1613(a, b) ((a) + (b) + 1613)
+typedef int pch_int_1613;
+int pch_function_1613(pch_int_1613 a, int b);
+#define PCH_VALUE_1614 (1614 * 2 + 1)
+#define PCH_ADD_1614(a, b) ((a) + (b) + 1614)
+typedef int pch_int_1614;
+int pch_function_1614(pch_int_1614 a, int b);
+#define PCH_VALUE_1615 (1615 * 2 + 1)
+#define PCH_ADD_1615(a, b) ((a) + (b) + 1615)
+typedef int pch_int_1615;
+int pch_function_1615(pch_int_1615 a, int b);
+#define PCH_VALUE_1616 (1616 * 2 + 1)
+#define PCH_ADD_1616(a, b) ((a) + (b) + 1616)
+typedef int pch_int_1616;
+int pch_function_1616(pch_int_1616 a, int b);
+#define PCH_VALUE_1617 (1617 * 2 + 1)
+#define PCH_ADD_1617(a, b) ((a) + (b) + 1617)
+typedef int pch_int_1617;
+int pch_function_1617(pch_int_1617 a, int b);
+#define PCH_VALUE_1618 (1618 * 2 + 1)
+#define PCH_ADD_1618(a, b) ((a) + (b) + 1618)
+typedef int pch_int_1618;
+int pch_function_1618(pch_int_1618 a, int b);
+#define PCH_VALUE_1619 (1619 * 2 + 1)
+#define PCH_ADD_1619(a, b) ((a) + (b) + 1619)
+typedef int pch_int_1619;
+int pch_function_1619(pch_int_1619 a, int b);
+#define PCH_VALUE_1620 (1620 * 2 + 1)
+#define PCH_ADD_1620(a, b) ((a) + (b) + 1620)
+typedef int pch_int_1620;
+int pch_function_1620(pch_int_1620 a, int b);
+#define PCH_VALUE_1621 (1621 * 2 + 1)
+#define PCH_ADD_1621(a, b) ((a) + (b) + 1621)
+typedef int pch_int_1621;
+int pch_function_1621(pch_int_1621 a, int b);
+#define PCH_VALUE_1622 (1622 * 2 + 1)
+#define PCH_ADD_1622(a, b) ((a) + (b) + 1622)
+typedef int pch_int_1622;
+int pch_function_1622(pch_int_1622 a, int b);
+#define PCH_VALUE_1623 (1623 * 2 + 1)
+#define PCH_ADD_1623(a, b) ((a) + (b) + 1623)
+typedef int pch_int_1623;
+int pch_function_1623(pch_int_1623 a, int b);
+#define PCH_VALUE_1624 (1624 * 2 + 1)
+#define PCH_ADD_1624(a, b) ((a) + (b) + 1624)
+typedef int pch_int_1624;
+int pch_function_1624(pch_int_1624 a, int b);
+#define PCH_VALUE_1625 (1625 * 2 + 1)
+#define PCH_ADD_1625(a, b) ((a) + (b) + 1625)
+typedef int pch_int_1625;
+int pch_function_1625(pch_int_1625 a, int b);
+#define PCH_VALUE_1626 (1626 * 2 + 1)
+#define PCH_ADD_1626(a, b) ((a) + (b) + 1626)
+typedef int pch_int_1626;
+int pch_function_1626(pch_int_1626 a, int b);
+#define PCH_VALUE_1627 (1627 * 2 + 1)
+#define PCH_ADD_1627(a, b) ((a) + (b) + 1627)
+typedef int pch_int_1627;
+int pch_function_1627(pch_int_1627 a, int b);
+#define PCH_VALUE_1628 (1628 * 2 + 1)
+#define PCH_ADD_1628(a, b) ((a) + (b) + 1628)
+typedef int pch_int_1628;
+int pch_function_1628(pch_int_1628 a, int b);
+#define PCH_VALUE_1629 (1629 * 2 + 1)
+#define PCH_ADD_1629(a, b) ((a) + (b) + 1629)
+typedef int pch_int_1629;
+int pch_function_1629(pch_int_1629 a, int b);
+#define PCH_VALUE_1630 (1630 * 2 + 1)
+#define PCH_ADD_1630(a, b) ((a) + (b) + 1630)
+typedef int pch_int_1630;
+int pch_function_1630(pch_int_1630 a, int b);
+#define PCH_VALUE_1631 (1631 * 2 + 1)
+#define PCH_ADD_1631(a, b) ((a) + (b) + 1631)
+typedef int pch_int_1631;
+int pch_function_1631(pch_int_1631 a, int b);
+#define PCH_VALUE_1632 (1632 * 2 + 1)
+#define PCH_ADD_1632(a, b) ((a) + (b) + 1632)
+typedef int pch_int_1632;
+int pch_function_1632(pch_int_1632 a, int b);
+#define PCH_VALUE_1633 (1633 * 2 + 1)
+#define PCH_ADD_1633(a, b) ((a) + (b) + 1633)
+typedef int pch_int_1633;
+int pch_function_1633(pch_int_1633 a, int b);
+#define PCH_VALUE_1634 (1634 * 2 + 1)
+#define PCH_ADD_1634(a, b) ((a) + (b) + 1634)
+typedef int pch_int_1634;
+int pch_function_1634(pch_int_1634 a, int b);
+#define PCH_VALUE_1635 (1635 * 2 + 1)
+#define PCH_ADD_1635(a, b) ((a) + (b) + 1635)
+typedef int pch_int_1635;
+int pch_function_1635(pch_int_1635 a, int b);
+#define PCH_VALUE_1636 (1636 * 2 + 1)
+#define PCH_ADD_1636(a, b) ((a) + (b) + 1636)
+typedef int pch_int_1636;
+int pch_function_1636(pch_int_1636 a, int b);
+#define PCH_VALUE_1637 (1637 * 2 + 1)
+#define PCH_ADD_1637(a, b) ((a) + (b) + 1637)
+typedef int pch_int_1637;
+int pch_function_1637(pch_int_1637 a, int b);
+#define PCH_VALUE_1638 (1638 * 2 + 1)
+#define PCH_ADD_1638(a, b) ((a) + (b) + 1638)
+typedef int pch_int_1638;
+int pch_function_1638(pch_int_1638 a, int b);
+#define PCH_VALUE_1639 (1639 * 2 + 1)
+#define PCH_ADD_1639(a, b) ((a) + (b) + 1639)
+typedef int pch_int_1639;
+int pch_function_1639(pch_int_1639 a, int b);
+#define PCH_VALUE_1640 (1640 * 2 + 1)
+#define PCH_ADD_1640(a, b) ((a) + (b) + 1640)
+typedef int pch_int_1640;
+int pch_function_1640(pch_int_1640 a, int b);
+#define PCH_VALUE_1641 (1641 * 2 + 1)
+#define PCH_ADD_1641(a, b) ((a) + (b) + 1641)
+typedef int pch_int_1641;
+int pch_function_1641(pch_int_1641 a, int b);
+#define PCH_VALUE_1642 (1642 * 2 + 1)
+#define PCH_ADD_1642(a, b) ((a) + (b) + 1642)
+typedef int pch_int_1642;
+int pch_function_1642(pch_int_1642 a, int b);
+#define PCH_VALUE_1643 (1643 * 2 + 1)
+#define PCH_ADD_1643(a, b) ((a) + (b) + 1643)
+typedef int pch_int_1643;
+int pch_function_1643(pch_int_1643 a, int b);
+#define PCH_VALUE_1644 (1644 * 2 + 1)
+#define PCH_ADD_1644(a, b) ((a) + (b) + 1644)
+typedef int pch_int_1644;
+int pch_function_1644(pch_int_1644 a, int b);
+#define PCH_VALUE_1645 (1645 * 2 + 1)
+#define PCH_ADD_1645(a, b) ((a) + (b) + 1645)
+typedef int pch_int_1645;
+int pch_function_1645(pch_int_1645 a, int b);
+#define PCH_VALUE_1646 (1646 * 2 + 1)
+#define PCH_ADD_1646(a, b) ((a) + (b) + 1646)
+typedef int pch_int_1646;
+int pch_function_1646(pch_int_1646 a, int b);
+#define PCH_VALUE_1647 (1647 * 2 + 1)
+#define PCH_ADD_1647(a, b) ((a) + (b) + 1647)
+typedef int pch_int_1647;
+int pch_function_1647(pch_int_1647 a, int b);
+#define PCH_VALUE_1648 (1648 * 2 + 1)
+#define PCH_ADD_1648(a, b) ((a) + (b) + 1648)
+typedef int pch_int_1648;
+int pch_function_1648(pch_int_1648 a, int b);
+#define PCH_VALUE_1649 (1649 * 2 + 1)
+#define PCH_ADD_1649(a, b) ((a) + (b) + 1649)
+typedef int pch_int_1649;
+int pch_function_1649(pch_int_1649 a, int b);
+#define PCH_VALUE_1650 (1650 * 2 + 1)
+#define PCH_ADD_1650(a, b) ((a) + (b) + 1650)
+typedef int pch_int_1650;
+int pch_function_1650(pch_int_1650 a, int b);
+#define PCH_VALUE_1651 (1651 * 2 + 1)
+#define PCH_ADD_1651(a, b) ((a) + (b) + 1651)
+typedef int pch_int_1651;
+int pch_function_1651(pch_int_1651 a, int b);
+#define PCH_VALUE_1652 (1652 * 2 + 1)
+#define PCH_ADD_1652(a, b) ((a) + (b) + 1652)
+typedef int pch_int_1652;
+int pch_function_1652(pch_int_1652 a, int b);
+#define PCH_VALUE_1653 (1653 * 2 + 1)
+#define PCH_ADD_1653(a, b) ((a) + (b) + 1653)
+typedef int pch_int_1653;
+int pch_function_1653(pch_int_1653 a, int b);
+#define PCH_VALUE_1654 (1654 * 2 + 1)
+#define PCH_ADD_1654(a, b) ((a) + (b) + 1654)
+typedef int pch_int_1654;
+int pch_function_1654(pch_int_1654 a, int b);
+#define PCH_VALUE_1655 (1655 * 2 + 1)
+#define PCH_ADD_1655(a, b) ((a) + (b) + 1655)
+typedef int pch_int_1655;
+int pch_function_1655(pch_int_1655 a, int b);
+#define PCH_VALUE_1656 (1656 * 2 + 1)
+#define PCH_ADD_1656(a, b) ((a) + (b) + 1656)
+typedef int pch_int_1656;
+int pch_function_1656(pch_int_1656 a, int b);
+#define PCH_VALUE_1657 (1657 * 2 + 1)
+#define PCH_ADD_1657(a, b) ((a) + (b) + 1657)
+typedef int pch_int_1657;
+int pch_function_1657(pch_int_1657 a, int b);
+#define PCH_VALUE_1658 (1658 * 2 + 1)
+#define PCH_ADD_1658(a, b) ((a) + (b) + 1658)
+typedef int pch_int_1658;
+int pch_function_1658(pch_int_1658 a, int b);
+#define PCH_VALUE_1659 (1659 * 2 + 1)
+#define PCH_ADD_1659(a, b) ((a) + (b) + 1659)
+typedef int pch_int_1659;
+int pch_function_1659(pch_int_1659 a, int b);
+#define PCH_VALUE_1660 (1660 * 2 + 1)
+#define PCH_ADD_1660(a, b) ((a) + (b) + 1660)
+typedef int pch_int_1660;
+int pch_function_1660(pch_int_1660 a, int b);
+#define PCH_VALUE_1661 (1661 * 2 + 1)
+#define PCH_ADD_1661(a, b) ((a) + (b) + 1661)
+typedef int pch_int_1661;
+int pch_function_1661(pch_int_1661 a, int b);
+#define PCH_VALUE_1662 (1662 * 2 + 1)
+#define PCH_ADD_1662(a, b) ((a) + (b) + 1662)
+typedef int pch_int_1662;
+int pch_function_1662(pch_int_1662 a, int b);
+#define PCH_VALUE_1663 (1663 * 2 + 1)
+#define PCH_ADD_1663(a, b) ((a) + (b) + 1663)
+typedef int pch_int_1663;
+int pch_function_1663(pch_int_1663 a, int b);
+#define PCH_VALUE_1664 (1664 * 2 + 1)
+#define PCH_ADD_1664(a, b) ((a) + (b) + 1664)
+typedef int pch_int_1664;
+int pch_function_1664(pch_int_1664 a, int b);
+#define PCH_VALUE_1665 (1665 * 2 + 1)
+#define PCH_ADD_1665(a, b) ((a) + (b) + 1665)
+typedef int pch_int_1665;
+int pch_function_1665(pch_int_1665 a, int b);
+#define PCH_VALUE_1666 (1666 * 2 + 1)
+#define PCH_ADD_1666(a, b) ((a) + (b) + 1666)
+typedef int pch_int_1666;
+int pch_function_1666(pch_int_1666 a, int b);
+#define PCH_VALUE_1667 (1667 * 2 + 1)
+#define PCH_ADD_1667(a, b) ((a) + (b) + 1667)
+typedef int pch_int_1667;
+int pch_function_1667(pch_int_1667 a, int b);
+#define PCH_VALUE_1668 (1668 * 2 + 1)
+#define PCH_ADD_1668(a, b) ((a) + (b) + 1668)
+typedef int pch_int_1668;
+int pch_function_1668(pch_int_1668 a, int b);
+#define PCH_VALUE_1669 (1669 * 2 + 1)
+#define PCH_ADD_1669(a, b) ((a) + (b) + 1669)
+typedef int pch_int_1669;
+int pch_function_1669(pch_int_1669 a, int b);
+#define PCH_VALUE_1670 (1670 * 2 + 1)
+#define PCH_ADD_1670(a, b) ((a) + (b) + 1670)
+typedef int pch_int_1670;
+int pch_function_1670(pch_int_1670 a, int b);
+#define PCH_VALUE_1671 (1671 * 2 + 1)
+#define PCH_ADD_1671(a, b) ((a) + (b) + 1671)
+typedef int pch_int_1671;
+int pch_function_1671(pch_int_1671 a, int b);
+#define PCH_VALUE_1672 (1672 * 2 + 1)
+#define PCH_ADD_1672(a, b) ((a) + (b) + 1672)
+typedef int pch_int_1672;
+int pch_function_1672(pch_int_1672 a, int b);
+#define PCH_VALUE_1673 (1673 * 2 + 1)
+#define PCH_ADD_1673(a, b) ((a) + (b) + 1673)
+typedef int pch_int_1673;
+int pch_function_1673(pch_int_1673 a, int b);
+#define PCH_VALUE_1674 (1674 * 2 + 1)
+#define PCH_ADD_1674(a, b) ((a) + (b) + 1674)
+typedef int pch_int_1674;
+int pch_function_1674(pch_int_1674 a, int b);
+#define PCH_VALUE_1675 (1675 * 2 + 1)
+#define PCH_ADD_1675(a, b) ((a) + (b) + 1675)
+typedef int pch_int_1675;
+int pch_function_1675(pch_int_1675 a, int b);
+#define PCH_VALUE_1676 (1676 * 2 + 1)
+#define PCH_ADD_1676(a, b) ((a) + (b) + 1676)
+typedef int pch_int_1676;
+int pch_function_1676(pch_int_1676 a, int b);
+#define PCH_VALUE_1677 (1677 * 2 + 1)
+#define PCH_ADD_1677(a, b) ((a) + (b) + 1677)
+typedef int pch_int_1677;
+int pch_function_1677(pch_int_1677 a, int b);
+#define PCH_VALUE_1678 (1678 * 2 + 1)
+#define PCH_ADD_1678(a, b) ((a) + (b) + 1678)
+typedef int pch_int_1678;
+int pch_function_1678(pch_int_1678 a, int b);
+#define PCH_VALUE_1679 (1679 * 2 + 1)
+#define PCH_ADD_1679(a, b) ((a) + (b) + 1679)
+typedef int pch_int_1679;
+int pch_function_1679(pch_int_1679 a, int b);
+#define PCH_VALUE_1680 (1680 * 2 + 1)
+#define PCH_ADD_1680(a, b) ((a) + (b) + 1680)
+typedef int pch_int_1680;
+int pch_function_1680(pch_int_1680 a, int b);
+#define PCH_VALUE_1681 (1681 * 2 + 1)
+#define PCH_ADD_1681(a, b) ((a) + (b) + 1681)
+typedef int pch_int_1681;
+int pch_function_1681(pch_int_1681 a, int b);
+#define PCH_VALUE_1682 (1682 * 2 + 1)
+#define PCH_ADD_1682(a, b) ((a) + (b) + 1682)
+typedef int pch_int_1682;
+int pch_function_1682(pch_int_1682 a, int b);
+#define PCH_VALUE_1683 (1683 * 2 + 1)
+#define PCH_ADD_1683(a, b) ((a) + (b) + 1683)
+typedef int pch_int_1683;
+int pch_function_1683(pch_int_1683 a, int b);
+#define PCH_VALUE_1684 (1684 * 2 + 1)
+#define PCH_ADD_1684(a, b) ((a) + (b) + 1684)
+typedef int pch_int_1684;
+int pch_function_1684(pch_int_1684 a, int b);
+#define PCH_VALUE_1685 (1685 * 2 + 1)
+#define PCH_ADD_1685(a, b) ((a) + (b) + 1685)
+typedef int pch_int_1685;
+int pch_function_1685(pch_int_1685 a, int b);
+#define PCH_VALUE_1686 (1686 * 2 + 1)
+#define PCH_ADD_1686(a, b) ((a) + (b) + 1686)
+typedef int pch_int_1686;
+int pch_function_1686(pch_int_1686 a, int b);
+#define PCH_VALUE_1687 (1687 * 2 + 1)
+#define PCH_ADD_1687(a, b) ((a) + (b) + 1687)
+typedef int pch_int_1687;
+int pch_function_1687(pch_int_1687 a, int b);
+#define PCH_VALUE_1688 (1688 * 2 + 1)
+#define PCH_ADD_1688(a, b) ((a) + (b) + 1688)
+typedef int pch_int_1688;
+int pch_function_1688(pch_int_1688 a, int b);
+#define PCH_VALUE_1689 (1689 * 2 + 1)
+#define PCH_ADD_1689(a, b) ((a) + (b) + 1689)
+typedef int pch_int_1689;
+int pch_function_1689(pch_int_1689 a, int b);
+#define PCH_VALUE_1690 (1690 * 2 + 1)
+#define PCH_ADD_1690(a, b) ((a) + (b) + 1690)
+typedef int pch_int_1690;
+int pch_function_1690(pch_int_1690 a, int b);
+#define PCH_VALUE_1691 (1691 * 2 + 1)
+#define PCH_ADD_1691(a, b) ((a) + (b) + 1691)
+typedef int pch_int_1691;
+int pch_function_1691(pch_int_1691 a, int b);
+#define PCH_VALUE_1692 (1692 * 2 + 1)
+#define PCH_ADD_1692(a, b) ((a) + (b) + 1692)
+typedef int pch_int_1692;
+int pch_function_1692(pch_int_1692 a, int b);
+#define PCH_VALUE_1693 (1693 * 2 + 1)
+#define PCH_ADD_1693(a, b) ((a) + (b) + 1693)
+typedef int pch_int_1693;
+int pch_function_1693(pch_int_1693 a, int b);
+#define PCH_VALUE_1694 (1694 * 2 + 1)
+#define PCH_ADD_1694(a, b) ((a) + (b) + 1694)
+typedef int pch_int_1694;
+int pch_function_1694(pch_int_1694 a, int b);
+#define PCH_VALUE_1695 (1695 * 2 + 1)
+#define PCH_ADD_1695(a, b) ((a) + (b) + 1695)
+typedef int pch_int_1695;
+int pch_function_1695(pch_int_1695 a, int b);
+#define PCH_VALUE_1696 (1696 * 2 + 1)
+#define PCH_ADD_1696(a, b) ((a) + (b) + 1696)
+typedef int pch_int_1696;
+int pch_function_1696(pch_int_1696 a, int b);
+#define PCH_VALUE_1697 (1697 * 2 + 1)
+#define PCH_ADD_1697(a, b) ((a) + (b) + 1697)
+typedef int pch_int_1697;
+int pch_function_1697(pch_int_1697 a, int b);
+#define PCH_VALUE_1698 (1698 * 2 + 1)
+#define PCH_ADD_1698(a, b) ((a) + (b) + 1698)
+typedef int pch_int_1698;
+int pch_function_1698(pch_int_1698 a, int b);
+#define PCH_VALUE_1699 (1699 * 2 + 1)
+#define PCH_ADD_1699(a, b) ((a) + (b) + 1699)
+typedef int pch_int_1699;
+int pch_function_1699(pch_int_1699 a, int b);
+#define PCH_VALUE_1700 (1700 * 2 + 1)
+#define PCH_ADD_1700(a, b) ((a) + (b) + 1700)
+typedef int pch_int_1700;
+int pch_function_1700(pch_int_1700 a, int b);
+#define PCH_VALUE_1701 (1701 * 2 + 1)
+#define PCH_ADD_1701(a, b) ((a) + (b) + 1701)
+typedef int pch_int_1701;
+int pch_function_1701(pch_int_1701 a, int b);
+#define PCH_VALUE_1702 (1702 * 2 + 1)
+#define PCH_ADD_1702(a, b) ((a) + (b) + 1702)
+typedef int pch_int_1702;
+int pch_function_1702(pch_int_1702 a, int b);
+#define PCH_VALUE_1703 (1703 * 2 + 1)
+#define PCH_ADD_1703(a, b) ((a) + (b) + 1703)
+typedef int pch_int_1703;
+int pch_function_1703(pch_int_1703 a, int b);
+#define PCH_VALUE_1704 (1704 * 2 + 1)
+#define PCH_ADD_1704(a, b) ((a) + (b) + 1704)
+typedef int pch_int_1704;
+int pch_function_1704(pch_int_1704 a, int b);
+#define PCH_VALUE_1705 (1705 * 2 + 1)
+#define PCH_ADD_1705(a, b) ((a) + (b) + 1705)
+typedef int pch_int_1705;
+int pch_function_1705(pch_int_1705 a, int b);
+#define PCH_VALUE_1706 (1706 * 2 + 1)
+#define PCH_ADD_1706(a, b) ((a) + (b) + 1706)
+typedef int pch_int_1706;
+int pch_function_1706(pch_int_1706 a, int b);
+#define PCH_VALUE_1707 (1707 * 2 + 1)
+#define PCH_ADD_1707(a, b) ((a) + (b) + 1707)
+typedef int pch_int_1707;
+int pch_function_1707(pch_int_1707 a, int b);
+#define PCH_VALUE_1708 (1708 * 2 + 1)
+#define PCH_ADD_1708(a, b) ((a) + (b) + 1708)
+typedef int pch_int_1708;
+int pch_function_1708(pch_int_1708 a, int b);
+#define PCH_VALUE_1709 (1709 * 2 + 1)
+#define PCH_ADD_1709(a, b) ((a) + (b) + 1709)
+typedef int pch_int_1709;
+int pch_function_1709(pch_int_1709 a, int b);
+#define PCH_VALUE_1710 (1710 * 2 + 1)
+#define PCH_ADD_1710(a, b) ((a) + (b) + 1710)
+typedef int pch_int_1710;
+int pch_function_1710(pch_int_1710 a, int b);
+#define PCH_VALUE_1711 (1711 * 2 + 1)
+#define PCH_ADD_1711(a, b) ((a) + (b) + 1711)
+typedef int pch_int_1711;
+int pch_function_1711(pch_int_1711 a, int b);
+#define PCH_VALUE_1712 (1712 * 2 + 1)
+#define PCH_ADD_1712(a, b) ((a) + (b) + 1712)
+typedef int pch_int_1712;
+int pch_function_1712(pch_int_1712 a, int b);
+#define PCH_VALUE_1713 (1713 * 2 + 1)
+#define PCH_ADD_1713(a, b) ((a) + (b) + 1713)
+typedef int pch_int_1713;
+int pch_function_1713(pch_int_1713 a, int b);
+#define PCH_VALUE_1714 (1714 * 2 + 1)
+#define PCH_ADD_1714(a, b) ((a) + (b) + 1714)
+typedef int pch_int_1714;
+int pch_function_1714(pch_int_1714 a, int b);
+#define PCH_VALUE_1715 (1715 * 2 + 1)
+#define PCH_ADD_1715(a, b) ((a) + (b) + 1715)
+typedef int pch_int_1715;
+int pch_function_1715(pch_int_1715 a, int b);
+#define PCH_VALUE_1716 (1716 * 2 + 1)
+#define PCH_ADD_1716(a, b) ((a) + (b) + 1716)
+typedef int pch_int_1716;
+int pch_function_1716(pch_int_1716 a, int b);
+#define PCH_VALUE_1717 (1717 * 2 + 1)
+#define PCH_ADD_1717(a, b) ((a) + (b) + 1717)
+typedef int pch_int_1717;
+int pch_function_1717(pch_int_1717 a, int b);
+#define PCH_VALUE_1718 (1718 * 2 + 1)
+#define PCH_ADD_1718(a, b) ((a) + (b) + 1718)
+typedef int pch_int_1718;
+int pch_function_1718(pch_int_1718 a, int b);
+#define PCH_VALUE_1719 (1719 * 2 + 1)
+#define PCH_ADD_1719(a, b) ((a) + (b) + 1719)
+typedef int pch_int_1719;
+int pch_function_1719(pch_int_1719 a, int b);
+#define PCH_VALUE_1720 (1720 * 2 + 1)
+#define PCH_ADD_1720(a, b) ((a) + (b) + 1720)
+typedef int pch_int_1720;
+int pch_function_1720(pch_int_1720 a, int b);
+#define PCH_VALUE_1721 (1721 * 2 + 1)
+#define PCH_ADD_1721(a, b) ((a) + (b) + 1721)
+typedef int pch_int_1721;
+int pch_function_1721(pch_int_1721 a, int b);
+#define PCH_VALUE_1722 (1722 * 2 + 1)
+#define PCH_ADD_1722(a, b) ((a) + (b) + 1722)
+typedef int pch_int_1722;
+int pch_function_1722(pch_int_1722 a, int b);
+#define PCH_VALUE_1723 (1723 * 2 + 1)
+#define PCH_ADD_1723(a, b) ((a) + (b) + 1723)
+typedef int pch_int_1723;
+int pch_function_1723(pch_int_1723 a, int b);
+#define PCH_VALUE_1724 (1724 * 2 + 1)
+#define PCH_ADD_1724(a, b) ((a) + (b) + 1724)
+typedef int pch_int_1724;
+int pch_function_1724(pch_int_1724 a, int b);
+#define PCH_VALUE_1725 (1725 * 2 + 1)
+#define PCH_ADD_1725(a, b) ((a) + (b) + 1725)
+typedef int pch_int_1725;
+int pch_function_1725(pch_int_1725 a, int b);
+#define PCH_VALUE_1726 (1726 * 2 + 1)
+#define PCH_ADD_1726(a, b) ((a) + (b) + 1726)
+typedef int pch_int_1726;
+int pch_function_1726(pch_int_1726 a, int b);
+#define PCH_VALUE_1727 (1727 * 2 + 1)
+#define PCH_ADD_1727(a, b) ((a) + (b) + 1727)
+typedef int pch_int_1727;
+int pch_function_1727(pch_int_1727 a, int b);
+#define PCH_VALUE_1728 (1728 * 2 + 1)
+#define PCH_ADD_1728(a, b) ((a) + (b) + 1728)
+typedef int pch_int_1728;
+int pch_function_1728(pch_int_1728 a, int b);
+#define PCH_VALUE_1729 (1729 * 2 + 1)
+#define PCH_ADD_1729(a, b) ((a) + (b) + 1729)
+typedef int pch_int_1729;
+int pch_function_1729(pch_int_1729 a, int b);
+#define PCH_VALUE_1730 (1730 * 2 + 1)
+#define PCH_ADD_1730(a, b) ((a) + (b) + 1730)
+typedef int pch_int_1730;
+int pch_function_1730(pch_int_1730 a, int b);
+#define PCH_VALUE_1731 (1731 * 2 + 1)
+#define PCH_ADD_1731(a, b) ((a) + (b) + 1731)
+typedef int pch_int_1731;
+int pch_function_1731(pch_int_1731 a, int b);
+#define PCH_VALUE_1732 (1732 * 2 + 1)
+#define PCH_ADD_1732(a, b) ((a) + (b) + 1732)
+typedef int pch_int_1732;
+int pch_function_1732(pch_int_1732 a, int b);
+#define PCH_VALUE_1733 (1733 * 2 + 1)
+#define PCH_ADD_1733(a, b) ((a) + (b) + 1733)
+typedef int pch_int_1733;
+int pch_function_1733(pch_int_1733 a, int b);
+#define PCH_VALUE_1734 (1734 * 2 + 1)
+#define PCH_ADD_1734(a, b) ((a) + (b) + 1734)
+typedef int pch_int_1734;
+int pch_function_1734(pch_int_1734 a, int b);
+#define PCH_VALUE_1735 (1735 * 2 + 1)
+#define PCH_ADD_1735(a, b) ((a) + (b) + 1735)
+typedef int pch_int_1735;
+int pch_function_1735(pch_int_1735 a, int b);
+#define PCH_VALUE_1736 (1736 * 2 + 1)
+#define PCH_ADD_1736(a, b) ((a) + (b) + 1736)
+typedef int pch_int_1736;
+int pch_function_1736(pch_int_1736 a, int b);
+#define PCH_VALUE_1737 (1737 * 2 + 1)
+#define PCH_ADD_1737(a, b) ((a) + (b) + 1737)
+typedef int pch_int_1737;
+int pch_function_1737(pch_int_1737 a, int b);
+#define PCH_VALUE_1738 (1738 * 2 + 1)
+#define PCH_ADD_1738(a, b) ((a) + (b) + 1738)
+typedef int pch_int_1738;
+int pch_function_1738(pch_int_1738 a, int b);
+#define PCH_VALUE_1739 (1739 * 2 + 1)
+#define PCH_ADD_1739(a, b) ((a) + (b) + 1739)
+typedef int pch_int_1739;
+int pch_function_1739(pch_int_1739 a, int b);
+#define PCH_VALUE_1740 (1740 * 2 + 1)
+#define PCH_ADD_1740(a, b) ((a) + (b) + 1740)
+typedef int pch_int_1740;
+int pch_function_1740(pch_int_1740 a, int b);
+#define PCH_VALUE_1741 (1741 * 2 + 1)
+#define PCH_ADD_1741(a, b) ((a) + (b) + 1741)
+typedef int pch_int_1741;
+int pch_function_1741(pch_int_1741 a, int b);
+#define PCH_VALUE_1742 (1742 * 2 + 1)
+#define PCH_ADD_1742(a, b) ((a) + (b) + 1742)
+typedef int pch_int_1742;
+int pch_function_1742(pch_int_1742 a, int b);
+#define PCH_VALUE_1743 (1743 * 2 + 1)
+#define PCH_ADD_1743(a, b) ((a) + (b) + 1743)
+typedef int pch_int_1743;
+int pch_function_1743(pch_int_1743 a, int b);
+#define PCH_VALUE_1744 (1744 * 2 + 1)
+#define PCH_ADD_1744(a, b) ((a) + (b) + 1744)
+typedef int pch_int_1744;
+int pch_function_1744(pch_int_1744 a, int b);
+#define PCH_VALUE_1745 (1745 * 2 + 1)
+#define PCH_ADD_1745(a, b) ((a) + (b) + 1745)
+typedef int pch_int_1745;
+int pch_function_1745(pch_int_1745 a, int b);
+#define PCH_VALUE_1746 (1746 * 2 + 1)
+#define PCH_ADD_1746(a, b) ((a) + (b) + 1746)
+typedef int pch_int_1746;
+int pch_function_1746(pch_int_1746 a, int b);
+#define PCH_VALUE_1747 (1747 * 2 + 1)
+#define PCH_ADD_1747(a, b) ((a) + (b) + 1747)
+typedef int pch_int_1747;
+int pch_function_1747(pch_int_1747 a, int b);
+#define PCH_VALUE_1748 (1748 * 2 + 1)
+#define PCH_ADD_1748(a, b) ((a) + (b) + 1748)
+typedef int pch_int_1748;
+int pch_function_1748(pch_int_1748 a, int b);
+#define PCH_VALUE_1749 (1749 * 2 + 1)
+#define PCH_ADD_1749(a, b) ((a) + (b) + 1749)
+typedef int pch_int_1749;
+int pch_function_1749(pch_int_1749 a, int b);
+#define PCH_VALUE_1750 (1750 * 2 + 1)
+#define PCH_ADD_1750(a, b) ((a) + (b) + 1750)
+typedef int pch_int_1750;
+int pch_function_1750(pch_int_1750 a, int b);
+#define PCH_VALUE_1751 (1751 * 2 + 1)
+#define PCH_ADD_1751(a, b) ((a) + (b) + 1751)
+typedef int pch_int_1751;
+int pch_function_1751(pch_int_1751 a, int b);
+#define PCH_VALUE_1752 (1752 * 2 + 1)
+#define PCH_ADD_1752(a, b) ((a) + (b) + 1752)
+typedef int pch_int_1752;
+int pch_function_1752(pch_int_1752 a, int b);
+#define PCH_VALUE_1753 (1753 * 2 + 1)
+#define PCH_ADD_1753(a, b) ((a) + (b) + 1753)
+typedef int pch_int_1753;
+int pch_function_1753(pch_int_1753 a, int b);
+#define PCH_VALUE_1754 (1754 * 2 + 1)
+#define PCH_ADD_1754(a, b) ((a) + (b) + 1754)
+typedef int pch_int_1754;
+int pch_function_1754(pch_int_1754 a, int b);
+#define PCH_VALUE_1755 (1755 * 2 + 1)
+#define PCH_ADD_1755(a, b) ((a) + (b) + 1755)
+typedef int pch_int_1755;
+int pch_function_1755(pch_int_1755 a, int b);
+#define PCH_VALUE_1756 (1756 * 2 + 1)
+#define PCH_ADD_1756(a, b) ((a) + (b) + 1756)
+typedef int pch_int_1756;
+int pch_function_1756(pch_int_1756 a, int b);
+#define PCH_VALUE_1757 (1757 * 2 + 1)
+#define PCH_ADD_1757(a, b) ((a) + (b) + 1757)
+typedef int pch_int_1757;
+int pch_function_1757(pch_int_1757 a, int b);
+#define PCH_VALUE_1758 (1758 * 2 + 1)
+#define PCH_ADD_1758(a, b) ((a) + (b) + 1758)
+typedef int pch_int_1758;
+int pch_function_1758(pch_int_1758 a, int b);
+#define PCH_VALUE_1759 (1759 * 2 + 1)
+#define PCH_ADD_1759(a, b) ((a) + (b) + 1759)
+typedef int pch_int_1759;
+int pch_function_1759(pch_int_1759 a, int b);
+#define PCH_VALUE_1760 (1760 * 2 + 1)
+#define PCH_ADD_1760(a, b) ((a) + (b) + 1760)
+typedef int pch_int_1760;
+int pch_function_1760(pch_int_1760 a, int b);
+#define PCH_VALUE_1761 (1761 * 2 + 1)
+#define PCH_ADD_1761(a, b) ((a) + (b) + 1761)
+typedef int pch_int_1761;
+int pch_function_1761(pch_int_1761 a, int b);
+#define PCH_VALUE_1762 (1762 * 2 + 1)
+#define PCH_ADD_1762(a, b) ((a) + (b) + 1762)
+typedef int pch_int_1762;
+int pch_function_1762(pch_int_1762 a, int b);
+#define PCH_VALUE_1763 (1763 * 2 + 1)
+#define PCH_ADD_1763(a, b) ((a) + (b) + 1763)
+typedef int pch_int_1763;
+int pch_function_1763(pch_int_1763 a, int b);
+#define PCH_VALUE_1764 (1764 * 2 + 1)
+#define PCH_ADD_1764(a, b) ((a) + (b) + 1764)
+typedef int pch_int_1764;
+int pch_function_1764(pch_int_1764 a, int b);
+#define PCH_VALUE_1765 (1765 * 2 + 1)
+#define PCH_ADD_1765(a, b) ((a) + (b) + 1765)
+typedef int pch_int_1765;
+int pch_function_1765(pch_int_1765 a, int b);
+#define PCH_VALUE_1766 (1766 * 2 + 1)
+#define PCH_ADD_1766(a, b) ((a) + (b) + 1766)
+typedef int pch_int_1766;
+int pch_function_1766(pch_int_1766 a, int b);
+#define PCH_VALUE_1767 (1767 * 2 + 1)
+#define PCH_ADD_1767(a, b) ((a) + (b) + 1767)
+typedef int pch_int_1767;
+int pch_function_1767(pch_int_1767 a, int b);
+#define PCH_VALUE_1768 (1768 * 2 + 1)
+#define PCH_ADD_1768(a, b) ((a) + (b) + 1768)
+typedef int pch_int_1768;
+int pch_function_1768(pch_int_1768 a, int b);
+#define PCH_VALUE_1769 (1769 * 2 + 1)
+#define PCH_ADD_1769(a, b) ((a) + (b) + 1769)
+typedef int pch_int_1769;
+int pch_function_1769(pch_int_1769 a, int b);
+#define PCH_VALUE_1770 (1770 * 2 + 1)
+#define PCH_ADD_1770(a, b) ((a) + (b) + 1770)
+typedef int pch_int_1770;
+int pch_function_1770(pch_int_1770 a, int b);
+#define PCH_VALUE_1771 (1771 * 2 + 1)
+#define PCH_ADD_1771(a, b) ((a) + (b) + 1771)
+typedef int pch_int_1771;
+int pch_function_1771(pch_int_1771 a, int b);
+#define PCH_VALUE_1772 (1772 * 2 + 1)
+#define PCH_ADD_1772(a, b) ((a) + (b) + 1772)
+typedef int pch_int_1772;
+int pch_function_1772(pch_int_1772 a, int b);
+#define PCH_VALUE_1773 (1773 * 2 + 1)
+#define PCH_ADD_1773(a, b) ((a) + (b) + 1773)
+typedef int pch_int_1773;
+int pch_function_1773(pch_int_1773 a, int b);
+#define PCH_VALUE_1774 (1774 * 2 + 1)
+#define PCH_ADD_1774(a, b) ((a) + (b) + 1774)
+typedef int pch_int_1774;
+int pch_function_1774(pch_int_1774 a, int b);
+#define PCH_VALUE_1775 (1775 * 2 + 1)
+#define PCH_ADD_1775(a, b) ((a) + (b) + 1775)
+typedef int pch_int_1775;
+int pch_function_1775(pch_int_1775 a, int b);
+#define PCH_VALUE_1776 (1776 * 2 + 1)
+#define PCH_ADD_1776(a, b) ((a) + (b) + 1776)
+typedef int pch_int_1776;
+int pch_function_1776(pch_int_1776 a, int b);
+#define PCH_VALUE_1777 (1777 * 2 + 1)
+#define PCH_ADD_1777(a, b) ((a) + (b) + 1777)
+typedef int pch_int_1777;
+int pch_function_1777(pch_int_1777 a, int b);
+#define PCH_VALUE_1778 (1778 * 2 + 1)
+#define PCH_ADD_1778(a, b) ((a) + (b) + 1778)
+typedef int pch_int_1778;
+int pch_function_1778(pch_int_1778 a, int b);
+#define PCH_VALUE_1779 (1779 * 2 + 1)
+#define PCH_ADD_1779(a, b) ((a) + (b) + 1779)
+typedef int pch_int_1779;
+int pch_function_1779(pch_int_1779 a, int b);
+#define PCH_VALUE_1780 (1780 * 2 + 1)
+#define PCH_ADD_1780(a, b) ((a) + (b) + 1780)
+typedef int pch_int_1780;
+int pch_function_1780(pch_int_1780 a, int b);
+#define PCH_VALUE_1781 (1781 * 2 + 1)
+#define PCH_ADD_1781(a, b) ((a) + (b) + 1781)
+typedef int pch_int_1781;
+int pch_function_1781(pch_int_1781 a, int b);
+#define PCH_VALUE_1782 (1782 * 2 + 1)
+#define PCH_ADD_1782(a, b) ((a) + (b) + 1782)
+typedef int pch_int_1782;
+int pch_function_1782(pch_int_1782 a, int b);
+#define PCH_VALUE_1783 (1783 * 2 + 1)
+#define PCH_ADD_1783(a, b) ((a) + (b) + 1783)
+typedef int pch_int_1783;
+int pch_function_1783(pch_int_1783 a, int b);
+#define PCH_VALUE_1784 (1784 * 2 + 1)
+#define PCH_ADD_1784(a, b) ((a) + (b) + 1784)
+typedef int pch_int_1784;
+int pch_function_1784(pch_int_1784 a, int b);
+#define PCH_VALUE_1785 (1785 * 2 + 1)
+#define PCH_ADD_1785(a, b) ((a) + (b) + 1785)
+typedef int pch_int_1785;
+int pch_function_1785(pch_int_1785 a, int b);
+#define PCH_VALUE_1786 (1786 * 2 + 1)
+#define PCH_ADD_1786(a, b) ((a) + (b) + 1786)
+typedef int pch_int_1786;
+int pch_function_1786(pch_int_1786 a, int b);
+#define PCH_VALUE_1787 (1787 * 2 + 1)
+#define PCH_ADD_1787(a, b) ((a) + (b) + 1787)
+typedef int pch_int_1787;
+int pch_function_1787(pch_int_1787 a, int b);
+#define PCH_VALUE_1788 (1788 * 2 + 1)
+#define PCH_ADD_1788(a, b) ((a) + (b) + 1788)
+typedef int pch_int_1788;
+int pch_function_1788(pch_int_1788 a, int b);
+#define PCH_VALUE_1789 (1789 * 2 + 1)
+#define PCH_ADD_1789(a, b) ((a) + (b) + 1789)
+typedef int pch_int_1789;
+int pch_function_1789(pch_int_1789 a, int b);
+#define PCH_VALUE_1790 (1790 * 2 + 1)
+#define PCH_ADD_1790(a, b) ((a) + (b) + 1790)
+typedef int pch_int_1790;
+int pch_function_1790(pch_int_1790 a, int b);
+#define PCH_VALUE_1791 (1791 * 2 + 1)
+#define PCH_ADD_1791(a, b) ((a) + (b) + 1791)
+typedef int pch_int_1791;
+int pch_function_1791(pch_int_1791 a, int b);
+#define PCH_VALUE_1792 (1792 * 2 + 1)
+#define PCH_ADD_1792(a, b) ((a) + (b) + 1792)
+typedef int pch_int_1792;
+int pch_function_1792(pch_int_1792 a, int b);
+#define PCH_VALUE_1793 (1793 * 2 + 1)
+#define PCH_ADD_1793(a, b) ((a) + (b) + 1793)
+typedef int pch_int_1793;
+int pch_function_1793(pch_int_1793 a, int b);
+#define PCH_VALUE_1794 (1794 * 2 + 1)
+#define PCH_ADD_1794(a, b) ((a) + (b) + 1794)
+typedef int pch_int_1794;
+int pch_function_1794(pch_int_1794 a, int b);
+#define PCH_VALUE_1795 (1795 * 2 + 1)
+#define PCH_ADD_1795(a, b) ((a) + (b) + 1795)
+typedef int pch_int_1795;
+int pch_function_1795(pch_int_1795 a, int b);
+#define PCH_VALUE_1796 (1796 * 2 + 1)
+#define PCH_ADD_1796(a, b) ((a) + (b) + 1796)
+typedef int pch_int_1796;
+int pch_function_1796(pch_int_1796 a, int b);
+#define PCH_VALUE_1797 (1797 * 2 + 1)
+#define PCH_ADD_1797(a, b) ((a) + (b) + 1797)
+typedef int pch_int_1797;
+int pch_function_1797(pch_int_1797 a, int b);
+#define PCH_VALUE_1798 (1798 * 2 + 1)
+#define PCH_ADD_1798(a, b) ((a) + (b) + 1798)
+typedef int pch_int_1798;
+int pch_function_1798(pch_int_1798 a, int b);
+#define PCH_VALUE_1799 (1799 * 2 + 1)
+#define PCH_ADD_1799(a, b) ((a) + (b) + 1799)
+typedef int pch_int_1799;
+int pch_function_1799(pch_int_1799 a, int b);
+#define PCH_VALUE_1800 (1800 * 2 + 1)
+#define PCH_ADD_1800(a, b) ((a) + (b) + 1800)
+typedef int pch_int_1800;
+int pch_function_1800(pch_int_1800 a, int b);
+#define PCH_VALUE_1801 (1801 * 2 + 1)
+#define PCH_ADD_1801(a, b) ((a) + (b) + 1801)
+typedef int pch_int_1801;
+int pch_function_1801(pch_int_1801 a, int b);
+#define PCH_VALUE_1802 (1802 * 2 + 1)
+#define PCH_ADD_1802(a, b) ((a) + (b) + 1802)
+typedef int pch_int_1802;
+int pch_function_1802(pch_int_1802 a, int b);
+#define PCH_VALUE_1803 (1803 * 2 + 1)
+#define PCH_ADD_1803(a, b) ((a) + (b) + 1803)
+typedef int pch_int_1803;
+int pch_function_1803(pch_int_1803 a, int b);
+#define PCH_VALUE_1804 (1804 * 2 + 1)
+#define PCH_ADD_1804(a, b) ((a) + (b) + 1804)
+typedef int pch_int_1804;
+int pch_function_1804(pch_int_1804 a, int b);
+#define PCH_VALUE_1805 (1805 * 2 + 1)
+#define PCH_ADD_1805(a, b) ((a) + (b) + 1805)
+typedef int pch_int_1805;
+int pch_function_1805(pch_int_1805 a, int b);
+#define PCH_VALUE_1806 (1806 * 2 + 1)
+#define PCH_ADD_1806(a, b) ((a) + (b) + 1806)
+typedef int pch_int_1806;
+int pch_function_1806(pch_int_1806 a, int b);
+#define PCH_VALUE_1807 (1807 * 2 + 1)
+#define PCH_ADD_1807(a, b) ((a) + (b) + 1807)
+typedef int pch_int_1807;
+int pch_function_1807(pch_int_1807 a, int b);
+#define PCH_VALUE_1808 (1808 * 2 + 1)
+#define PCH_ADD_1808(a, b) ((a) + (b) + 1808)
+typedef int pch_int_1808;
+int pch_function_1808(pch_int_1808 a, int b);
+#define PCH_VALUE_1809 (1809 * 2 + 1)
+#define PCH_ADD_1809(a, b) ((a) + (b) + 1809)
+typedef int pch_int_1809;
+int pch_function_1809(pch_int_1809 a, int b);
+#define PCH_VALUE_1810 (1810 * 2 + 1)
+#define PCH_ADD_1810(a, b) ((a) + (b) + 1810)
+typedef int pch_int_1810;
+int pch_function_1810(pch_int_1810 a, int b);
+#define PCH_VALUE_1811 (1811 * 2 + 1)
+#define PCH_ADD_1811(a, b) ((a) + (b) + 1811)
+typedef int pch_int_1811;
+int pch_function_1811(pch_int_1811 a, int b);
+#define PCH_VALUE_1812 (1812 * 2 + 1)
+#define PCH_ADD_1812(a, b) ((a) + (b) + 1812)
+typedef int pch_int_1812;
+int pch_function_1812(pch_int_1812 a, int b);
+#define PCH_VALUE_1813 (1813 * 2 + 1)
+#define PCH_ADD_1813(a, b) ((a) + (b) + 1813)
+typedef int pch_int_1813;
+int pch_function_1813(pch_int_1813 a, int b);
+#define PCH_VALUE_1814 (1814 * 2 + 1)
+#define PCH_ADD_1814(a, b) ((a) + (b) + 1814)
+typedef int pch_int_1814;
+int pch_function_1814(pch_int_1814 a, int b);
+#define PCH_VALUE_1815 (1815 * 2 + 1)
+#define PCH_ADD_1815(a, b) ((a) + (b) + 1815)
+typedef int pch_int_1815;
+int pch_function_1815(pch_int_1815 a, int b);
+#define PCH_VALUE_1816 (1816 * 2 + 1)
+#define PCH_ADD_1816(a, b) ((a) + (b) + 1816)
+typedef int pch_int_1816;
+int pch_function_1816(pch_int_1816 a, int b);
+#define PCH_VALUE_1817 (1817 * 2 + 1)
+#define PCH_ADD_1817(a, b) ((a) + (b) + 1817)
+typedef int pch_int_1817;
+int pch_function_1817(pch_int_1817 a, int b);
+#define PCH_VALUE_1818 (1818 * 2 + 1)
+#define PCH_ADD_1818(a, b) ((a) + (b) + 1818)
+typedef int pch_int_1818;
+int pch_function_1818(pch_int_1818 a, int b);
+#define PCH_VALUE_1819 (1819 * 2 + 1)
+#define PCH_ADD_1819(a, b) ((a) + (b) + 1819)
+typedef int pch_int_1819;
+int pch_function_1819(pch_int_1819 a, int b);
+#define PCH_VALUE_1820 (1820 * 2 + 1)
+#define PCH_ADD_1820(a, b) ((a) + (b) + 1820)
+typedef int pch_int_1820;
+int pch_function_1820(pch_int_1820 a, int b);
+#define PCH_VALUE_1821 (1821 * 2 + 1)
+#define PCH_ADD_1821(a, b) ((a) + (b) + 1821)
+typedef int pch_int_1821;
+int pch_function_1821(pch_int_1821 a, int b);
+#define PCH_VALUE_1822 (1822 * 2 + 1)
+#define PCH_ADD_1822(a, b) ((a) + (b) + 1822)
+typedef int pch_int_1822;
+int pch_function_1822(pch_int_1822 a, int b);
+#define PCH_VALUE_1823 (1823 * 2 + 1)
+#define PCH_ADD_1823(a, b) ((a) + (b) + 1823)
+typedef int pch_int_1823;
+int pch_function_1823(pch_int_1823 a, int b);
+#define PCH_VALUE_1824 (1824 * 2 + 1)
+#define PCH_ADD_1824(a, b) ((a) + (b) + 1824)
+typedef int pch_int_1824;
+int pch_function_1824(pch_int_1824 a, int b);
+#define PCH_VALUE_1825 (1825 * 2 + 1)
+#define PCH_ADD_1825(a, b) ((a) + (b) + 1825)
+typedef int pch_int_1825;
+int pch_function_1825(pch_int_1825 a, int b);
+#define PCH_VALUE_1826 (1826 * 2 + 1)
+#define PCH_ADD_1826(a, b) ((a) + (b) + 1826)
+typedef int pch_int_1826;
+int pch_function_1826(pch_int_1826 a, int b);
+#define PCH_VALUE_1827 (1827 * 2 + 1)
+#define PCH_ADD_1827(a, b) ((a) + (b) + 1827)
+typedef int pch_int_1827;
+int pch_function_1827(pch_int_1827 a, int b);
+#define PCH_VALUE_1828 (1828 * 2 + 1)
+#define PCH_ADD_1828(a, b) ((a) + (b) + 1828)
+typedef int pch_int_1828;
+int pch_function_1828(pch_int_1828 a, int b);
+#define PCH_VALUE_1829 (1829 * 2 + 1)
+#define PCH_ADD_1829(a, b) ((a) + (b) + 1829)
+typedef int pch_int_1829;
+int pch_function_1829(pch_int_1829 a, int b);
+#define PCH_VALUE_1830 (1830 * 2 + 1)
+#define PCH_ADD_1830(a, b) ((a) + (b) + 1830)
+typedef int pch_int_1830;
+int pch_function_1830(pch_int_1830 a, int b);
+#define PCH_VALUE_1831 (1831 * 2 + 1)
+#define PCH_ADD_1831(a, b) ((a) + (b) + 1831)
+typedef int pch_int_1831;
+int pch_function_1831(pch_int_1831 a, int b);
+#define PCH_VALUE_1832 (1832 * 2 + 1)
+#define PCH_ADD_1832(a, b) ((a) + (b) + 1832)
+typedef int pch_int_1832;
+int pch_function_1832(pch_int_1832 a, int b);
+#define PCH_VALUE_1833 (1833 * 2 + 1)
+#define PCH_ADD_1833(a, b) ((a) + (b) + 1833)
+typedef int pch_int_1833;
+int pch_function_1833(pch_int_1833 a, int b);
+#define PCH_VALUE_1834 (1834 * 2 + 1)
+#define PCH_ADD_1834(a, b) ((a) + (b) + 1834)
+typedef int pch_int_1834;
+int pch_function_1834(pch_int_1834 a, int b);
+#define PCH_VALUE_1835 (1835 * 2 + 1)
+#define PCH_ADD_1835(a, b) ((a) + (b) + 1835)
+typedef int pch_int_1835;
+int pch_function_1835(pch_int_1835 a, int b);
+#define PCH_VALUE_1836 (1836 * 2 + 1)
+#define PCH_ADD_1836(a, b) ((a) + (b) + 1836)
+typedef int pch_int_1836;
+int pch_function_1836(pch_int_1836 a, int b);
+#define PCH_VALUE_1837 (1837 * 2 + 1)
+#define PCH_ADD_1837(a, b) ((a) + (b) + 1837)
+typedef int pch_int_1837;
+int pch_function_1837(pch_int_1837 a, int b);
+#define PCH_VALUE_1838 (1838 * 2 + 1)
+#define PCH_ADD_1838(a, b) ((a) + (b) + 1838)
+typedef int pch_int_1838;
+int pch_function_1838(pch_int_1838 a, int b);
+#define PCH_VALUE_1839 (1839 * 2 + 1)
+#define PCH_ADD_1839(a, b) ((a) + (b) + 1839)
+typedef int pch_int_1839;
+int pch_function_1839(pch_int_1839 a, int b);
+#define PCH_VALUE_1840 (1840 * 2 + 1)
+#define PCH_ADD_1840(a, b) ((a) + (b) + 1840)
+typedef int pch_int_1840;
+int pch_function_1840(pch_int_1840 a, int b);
+#define PCH_VALUE_1841 (1841 * 2 + 1)
+#define PCH_ADD_1841(a, b) ((a) + (b) + 1841)
+typedef int pch_int_1841;
+int pch_function_1841(pch_int_1841 a, int b);
+#define PCH_VALUE_1842 (1842 * 2 + 1)
+#define PCH_ADD_1842(a, b) ((a) + (b) + 1842)
+typedef int pch_int_1842;
+int pch_function_1842(pch_int_1842 a, int b);
+#define PCH_VALUE_1843 (1843 * 2 + 1)
+#define PCH_ADD_1843(a, b) ((a) + (b) + 1843)
+typedef int pch_int_1843;
+int pch_function_1843(pch_int_1843 a, int b);
+#define PCH_VALUE_1844 (1844 * 2 + 1)
+#define PCH_ADD_1844(a, b) ((a) + (b) + 1844)
+typedef int pch_int_1844;
+int pch_function_1844(pch_int_1844 a, int b);
+#define PCH_VALUE_1845 (1845 * 2 + 1)
+#define PCH_ADD_1845(a, b) ((a) + (b) + 1845)
+typedef int pch_int_1845;
+int pch_function_1845(pch_int_1845 a, int b);
+#define PCH_VALUE_1846 (1846 * 2 + 1)
+#define PCH_ADD_1846(a, b) ((a) + (b) + 1846)
+typedef int pch_int_1846;
+int pch_function_1846(pch_int_1846 a, int b);
+#define PCH_VALUE_1847 (1847 * 2 + 1)
+#define PCH_ADD_1847(a, b) ((a) + (b) + 1847)
+typedef int pch_int_1847;
+int pch_function_1847(pch_int_1847 a, int b);
+#define PCH_VALUE_1848 (1848 * 2 + 1)
+#define PCH_ADD_1848(a, b) ((a) + (b) + 1848)
+typedef int pch_int_1848;
+int pch_function_1848(pch_int_1848 a, int b);
+#define PCH_VALUE_1849 (1849 * 2 + 1)
+#define PCH_ADD_1849(a, b) ((a) + (b) + 1849)
+typedef int pch_int_1849;
+int pch_function_1849(pch_int_1849 a, int b);
+#define PCH_VALUE_1850 (1850 * 2 + 1)
+#define PCH_ADD_1850(a, b) ((a) + (b) + 1850)
+typedef int pch_int_1850;
+int pch_function_1850(pch_int_1850 a, int b);
+#define PCH_VALUE_1851 (1851 * 2 + 1)
+#define PCH_ADD_1851(a, b) ((a) + (b) + 1851)
+typedef int pch_int_1851;
+int pch_function_1851(pch_int_1851 a, int b);
+#define PCH_VALUE_1852 (1852 * 2 + 1)
+#define PCH_ADD_1852(a, b) ((a) + (b) + 1852)
+typedef int pch_int_1852;
+int pch_function_1852(pch_int_1852 a, int b);
+#define PCH_VALUE_1853 (1853 * 2 + 1)
+#define PCH_ADD_1853(a, b) ((a) + (b) + 1853)
+typedef int pch_int_1853;
+int pch_function_1853(pch_int_1853 a, int b);
+#define PCH_VALUE_1854 (1854 * 2 + 1)
+#define PCH_ADD_1854(a, b) ((a) + (b) + 1854)
+typedef int pch_int_1854;
+int pch_function_1854(pch_int_1854 a, int b);
+#define PCH_VALUE_1855 (1855 * 2 + 1)
+#define PCH_ADD_1855(a, b) ((a) + (b) + 1855)
+typedef int pch_int_1855;
+int pch_function_1855(pch_int_1855 a, int b);
+#define PCH_VALUE_1856 (1856 * 2 + 1)
+#define PCH_ADD_1856(a, b) ((a) + (b) + 1856)
+typedef int pch_int_1856;
+int pch_function_1856(pch_int_1856 a, int b);
+#define PCH_VALUE_1857 (1857 * 2 + 1)
+#define PCH_ADD_1857(a, b) ((a) + (b) + 1857)
+typedef int pch_int_1857;
+int pch_function_1857(pch_int_1857 a, int b);
+#define PCH_VALUE_1858 (1858 * 2 + 1)
+#define PCH_ADD_1858(a, b) ((a) + (b) + 1858)
+typedef int pch_int_1858;
+int pch_function_1858(pch_int_1858 a, int b);
+#define PCH_VALUE_1859 (1859 * 2 + 1)
+#define PCH_ADD_1859(a, b) ((a) + (b) + 1859)
+typedef int pch_int_1859;
+int pch_function_1859(pch_int_1859 a, int b);
+#define PCH_VALUE_1860 (1860 * 2 + 1)
+#define PCH_ADD_1860(a, b) ((a) + (b) + 1860)
+typedef int pch_int_1860;
+int pch_function_1860(pch_int_1860 a, int b);
+#define PCH_VALUE_1861 (1861 * 2 + 1)
+#define PCH_ADD_1861(a, b) ((a) + (b) + 1861)
+typedef int pch_int_1861;
+int pch_function_1861(pch_int_1861 a, int b);
+#define PCH_VALUE_1862 (1862 * 2 + 1)
+#define PCH_ADD_1862(a, b) ((a) + (b) + 1862)
+typedef int pch_int_1862;
+int pch_function_1862(pch_int_1862 a, int b);
+#define PCH_VALUE_1863 (1863 * 2 + 1)
+#define PCH_ADD_1863(a, b) ((a) + (b) + 1863)
+typedef int pch_int_1863;
+int pch_function_1863(pch_int_1863 a, int b);
+#define PCH_VALUE_1864 (1864 * 2 + 1)
+#define PCH_ADD_1864(a, b) ((a) + (b) + 1864)
+typedef int pch_int_1864;
+int pch_function_1864(pch_int_1864 a, int b);
+#define PCH_VALUE_1865 (1865 * 2 + 1)
+#define PCH_ADD_1865(a, b) ((a) + (b) + 1865)
+typedef int pch_int_1865;
+int pch_function_1865(pch_int_1865 a, int b);
+#define PCH_VALUE_1866 (1866 * 2 + 1)
+#define PCH_ADD_1866(a, b) ((a) + (b) + 1866)
+typedef int pch_int_1866;
+int pch_function_1866(pch_int_1866 a, int b);
+#define PCH_VALUE_1867 (1867 * 2 + 1)
+#define PCH_ADD_1867(a, b) ((a) + (b) + 1867)
+typedef int pch_int_1867;
+int pch_function_1867(pch_int_1867 a, int b);
+#define PCH_VALUE_1868 (1868 * 2 + 1)
+#define PCH_ADD_1868(a, b) ((a) + (b) + 1868)
+typedef int pch_int_1868;
+int pch_function_1868(pch_int_1868 a, int b);
+#define PCH_VALUE_1869 (1869 * 2 + 1)
+#define PCH_ADD_1869(a, b) ((a) + (b) + 1869)
+typedef int pch_int_1869;
+int pch_function_1869(pch_int_1869 a, int b);
+#define PCH_VALUE_1870 (1870 * 2 + 1)
+#define PCH_ADD_1870(a, b) ((a) + (b) + 1870)
+typedef int pch_int_1870;
+int pch_function_1870(pch_int_1870 a, int b);
+#define PCH_VALUE_1871 (1871 * 2 + 1)
+#define PCH_ADD_1871(a, b) ((a) + (b) + 1871)
+typedef int pch_int_1871;
+int pch_function_1871(pch_int_1871 a, int b);
+#define PCH_VALUE_1872 (1872 * 2 + 1)
+#define PCH_ADD_1872(a, b) ((a) + (b) + 1872)
+typedef int pch_int_1872;
+int pch_function_1872(pch_int_1872 a, int b);
+#define PCH_VALUE_1873 (1873 * 2 + 1)
+#define PCH_ADD_1873(a, b) ((a) + (b) + 1873)
+typedef int pch_int_1873;
+int pch_function_1873(pch_int_1873 a, int b);
+#define PCH_VALUE_1874 (1874 * 2 + 1)
+#define PCH_ADD_1874(a, b) ((a) + (b) + 1874)
+typedef int pch_int_1874;
+int pch_function_1874(pch_int_1874 a, int b);
+#define PCH_VALUE_1875 (1875 * 2 + 1)
+#define PCH_ADD_1875(a, b) ((a) + (b) + 1875)
+typedef int pch_int_1875;
+int pch_function_1875(pch_int_1875 a, int b);
+#define PCH_VALUE_1876 (1876 * 2 + 1)
+#define PCH_ADD_1876(a, b) ((a) + (b) + 1876)
+typedef int pch_int_1876;
+int pch_function_1876(pch_int_1876 a, int b);
+#define PCH_VALUE_1877 (1877 * 2 + 1)
+#define PCH_ADD_1877(a, b) ((a) + (b) + 1877)
+typedef int pch_int_1877;
+int pch_function_1877(pch_int_1877 a, int b);
+#define PCH_VALUE_1878 (1878 * 2 + 1)
+#define PCH_ADD_1878(a, b) ((a) + (b) + 1878)
+typedef int pch_int_1878;
+int pch_function_1878(pch_int_1878 a, int b);
+#define PCH_VALUE_1879 (1879 * 2 + 1)
+#define PCH_ADD_1879(a, b) ((a) + (b) + 1879)
+typedef int pch_int_1879;
+int pch_function_1879(pch_int_1879 a, int b);
+#define PCH_VALUE_1880 (1880 * 2 + 1)
+#define PCH_ADD_1880(a, b) ((a) + (b) + 1880)
+typedef int pch_int_1880;
+int pch_function_1880(pch_int_1880 a, int b);
+#define PCH_VALUE_1881 (1881 * 2 + 1)
+#define PCH_ADD_1881(a, b) ((a) + (b) + 1881)
+typedef int pch_int_1881;
+int pch_function_1881(pch_int_1881 a, int b);
+#define PCH_VALUE_1882 (1882 * 2 + 1)
+#define PCH_ADD_1882(a, b) ((a) + (b) + 1882)
+typedef int pch_int_1882;
+int pch_function_1882(pch_int_1882 a, int b);
+#define PCH_VALUE_1883 (1883 * 2 + 1)
+#define PCH_ADD_1883(a, b) ((a) + (b) + 1883)
+typedef int pch_int_1883;
+int pch_function_1883(pch_int_1883 a, int b);
+#define PCH_VALUE_1884 (1884 * 2 + 1)
+#define PCH_ADD_1884(a, b) ((a) + (b) + 1884)
+typedef int pch_int_1884;
+int pch_function_1884(pch_int_1884 a, int b);
+#define PCH_VALUE_1885 (1885 * 2 + 1)
+#define PCH_ADD_1885(a, b) ((a) + (b) + 1885)
+typedef int pch_int_1885;
+int pch_function_1885(pch_int_1885 a, int b);
+#define PCH_VALUE_1886 (1886 * 2 + 1)
+#define PCH_ADD_1886(a, b) ((a) + (b) + 1886)
+typedef int pch_int_1886;
+int pch_function_1886(pch_int_1886 a, int b);
+#define PCH_VALUE_1887 (1887 * 2 + 1)
+#define PCH_ADD_1887(a, b) ((a) + (b) + 1887)
+typedef int pch_int_1887;
+int pch_function_1887(pch_int_1887 a, int b);
+#define PCH_VALUE_1888 (1888 * 2 + 1)
+#define PCH_ADD_1888(a, b) ((a) + (b) + 1888)
+typedef int pch_int_1888;
+int pch_function_1888(pch_int_1888 a, int b);
+#define PCH_VALUE_1889 (1889 * 2 + 1)
+#define PCH_ADD_1889(a, b) ((a) + (b) + 1889)
+typedef int pch_int_1889;
+int pch_function_1889(pch_int_1889 a, int b);
+#define PCH_VALUE_1890 (1890 * 2 + 1)
+#define PCH_ADD_1890(a, b) ((a) + (b) + 1890)
+typedef int pch_int_1890;
+int pch_function_1890(pch_int_1890 a, int b);
+#define PCH_VALUE_1891 (1891 * 2 + 1)
+#define PCH_ADD_1891(a, b) ((a) + (b) + 1891)
+typedef int pch_int_1891;
+int pch_function_1891(pch_int_1891 a, int b);
+#define PCH_VALUE_1892 (1892 * 2 + 1)
+#define PCH_ADD_1892(a, b) ((a) + (b) + 1892)
+typedef int pch_int_1892;
+int pch_function_1892(pch_int_1892 a, int b);
+#define PCH_VALUE_1893 (1893 * 2 + 1)
+#define PCH_ADD_1893(a, b) ((a) + (b) + 1893)
+typedef int pch_int_1893;
+int pch_function_1893(pch_int_1893 a, int b);
+#define PCH_VALUE_1894 (1894 * 2 + 1)
+#define PCH_ADD_1894(a, b) ((a) + (b) + 1894)
+typedef int pch_int_1894;
+int pch_function_1894(pch_int_1894 a, int b);
+#define PCH_VALUE_1895 (1895 * 2 + 1)
+#define PCH_ADD_1895(a, b) ((a) + (b) + 1895)
+typedef int pch_int_1895;
+int pch_function_1895(pch_int_1895 a, int b);
+#define PCH_VALUE_1896 (1896 * 2 + 1)
+#define PCH_ADD_1896(a, b) ((a) + (b) + 1896)
+typedef int pch_int_1896;
+int pch_function_1896(pch_int_1896 a, int b);
+#define PCH_VALUE_1897 (1897 * 2 + 1)
+#define PCH_ADD_1897(a, b) ((a) + (b) + 1897)
+typedef int pch_int_1897;
+int pch_function_1897(pch_int_1897 a, int b);
+#define PCH_VALUE_1898 (1898 * 2 + 1)
+#define PCH_ADD_1898(a, b) ((a) + (b) + 1898)
+typedef int pch_int_1898;
+int pch_function_1898(pch_int_1898 a, int b);
+#define PCH_VALUE_1899 (1899 * 2 + 1)
+#define PCH_ADD_1899(a, b) ((a) + (b) + 1899)
+typedef int pch_int_1899;
+int pch_function_1899(pch_int_1899 a, int b);
+#define PCH_VALUE_1900 (1900 * 2 + 1)
+#define PCH_ADD_1900(a, b) ((a) + (b) + 1900)
+typedef int pch_int_1900;
+int pch_function_1900(pch_int_1900 a, int b);
+#define PCH_VALUE_1901 (1901 * 2 + 1)
+#define PCH_ADD_1901(a, b) ((a) + (b) + 1901)
+typedef int pch_int_1901;
+int pch_function_1901(pch_int_1901 a, int b);
+#define PCH_VALUE_1902 (1902 * 2 + 1)
+#define PCH_ADD_1902(a, b) ((a) + (b) + 1902)
+typedef int pch_int_1902;
+int pch_function_1902(pch_int_1902 a, int b);
+#define PCH_VALUE_1903 (1903 * 2 + 1)
+#define PCH_ADD_1903(a, b) ((a) + (b) + 1903)
+typedef int pch_int_1903;
+int pch_function_1903(pch_int_1903 a, int b);
+#define PCH_VALUE_1904 (1904 * 2 + 1)
+#define PCH_ADD_1904(a, b) ((a) + (b) + 1904)
+typedef int pch_int_1904;
+int pch_function_1904(pch_int_1904 a, int b);
+#define PCH_VALUE_1905 (1905 * 2 + 1)
+#define PCH_ADD_1905(a, b) ((a) + (b) + 1905)
+typedef int pch_int_1905;
+int pch_function_1905(pch_int_1905 a, int b);
+#define PCH_VALUE_1906 (1906 * 2 + 1)
+#define PCH_ADD_1906(a, b) ((a) + (b) + 1906)
+typedef int pch_int_1906;
+int pch_function_1906(pch_int_1906 a, int b);
+#define PCH_VALUE_1907 (1907 * 2 + 1)
+#define PCH_ADD_1907(a, b) ((a) + (b) + 1907)
+typedef int pch_int_1907;
+int pch_function_1907(pch_int_1907 a, int b);
+#define PCH_VALUE_1908 (1908 * 2 + 1)
+#define PCH_ADD_1908(a, b) ((a) + (b) + 1908)
+typedef int pch_int_1908;
+int pch_function_1908(pch_int_1908 a, int b);
+#define PCH_VALUE_1909 (1909 * 2 + 1)
+#define PCH_ADD_1909(a, b) ((a) + (b) + 1909)
+typedef int pch_int_1909;
+int pch_function_1909(pch_int_1909 a, int b);
+#define PCH_VALUE_1910 (1910 * 2 + 1)
+#define PCH_ADD_1910(a, b) ((a) + (b) + 1910)
+typedef int pch_int_1910;
+int pch_function_1910(pch_int_1910 a, int b);
+#define PCH_VALUE_1911 (1911 * 2 + 1)
+#define PCH_ADD_1911(a, b) ((a) + (b) + 1911)
+typedef int pch_int_1911;
+int pch_function_1911(pch_int_1911 a, int b);
+#define PCH_VALUE_1912 (1912 * 2 + 1)
+#define PCH_ADD_1912(a, b) ((a) + (b) + 1912)
+typedef int pch_int_1912;
+int pch_function_1912(pch_int_1912 a, int b);
+#define PCH_VALUE_1913 (1913 * 2 + 1)
+#define PCH_ADD_1913(a, b) ((a) + (b) + 1913)
+typedef int pch_int_1913;
+int pch_function_1913(pch_int_1913 a, int b);
+#define PCH_VALUE_1914 (1914 * 2 + 1)
+#define PCH_ADD_1914(a, b) ((a) + (b) + 1914)
+typedef int pch_int_1914;
+int pch_function_1914(pch_int_1914 a, int b);
+#define PCH_VALUE_1915 (1915 * 2 + 1)
+#define PCH_ADD_1915(a, b) ((a) + (b) + 1915)
+typedef int pch_int_1915;
+int pch_function_1915(pch_int_1915 a, int b);
+#define PCH_VALUE_1916 (1916 * 2 + 1)
+#define PCH_ADD_1916(a, b) ((a) + (b) + 1916)
+typedef int pch_int_1916;
+int pch_function_1916(pch_int_1916 a, int b);
+#define PCH_VALUE_1917 (1917 * 2 + 1)
+#define PCH_ADD_1917(a, b) ((a) + (b) + 1917)
+typedef int pch_int_1917;
+int pch_function_1917(pch_int_1917 a, int b);
+#define PCH_VALUE_1918 (1918 * 2 + 1)
+#define PCH_ADD_1918(a, b) ((a) + (b) + 1918)
+typedef int pch_int_1918;
+int pch_function_1918(pch_int_1918 a, int b);
+#define PCH_VALUE_1919 (1919 * 2 + 1)
+#define PCH_ADD_1919(a, b) ((a) + (b) + 1919)
+typedef int pch_int_1919;
+int pch_function_1919(pch_int_1919 a, int b);
+#define PCH_VALUE_1920 (1920 * 2 + 1)
+#define PCH_ADD_1920(a, b) ((a) + (b) + 1920)
+typedef int pch_int_1920;
+int pch_function_1920(pch_int_1920 a, int b);
+#define PCH_VALUE_1921 (1921 * 2 + 1)
+#define PCH_ADD_1921(a, b) ((a) + (b) + 1921)
+typedef int pch_int_1921;
+int pch_function_1921(pch_int_1921 a, int b);
+#define PCH_VALUE_1922 (1922 * 2 + 1)
+#define PCH_ADD_1922(a, b) ((a) + (b) + 1922)
+typedef int pch_int_1922;
+int pch_function_1922(pch_int_1922 a, int b);
+#define PCH_VALUE_1923 (1923 * 2 + 1)
+#define PCH_ADD_1923(a, b) ((a) + (b) + 1923)
+typedef int pch_int_1923;
+int pch_function_1923(pch_int_1923 a, int b);
+#define PCH_VALUE_1924 (1924 * 2 + 1)
+#define PCH_ADD_1924(a, b) ((a) + (b) + 1924)
+typedef int pch_int_1924;
+int pch_function_1924(pch_int_1924 a, int b);
+#define PCH_VALUE_1925 (1925 * 2 + 1)
+#define PCH_ADD_1925(a, b) ((a) + (b) + 1925)
+typedef int pch_int_1925;
+int pch_function_1925(pch_int_1925 a, int b);
+#define PCH_VALUE_1926 (1926 * 2 + 1)
+#define PCH_ADD_1926(a, b) ((a) + (b) + 1926)
+typedef int pch_int_1926;
+int pch_function_1926(pch_int_1926 a, int b);
+#define PCH_VALUE_1927 (1927 * 2 + 1)
+#define PCH_ADD_1927(a, b) ((a) + (b) + 1927)
+typedef int pch_int_1927;
+int pch_function_1927(pch_int_1927 a, int b);
+#define PCH_VALUE_1928 (1928 * 2 + 1)
+#define PCH_ADD_1928(a, b) ((a) + (b) + 1928)
+typedef int pch_int_1928;
+int pch_function_1928(pch_int_1928 a, int b);
+#define PCH_VALUE_1929 (1929 * 2 + 1)
+#define PCH_ADD_1929(a, b) ((a) + (b) + 1929)
+typedef int pch_int_1929;
+int pch_function_1929(pch_int_1929 a, int b);
+#define PCH_VALUE_1930 (1930 * 2 + 1)
+#define PCH_ADD_1930(a, b) ((a) + (b) + 1930)
+typedef int pch_int_1930;
+int pch_function_1930(pch_int_1930 a, int b);
+#define PCH_VALUE_1931 (1931 * 2 + 1)
+#define PCH_ADD_1931(a, b) ((a) + (b) + 1931)
+typedef int pch_int_1931;
+int pch_function_1931(pch_int_1931 a, int b);
+#define PCH_VALUE_1932 (1932 * 2 + 1)
+#define PCH_ADD_1932(a, b) ((a) + (b) + 1932)
+typedef int pch_int_1932;
+int pch_function_1932(pch_int_1932 a, int b);
+#define PCH_VALUE_1933 (1933 * 2 + 1)
+#define PCH_ADD_1933(a, b) ((a) + (b) + 1933)
+typedef int pch_int_1933;
+int pch_function_1933(pch_int_1933 a, int b);
+#define PCH_VALUE_1934 (1934 * 2 + 1)
+#define PCH_ADD_1934(a, b) ((a) + (b) + 1934)
+typedef int pch_int_1934;
+int pch_function_1934(pch_int_1934 a, int b);
+#define PCH_VALUE_1935 (1935 * 2 + 1)
+#define PCH_ADD_1935(a, b) ((a) + (b) + 1935)
+typedef int pch_int_1935;
+int pch_function_1935(pch_int_1935 a, int b);
+#define PCH_VALUE_1936 (1936 * 2 + 1)
+#define PCH_ADD_1936(a, b) ((a) + (b) + 1936)
+typedef int pch_int_1936;
+int pch_function_1936(pch_int_1936 a, int b);
+#define PCH_VALUE_1937 (1937 * 2 + 1)
+#define PCH_ADD_1937(a, b) ((a) + (b) + 1937)
+typedef int pch_int_1937;
+int pch_function_1937(pch_int_1937 a, int b);
+#define PCH_VALUE_1938 (1938 * 2 + 1)
+#define PCH_ADD_1938(a, b) ((a) + (b) + 1938)
+typedef int pch_int_1938;
+int pch_function_1938(pch_int_1938 a, int b);
+#define PCH_VALUE_1939 (1939 * 2 + 1)
+#define PCH_ADD_1939(a, b) ((a) + (b) + 1939)
+typedef int pch_int_1939;
+int pch_function_1939(pch_int_1939 a, int b);
+#define PCH_VALUE_1940 (1940 * 2 + 1)
+#define PCH_ADD_1940(a, b) ((a) + (b) + 1940)
+typedef int pch_int_1940;
+int pch_function_1940(pch_int_1940 a, int b);
+#define PCH_VALUE_1941 (1941 * 2 + 1)
+#define PCH_ADD_1941(a, b) ((a) + (b) + 1941)
+typedef int pch_int_1941;
+int pch_function_1941(pch_int_1941 a, int b);
+#define PCH_VALUE_1942 (1942 * 2 + 1)
+#define PCH_ADD_1942(a, b) ((a) + (b) + 1942)
+typedef int pch_int_1942;
+int pch_function_1942(pch_int_1942 a, int b);
+#define PCH_VALUE_1943 (1943 * 2 + 1)
+#define PCH_ADD_1943(a, b) ((a) + (b) + 1943)
+typedef int pch_int_1943;
+int pch_function_1943(pch_int_1943 a, int b);
+#define PCH_VALUE_1944 (1944 * 2 + 1)
+#define PCH_ADD_1944(a, b) ((a) + (b) + 1944)
+typedef int pch_int_1944;
+int pch_function_1944(pch_int_1944 a, int b);
+#define PCH_VALUE_1945 (1945 * 2 + 1)
+#define PCH_ADD_1945(a, b) ((a) + (b) + 1945)
+typedef int pch_int_1945;
+int pch_function_1945(pch_int_1945 a, int b);
+#define PCH_VALUE_1946 (1946 * 2 + 1)
+#define PCH_ADD_1946(a, b) ((a) + (b) + 1946)
+typedef int pch_int_1946;
+int pch_function_1946(pch_int_1946 a, int b);
+#define PCH_VALUE_1947 (1947 * 2 + 1)
+#define PCH_ADD_1947(a, b) ((a) + (b) + 1947)
+typedef int pch_int_1947;
+int pch_function_1947(pch_int_1947 a, int b);
+#define PCH_VALUE_1948 (1948 * 2 + 1)
+#define PCH_ADD_1948(a, b) ((a) + (b) + 1948)
+typedef int pch_int_1948;
+int pch_function_1948(pch_int_1948 a, int b);
+#define PCH_VALUE_1949 (1949 * 2 + 1)
+#define PCH_ADD_1949(a, b) ((a) + (b) + 1949)
+typedef int pch_int_1949;
+int pch_function_1949(pch_int_1949 a, int b);
+#define PCH_VALUE_1950 (1950 * 2 + 1)
+#define PCH_ADD_1950(a, b) ((a) + (b) + 1950)
+typedef int pch_int_1950;
+int pch_function_1950(pch_int_1950 a, int b);
+#define PCH_VALUE_1951 (1951 * 2 + 1)
+#define PCH_ADD_1951(a, b) ((a) + (b) + 1951)
+typedef int pch_int_1951;
+int pch_function_1951(pch_int_1951 a, int b);
+#define PCH_VALUE_1952 (1952 * 2 + 1)
+#define PCH_ADD_1952(a, b) ((a) + (b) + 1952)
+typedef int pch_int_1952;
+int pch_function_1952(pch_int_1952 a, int b);
+#define PCH_VALUE_1953 (1953 * 2 + 1)
+#define PCH_ADD_1953(a, b) ((a) + (b) + 1953)
+typedef int pch_int_1953;
+int pch_function_1953(pch_int_1953 a, int b);
+#define PCH_VALUE_1954 (1954 * 2 + 1)
+#define PCH_ADD_1954(a, b) ((a) + (b) + 1954)
+typedef int pch_int_1954;
+int pch_function_1954(pch_int_1954 a, int b);
+#define PCH_VALUE_1955 (1955 * 2 + 1)
+#define PCH_ADD_1955(a, b) ((a) + (b) + 1955)
+typedef int pch_int_1955;
+int pch_function_1955(pch_int_1955 a, int b);
+#define PCH_VALUE_1956 (1956 * 2 + 1)
+#define PCH_ADD_1956(a, b) ((a) + (b) + 1956)
+typedef int pch_int_1956;
+int pch_function_1956(pch_int_1956 a, int b);
+#define PCH_VALUE_1957 (1957 * 2 + 1)
+#define PCH_ADD_1957(a, b) ((a) + (b) + 1957)
+typedef int pch_int_1957;
+int pch_function_1957(pch_int_1957 a, int b);
+#define PCH_VALUE_1958 (1958 * 2 + 1)
+#define PCH_ADD_1958(a, b) ((a) + (b) + 1958)
+typedef int pch_int_1958;
+int pch_function_1958(pch_int_1958 a, int b);
+#define PCH_VALUE_1959 (1959 * 2 + 1)
+#define PCH_ADD_1959(a, b) ((a) + (b) + 1959)
+typedef int pch_int_1959;
+int pch_function_1959(pch_int_1959 a, int b);
+#define PCH_VALUE_1960 (1960 * 2 + 1)
+#define PCH_ADD_1960(a, b) ((a) + (b) + 1960)
+typedef int pch_int_1960;
+int pch_function_1960(pch_int_1960 a, int b);
+#define PCH_VALUE_1961 (1961 * 2 + 1)
+#define PCH_ADD_1961(a, b) ((a) + (b) + 1961)
+typedef int pch_int_1961;
+int pch_function_1961(pch_int_1961 a, int b);
+#define PCH_VALUE_1962 (1962 * 2 + 1)
+#define PCH_ADD_1962(a, b) ((a) + (b) + 1962)
+typedef int pch_int_1962;
+int pch_function_1962(pch_int_1962 a, int b);
+#define PCH_VALUE_1963 (1963 * 2 + 1)
+#define PCH_ADD_1963(a, b) ((a) + (b) + 1963)
+typedef int pch_int_1963;
+int pch_function_1963(pch_int_1963 a, int b);
+#define PCH_VALUE_1964 (1964 * 2 + 1)
+#define PCH_ADD_1964(a, b) ((a) + (b) + 1964)
+typedef int pch_int_1964;
+int pch_function_1964(pch_int_1964 a, int b);
+#define PCH_VALUE_1965 (1965 * 2 + 1)
+#define PCH_ADD_1965(a, b) ((a) + (b) + 1965)
+typedef int pch_int_1965;
+int pch_function_1965(pch_int_1965 a, int b);
+#define PCH_VALUE_1966 (1966 * 2 + 1)
+#define PCH_ADD_1966(a, b) ((a) + (b) + 1966)
+typedef int pch_int_1966;
+int pch_function_1966(pch_int_1966 a, int b);
+#define PCH_VALUE_1967 (1967 * 2 + 1)
+#define PCH_ADD_1967(a, b) ((a) + (b) + 1967)
+typedef int pch_int_1967;
+int pch_function_1967(pch_int_1967 a, int b);
+#define PCH_VALUE_1968 (1968 * 2 + 1)
+#define PCH_ADD_1968(a, b) ((a) + (b) + 1968)
+typedef int pch_int_1968;
+int pch_function_1968(pch_int_1968 a, int b);
+#define PCH_VALUE_1969 (1969 * 2 + 1)
+#define PCH_ADD_1969(a, b) ((a) + (b) + 1969)
+typedef int pch_int_1969;
+int pch_function_1969(pch_int_1969 a, int b);
+#define PCH_VALUE_1970 (1970 * 2 + 1)
+#define PCH_ADD_1970(a, b) ((a) + (b) + 1970)
+typedef int pch_int_1970;
+int pch_function_1970(pch_int_1970 a, int b);
+#define PCH_VALUE_1971 (1971 * 2 + 1)
+#define PCH_ADD_1971(a, b) ((a) + (b) + 1971)
+typedef int pch_int_1971;
+int pch_function_1971(pch_int_1971 a, int b);
+#define PCH_VALUE_1972 (1972 * 2 + 1)
+#define PCH_ADD_1972(a, b) ((a) + (b) + 1972)
+typedef int pch_int_1972;
+int pch_function_1972(pch_int_1972 a, int b);
+#define PCH_VALUE_1973 (1973 * 2 + 1)
+#define PCH_ADD_1973(a, b) ((a) + (b) + 1973)
+typedef int pch_int_1973;
+int pch_function_1973(pch_int_1973 a, int b);
+#define PCH_VALUE_1974 (1974 * 2 + 1)
+#define PCH_ADD_1974(a, b) ((a) + (b) + 1974)
+typedef int pch_int_1974;
+int pch_function_1974(pch_int_1974 a, int b);
+#define PCH_VALUE_1975 (1975 * 2 + 1)
+#define PCH_ADD_1975(a, b) ((a) + (b) + 1975)
+typedef int pch_int_1975;
+int pch_function_1975(pch_int_1975 a, int b);
+#define PCH_VALUE_1976 (1976 * 2 + 1)
+#define PCH_ADD_1976(a, b) ((a) + (b) + 1976)
+typedef int pch_int_1976;
+int pch_function_1976(pch_int_1976 a, int b);
+#define PCH_VALUE_1977 (1977 * 2 + 1)
+#define PCH_ADD_1977(a, b) ((a) + (b) + 1977)
+typedef int pch_int_1977;
+int pch_function_1977(pch_int_1977 a, int b);
+#define PCH_VALUE_1978 (1978 * 2 + 1)
+#define PCH_ADD_1978(a, b) ((a) + (b) + 1978)
+typedef int pch_int_1978;
+int pch_function_1978(pch_int_1978 a, int b);
+#define PCH_VALUE_1979 (1979 * 2 + 1)
+#define PCH_ADD_1979(a, b) ((a) + (b) + 1979)
+typedef int pch_int_1979;
+int pch_function_1979(pch_int_1979 a, int b);
+#define PCH_VALUE_1980 (1980 * 2 + 1)
+#define PCH_ADD_1980(a, b) ((a) + (b) + 1980)
+typedef int pch_int_1980;
+int pch_function_1980(pch_int_1980 a, int b);
+#define PCH_VALUE_1981 (1981 * 2 + 1)
+#define PCH_ADD_1981(a, b) ((a) + (b) + 1981)
+typedef int pch_int_1981;
+int pch_function_1981(pch_int_1981 a, int b);
+#define PCH_VALUE_1982 (1982 * 2 + 1)
+#define PCH_ADD_1982(a, b) ((a) + (b) + 1982)
+typedef int pch_int_1982;
+int pch_function_1982(pch_int_1982 a, int b);
+#define PCH_VALUE_1983 (1983 * 2 + 1)
+#define PCH_ADD_1983(a, b) ((a) + (b) + 1983)
+typedef int pch_int_1983;
+int pch_function_1983(pch_int_1983 a, int b);
+#define PCH_VALUE_1984 (1984 * 2 + 1)
+#define PCH_ADD_1984(a, b) ((a) + (b) + 1984)
+typedef int pch_int_1984;
+int pch_function_1984(pch_int_1984 a, int b);
+#define PCH_VALUE_1985 (1985 * 2 + 1)
+#define PCH_ADD_1985(a, b) ((a) + (b) + 1985)
+typedef int pch_int_1985;
+int pch_function_1985(pch_int_1985 a, int b);
+#define PCH_VALUE_1986 (1986 * 2 + 1)
+#define PCH_ADD_1986(a, b) ((a) + (b) + 1986)
+typedef int pch_int_1986;
+int pch_function_1986(pch_int_1986 a, int b);
+#define PCH_VALUE_1987 (1987 * 2 + 1)
+#define PCH_ADD_1987(a, b) ((a) + (b) + 1987)
+typedef int pch_int_1987;
+int pch_function_1987(pch_int_1987 a, int b);
+#define PCH_VALUE_1988 (1988 * 2 + 1)
+#define PCH_ADD_1988(a, b) ((a) + (b) + 1988)
+typedef int pch_int_1988;
+int pch_function_1988(pch_int_1988 a, int b);
+#define PCH_VALUE_1989 (1989 * 2 + 1)
+#define PCH_ADD_1989(a, b) ((a) + (b) + 1989)
+typedef int pch_int_1989;
+int pch_function_1989(pch_int_1989 a, int b);
+#define PCH_VALUE_1990 (1990 * 2 + 1)
+#define PCH_ADD_1990(a, b) ((a) + (b) + 1990)
+typedef int pch_int_1990;
+int pch_function_1990(pch_int_1990 a, int b);
+#define PCH_VALUE_1991 (1991 * 2 + 1)
+#define PCH_ADD_1991(a, b) ((a) + (b) + 1991)
+typedef int pch_int_1991;
+int pch_function_1991(pch_int_1991 a, int b);
+#define PCH_VALUE_1992 (1992 * 2 + 1)
+#define PCH_ADD_1992(a, b) ((a) + (b) + 1992)
+typedef int pch_int_1992;
+int pch_function_1992(pch_int_1992 a, int b);
+#define PCH_VALUE_1993 (1993 * 2 + 1)
+#define PCH_ADD_1993(a, b) ((a) + (b) + 1993)
+typedef int pch_int_1993;
+int pch_function_1993(pch_int_1993 a, int b);
+#define PCH_VALUE_1994 (1994 * 2 + 1)
+#define PCH_ADD_1994(a, b) ((a) + (b) + 1994)
+typedef int pch_int_1994;
+int pch_function_1994(pch_int_1994 a, int b);
+#define PCH_VALUE_1995 (1995 * 2 + 1)
+#define PCH_ADD_1995(a, b) ((a) + (b) + 1995)
+typedef int pch_int_1995;
+int pch_function_1995(pch_int_1995 a, int b);
+#define PCH_VALUE_1996 (1996 * 2 + 1)
+#define PCH_ADD_1996(a, b) ((a) + (b) + 1996)
+typedef int pch_int_1996;
+int pch_function_1996(pch_int_1996 a, int b);
+#define PCH_VALUE_1997 (1997 * 2 + 1)
+#define PCH_ADD_1997(a, b) ((a) + (b) + 1997)
+typedef int pch_int_1997;
+int pch_function_1997(pch_int_1997 a, int b);
+#define PCH_VALUE_1998 (1998 * 2 + 1)
+#define PCH_ADD_1998(a, b) ((a) + (b) + 1998)
+typedef int pch_int_1998;
+int pch_function_1998(pch_int_1998 a, int b);
+#define PCH_VALUE_1999 (1999 * 2 + 1)
+#define PCH_ADD_1999(a, b) ((a) + (b) + 1999)
+typedef int pch_int_1999;
+int pch_function_1999(pch_int_1999 a, int b);
+#endif
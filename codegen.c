@@ -559,34 +559,246 @@ void codegen_release_register(const char *reg)
     register_unset_flag(codegen_get_enum_for_register(reg));
 }
 
-void asm_push_no_nl(const char *ins, ...)
+/**
+ * Writes out the assembly collected so far, also to stdout when compiling verbosely
+ */
+void codegen_output_flush()
 {
-    va_list args;
-    va_start(args, ins);
-    vfprintf(stdout, ins, args);
-    va_end(args);
-
+    struct code_generator_output *output = &current_process->generator->output;
     if (current_process->ofile)
     {
-        va_list args;
-        va_start(args, ins);
-        vfprintf(current_process->ofile, ins, args);
-        va_end(args);
+        fwrite(output->data, 1, output->len, current_process->ofile);
+    }
+
+    if (current_process->flags & COMPILE_PROCESS_VERBOSE)
+    {
+        fwrite(output->data, 1, output->len, stdout);
     }
+    output->len = 0;
 }
 
-void asm_push_args(const char *ins, va_list args)
+void codegen_output_vprintf(const char *fmt, va_list args)
 {
+    struct peephole *peephole = &current_process->generator->peephole;
+    if (peephole->instructions)
+    {
+        // The function is captured for the peephole optimiser, it is written out once it is complete
+        char text[CODEGEN_LINE_MAX * 2];
+        if (vsnprintf(text, sizeof(text), fmt, args) >= sizeof(text) || !peephole_write(peephole, text))
+        {
+            codegen_err("Generated assembly line is longer than %i bytes", CODEGEN_LINE_MAX);
+        }
+        return;
+    }
+
+    struct code_generator_output *output = &current_process->generator->output;
     va_list args2;
     va_copy(args2, args);
-    vfprintf(stdout, ins, args);
-    fprintf(stdout, "\n");
-    if (current_process->ofile)
+    size_t space = sizeof(output->data) - output->len;
+    size_t len = vsnprintf(&output->data[output->len], space, fmt, args);
+    if (len >= space)
+    {
+        // Not enough room left in the chunk, write it out and start a new one
+        codegen_output_flush();
+        len = vsnprintf(output->data, sizeof(output->data), fmt, args2);
+        if (len >= sizeof(output->data))
+        {
+            codegen_err("Generated assembly line is larger than %i bytes", CODEGEN_OUTPUT_CHUNK_SIZE);
+        }
+    }
+    output->len += len;
+    va_end(args2);
+}
+
+void codegen_output_printf(const char *fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    codegen_output_vprintf(fmt, args);
+    va_end(args);
+}
+
+static void codegen_output_line(const char *line)
+{
+    codegen_output_printf("%s\n", line);
+}
+
+static const char *codegen_temporary_registers[CODEGEN_TOTAL_TEMPORARY_REGISTERS] = {"esi", "edi"};
+
+static struct code_generator_temporaries *codegen_temporaries()
+{
+    return &current_process->generator->temporaries;
+}
+
+static bool codegen_temporaries_empty()
+{
+    struct code_generator_temporaries *temporaries = codegen_temporaries();
+    return !temporaries->pending[0] && !temporaries->used;
+}
+
+static bool codegen_stack_frame_element_is_temporary(struct stack_frame_element *element)
+{
+    return element->flags & (STACK_FRAME_ELEMENT_FLAG_IN_REGISTER | STACK_FRAME_ELEMENT_FLAG_PENDING);
+}
+
+static void codegen_temporary_release(struct stack_frame_element *element)
+{
+    struct code_generator_temporaries *temporaries = codegen_temporaries();
+    if (element->flags & STACK_FRAME_ELEMENT_FLAG_PENDING)
+    {
+        temporaries->pending[0] = 0;
+    }
+
+    for (int i = 0; i < CODEGEN_TOTAL_TEMPORARY_REGISTERS; i++)
+    {
+        if ((element->flags & STACK_FRAME_ELEMENT_FLAG_IN_REGISTER) && S_EQ(element->reg, codegen_temporary_registers[i]))
+        {
+            temporaries->used &= ~(1 << i);
+        }
+    }
+    element->flags &= ~(STACK_FRAME_ELEMENT_FLAG_IN_REGISTER | STACK_FRAME_ELEMENT_FLAG_PENDING);
+    element->reg = NULL;
+}
+
+/**
+ * Returns the index of the lowest stack frame element that is a temporary, temporaries are
+ * always the top most elements of the stack frame. Returns the total elements if there are none.
+ */
+static int codegen_temporaries_start()
+{
+    struct vector *elements = current_function->func.frame.elements;
+    int index = vector_count(elements);
+    while (index > 0 && codegen_stack_frame_element_is_temporary(vector_at(elements, index - 1)))
+    {
+        index--;
+    }
+    return index;
+}
+
+/**
+ * Pushes the temporaries to the machine stack, lowest first. Afterwards the machine stack
+ * is exactly what the stack frame describes.
+ */
+void codegen_temporaries_spill()
+{
+    if (codegen_temporaries_empty())
+    {
+        return;
+    }
+
+    struct vector *elements = current_function->func.frame.elements;
+    for (int i = codegen_temporaries_start(); i < vector_count(elements); i++)
+    {
+        struct stack_frame_element *element = vector_at(elements, i);
+        codegen_output_printf("push %s\n", (element->flags & STACK_FRAME_ELEMENT_FLAG_PENDING) ? codegen_temporaries()->pending : element->reg);
+        codegen_temporary_release(element);
+    }
+}
+
+/**
+ * Returns a free temporary register, when all are taken the one holding the lowest
+ * element is pushed to the machine stack as it will be needed last.
+ */
+static const char *codegen_temporary_register_take()
+{
+    struct code_generator_temporaries *temporaries = codegen_temporaries();
+    if (temporaries->used == (1 << CODEGEN_TOTAL_TEMPORARY_REGISTERS) - 1)
+    {
+        struct stack_frame_element *lowest = vector_at(current_function->func.frame.elements, codegen_temporaries_start());
+        codegen_output_printf("push %s\n", lowest->reg);
+        codegen_temporary_release(lowest);
+    }
+
+    for (int i = 0; i < CODEGEN_TOTAL_TEMPORARY_REGISTERS; i++)
+    {
+        if (!(temporaries->used & (1 << i)))
+        {
+            temporaries->used |= 1 << i;
+            return codegen_temporary_registers[i];
+        }
+    }
+
+    FAIL_ERR("No temporary register is free");
+    return NULL;
+}
+
+/**
+ * Moves the pending push into a temporary register, the operand may not be valid
+ * once the next instruction runs.
+ */
+static void codegen_temporary_materialize()
+{
+    struct code_generator_temporaries *temporaries = codegen_temporaries();
+    if (!temporaries->pending[0])
+    {
+        return;
+    }
+
+    struct stack_frame_element *element = stackframe_back(current_function);
+    assert(element->flags & STACK_FRAME_ELEMENT_FLAG_PENDING);
+    const char *reg = codegen_temporary_register_take();
+    codegen_output_printf("mov %s, %s\n", reg, temporaries->pending);
+    temporaries->pending[0] = 0;
+    element->flags = (element->flags & ~STACK_FRAME_ELEMENT_FLAG_PENDING) | STACK_FRAME_ELEMENT_FLAG_IN_REGISTER;
+    element->reg = reg;
+}
+
+/**
+ * Returns true if the instruction jumps, is a label or depends on where the stack pointer is.
+ * The temporaries must be on the machine stack before any of these.
+ */
+static bool codegen_instruction_observes_stack(const char *line)
+{
+    size_t len = strlen(line);
+    if (len && line[len - 1] == ':')
+    {
+        return true;
+    }
+
+    return line[0] == 'j' ||
+           strncmp(line, "push", 4) == 0 ||
+           strncmp(line, "pop", 3) == 0 ||
+           strncmp(line, "call", 4) == 0 ||
+           strncmp(line, "ret", 3) == 0 ||
+           strstr(line, "esp");
+}
+
+static void codegen_temporaries_before_instruction(const char *line)
+{
+    if (codegen_temporaries_empty() || line[0] == ';' || line[0] == 0)
     {
+        return;
+    }
 
-        vfprintf(current_process->ofile, ins, args2);
-        fprintf(current_process->ofile, "\n");
+    if (codegen_instruction_observes_stack(line))
+    {
+        codegen_temporaries_spill();
+        return;
     }
+
+    codegen_temporary_materialize();
+}
+
+void asm_push_no_nl(const char *ins, ...)
+{
+    codegen_temporaries_spill();
+
+    va_list args;
+    va_start(args, ins);
+    codegen_output_vprintf(ins, args);
+    va_end(args);
+}
+
+void asm_push_args(const char *ins, va_list args)
+{
+    char line[CODEGEN_LINE_MAX];
+    if (vsnprintf(line, sizeof(line), ins, args) >= sizeof(line))
+    {
+        codegen_err("Generated assembly line is longer than %i bytes", CODEGEN_LINE_MAX);
+    }
+
+    codegen_temporaries_before_instruction(line);
+    codegen_output_printf("%s\n", line);
 }
 
 void codegen_data_section_add(const char* data, ...)
@@ -606,47 +818,58 @@ void asm_push(const char *ins, ...)
     va_end(args);
 }
 
+/**
+ * Pushes the element to the stack frame. Values that nothing else on the machine stack depends on
+ * are kept as pending temporaries, the push is only emitted if it turns out to be needed.
+ */
+void asm_push_ins_push_element(struct stack_frame_element *element, const char *fmt, va_list args)
+{
+    char operand[CODEGEN_LINE_MAX];
+    if (vsnprintf(operand, sizeof(operand), fmt, args) >= sizeof(operand))
+    {
+        codegen_err("Pushed operand is longer than %i bytes", CODEGEN_LINE_MAX);
+    }
+
+    // Let's add it to the stack frame for compiler referencing
+    assert(current_function);
+    bool temporary = (element->type == STACK_FRAME_ELEMENT_TYPE_PUSHED_VALUE || element->type == STACK_FRAME_ELEMENT_TYPE_SAVED_REGISTER) && !strstr(operand, "esp");
+    if (!temporary)
+    {
+        codegen_temporaries_spill();
+        codegen_output_printf("push %s\n", operand);
+        stackframe_push(current_function, element);
+        return;
+    }
+
+    codegen_temporary_materialize();
+    strcpy(codegen_temporaries()->pending, operand);
+    element->flags |= STACK_FRAME_ELEMENT_FLAG_PENDING;
+    stackframe_push(current_function, element);
+}
+
 void asm_push_ins_push_with_flags(const char *fmt, int stack_entity_type, const char *stack_entity_name, int flags, ...)
 {
-    char tmp_buf[200];
-    sprintf(tmp_buf, "push %s", fmt);
     va_list args;
     va_start(args, flags);
-    asm_push_args(tmp_buf, args);
+    asm_push_ins_push_element(&(struct stack_frame_element){.flags = flags, .type = stack_entity_type, .name = stack_entity_name}, fmt, args);
     va_end(args);
-
-    // Let's add it to the stack frame for compiler referencing
-    assert(current_function);
-    stackframe_push(current_function, &(struct stack_frame_element){.flags = flags, .type = stack_entity_type, .name = stack_entity_name});
 }
 
 void asm_push_ins_push_with_data(const char *fmt, int stack_entity_type, const char *stack_entity_name, int flags, struct stack_frame_data *data, ...)
 {
-    char tmp_buf[200];
-    sprintf(tmp_buf, "push %s", fmt);
+    flags |= STACK_FRAME_ELEMENT_FLAG_HAS_DATATYPE;
     va_list args;
     va_start(args, data);
-    asm_push_args(tmp_buf, args);
+    asm_push_ins_push_element(&(struct stack_frame_element){.type = stack_entity_type, .name = stack_entity_name, .flags = flags, .data = *data}, fmt, args);
     va_end(args);
-
-    flags |= STACK_FRAME_ELEMENT_FLAG_HAS_DATATYPE;
-    // Let's add it to the stack frame for compiler referencing
-    assert(current_function);
-    stackframe_push(current_function, &(struct stack_frame_element){.type = stack_entity_type, .name = stack_entity_name, .flags = flags, .data = *data});
 }
 
 void asm_push_ins_push(const char *fmt, int stack_entity_type, const char *stack_entity_name, ...)
 {
-    char tmp_buf[200];
-    sprintf(tmp_buf, "push %s", fmt);
     va_list args;
     va_start(args, stack_entity_name);
-    asm_push_args(tmp_buf, args);
+    asm_push_ins_push_element(&(struct stack_frame_element){.type = stack_entity_type, .name = stack_entity_name}, fmt, args);
     va_end(args);
-
-    // Let's add it to the stack frame for compiler referencing
-    assert(current_function);
-    stackframe_push(current_function, &(struct stack_frame_element){.type = stack_entity_type, .name = stack_entity_name});
 }
 
 struct stack_frame_element *asm_stack_back()
@@ -684,23 +907,58 @@ bool asm_datatype_back(struct datatype *dtype_out)
     return true;
 }
 
-int asm_push_ins_pop(const char *fmt, int expecting_stack_entity_type, const char *expecting_stack_entity_name, ...)
+/**
+ * Pops the top stack frame element into the operand, temporaries become a move.
+ * Returns the flags the element was pushed with.
+ */
+int asm_push_ins_pop_element(const char *fmt, int expecting_stack_entity_type, const char *expecting_stack_entity_name, va_list args)
 {
-    char tmp_buf[200];
-    sprintf(tmp_buf, "pop %s", fmt);
-    va_list args;
-    va_start(args, expecting_stack_entity_name);
-    asm_push_args(tmp_buf, args);
-    va_end(args);
+    char operand[CODEGEN_LINE_MAX];
+    if (vsnprintf(operand, sizeof(operand), fmt, args) >= sizeof(operand))
+    {
+        codegen_err("Popped operand is longer than %i bytes", CODEGEN_LINE_MAX);
+    }
 
-    // Let's add it to the stack frame for compiler referencing
     assert(current_function);
     struct stack_frame_element *element = stackframe_back(current_function);
-    int flags = element->flags;
+    int flags = element->flags & ~(STACK_FRAME_ELEMENT_FLAG_IN_REGISTER | STACK_FRAME_ELEMENT_FLAG_PENDING);
+    const char *pending = codegen_temporaries()->pending;
+    if ((element->flags & STACK_FRAME_ELEMENT_FLAG_PENDING) && strchr(operand, '[') && strchr(pending, '['))
+    {
+        // We cannot move memory to memory
+        codegen_temporary_materialize();
+    }
+
+    if (element->flags & STACK_FRAME_ELEMENT_FLAG_PENDING)
+    {
+        if (!S_EQ(operand, pending))
+        {
+            codegen_output_printf("mov %s, %s\n", operand, pending);
+        }
+    }
+    else if (element->flags & STACK_FRAME_ELEMENT_FLAG_IN_REGISTER)
+    {
+        codegen_output_printf("mov %s, %s\n", operand, element->reg);
+    }
+    else
+    {
+        codegen_output_printf("pop %s\n", operand);
+    }
+
+    codegen_temporary_release(element);
     stackframe_pop_expecting(current_function, expecting_stack_entity_type, expecting_stack_entity_name);
     return flags;
 }
 
+int asm_push_ins_pop(const char *fmt, int expecting_stack_entity_type, const char *expecting_stack_entity_name, ...)
+{
+    va_list args;
+    va_start(args, expecting_stack_entity_name);
+    int flags = asm_push_ins_pop_element(fmt, expecting_stack_entity_type, expecting_stack_entity_name, args);
+    va_end(args);
+    return flags;
+}
+
 int asm_push_ins_pop_or_ignore(const char *fmt, int expecting_stack_entity_type, const char *expecting_stack_entity_name, ...)
 {
     if (!stackframe_back_expect(current_function, expecting_stack_entity_type, expecting_stack_entity_name))
@@ -708,16 +966,10 @@ int asm_push_ins_pop_or_ignore(const char *fmt, int expecting_stack_entity_type,
         return STACK_FRAME_ELEMENT_FLAG_ELEMENT_NOT_FOUND;
     }
 
-    char tmp_buf[200];
-    sprintf(tmp_buf, "pop %s", fmt);
     va_list args;
     va_start(args, expecting_stack_entity_name);
-    asm_push_args(tmp_buf, args);
+    int flags = asm_push_ins_pop_element(fmt, expecting_stack_entity_type, expecting_stack_entity_name, args);
     va_end(args);
-
-    struct stack_frame_element *element = stackframe_back(current_function);
-    int flags = element->flags;
-    stackframe_pop_expecting(current_function, expecting_stack_entity_type, expecting_stack_entity_name);
     return flags;
 }
 
@@ -740,6 +992,7 @@ void codegen_stack_sub_with_name(size_t stack_size, const char *name)
 {
     if (stack_size != 0)
     {
+        codegen_temporaries_spill();
         stackframe_sub(current_function, STACK_FRAME_ELEMENT_TYPE_UNKNOWN, name, stack_size);
         asm_push("sub esp, %lld", stack_size);
     }
@@ -760,6 +1013,16 @@ void codegen_stack_add_no_compile_time_stack_frame_restore(size_t stack_size)
 
 void codegen_stack_add(size_t stack_size)
 {
+    // Temporaries that are thrown away never have to reach the machine stack
+    struct stack_frame_element *element = stackframe_back(current_function);
+    while (stack_size != 0 && element && codegen_stack_frame_element_is_temporary(element))
+    {
+        codegen_temporary_release(element);
+        stackframe_pop(current_function);
+        stack_size -= DATA_SIZE_DWORD;
+        element = stackframe_back(current_function);
+    }
+
     if (stack_size != 0)
     {
         stackframe_add(current_function, stack_size);
@@ -1534,6 +1797,8 @@ void codegen_generate_entity_access_for_function_call(struct resolver_result *re
     {
         struct history history;
         codegen_generate_expressionable(node, history_begin(&history, EXPRESSION_IN_FUNCTION_CALL_ARGUMENTS));
+        // Arguments are passed on the machine stack, pushing them now saves moving them through a register
+        codegen_temporaries_spill();
         node = vector_peek_ptr(entity->func_call_data.arguments);
     }
 
@@ -2865,14 +3130,48 @@ void codegen_generate_statement_return_exp(struct node *node)
     asm_push_ins_pop("eax", STACK_FRAME_ELEMENT_TYPE_PUSHED_VALUE, "result_value");
 }
 
+/**
+ * Returns the size of the stack frame for the function, its locals and the room to save the temporary registers
+ */
+size_t codegen_function_frame_size(struct node *func_node)
+{
+    size_t locals_size = C_ALIGN(function_node_stack_size(func_node));
+    return locals_size + CODEGEN_TEMPORARY_REGISTERS_SAVE_SIZE;
+}
+
+/**
+ * Our callers expect esi and edi to be preserved, they are saved below the locals of the function
+ */
+void codegen_save_temporary_registers(struct node *func_node)
+{
+    size_t offset = C_ALIGN(function_node_stack_size(func_node));
+    for (int i = 0; i < CODEGEN_TOTAL_TEMPORARY_REGISTERS; i++)
+    {
+        offset += DATA_SIZE_DWORD;
+        asm_push("mov dword [ebp-%i], %s", offset, codegen_temporary_registers[i]);
+    }
+}
+
+void codegen_restore_temporary_registers(struct node *func_node)
+{
+    size_t offset = C_ALIGN(function_node_stack_size(func_node));
+    for (int i = 0; i < CODEGEN_TOTAL_TEMPORARY_REGISTERS; i++)
+    {
+        offset += DATA_SIZE_DWORD;
+        asm_push("mov %s, dword [ebp-%i]", codegen_temporary_registers[i], offset);
+    }
+}
+
 void codegen_generate_statement_return(struct node *node)
 {
     if (node->stmt.ret.exp)
     {
         codegen_generate_statement_return_exp(node);
     }
+    codegen_restore_temporary_registers(node->binded.function);
+
     // Generate the stack subtraction.
-    codegen_stack_add_no_compile_time_stack_frame_restore(C_ALIGN(function_node_stack_size(node->binded.function)));
+    codegen_stack_add_no_compile_time_stack_frame_restore(codegen_function_frame_size(node->binded.function));
 
     // Now we must leave the function
     asm_pop_ebp_no_stack_frame_restore();
@@ -2937,12 +3236,17 @@ void codegen_generate_while_stmt(struct node *node)
     int while_end_id = codegen_label_count();
     asm_push(".while_start_%i:", while_start_id);
 
-    // Generate the expressionable condition
-    codegen_generate_brand_new_expression(node->stmt._while.cond, history_begin(&history, 0));
-    asm_push_ins_pop("eax", STACK_FRAME_ELEMENT_TYPE_PUSHED_VALUE, "result_value");
+    // A condition folded to a non zero number is always true, there is nothing to test
+    struct node *cond = node->stmt._while.cond;
+    if (cond->type != NODE_TYPE_NUMBER || !cond->llnum)
+    {
+        // Generate the expressionable condition
+        codegen_generate_brand_new_expression(cond, history_begin(&history, 0));
+        asm_push_ins_pop("eax", STACK_FRAME_ELEMENT_TYPE_PUSHED_VALUE, "result_value");
 
-    asm_push("cmp eax, 0");
-    asm_push("je .while_end_%i", while_end_id);
+        asm_push("cmp eax, 0");
+        asm_push("je .while_end_%i", while_end_id);
+    }
     // Okay, let us now generate the body
     codegen_generate_body(node->stmt._while.body, history_begin(&history, IS_ALONE_STATEMENT));
     asm_push("jmp .while_start_%i", while_start_id);
@@ -3116,6 +3420,10 @@ void codegen_generate_statement(struct node *node, struct history *history)
     switch (node->type)
     {
 
+    case NODE_TYPE_BODY:
+        codegen_generate_body(node, history_begin(history, history->flags));
+        break;
+
     case NODE_TYPE_EXPRESSION:
         codegen_generate_exp_node(node, history_begin(history, history->flags));
         break;
@@ -3218,6 +3526,7 @@ void codegen_generate_function_prototype(struct node *node)
 
 void codegen_generate_function_with_body(struct node *node)
 {
+    memset(&current_process->generator->temporaries, 0, sizeof(current_process->generator->temporaries));
     // We must register this function
     codegen_register_function(node, 0);
     asm_push("global %s", node->func.name);
@@ -3227,7 +3536,8 @@ void codegen_generate_function_with_body(struct node *node)
     // We have to create a stack frame ;)
     asm_push_ebp();
     asm_push("mov ebp, esp");
-    codegen_stack_sub(C_ALIGN(function_node_stack_size(node)));
+    codegen_stack_sub(codegen_function_frame_size(node));
+    codegen_save_temporary_registers(node);
     // Generate scope for function arguments
     codegen_new_scope(RESOLVER_DEFAULT_ENTITY_FLAG_IS_LOCAL_STACK);
 
@@ -3241,7 +3551,8 @@ void codegen_generate_function_with_body(struct node *node)
     // End function argument scope
     codegen_finish_scope();
 
-    codegen_stack_add(C_ALIGN(function_node_stack_size(node)));
+    codegen_restore_temporary_registers(node);
+    codegen_stack_add(codegen_function_frame_size(node));
 
     asm_pop_ebp();
     // We expect the compiler stack frame to be empty at this point.
@@ -3249,6 +3560,49 @@ void codegen_generate_function_with_body(struct node *node)
 
     asm_push("ret");
 }
+
+/**
+ * Lowers the function to the IR, returns NULL if the function must be generated from the tree
+ */
+struct ir_function *codegen_lower_function(struct node *node)
+{
+    int flags = current_process->flags;
+    if ((flags & COMPILE_PROCESS_NO_IR) && !(flags & COMPILE_PROCESS_EMIT_IR))
+    {
+        return NULL;
+    }
+
+    const char *reason = NULL;
+    struct ir_function *function = ir_lower_function(current_process, node, &reason);
+    if (flags & COMPILE_PROCESS_EMIT_IR)
+    {
+        if (function)
+        {
+            ir_function_dump(function, stdout);
+        }
+        else
+        {
+            printf("function %s is not lowered: %s\n\n", node->func.name, reason);
+        }
+    }
+
+    if (function && (flags & COMPILE_PROCESS_NO_IR))
+    {
+        ir_function_free(function);
+        return NULL;
+    }
+    return function;
+}
+
+void codegen_generate_function_from_ir(struct node *node, struct ir_function *function)
+{
+    codegen_register_function(node, 0);
+    asm_push("global %s", node->func.name);
+    asm_push("; %s function", node->func.name);
+    asm_push("%s:", node->func.name);
+    ir_x86_generate_function(&x86_codegen, function);
+}
+
 void codegen_generate_function(struct node *node)
 {
     current_function = node;
@@ -3258,7 +3612,30 @@ void codegen_generate_function(struct node *node)
         return;
     }
 
-    codegen_generate_function_with_body(node);
+    struct ir_function *ir_function = codegen_lower_function(node);
+
+    struct peephole *peephole = &current_process->generator->peephole;
+    bool optimise = !(current_process->flags & COMPILE_PROCESS_NO_PEEPHOLE);
+    if (optimise)
+    {
+        peephole_begin(peephole);
+    }
+
+    if (ir_function)
+    {
+        codegen_generate_function_from_ir(node, ir_function);
+        ir_function_free(ir_function);
+    }
+    else
+    {
+        codegen_generate_function_with_body(node);
+    }
+
+    if (optimise)
+    {
+        peephole_end(peephole, codegen_output_line);
+    }
+    codegen_output_flush();
 }
 
 void codegen_generate_root_node(struct node *node)
@@ -3383,6 +3760,7 @@ int codegen(struct compile_process *process)
 
     // Finally generate read only data
     codegen_generate_rod();
+    codegen_output_flush();
 
     return 0;
 }
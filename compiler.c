@@ -2,11 +2,6 @@
 #include "misc.h"
 #include "helpers/vector.h"
 
-struct lex_process_functions compiler_lex_functions = {
-    .next_char = compile_process_next_char,
-    .peek_char = compile_process_peek_char,
-    .push_char = compile_process_push_char};
-
 void compiler_node_error(struct node *node, const char *msg, ...)
 {
     va_list args;
@@ -14,7 +9,19 @@ void compiler_node_error(struct node *node, const char *msg, ...)
     vfprintf(stderr, msg, args);
     va_end(args);
 
-    fprintf(stderr, " on line %i, col %i in file %s\n", node->pos.line, node->pos.col, node->pos.filename);
+    fprintf(stderr, " on line %i, col %i in file %s\n", node->pos.line, node->pos.col, compiler_file_name(node->pos.file));
+
+    exit(-1);
+}
+
+void compiler_pos_error(struct pos *pos, const char *msg, ...)
+{
+    va_list args;
+    va_start(args, msg);
+    vfprintf(stderr, msg, args);
+    va_end(args);
+
+    fprintf(stderr, " on line %i, col %i in file %s\n", pos->line, pos->col, compiler_file_name(pos->file));
 
     exit(-1);
 }
@@ -25,7 +32,7 @@ void compiler_error(struct compile_process *compiler, const char *msg, ...)
     vfprintf(stderr, msg, args);
     va_end(args);
 
-    fprintf(stderr, " on line %i, col %i in file %s\n", compiler->pos.line, compiler->pos.col, compiler->pos.filename);
+    fprintf(stderr, " on line %i, col %i in file %s\n", compiler->pos.line, compiler->pos.col, compiler_file_name(compiler->pos.file));
 
     exit(-1);
 }
@@ -94,35 +101,96 @@ void test(struct node *node)
     }
 }
 
-struct compile_process *compile_include_for_include_dir(const char *include_dir, const char *filename, struct compile_process *parent_process)
+bool compile_include_resolve(const char *filename, struct compile_process *parent_process, char *path_out)
 {
+    // Resolved before? Then the filesystem does not need asking again, even when it was not found.
+    int cached = include_cache_lookup(parent_process, filename, path_out);
+    if (cached != INCLUDE_CACHE_UNKNOWN)
+    {
+        return cached == INCLUDE_CACHE_FOUND;
+    }
+
     char tmp_filename[512];
-    sprintf(tmp_filename, "%s/%s", include_dir, filename);
-    if (file_exists(tmp_filename))
+    int calls = 0;
+    const char *include_dir = compiler_include_dir_begin(parent_process);
+    while (include_dir)
     {
-        filename = tmp_filename;
+        // Relative to the include directory first, otherwise relative to where we are
+        sprintf(tmp_filename, "%s/%s", include_dir, filename);
+        const char *path = file_exists(tmp_filename) ? tmp_filename : filename;
+        calls += 2;
+        if (realpath(path, path_out))
+        {
+            include_cache_insert(parent_process, filename, path_out, calls);
+            return true;
+        }
+        include_dir = compiler_include_dir_next(parent_process);
     }
 
-    struct compile_process *process = compile_process_create(filename, NULL, parent_process->flags, parent_process);
-    if (!process)
-        return NULL;
+    include_cache_insert(parent_process, filename, NULL, calls);
+    return false;
+}
 
-    struct lex_process *lex_process = lex_process_create(process, &compiler_lex_functions, NULL);
+/**
+ * Lexes the file of the process into token_vec_original. Unless the whole file is wanted
+ * only its first piece is lexed here, the preprocessor asks for the rest as it needs it and
+ * skips the lines of #if groups that are not compiled without lexing them.
+ */
+static bool compile_lex(struct compile_process *process, bool whole_file)
+{
+    struct lex_process *lex_process = lex_process_create_for_source(process, process->cfile.data, process->cfile.size);
     if (!lex_process)
     {
-        return NULL;
+        return false;
     }
 
-    if (lex(lex_process) != LEXICAL_ANALYSIS_ALL_OK)
+    process->token_vec_original = lex_process_tokens(lex_process);
+    // Only the lexer knows which lines are directives, directives only lexing is always on demand
+    bool directives_only = process->flags & COMPILE_PROCESS_DIRECTIVES_ONLY;
+    if (!directives_only && (whole_file || process->flags & COMPILE_PROCESS_NO_SKIP_INACTIVE))
+    {
+        return lex(lex_process) == LEXICAL_ANALYSIS_ALL_OK;
+    }
+
+    lex_begin(lex_process);
+    if (lex_next_conditional(lex_process))
+    {
+        process->lex_process = lex_process;
+    }
+    return true;
+}
+
+struct compile_process *compile_include_path(const char *path, struct compile_process *parent_process)
+{
+    double start = compile_timing_now();
+    struct compile_process *process = compile_process_create(path, NULL, parent_process->flags, parent_process);
+    if (!process)
         return NULL;
 
-    process->token_vec_original = lex_process_tokens(lex_process);
+    compile_timing_begin(process, COMPILE_PHASE_LEX);
+    // A header that has not changed since it was cached is not lexed again
+    process->token_vec_original = token_cache_load(process);
+    bool cached = process->token_vec_original != NULL;
+    if (!cached)
+    {
+        // Only a header that is lexed whole can be cached, preprocessing alone lexes it in pieces
+        bool whole_file = token_cache_get_directory() != NULL && !(process->flags & (COMPILE_PROCESS_DIRECTIVES_ONLY | COMPILE_PROCESS_PREPROCESS_ONLY));
+        if (!compile_lex(process, whole_file))
+            return NULL;
+
+        if (whole_file)
+            token_cache_store(process, process->token_vec_original);
+    }
+    compile_timing_end(process, vector_count(process->token_vec_original));
 
+    compile_timing_begin(process, COMPILE_PHASE_PREPROCESS);
     if (preprocessor_run(process) != 0)
     {
         return NULL;
     }
+    compile_timing_end(process, vector_count(process->token_vec));
 
+    compile_timing_include(parent_process, process->cfile.abs_path, start, vector_count(process->token_vec), cached);
     return process;
 }
 
@@ -135,15 +203,13 @@ struct compile_process *compile_include_for_include_dir(const char *include_dir,
  */
 struct compile_process *compile_include(const char *filename, struct compile_process *parent_process)
 {
-    struct compile_process *new_process = NULL;
-    const char *include_dir = compiler_include_dir_begin(parent_process);
-    while (include_dir && !new_process)
+    char path[PATH_MAX];
+    if (!compile_include_resolve(filename, parent_process, path))
     {
-        new_process = compile_include_for_include_dir(include_dir, filename, parent_process);
-        include_dir = compiler_include_dir_next(parent_process);
+        return NULL;
     }
 
-    return new_process;
+    return compile_include_path(path, parent_process);
 }
 
 int compile_file(const char *filename, const char *out_filename, int flags)
@@ -152,42 +218,164 @@ int compile_file(const char *filename, const char *out_filename, int flags)
     if (!process)
         return COMPILER_FAILED_WITH_ERRORS;
 
-    struct lex_process *lex_process = lex_process_create(process, &compiler_lex_functions, NULL);
-    if (!lex_process)
-    {
+    compile_timing_begin(process, COMPILE_PHASE_LEX);
+    if (!compile_lex(process, false))
         return COMPILER_FAILED_WITH_ERRORS;
-    }
 
-    if (lex(lex_process) != LEXICAL_ANALYSIS_ALL_OK)
+    compile_timing_end(process, vector_count(process->token_vec_original));
+
+    compile_timing_begin(process, COMPILE_PHASE_PREPROCESS);
+    // Start from the precompiled header if there is one, as if it was included first
+    if (pch_restore(process) != 0 || preprocessor_run(process) != 0)
+    {
         return COMPILER_FAILED_WITH_ERRORS;
+    }
+    compile_timing_end(process, vector_count(process->token_vec));
 
-    process->token_vec_original = lex_process_tokens(lex_process);
-    if (preprocessor_run(process) != 0)
+    if (depend_write(process) != 0)
     {
         return COMPILER_FAILED_WITH_ERRORS;
     }
 
     // Symbol resolution is now done during parsing..
+    size_t total_nodes = node_total_created();
+    compile_timing_begin(process, COMPILE_PHASE_PARSE);
     if (parse(process) != PARSE_ALL_OK)
         return COMPILER_FAILED_WITH_ERRORS;
+    total_nodes = node_total_created() - total_nodes;
+    compile_timing_end(process, total_nodes);
 
     // We must validate the tree to ensure people aren't setting variables that dont exist
     // ect..
+    compile_timing_begin(process, COMPILE_PHASE_VALIDATE);
     if (validate(process) != VALIDATION_ALL_OK)
         return COMPILER_FAILED_WITH_ERRORS;
+    compile_timing_end(process, total_nodes);
+
+    if (!(flags & COMPILE_PROCESS_NO_FOLD))
+    {
+        compile_timing_begin(process, COMPILE_PHASE_FOLD);
+        fold(process);
+        compile_timing_end(process, total_nodes);
+    }
 
-    for (int i = 0; i < vector_count(process->node_tree_vec); i++)
+    if (flags & COMPILE_PROCESS_VERBOSE)
     {
-        struct node *ptr;
-        ptr = *((struct node **)(vector_at(process->node_tree_vec, i)));
-        test(ptr);
+        for (int i = 0; i < vector_count(process->node_tree_vec); i++)
+        {
+            struct node *ptr;
+            ptr = *((struct node **)(vector_at(process->node_tree_vec, i)));
+            test(ptr);
+        }
+        printf("\n");
     }
-    printf("\n");
     // Do validation here..
 
+    compile_timing_begin(process, COMPILE_PHASE_CODEGEN);
     if (codegen(process) != CODEGEN_ALL_OK)
         return COMPILER_FAILED_WITH_ERRORS;
+    compile_timing_end(process, total_nodes);
 
+    compile_timing_report(process, stderr);
     compile_process_destroy(process);
+    include_cache_store();
     return COMPILER_FILE_COMPILED_OK;
-}
\ No newline at end of file
+}
+
+int compile_pch(const char *filename, const char *pch_filename, int flags)
+{
+    struct compile_process *process = compile_process_create(filename, NULL, flags, NULL);
+    if (!process)
+        return COMPILER_FAILED_WITH_ERRORS;
+
+    compile_timing_begin(process, COMPILE_PHASE_LEX);
+    if (!compile_lex(process, false))
+        return COMPILER_FAILED_WITH_ERRORS;
+
+    compile_timing_end(process, vector_count(process->token_vec_original));
+
+    compile_timing_begin(process, COMPILE_PHASE_PREPROCESS);
+    if (preprocessor_run(process) != 0)
+    {
+        return COMPILER_FAILED_WITH_ERRORS;
+    }
+    compile_timing_end(process, vector_count(process->token_vec));
+
+    if (pch_write(process, pch_filename) != 0)
+    {
+        fprintf(stderr, "Unable to write the precompiled header %s\n", pch_filename);
+        return COMPILER_FAILED_WITH_ERRORS;
+    }
+
+    compile_timing_report(process, stderr);
+    compile_process_destroy(process);
+    include_cache_store();
+    return COMPILER_FILE_COMPILED_OK;
+}
+
+int compile_dependencies(const char *filename, const char *target, FILE *out, int flags)
+{
+    struct compile_process *process = compile_process_create(filename, NULL, flags, NULL);
+    if (!process)
+        return COMPILER_FAILED_WITH_ERRORS;
+
+    compile_timing_begin(process, COMPILE_PHASE_LEX);
+    if (!compile_lex(process, false))
+        return COMPILER_FAILED_WITH_ERRORS;
+
+    compile_timing_end(process, vector_count(process->token_vec_original));
+
+    compile_timing_begin(process, COMPILE_PHASE_PREPROCESS);
+    if (pch_restore(process) != 0 || preprocessor_run(process) != 0)
+    {
+        return COMPILER_FAILED_WITH_ERRORS;
+    }
+    compile_timing_end(process, vector_count(process->token_vec));
+
+    depend_write_rule(process, target, out);
+    compile_timing_report(process, stderr);
+    compile_process_destroy(process);
+    include_cache_store();
+    return COMPILER_FILE_COMPILED_OK;
+}
+
+int compile_preprocess(const char *filename, FILE *out, int flags)
+{
+    struct compile_process *process = compile_process_create(filename, NULL, flags, NULL);
+    if (!process)
+        return COMPILER_FAILED_WITH_ERRORS;
+
+    compile_timing_begin(process, COMPILE_PHASE_LEX);
+    if (!compile_lex(process, false))
+        return COMPILER_FAILED_WITH_ERRORS;
+
+    compile_timing_end(process, vector_count(process->token_vec_original));
+
+    compile_timing_begin(process, COMPILE_PHASE_PREPROCESS);
+    // The tokens are written as they are produced, included files write theirs too
+    preprocessor_output_begin(process->preprocessor, out);
+    if (pch_restore(process) != 0)
+    {
+        return COMPILER_FAILED_WITH_ERRORS;
+    }
+
+    // A precompiled header comes first, written where the header had its tokens
+    preprocessor_output_write_restored(process);
+
+    if (preprocessor_run(process) != 0)
+    {
+        return COMPILER_FAILED_WITH_ERRORS;
+    }
+    compile_timing_end(process, process->preprocessor->output.tokens);
+
+    if (preprocessor_output_end(process->preprocessor) != 0)
+    {
+        fprintf(stderr, "Unable to write the preprocessed output of %s\n", filename);
+        return COMPILER_FAILED_WITH_ERRORS;
+    }
+
+    compile_timing_report(process, stderr);
+    compile_process_destroy(process);
+    include_cache_store();
+    return COMPILER_FILE_COMPILED_OK;
+}
@@ -6,11 +6,13 @@
 #include <memory.h>
 #include <string.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <assert.h>
 #include <string.h>
 #include <linux/limits.h>
 
 #include "helpers/vector.h"
+#include "helpers/atom.h"
 
 #define FAIL_ERR(message) assert(0 == 1 && message)
 
@@ -26,8 +28,10 @@
 #define DEPTH_INFINITE 0xffff
 
 // Macro's make life cleaner..
+// Identical pointers are equal without touching the characters, which is always
+// the case when both sides are atoms.
 #define S_EQ(str, str2) \
-    (str && str2 && (strcmp(str, str2) == 0))
+    (str && str2 && ((str) == (str2) || strcmp(str, str2) == 0))
 
 /**
  * Note: we do not include ")" as an operator only "(". ")" is classed as a symbol.
@@ -79,11 +83,16 @@
     case ')':       \
     case ']'
 
+#define POS_MAX_COL UINT16_MAX
+
 struct pos
 {
     int line;
-    int col;
-    const char *filename;
+    // Kept to 16 bits each so a position packs into 8 bytes on every token. Columns past
+    // POS_MAX_COL are reported as POS_MAX_COL rather than wrapping.
+    uint16_t col;
+    // Index into the compiler file table, see compiler_file_name
+    uint16_t file;
 };
 
 enum
@@ -235,6 +244,18 @@ enum
 #define STACK_PUSH_SIZE 4
 #define FUNCTION_CALL_ARGUMENTS_GET_STACK_SIZE(total_args) total_args *STACK_PUSH_SIZE
 #define C_ALIGN(size) (size % C_STACK_ALIGNMENT) ? size + (C_STACK_ALIGNMENT - (size % C_STACK_ALIGNMENT)) : size
+
+// Size of the chunk the code generator collects assembly in before writing it out
+#define CODEGEN_OUTPUT_CHUNK_SIZE 65536
+
+// Longest assembly line or push operand the code generator formats
+#define CODEGEN_LINE_MAX 1024
+
+// Total temporary registers, esi and edi. They are never used by the code generator directly.
+#define CODEGEN_TOTAL_TEMPORARY_REGISTERS 2
+// Room reserved at the bottom of every stack frame for saving the temporary registers, kept 16 byte aligned
+#define CODEGEN_TEMPORARY_REGISTERS_SAVE_SIZE 16
+
 struct expression_state
 {
     int flags;
@@ -263,10 +284,17 @@ enum
 struct preprocessor;
 struct preprocessor_definition;
 
+struct preprocessor_expansion;
 struct preprocessor_function_argument
 {
-    // Tokens for this argument struct token
-    struct vector *tokens;
+    // The tokens of the argument, they point into the tokens the call was read from
+    // and are never copied out of them.
+    struct token *tokens;
+    int total;
+
+    // The macro expansion the call was read from, its arguments are substituted into
+    // these tokens. NULL if the call was not inside a macro.
+    struct preprocessor_expansion *expansion;
 };
 
 struct preprocessor_function_arguments
@@ -325,6 +353,12 @@ struct preprocessor_definition
 struct preprocessor_included_file
 {
     char filename[PATH_MAX];
+
+    // The macro of the include guard that wraps the whole file i.e #ifndef STDIO_H, NULL if the file has none
+    const char *guard;
+
+    // True if the file used #pragma once
+    bool once;
 };
 
 /**
@@ -336,8 +370,8 @@ typedef void (*PREPROCESSOR_STATIC_INCLUDE_HANDLER_POST_CREATION)(struct preproc
 struct preprocessor
 {
 
-    // Vector of preprocessor definitions struct preprocessor_definition*
-    struct vector *definitions;
+    // Preprocessor definitions struct preprocessor_definition* indexed by name
+    struct hashmap *definitions;
 
     // vector of (struct preprocessor_node*) .
     struct vector *exp_vector;
@@ -348,9 +382,89 @@ struct preprocessor
     struct compile_process *compiler;
 
     /** 
-     * Vector of included files struct preprocessor_included_file*
+     * Included files struct preprocessor_included_file* indexed by filename
      */
-    struct vector *includes;
+    struct hashmap *includes;
+    // The same files in the order they were first included, vector of struct preprocessor_included_file*
+    struct vector *include_order;
+
+    // Macros expanded so far and the vector allocations expanding them took.
+    // A macro expanded inside another is part of the outer expansion.
+    struct preprocessor_expansion_stats
+    {
+        size_t expansions;
+        size_t allocations;
+    } expansion_stats;
+    int expansion_depth;
+
+    // Argument vectors of finished macro calls kept for the next calls, vector of struct vector*
+    struct vector *argument_vectors;
+
+    // Expansions of the macro function calls written in the source, reused when a call is written again
+    struct preprocessor_expansion_cache
+    {
+        // Open addressed table of the calls seen, indexed by a hash of the definition and the call
+        struct preprocessor_expansion_cache_slot *slots;
+        size_t size;
+        size_t count;
+        size_t hits;
+        size_t misses;
+        // Set while expanding something that depends on more than the definitions and the call,
+        // i.e a native definition such as __LINE__
+        bool uncacheable;
+    } expansion_cache;
+
+    // Evaluation of #if and #elif conditions, see preprocessor/condition.c
+    struct preprocessor_conditions
+    {
+        // The tokens of the condition being evaluated as written and once expanded, kept
+        // from one condition to the next so evaluating a condition does not allocate
+        struct vector *line;
+        struct vector *expanded;
+
+        // True while a condition is expanded, every definition looked up is a dependency
+        bool recording;
+        // Index of the first dependency of the condition being expanded
+        int recording_from;
+        // The names every cached condition looked up and the definitions they had,
+        // vector of struct preprocessor_condition_dependency
+        struct vector *dependencies;
+
+        // Open addressed table of evaluated conditions, indexed by a hash of their tokens
+        struct preprocessor_condition_slot *slots;
+        size_t size;
+        size_t count;
+
+        size_t evaluated;
+        size_t hits;
+        size_t allocations;
+    } conditions;
+
+    // #if groups that were not compiled and were skipped without being lexed
+    struct preprocessor_inactive_stats
+    {
+        size_t groups;
+        size_t bytes;
+    } inactive;
+
+    // Set when only preprocessing, the output is written as text as it is produced rather
+    // than kept in the token vector of each file, see preprocessor/output.c
+    struct preprocessor_output
+    {
+        FILE *fp;
+        // False until a #line marker is written, and again whenever a file is entered or left
+        bool started;
+        // The file and line of the source that the line being written comes from
+        uint16_t file;
+        int line;
+        // True until a token is written on the line
+        bool line_empty;
+        // Enough of the last token written to decide if a space must separate it from the next
+        uint8_t last_type;
+        char last_char;
+        bool last_whitespace;
+        size_t tokens;
+    } output;
 };
 
 struct string_table_element
@@ -367,6 +481,62 @@ struct parsed_switch_case
     int index;
 };
 
+enum
+{
+    PEEPHOLE_LINE_TYPE_INSTRUCTION,
+    PEEPHOLE_LINE_TYPE_LABEL,
+    // Assembler directives such as global and extern, never removed
+    PEEPHOLE_LINE_TYPE_DIRECTIVE,
+    PEEPHOLE_LINE_TYPE_COMMENT
+};
+
+// The rules of the peephole optimiser, in the order they are tried
+enum
+{
+    PEEPHOLE_RULE_PUSH_POP,
+    PEEPHOLE_RULE_REDUNDANT_MOVE,
+    PEEPHOLE_RULE_SELF_MOVE,
+    PEEPHOLE_RULE_COMPARE_AFTER_SET,
+    PEEPHOLE_RULE_JUMP_TO_NEXT,
+    PEEPHOLE_RULE_UNREACHABLE,
+    PEEPHOLE_TOTAL_RULES
+};
+
+#define PEEPHOLE_MAX_OPERANDS 3
+
+/**
+ * A line of generated assembly split into its parts, i.e "mov eax, dword [ebp-4]"
+ * is the mnemonic "mov" with the operands "eax" and "dword [ebp-4]"
+ */
+struct peephole_instruction
+{
+    int type;
+    // Removed instructions are skipped when the function is written out
+    bool removed;
+    // The line as it is written out, without the new line
+    char *line;
+    // Copy of the line that the mnemonic and operands point into
+    char *parts;
+    const char *mnemonic;
+    const char *operands[PEEPHOLE_MAX_OPERANDS];
+    int total_operands;
+};
+
+struct peephole
+{
+    // Vector of struct peephole_instruction for the function being generated,
+    // NULL when no function is being captured
+    struct vector *instructions;
+
+    // The line being written, it becomes an instruction once its new line is written
+    char line[CODEGEN_LINE_MAX];
+    size_t line_len;
+
+    // Instructions captured over the whole file and how many each rule removed
+    size_t total_instructions;
+    size_t removed[PEEPHOLE_TOTAL_RULES];
+};
+
 struct code_generator
 {
     struct states
@@ -418,14 +588,62 @@ struct code_generator
     
     // Vector of struct response*
     struct vector *responses;
+
+    // Pushed values are kept in the temporary registers rather than on the machine stack for as long
+    // as nothing can observe the difference. Before any jump, label, call or stack pointer access
+    // they are pushed for real so the machine stack looks exactly like the stack frame.
+    struct code_generator_temporaries
+    {
+        // Operand of the last push that has not been emitted, empty if there is none
+        char pending[CODEGEN_LINE_MAX];
+
+        // Bit set for every temporary register that holds a stack frame element
+        int used;
+    } temporaries;
+
+    // Assembly waiting to be written to the output file, it is written in one go
+    // when the chunk is full, after every function and when code generation finishes.
+    struct code_generator_output
+    {
+        char data[CODEGEN_OUTPUT_CHUNK_SIZE];
+        size_t len;
+    } output;
+
+    // Every function is captured here and optimised before it is written to the output
+    struct peephole peephole;
 };
 
 enum
 {
     COMPILE_PROCESS_EXPORT_AS_OBJECT = 0b00000001,
     // If this flag is set NASM will be used after compliation, to assemble
-    // the file.
-    COMPILE_PROCESS_EXECUTE_NASM = 0b00000010
+    // the file. Otherwise the internal assembler is used.
+    COMPILE_PROCESS_EXECUTE_NASM = 0b00000010,
+    // Time every compiler phase and print a report when the file is compiled
+    COMPILE_PROCESS_TIME_REPORT = 0b00000100,
+    // Print the time report as JSON rather than a table
+    COMPILE_PROCESS_TIME_REPORT_JSON = 0b00001000,
+    // Dump the tree and echo the generated assembly to stdout
+    COMPILE_PROCESS_VERBOSE = 0b00010000,
+    // Write the generated assembly exactly as it was generated, without the peephole optimiser
+    COMPILE_PROCESS_NO_PEEPHOLE = 0b00100000,
+    // Generate every function straight from the tree, even the ones the IR can represent
+    COMPILE_PROCESS_NO_IR = 0b01000000,
+    // Write the IR of every function to stdout
+    COMPILE_PROCESS_EMIT_IR = 0b10000000,
+    // Keep constant expressions and constant branches in the tree as they were written
+    COMPILE_PROCESS_NO_FOLD = 0b100000000,
+    // Lex with the scalar scanners even when the CPU has SSE2 or AVX2
+    COMPILE_PROCESS_NO_SIMD = 0b1000000000,
+    // Expand every macro function call again rather than reuse the expansion of an identical call
+    COMPILE_PROCESS_NO_MACRO_CACHE = 0b10000000000,
+    // Lex every file in one go before it is preprocessed, the tokens of #if groups that are not compiled included
+    COMPILE_PROCESS_NO_SKIP_INACTIVE = 0b100000000000,
+    // Lex only the directive lines of every file, for scanning the headers a file includes
+    COMPILE_PROCESS_DIRECTIVES_ONLY = 0b1000000000000,
+    // Only preprocess and write the output as it is produced, files are lexed in pieces
+    // small enough that memory stays bounded however large they are
+    COMPILE_PROCESS_PREPROCESS_ONLY = 0b10000000000000
 };
 
 struct compile_process;
@@ -441,6 +659,23 @@ struct lex_process_functions
     LEX_PROCESS_PUSH_CHAR push_char;
 };
 
+/**
+ * Scanners the lexer uses to skip a run of characters in one call, see lex_scan.c.
+ * Each returns how many characters from ptr up to end belong to the run.
+ */
+struct lex_scanner
+{
+    const char *name;
+    // Spaces and tabs
+    size_t (*blanks)(const char *ptr, const char *end);
+    // Letters, digits and underscores
+    size_t (*identifier)(const char *ptr, const char *end);
+    // Any character other than c1 and c2
+    size_t (*until)(const char *ptr, const char *end, char c1, char c2);
+    // Not a run, the number of times c appears from ptr up to end
+    size_t (*count)(const char *ptr, const char *end, char c);
+};
+
 struct lex_process
 {
     // Current line position information.
@@ -455,10 +690,22 @@ struct lex_process
  * If current expression count is zero then we are not in an expression
  */
     int current_expression_count;
-    struct buffer *parentheses_buffer;
+
+    // How deep in braces the lexer is, only counted while preprocessing alone so files
+    // are lexed in pieces that end outside of any declaration
+    int brace_depth;
 
     struct lex_process_functions *function;
 
+    // The in memory source being lexed. When "start" is set the lexer reads
+    // straight from the cursor and never calls through "function".
+    struct lex_source
+    {
+        char *start;
+        char *cursor;
+        char *end;
+    } source;
+
     // Private data that the creator of the lex process can use to store.
     // data they understand
     void *private;
@@ -477,6 +724,12 @@ struct compile_process
         FILE *fp;
         // The absolute path of the compiler process input file
         const char *abs_path;
+
+        // The whole file contents, memory mapped when possible otherwise read in one go.
+        // Mapped privately and writable so the lexer can push characters back in place.
+        char *data;
+        size_t size;
+        bool mapped;
     } cfile;
 
     // The output file to compile to. NULL if this is a sub-file included with "include"
@@ -491,6 +744,14 @@ struct compile_process
     // after it is done.
     struct vector *token_vec_original;
 
+    // Set while the file is lexed on demand, the lexer is asked for more of "token_vec_original"
+    // as the preprocessor runs out of tokens. NULL once the whole file has been lexed.
+    struct lex_process *lex_process;
+
+    // Set once tokens of "token_vec_original" have been dropped after they were preprocessed,
+    // the file can then no longer be checked for an include guard
+    bool token_vec_original_trimmed;
+
     // Stack of tokens that have undergone lexcial analysis.
     // Vector of struct <struct token> individual tokens (not pointers)
     // This is the final output preprocessed tokens.
@@ -533,6 +794,9 @@ struct compile_process
 
     // The code generator
     struct code_generator *generator;
+
+    // Phase timings, shared with included files. NULL unless COMPILE_PROCESS_TIME_REPORT is set.
+    struct compile_timing *timing;
 };
 
 struct datatype
@@ -650,6 +914,7 @@ struct resolver_entity
     // If this is a variable this would be the variable name,
     // if this is a function it would be the function name
     // if this is a structure it would be the structure name.
+    // Named entities always hold an atom so lookups compare pointers.
     const char *name;
 
     // The offset from the first entity if applicable.
@@ -890,6 +1155,63 @@ enum
     TOKEN_TYPE_NEWLINE
 };
 
+/**
+ * Every word the compiler gives meaning to. The lexer recognises them once and stores
+ * the result on the token, later phases switch on it rather than comparing strings.
+ * KEYWORD_NONE is zero so zero initialized tokens are never keywords.
+ */
+enum
+{
+    KEYWORD_NONE,
+
+    // C keywords, these are lexed as TOKEN_TYPE_KEYWORD
+    KEYWORD_UNSIGNED,
+    KEYWORD_SIGNED,
+    KEYWORD_CHAR,
+    KEYWORD_SHORT,
+    KEYWORD_INT,
+    KEYWORD_FLOAT,
+    KEYWORD_DOUBLE,
+    KEYWORD_LONG,
+    KEYWORD_VOID,
+    KEYWORD_STRUCT,
+    KEYWORD_UNION,
+    KEYWORD_STATIC,
+    KEYWORD_IGNORE_TYPECHECK,
+    KEYWORD_RETURN,
+    KEYWORD_INCLUDE,
+    KEYWORD_SIZEOF,
+    KEYWORD_IF,
+    KEYWORD_ELSE,
+    KEYWORD_WHILE,
+    KEYWORD_FOR,
+    KEYWORD_DO,
+    KEYWORD_BREAK,
+    KEYWORD_CONTINUE,
+    KEYWORD_SWITCH,
+    KEYWORD_CASE,
+    KEYWORD_DEFAULT,
+    KEYWORD_GOTO,
+    KEYWORD_TYPEDEF,
+    KEYWORD_CONST,
+    KEYWORD_EXTERN,
+    KEYWORD_RESTRICT,
+
+    // Preprocessor directive names and the "defined" operator,
+    // these are lexed as TOKEN_TYPE_IDENTIFIER
+    KEYWORD_DEFINE,
+    KEYWORD_UNDEF,
+    KEYWORD_WARNING,
+    KEYWORD_ERROR,
+    KEYWORD_ELIF,
+    KEYWORD_IFDEF,
+    KEYWORD_IFNDEF,
+    KEYWORD_ENDIF,
+    KEYWORD_PRAGMA,
+    KEYWORD_LINE,
+    KEYWORD_DEFINED
+};
+
 enum
 {
     NUMBER_TYPE_NORMAL,
@@ -900,14 +1222,36 @@ enum
 
 enum
 {
-    TOKEN_FLAG_IS_CUSTOM_OPERATOR = 0b00000001
+    TOKEN_FLAG_IS_CUSTOM_OPERATOR = 0b00000001,
+    // Produced by expanding a definition written in the source, the token keeps the
+    // position it has in the definition rather than the one of the source it replaced
+    TOKEN_FLAG_FROM_EXPANSION = 0b00000010
 };
 
+/**
+ * Tokens are kept small as every token of every included file is copied into the
+ * token vectors. The first 32 bits hold the type, flags, keyword and whitespace.
+ */
 struct token
 {
-    int type;
-    int flags;
+    uint8_t type;
+    uint8_t flags;
+    // One of KEYWORD_*, set for keywords and for identifiers that name a preprocessor directive
+    uint8_t keyword;
+
+    // True if their is a whitespace between the token and the next token
+    // i.e * a for token * whitespace would be true as the token "a" has a space
+    // between this token
+    bool whitespace;
+
     struct pos pos;
+
+    // Information for the given number token, if this token is of type TOKEN_TYPE_NUMBER
+    struct token_number
+    {
+        uint8_t type;
+    } num;
+
     union
     {
         char cval;
@@ -919,23 +1263,6 @@ struct token
         double dnum;
         void *any;
     };
-
-    // Information for the given number token, if this token is of type TOKEN_TYPE_NUMBER
-    struct token_number
-    {
-        int type;
-    } num;
-
-    // True if their is a whitespace between the token and the next token
-    // i.e * a for token * whitespace would be true as the token "a" has a space
-    // between this token
-    bool whitespace;
-
-    // If this token is between the brackets ( ) then it will have
-    // a pointer for the data between the brackets.
-    // I.e if we have abc(50+20+40) then for numerical token 20 between_brackets
-    // will point to the string 50+20+40
-    const char *between_brackets;
 };
 
 struct sizeable_node
@@ -953,6 +1280,7 @@ enum
 
 struct symbol
 {
+    // Always an atom, see symresolver_register_symbol
     const char *name;
     int type;
     void *data;
@@ -1209,7 +1537,12 @@ enum
     STACK_FRAME_ELEMENT_FLAG_IS_PUSHED_ADDRESS = 0b00000001,
     STACK_FRAME_ELEMENT_FLAG_ELEMENT_NOT_FOUND = 0b00000010,
     STACK_FRAME_ELEMENT_FLAG_IS_NUMERICAL = 0b00000100,
-    STACK_FRAME_ELEMENT_FLAG_HAS_DATATYPE = 0b00001000
+    STACK_FRAME_ELEMENT_FLAG_HAS_DATATYPE = 0b00001000,
+    // The element is not on the machine stack, it lives in a temporary register.
+    STACK_FRAME_ELEMENT_FLAG_IN_REGISTER = 0b00010000,
+    // The element is not on the machine stack yet, its operand is kept by the code generator
+    // until we know where it is needed.
+    STACK_FRAME_ELEMENT_FLAG_PENDING = 0b00100000
 
 };
 
@@ -1240,6 +1573,9 @@ struct stack_frame_element
     // The offset from the stack pointer this element can be located.
     int offset_from_bp;
 
+    // The temporary register holding this element if STACK_FRAME_ELEMENT_FLAG_IN_REGISTER is set
+    const char *reg;
+
     struct stack_frame_data data;
 };
 
@@ -1578,6 +1914,11 @@ void compiler_error(struct compile_process *compiler, const char *msg, ...);
  */
 void compiler_node_error(struct node *node, const char *msg, ...);
 
+/**
+ * Called to issue a compiler error at the given position and terminate the compiler
+ */
+void compiler_pos_error(struct pos *pos, const char *msg, ...);
+
 /**
  * Called to issue a compiler warning but continue execution
  */
@@ -1594,6 +1935,24 @@ const char *compiler_include_dir_next(struct compile_process *process);
  */
 int compile_file(const char *filename, const char *out_filename, int flags);
 
+/**
+ * Lexes and preprocesses the header, then writes the state of the preprocessor and
+ * the tokens the header produced to pch_filename, see preprocessor/pch.c
+ */
+int compile_pch(const char *filename, const char *pch_filename, int flags);
+
+/**
+ * Lexes and preprocesses the file without compiling it and writes a make rule for target
+ * with the headers it includes to out, see depend.c
+ */
+int compile_dependencies(const char *filename, const char *target, FILE *out, int flags);
+
+/**
+ * Lexes and preprocesses the file without compiling it and writes the preprocessed source
+ * to out as it is produced, with #line markers for where it came from, see preprocessor/output.c
+ */
+int compile_preprocess(const char *filename, FILE *out, int flags);
+
 /**
  * Includes a file to be compiled, returns a new compile process that represents the file
  * to be compiled.
@@ -1603,17 +1962,61 @@ int compile_file(const char *filename, const char *out_filename, int flags);
  */
 struct compile_process *compile_include(const char *filename, struct compile_process *parent_process);
 
+/**
+ * Finds the given include filename in the include directories, the absolute path
+ * is written to path_out. Returns false if the file could not be found.
+ */
+bool compile_include_resolve(const char *filename, struct compile_process *parent_process, char *path_out);
+
+/**
+ * Same as compile_include() but for a path that was already resolved with compile_include_resolve()
+ */
+struct compile_process *compile_include_path(const char *path, struct compile_process *parent_process);
+
 /**
  * Lexical analysis
  */
 int lex(struct lex_process *process);
+
+/**
+ * Prepares the process to be lexed a piece at a time with lex_next_conditional(), lex() does this itself
+ */
+void lex_begin(struct lex_process *process);
+
+/**
+ * Lexes up to and including the next #if, #ifdef, #ifndef, #elif, #else or #endif line, so the
+ * preprocessor can decide whether the lines after it are lexed at all. With
+ * COMPILE_PROCESS_PREPROCESS_ONLY a long run of lines without one is lexed in several pieces.
+ * Returns false once the end of the source has been lexed.
+ */
+bool lex_next_conditional(struct lex_process *process);
+
+/**
+ * Moves the cursor over the lines of an #if group that is not compiled, up to the #elif, #else or
+ * #endif line that ends the group, or only up to the #endif that ends the whole #if when "to_endif"
+ * is true. Nothing is lexed, only the nesting of directives, comments and continued lines are
+ * tracked. Returns the number of characters skipped, zero for processes that do not read from memory.
+ */
+size_t lex_skip_inactive(struct lex_process *process, bool to_endif);
 /**
  * Builds tokens for the given input string, returns a lexical analysis process.
  */
 struct lex_process *tokens_build_for_string(struct compile_process *compiler, const char *str);
 struct lex_process *lex_process_create(struct compile_process *compiler, struct lex_process_functions *functions, void *private);
+
+/**
+ * Creates a lexical analysis process that reads the given memory through a pointer cursor.
+ * The memory must stay alive and writable for the duration of lexing, pushed back characters
+ * are written back into it.
+ */
+struct lex_process *lex_process_create_for_source(struct compile_process *compiler, char *data, size_t size);
 void lex_process_free(struct lex_process *process);
 
+/**
+ * Returns the fastest scanners this CPU supports, the scalar ones if allow_simd is false
+ */
+const struct lex_scanner *lex_scanner_get(bool allow_simd);
+
 /**
  * Returns the private data of this lexical process
  */
@@ -1635,11 +2038,33 @@ int parse(struct compile_process *process);
  */
 int validate(struct compile_process* process);
 
+/**
+ * Folds constant expressions, simplifies identities such as "x * 1" and removes the branches
+ * of if and while statements whose condition is constant. Runs once the tree is validated.
+ */
+void fold(struct compile_process *process);
+
 /**
  * Generates the assembly output for the given AST
  */
 int codegen(struct compile_process *process);
 
+/**
+ * Returns the KEYWORD_* for the "length" characters at str, KEYWORD_NONE if the
+ * word is not one the compiler knows. str does not need to be null terminated.
+ */
+int keyword_lookup(const char *str, size_t length);
+
+/**
+ * Returns true if the given KEYWORD_* is a C keyword rather than a preprocessor word
+ */
+bool keyword_is_c_keyword(int keyword);
+
+/**
+ * Returns true if the given KEYWORD_* names a data type such as int or struct
+ */
+bool keyword_id_is_datatype(int keyword);
+
 bool keyword_is_datatype(const char *str);
 
 /**
@@ -1662,22 +2087,109 @@ void compile_process_destroy(struct compile_process *process);
 FILE *compile_process_file(struct compile_process *process);
 
 /**
- * Gets the next character from the current file
+ * Returns the id of the given file in the compiler file table, adding it if needed.
+ * Positions store this id rather than a pointer to the file name.
  */
-char compile_process_next_char(struct lex_process *lex_process);
+uint16_t compiler_file_id(const char *filename);
 
 /**
- * Peeks in the stream for the next char from the current file.
- * Does not impact the file pointer.
+ * Returns the file name for an id returned by compiler_file_id
  */
-char compile_process_peek_char(struct lex_process *lex_process);
+const char *compiler_file_name(uint16_t id);
 
 /**
- * Unsets the given character pushing it back into the end of the input stream.
- * The next time compile_process_next_char or compile_process_peek_char is called
- * the given character provided here will be given
+ * Sets the directory the tokens of included files are cached in, see token_cache.c.
+ * The cache is disabled until a directory is set.
  */
-void compile_process_push_char(struct lex_process *lex_process, char c);
+void token_cache_set_directory(const char *directory);
+const char *token_cache_get_directory();
+
+/**
+ * Returns the tokens cached for the file the process has loaded, NULL if the cache is
+ * disabled or has no tokens for the file as it is now
+ */
+struct vector *token_cache_load(struct compile_process *process);
+
+/**
+ * Writes the tokens lexed from the file the process has loaded to the cache
+ */
+void token_cache_store(struct compile_process *process, struct vector *token_vec);
+
+enum
+{
+    INCLUDE_CACHE_UNKNOWN,
+    INCLUDE_CACHE_FOUND,
+    INCLUDE_CACHE_NOT_FOUND
+};
+
+struct include_cache_stats
+{
+    size_t hits;
+    size_t misses;
+    // Filesystem calls the hits would have made had the names been resolved again
+    size_t calls_saved;
+    // Directories looked at to tell if a saved entry is still good
+    size_t directory_checks;
+};
+
+/**
+ * Keeps the include cache in the given file between runs, see include_cache.c.
+ * Without a file the cache only lasts for the run.
+ */
+void include_cache_set_file(const char *filename);
+
+/**
+ * Looks up how the include name resolved last time with the include directories of
+ * the process. Returns INCLUDE_CACHE_FOUND and writes the path to path_out,
+ * INCLUDE_CACHE_NOT_FOUND if the name could not be resolved, or INCLUDE_CACHE_UNKNOWN.
+ */
+int include_cache_lookup(struct compile_process *process, const char *filename, char *path_out);
+
+/**
+ * Records how the include name resolved, path is NULL if it could not be found.
+ * Calls is the number of filesystem calls resolving it took.
+ */
+void include_cache_insert(struct compile_process *process, const char *filename, const char *path, int calls);
+
+/**
+ * Writes the include cache to its file if anything new was resolved
+ */
+void include_cache_store();
+
+struct include_cache_stats *include_cache_stats();
+
+/**
+ * Makes compile_file() write a make rule for target to filename once the file has been
+ * preprocessed, see depend.c. A NULL filename stops it.
+ */
+void depend_set_output(const char *filename, const char *target);
+
+/**
+ * Writes the make rule for target with the file the process compiles and every header it included
+ */
+void depend_write_rule(struct compile_process *process, const char *target, FILE *out);
+
+/**
+ * Writes the make rule to the file given to depend_set_output(), if any. Returns zero on success.
+ */
+int depend_write(struct compile_process *process);
+
+/**
+ * Gets the next character from the lex process source cursor, EOF at the end
+ */
+char lex_process_source_next_char(struct lex_process *lex_process);
+
+/**
+ * Peeks at the next character from the lex process source cursor.
+ * Does not move the cursor.
+ */
+char lex_process_source_peek_char(struct lex_process *lex_process);
+
+/**
+ * Pushes the given character back into the source, the next call to
+ * lex_process_source_next_char or lex_process_source_peek_char returns it.
+ */
+void lex_process_source_push_char(struct lex_process *lex_process, char c);
 
 struct scope *scope_alloc();
 struct scope *scope_create_root(struct compile_process *process);
@@ -2220,8 +2732,15 @@ const char *node_var_name(struct node *var_node);
  * if this is a function node that returns a pointer. Otherwise false
  */
 bool is_pointer_node(struct node *node);
+
+/**
+ * Returns the total number of nodes created so far
+ */
+size_t node_total_created();
 // Token
 struct vector *tokens_join_vector(struct compile_process *compiler, struct vector *token_vec);
+struct vector *tokens_join(struct compile_process *compiler, struct token *tokens, int total);
+uint64_t tokens_hash(struct token *tokens, int total, uint64_t seed);
 
 bool token_is_operator(struct token *token, const char *op);
 bool token_is_keyword(struct token *token, const char *keyword);
@@ -2229,6 +2748,12 @@ bool token_is_symbol(struct token *token, char sym);
 bool token_is_identifier(struct token *token, const char *iden);
 bool token_is_primitive_keyword(struct token *token);
 
+/**
+ * Returns a new string holding the source between the brackets the token sits in,
+ * NULL if the token is not between brackets. The token must have been lexed from
+ * the input file of the given process.
+ */
+
 struct token *token_peek_no_nl(struct vector *token_vec);
 
 // Preprocessor
@@ -2261,6 +2786,86 @@ struct preprocessor_definition *preprocessor_definition_create(const char *name,
  */
 struct preprocessor *preprocessor_create(struct compile_process *compiler);
 
+struct preprocessor_definition *preprocessor_definition_create_typedef(const char *name, struct vector *value_vec, struct preprocessor *preprocessor);
+
+/**
+ * Returns the definition with the given name, NULL if the name is not defined
+ */
+struct preprocessor_definition *preprocessor_get_definition(struct preprocessor *preprocessor, const char *name);
+
+/**
+ * Expands every definition in the tokens into the output vector, as if they were written in the source
+ */
+void preprocessor_expand_tokens(struct compile_process *compiler, struct token *tokens, int total, struct vector *dst_vec);
+
+/**
+ * Evaluates the condition of the #if or #elif whose tokens come next, they are read up to the end of the line.
+ * Returns true if the condition holds, see preprocessor/condition.c
+ */
+bool preprocessor_condition_evaluate(struct compile_process *compiler, struct token *directive);
+
+/**
+ * Records that the condition being evaluated looked up the name and found the definition, or NULL
+ */
+void preprocessor_condition_depends_on(struct preprocessor *preprocessor, const char *name, struct preprocessor_definition *definition);
+
+/**
+ * Records the file as included, returns the existing record if it was included before
+ */
+struct preprocessor_included_file *preprocessor_add_included_file(struct preprocessor *preprocessor, const char *filename);
+
+/**
+ * Sets the precompiled header every compiled file starts from, see preprocessor/pch.c
+ */
+void pch_set_include(const char *filename);
+
+/**
+ * Writes the preprocessor state of the process and its preprocessed tokens to the file.
+ * Returns zero on success.
+ */
+int pch_write(struct compile_process *process, const char *filename);
+
+/**
+ * Restores the precompiled header set by pch_set_include() into the process, it must be
+ * called before the file is preprocessed. Does nothing if no header was set.
+ */
+int pch_restore(struct compile_process *process);
+
+/**
+ * Returns true for tokens only the preprocessor cares about, new lines, comments
+ * and the line continuation symbol.
+ */
+bool preprocessor_token_is_trivia(struct token *token);
+
+/**
+ * Makes the preprocessor write its output to out as text rather than keep it, see preprocessor/output.c
+ */
+void preprocessor_output_begin(struct preprocessor *preprocessor, FILE *out);
+
+/**
+ * Writes the tokens the process has produced since the last call and empties its token vector.
+ * "pos" is where the source token they were produced from was written.
+ */
+void preprocessor_output_write(struct compile_process *compiler, struct pos pos);
+
+/**
+ * Same as preprocessor_output_write() for tokens that were not produced from the source
+ * just read, such as those of a precompiled header. Each token is written where it was
+ * in its own file.
+ */
+void preprocessor_output_write_restored(struct compile_process *compiler);
+
+/**
+ * Called when preprocessing enters or leaves a file, the next token is written after a #line
+ * marker even if the file is the one written last.
+ */
+void preprocessor_output_file_changed(struct preprocessor *preprocessor);
+
+/**
+ * Ends the last line of the output and flushes it. Returns zero on success.
+ */
+int preprocessor_output_end(struct preprocessor *preprocessor);
+
 /**
  * Returns the static include handler for the given filename, if none exists then NULL Is returned.
  * Some header files are compiled into the binary its self, this function resolves them
@@ -2461,7 +3066,8 @@ struct code_generator *codegenerator_new(struct compile_process *process);
 bool is_compile_computable(struct node *node);
 
 /**
- * Computes the provided expression into a long
+ * Computes the provided expression into a long, success is false if the operator is not supported
+ * or the result is undefined such as a division by zero
  */
 long arithmetic(struct compile_process *compiler, long left_operand, long right_operand, const char *op, bool *success);
 
@@ -2589,4 +3195,356 @@ bool fixups_resolve(struct fixup_system *system);
 void register_set_flag(int flag);
 void register_unset_flag(int flag);
 
+// Assembler, assembles the NASM output of the code generator directly into
+// an ELF32 relocatable object file.
+enum
+{
+    ASSEMBLER_SECTION_TEXT,
+    ASSEMBLER_SECTION_DATA,
+    ASSEMBLER_SECTION_RODATA,
+    ASSEMBLER_TOTAL_SECTIONS
+};
+
+enum
+{
+    ASSEMBLER_SYMBOL_FLAG_DEFINED = 0b00000001,
+    ASSEMBLER_SYMBOL_FLAG_GLOBAL = 0b00000010,
+    ASSEMBLER_SYMBOL_FLAG_EXTERN = 0b00000100,
+    // Set when an instruction or data directive refers to this symbol
+    ASSEMBLER_SYMBOL_FLAG_REFERENCED = 0b00001000
+};
+
+struct assembler_symbol
+{
+    int flags;
+    // Local labels such as ".while_start_3" are prefixed with the label
+    // they belong to i.e "main.while_start_3", the same as NASM does.
+    const char *name;
+
+    // The section this symbol is defined in, only valid when defined.
+    int section;
+    // Offset from the start of the section
+    uint32_t offset;
+
+    // Index in the ELF symbol table, assigned when the object file is written
+    int index;
+};
+
+enum
+{
+    ASSEMBLER_RELOCATION_ABSOLUTE,
+    ASSEMBLER_RELOCATION_PC_RELATIVE
+};
+
+struct assembler_relocation
+{
+    int type;
+    // Offset into the section of the four bytes the linker must patch
+    uint32_t offset;
+    // The symbol this relocation is against, symbols that are not global or external
+    // are relocated against their section and their offset is written as the addend.
+    struct assembler_symbol *symbol;
+};
+
+struct assembler_section
+{
+    const char *name;
+    // The assembled bytes
+    struct buffer *data;
+    // Vector of struct assembler_relocation
+    struct vector *relocations;
+};
+
+struct assembler
+{
+    struct assembler_section sections[ASSEMBLER_TOTAL_SECTIONS];
+
+    // Vector of struct assembler_symbol* in the order they were first seen.
+    struct vector *symbols;
+    // struct assembler_symbol* indexed by name
+    struct hashmap *symbol_table;
+
+    // Vector of parsed statements, private to the assembler.
+    struct vector *statements;
+
+    // The file name that is written into the symbol table
+    const char *filename;
+    int line;
+    int current_section;
+    // The last label that did not start with a "." so we can resolve local labels
+    const char *last_label;
+};
+
+/**
+ * Assembles the given NASM source file produced by the code generator and writes
+ * an ELF32 relocatable object file to obj_filename.
+ *
+ * Returns zero on success
+ */
+int assembler_assemble_file(const char *asm_filename, const char *obj_filename);
+
+/**
+ * Assembles the given null terminated NASM source and writes an ELF32 relocatable
+ * object file to obj_filename.
+ */
+int assembler_assemble(const char *source, const char *filename, const char *obj_filename);
+
+/**
+ * Writes the assembled sections and symbols as an ELF32 relocatable object file.
+ * Implemented in assembler/elf.c
+ */
+int assembler_elf_write(struct assembler *assembler, const char *obj_filename);
+
+// Intermediate representation, ir.c lowers a function to it and ir_x86.c selects x86 from it.
+//
+// The IR is three address code in basic blocks. Every value lives in a virtual register. Locals
+// and arguments have a virtual register of their own as their address is never taken, globals
+// live in memory and are only reached through loads and stores.
+enum
+{
+    IR_OPERAND_NONE,
+    IR_OPERAND_VREG,
+    IR_OPERAND_CONSTANT
+};
+
+/**
+ * Values are 32 bits wide once loaded, the type says how they are extended from memory
+ * and which division, shift and comparison to use on them
+ */
+struct ir_type
+{
+    int size;
+    bool is_signed;
+};
+
+struct ir_operand
+{
+    int kind;
+    struct ir_type type;
+    union
+    {
+        int vreg;
+        long long constant;
+    };
+};
+
+enum
+{
+    // dst = a
+    IR_OP_MOVE,
+    // dst = load variable
+    IR_OP_LOAD,
+    // store variable, a
+    IR_OP_STORE,
+    // dst = a op b
+    IR_OP_ADD,
+    IR_OP_SUB,
+    IR_OP_MUL,
+    IR_OP_DIV,
+    IR_OP_MOD,
+    IR_OP_AND,
+    IR_OP_OR,
+    IR_OP_XOR,
+    IR_OP_SHL,
+    IR_OP_SHR,
+    // dst = 1 if a op b otherwise 0
+    IR_OP_EQ,
+    IR_OP_NE,
+    IR_OP_LT,
+    IR_OP_LE,
+    IR_OP_GT,
+    IR_OP_GE,
+    // dst = op a
+    IR_OP_NEG,
+    IR_OP_NOT,
+    // dst = a cut down to the size of the type and extended back to 32 bits
+    IR_OP_TRUNCATE,
+    // dst = call function(arguments)
+    IR_OP_CALL,
+    // Terminators, every block ends with exactly one of these
+    IR_OP_JUMP,
+    IR_OP_BRANCH,
+    IR_OP_RETURN
+};
+
+enum
+{
+    IR_VARIABLE_LOCAL,
+    IR_VARIABLE_ARGUMENT,
+    IR_VARIABLE_GLOBAL
+};
+
+struct ir_variable
+{
+    int kind;
+    const char *name;
+    struct ir_type type;
+    // Offset from the base pointer for locals and arguments
+    int offset;
+    // The virtual register holding a local or argument, -1 for globals
+    int vreg;
+};
+
+struct ir_block;
+struct ir_instruction
+{
+    int op;
+    // Type of the result, or of the memory for loads and stores
+    struct ir_type type;
+    // Virtual register written by the instruction, -1 if it writes none
+    int dst;
+    struct ir_operand operands[2];
+
+    // Loads and stores
+    struct ir_variable *variable;
+
+    // Calls, vector of struct ir_operand in the order they are written
+    const char *function;
+    struct vector *arguments;
+
+    // Jumps have one target, branches go to the first when the operand is not zero
+    struct ir_block *targets[2];
+};
+
+struct ir_block
+{
+    int id;
+    // Vector of struct ir_instruction
+    struct vector *instructions;
+};
+
+struct ir_function
+{
+    struct node *node;
+    const char *name;
+    // Vector of struct ir_block*, the first block is the entry
+    struct vector *blocks;
+    // Vector of struct ir_variable* for the arguments, locals and the globals used
+    struct vector *variables;
+    int total_vregs;
+};
+
+/**
+ * Lowers the function to the IR. Returns NULL if the function uses something the IR cannot
+ * represent yet, the reason is written to reason_out.
+ */
+struct ir_function *ir_lower_function(struct compile_process *process, struct node *func_node, const char **reason_out);
+void ir_function_free(struct ir_function *function);
+
+/**
+ * Writes the function as text, i.e "%2 = add.i32 %0, %1"
+ */
+void ir_function_dump(struct ir_function *function, FILE *out);
+
+/**
+ * Selects x86 instructions for the function and writes them with the generator,
+ * the function label and its frame are included
+ */
+void ir_x86_generate_function(struct generator *generator, struct ir_function *function);
+
+// Peephole optimiser, peephole.c
+typedef void (*PEEPHOLE_WRITE_LINE)(const char *line);
+
+/**
+ * Starts capturing the lines of a function
+ */
+void peephole_begin(struct peephole *peephole);
+
+/**
+ * Adds generated text to the function being captured, it can contain any number of lines.
+ * Returns false if a line is longer than CODEGEN_LINE_MAX
+ */
+bool peephole_write(struct peephole *peephole, const char *text);
+
+/**
+ * Applies the rules to the captured function until none of them match, then writes
+ * the remaining lines out and stops capturing
+ */
+void peephole_end(struct peephole *peephole, PEEPHOLE_WRITE_LINE write_line);
+
+/**
+ * Returns the name of the rule as shown in the time report
+ */
+const char *peephole_rule_name(int rule);
+
+// Timing, timing.c
+enum
+{
+    COMPILE_PHASE_LEX,
+    COMPILE_PHASE_PREPROCESS,
+    COMPILE_PHASE_PARSE,
+    COMPILE_PHASE_VALIDATE,
+    COMPILE_PHASE_FOLD,
+    COMPILE_PHASE_CODEGEN,
+    COMPILE_TOTAL_PHASES
+};
+
+#define COMPILE_TIMING_MAX_DEPTH 256
+
+struct compile_phase_timing
+{
+    // Wall time spent in this phase alone, time spent in nested phases is not counted.
+    double seconds;
+    // The number of tokens or nodes the phase processed
+    size_t items;
+};
+
+struct compile_include_timing
+{
+    const char *filename;
+    // Wall time to lex and preprocess the include, nested includes are counted
+    double seconds;
+    // Tokens produced by the include once preprocessed
+    size_t tokens;
+    int depth;
+    // True if the tokens came from the token cache rather than the lexer
+    bool cached;
+};
+
+struct compile_timing
+{
+    struct compile_phase_timing phases[COMPILE_TOTAL_PHASES];
+
+    // Vector of struct compile_include_timing
+    struct vector *includes;
+
+    // Stack of the phases that are running, phases nest when a file is included.
+    struct compile_timing_frame
+    {
+        int phase;
+        double start;
+        // Time spent in phases started while this one was running
+        double nested;
+    } stack[COMPILE_TIMING_MAX_DEPTH];
+    int depth;
+};
+
+/**
+ * Returns the current time of the monotonic clock in seconds
+ */
+double compile_timing_now();
+
+struct compile_timing *compile_timing_create();
+void compile_timing_free(struct compile_timing *timing);
+
+/**
+ * Starts timing the given phase, does nothing if timing is disabled for the process
+ */
+void compile_timing_begin(struct compile_process *process, int phase);
+
+/**
+ * Stops timing the phase that was last started and adds the items it processed
+ */
+void compile_timing_end(struct compile_process *process, size_t items);
+
+/**
+ * Records how long an include took, start is the time returned by compile_timing_now
+ */
+void compile_timing_include(struct compile_process *process, const char *filename, double start, size_t tokens, bool cached);
+
+/**
+ * Prints the timing report as a table, or as JSON if COMPILE_PROCESS_TIME_REPORT_JSON is set
+ */
+void compile_timing_report(struct compile_process *process, FILE *out);
+
 #endif
\ No newline at end of file
@@ -2,11 +2,68 @@
 #include "helpers/vector.h"
 
 #include <memory.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 const char* default_include_dirs[] = {"./dc_includes", "../dc_includes", "/usr/include/dragon-compiler", "/usr/include"};
 
+/**
+ * Loads the whole input file into memory so the lexer can walk it with a pointer.
+ * The file is mapped privately when possible, otherwise it is read in a single pass.
+ */
+static bool compile_process_load_source(struct compile_process *process)
+{
+    struct stat st;
+    int fd = fileno(process->cfile.fp);
+    if (fstat(fd, &st) != 0)
+    {
+        return false;
+    }
+
+    size_t size = st.st_size;
+    if (size > 0 && S_ISREG(st.st_mode))
+    {
+        void *data = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED)
+        {
+            process->cfile.data = data;
+            process->cfile.size = size;
+            process->cfile.mapped = true;
+            return true;
+        }
+    }
+
+    // Not mappable, i.e an empty file or a pipe. Read it all instead.
+    size_t capacity = size > 0 ? size : 4096;
+    char *data = malloc(capacity);
+    size_t total = 0;
+    size_t count = 0;
+    while ((count = fread(data + total, 1, capacity - total, process->cfile.fp)) > 0)
+    {
+        total += count;
+        if (total == capacity)
+        {
+            capacity *= 2;
+            data = realloc(data, capacity);
+        }
+    }
+
+    process->cfile.data = data;
+    process->cfile.size = total;
+    process->cfile.mapped = false;
+    return true;
+}
+
 void compile_process_destroy(struct compile_process *process)
 {
+    if (process->cfile.mapped)
+    {
+        munmap(process->cfile.data, process->cfile.size);
+    }
+    else
+    {
+        free(process->cfile.data);
+    }
     fclose(process->cfile.fp);
     if (process->ofile)
     {
@@ -60,9 +117,18 @@ struct compile_process *compile_process_create(const char *filename, const char
     process->pos.line = 1;
 
     process->cfile.fp = file;
+    if (!compile_process_load_source(process))
+    {
+        fclose(file);
+        if (out_file)
+        {
+            fclose(out_file);
+        }
+        free(process);
+        return NULL;
+    }
     process->ofile = out_file;
     process->token_vec = vector_create(sizeof(struct token));
-    process->token_vec_original = vector_create(sizeof(struct token));
     process->node_vec = vector_create(sizeof(struct node *));
     process->node_tree_vec = vector_create(sizeof(struct node *));
     process->resolver = resolver_default_new_process(process);
@@ -83,6 +149,7 @@ struct compile_process *compile_process_create(const char *filename, const char
     {
         process->preprocessor = parent_process->preprocessor;
         process->include_dirs = parent_process->include_dirs;
+        process->timing = parent_process->timing;
     }
     else
     {
@@ -92,6 +159,11 @@ struct compile_process *compile_process_create(const char *filename, const char
         process->include_dirs = vector_create(sizeof(const char *));
         // Setup default include directories
         compiler_setup_default_include_directories(process->include_dirs);
+
+        if (flags & COMPILE_PROCESS_TIME_REPORT)
+        {
+            process->timing = compile_timing_create();
+        }
     }
 
     // Load the absolute file path into the file.
@@ -107,29 +179,39 @@ FILE *compile_process_file(struct compile_process *process)
     return process->cfile.fp;
 }
 
-char compile_process_next_char(struct lex_process *lex_process)
+// Every file name a position can refer to, indexed by file id.
+static struct vector *compiler_file_table = NULL;
+
+uint16_t compiler_file_id(const char *filename)
 {
-    struct compile_process *process = lex_process->compiler;
-    process->pos.col += 1;
-    char c = getc(process->cfile.fp);
-    if (c == '\n')
+    if (!compiler_file_table)
+    {
+        compiler_file_table = vector_create(sizeof(const char *));
+    }
+
+    // File names are atoms, so the same file always compares equal by pointer.
+    filename = atom(filename);
+    for (int i = 0; i < vector_count(compiler_file_table); i++)
     {
-        process->pos.line += 1;
-        process->pos.col = 0;
+        const char *name = *(const char **)vector_at(compiler_file_table, i);
+        if (name == filename)
+        {
+            return i;
+        }
     }
-    return c;
+
+    assert(vector_count(compiler_file_table) < UINT16_MAX);
+    vector_push(compiler_file_table, &filename);
+    return vector_count(compiler_file_table) - 1;
 }
 
-char compile_process_peek_char(struct lex_process *lex_process)
+const char *compiler_file_name(uint16_t id)
 {
-    struct compile_process *process = lex_process->compiler;
-    char c = getc(process->cfile.fp);
-    ungetc(c, process->cfile.fp);
-    return c;
+    if (!compiler_file_table || id >= vector_count(compiler_file_table))
+    {
+        return NULL;
+    }
+
+    return *(const char **)vector_at(compiler_file_table, id);
 }
 
-void compile_process_push_char(struct lex_process *lex_process, char c)
-{
-    struct compile_process *process = lex_process->compiler;
-    ungetc(c, process->cfile.fp);
-}
\ No newline at end of file
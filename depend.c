@@ -0,0 +1,84 @@
+#include "compiler.h"
+#include "helpers/vector.h"
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * Dependency rules for make. The rule of a file names the object built from it as its
+ * target, and depends on the file and every header it included in the order they were
+ * first included, all by their absolute path. Headers built into the compiler such as
+ * stddef.h are not files and are left out, as is a header included again.
+ *
+ * compile_dependencies() only lexes and preprocesses a file to write its rule, with
+ * COMPILE_PROCESS_DIRECTIVES_ONLY the lexer even skips every line that is not a
+ * directive. compile_file() writes the rule as it compiles when depend_set_output() was
+ * given a file.
+ */
+
+static const char *depend_filename = NULL;
+static const char *depend_target = NULL;
+
+void depend_set_output(const char *filename, const char *target)
+{
+    depend_filename = filename;
+    depend_target = target;
+}
+
+/**
+ * Writes the path escaped the way make reads it, spaces escaped and $ doubled
+ */
+static void depend_write_path(FILE *out, const char *path)
+{
+    for (const char *ptr = path; *ptr; ptr++)
+    {
+        if (*ptr == ' ' || *ptr == '#')
+        {
+            fputc('\\', out);
+        }
+        else if (*ptr == '$')
+        {
+            fputc('$', out);
+        }
+        fputc(*ptr, out);
+    }
+}
+
+void depend_write_rule(struct compile_process *process, const char *target, FILE *out)
+{
+    depend_write_path(out, target);
+    fputs(": ", out);
+    depend_write_path(out, process->cfile.abs_path);
+
+    struct vector *include_order = process->preprocessor->include_order;
+    for (int i = 0; i < vector_count(include_order); i++)
+    {
+        struct preprocessor_included_file *included_file = *(struct preprocessor_included_file **)vector_at(include_order, i);
+        // Built in headers are known by the name they were included with, files by their absolute path
+        if (included_file->filename[0] != '/' || S_EQ(included_file->filename, process->cfile.abs_path))
+        {
+            continue;
+        }
+
+        fputs(" \\\n  ", out);
+        depend_write_path(out, included_file->filename);
+    }
+    fputs("\n", out);
+}
+
+int depend_write(struct compile_process *process)
+{
+    if (!depend_filename)
+    {
+        return 0;
+    }
+
+    FILE *out = fopen(depend_filename, "w");
+    if (!out)
+    {
+        fprintf(stderr, "Unable to write the dependencies to %s\n", depend_filename);
+        return -1;
+    }
+
+    depend_write_rule(process, depend_target, out);
+    return fclose(out) == 0 ? 0 : -1;
+}
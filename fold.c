@@ -0,0 +1,532 @@
+#include "compiler.h"
+#include "helpers/vector.h"
+
+/**
+ * Folds constant expressions and simplifies the tree once it has been validated.
+ *
+ * Every fold function returns the node that should take the place of the node it was given,
+ * the caller stores it back where the node came from.
+ */
+
+static struct node *fold_exp(struct compile_process *process, struct node *node);
+static struct node *fold_statement(struct compile_process *process, struct node *node);
+
+static bool fold_is_literal(struct node *node)
+{
+    return node && node->type == NODE_TYPE_NUMBER;
+}
+
+/**
+ * Creates the node that replaces the given node, it is bound to the same body and function
+ */
+static struct node *fold_replacement(struct node *replacing, struct node *_node)
+{
+    node_create(_node);
+    struct node *node = node_pop();
+    node->binded = replacing->binded;
+    node->pos = replacing->pos;
+    return node;
+}
+
+static struct node *fold_number(struct node *replacing, long value)
+{
+    return fold_replacement(replacing, &(struct node){.type = NODE_TYPE_NUMBER, .llnum = value});
+}
+
+static struct node *fold_blank(struct node *replacing)
+{
+    return fold_replacement(replacing, &(struct node){.type = NODE_TYPE_BLANK});
+}
+
+static bool fold_is_assignment(struct node *node)
+{
+    return is_node_assignment(node) || S_EQ(node->exp.op, "%=") || S_EQ(node->exp.op, "&=") ||
+           S_EQ(node->exp.op, "|=") || S_EQ(node->exp.op, "^=");
+}
+
+/**
+ * Returns true if evaluating the node could do more than produce a value,
+ * such nodes cannot be dropped even when their value is not needed
+ */
+static bool fold_has_side_effects(struct node *node)
+{
+    if (!node_valid(node))
+    {
+        return false;
+    }
+
+    switch (node->type)
+    {
+    case NODE_TYPE_NUMBER:
+    case NODE_TYPE_IDENTIFIER:
+    case NODE_TYPE_STRING:
+        return false;
+
+    case NODE_TYPE_EXPRESSION:
+        if (fold_is_assignment(node) || S_EQ(node->exp.op, "()"))
+        {
+            return true;
+        }
+        return fold_has_side_effects(node->exp.left) || fold_has_side_effects(node->exp.right);
+
+    case NODE_TYPE_EXPRESSION_PARENTHESIS:
+        return fold_has_side_effects(node->parenthesis.exp);
+
+    case NODE_TYPE_UNARY:
+        if (S_EQ(node->unary.op, "++") || S_EQ(node->unary.op, "--"))
+        {
+            return true;
+        }
+        return fold_has_side_effects(node->unary.operand);
+
+    case NODE_TYPE_CAST:
+        return fold_has_side_effects(node->cast.operand);
+
+    case NODE_TYPE_TENARY:
+        return fold_has_side_effects(node->tenary.true_node) || fold_has_side_effects(node->tenary.false_node);
+
+    case NODE_TYPE_BRACKET:
+        return fold_has_side_effects(node->bracket.inner);
+    }
+
+    return true;
+}
+
+/**
+ * Returns the value cut down to the integer type, as a cast to it would at runtime
+ */
+static bool fold_cast_value(struct datatype *dtype, long value, long *value_out)
+{
+    if (dtype->flags & (DATATYPE_FLAG_IS_POINTER | DATATYPE_FLAG_IS_ARRAY))
+    {
+        return false;
+    }
+
+    bool is_signed = dtype->flags & DATATYPE_FLAG_IS_SIGNED;
+    switch (dtype->type)
+    {
+    case DATA_TYPE_CHAR:
+        *value_out = is_signed ? (long)(char)value : (long)(unsigned char)value;
+        return true;
+
+    case DATA_TYPE_SHORT:
+        *value_out = is_signed ? (long)(short)value : (long)(unsigned short)value;
+        return true;
+
+    case DATA_TYPE_INTEGER:
+    case DATA_TYPE_LONG:
+        *value_out = is_signed ? (long)(int)value : (long)(unsigned int)value;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * Simplifies "x op literal" and "literal op x" where the literal makes the operation an identity,
+ * i.e "x + 0", "x * 1" and "x * 0". Returns NULL if nothing could be simplified.
+ */
+static struct node *fold_identity(struct node *node)
+{
+    const char *op = node->exp.op;
+    struct node *left = node->exp.left;
+    struct node *right = node->exp.right;
+
+    if (fold_is_literal(right))
+    {
+        long value = right->llnum;
+        if (value == 0 && (S_EQ(op, "+") || S_EQ(op, "-") || S_EQ(op, "|") || S_EQ(op, "^") || S_EQ(op, "<<") || S_EQ(op, ">>")))
+        {
+            return left;
+        }
+
+        if (value == 1 && (S_EQ(op, "*") || S_EQ(op, "/")))
+        {
+            return left;
+        }
+
+        if (value == 0 && (S_EQ(op, "*") || S_EQ(op, "&")) && !fold_has_side_effects(left))
+        {
+            return fold_number(node, 0);
+        }
+    }
+
+    if (fold_is_literal(left))
+    {
+        long value = left->llnum;
+        if (value == 0 && (S_EQ(op, "+") || S_EQ(op, "|") || S_EQ(op, "^")))
+        {
+            return right;
+        }
+
+        if (value == 1 && S_EQ(op, "*"))
+        {
+            return right;
+        }
+
+        if (value == 0 && (S_EQ(op, "*") || S_EQ(op, "&") || S_EQ(op, "<<") || S_EQ(op, ">>")) && !fold_has_side_effects(right))
+        {
+            return fold_number(node, 0);
+        }
+    }
+
+    return NULL;
+}
+
+static struct node *fold_exp_node(struct compile_process *process, struct node *node)
+{
+    const char *op = node->exp.op;
+    node->exp.left = fold_exp(process, node->exp.left);
+    node->exp.right = fold_exp(process, node->exp.right);
+    if (fold_is_assignment(node) || S_EQ(op, "()") || S_EQ(op, ",") || is_access_operator(op) || is_array_operator(op))
+    {
+        return node;
+    }
+
+    struct node *left = node->exp.left;
+    struct node *right = node->exp.right;
+    if (S_EQ(op, "?"))
+    {
+        if (!fold_is_literal(left))
+        {
+            return node;
+        }
+        return left->llnum ? right->tenary.true_node : right->tenary.false_node;
+    }
+
+    // The right operand is never evaluated when the left operand decides the result
+    if (fold_is_literal(left) && ((S_EQ(op, "&&") && !left->llnum) || (S_EQ(op, "||") && left->llnum)))
+    {
+        return fold_number(node, left->llnum != 0);
+    }
+
+    if (fold_is_literal(left) && fold_is_literal(right))
+    {
+        bool success = false;
+        long result = arithmetic(process, left->llnum, right->llnum, op, &success);
+        if (success)
+        {
+            return fold_number(node, result);
+        }
+        return node;
+    }
+
+    struct node *simplified = fold_identity(node);
+    return simplified ? simplified : node;
+}
+
+static struct node *fold_unary(struct compile_process *process, struct node *node)
+{
+    node->unary.operand = fold_exp(process, node->unary.operand);
+    struct node *operand = node->unary.operand;
+    if (!fold_is_literal(operand))
+    {
+        return node;
+    }
+
+    const char *op = node->unary.op;
+    if (S_EQ(op, "-"))
+    {
+        return fold_number(node, (int)-operand->llnum);
+    }
+
+    if (S_EQ(op, "~"))
+    {
+        return fold_number(node, (int)~operand->llnum);
+    }
+
+    if (S_EQ(op, "!"))
+    {
+        return fold_number(node, !operand->llnum);
+    }
+
+    return node;
+}
+
+static struct node *fold_cast(struct compile_process *process, struct node *node)
+{
+    node->cast.operand = fold_exp(process, node->cast.operand);
+    long value = 0;
+    if (fold_is_literal(node->cast.operand) && fold_cast_value(&node->cast.dtype, node->cast.operand->llnum, &value))
+    {
+        return fold_number(node, value);
+    }
+    return node;
+}
+
+static struct node *fold_exp(struct compile_process *process, struct node *node)
+{
+    if (!node_valid(node))
+    {
+        return node;
+    }
+
+    switch (node->type)
+    {
+    case NODE_TYPE_EXPRESSION:
+        return fold_exp_node(process, node);
+
+    case NODE_TYPE_EXPRESSION_PARENTHESIS:
+        node->parenthesis.exp = fold_exp(process, node->parenthesis.exp);
+        return fold_is_literal(node->parenthesis.exp) ? node->parenthesis.exp : node;
+
+    case NODE_TYPE_UNARY:
+        return fold_unary(process, node);
+
+    case NODE_TYPE_CAST:
+        return fold_cast(process, node);
+
+    case NODE_TYPE_TENARY:
+        node->tenary.true_node = fold_exp(process, node->tenary.true_node);
+        node->tenary.false_node = fold_exp(process, node->tenary.false_node);
+        break;
+
+    case NODE_TYPE_BRACKET:
+        node->bracket.inner = fold_exp(process, node->bracket.inner);
+        break;
+    }
+
+    return node;
+}
+
+/**
+ * Returns true if a goto or switch could jump into the statement, it cannot be removed then
+ * even when it is never reached from above
+ */
+static bool fold_has_jump_target(struct node *node)
+{
+    if (!node_valid(node))
+    {
+        return false;
+    }
+
+    switch (node->type)
+    {
+    case NODE_TYPE_LABEL:
+    case NODE_TYPE_STATEMENT_CASE:
+    case NODE_TYPE_STATEMENT_DEFAULT:
+        return true;
+
+    case NODE_TYPE_BODY:
+        for (int i = 0; i < vector_count(node->body.statements); i++)
+        {
+            if (fold_has_jump_target(*(struct node **)vector_at(node->body.statements, i)))
+            {
+                return true;
+            }
+        }
+        return false;
+
+    case NODE_TYPE_STATEMENT_IF:
+        return fold_has_jump_target(node->stmt._if.body_node) || fold_has_jump_target(node->stmt._if.next);
+
+    case NODE_TYPE_STATEMENT_ELSE:
+        return fold_has_jump_target(node->stmt._else.body_node);
+
+    case NODE_TYPE_STATEMENT_WHILE:
+        return fold_has_jump_target(node->stmt._while.body);
+
+    case NODE_TYPE_STATEMENT_DO_WHILE:
+        return fold_has_jump_target(node->stmt._do_while.body);
+
+    case NODE_TYPE_STATEMENT_FOR:
+        return fold_has_jump_target(node->stmt._for.body);
+
+    case NODE_TYPE_STATEMENT_SWITCH:
+        return fold_has_jump_target(node->stmt._switch.body);
+    }
+
+    return false;
+}
+
+/**
+ * Folds the "else" or "else if" of an if statement, returns NULL if nothing is left of it
+ */
+static struct node *fold_else_or_else_if(struct compile_process *process, struct node *node)
+{
+    if (!node)
+    {
+        return NULL;
+    }
+
+    if (node->type == NODE_TYPE_STATEMENT_ELSE)
+    {
+        node->stmt._else.body_node = fold_statement(process, node->stmt._else.body_node);
+        return node;
+    }
+
+    struct node *folded = fold_statement(process, node);
+    if (folded->type == NODE_TYPE_STATEMENT_IF)
+    {
+        return folded;
+    }
+
+    if (folded->type == NODE_TYPE_BLANK)
+    {
+        return NULL;
+    }
+
+    // The condition of the "else if" is always true, it is an "else" now
+    return fold_replacement(node, &(struct node){.type = NODE_TYPE_STATEMENT_ELSE, .stmt._else.body_node = folded});
+}
+
+static struct node *fold_if(struct compile_process *process, struct node *node)
+{
+    node->stmt._if.cond_node = fold_exp(process, node->stmt._if.cond_node);
+    node->stmt._if.body_node = fold_statement(process, node->stmt._if.body_node);
+    node->stmt._if.next = fold_else_or_else_if(process, node->stmt._if.next);
+
+    struct node *cond = node->stmt._if.cond_node;
+    struct node *next = node->stmt._if.next;
+    if (!fold_is_literal(cond))
+    {
+        return node;
+    }
+
+    if (cond->llnum)
+    {
+        if (fold_has_jump_target(next))
+        {
+            return node;
+        }
+        return node->stmt._if.body_node;
+    }
+
+    if (fold_has_jump_target(node->stmt._if.body_node))
+    {
+        return node;
+    }
+
+    if (!next)
+    {
+        return fold_blank(node);
+    }
+    return next->type == NODE_TYPE_STATEMENT_ELSE ? next->stmt._else.body_node : next;
+}
+
+static struct node *fold_while(struct compile_process *process, struct node *node)
+{
+    node->stmt._while.cond = fold_exp(process, node->stmt._while.cond);
+    node->stmt._while.body = fold_statement(process, node->stmt._while.body);
+    if (fold_is_literal(node->stmt._while.cond) && !node->stmt._while.cond->llnum && !fold_has_jump_target(node->stmt._while.body))
+    {
+        return fold_blank(node);
+    }
+    return node;
+}
+
+static struct node *fold_for(struct compile_process *process, struct node *node)
+{
+    node->stmt._for.init = fold_exp(process, node->stmt._for.init);
+    node->stmt._for.cond = fold_exp(process, node->stmt._for.cond);
+    node->stmt._for.loop = fold_exp(process, node->stmt._for.loop);
+    node->stmt._for.body = fold_statement(process, node->stmt._for.body);
+
+    struct node *init = node->stmt._for.init;
+    struct node *cond = node->stmt._for.cond;
+    if (!fold_is_literal(cond) || cond->llnum || fold_has_jump_target(node->stmt._for.body))
+    {
+        return node;
+    }
+
+    // Only the initialisation runs when the condition is never true
+    if (!node_valid(init))
+    {
+        return fold_blank(node);
+    }
+    return node_is_expressionable(init) ? init : node;
+}
+
+static void fold_variable(struct compile_process *process, struct node *node)
+{
+    if (node->var.val)
+    {
+        node->var.val = fold_exp(process, node->var.val);
+    }
+}
+
+static void fold_body(struct compile_process *process, struct node *node)
+{
+    for (int i = 0; i < vector_count(node->body.statements); i++)
+    {
+        struct node **statement = vector_at(node->body.statements, i);
+        *statement = fold_statement(process, *statement);
+    }
+}
+
+static struct node *fold_statement(struct compile_process *process, struct node *node)
+{
+    if (!node_valid(node))
+    {
+        return node;
+    }
+
+    switch (node->type)
+    {
+    case NODE_TYPE_BODY:
+        fold_body(process, node);
+        break;
+
+    case NODE_TYPE_VARIABLE:
+        fold_variable(process, node);
+        break;
+
+    case NODE_TYPE_VARIABLE_LIST:
+        for (int i = 0; i < vector_count(node->var_list.list); i++)
+        {
+            fold_variable(process, *(struct node **)vector_at(node->var_list.list, i));
+        }
+        break;
+
+    case NODE_TYPE_STATEMENT_RETURN:
+        node->stmt.ret.exp = fold_exp(process, node->stmt.ret.exp);
+        break;
+
+    case NODE_TYPE_STATEMENT_IF:
+        return fold_if(process, node);
+
+    case NODE_TYPE_STATEMENT_WHILE:
+        return fold_while(process, node);
+
+    case NODE_TYPE_STATEMENT_DO_WHILE:
+        node->stmt._do_while.body = fold_statement(process, node->stmt._do_while.body);
+        node->stmt._do_while.cond = fold_exp(process, node->stmt._do_while.cond);
+        break;
+
+    case NODE_TYPE_STATEMENT_FOR:
+        return fold_for(process, node);
+
+    case NODE_TYPE_STATEMENT_SWITCH:
+        node->stmt._switch.exp = fold_exp(process, node->stmt._switch.exp);
+        node->stmt._switch.body = fold_statement(process, node->stmt._switch.body);
+        break;
+
+    case NODE_TYPE_EXPRESSION:
+    case NODE_TYPE_EXPRESSION_PARENTHESIS:
+    case NODE_TYPE_UNARY:
+    case NODE_TYPE_CAST:
+        return fold_exp(process, node);
+    }
+
+    return node;
+}
+
+void fold(struct compile_process *process)
+{
+    for (int i = 0; i < vector_count(process->node_tree_vec); i++)
+    {
+        struct node *node = *(struct node **)vector_at(process->node_tree_vec, i);
+        switch (node->type)
+        {
+        case NODE_TYPE_FUNCTION:
+            if (!function_node_is_prototype(node))
+            {
+                fold_body(process, node->func.body_n);
+            }
+            break;
+
+        case NODE_TYPE_VARIABLE:
+            fold_variable(process, node);
+            break;
+        }
+    }
+}
@@ -16,10 +16,14 @@ long arithmetic(struct compile_process *compiler, long left_operand, long right_
     {
         result = left_operand * right_operand;
     }
-    else if (S_EQ(op, "/"))
+    else if (S_EQ(op, "/") && right_operand != 0)
     {
         result = left_operand / right_operand;
     }
+    else if (S_EQ(op, "%") && right_operand != 0)
+    {
+        result = left_operand % right_operand;
+    }
     else if (S_EQ(op, "+"))
     {
         result = left_operand + right_operand;
@@ -52,13 +56,25 @@ long arithmetic(struct compile_process *compiler, long left_operand, long right_
     {
         result = left_operand <= right_operand;
     }
-    else if (S_EQ(op, "<<"))
+    else if (S_EQ(op, "<<") && right_operand >= 0 && right_operand < 32)
+    {
+        result = (int)left_operand << right_operand;
+    }
+    else if (S_EQ(op, ">>") && right_operand >= 0 && right_operand < 32)
+    {
+        result = (int)left_operand >> right_operand;
+    }
+    else if (S_EQ(op, "&"))
+    {
+        result = left_operand & right_operand;
+    }
+    else if (S_EQ(op, "|"))
     {
-        result = left_operand << right_operand;
+        result = left_operand | right_operand;
     }
-    else if (S_EQ(op, ">>"))
+    else if (S_EQ(op, "^"))
     {
-        result = left_operand >> right_operand;
+        result = left_operand ^ right_operand;
     }
     else if (S_EQ(op, "&&"))
     {
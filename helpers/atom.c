@@ -0,0 +1,50 @@
+#include "atom.h"
+#include "hashmap.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Names shorter than this are terminated on the stack before they are looked up
+#define ATOM_STACK_NAME_SIZE 256
+
+// The global atom table, lazily created on the first intern. The atoms are the keys of the
+// hashmap, they are never removed so they never move.
+static struct hashmap* atom_table = NULL;
+
+const char* atom_n(const char* str, size_t length)
+{
+    if (!str)
+    {
+        return NULL;
+    }
+
+    char stack_name[ATOM_STACK_NAME_SIZE];
+    char* name = length < sizeof(stack_name) ? stack_name : malloc(length + 1);
+    memcpy(name, str, length);
+    name[length] = 0x00;
+
+    const char* result = atom(name);
+    if (name != stack_name)
+    {
+        free(name);
+    }
+    return result;
+}
+
+const char* atom(const char* str)
+{
+    if (!str)
+    {
+        return NULL;
+    }
+
+    if (!atom_table)
+    {
+        atom_table = hashmap_create(ATOM_TABLE_DEFAULT_SIZE);
+    }
+    return hashmap_key(atom_table, str);
+}
+
+size_t atom_count()
+{
+    return atom_table ? atom_table->count : 0;
+}
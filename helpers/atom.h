@@ -0,0 +1,31 @@
+#ifndef ATOM_H
+#define ATOM_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#define ATOM_TABLE_DEFAULT_SIZE 4096
+
+/**
+ * An atom is the single shared copy of a string held in the global atom table.
+ * Interning the same characters twice returns the same pointer, so two atoms are
+ * equal if and only if their pointers are equal. Atoms live for the lifetime of the program
+ * and must never be freed or written to.
+ *
+ * Returns the atom for the given null terminated string, creating it if needed.
+ * Returns NULL when str is NULL.
+ */
+const char* atom(const char* str);
+
+/**
+ * Returns the atom for the first "length" bytes of str, the input does not
+ * need to be null terminated.
+ */
+const char* atom_n(const char* str, size_t length);
+
+/**
+ * Returns the total number of unique atoms created so far
+ */
+size_t atom_count();
+
+#endif
@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <stdarg.h>
+#include <string.h>
 
 struct buffer* buffer_create()
 {
@@ -62,6 +63,14 @@ void buffer_write(struct buffer* buffer, char c)
     buffer->len++;
 }
 
+void buffer_write_bytes(struct buffer* buffer, const char* bytes, size_t size)
+{
+    buffer_need(buffer, size);
+
+    memcpy(&buffer->data[buffer->len], bytes, size);
+    buffer->len += size;
+}
+
 void* buffer_ptr(struct buffer* buffer)
 {
     return buffer->data;
@@ -1,44 +1,134 @@
 #include "hashmap.h"
+#include <string.h>
+
 struct hashmap* hashmap_create(size_t size)
 {
-    if (size < 1024)
+    if (size < HASHMAP_MINIMUM_SIZE)
     {
-        return NULL;
+        size = HASHMAP_MINIMUM_SIZE;
     }
 
     struct hashmap* hashmap = calloc(sizeof(struct hashmap), 1);
-  //  hashmap->data = malloc(size);
+    hashmap->data = calloc(sizeof(struct hashmap_data*), size);
+    hashmap->size = size;
     return hashmap;
 }
 
-void** hashmap_data_pointer(struct hashmap* hashmap, int hash)
+unsigned int hashmap_hash(struct hashmap* hashmap, const char* key)
+{
+    // FNV-1a
+    unsigned int hash = 2166136261u;
+    while (*key)
+    {
+        hash ^= (unsigned char)*key;
+        hash *= 16777619u;
+        key++;
+    }
+    return hash;
+}
+
+static struct hashmap_data** hashmap_data_pointer(struct hashmap* hashmap, const char* key)
+{
+    unsigned int index = hashmap_hash(hashmap, key) % hashmap->size;
+    struct hashmap_data** ptr = &hashmap->data[index];
+    while (*ptr && strcmp((*ptr)->key, key) != 0)
+    {
+        ptr = &(*ptr)->next;
+    }
+
+    return ptr;
+}
+
+static void hashmap_grow(struct hashmap* hashmap)
 {
+    size_t new_size = hashmap->size * 2;
+    struct hashmap_data** new_data = calloc(sizeof(struct hashmap_data*), new_size);
+    for (size_t i = 0; i < hashmap->size; i++)
+    {
+        struct hashmap_data* entry = hashmap->data[i];
+        while (entry)
+        {
+            struct hashmap_data* next = entry->next;
+            unsigned int index = hashmap_hash(hashmap, entry->key) % new_size;
+            entry->next = new_data[index];
+            new_data[index] = entry;
+            entry = next;
+        }
+    }
 
+    free(hashmap->data);
+    hashmap->data = new_data;
+    hashmap->size = new_size;
 }
 
-void hashmap_insert(struct hashmap* hashmap, const char* key, void** data, size_t len)
+/**
+ * Returns the entry for the given key, creating it with a NULL value if it does not exist
+ */
+static struct hashmap_data* hashmap_entry(struct hashmap* hashmap, const char* key)
 {
-    int index = hashmap_hash(hashmap, key);
-    // Copy the pointer to where the data pointer should be
-    // for the given hash
-    memcpy(hashmap_data_pointer(hashmap, index), *data, sizeof(void*));
+    struct hashmap_data** ptr = hashmap_data_pointer(hashmap, key);
+    if (*ptr)
+    {
+        return *ptr;
+    }
+
+    size_t len = strlen(key);
+    struct hashmap_data* entry = calloc(sizeof(struct hashmap_data) + len + 1, 1);
+    memcpy(entry->key, key, len + 1);
+    *ptr = entry;
     hashmap->count++;
+
+    // Keep the chains short, growing only relinks the entries
+    if (hashmap->count > hashmap->size)
+    {
+        hashmap_grow(hashmap);
+    }
+    return entry;
+}
+
+void hashmap_insert(struct hashmap* hashmap, const char* key, void* value)
+{
+    hashmap_entry(hashmap, key)->value = value;
 }
 
 void* hashmap_data(struct hashmap* hashmap, const char* key)
 {
-    int index = hashmap_hash(hashmap, key);
-   // return hashmap->data+index;
+    struct hashmap_data* entry = *hashmap_data_pointer(hashmap, key);
+    return entry ? entry->value : NULL;
 }
-int hashmap_hash(struct hashmap* hashmap, const char* key)
+
+const char* hashmap_key(struct hashmap* hashmap, const char* key)
 {
-    size_t len = strlen(key);
-    int hash = 0;
-    for (int i = 0; i < len; i++)
+    return hashmap_entry(hashmap, key)->key;
+}
+
+bool hashmap_remove(struct hashmap* hashmap, const char* key)
+{
+    struct hashmap_data** ptr = hashmap_data_pointer(hashmap, key);
+    struct hashmap_data* entry = *ptr;
+    if (!entry)
     {
-        hash += key[i];
+        return false;
     }
-    // The final 4 bytes will hold a void pointer to the value data.
-    // that is why we add on the size of void*
-    return hash % (hashmap->size - len+sizeof(void*));
-}
\ No newline at end of file
+
+    *ptr = entry->next;
+    free(entry);
+    hashmap->count--;
+    return true;
+}
+
+void hashmap_free(struct hashmap* hashmap)
+{
+    for (size_t i = 0; i < hashmap->size; i++)
+    {
+        struct hashmap_data* entry = hashmap->data[i];
+        while (entry)
+        {
+            struct hashmap_data* next = entry->next;
+            free(entry);
+            entry = next;
+        }
+    }
+    free(hashmap->data);
+    free(hashmap);
+}
@@ -2,32 +2,58 @@
 #define HASHMAP_H
 
 #include <stddef.h>
+#include <stdbool.h>
 #include <memory.h>
 #include <stdlib.h>
 
-#define HASHMAP_DEFAULT_SIZE 1024*512
-#define HASHMAP_MINIMUM_SIZE 1024
+#define HASHMAP_DEFAULT_SIZE 1024
+#define HASHMAP_MINIMUM_SIZE 16
 
 struct hashmap_data
 {
     // Pointer to the value
     void* value;
 
+    // The next entry in this bucket, NULL if this is the last one
+    struct hashmap_data* next;
+
     // The key name
     char key[];
 };
 
 struct hashmap
 {
-    struct hashmap_data data;
+    // Array of buckets, each bucket is a chain of hashmap_data
+    struct hashmap_data** data;
     size_t size;
     size_t count;
 };
 
 
 struct hashmap* hashmap_create(size_t size);
-int hashmap_hash(struct hashmap* hashmap, const char* key);
-void hashmap_insert(struct hashmap* hashmap, const char* key, void** data, size_t len);
+unsigned int hashmap_hash(struct hashmap* hashmap, const char* key);
+
+/**
+ * Inserts the given value into the hashmap. If the key already exists
+ * its value is replaced.
+ */
+void hashmap_insert(struct hashmap* hashmap, const char* key, void* value);
+
+/**
+ * Returns the value for the given key or NULL if the key does not exist
+ */
 void* hashmap_data(struct hashmap* hashmap, const char* key);
 
-#endif
\ No newline at end of file
+/**
+ * Returns the hashmap's own copy of the given key, inserting the key with a NULL value
+ * if it does not exist. The copy stays at the same address until the key is removed.
+ */
+const char* hashmap_key(struct hashmap* hashmap, const char* key);
+
+/**
+ * Removes the given key from the hashmap, returns true if the key was removed
+ */
+bool hashmap_remove(struct hashmap* hashmap, const char* key);
+void hashmap_free(struct hashmap* hashmap);
+
+#endif
@@ -6,6 +6,14 @@
 #include <stdbool.h>
 #include <stdio.h>
 
+// Every allocation made by a vector, see vector_total_allocations()
+static size_t vector_allocations = 0;
+
+size_t vector_total_allocations()
+{
+    return vector_allocations;
+}
+
 static bool vector_in_bounds_for_at(struct vector *vector, int index)
 {
     return (index >= 0 && index < vector->rindex);
@@ -25,6 +33,7 @@ struct vector *vector_create_no_saves(size_t esize)
 {
     struct vector *vector = calloc(sizeof(struct vector), 1);
     vector->data = malloc(esize * VECTOR_ELEMENT_INCREMENT);
+    vector_allocations += 2;
     vector->mindex = VECTOR_ELEMENT_INCREMENT;
     vector->rindex = 0;
     vector->pindex = 0;
@@ -48,8 +57,10 @@ struct vector *vector_clone(struct vector *vector)
     void *new_data_address = calloc(vector->esize, vector->count + VECTOR_ELEMENT_INCREMENT);
     memcpy(new_data_address, vector->data, vector_total_size(vector));
     struct vector *new_vec = calloc(sizeof(struct vector), 1);
+    vector_allocations += 2;
     memcpy(new_vec, vector, sizeof(struct vector));
     new_vec->data = new_data_address;
+    new_vec->mindex = vector->count + VECTOR_ELEMENT_INCREMENT;
 
     // Saves are not cloned with vector_clone yet.
     // assert(vector->saves == NULL);
@@ -58,9 +69,8 @@ struct vector *vector_clone(struct vector *vector)
 
 struct vector *vector_create(size_t esize)
 {
-    struct vector *vec = vector_create_no_saves(esize);
-    vec->saves = vector_create_no_saves(sizeof(struct vector));
-    return vec;
+    // The save stack is only created by the first vector_save, most vectors are never saved
+    return vector_create_no_saves(esize);
 }
 
 void vector_free(struct vector *vector)
@@ -82,9 +92,17 @@ void vector_resize_for_index(struct vector *vector, int start_index, int total_e
         return;
     }
 
-    vector->data = realloc(vector->data, ((start_index + total_elements + VECTOR_ELEMENT_INCREMENT) * vector->esize));
+    // Grow by at least half again, pushing n elements then only reallocates log n times
+    int capacity = start_index + total_elements + VECTOR_ELEMENT_INCREMENT;
+    if (capacity < vector->mindex + vector->mindex / 2)
+    {
+        capacity = vector->mindex + vector->mindex / 2;
+    }
+
+    vector->data = realloc(vector->data, capacity * vector->esize);
+    vector_allocations++;
     assert(vector->data);
-    vector->mindex = start_index + total_elements;
+    vector->mindex = capacity;
 }
 
 void vector_resize_for(struct vector *vector, int total_elements)
@@ -211,6 +229,10 @@ void vector_save(struct vector *vector)
     // We not allowed to modify the saves so set it to NULL
     // when we push it to the save stack.
     tmp_vec.saves = NULL;
+    if (!vector->saves)
+    {
+        vector->saves = vector_create_no_saves(sizeof(struct vector));
+    }
     vector_push(vector->saves, &tmp_vec);
 }
 
@@ -357,6 +379,16 @@ void vector_pop_at(struct vector *vector, int index)
     vector->rindex -= 1;
 }
 
+void vector_pop_front(struct vector *vector, int total)
+{
+    void *next_element_pos = vector_at(vector, total);
+    size_t size = (size_t)vector_data_end(vector) - (size_t)next_element_pos;
+    memmove(vector->data, next_element_pos, size);
+    vector->count -= total;
+    vector->rindex -= total;
+    vector->pindex = vector->pindex > total ? vector->pindex - total : 0;
+}
+
 void vector_peek_pop(struct vector *vector)
 {
     // Popping at a peek is an akward one
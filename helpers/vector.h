@@ -110,6 +110,12 @@ int vector_pop_value(struct vector* vector, void* val);
 
 void vector_pop_at(struct vector *vector, int index);
 
+/**
+ * Pops the first "total" elements, the rest and the peek pointer move down with them.
+ * This will invalidate any pointers pointing directly to the vector data
+ */
+void vector_pop_front(struct vector *vector, int total);
+
 /**
  * Decrements the peek pointer so that the next peek
  * will point at the last peeked token
@@ -148,4 +154,9 @@ size_t vector_element_size(struct vector* vector);
  */
 struct vector* vector_clone(struct vector* vector);
 
+/**
+ * Returns how many times vectors have allocated or reallocated memory so far
+ */
+size_t vector_total_allocations();
+
 #endif
\ No newline at end of file
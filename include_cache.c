@@ -0,0 +1,443 @@
+#include "compiler.h"
+#include "helpers/buffer.h"
+#include "helpers/hashmap.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+/**
+ * Cache of include resolutions. Resolving an include asks the filesystem about every
+ * include directory in turn, and the same name is resolved again for every #include of
+ * it. The cache remembers where a name was found, or that it was not found at all,
+ * for the include directories and working directory it was resolved against.
+ *
+ * The cache can be kept in a file between runs. Adding or removing a file changes the
+ * modification time of its directory, so every entry in the file remembers which
+ * directories were looked in to resolve it, and an entry is dropped when it is loaded
+ * if any of them changed. Within one run the directories are assumed not to change.
+ * Writing the file changes its own directory, which is often the working directory every
+ * quoted include looks in, that change is told apart by the time the file was written.
+ */
+
+#define INCLUDE_CACHE_MAGIC "DCIC"
+#define INCLUDE_CACHE_VERSION 2
+
+struct include_cache_directory
+{
+    const char *path;
+    // Modification time when the directory was first looked at, -1 if it does not exist
+    int64_t mtime_sec;
+    int64_t mtime_nsec;
+    dev_t dev;
+    ino_t ino;
+};
+
+struct include_cache_entry
+{
+    // Absolute path the name resolves to, NULL if it could not be found
+    const char *path;
+    // Filesystem calls it took to resolve the name
+    int calls;
+    // Indexes into the directory table of the directories that were looked in,
+    // only kept when the cache is saved to a file.
+    struct vector *directories;
+};
+
+static struct include_cache
+{
+    // Include name to struct include_cache_entry
+    struct hashmap *entries;
+
+    // Vector of struct include_cache_directory, and its path to index + 1
+    struct vector *directories;
+    struct hashmap *directory_ids;
+
+    // The working directory and include directories the entries were resolved against
+    char *signature;
+    // The include directory vector the signature was last built for
+    struct vector *include_dirs;
+
+    // File the cache is loaded from and saved to, NULL if it is not kept
+    const char *filename;
+    bool loaded;
+    // True if there is something in memory the file does not have
+    bool dirty;
+
+    struct include_cache_stats stats;
+} include_cache;
+
+void include_cache_set_file(const char *filename)
+{
+    include_cache.filename = filename;
+}
+
+struct include_cache_stats *include_cache_stats()
+{
+    return &include_cache.stats;
+}
+
+static void include_cache_reset()
+{
+    if (include_cache.entries)
+    {
+        hashmap_free(include_cache.entries);
+        hashmap_free(include_cache.directory_ids);
+        vector_free(include_cache.directories);
+    }
+
+    include_cache.entries = hashmap_create(HASHMAP_DEFAULT_SIZE);
+    include_cache.directory_ids = hashmap_create(HASHMAP_MINIMUM_SIZE);
+    include_cache.directories = vector_create(sizeof(struct include_cache_directory));
+}
+
+static char *include_cache_signature(struct compile_process *process)
+{
+    char cwd[PATH_MAX];
+    if (!getcwd(cwd, sizeof(cwd)))
+    {
+        cwd[0] = 0;
+    }
+
+    struct buffer *buffer = buffer_create();
+    buffer_write_bytes(buffer, cwd, strlen(cwd));
+    buffer_write(buffer, '\n');
+    const char *include_dir = compiler_include_dir_begin(process);
+    while (include_dir)
+    {
+        buffer_write_bytes(buffer, include_dir, strlen(include_dir));
+        buffer_write(buffer, '\n');
+        include_dir = compiler_include_dir_next(process);
+    }
+    buffer_write(buffer, 0x00);
+
+    char *signature = strdup(buffer_ptr(buffer));
+    buffer_free(buffer);
+    return signature;
+}
+
+static void include_cache_stat_directory(struct include_cache_directory *directory)
+{
+    struct stat st;
+    include_cache.stats.directory_checks++;
+    if (stat(directory->path, &st) != 0)
+    {
+        directory->mtime_sec = -1;
+        directory->mtime_nsec = 0;
+        return;
+    }
+
+    directory->mtime_sec = st.st_mtim.tv_sec;
+    directory->mtime_nsec = st.st_mtim.tv_nsec;
+    directory->dev = st.st_dev;
+    directory->ino = st.st_ino;
+}
+
+/**
+ * Writes the directory the path is in to directory, which holds PATH_MAX characters
+ */
+static void include_cache_directory_of(const char *path, char *directory)
+{
+    const char *slash = strrchr(path, '/');
+    if (!slash)
+    {
+        strcpy(directory, ".");
+    }
+    else if (slash == path)
+    {
+        strcpy(directory, "/");
+    }
+    else
+    {
+        snprintf(directory, PATH_MAX, "%.*s", (int)(slash - path), path);
+    }
+}
+
+/**
+ * Returns the index of the directory in the table, the directory is added and looked
+ * at if it is not in there yet
+ */
+static int include_cache_directory_id(const char *path)
+{
+    intptr_t id = (intptr_t)hashmap_data(include_cache.directory_ids, path);
+    if (id)
+    {
+        return id - 1;
+    }
+
+    struct include_cache_directory directory = {.path = strdup(path)};
+    include_cache_stat_directory(&directory);
+    vector_push(include_cache.directories, &directory);
+    id = vector_count(include_cache.directories);
+    hashmap_insert(include_cache.directory_ids, path, (void *)id);
+    return id - 1;
+}
+
+/**
+ * Adds the directory the probed path is in to the directories the entry depends on
+ */
+static void include_cache_entry_add_probe(struct include_cache_entry *entry, const char *probed_path)
+{
+    char directory[PATH_MAX];
+    include_cache_directory_of(probed_path, directory);
+    int id = include_cache_directory_id(directory);
+    vector_push(entry->directories, &id);
+}
+
+static struct include_cache_entry *include_cache_entry_create(const char *path, int calls)
+{
+    struct include_cache_entry *entry = calloc(1, sizeof(struct include_cache_entry));
+    entry->path = path ? strdup(path) : NULL;
+    entry->calls = calls;
+    entry->directories = vector_create(sizeof(int));
+    return entry;
+}
+
+/**
+ * Reads the cache file, entries resolved against other include directories or that
+ * depend on a directory that changed since they were saved are left out.
+ */
+static void include_cache_load()
+{
+    FILE *fp = fopen(include_cache.filename, "r");
+    if (!fp)
+    {
+        return;
+    }
+
+    char *line = NULL;
+    size_t line_size = 0;
+    char magic[5] = {};
+    int version = 0;
+    size_t signature_size = 0;
+    if (fscanf(fp, "%4s %i\nsignature %zu", magic, &version, &signature_size) != 3 || fgetc(fp) != '\n' ||
+        !S_EQ(magic, INCLUDE_CACHE_MAGIC) || version != INCLUDE_CACHE_VERSION || signature_size >= PATH_MAX * 64)
+    {
+        fclose(fp);
+        return;
+    }
+
+    char *signature = calloc(1, signature_size + 1);
+    if (fread(signature, 1, signature_size, fp) != signature_size || !S_EQ(signature, include_cache.signature))
+    {
+        // Resolved against other include directories, none of it applies
+        include_cache.dirty = true;
+        free(signature);
+        fclose(fp);
+        return;
+    }
+    free(signature);
+
+    // Directories are saved with the time they had, any that changed since then
+    // make the entries that looked in them stale.
+    struct include_cache_loaded_directory
+    {
+        int id;
+        bool changed;
+    };
+    struct vector *loaded_directories = vector_create(sizeof(struct include_cache_loaded_directory));
+    struct stat file_st = {};
+    fstat(fileno(fp), &file_st);
+    long long mtime_sec, mtime_nsec;
+    int holds_file, path_start;
+    while (getline(&line, &line_size, fp) > 0)
+    {
+        line[strcspn(line, "\n")] = 0;
+        if (sscanf(line, "directory %lld %lld %i %n", &mtime_sec, &mtime_nsec, &holds_file, &path_start) == 3)
+        {
+            struct include_cache_loaded_directory loaded = {.id = include_cache_directory_id(line + path_start)};
+            struct include_cache_directory *directory = vector_at(include_cache.directories, loaded.id);
+            loaded.changed = directory->mtime_sec != mtime_sec || directory->mtime_nsec != mtime_nsec;
+            if (loaded.changed && holds_file)
+            {
+                // Putting the file in its directory was the last change to it? Then nothing else changed
+                loaded.changed = directory->mtime_sec > file_st.st_ctim.tv_sec ||
+                                 (directory->mtime_sec == file_st.st_ctim.tv_sec && directory->mtime_nsec > file_st.st_ctim.tv_nsec);
+            }
+            vector_push(loaded_directories, &loaded);
+            include_cache.dirty |= loaded.changed;
+            continue;
+        }
+
+        int calls, total_directories, offset;
+        if (sscanf(line, "entry %i %i %n", &calls, &total_directories, &offset) != 2)
+        {
+            continue;
+        }
+
+        bool stale = false;
+        struct include_cache_entry *entry = include_cache_entry_create(NULL, calls);
+        for (int i = 0; i < total_directories; i++)
+        {
+            int index, consumed;
+            if (sscanf(line + offset, "%i %n", &index, &consumed) != 1 || index < 0 || index >= vector_count(loaded_directories))
+            {
+                stale = true;
+                break;
+            }
+            offset += consumed;
+            struct include_cache_loaded_directory *loaded = vector_at(loaded_directories, index);
+            stale |= loaded->changed;
+            vector_push(entry->directories, &loaded->id);
+        }
+
+        char *name = line + offset;
+        char *path = strchr(name, '\t');
+        if (stale || !path)
+        {
+            include_cache.dirty = true;
+            vector_free(entry->directories);
+            free(entry);
+            continue;
+        }
+        *path++ = 0;
+        entry->path = *path ? strdup(path) : NULL;
+        hashmap_insert(include_cache.entries, name, entry);
+    }
+
+    vector_free(loaded_directories);
+    free(line);
+    fclose(fp);
+}
+
+/**
+ * Makes sure the cache holds the entries for the include directories of the process,
+ * entries resolved against other directories say nothing about these.
+ */
+static void include_cache_prepare(struct compile_process *process)
+{
+    if (include_cache.include_dirs == process->include_dirs)
+    {
+        return;
+    }
+
+    include_cache.include_dirs = process->include_dirs;
+    char *signature = include_cache_signature(process);
+    if (include_cache.signature && S_EQ(signature, include_cache.signature))
+    {
+        free(signature);
+        return;
+    }
+
+    include_cache_reset();
+    free(include_cache.signature);
+    include_cache.signature = signature;
+    if (include_cache.filename && !include_cache.loaded)
+    {
+        include_cache.loaded = true;
+        include_cache_load();
+    }
+}
+
+int include_cache_lookup(struct compile_process *process, const char *filename, char *path_out)
+{
+    include_cache_prepare(process);
+    struct include_cache_entry *entry = hashmap_data(include_cache.entries, filename);
+    if (!entry)
+    {
+        include_cache.stats.misses++;
+        return INCLUDE_CACHE_UNKNOWN;
+    }
+
+    include_cache.stats.hits++;
+    include_cache.stats.calls_saved += entry->calls;
+    if (!entry->path)
+    {
+        return INCLUDE_CACHE_NOT_FOUND;
+    }
+
+    strcpy(path_out, entry->path);
+    return INCLUDE_CACHE_FOUND;
+}
+
+void include_cache_insert(struct compile_process *process, const char *filename, const char *path, int calls)
+{
+    include_cache_prepare(process);
+    struct include_cache_entry *entry = include_cache_entry_create(path, calls);
+    if (include_cache.filename)
+    {
+        // Only an entry that outlives the run can see its directories change
+        char probed_path[PATH_MAX];
+        const char *include_dir = compiler_include_dir_begin(process);
+        while (include_dir)
+        {
+            snprintf(probed_path, sizeof(probed_path), "%s/%s", include_dir, filename);
+            include_cache_entry_add_probe(entry, probed_path);
+            include_dir = compiler_include_dir_next(process);
+        }
+        include_cache_entry_add_probe(entry, filename);
+    }
+
+    hashmap_insert(include_cache.entries, filename, entry);
+    include_cache.dirty = true;
+}
+
+static bool include_cache_write_entry(FILE *fp, const char *name, struct include_cache_entry *entry)
+{
+    // Names and paths are separated by tabs and lines, they cannot contain them
+    if (strpbrk(name, "\t\n") || (entry->path && strchr(entry->path, '\n')))
+    {
+        return true;
+    }
+
+    fprintf(fp, "entry %i %i", entry->calls, vector_count(entry->directories));
+    for (int i = 0; i < vector_count(entry->directories); i++)
+    {
+        fprintf(fp, " %i", *(int *)vector_at(entry->directories, i));
+    }
+    return fprintf(fp, " %s\t%s\n", name, entry->path ? entry->path : "") > 0;
+}
+
+void include_cache_store()
+{
+    if (!include_cache.filename || !include_cache.dirty || !include_cache.signature)
+    {
+        return;
+    }
+
+    // The directory of the file is marked if it has not changed since it was first looked at,
+    // the next run can then tell writing the file apart from other changes
+    char file_directory[PATH_MAX];
+    include_cache_directory_of(include_cache.filename, file_directory);
+    struct stat file_directory_st;
+    bool has_file_directory = stat(file_directory, &file_directory_st) == 0;
+
+    char tmp_path[PATH_MAX + 32];
+    snprintf(tmp_path, sizeof(tmp_path), "%s.%i.tmp", include_cache.filename, getpid());
+    FILE *fp = fopen(tmp_path, "w");
+    if (!fp)
+    {
+        return;
+    }
+
+    bool written = fprintf(fp, "%s %i\nsignature %zu\n%s", INCLUDE_CACHE_MAGIC, INCLUDE_CACHE_VERSION,
+                           strlen(include_cache.signature), include_cache.signature) > 0;
+    for (int i = 0; i < vector_count(include_cache.directories); i++)
+    {
+        struct include_cache_directory *directory = vector_at(include_cache.directories, i);
+        bool holds_file = has_file_directory && directory->mtime_sec >= 0 && directory->dev == file_directory_st.st_dev &&
+                          directory->ino == file_directory_st.st_ino && directory->mtime_sec == file_directory_st.st_mtim.tv_sec &&
+                          directory->mtime_nsec == file_directory_st.st_mtim.tv_nsec;
+        written &= fprintf(fp, "directory %lld %lld %i %s\n", (long long)directory->mtime_sec,
+                           (long long)directory->mtime_nsec, holds_file, directory->path) > 0;
+    }
+
+    struct hashmap *entries = include_cache.entries;
+    for (size_t i = 0; i < entries->size; i++)
+    {
+        for (struct hashmap_data *data = entries->data[i]; data; data = data->next)
+        {
+            written &= include_cache_write_entry(fp, data->key, data->value);
+        }
+    }
+    written = fclose(fp) == 0 && written;
+
+    // Like the token cache, other compilers only ever see a complete file
+    if (!written || rename(tmp_path, include_cache.filename) != 0)
+    {
+        unlink(tmp_path);
+        return;
+    }
+    include_cache.dirty = false;
+}
@@ -0,0 +1,1067 @@
+#include "compiler.h"
+#include "helpers/vector.h"
+
+/**
+ * Lowers the tree of a function to the IR.
+ *
+ * Virtual registers are not in SSA form, the result of a logical or tenary expression is
+ * moved into the same register on both paths. Every local and argument is held in a virtual
+ * register of its own for the whole function, the IR cannot take the address of a variable
+ * so nothing else can reach them. Arguments are loaded into theirs on entry. Any other virtual
+ * register never outlives the statement that created it.
+ */
+struct ir_lowering
+{
+    struct compile_process *process;
+    struct ir_function *function;
+    struct ir_block *block;
+
+    // Stack of struct ir_variable* in scope, the innermost declaration is found first
+    struct vector *scope;
+
+    // Stacks of struct ir_block* that break and continue jump to
+    struct vector *break_targets;
+    struct vector *continue_targets;
+
+    // Set to why the function cannot be lowered, NULL while it can
+    const char *unsupported;
+
+    // Value of the last statement when it was an expression. Functions generated from the tree
+    // return it when they fall off their end, as it is left in eax.
+    struct ir_operand last_value;
+};
+
+static const struct ir_type ir_type_int = {DATA_SIZE_DWORD, true};
+
+static const char *ir_op_names[] = {
+    [IR_OP_MOVE] = "move",
+    [IR_OP_LOAD] = "load",
+    [IR_OP_STORE] = "store",
+    [IR_OP_ADD] = "add",
+    [IR_OP_SUB] = "sub",
+    [IR_OP_MUL] = "mul",
+    [IR_OP_DIV] = "div",
+    [IR_OP_MOD] = "mod",
+    [IR_OP_AND] = "and",
+    [IR_OP_OR] = "or",
+    [IR_OP_XOR] = "xor",
+    [IR_OP_SHL] = "shl",
+    [IR_OP_SHR] = "shr",
+    [IR_OP_EQ] = "eq",
+    [IR_OP_NE] = "ne",
+    [IR_OP_LT] = "lt",
+    [IR_OP_LE] = "le",
+    [IR_OP_GT] = "gt",
+    [IR_OP_GE] = "ge",
+    [IR_OP_NEG] = "neg",
+    [IR_OP_NOT] = "not",
+    [IR_OP_TRUNCATE] = "truncate",
+    [IR_OP_CALL] = "call",
+    [IR_OP_JUMP] = "jump",
+    [IR_OP_BRANCH] = "branch",
+    [IR_OP_RETURN] = "ret"};
+
+static const char *ir_variable_kind_names[] = {
+    [IR_VARIABLE_LOCAL] = "local",
+    [IR_VARIABLE_ARGUMENT] = "argument",
+    [IR_VARIABLE_GLOBAL] = "global"};
+
+struct ir_binary_operator
+{
+    const char *op;
+    int ir_op;
+};
+
+static const struct ir_binary_operator ir_binary_operators[] = {
+    {"+", IR_OP_ADD},
+    {"-", IR_OP_SUB},
+    {"*", IR_OP_MUL},
+    {"/", IR_OP_DIV},
+    {"%", IR_OP_MOD},
+    {"&", IR_OP_AND},
+    {"|", IR_OP_OR},
+    {"^", IR_OP_XOR},
+    {"<<", IR_OP_SHL},
+    {">>", IR_OP_SHR},
+    {"==", IR_OP_EQ},
+    {"!=", IR_OP_NE},
+    {"<", IR_OP_LT},
+    {"<=", IR_OP_LE},
+    {">", IR_OP_GT},
+    {">=", IR_OP_GE},
+    {NULL, 0}};
+
+static int ir_binary_op(const char *op)
+{
+    for (int i = 0; ir_binary_operators[i].op; i++)
+    {
+        if (S_EQ(ir_binary_operators[i].op, op))
+        {
+            return ir_binary_operators[i].ir_op;
+        }
+    }
+    return -1;
+}
+
+static bool ir_op_is_comparison(int op)
+{
+    return op >= IR_OP_EQ && op <= IR_OP_GE;
+}
+
+static bool ir_op_is_terminator(int op)
+{
+    return op == IR_OP_JUMP || op == IR_OP_BRANCH || op == IR_OP_RETURN;
+}
+
+static void ir_unsupported(struct ir_lowering *lowering, const char *reason)
+{
+    if (!lowering->unsupported)
+    {
+        lowering->unsupported = reason;
+    }
+}
+
+static struct ir_operand ir_operand_none()
+{
+    return (struct ir_operand){.kind = IR_OPERAND_NONE, .type = ir_type_int};
+}
+
+static struct ir_operand ir_operand_constant(long long constant)
+{
+    return (struct ir_operand){.kind = IR_OPERAND_CONSTANT, .type = ir_type_int, .constant = constant};
+}
+
+static struct ir_operand ir_operand_vreg(int vreg, struct ir_type type)
+{
+    return (struct ir_operand){.kind = IR_OPERAND_VREG, .type = type, .vreg = vreg};
+}
+
+static struct ir_block *ir_block_new(struct ir_lowering *lowering)
+{
+    struct ir_block *block = calloc(1, sizeof(struct ir_block));
+    block->instructions = vector_create(sizeof(struct ir_instruction));
+    return block;
+}
+
+/**
+ * Continues lowering in the block. Blocks are numbered and kept in the order lowering reaches
+ * them, jumps within an expression then only ever go forward.
+ */
+static void ir_place_block(struct ir_lowering *lowering, struct ir_block *block)
+{
+    block->id = vector_count(lowering->function->blocks);
+    vector_push(lowering->function->blocks, &block);
+    lowering->block = block;
+}
+
+static bool ir_block_terminated(struct ir_block *block)
+{
+    struct ir_instruction *last = vector_back_or_null(block->instructions);
+    return last && ir_op_is_terminator(last->op);
+}
+
+static struct ir_instruction *ir_emit(struct ir_lowering *lowering, struct ir_instruction *instruction)
+{
+    if (ir_block_terminated(lowering->block))
+    {
+        // Anything after a return, break or continue cannot run, it still needs a block to go in
+        ir_place_block(lowering, ir_block_new(lowering));
+    }
+
+    vector_push(lowering->block->instructions, instruction);
+    return vector_back(lowering->block->instructions);
+}
+
+static int ir_vreg_new(struct ir_lowering *lowering)
+{
+    return lowering->function->total_vregs++;
+}
+
+/**
+ * Emits an instruction that produces a value and returns the virtual register holding it
+ */
+static struct ir_operand ir_emit_value(struct ir_lowering *lowering, int op, struct ir_type type, struct ir_operand a, struct ir_operand b)
+{
+    struct ir_type result_type = ir_op_is_comparison(op) ? ir_type_int : type;
+    struct ir_instruction *instruction = ir_emit(lowering, &(struct ir_instruction){.op = op, .type = type, .dst = ir_vreg_new(lowering), .operands = {a, b}});
+    return ir_operand_vreg(instruction->dst, result_type);
+}
+
+static void ir_emit_move(struct ir_lowering *lowering, int dst, struct ir_operand a)
+{
+    ir_emit(lowering, &(struct ir_instruction){.op = IR_OP_MOVE, .type = a.type, .dst = dst, .operands = {a}});
+}
+
+static void ir_emit_jump(struct ir_lowering *lowering, struct ir_block *target)
+{
+    ir_emit(lowering, &(struct ir_instruction){.op = IR_OP_JUMP, .dst = -1, .targets = {target}});
+}
+
+static void ir_emit_branch(struct ir_lowering *lowering, struct ir_operand cond, struct ir_block *if_true, struct ir_block *if_false)
+{
+    ir_emit(lowering, &(struct ir_instruction){.op = IR_OP_BRANCH, .dst = -1, .operands = {cond}, .targets = {if_true, if_false}});
+}
+
+/**
+ * Jumps to the block unless the current block has already left
+ */
+static void ir_jump_unless_terminated(struct ir_lowering *lowering, struct ir_block *block)
+{
+    if (!ir_block_terminated(lowering->block))
+    {
+        ir_emit_jump(lowering, block);
+    }
+}
+
+/**
+ * Continues lowering in the block, falling through to it from the current block
+ */
+static void ir_begin_block(struct ir_lowering *lowering, struct ir_block *block)
+{
+    ir_jump_unless_terminated(lowering, block);
+    ir_place_block(lowering, block);
+}
+
+/**
+ * Returns true if the IR can hold a value of the datatype, we only have integers for now
+ */
+static bool ir_datatype_supported(struct datatype *dtype)
+{
+    if (dtype->flags & (DATATYPE_FLAG_IS_POINTER | DATATYPE_FLAG_IS_ARRAY))
+    {
+        return false;
+    }
+
+    switch (dtype->type)
+    {
+    case DATA_TYPE_CHAR:
+    case DATA_TYPE_SHORT:
+    case DATA_TYPE_INTEGER:
+    case DATA_TYPE_LONG:
+        return dtype->size == DATA_SIZE_BYTE || dtype->size == DATA_SIZE_WORD || dtype->size == DATA_SIZE_DWORD;
+    }
+    return false;
+}
+
+static struct ir_type ir_type_for_datatype(struct datatype *dtype)
+{
+    return (struct ir_type){.size = dtype->size, .is_signed = dtype->flags & DATATYPE_FLAG_IS_SIGNED};
+}
+
+/**
+ * Creates the IR variable for the variable node. Variables the IR cannot hold get a size of zero
+ * so they still hide globals of the same name.
+ */
+static struct ir_variable *ir_variable_new(struct ir_lowering *lowering, struct node *var_node, int kind)
+{
+    struct ir_variable *variable = calloc(1, sizeof(struct ir_variable));
+    variable->kind = kind;
+    variable->name = var_node->var.name;
+    variable->offset = var_node->var.aoffset;
+    variable->vreg = -1;
+    if (ir_datatype_supported(&var_node->var.type) && !(var_node->var.type.flags & DATATYPE_FLAG_IS_STATIC))
+    {
+        variable->type = ir_type_for_datatype(&var_node->var.type);
+        if (kind != IR_VARIABLE_GLOBAL)
+        {
+            variable->vreg = ir_vreg_new(lowering);
+        }
+    }
+
+    vector_push(lowering->function->variables, &variable);
+    return variable;
+}
+
+static struct ir_variable *ir_variable_for_name(struct ir_lowering *lowering, const char *name)
+{
+    for (int i = vector_count(lowering->scope) - 1; i >= 0; i--)
+    {
+        struct ir_variable *variable = *(struct ir_variable **)vector_at(lowering->scope, i);
+        if (S_EQ(variable->name, name))
+        {
+            return variable;
+        }
+    }
+
+    // Globals are not in the scope, they are created the first time the function uses them
+    for (int i = 0; i < vector_count(lowering->function->variables); i++)
+    {
+        struct ir_variable *variable = *(struct ir_variable **)vector_at(lowering->function->variables, i);
+        if (variable->kind == IR_VARIABLE_GLOBAL && S_EQ(variable->name, name))
+        {
+            return variable;
+        }
+    }
+
+    struct symbol *sym = symresolver_get_symbol(lowering->process, name);
+    if (!sym || sym->type != SYMBOL_TYPE_NODE || ((struct node *)sym->data)->type != NODE_TYPE_VARIABLE)
+    {
+        return NULL;
+    }
+
+    return ir_variable_new(lowering, sym->data, IR_VARIABLE_GLOBAL);
+}
+
+static struct ir_variable *ir_variable_for_node(struct ir_lowering *lowering, struct node *node)
+{
+    if (node->type != NODE_TYPE_IDENTIFIER)
+    {
+        ir_unsupported(lowering, "assignment to something other than a variable");
+        return NULL;
+    }
+
+    struct ir_variable *variable = ir_variable_for_name(lowering, node->sval);
+    if (!variable || variable->type.size == 0)
+    {
+        ir_unsupported(lowering, "variable that is not an integer");
+        return NULL;
+    }
+    return variable;
+}
+
+/**
+ * The type of a variable once it is loaded, smaller variables are extended to 32 bits
+ */
+static struct ir_type ir_type_loaded(struct ir_variable *variable)
+{
+    return (struct ir_type){DATA_SIZE_DWORD, variable->type.is_signed || variable->type.size < DATA_SIZE_DWORD};
+}
+
+/**
+ * Emits "dst = load variable" from memory
+ */
+static void ir_emit_load(struct ir_lowering *lowering, int dst, struct ir_variable *variable)
+{
+    ir_emit(lowering, &(struct ir_instruction){.op = IR_OP_LOAD, .type = variable->type, .dst = dst, .variable = variable});
+}
+
+static struct ir_operand ir_load(struct ir_lowering *lowering, struct ir_variable *variable)
+{
+    int dst = ir_vreg_new(lowering);
+    if (variable->vreg != -1)
+    {
+        // A copy, the variable may be assigned while the value is still needed as in "x++"
+        ir_emit_move(lowering, dst, ir_operand_vreg(variable->vreg, ir_type_loaded(variable)));
+    }
+    else
+    {
+        ir_emit_load(lowering, dst, variable);
+    }
+    return ir_operand_vreg(dst, ir_type_loaded(variable));
+}
+
+static void ir_store(struct ir_lowering *lowering, struct ir_variable *variable, struct ir_operand value)
+{
+    if (variable->vreg == -1)
+    {
+        ir_emit(lowering, &(struct ir_instruction){.op = IR_OP_STORE, .type = variable->type, .dst = -1, .operands = {value}, .variable = variable});
+        return;
+    }
+
+    // The register holds the value as it would be loaded from a variable of its size
+    if (variable->type.size < DATA_SIZE_DWORD)
+    {
+        ir_emit(lowering, &(struct ir_instruction){.op = IR_OP_TRUNCATE, .type = variable->type, .dst = variable->vreg, .operands = {value}});
+        return;
+    }
+    ir_emit_move(lowering, variable->vreg, value);
+}
+
+/**
+ * The type binary operations on a and b are done in, unsigned wins as it does in C
+ */
+static struct ir_type ir_type_for_binary(struct ir_operand a, struct ir_operand b)
+{
+    return (struct ir_type){DATA_SIZE_DWORD, a.type.is_signed && b.type.is_signed};
+}
+
+static struct ir_operand ir_lower_exp(struct ir_lowering *lowering, struct node *node);
+
+/**
+ * Lowers the value of a condition, the result is zero when the condition is false
+ */
+static struct ir_operand ir_lower_logical(struct ir_lowering *lowering, struct node *node)
+{
+    bool is_and = S_EQ(node->exp.op, "&&");
+    int dst = ir_vreg_new(lowering);
+    struct ir_block *right_block = ir_block_new(lowering);
+    struct ir_block *short_block = ir_block_new(lowering);
+    struct ir_block *end_block = ir_block_new(lowering);
+
+    struct ir_operand left = ir_lower_exp(lowering, node->exp.left);
+    if (is_and)
+    {
+        ir_emit_branch(lowering, left, right_block, short_block);
+    }
+    else
+    {
+        ir_emit_branch(lowering, left, short_block, right_block);
+    }
+
+    ir_place_block(lowering, right_block);
+    struct ir_operand right = ir_lower_exp(lowering, node->exp.right);
+    ir_emit_move(lowering, dst, ir_emit_value(lowering, IR_OP_NE, right.type, right, ir_operand_constant(0)));
+    ir_emit_jump(lowering, end_block);
+
+    ir_place_block(lowering, short_block);
+    ir_emit_move(lowering, dst, ir_operand_constant(is_and ? 0 : 1));
+    ir_emit_jump(lowering, end_block);
+
+    ir_place_block(lowering, end_block);
+    return ir_operand_vreg(dst, ir_type_int);
+}
+
+static struct ir_operand ir_lower_tenary(struct ir_lowering *lowering, struct node *node)
+{
+    struct node *tenary = node->exp.right;
+    int dst = ir_vreg_new(lowering);
+    struct ir_block *true_block = ir_block_new(lowering);
+    struct ir_block *false_block = ir_block_new(lowering);
+    struct ir_block *end_block = ir_block_new(lowering);
+
+    ir_emit_branch(lowering, ir_lower_exp(lowering, node->exp.left), true_block, false_block);
+
+    ir_place_block(lowering, true_block);
+    struct ir_operand true_value = ir_lower_exp(lowering, tenary->tenary.true_node);
+    ir_emit_move(lowering, dst, true_value);
+    ir_emit_jump(lowering, end_block);
+
+    ir_place_block(lowering, false_block);
+    struct ir_operand false_value = ir_lower_exp(lowering, tenary->tenary.false_node);
+    ir_emit_move(lowering, dst, false_value);
+    ir_emit_jump(lowering, end_block);
+
+    ir_place_block(lowering, end_block);
+    return ir_operand_vreg(dst, ir_type_for_binary(true_value, false_value));
+}
+
+static void ir_lower_call_arguments(struct ir_lowering *lowering, struct node *node, struct vector *arguments)
+{
+    if (!node_valid(node))
+    {
+        return;
+    }
+
+    if (is_argument_node(node))
+    {
+        ir_lower_call_arguments(lowering, node->exp.left, arguments);
+        ir_lower_call_arguments(lowering, node->exp.right, arguments);
+        return;
+    }
+
+    if (node->type == NODE_TYPE_EXPRESSION_PARENTHESIS)
+    {
+        ir_lower_call_arguments(lowering, node->parenthesis.exp, arguments);
+        return;
+    }
+
+    struct ir_operand argument = ir_lower_exp(lowering, node);
+    vector_push(arguments, &argument);
+}
+
+static struct ir_operand ir_lower_call(struct ir_lowering *lowering, struct node *node)
+{
+    struct symbol *sym = node->exp.left->type == NODE_TYPE_IDENTIFIER ? symresolver_get_symbol(lowering->process, node->exp.left->sval) : NULL;
+    struct node *func_node = sym && sym->type == SYMBOL_TYPE_NODE ? sym->data : NULL;
+    if (!func_node || func_node->type != NODE_TYPE_FUNCTION || func_node->func.flags & FUNCTION_NODE_FLAG_IS_NATIVE)
+    {
+        ir_unsupported(lowering, "call to something other than a function");
+        return ir_operand_none();
+    }
+
+    struct datatype *rtype = &func_node->func.rtype;
+    if (rtype->type != DATA_TYPE_VOID && !ir_datatype_supported(rtype))
+    {
+        ir_unsupported(lowering, "call to a function that does not return an integer");
+        return ir_operand_none();
+    }
+
+    struct vector *arguments = vector_create(sizeof(struct ir_operand));
+    ir_lower_call_arguments(lowering, node->exp.right, arguments);
+
+    struct ir_type type = rtype->type == DATA_TYPE_VOID ? ir_type_int : ir_type_for_datatype(rtype);
+    struct ir_instruction *instruction = ir_emit(lowering, &(struct ir_instruction){.op = IR_OP_CALL, .type = type, .dst = ir_vreg_new(lowering), .function = func_node->func.name, .arguments = arguments});
+    return ir_operand_vreg(instruction->dst, (struct ir_type){DATA_SIZE_DWORD, type.is_signed});
+}
+
+/**
+ * Lowers "a = b" and the compound assignments such as "a += b"
+ */
+static struct ir_operand ir_lower_assignment(struct ir_lowering *lowering, struct node *node)
+{
+    struct ir_variable *variable = ir_variable_for_node(lowering, node->exp.left);
+    if (!variable)
+    {
+        return ir_operand_none();
+    }
+
+    struct ir_operand value = ir_lower_exp(lowering, node->exp.right);
+    if (!S_EQ(node->exp.op, "="))
+    {
+        // "+=" is "+" and so on
+        char op[4] = {};
+        strncpy(op, node->exp.op, strlen(node->exp.op) - 1);
+        int ir_op = ir_binary_op(op);
+        if (ir_op == -1)
+        {
+            ir_unsupported(lowering, "assignment operator");
+            return ir_operand_none();
+        }
+
+        struct ir_operand current = ir_load(lowering, variable);
+        value = ir_emit_value(lowering, ir_op, ir_type_for_binary(current, value), current, value);
+    }
+
+    ir_store(lowering, variable, value);
+    if (variable->type.size < DATA_SIZE_DWORD)
+    {
+        // The value of the assignment is what was stored
+        return ir_emit_value(lowering, IR_OP_TRUNCATE, variable->type, value, ir_operand_none());
+    }
+    return value;
+}
+
+static struct ir_operand ir_lower_exp_node(struct ir_lowering *lowering, struct node *node)
+{
+    const char *op = node->exp.op;
+    if (S_EQ(op, "()"))
+    {
+        return ir_lower_call(lowering, node);
+    }
+
+    if (S_EQ(op, "?"))
+    {
+        return ir_lower_tenary(lowering, node);
+    }
+
+    if (S_EQ(op, "&&") || S_EQ(op, "||"))
+    {
+        return ir_lower_logical(lowering, node);
+    }
+
+    if (S_EQ(op, ","))
+    {
+        ir_lower_exp(lowering, node->exp.left);
+        return ir_lower_exp(lowering, node->exp.right);
+    }
+
+    if (is_node_assignment(node))
+    {
+        return ir_lower_assignment(lowering, node);
+    }
+
+    int ir_op = ir_binary_op(op);
+    if (ir_op == -1)
+    {
+        ir_unsupported(lowering, "operator");
+        return ir_operand_none();
+    }
+
+    struct ir_operand left = ir_lower_exp(lowering, node->exp.left);
+    struct ir_operand right = ir_lower_exp(lowering, node->exp.right);
+    return ir_emit_value(lowering, ir_op, ir_type_for_binary(left, right), left, right);
+}
+
+static struct ir_operand ir_lower_increment(struct ir_lowering *lowering, struct node *node)
+{
+    struct ir_variable *variable = ir_variable_for_node(lowering, node->unary.operand);
+    if (!variable)
+    {
+        return ir_operand_none();
+    }
+
+    struct ir_operand before = ir_load(lowering, variable);
+    int ir_op = S_EQ(node->unary.op, "++") ? IR_OP_ADD : IR_OP_SUB;
+    struct ir_operand after = ir_emit_value(lowering, ir_op, before.type, before, ir_operand_constant(1));
+    ir_store(lowering, variable, after);
+
+    // x++ is the value before it was incremented
+    return node->unary.flags & UNARY_FLAG_IS_RIGHT_OPERANDED_UNARY ? before : after;
+}
+
+static struct ir_operand ir_lower_unary(struct ir_lowering *lowering, struct node *node)
+{
+    const char *op = node->unary.op;
+    if (S_EQ(op, "++") || S_EQ(op, "--"))
+    {
+        return ir_lower_increment(lowering, node);
+    }
+
+    struct ir_operand operand = ir_lower_exp(lowering, node->unary.operand);
+    if (S_EQ(op, "-"))
+    {
+        return ir_emit_value(lowering, IR_OP_NEG, operand.type, operand, ir_operand_none());
+    }
+
+    if (S_EQ(op, "~"))
+    {
+        return ir_emit_value(lowering, IR_OP_NOT, operand.type, operand, ir_operand_none());
+    }
+
+    if (S_EQ(op, "!"))
+    {
+        return ir_emit_value(lowering, IR_OP_EQ, operand.type, operand, ir_operand_constant(0));
+    }
+
+    ir_unsupported(lowering, "unary operator");
+    return ir_operand_none();
+}
+
+static struct ir_operand ir_lower_exp(struct ir_lowering *lowering, struct node *node)
+{
+    switch (node->type)
+    {
+    case NODE_TYPE_NUMBER:
+        return ir_operand_constant((int)node->llnum);
+
+    case NODE_TYPE_IDENTIFIER:
+    {
+        struct ir_variable *variable = ir_variable_for_node(lowering, node);
+        return variable ? ir_load(lowering, variable) : ir_operand_none();
+    }
+
+    case NODE_TYPE_EXPRESSION:
+        return ir_lower_exp_node(lowering, node);
+
+    case NODE_TYPE_EXPRESSION_PARENTHESIS:
+        return ir_lower_exp(lowering, node->parenthesis.exp);
+
+    case NODE_TYPE_UNARY:
+        return ir_lower_unary(lowering, node);
+
+    case NODE_TYPE_CAST:
+    {
+        struct ir_operand operand = ir_lower_exp(lowering, node->cast.operand);
+        if (!ir_datatype_supported(&node->cast.dtype))
+        {
+            ir_unsupported(lowering, "cast to something other than an integer");
+            return ir_operand_none();
+        }
+
+        struct ir_type type = ir_type_for_datatype(&node->cast.dtype);
+        if (type.size == DATA_SIZE_DWORD)
+        {
+            operand.type = type;
+            return operand;
+        }
+        return ir_emit_value(lowering, IR_OP_TRUNCATE, type, operand, ir_operand_none());
+    }
+    }
+
+    ir_unsupported(lowering, "expression");
+    return ir_operand_none();
+}
+
+static void ir_lower_statement(struct ir_lowering *lowering, struct node *node);
+
+static void ir_lower_body(struct ir_lowering *lowering, struct node *node)
+{
+    if (node->type != NODE_TYPE_BODY)
+    {
+        ir_lower_statement(lowering, node);
+        return;
+    }
+
+    // Variables declared in the body go out of scope at its end
+    int scope_start = vector_count(lowering->scope);
+    vector_set_peek_pointer(node->body.statements, 0);
+    for (int i = 0; i < vector_count(node->body.statements); i++)
+    {
+        ir_lower_statement(lowering, *(struct node **)vector_at(node->body.statements, i));
+    }
+
+    while (vector_count(lowering->scope) > scope_start)
+    {
+        vector_pop(lowering->scope);
+    }
+}
+
+static void ir_lower_variable(struct ir_lowering *lowering, struct node *node)
+{
+    struct ir_variable *variable = ir_variable_new(lowering, node, IR_VARIABLE_LOCAL);
+    if (variable->type.size == 0)
+    {
+        ir_unsupported(lowering, "variable that is not an integer");
+        return;
+    }
+
+    vector_push(lowering->scope, &variable);
+    if (node->var.val)
+    {
+        ir_store(lowering, variable, ir_lower_exp(lowering, node->var.val));
+    }
+}
+
+static void ir_lower_if(struct ir_lowering *lowering, struct node *node)
+{
+    struct ir_block *true_block = ir_block_new(lowering);
+    struct ir_block *false_block = ir_block_new(lowering);
+    struct ir_block *end_block = node->stmt._if.next ? ir_block_new(lowering) : false_block;
+
+    ir_emit_branch(lowering, ir_lower_exp(lowering, node->stmt._if.cond_node), true_block, false_block);
+
+    ir_place_block(lowering, true_block);
+    ir_lower_body(lowering, node->stmt._if.body_node);
+    if (!node->stmt._if.next)
+    {
+        ir_begin_block(lowering, end_block);
+        return;
+    }
+
+    ir_jump_unless_terminated(lowering, end_block);
+
+    ir_place_block(lowering, false_block);
+    struct node *next = node->stmt._if.next;
+    if (next->type == NODE_TYPE_STATEMENT_ELSE)
+    {
+        ir_lower_body(lowering, next->stmt._else.body_node);
+    }
+    else
+    {
+        ir_lower_if(lowering, next);
+    }
+    ir_begin_block(lowering, end_block);
+}
+
+/**
+ * Lowers the loop body with break and continue going to the blocks given
+ */
+static void ir_lower_loop_body(struct ir_lowering *lowering, struct node *body, struct ir_block *break_block, struct ir_block *continue_block)
+{
+    vector_push(lowering->break_targets, &break_block);
+    vector_push(lowering->continue_targets, &continue_block);
+    ir_lower_body(lowering, body);
+    vector_pop(lowering->break_targets);
+    vector_pop(lowering->continue_targets);
+}
+
+static void ir_lower_while(struct ir_lowering *lowering, struct node *node)
+{
+    struct ir_block *cond_block = ir_block_new(lowering);
+    struct ir_block *body_block = ir_block_new(lowering);
+    struct ir_block *end_block = ir_block_new(lowering);
+
+    ir_begin_block(lowering, cond_block);
+    ir_emit_branch(lowering, ir_lower_exp(lowering, node->stmt._while.cond), body_block, end_block);
+
+    ir_place_block(lowering, body_block);
+    ir_lower_loop_body(lowering, node->stmt._while.body, end_block, cond_block);
+    ir_jump_unless_terminated(lowering, cond_block);
+    ir_place_block(lowering, end_block);
+}
+
+static void ir_lower_do_while(struct ir_lowering *lowering, struct node *node)
+{
+    struct ir_block *body_block = ir_block_new(lowering);
+    struct ir_block *cond_block = ir_block_new(lowering);
+    struct ir_block *end_block = ir_block_new(lowering);
+
+    ir_begin_block(lowering, body_block);
+    ir_lower_loop_body(lowering, node->stmt._do_while.body, end_block, cond_block);
+
+    ir_begin_block(lowering, cond_block);
+    ir_emit_branch(lowering, ir_lower_exp(lowering, node->stmt._do_while.cond), body_block, end_block);
+    ir_place_block(lowering, end_block);
+}
+
+static void ir_lower_for(struct ir_lowering *lowering, struct node *node)
+{
+    struct ir_block *cond_block = ir_block_new(lowering);
+    struct ir_block *body_block = ir_block_new(lowering);
+    struct ir_block *loop_block = ir_block_new(lowering);
+    struct ir_block *end_block = ir_block_new(lowering);
+
+    if (node_valid(node->stmt._for.init))
+    {
+        ir_lower_exp(lowering, node->stmt._for.init);
+    }
+
+    ir_begin_block(lowering, cond_block);
+    if (node_valid(node->stmt._for.cond))
+    {
+        ir_emit_branch(lowering, ir_lower_exp(lowering, node->stmt._for.cond), body_block, end_block);
+    }
+
+    ir_begin_block(lowering, body_block);
+    ir_lower_loop_body(lowering, node->stmt._for.body, end_block, loop_block);
+
+    ir_begin_block(lowering, loop_block);
+    if (node_valid(node->stmt._for.loop))
+    {
+        ir_lower_exp(lowering, node->stmt._for.loop);
+    }
+    ir_emit_jump(lowering, cond_block);
+    ir_place_block(lowering, end_block);
+}
+
+static void ir_lower_loop_exit(struct ir_lowering *lowering, struct vector *targets)
+{
+    struct ir_block **target = vector_back_or_null(targets);
+    if (!target)
+    {
+        ir_unsupported(lowering, "break or continue outside of a loop");
+        return;
+    }
+    ir_emit_jump(lowering, *target);
+}
+
+static void ir_lower_return(struct ir_lowering *lowering, struct node *node)
+{
+    struct ir_operand value = ir_operand_none();
+    if (node->stmt.ret.exp)
+    {
+        value = ir_lower_exp(lowering, node->stmt.ret.exp);
+    }
+    ir_emit(lowering, &(struct ir_instruction){.op = IR_OP_RETURN, .dst = -1, .operands = {value}});
+}
+
+static void ir_lower_statement(struct ir_lowering *lowering, struct node *node)
+{
+    struct ir_operand value = ir_operand_none();
+    switch (node->type)
+    {
+    case NODE_TYPE_BODY:
+        ir_lower_body(lowering, node);
+        break;
+
+    case NODE_TYPE_VARIABLE:
+        ir_lower_variable(lowering, node);
+        break;
+
+    case NODE_TYPE_VARIABLE_LIST:
+        for (int i = 0; i < vector_count(node->var_list.list); i++)
+        {
+            ir_lower_variable(lowering, *(struct node **)vector_at(node->var_list.list, i));
+        }
+        break;
+
+    case NODE_TYPE_STATEMENT_RETURN:
+        ir_lower_return(lowering, node);
+        break;
+
+    case NODE_TYPE_STATEMENT_IF:
+        ir_lower_if(lowering, node);
+        break;
+
+    case NODE_TYPE_STATEMENT_WHILE:
+        ir_lower_while(lowering, node);
+        break;
+
+    case NODE_TYPE_STATEMENT_DO_WHILE:
+        ir_lower_do_while(lowering, node);
+        break;
+
+    case NODE_TYPE_STATEMENT_FOR:
+        ir_lower_for(lowering, node);
+        break;
+
+    case NODE_TYPE_STATEMENT_BREAK:
+        ir_lower_loop_exit(lowering, lowering->break_targets);
+        break;
+
+    case NODE_TYPE_STATEMENT_CONTINUE:
+        ir_lower_loop_exit(lowering, lowering->continue_targets);
+        break;
+
+    case NODE_TYPE_BLANK:
+        break;
+
+    case NODE_TYPE_EXPRESSION:
+    case NODE_TYPE_EXPRESSION_PARENTHESIS:
+    case NODE_TYPE_UNARY:
+    case NODE_TYPE_IDENTIFIER:
+    case NODE_TYPE_NUMBER:
+    case NODE_TYPE_CAST:
+        value = ir_lower_exp(lowering, node);
+        break;
+
+    default:
+        ir_unsupported(lowering, "statement");
+    }
+    lowering->last_value = value;
+}
+
+struct ir_function *ir_lower_function(struct compile_process *process, struct node *func_node, const char **reason_out)
+{
+    struct ir_function *function = calloc(1, sizeof(struct ir_function));
+    function->node = func_node;
+    function->name = func_node->func.name;
+    function->blocks = vector_create(sizeof(struct ir_block *));
+    function->variables = vector_create(sizeof(struct ir_variable *));
+
+    struct ir_lowering lowering = {};
+    lowering.process = process;
+    lowering.function = function;
+    lowering.scope = vector_create(sizeof(struct ir_variable *));
+    lowering.break_targets = vector_create(sizeof(struct ir_block *));
+    lowering.continue_targets = vector_create(sizeof(struct ir_block *));
+    ir_place_block(&lowering, ir_block_new(&lowering));
+
+    if (!ir_datatype_supported(&func_node->func.rtype) && func_node->func.rtype.type != DATA_TYPE_VOID)
+    {
+        ir_unsupported(&lowering, "function that does not return an integer");
+    }
+
+    struct vector *arguments = function_node_argument_vec(func_node);
+    for (int i = 0; i < vector_count(arguments); i++)
+    {
+        struct ir_variable *variable = ir_variable_new(&lowering, *(struct node **)vector_at(arguments, i), IR_VARIABLE_ARGUMENT);
+        vector_push(lowering.scope, &variable);
+        if (variable->vreg != -1)
+        {
+            ir_emit_load(&lowering, variable->vreg, variable);
+        }
+    }
+
+    ir_lower_body(&lowering, func_node->func.body_n);
+    if (!ir_block_terminated(lowering.block))
+    {
+        struct ir_operand value = func_node->func.rtype.type != DATA_TYPE_VOID ? lowering.last_value : ir_operand_none();
+        ir_emit(&lowering, &(struct ir_instruction){.op = IR_OP_RETURN, .dst = -1, .operands = {value}});
+    }
+
+    vector_free(lowering.scope);
+    vector_free(lowering.break_targets);
+    vector_free(lowering.continue_targets);
+
+    if (lowering.unsupported)
+    {
+        *reason_out = lowering.unsupported;
+        ir_function_free(function);
+        return NULL;
+    }
+    return function;
+}
+
+void ir_function_free(struct ir_function *function)
+{
+    for (int i = 0; i < vector_count(function->blocks); i++)
+    {
+        struct ir_block *block = *(struct ir_block **)vector_at(function->blocks, i);
+        for (int j = 0; j < vector_count(block->instructions); j++)
+        {
+            struct ir_instruction *instruction = vector_at(block->instructions, j);
+            if (instruction->arguments)
+            {
+                vector_free(instruction->arguments);
+            }
+        }
+        vector_free(block->instructions);
+        free(block);
+    }
+
+    for (int i = 0; i < vector_count(function->variables); i++)
+    {
+        free(*(struct ir_variable **)vector_at(function->variables, i));
+    }
+    vector_free(function->blocks);
+    vector_free(function->variables);
+    free(function);
+}
+
+static void ir_dump_type(struct ir_type type, FILE *out)
+{
+    fprintf(out, "%c%i", type.is_signed ? 'i' : 'u', type.size * 8);
+}
+
+static void ir_dump_operand(struct ir_operand operand, FILE *out)
+{
+    switch (operand.kind)
+    {
+    case IR_OPERAND_VREG:
+        fprintf(out, "%%%i", operand.vreg);
+        break;
+    case IR_OPERAND_CONSTANT:
+        fprintf(out, "%lld", operand.constant);
+        break;
+    }
+}
+
+static void ir_dump_instruction(struct ir_instruction *instruction, FILE *out)
+{
+    fprintf(out, "    ");
+    if (instruction->dst != -1)
+    {
+        fprintf(out, "%%%i = ", instruction->dst);
+    }
+
+    fprintf(out, "%s", ir_op_names[instruction->op]);
+    if (!ir_op_is_terminator(instruction->op) && instruction->op != IR_OP_MOVE)
+    {
+        fputc('.', out);
+        ir_dump_type(instruction->type, out);
+    }
+
+    switch (instruction->op)
+    {
+    case IR_OP_LOAD:
+        fprintf(out, " %s", instruction->variable->name);
+        break;
+
+    case IR_OP_STORE:
+        fprintf(out, " %s, ", instruction->variable->name);
+        ir_dump_operand(instruction->operands[0], out);
+        break;
+
+    case IR_OP_CALL:
+        fprintf(out, " %s(", instruction->function);
+        for (int i = 0; i < vector_count(instruction->arguments); i++)
+        {
+            fprintf(out, "%s", i ? ", " : "");
+            ir_dump_operand(*(struct ir_operand *)vector_at(instruction->arguments, i), out);
+        }
+        fputc(')', out);
+        break;
+
+    case IR_OP_JUMP:
+        fprintf(out, " bb%i", instruction->targets[0]->id);
+        break;
+
+    case IR_OP_BRANCH:
+        fputc(' ', out);
+        ir_dump_operand(instruction->operands[0], out);
+        fprintf(out, ", bb%i, bb%i", instruction->targets[0]->id, instruction->targets[1]->id);
+        break;
+
+    default:
+        for (int i = 0; i < 2 && instruction->operands[i].kind != IR_OPERAND_NONE; i++)
+        {
+            fprintf(out, "%s", i ? ", " : " ");
+            ir_dump_operand(instruction->operands[i], out);
+        }
+    }
+    fputc('\n', out);
+}
+
+void ir_function_dump(struct ir_function *function, FILE *out)
+{
+    fprintf(out, "function %s\n", function->name);
+    for (int i = 0; i < vector_count(function->variables); i++)
+    {
+        struct ir_variable *variable = *(struct ir_variable **)vector_at(function->variables, i);
+        fprintf(out, "    %s %s ", ir_variable_kind_names[variable->kind], variable->name);
+        ir_dump_type(variable->type, out);
+        if (variable->kind == IR_VARIABLE_GLOBAL)
+        {
+            fputc('\n', out);
+            continue;
+        }
+        fprintf(out, " [ebp%+i]", variable->offset);
+        if (variable->vreg != -1)
+        {
+            fprintf(out, " %%%i", variable->vreg);
+        }
+        fputc('\n', out);
+    }
+
+    for (int i = 0; i < vector_count(function->blocks); i++)
+    {
+        struct ir_block *block = *(struct ir_block **)vector_at(function->blocks, i);
+        fprintf(out, "bb%i:\n", block->id);
+        for (int j = 0; j < vector_count(block->instructions); j++)
+        {
+            ir_dump_instruction(vector_at(block->instructions, j), out);
+        }
+    }
+    fputc('\n', out);
+}
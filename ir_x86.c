@@ -0,0 +1,1194 @@
+#include "compiler.h"
+#include "helpers/vector.h"
+
+/**
+ * Instruction selection and register allocation for the IR.
+ *
+ * Virtual registers get one of the six general purpose registers with a linear scan over their
+ * live intervals, the rest are spilled to slots in the stack frame. Liveness is found over the
+ * blocks first so locals held in virtual registers stay live around loops, the interval of a
+ * virtual register then runs from the first to the last instruction it is live at in block order.
+ *
+ * Selecting an instruction may need eax, ecx or edx for itself, such as div needing eax and edx.
+ * Every instruction says which registers it overwrites before it has read its operands, after
+ * it has read them and which its result cannot be in. A virtual register is never given a
+ * register that an instruction overwrites while the virtual register is live.
+ */
+#define IR_X86_TOTAL_REGISTERS 6
+#define IR_X86_NO_REGISTER -1
+
+enum
+{
+    IR_X86_EAX,
+    IR_X86_EBX,
+    IR_X86_ECX,
+    IR_X86_EDX,
+    IR_X86_ESI,
+    IR_X86_EDI
+};
+
+#define IR_X86_MASK(reg) (1 << (reg))
+
+static const char *ir_x86_registers[IR_X86_TOTAL_REGISTERS] = {"eax", "ebx", "ecx", "edx", "esi", "edi"};
+
+// Registers our callers expect to be preserved, they are saved in the frame when they are used
+#define IR_X86_CALLEE_SAVED (IR_X86_MASK(IR_X86_EBX) | IR_X86_MASK(IR_X86_ESI) | IR_X86_MASK(IR_X86_EDI))
+
+// Registers a call overwrites. Functions generated from the tree use ebx freely, so it is one of them.
+#define IR_X86_CALL_CLOBBERED (IR_X86_MASK(IR_X86_EAX) | IR_X86_MASK(IR_X86_ECX) | IR_X86_MASK(IR_X86_EDX) | IR_X86_MASK(IR_X86_EBX))
+
+// The order registers are tried in, those that do not have to be saved first
+static const int ir_x86_allocation_order[IR_X86_TOTAL_REGISTERS] = {IR_X86_ECX, IR_X86_EDX, IR_X86_EAX, IR_X86_ESI, IR_X86_EDI, IR_X86_EBX};
+
+/**
+ * Registers the instruction selected for an IR instruction overwrites
+ */
+struct ir_x86_clobbers
+{
+    // Overwritten before the operands are read, no operand can be in them
+    int early;
+    // Overwritten after the operands are read and before the result is written
+    int late;
+    // Registers the result cannot be written to
+    int dst;
+};
+
+struct ir_x86_interval
+{
+    int vreg;
+    // Position of the first and last instruction the virtual register is live at, -1 if unused
+    int start;
+    int end;
+    int uses;
+    // What spilling the virtual register costs, every read and write counts ten times more for each loop it is in
+    double weight;
+
+    // Registers the virtual register cannot be given
+    int forbidden;
+    int reg;
+    // Offset from the base pointer when the virtual register is spilled
+    int spill_offset;
+};
+
+struct ir_x86
+{
+    struct generator *generator;
+    struct ir_function *function;
+    struct ir_x86_interval *intervals;
+
+    // The callee saved registers that are used, they are restored before returning
+    int used_registers;
+    int locals_size;
+    int frame_size;
+};
+
+enum
+{
+    IR_X86_LOCATION_REGISTER,
+    IR_X86_LOCATION_MEMORY,
+    IR_X86_LOCATION_CONSTANT
+};
+
+struct ir_x86_location
+{
+    int kind;
+    char text[64];
+};
+
+#define ir_x86_push(x86, ...) (x86)->generator->asm_push(__VA_ARGS__)
+
+static struct ir_x86_clobbers ir_x86_instruction_clobbers(struct ir_instruction *instruction)
+{
+    const int eax = IR_X86_MASK(IR_X86_EAX);
+    const int ecx = IR_X86_MASK(IR_X86_ECX);
+    const int edx = IR_X86_MASK(IR_X86_EDX);
+    switch (instruction->op)
+    {
+    case IR_OP_ADD:
+    case IR_OP_SUB:
+    case IR_OP_MUL:
+    case IR_OP_AND:
+    case IR_OP_OR:
+    case IR_OP_XOR:
+    case IR_OP_EQ:
+    case IR_OP_NE:
+    case IR_OP_LT:
+    case IR_OP_LE:
+    case IR_OP_GT:
+    case IR_OP_GE:
+        // The left operand may be moved into eax before the right one is read
+        return (struct ir_x86_clobbers){.early = eax};
+
+    case IR_OP_DIV:
+    case IR_OP_MOD:
+        return (struct ir_x86_clobbers){.early = eax | ecx | edx};
+
+    case IR_OP_SHL:
+    case IR_OP_SHR:
+        // The count goes in cl before the value is read, and the result is shifted in place
+        return (struct ir_x86_clobbers){.early = ecx, .late = eax, .dst = ecx};
+
+    case IR_OP_CALL:
+        return (struct ir_x86_clobbers){.late = IR_X86_CALL_CLOBBERED};
+
+    case IR_OP_JUMP:
+    case IR_OP_BRANCH:
+        return (struct ir_x86_clobbers){};
+    }
+
+    // Moves between memory, loads, stores, unary operations, truncation and the return value go through eax
+    return (struct ir_x86_clobbers){.late = eax};
+}
+
+static bool ir_x86_instruction_reads(struct ir_instruction *instruction, int vreg)
+{
+    for (int i = 0; i < 2; i++)
+    {
+        if (instruction->operands[i].kind == IR_OPERAND_VREG && instruction->operands[i].vreg == vreg)
+        {
+            return true;
+        }
+    }
+
+    for (int i = 0; instruction->arguments && i < vector_count(instruction->arguments); i++)
+    {
+        struct ir_operand *argument = vector_at(instruction->arguments, i);
+        if (argument->kind == IR_OPERAND_VREG && argument->vreg == vreg)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void ir_x86_operand_vregs(struct ir_instruction *instruction, void (*fn)(void *data, int vreg), void *data)
+{
+    for (int i = 0; i < 2; i++)
+    {
+        if (instruction->operands[i].kind == IR_OPERAND_VREG)
+        {
+            fn(data, instruction->operands[i].vreg);
+        }
+    }
+
+    for (int i = 0; instruction->arguments && i < vector_count(instruction->arguments); i++)
+    {
+        struct ir_operand *argument = vector_at(instruction->arguments, i);
+        if (argument->kind == IR_OPERAND_VREG)
+        {
+            fn(data, argument->vreg);
+        }
+    }
+}
+
+// Sets of virtual registers are arrays of words with one bit for each
+#define IR_X86_SET_WORDS(total) (((total) + 31) / 32)
+
+static bool ir_x86_set_has(uint32_t *bits, int vreg)
+{
+    return bits[vreg / 32] & (1u << (vreg % 32));
+}
+
+static void ir_x86_set_add(uint32_t *bits, int vreg)
+{
+    bits[vreg / 32] |= 1u << (vreg % 32);
+}
+
+struct ir_x86_block_liveness
+{
+    // Read in the block before it is written
+    uint32_t *use;
+    uint32_t *def;
+    uint32_t *live_in;
+    uint32_t *live_out;
+    int first;
+    int last;
+};
+
+static void ir_x86_record_use(void *data, int vreg)
+{
+    struct ir_x86_block_liveness *liveness = data;
+    if (!ir_x86_set_has(liveness->def, vreg))
+    {
+        ir_x86_set_add(liveness->use, vreg);
+    }
+}
+
+struct ir_x86_interval_data
+{
+    struct ir_x86 *x86;
+    int position;
+    // The cost of a read or write at the position
+    double weight;
+};
+
+static void ir_x86_interval_extend(struct ir_x86_interval *interval, int position)
+{
+    if (interval->start == -1 || position < interval->start)
+    {
+        interval->start = position;
+    }
+    if (position > interval->end)
+    {
+        interval->end = position;
+    }
+}
+
+static void ir_x86_interval_use(void *data, int vreg)
+{
+    struct ir_x86_interval_data *interval_data = data;
+    struct ir_x86_interval *interval = &interval_data->x86->intervals[vreg];
+    ir_x86_interval_extend(interval, interval_data->position);
+    interval->uses++;
+    interval->weight += interval_data->weight;
+}
+
+/**
+ * Finds the blocks each virtual register is live into and out of, iterating until nothing changes
+ */
+static struct ir_x86_block_liveness *ir_x86_liveness(struct ir_x86 *x86)
+{
+    struct ir_function *function = x86->function;
+    int total_blocks = vector_count(function->blocks);
+    int words = IR_X86_SET_WORDS(function->total_vregs);
+    struct ir_x86_block_liveness *liveness = calloc(total_blocks, sizeof(struct ir_x86_block_liveness));
+
+    int position = 0;
+    for (int i = 0; i < total_blocks; i++)
+    {
+        struct ir_block *block = *(struct ir_block **)vector_at(function->blocks, i);
+        struct ir_x86_block_liveness *block_liveness = &liveness[i];
+        block_liveness->use = calloc(words * 4 + 1, sizeof(uint32_t));
+        block_liveness->def = block_liveness->use + words;
+        block_liveness->live_in = block_liveness->def + words;
+        block_liveness->live_out = block_liveness->live_in + words;
+        block_liveness->first = position;
+        for (int j = 0; j < vector_count(block->instructions); j++, position++)
+        {
+            struct ir_instruction *instruction = vector_at(block->instructions, j);
+            ir_x86_operand_vregs(instruction, ir_x86_record_use, block_liveness);
+            if (instruction->dst != -1)
+            {
+                ir_x86_set_add(block_liveness->def, instruction->dst);
+            }
+        }
+        block_liveness->last = position - 1;
+    }
+
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        for (int i = total_blocks - 1; i >= 0; i--)
+        {
+            struct ir_block *block = *(struct ir_block **)vector_at(function->blocks, i);
+            struct ir_x86_block_liveness *block_liveness = &liveness[i];
+            struct ir_instruction *terminator = vector_back_or_null(block->instructions);
+            for (int t = 0; terminator && t < 2; t++)
+            {
+                struct ir_block *target = terminator->op != IR_OP_RETURN ? terminator->targets[t] : NULL;
+                if (!target)
+                {
+                    continue;
+                }
+
+                for (int w = 0; w < words; w++)
+                {
+                    block_liveness->live_out[w] |= liveness[target->id].live_in[w];
+                }
+            }
+
+            for (int w = 0; w < words; w++)
+            {
+                uint32_t live_in = block_liveness->use[w] | (block_liveness->live_out[w] & ~block_liveness->def[w]);
+                if (live_in != block_liveness->live_in[w])
+                {
+                    block_liveness->live_in[w] = live_in;
+                    changed = true;
+                }
+            }
+        }
+    }
+    return liveness;
+}
+
+/**
+ * Finds the interval of every virtual register, from the first to the last position it is
+ * used, written or live into or out of a block at
+ */
+static void ir_x86_build_intervals(struct ir_x86 *x86)
+{
+    struct ir_function *function = x86->function;
+    x86->intervals = calloc(function->total_vregs, sizeof(struct ir_x86_interval));
+    for (int i = 0; i < function->total_vregs; i++)
+    {
+        x86->intervals[i] = (struct ir_x86_interval){.vreg = i, .start = -1, .end = -1, .reg = IR_X86_NO_REGISTER};
+    }
+
+    struct ir_x86_block_liveness *liveness = ir_x86_liveness(x86);
+    int total_blocks = vector_count(function->blocks);
+
+    // Loops are lowered in one piece, a jump back to an earlier block closes a loop over the blocks between them
+    int *loop_depth = calloc(total_blocks, sizeof(int));
+    for (int i = 0; i < total_blocks; i++)
+    {
+        struct ir_block *block = *(struct ir_block **)vector_at(function->blocks, i);
+        struct ir_instruction *terminator = vector_back_or_null(block->instructions);
+        for (int t = 0; terminator && terminator->op != IR_OP_RETURN && t < 2; t++)
+        {
+            struct ir_block *target = terminator->targets[t];
+            for (int j = target ? target->id : i + 1; j <= i; j++)
+            {
+                loop_depth[j]++;
+            }
+        }
+    }
+
+    struct ir_x86_interval_data data = {.x86 = x86};
+    for (int i = 0; i < total_blocks; i++)
+    {
+        struct ir_block *block = *(struct ir_block **)vector_at(function->blocks, i);
+        struct ir_x86_block_liveness *block_liveness = &liveness[i];
+        for (int vreg = 0; vreg < function->total_vregs; vreg++)
+        {
+            if (ir_x86_set_has(block_liveness->live_in, vreg))
+            {
+                ir_x86_interval_extend(&x86->intervals[vreg], block_liveness->first);
+            }
+            if (ir_x86_set_has(block_liveness->live_out, vreg))
+            {
+                ir_x86_interval_extend(&x86->intervals[vreg], block_liveness->last);
+            }
+        }
+
+        data.position = block_liveness->first;
+        data.weight = 1;
+        for (int depth = 0; depth < loop_depth[i] && depth < 4; depth++)
+        {
+            data.weight *= 10;
+        }
+        for (int j = 0; j < vector_count(block->instructions); j++, data.position++)
+        {
+            struct ir_instruction *instruction = vector_at(block->instructions, j);
+            ir_x86_operand_vregs(instruction, ir_x86_interval_use, &data);
+            if (instruction->dst != -1)
+            {
+                ir_x86_interval_extend(&x86->intervals[instruction->dst], data.position);
+                x86->intervals[instruction->dst].weight += data.weight;
+            }
+        }
+        free(block_liveness->use);
+    }
+    free(loop_depth);
+    free(liveness);
+}
+
+/**
+ * Finds the registers every interval cannot be given. Within an interval every instruction
+ * is treated as one the virtual register is live across, only the first and last instruction
+ * look at whether the virtual register is read or written there.
+ */
+static void ir_x86_find_forbidden_registers(struct ir_x86 *x86)
+{
+    struct ir_function *function = x86->function;
+    struct vector *instructions = vector_create(sizeof(struct ir_instruction *));
+    for (int i = 0; i < vector_count(function->blocks); i++)
+    {
+        struct ir_block *block = *(struct ir_block **)vector_at(function->blocks, i);
+        for (int j = 0; j < vector_count(block->instructions); j++)
+        {
+            struct ir_instruction *instruction = vector_at(block->instructions, j);
+            vector_push(instructions, &instruction);
+        }
+    }
+
+    // How many instructions before each position overwrite each register
+    int total = vector_count(instructions);
+    int *before = calloc((total + 1) * IR_X86_TOTAL_REGISTERS, sizeof(int));
+    for (int p = 0; p < total; p++)
+    {
+        struct ir_x86_clobbers clobbers = ir_x86_instruction_clobbers(*(struct ir_instruction **)vector_at(instructions, p));
+        for (int reg = 0; reg < IR_X86_TOTAL_REGISTERS; reg++)
+        {
+            before[(p + 1) * IR_X86_TOTAL_REGISTERS + reg] = before[p * IR_X86_TOTAL_REGISTERS + reg] + (((clobbers.early | clobbers.late) & IR_X86_MASK(reg)) != 0);
+        }
+    }
+
+    for (int i = 0; i < function->total_vregs; i++)
+    {
+        struct ir_x86_interval *interval = &x86->intervals[i];
+        if (interval->start == -1)
+        {
+            continue;
+        }
+
+        for (int reg = 0; reg < IR_X86_TOTAL_REGISTERS; reg++)
+        {
+            int start = interval->start + 1;
+            int end = interval->end;
+            if (start < end && before[end * IR_X86_TOTAL_REGISTERS + reg] - before[start * IR_X86_TOTAL_REGISTERS + reg] > 0)
+            {
+                interval->forbidden |= IR_X86_MASK(reg);
+            }
+        }
+
+        // The first instruction, the virtual register is still needed after it unless it is also the last
+        struct ir_instruction *first = *(struct ir_instruction **)vector_at(instructions, interval->start);
+        struct ir_x86_clobbers clobbers = ir_x86_instruction_clobbers(first);
+        bool writes = first->dst == i;
+        if (ir_x86_instruction_reads(first, i))
+        {
+            interval->forbidden |= clobbers.early;
+        }
+        if (writes)
+        {
+            interval->forbidden |= clobbers.dst;
+        }
+        else if (interval->start < interval->end)
+        {
+            interval->forbidden |= clobbers.early | clobbers.late;
+        }
+
+        if (interval->start == interval->end)
+        {
+            continue;
+        }
+
+        // The last instruction, the virtual register is held until it has been read
+        struct ir_instruction *last = *(struct ir_instruction **)vector_at(instructions, interval->end);
+        clobbers = ir_x86_instruction_clobbers(last);
+        writes = last->dst == i;
+        if (ir_x86_instruction_reads(last, i) || !writes)
+        {
+            interval->forbidden |= clobbers.early;
+        }
+        if (writes)
+        {
+            interval->forbidden |= clobbers.dst;
+        }
+    }
+
+    free(before);
+    vector_free(instructions);
+}
+
+static int ir_x86_compare_intervals(const void *a, const void *b)
+{
+    const struct ir_x86_interval *interval_a = *(const struct ir_x86_interval **)a;
+    const struct ir_x86_interval *interval_b = *(const struct ir_x86_interval **)b;
+    if (interval_a->start != interval_b->start)
+    {
+        return interval_a->start - interval_b->start;
+    }
+    return interval_a->vreg - interval_b->vreg;
+}
+
+static void ir_x86_allocate_registers(struct ir_x86 *x86)
+{
+    int total_vregs = x86->function->total_vregs;
+    struct ir_x86_interval **sorted = calloc(total_vregs + 1, sizeof(struct ir_x86_interval *));
+    for (int i = 0; i < total_vregs; i++)
+    {
+        sorted[i] = &x86->intervals[i];
+    }
+    qsort(sorted, total_vregs, sizeof(struct ir_x86_interval *), ir_x86_compare_intervals);
+
+    // The interval holding each register, NULL while the register is free
+    struct ir_x86_interval *active[IR_X86_TOTAL_REGISTERS] = {};
+    for (int i = 0; i < total_vregs; i++)
+    {
+        struct ir_x86_interval *interval = sorted[i];
+        if (interval->start == -1)
+        {
+            continue;
+        }
+
+        for (int reg = 0; reg < IR_X86_TOTAL_REGISTERS; reg++)
+        {
+            if (active[reg] && active[reg]->end < interval->start)
+            {
+                active[reg] = NULL;
+            }
+        }
+
+        for (int j = 0; j < IR_X86_TOTAL_REGISTERS; j++)
+        {
+            int reg = ir_x86_allocation_order[j];
+            if (!active[reg] && !(interval->forbidden & IR_X86_MASK(reg)))
+            {
+                interval->reg = reg;
+                active[reg] = interval;
+                break;
+            }
+        }
+
+        if (interval->reg != IR_X86_NO_REGISTER)
+        {
+            continue;
+        }
+
+        // No register is free, the interval that is cheapest to spill is spilled. It may be this one.
+        struct ir_x86_interval *spill = NULL;
+        for (int reg = 0; reg < IR_X86_TOTAL_REGISTERS; reg++)
+        {
+            if (active[reg] && !(interval->forbidden & IR_X86_MASK(reg)) && active[reg]->weight < interval->weight &&
+                (!spill || active[reg]->weight < spill->weight))
+            {
+                spill = active[reg];
+            }
+        }
+
+        if (spill)
+        {
+            interval->reg = spill->reg;
+            active[spill->reg] = interval;
+            spill->reg = IR_X86_NO_REGISTER;
+        }
+    }
+
+    for (int i = 0; i < total_vregs; i++)
+    {
+        if (x86->intervals[i].reg != IR_X86_NO_REGISTER)
+        {
+            x86->used_registers |= IR_X86_MASK(x86->intervals[i].reg) & IR_X86_CALLEE_SAVED;
+        }
+    }
+
+    // Saved registers go below the locals and the spilled virtual registers below them
+    int spill_offset = x86->locals_size;
+    for (int reg = 0; reg < IR_X86_TOTAL_REGISTERS; reg++)
+    {
+        if (x86->used_registers & IR_X86_MASK(reg))
+        {
+            spill_offset += DATA_SIZE_DWORD;
+        }
+    }
+
+    for (int i = 0; i < total_vregs; i++)
+    {
+        struct ir_x86_interval *interval = &x86->intervals[i];
+        if (interval->start != -1 && interval->reg == IR_X86_NO_REGISTER)
+        {
+            spill_offset += DATA_SIZE_DWORD;
+            interval->spill_offset = spill_offset;
+        }
+    }
+
+    x86->frame_size = C_ALIGN(spill_offset);
+    free(sorted);
+}
+
+static struct ir_x86_location ir_x86_operand(struct ir_x86 *x86, struct ir_operand *operand)
+{
+    struct ir_x86_location location = {};
+    if (operand->kind == IR_OPERAND_CONSTANT)
+    {
+        location.kind = IR_X86_LOCATION_CONSTANT;
+        snprintf(location.text, sizeof(location.text), "%i", (int)operand->constant);
+        return location;
+    }
+
+    struct ir_x86_interval *interval = &x86->intervals[operand->vreg];
+    if (interval->reg != IR_X86_NO_REGISTER)
+    {
+        location.kind = IR_X86_LOCATION_REGISTER;
+        snprintf(location.text, sizeof(location.text), "%s", ir_x86_registers[interval->reg]);
+        return location;
+    }
+
+    location.kind = IR_X86_LOCATION_MEMORY;
+    snprintf(location.text, sizeof(location.text), "dword [ebp-%i]", interval->spill_offset);
+    return location;
+}
+
+static struct ir_x86_location ir_x86_dst(struct ir_x86 *x86, int vreg)
+{
+    return ir_x86_operand(x86, &(struct ir_operand){.kind = IR_OPERAND_VREG, .vreg = vreg});
+}
+
+static bool ir_x86_same_location(struct ir_x86_location *a, struct ir_x86_location *b)
+{
+    return S_EQ(a->text, b->text);
+}
+
+static void ir_x86_move(struct ir_x86 *x86, struct ir_x86_location *dst, struct ir_x86_location *src)
+{
+    if (ir_x86_same_location(dst, src))
+    {
+        return;
+    }
+
+    if (dst->kind == IR_X86_LOCATION_MEMORY && src->kind == IR_X86_LOCATION_MEMORY)
+    {
+        ir_x86_push(x86, "mov eax, %s", src->text);
+        ir_x86_push(x86, "mov %s, eax", dst->text);
+        return;
+    }
+    ir_x86_push(x86, "mov %s, %s", dst->text, src->text);
+}
+
+static struct ir_x86_location ir_x86_register_location(const char *reg)
+{
+    struct ir_x86_location location = {.kind = IR_X86_LOCATION_REGISTER};
+    snprintf(location.text, sizeof(location.text), "%s", reg);
+    return location;
+}
+
+/**
+ * Returns the register an instruction writing to dst should work in,
+ * dst itself when it is a register otherwise eax
+ */
+static struct ir_x86_location ir_x86_work_register(struct ir_x86_location *dst)
+{
+    return dst->kind == IR_X86_LOCATION_REGISTER ? *dst : ir_x86_register_location("eax");
+}
+
+static void ir_x86_variable_address(struct ir_x86 *x86, struct ir_variable *variable, char *out, size_t size)
+{
+    if (variable->kind == IR_VARIABLE_GLOBAL)
+    {
+        snprintf(out, size, "%s", variable->name);
+        return;
+    }
+    snprintf(out, size, "ebp%+i", variable->offset);
+}
+
+static const char *ir_x86_size_keyword(int size)
+{
+    switch (size)
+    {
+    case DATA_SIZE_BYTE:
+        return "byte";
+    case DATA_SIZE_WORD:
+        return "word";
+    }
+    return "dword";
+}
+
+static const char *ir_x86_eax_for_size(int size)
+{
+    switch (size)
+    {
+    case DATA_SIZE_BYTE:
+        return "al";
+    case DATA_SIZE_WORD:
+        return "ax";
+    }
+    return "eax";
+}
+
+static void ir_x86_load(struct ir_x86 *x86, struct ir_instruction *instruction)
+{
+    char address[128];
+    ir_x86_variable_address(x86, instruction->variable, address, sizeof(address));
+    struct ir_x86_location dst = ir_x86_dst(x86, instruction->dst);
+    struct ir_x86_location work = ir_x86_work_register(&dst);
+
+    int size = instruction->type.size;
+    if (size == DATA_SIZE_DWORD)
+    {
+        ir_x86_push(x86, "mov %s, dword [%s]", work.text, address);
+    }
+    else
+    {
+        ir_x86_push(x86, "%s %s, %s [%s]", instruction->type.is_signed ? "movsx" : "movzx", work.text, ir_x86_size_keyword(size), address);
+    }
+    ir_x86_move(x86, &dst, &work);
+}
+
+static void ir_x86_store(struct ir_x86 *x86, struct ir_instruction *instruction)
+{
+    char address[128];
+    ir_x86_variable_address(x86, instruction->variable, address, sizeof(address));
+    struct ir_operand *value = &instruction->operands[0];
+    struct ir_x86_location src = ir_x86_operand(x86, value);
+
+    int size = instruction->type.size;
+    if (src.kind == IR_X86_LOCATION_CONSTANT)
+    {
+        // Only the low bytes are stored, the assembler would otherwise see "mov byte [x], 300"
+        int constant = size == DATA_SIZE_BYTE ? (int8_t)value->constant : size == DATA_SIZE_WORD ? (int16_t)value->constant : (int)value->constant;
+        ir_x86_push(x86, "mov %s [%s], %i", ir_x86_size_keyword(size), address, constant);
+        return;
+    }
+
+    if (size == DATA_SIZE_DWORD && src.kind == IR_X86_LOCATION_REGISTER)
+    {
+        ir_x86_push(x86, "mov %s [%s], %s", ir_x86_size_keyword(size), address, src.text);
+        return;
+    }
+
+    // esi and edi have no byte registers, smaller stores go through eax
+    ir_x86_push(x86, "mov eax, %s", src.text);
+    ir_x86_push(x86, "mov %s [%s], %s", ir_x86_size_keyword(size), address, ir_x86_eax_for_size(size));
+}
+
+static const char *ir_x86_binary_mnemonic(int op)
+{
+    switch (op)
+    {
+    case IR_OP_ADD:
+        return "add";
+    case IR_OP_SUB:
+        return "sub";
+    case IR_OP_MUL:
+        return "imul";
+    case IR_OP_AND:
+        return "and";
+    case IR_OP_OR:
+        return "or";
+    case IR_OP_XOR:
+        return "xor";
+    }
+    return NULL;
+}
+
+static bool ir_x86_op_is_commutative(int op)
+{
+    return op == IR_OP_ADD || op == IR_OP_MUL || op == IR_OP_AND || op == IR_OP_OR || op == IR_OP_XOR;
+}
+
+static void ir_x86_binary(struct ir_x86 *x86, struct ir_instruction *instruction)
+{
+    struct ir_operand *a = &instruction->operands[0];
+    struct ir_operand *b = &instruction->operands[1];
+    struct ir_x86_location dst = ir_x86_dst(x86, instruction->dst);
+    struct ir_x86_location b_location = ir_x86_operand(x86, b);
+    if (ir_x86_op_is_commutative(instruction->op) && (ir_x86_same_location(&dst, &b_location) || a->kind == IR_OPERAND_CONSTANT))
+    {
+        // "dst = a + dst" is "dst += a"
+        struct ir_operand *temp = a;
+        a = b;
+        b = temp;
+    }
+
+    struct ir_x86_location a_location = ir_x86_operand(x86, a);
+    b_location = ir_x86_operand(x86, b);
+    struct ir_x86_location work = ir_x86_work_register(&dst);
+    if (ir_x86_same_location(&work, &b_location))
+    {
+        work = ir_x86_register_location("eax");
+    }
+
+    ir_x86_move(x86, &work, &a_location);
+    ir_x86_push(x86, "%s %s, %s", ir_x86_binary_mnemonic(instruction->op), work.text, b_location.text);
+    ir_x86_move(x86, &dst, &work);
+}
+
+static void ir_x86_divide(struct ir_x86 *x86, struct ir_instruction *instruction)
+{
+    struct ir_operand *b = &instruction->operands[1];
+    struct ir_x86_location a_location = ir_x86_operand(x86, &instruction->operands[0]);
+    struct ir_x86_location b_location = ir_x86_operand(x86, b);
+    struct ir_x86_location dst = ir_x86_dst(x86, instruction->dst);
+
+    ir_x86_push(x86, "mov eax, %s", a_location.text);
+    if (b->kind == IR_OPERAND_CONSTANT)
+    {
+        // div has no immediate form
+        ir_x86_push(x86, "mov ecx, %s", b_location.text);
+        b_location = ir_x86_register_location("ecx");
+    }
+
+    if (instruction->type.is_signed)
+    {
+        ir_x86_push(x86, "cdq");
+        ir_x86_push(x86, "idiv %s", b_location.text);
+    }
+    else
+    {
+        ir_x86_push(x86, "xor edx, edx");
+        ir_x86_push(x86, "div %s", b_location.text);
+    }
+
+    struct ir_x86_location result = ir_x86_register_location(instruction->op == IR_OP_MOD ? "edx" : "eax");
+    ir_x86_move(x86, &dst, &result);
+}
+
+static void ir_x86_shift(struct ir_x86 *x86, struct ir_instruction *instruction)
+{
+    struct ir_operand *b = &instruction->operands[1];
+    struct ir_x86_location a_location = ir_x86_operand(x86, &instruction->operands[0]);
+    struct ir_x86_location dst = ir_x86_dst(x86, instruction->dst);
+    struct ir_x86_location work = ir_x86_work_register(&dst);
+    const char *mnemonic = instruction->op == IR_OP_SHL ? "shl" : instruction->type.is_signed ? "sar"
+                                                                                               : "shr";
+
+    if (b->kind == IR_OPERAND_CONSTANT)
+    {
+        ir_x86_move(x86, &work, &a_location);
+        ir_x86_push(x86, "%s %s, %i", mnemonic, work.text, (int)(b->constant & 31));
+    }
+    else
+    {
+        struct ir_x86_location b_location = ir_x86_operand(x86, b);
+        ir_x86_push(x86, "mov ecx, %s", b_location.text);
+        ir_x86_move(x86, &work, &a_location);
+        ir_x86_push(x86, "%s %s, cl", mnemonic, work.text);
+    }
+    ir_x86_move(x86, &dst, &work);
+}
+
+static const char *ir_x86_condition(int op, bool is_signed)
+{
+    switch (op)
+    {
+    case IR_OP_EQ:
+        return "e";
+    case IR_OP_NE:
+        return "ne";
+    case IR_OP_LT:
+        return is_signed ? "l" : "b";
+    case IR_OP_LE:
+        return is_signed ? "le" : "be";
+    case IR_OP_GT:
+        return is_signed ? "g" : "a";
+    case IR_OP_GE:
+        return is_signed ? "ge" : "ae";
+    }
+    return NULL;
+}
+
+static int ir_x86_inverse_comparison(int op)
+{
+    switch (op)
+    {
+    case IR_OP_EQ:
+        return IR_OP_NE;
+    case IR_OP_NE:
+        return IR_OP_EQ;
+    case IR_OP_LT:
+        return IR_OP_GE;
+    case IR_OP_LE:
+        return IR_OP_GT;
+    case IR_OP_GT:
+        return IR_OP_LE;
+    case IR_OP_GE:
+        return IR_OP_LT;
+    }
+    return op;
+}
+
+/**
+ * Compares the operands of the instruction, the left operand goes in eax when cmp cannot take it as it is
+ */
+static void ir_x86_compare(struct ir_x86 *x86, struct ir_instruction *instruction)
+{
+    struct ir_x86_location a_location = ir_x86_operand(x86, &instruction->operands[0]);
+    struct ir_x86_location b_location = ir_x86_operand(x86, &instruction->operands[1]);
+    if (a_location.kind == IR_X86_LOCATION_CONSTANT || (a_location.kind == IR_X86_LOCATION_MEMORY && b_location.kind == IR_X86_LOCATION_MEMORY))
+    {
+        ir_x86_push(x86, "mov eax, %s", a_location.text);
+        a_location = ir_x86_register_location("eax");
+    }
+    ir_x86_push(x86, "cmp %s, %s", a_location.text, b_location.text);
+}
+
+static void ir_x86_set_condition(struct ir_x86 *x86, struct ir_instruction *instruction)
+{
+    struct ir_x86_location dst = ir_x86_dst(x86, instruction->dst);
+    struct ir_x86_location work = ir_x86_work_register(&dst);
+    ir_x86_compare(x86, instruction);
+    ir_x86_push(x86, "set%s al", ir_x86_condition(instruction->op, instruction->type.is_signed));
+    ir_x86_push(x86, "movzx %s, al", work.text);
+    ir_x86_move(x86, &dst, &work);
+}
+
+static void ir_x86_unary(struct ir_x86 *x86, struct ir_instruction *instruction)
+{
+    struct ir_x86_location a_location = ir_x86_operand(x86, &instruction->operands[0]);
+    struct ir_x86_location dst = ir_x86_dst(x86, instruction->dst);
+    struct ir_x86_location work = ir_x86_work_register(&dst);
+    ir_x86_move(x86, &work, &a_location);
+    ir_x86_push(x86, "%s %s", instruction->op == IR_OP_NEG ? "neg" : "not", work.text);
+    ir_x86_move(x86, &dst, &work);
+}
+
+static void ir_x86_truncate(struct ir_x86 *x86, struct ir_instruction *instruction)
+{
+    struct ir_x86_location a_location = ir_x86_operand(x86, &instruction->operands[0]);
+    struct ir_x86_location dst = ir_x86_dst(x86, instruction->dst);
+    struct ir_x86_location work = ir_x86_work_register(&dst);
+    struct ir_x86_location eax = ir_x86_register_location("eax");
+    ir_x86_move(x86, &eax, &a_location);
+    ir_x86_push(x86, "%s %s, %s", instruction->type.is_signed ? "movsx" : "movzx", work.text, ir_x86_eax_for_size(instruction->type.size));
+    ir_x86_move(x86, &dst, &work);
+}
+
+static void ir_x86_call(struct ir_x86 *x86, struct ir_instruction *instruction)
+{
+    int total_arguments = vector_count(instruction->arguments);
+    for (int i = total_arguments - 1; i >= 0; i--)
+    {
+        struct ir_x86_location argument = ir_x86_operand(x86, vector_at(instruction->arguments, i));
+        ir_x86_push(x86, "push %s", argument.text);
+    }
+
+    ir_x86_push(x86, "call %s", instruction->function);
+    if (total_arguments)
+    {
+        ir_x86_push(x86, "add esp, %i", total_arguments * DATA_SIZE_DWORD);
+    }
+
+    if (x86->intervals[instruction->dst].uses == 0)
+    {
+        return;
+    }
+
+    struct ir_x86_location dst = ir_x86_dst(x86, instruction->dst);
+    struct ir_x86_location eax = ir_x86_register_location("eax");
+    if (instruction->type.size < DATA_SIZE_DWORD)
+    {
+        // Only the low bytes of eax are the return value
+        ir_x86_push(x86, "%s eax, %s", instruction->type.is_signed ? "movsx" : "movzx", ir_x86_eax_for_size(instruction->type.size));
+    }
+    ir_x86_move(x86, &dst, &eax);
+}
+
+static void ir_x86_block_label(struct ir_x86 *x86, struct ir_block *block, char *out, size_t size)
+{
+    snprintf(out, size, ".bb%i", block->id);
+}
+
+/**
+ * Jumps to the block unless it is the next one, then we fall through to it
+ */
+static void ir_x86_jump(struct ir_x86 *x86, struct ir_block *target, struct ir_block *next)
+{
+    if (target == next)
+    {
+        return;
+    }
+
+    char label[32];
+    ir_x86_block_label(x86, target, label, sizeof(label));
+    ir_x86_push(x86, "jmp %s", label);
+}
+
+/**
+ * Jumps to the targets of the branch, the condition is true when cmp set the condition code
+ */
+static void ir_x86_branch_on_condition(struct ir_x86 *x86, struct ir_instruction *branch, int op, bool is_signed, struct ir_block *next)
+{
+    struct ir_block *if_true = branch->targets[0];
+    struct ir_block *if_false = branch->targets[1];
+    if (if_true == next)
+    {
+        // Jump to the false block when the condition does not hold and fall through otherwise
+        struct ir_block *temp = if_true;
+        if_true = if_false;
+        if_false = temp;
+        op = ir_x86_inverse_comparison(op);
+    }
+
+    char label[32];
+    ir_x86_block_label(x86, if_true, label, sizeof(label));
+    ir_x86_push(x86, "j%s %s", ir_x86_condition(op, is_signed), label);
+    ir_x86_jump(x86, if_false, next);
+}
+
+static void ir_x86_branch(struct ir_x86 *x86, struct ir_instruction *instruction, struct ir_block *next)
+{
+    struct ir_operand *cond = &instruction->operands[0];
+    if (cond->kind == IR_OPERAND_CONSTANT)
+    {
+        ir_x86_jump(x86, instruction->targets[cond->constant ? 0 : 1], next);
+        return;
+    }
+
+    struct ir_x86_location location = ir_x86_operand(x86, cond);
+    ir_x86_push(x86, "cmp %s, 0", location.text);
+    ir_x86_branch_on_condition(x86, instruction, IR_OP_NE, true, next);
+}
+
+static void ir_x86_return(struct ir_x86 *x86, struct ir_instruction *instruction, bool is_last)
+{
+    if (instruction->operands[0].kind != IR_OPERAND_NONE)
+    {
+        struct ir_x86_location value = ir_x86_operand(x86, &instruction->operands[0]);
+        struct ir_x86_location eax = ir_x86_register_location("eax");
+        ir_x86_move(x86, &eax, &value);
+    }
+
+    if (!is_last)
+    {
+        ir_x86_push(x86, "jmp .exit");
+    }
+}
+
+/**
+ * Returns true if the comparison is only used by the branch after it,
+ * the branch can then use the flags of the comparison directly
+ */
+static bool ir_x86_fuses_with_branch(struct ir_x86 *x86, struct ir_instruction *instruction, struct ir_instruction *next)
+{
+    return ir_x86_condition(instruction->op, true) && next && next->op == IR_OP_BRANCH &&
+           next->operands[0].kind == IR_OPERAND_VREG && next->operands[0].vreg == instruction->dst &&
+           x86->intervals[instruction->dst].uses == 1;
+}
+
+static void ir_x86_instruction(struct ir_x86 *x86, struct ir_instruction *instruction)
+{
+    switch (instruction->op)
+    {
+    case IR_OP_MOVE:
+    {
+        struct ir_x86_location dst = ir_x86_dst(x86, instruction->dst);
+        struct ir_x86_location src = ir_x86_operand(x86, &instruction->operands[0]);
+        ir_x86_move(x86, &dst, &src);
+    }
+    break;
+
+    case IR_OP_LOAD:
+        ir_x86_load(x86, instruction);
+        break;
+
+    case IR_OP_STORE:
+        ir_x86_store(x86, instruction);
+        break;
+
+    case IR_OP_ADD:
+    case IR_OP_SUB:
+    case IR_OP_MUL:
+    case IR_OP_AND:
+    case IR_OP_OR:
+    case IR_OP_XOR:
+        ir_x86_binary(x86, instruction);
+        break;
+
+    case IR_OP_DIV:
+    case IR_OP_MOD:
+        ir_x86_divide(x86, instruction);
+        break;
+
+    case IR_OP_SHL:
+    case IR_OP_SHR:
+        ir_x86_shift(x86, instruction);
+        break;
+
+    case IR_OP_EQ:
+    case IR_OP_NE:
+    case IR_OP_LT:
+    case IR_OP_LE:
+    case IR_OP_GT:
+    case IR_OP_GE:
+        ir_x86_set_condition(x86, instruction);
+        break;
+
+    case IR_OP_NEG:
+    case IR_OP_NOT:
+        ir_x86_unary(x86, instruction);
+        break;
+
+    case IR_OP_TRUNCATE:
+        ir_x86_truncate(x86, instruction);
+        break;
+
+    case IR_OP_CALL:
+        ir_x86_call(x86, instruction);
+        break;
+    }
+}
+
+static void ir_x86_block(struct ir_x86 *x86, struct ir_block *block, struct ir_block *next)
+{
+    char label[32];
+    ir_x86_block_label(x86, block, label, sizeof(label));
+    ir_x86_push(x86, "%s:", label);
+
+    int total_instructions = vector_count(block->instructions);
+    for (int i = 0; i < total_instructions; i++)
+    {
+        struct ir_instruction *instruction = vector_at(block->instructions, i);
+        struct ir_instruction *following = i + 1 < total_instructions ? vector_at(block->instructions, i + 1) : NULL;
+        if (ir_x86_fuses_with_branch(x86, instruction, following))
+        {
+            ir_x86_compare(x86, instruction);
+            ir_x86_branch_on_condition(x86, following, instruction->op, instruction->type.is_signed, next);
+            break;
+        }
+
+        switch (instruction->op)
+        {
+        case IR_OP_JUMP:
+            ir_x86_jump(x86, instruction->targets[0], next);
+            break;
+
+        case IR_OP_BRANCH:
+            ir_x86_branch(x86, instruction, next);
+            break;
+
+        case IR_OP_RETURN:
+            ir_x86_return(x86, instruction, !next);
+            break;
+
+        default:
+            ir_x86_instruction(x86, instruction);
+        }
+    }
+}
+
+static void ir_x86_prologue(struct ir_x86 *x86)
+{
+    ir_x86_push(x86, "push ebp");
+    ir_x86_push(x86, "mov ebp, esp");
+    if (x86->frame_size)
+    {
+        ir_x86_push(x86, "sub esp, %i", x86->frame_size);
+    }
+
+    int offset = x86->locals_size;
+    for (int reg = 0; reg < IR_X86_TOTAL_REGISTERS; reg++)
+    {
+        if (x86->used_registers & IR_X86_MASK(reg))
+        {
+            offset += DATA_SIZE_DWORD;
+            ir_x86_push(x86, "mov dword [ebp-%i], %s", offset, ir_x86_registers[reg]);
+        }
+    }
+}
+
+static void ir_x86_epilogue(struct ir_x86 *x86)
+{
+    ir_x86_push(x86, ".exit:");
+    int offset = x86->locals_size;
+    for (int reg = 0; reg < IR_X86_TOTAL_REGISTERS; reg++)
+    {
+        if (x86->used_registers & IR_X86_MASK(reg))
+        {
+            offset += DATA_SIZE_DWORD;
+            ir_x86_push(x86, "mov %s, dword [ebp-%i]", ir_x86_registers[reg], offset);
+        }
+    }
+
+    if (x86->frame_size)
+    {
+        ir_x86_push(x86, "add esp, %i", x86->frame_size);
+    }
+    ir_x86_push(x86, "pop ebp");
+    ir_x86_push(x86, "ret");
+}
+
+void ir_x86_generate_function(struct generator *generator, struct ir_function *function)
+{
+    struct ir_x86 x86 = {};
+    x86.generator = generator;
+    x86.function = function;
+    x86.locals_size = C_ALIGN(function_node_stack_size(function->node));
+
+    ir_x86_build_intervals(&x86);
+    ir_x86_find_forbidden_registers(&x86);
+    ir_x86_allocate_registers(&x86);
+
+    ir_x86_prologue(&x86);
+    int total_blocks = vector_count(function->blocks);
+    for (int i = 0; i < total_blocks; i++)
+    {
+        struct ir_block *block = *(struct ir_block **)vector_at(function->blocks, i);
+        struct ir_block *next = i + 1 < total_blocks ? *(struct ir_block **)vector_at(function->blocks, i + 1) : NULL;
+        ir_x86_block(&x86, block, next);
+    }
+    ir_x86_epilogue(&x86);
+
+    free(x86.intervals);
+}
@@ -0,0 +1,192 @@
+#include "compiler.h"
+
+/**
+ * Keyword recognition. Dispatches on the length of the word and then on its first
+ * character so at most a couple of memcmp calls are made per identifier, rather than
+ * comparing it against every keyword in turn.
+ */
+
+#define KEYWORD_MATCH(word, keyword_id)                   \
+    if (memcmp(str, word, sizeof(word) - 1) == 0)         \
+    {                                                     \
+        return keyword_id;                                \
+    }
+
+int keyword_lookup(const char *str, size_t length)
+{
+    switch (length)
+    {
+    case 2:
+        switch (str[0])
+        {
+        case 'i':
+            KEYWORD_MATCH("if", KEYWORD_IF);
+            break;
+        case 'd':
+            KEYWORD_MATCH("do", KEYWORD_DO);
+            break;
+        }
+        break;
+
+    case 3:
+        switch (str[0])
+        {
+        case 'i':
+            KEYWORD_MATCH("int", KEYWORD_INT);
+            break;
+        case 'f':
+            KEYWORD_MATCH("for", KEYWORD_FOR);
+            break;
+        }
+        break;
+
+    case 4:
+        switch (str[0])
+        {
+        case 'c':
+            KEYWORD_MATCH("char", KEYWORD_CHAR);
+            KEYWORD_MATCH("case", KEYWORD_CASE);
+            break;
+        case 'l':
+            KEYWORD_MATCH("long", KEYWORD_LONG);
+            KEYWORD_MATCH("line", KEYWORD_LINE);
+            break;
+        case 'v':
+            KEYWORD_MATCH("void", KEYWORD_VOID);
+            break;
+        case 'e':
+            KEYWORD_MATCH("else", KEYWORD_ELSE);
+            KEYWORD_MATCH("elif", KEYWORD_ELIF);
+            break;
+        case 'g':
+            KEYWORD_MATCH("goto", KEYWORD_GOTO);
+            break;
+        }
+        break;
+
+    case 5:
+        switch (str[0])
+        {
+        case 's':
+            KEYWORD_MATCH("short", KEYWORD_SHORT);
+            break;
+        case 'f':
+            KEYWORD_MATCH("float", KEYWORD_FLOAT);
+            break;
+        case 'u':
+            KEYWORD_MATCH("union", KEYWORD_UNION);
+            KEYWORD_MATCH("undef", KEYWORD_UNDEF);
+            break;
+        case 'w':
+            KEYWORD_MATCH("while", KEYWORD_WHILE);
+            break;
+        case 'b':
+            KEYWORD_MATCH("break", KEYWORD_BREAK);
+            break;
+        case 'c':
+            KEYWORD_MATCH("const", KEYWORD_CONST);
+            break;
+        case 'e':
+            KEYWORD_MATCH("error", KEYWORD_ERROR);
+            KEYWORD_MATCH("endif", KEYWORD_ENDIF);
+            break;
+        case 'i':
+            KEYWORD_MATCH("ifdef", KEYWORD_IFDEF);
+            break;
+        }
+        break;
+
+    case 6:
+        switch (str[0])
+        {
+        case 's':
+            KEYWORD_MATCH("signed", KEYWORD_SIGNED);
+            KEYWORD_MATCH("struct", KEYWORD_STRUCT);
+            KEYWORD_MATCH("static", KEYWORD_STATIC);
+            KEYWORD_MATCH("sizeof", KEYWORD_SIZEOF);
+            KEYWORD_MATCH("switch", KEYWORD_SWITCH);
+            break;
+        case 'd':
+            KEYWORD_MATCH("double", KEYWORD_DOUBLE);
+            KEYWORD_MATCH("define", KEYWORD_DEFINE);
+            break;
+        case 'r':
+            KEYWORD_MATCH("return", KEYWORD_RETURN);
+            break;
+        case 'e':
+            KEYWORD_MATCH("extern", KEYWORD_EXTERN);
+            break;
+        case 'i':
+            KEYWORD_MATCH("ifndef", KEYWORD_IFNDEF);
+            break;
+        case 'p':
+            KEYWORD_MATCH("pragma", KEYWORD_PRAGMA);
+            break;
+        }
+        break;
+
+    case 7:
+        switch (str[0])
+        {
+        case 'i':
+            KEYWORD_MATCH("include", KEYWORD_INCLUDE);
+            break;
+        case 'd':
+            KEYWORD_MATCH("default", KEYWORD_DEFAULT);
+            KEYWORD_MATCH("defined", KEYWORD_DEFINED);
+            break;
+        case 't':
+            KEYWORD_MATCH("typedef", KEYWORD_TYPEDEF);
+            break;
+        case 'w':
+            KEYWORD_MATCH("warning", KEYWORD_WARNING);
+            break;
+        }
+        break;
+
+    case 8:
+        switch (str[0])
+        {
+        case 'u':
+            KEYWORD_MATCH("unsigned", KEYWORD_UNSIGNED);
+            break;
+        case 'c':
+            KEYWORD_MATCH("continue", KEYWORD_CONTINUE);
+            break;
+        case 'r':
+            KEYWORD_MATCH("restrict", KEYWORD_RESTRICT);
+            break;
+        }
+        break;
+
+    case 20:
+        KEYWORD_MATCH("__ignore_typecheck__", KEYWORD_IGNORE_TYPECHECK);
+        break;
+    }
+
+    return KEYWORD_NONE;
+}
+
+bool keyword_is_c_keyword(int keyword)
+{
+    return keyword >= KEYWORD_UNSIGNED && keyword <= KEYWORD_RESTRICT;
+}
+
+bool keyword_id_is_datatype(int keyword)
+{
+    switch (keyword)
+    {
+    case KEYWORD_VOID:
+    case KEYWORD_CHAR:
+    case KEYWORD_INT:
+    case KEYWORD_SHORT:
+    case KEYWORD_FLOAT:
+    case KEYWORD_DOUBLE:
+    case KEYWORD_LONG:
+    case KEYWORD_STRUCT:
+    case KEYWORD_UNION:
+        return true;
+    }
+
+    return false;
+}
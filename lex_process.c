@@ -12,6 +12,46 @@ struct lex_process* lex_process_create(struct compile_process* compiler, struct
     return process;
 }
 
+struct lex_process_functions lex_process_source_functions = {
+    .next_char = lex_process_source_next_char,
+    .peek_char = lex_process_source_peek_char,
+    .push_char = lex_process_source_push_char};
+
+struct lex_process* lex_process_create_for_source(struct compile_process* compiler, char* data, size_t size)
+{
+    struct lex_process* process = lex_process_create(compiler, &lex_process_source_functions, NULL);
+    process->source.start = data;
+    process->source.cursor = data;
+    process->source.end = data + size;
+    return process;
+}
+
+char lex_process_source_next_char(struct lex_process* process)
+{
+    if (process->source.cursor >= process->source.end)
+    {
+        return EOF;
+    }
+    return *process->source.cursor++;
+}
+
+char lex_process_source_peek_char(struct lex_process* process)
+{
+    if (process->source.cursor >= process->source.end)
+    {
+        return EOF;
+    }
+    return *process->source.cursor;
+}
+
+void lex_process_source_push_char(struct lex_process* process, char c)
+{
+    // Only characters we have already read are ever pushed back
+    // so there is always room behind the cursor.
+    assert(process->source.cursor > process->source.start);
+    *--process->source.cursor = c;
+}
+
 void lex_process_free(struct lex_process* process)
 {
     vector_free(process->token_vec);
@@ -0,0 +1,242 @@
+#include "compiler.h"
+#include <string.h>
+
+/**
+ * Block scanners used by the lexer to skip over runs of characters it does not need
+ * to look at one at a time: whitespace, identifier characters, and comment and string
+ * bodies. Each scanner has a scalar version and, on x86, SSE2 and AVX2 versions that
+ * test 16 or 32 characters per step. The best set the CPU supports is picked once,
+ * the scalar set is always available.
+ */
+
+#define LEX_SCAN_IS_BLANK(c) ((c) == ' ' || (c) == '\t')
+#define LEX_SCAN_IS_IDENTIFIER(c) (((c) >= 'a' && (c) <= 'z') || ((c) >= 'A' && (c) <= 'Z') || ((c) >= '0' && (c) <= '9') || (c) == '_')
+
+static size_t lex_scan_blanks_scalar(const char *ptr, const char *end)
+{
+    const char *start = ptr;
+    while (ptr < end && LEX_SCAN_IS_BLANK(*ptr))
+    {
+        ptr++;
+    }
+    return ptr - start;
+}
+
+static size_t lex_scan_identifier_scalar(const char *ptr, const char *end)
+{
+    const char *start = ptr;
+    while (ptr < end && LEX_SCAN_IS_IDENTIFIER(*ptr))
+    {
+        ptr++;
+    }
+    return ptr - start;
+}
+
+static size_t lex_scan_until_scalar(const char *ptr, const char *end, char c1, char c2)
+{
+    const char *start = ptr;
+    while (ptr < end && *ptr != c1 && *ptr != c2)
+    {
+        ptr++;
+    }
+    return ptr - start;
+}
+
+static size_t lex_scan_count_scalar(const char *ptr, const char *end, char c)
+{
+    size_t count = 0;
+    for (; ptr < end; ptr++)
+    {
+        count += *ptr == c;
+    }
+    return count;
+}
+
+static const struct lex_scanner lex_scanner_scalar = {
+    .name = "scalar",
+    .blanks = lex_scan_blanks_scalar,
+    .identifier = lex_scan_identifier_scalar,
+    .until = lex_scan_until_scalar,
+    .count = lex_scan_count_scalar};
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+
+/**
+ * The vector versions work on whole blocks and hand the tail that is shorter than a
+ * block to the scalar version, so they never read past the end of the source.
+ * A mask has a bit set for every character that ends the run.
+ */
+
+__attribute__((target("sse2"))) static inline unsigned lex_scan_identifier_mask_sse2(__m128i block)
+{
+    // Characters above 0x7f compare as negative and fail every range below.
+    __m128i lower = _mm_or_si128(block, _mm_set1_epi8(0x20));
+    __m128i letter = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(lower, _mm_set1_epi8('z' + 1)));
+    __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(block, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(block, _mm_set1_epi8('9' + 1)));
+    __m128i underscore = _mm_cmpeq_epi8(block, _mm_set1_epi8('_'));
+    return ~_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(letter, digit), underscore)) & 0xffff;
+}
+
+__attribute__((target("sse2"))) static size_t lex_scan_blanks_sse2(const char *ptr, const char *end)
+{
+    const char *start = ptr;
+    for (; end - ptr >= 16; ptr += 16)
+    {
+        __m128i block = _mm_loadu_si128((const __m128i *)ptr);
+        __m128i blank = _mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(block, _mm_set1_epi8('\t')));
+        unsigned mask = ~_mm_movemask_epi8(blank) & 0xffff;
+        if (mask)
+        {
+            return ptr - start + __builtin_ctz(mask);
+        }
+    }
+    return ptr - start + lex_scan_blanks_scalar(ptr, end);
+}
+
+__attribute__((target("sse2"))) static size_t lex_scan_identifier_sse2(const char *ptr, const char *end)
+{
+    const char *start = ptr;
+    for (; end - ptr >= 16; ptr += 16)
+    {
+        unsigned mask = lex_scan_identifier_mask_sse2(_mm_loadu_si128((const __m128i *)ptr));
+        if (mask)
+        {
+            return ptr - start + __builtin_ctz(mask);
+        }
+    }
+    return ptr - start + lex_scan_identifier_scalar(ptr, end);
+}
+
+__attribute__((target("sse2"))) static size_t lex_scan_until_sse2(const char *ptr, const char *end, char c1, char c2)
+{
+    const char *start = ptr;
+    __m128i v1 = _mm_set1_epi8(c1);
+    __m128i v2 = _mm_set1_epi8(c2);
+    for (; end - ptr >= 16; ptr += 16)
+    {
+        __m128i block = _mm_loadu_si128((const __m128i *)ptr);
+        unsigned mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(block, v1), _mm_cmpeq_epi8(block, v2)));
+        if (mask)
+        {
+            return ptr - start + __builtin_ctz(mask);
+        }
+    }
+    return ptr - start + lex_scan_until_scalar(ptr, end, c1, c2);
+}
+
+__attribute__((target("sse2,popcnt"))) static size_t lex_scan_count_sse2(const char *ptr, const char *end, char c)
+{
+    size_t count = 0;
+    __m128i v = _mm_set1_epi8(c);
+    for (; end - ptr >= 16; ptr += 16)
+    {
+        __m128i block = _mm_loadu_si128((const __m128i *)ptr);
+        count += __builtin_popcount(_mm_movemask_epi8(_mm_cmpeq_epi8(block, v)));
+    }
+    return count + lex_scan_count_scalar(ptr, end, c);
+}
+
+static const struct lex_scanner lex_scanner_sse2 = {
+    .name = "sse2",
+    .blanks = lex_scan_blanks_sse2,
+    .identifier = lex_scan_identifier_sse2,
+    .until = lex_scan_until_sse2,
+    .count = lex_scan_count_sse2};
+
+__attribute__((target("avx2"))) static inline unsigned lex_scan_identifier_mask_avx2(__m256i block)
+{
+    __m256i lower = _mm256_or_si256(block, _mm256_set1_epi8(0x20));
+    __m256i letter = _mm256_and_si256(_mm256_cmpgt_epi8(lower, _mm256_set1_epi8('a' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), lower));
+    __m256i digit = _mm256_and_si256(_mm256_cmpgt_epi8(block, _mm256_set1_epi8('0' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), block));
+    __m256i underscore = _mm256_cmpeq_epi8(block, _mm256_set1_epi8('_'));
+    return ~(unsigned)_mm256_movemask_epi8(_mm256_or_si256(_mm256_or_si256(letter, digit), underscore));
+}
+
+__attribute__((target("avx2"))) static size_t lex_scan_blanks_avx2(const char *ptr, const char *end)
+{
+    const char *start = ptr;
+    for (; end - ptr >= 32; ptr += 32)
+    {
+        __m256i block = _mm256_loadu_si256((const __m256i *)ptr);
+        __m256i blank = _mm256_or_si256(_mm256_cmpeq_epi8(block, _mm256_set1_epi8(' ')), _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\t')));
+        unsigned mask = ~(unsigned)_mm256_movemask_epi8(blank);
+        if (mask)
+        {
+            return ptr - start + __builtin_ctz(mask);
+        }
+    }
+    return ptr - start + lex_scan_blanks_sse2(ptr, end);
+}
+
+__attribute__((target("avx2"))) static size_t lex_scan_identifier_avx2(const char *ptr, const char *end)
+{
+    const char *start = ptr;
+    for (; end - ptr >= 32; ptr += 32)
+    {
+        unsigned mask = lex_scan_identifier_mask_avx2(_mm256_loadu_si256((const __m256i *)ptr));
+        if (mask)
+        {
+            return ptr - start + __builtin_ctz(mask);
+        }
+    }
+    return ptr - start + lex_scan_identifier_sse2(ptr, end);
+}
+
+__attribute__((target("avx2"))) static size_t lex_scan_until_avx2(const char *ptr, const char *end, char c1, char c2)
+{
+    const char *start = ptr;
+    __m256i v1 = _mm256_set1_epi8(c1);
+    __m256i v2 = _mm256_set1_epi8(c2);
+    for (; end - ptr >= 32; ptr += 32)
+    {
+        __m256i block = _mm256_loadu_si256((const __m256i *)ptr);
+        unsigned mask = _mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(block, v1), _mm256_cmpeq_epi8(block, v2)));
+        if (mask)
+        {
+            return ptr - start + __builtin_ctz(mask);
+        }
+    }
+    return ptr - start + lex_scan_until_sse2(ptr, end, c1, c2);
+}
+
+__attribute__((target("avx2,popcnt"))) static size_t lex_scan_count_avx2(const char *ptr, const char *end, char c)
+{
+    size_t count = 0;
+    __m256i v = _mm256_set1_epi8(c);
+    for (; end - ptr >= 32; ptr += 32)
+    {
+        __m256i block = _mm256_loadu_si256((const __m256i *)ptr);
+        count += __builtin_popcount(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, v)));
+    }
+    return count + lex_scan_count_scalar(ptr, end, c);
+}
+
+static const struct lex_scanner lex_scanner_avx2 = {
+    .name = "avx2",
+    .blanks = lex_scan_blanks_avx2,
+    .identifier = lex_scan_identifier_avx2,
+    .until = lex_scan_until_avx2,
+    .count = lex_scan_count_avx2};
+#endif
+
+const struct lex_scanner *lex_scanner_get(bool allow_simd)
+{
+    if (!allow_simd)
+    {
+        return &lex_scanner_scalar;
+    }
+
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt"))
+    {
+        return &lex_scanner_avx2;
+    }
+    if (__builtin_cpu_supports("sse2") && __builtin_cpu_supports("popcnt"))
+    {
+        return &lex_scanner_sse2;
+    }
+#endif
+    return &lex_scanner_scalar;
+}
@@ -25,8 +25,13 @@
         nextc();                        \
     }
 
+// The number of tokens a piece of a file that is only preprocessed holds at least, see lex_next_conditional
+#define LEX_PIECE_TOKENS 4096
+
 static struct token tmp_token;
 static struct lex_process *lex_process;
+// Picked by lex(), skips runs of characters when lexing straight from memory
+static const struct lex_scanner *lex_scanner;
 
 const char *read_number_str();
 unsigned long long read_number();
@@ -42,11 +47,6 @@ void error(const char *fmt, ...)
 void lex_new_expression()
 {
     lex_process->current_expression_count++;
-    if (lex_process->current_expression_count == 1)
-    {
-        // This is the first expression in series? Then we must initialize the buffer
-        lex_process->parentheses_buffer = buffer_create();
-    }
 }
 
 void lex_finish_expression()
@@ -63,36 +63,30 @@ bool lex_is_in_expression()
     return lex_process->current_expression_count > 0;
 }
 
-char lexer_string_buffer_next_char(struct lex_process *process)
-{
-    struct buffer *buf = lex_process_private(process);
-    return buffer_read(buf);
-}
-char lexer_string_buffer_peek_char(struct lex_process *process)
-{
-    struct buffer *buf = lex_process_private(process);
-    return buffer_peek(buf);
-}
-
-void lexer_string_buffer_push_char(struct lex_process *process, char c)
+// Processes created with lex_process_create_for_source are read straight from
+// memory, only custom character streams go through the function table.
+/**
+ * Sets the column, saturating at the largest column a position can hold
+ */
+static inline void lex_set_col(size_t col)
 {
-    struct buffer *buf = lex_process_private(process);
-    buffer_write(buf, c);
+    lex_process->pos.col = col < POS_MAX_COL ? col : POS_MAX_COL;
 }
 
-struct lex_process_functions lexer_string_buffer_functions = {
-    .next_char = lexer_string_buffer_next_char,
-    .peek_char = lexer_string_buffer_peek_char,
-    .push_char = lexer_string_buffer_push_char};
-
-static char nextc()
+static inline char nextc()
 {
-    char c = lex_process->function->next_char(lex_process);
-    if (lex_is_in_expression())
+    char c;
+    struct lex_source *source = &lex_process->source;
+    if (source->start)
     {
-        buffer_write(lex_process->parentheses_buffer, c);
+        c = source->cursor < source->end ? *source->cursor++ : EOF;
     }
-    lex_process->pos.col++;
+    else
+    {
+        c = lex_process->function->next_char(lex_process);
+    }
+
+    lex_set_col(lex_process->pos.col + 1);
     if (c == '\n')
     {
         lex_process->pos.col = 0;
@@ -101,62 +95,76 @@ static char nextc()
     return c;
 }
 
-static char peekc()
+static inline char peekc()
 {
+    struct lex_source *source = &lex_process->source;
+    if (source->start)
+    {
+        return source->cursor < source->end ? *source->cursor : EOF;
+    }
     return lex_process->function->peek_char(lex_process);
 }
 
+/**
+ * Returns true if the lexer reads from memory, so the scanners can be used on the
+ * characters from the cursor to the end of the source.
+ */
+static inline bool lex_can_scan()
+{
+    return lex_process->source.start != NULL;
+}
+
+/**
+ * Moves the cursor over "n" scanned characters that are known not to include a new line
+ */
+static inline void lex_skip_in_line(size_t n)
+{
+    lex_process->source.cursor += n;
+    lex_set_col(lex_process->pos.col + n);
+}
+
+/**
+ * Moves the cursor over "n" scanned characters, counting the new lines amongst them
+ */
+static void lex_skip(size_t n)
+{
+    struct lex_source *source = &lex_process->source;
+    size_t lines = lex_scanner->count(source->cursor, source->cursor + n, '\n');
+    if (lines == 0)
+    {
+        lex_skip_in_line(n);
+        return;
+    }
+
+    const char *last_newline = source->cursor + n - 1;
+    while (*last_newline != '\n')
+    {
+        last_newline--;
+    }
+
+    lex_process->pos.line += lines;
+    lex_set_col(source->cursor + n - last_newline - 1);
+    source->cursor += n;
+}
+
 static void pushc(char c)
 {
-    return lex_process->function->push_char(lex_process, c);
+    if (lex_process->source.start)
+    {
+        lex_process_source_push_char(lex_process, c);
+        return;
+    }
+    lex_process->function->push_char(lex_process, c);
 }
 
 bool is_keyword(const char *str)
 {
-    return S_EQ(str, "unsigned") ||
-           S_EQ(str, "signed") ||
-           S_EQ(str, "char") ||
-           S_EQ(str, "short") ||
-           S_EQ(str, "int") ||
-           S_EQ(str, "float") ||
-           S_EQ(str, "double") ||
-           S_EQ(str, "long") ||
-           S_EQ(str, "void") ||
-           S_EQ(str, "struct") ||
-           S_EQ(str, "union") ||
-           S_EQ(str, "static") ||
-           S_EQ(str, "__ignore_typecheck__") ||
-           S_EQ(str, "return") ||
-           S_EQ(str, "include") ||
-           S_EQ(str, "sizeof") ||
-           S_EQ(str, "if") ||
-           S_EQ(str, "else") ||
-           S_EQ(str, "while") ||
-           S_EQ(str, "for") ||
-           S_EQ(str, "do") ||
-           S_EQ(str, "break") ||
-           S_EQ(str, "continue") ||
-           S_EQ(str, "switch") ||
-           S_EQ(str, "case") ||
-           S_EQ(str, "default") ||
-           S_EQ(str, "goto") ||
-           S_EQ(str, "typedef") ||
-           S_EQ(str, "const") ||
-           S_EQ(str, "extern") ||
-           S_EQ(str, "restrict");
+    return keyword_is_c_keyword(keyword_lookup(str, strlen(str)));
 }
 
 bool keyword_is_datatype(const char *str)
 {
-    return S_EQ(str, "void") ||
-           S_EQ(str, "char") ||
-           S_EQ(str, "int") ||
-           S_EQ(str, "short") ||
-           S_EQ(str, "float") ||
-           S_EQ(str, "double") ||
-           S_EQ(str, "long") ||
-           S_EQ(str, "struct") ||
-           S_EQ(str, "union");
+    return keyword_id_is_datatype(keyword_lookup(str, strlen(str)));
 }
 
 static bool is_single_operator(char op)
@@ -257,6 +265,30 @@ static char assert_next_char(char expected_char)
     return c;
 }
 
+/**
+ * Returns the text of the buffer in memory of its own size and frees the buffer. Tokens keep their
+ * text for as long as the compiler runs, the buffer is much larger than most of them need.
+ */
+static const char *lex_buffer_take(struct buffer *buffer)
+{
+    char *str = strndup(buffer_ptr(buffer), buffer->len);
+    buffer_free(buffer);
+    return str;
+}
+
+/**
+ * Returns the text of a comment, preprocessing alone writes no comments and keeps none of them
+ */
+static const char *lex_comment_text(struct buffer *buffer)
+{
+    if (lex_process->compiler->flags & COMPILE_PROCESS_PREPROCESS_ONLY)
+    {
+        buffer_free(buffer);
+        return "";
+    }
+    return lex_buffer_take(buffer);
+}
+
 static struct token *token_create(struct token *_token)
 {
     // Shared temp token for all tokens, only one token should be created
@@ -264,10 +296,6 @@ static struct token *token_create(struct token *_token)
     // Once its pushed to the token stack then its safe to call this function again
     memcpy(&tmp_token, _token, sizeof(tmp_token));
     tmp_token.pos = lex_file_position();
-    if (lex_is_in_expression())
-    {
-        tmp_token.between_brackets = buffer_ptr(lex_process->parentheses_buffer);
-    }
     return &tmp_token;
 }
 
@@ -293,6 +321,11 @@ char lex_get_escaped_char(char c)
         break;
     case '\\':
         co = '\\';
+        break;
+
+    case '"':
+        co = '"';
+        break;
 
     case 't':
         co = '\t';
@@ -332,6 +365,17 @@ static struct token *token_make_string(char start_delim, char end_delim)
 
     for (; c != end_delim && c != EOF; c = nextc())
     {
+        if (lex_can_scan() && c != '\\')
+        {
+            // Copy the rest of the run up to the delimiter or the next escape in one go.
+            struct lex_source *source = &lex_process->source;
+            size_t n = lex_scanner->until(source->cursor, source->end, end_delim, '\\');
+            buffer_write(buf, c);
+            buffer_write_bytes(buf, source->cursor, n);
+            lex_skip(n);
+            continue;
+        }
+
         if (c == '\\')
         {
             lex_handle_escape(buf);
@@ -341,12 +385,44 @@ static struct token *token_make_string(char start_delim, char end_delim)
     }
     // Null terminator.
     buffer_write(buf, 0x00);
-    return token_create(&(struct token){TOKEN_TYPE_STRING, .sval = buffer_ptr(buf)});
+    return token_create(&(struct token){TOKEN_TYPE_STRING, .sval = lex_buffer_take(buf)});
+}
+
+/**
+ * Applies a "#line number" or "#line number "file"" directive on the line that just ended, the
+ * next line is numbered "number" and belongs to "file". Compiling the output of -E this way
+ * gives every token the position it had in the source that was preprocessed.
+ */
+static void lex_apply_line_directive()
+{
+    struct vector *token_vec = lex_process->token_vec;
+    int total = vector_count(token_vec);
+    struct token *last = vector_back_or_null(token_vec);
+    int start = total - (last && last->type == TOKEN_TYPE_STRING ? 4 : 3);
+    if (start < 0 || (start > 0 && ((struct token *)vector_at(token_vec, start - 1))->type != TOKEN_TYPE_NEWLINE))
+    {
+        return;
+    }
+
+    struct token *directive = vector_at(token_vec, start + 1);
+    struct token *number = vector_at(token_vec, start + 2);
+    if (!token_is_symbol(vector_at(token_vec, start), '#') || directive->type != TOKEN_TYPE_IDENTIFIER ||
+        directive->keyword != KEYWORD_LINE || number->type != TOKEN_TYPE_NUMBER)
+    {
+        return;
+    }
+
+    lex_process->pos.line = number->llnum;
+    if (last->type == TOKEN_TYPE_STRING)
+    {
+        lex_process->pos.file = compiler_file_id(last->sval);
+    }
 }
 
 static struct token *token_make_newline()
 {
     nextc();
+    lex_apply_line_directive();
     return token_create(&(struct token){TOKEN_TYPE_NEWLINE});
 }
 
@@ -427,7 +503,10 @@ static const char *read_op()
     {
         compiler_error(lex_process->compiler, "The operator %s is invalid\n", ptr);
     }
-    return ptr;
+
+    const char *op_atom = atom(ptr);
+    buffer_free(buffer);
+    return op_atom;
 }
 
 static struct token *token_make_operator_for_value(const char *val)
@@ -442,7 +521,7 @@ static struct token *token_make_operator_or_string()
     {
         // It's possible we have an include statement lets just check that if so we will have a string
         struct token *last_token = lexer_last_token();
-        if (token_is_keyword(last_token, "include"))
+        if (last_token && last_token->keyword == KEYWORD_INCLUDE)
         {
             // Aha so we have something like this "include <stdio.h>"
             // We are at the "stdio.h>" bit so we need to treat this as a string
@@ -469,7 +548,7 @@ const char *read_hex_number_str()
     // Null terminator.
     buffer_write(buffer, 0x00);
 
-    return buffer_ptr(buffer);
+    return lex_buffer_take(buffer);
 }
 
 const char *read_number_str()
@@ -482,13 +561,15 @@ const char *read_number_str()
     // Null terminator.
     buffer_write(buffer, 0x00);
 
-    return buffer_ptr(buffer);
+    return lex_buffer_take(buffer);
 }
 
 unsigned long long read_number()
 {
     const char *s = read_number_str();
-    return atoll(s);
+    unsigned long long number = atoll(s);
+    free((char *)s);
+    return number;
 }
 
 static int lexer_number_type(char c)
@@ -522,20 +603,47 @@ static struct token *token_make_number()
     return token_make_number_for_value(read_number());
 }
 
+static struct token *token_make_identifier_from_source()
+{
+    struct lex_source *source = &lex_process->source;
+    size_t length = lex_scanner->identifier(source->cursor, source->end);
+    int keyword = keyword_lookup(source->cursor, length);
+    const char *name = atom_n(source->cursor, length);
+    lex_skip_in_line(length);
+    if (keyword_is_c_keyword(keyword))
+    {
+        return token_create(&(struct token){TOKEN_TYPE_KEYWORD, .sval = name, .keyword = keyword});
+    }
+
+    return token_create(&(struct token){TOKEN_TYPE_IDENTIFIER, .sval = name, .keyword = keyword});
+}
+
 static struct token *token_make_identifier_or_keyword()
 {
+    if (lex_can_scan())
+    {
+        // Named straight from the source, no copy is needed to intern it.
+        return token_make_identifier_from_source();
+    }
+
     struct buffer *buffer = buffer_create();
     char c = peekc();
     LEX_GETC_IF(buffer, c, (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_');
     // Null terminator.
     buffer_write(buffer, 0x00);
 
-    if (is_keyword(buffer_ptr(buffer)))
+    // Identifiers and keywords are interned so every later comparison of the
+    // same name can be done on the pointer.
+    // The keyword is worked out once here, later phases switch on token->keyword.
+    int keyword = keyword_lookup(buffer_ptr(buffer), buffer->len - 1);
+    const char *name = atom_n(buffer_ptr(buffer), buffer->len - 1);
+    buffer_free(buffer);
+    if (keyword_is_c_keyword(keyword))
     {
-        return token_create(&(struct token){TOKEN_TYPE_KEYWORD, .sval = buffer_ptr(buffer)});
+        return token_create(&(struct token){TOKEN_TYPE_KEYWORD, .sval = name, .keyword = keyword});
     }
 
-    return token_create(&(struct token){TOKEN_TYPE_IDENTIFIER, .sval = buffer_ptr(buffer)});
+    return token_create(&(struct token){TOKEN_TYPE_IDENTIFIER, .sval = name, .keyword = keyword});
 }
 
 static struct token *token_make_symbol()
@@ -572,8 +680,15 @@ static struct token *token_make_one_line_comment()
 
     struct buffer *buffer = buffer_create();
     char c = 0;
+    if (lex_can_scan())
+    {
+        struct lex_source *source = &lex_process->source;
+        size_t n = lex_scanner->until(source->cursor, source->end, '\n', '\n');
+        buffer_write_bytes(buffer, source->cursor, n);
+        lex_skip_in_line(n);
+    }
     LEX_GETC_IF(buffer, c, c != '\n' && c != EOF);
-    return token_create(&(struct token){TOKEN_TYPE_COMMENT, .sval = buffer_ptr(buffer)});
+    return token_create(&(struct token){TOKEN_TYPE_COMMENT, .sval = lex_comment_text(buffer)});
 }
 
 /**
@@ -586,6 +701,13 @@ static struct token *token_make_multiline_comment()
     char c = 0;
     while (1)
     {
+        if (lex_can_scan())
+        {
+            struct lex_source *source = &lex_process->source;
+            size_t n = lex_scanner->until(source->cursor, source->end, '*', '*');
+            buffer_write_bytes(buffer, source->cursor, n);
+            lex_skip(n);
+        }
         LEX_GETC_IF(buffer, c, c != '*' && c != EOF);
         if (c == EOF)
         {
@@ -609,7 +731,7 @@ static struct token *token_make_multiline_comment()
         }
     }
 
-    return token_create(&(struct token){TOKEN_TYPE_COMMENT, .sval = buffer_ptr(buffer)});
+    return token_create(&(struct token){TOKEN_TYPE_COMMENT, .sval = lex_comment_text(buffer)});
 }
 static struct token *handle_comment()
 {
@@ -666,7 +788,16 @@ static struct token *handle_whitespace()
         last_token->whitespace = true;
     }
 
-    nextc();
+    if (lex_can_scan())
+    {
+        // Skip the whole run of spaces and tabs rather than one character per call
+        struct lex_source *source = &lex_process->source;
+        lex_skip_in_line(lex_scanner->blanks(source->cursor, source->end));
+    }
+    else
+    {
+        nextc();
+    }
     return read_next_token();
 }
 
@@ -685,6 +816,7 @@ static struct token *token_make_special_number_binary()
 
     // Okay we have a binary number, covnert it to an integer
     number = strtol(number_str, NULL, 2);
+    free((char *)number_str);
     return token_make_number_for_value(number);
 }
 
@@ -702,6 +834,7 @@ static struct token *token_make_special_number_hexadecimal()
 
     // Okay we have a binary number, covnert it to an integer
     number = strtol(number_str, NULL, 16);
+    free((char *)number_str);
     return token_make_number_for_value(number);
 }
 
@@ -793,14 +926,28 @@ static struct token *read_next_token()
     return token;
 }
 
-int lex(struct lex_process *process)
+void lex_begin(struct lex_process *process)
 {
     process->current_expression_count = 0;
-    process->parentheses_buffer = NULL;
+    process->brace_depth = 0;
+    // Copy filename to the lex process
+    process->pos.file = compiler_file_id(process->compiler->cfile.abs_path);
+}
 
+/**
+ * Makes the process the one the lexer works on, files lexed on demand take turns with
+ * the files they include
+ */
+static void lex_select(struct lex_process *process)
+{
     lex_process = process;
-    // Copy filename to the lex process
-    lex_process->pos.filename = process->compiler->cfile.abs_path;
+    lex_scanner = lex_scanner_get(!(process->compiler->flags & COMPILE_PROCESS_NO_SIMD));
+}
+
+int lex(struct lex_process *process)
+{
+    lex_begin(process);
+    lex_select(process);
 
     struct token *token = read_next_token();
     while (token)
@@ -812,11 +959,279 @@ int lex(struct lex_process *process)
     return LEXICAL_ANALYSIS_ALL_OK;
 }
 
+/**
+ * Returns true if the tokens from "start" to the end of the vector are an #if, #ifdef,
+ * #ifndef, #elif, #else or #endif line
+ */
+static bool lex_line_is_conditional(int start)
+{
+    struct vector *token_vec = lex_process->token_vec;
+    if (vector_count(token_vec) - start < 2 || !token_is_symbol(vector_at(token_vec, start), '#'))
+    {
+        return false;
+    }
+
+    struct token *directive = vector_at(token_vec, start + 1);
+    if (directive->type != TOKEN_TYPE_IDENTIFIER && directive->type != TOKEN_TYPE_KEYWORD)
+    {
+        return false;
+    }
+
+    switch (directive->keyword)
+    {
+    case KEYWORD_IF:
+    case KEYWORD_IFDEF:
+    case KEYWORD_IFNDEF:
+    case KEYWORD_ELIF:
+    case KEYWORD_ELSE:
+    case KEYWORD_ENDIF:
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * Returns the KEYWORD_* of the directive the line starts with, KEYWORD_NONE if the line is not a directive
+ */
+static int lex_inactive_directive(const char *ptr, const char *end)
+{
+    ptr += lex_scanner->blanks(ptr, end);
+    if (ptr >= end || *ptr != '#')
+    {
+        return KEYWORD_NONE;
+    }
+
+    ptr++;
+    ptr += lex_scanner->blanks(ptr, end);
+    return keyword_lookup(ptr, lex_scanner->identifier(ptr, end));
+}
+
+/**
+ * Returns the start of the line after the one at "ptr", continued lines are part of the line.
+ * Quotes are followed so a comment is not seen in a string, but an unterminated quote such as
+ * an apostrophe in prose ends at the end of the line.
+ */
+static const char *lex_inactive_line_end(const char *ptr, const char *end, bool *in_comment, size_t *lines)
+{
+    while (ptr < end)
+    {
+        char c = *ptr++;
+        if (c == '\n')
+        {
+            (*lines)++;
+            return ptr;
+        }
+
+        if (*in_comment)
+        {
+            if (c == '*' && ptr < end && *ptr == '/')
+            {
+                *in_comment = false;
+                ptr++;
+            }
+            continue;
+        }
+
+        switch (c)
+        {
+        case '\\':
+            if (ptr < end && *ptr == '\n')
+            {
+                (*lines)++;
+                ptr++;
+            }
+            break;
+
+        case '/':
+            if (ptr < end && *ptr == '*')
+            {
+                *in_comment = true;
+                ptr++;
+            }
+            else if (ptr < end && *ptr == '/')
+            {
+                // The rest of the line is a comment, only a continued line can carry it on
+                while (ptr < end && *ptr != '\n')
+                {
+                    if (*ptr == '\\' && ptr + 1 < end && ptr[1] == '\n')
+                    {
+                        (*lines)++;
+                        ptr++;
+                    }
+                    ptr++;
+                }
+            }
+            break;
+
+        case '"':
+        case '\'':
+            while (ptr < end && *ptr != c && *ptr != '\n')
+            {
+                if (*ptr == '\\' && ptr + 1 < end && ptr[1] != '\n')
+                {
+                    ptr++;
+                }
+                ptr++;
+            }
+            if (ptr < end && *ptr == c)
+            {
+                ptr++;
+            }
+            break;
+        }
+    }
+
+    return ptr;
+}
+
+/**
+ * Returns true if the line at "ptr" is a directive, the first character that is not blank is a #
+ */
+static bool lex_line_is_directive(const char *ptr, const char *end)
+{
+    ptr += lex_scanner->blanks(ptr, end);
+    return ptr < end && *ptr == '#';
+}
+
+/**
+ * Moves the cursor over the lines from the cursor on that are not directives, for files lexed
+ * with COMPILE_PROCESS_DIRECTIVES_ONLY
+ */
+static void lex_skip_text_lines()
+{
+    struct lex_source *source = &lex_process->source;
+    const char *line = source->cursor;
+    bool in_comment = false;
+    size_t lines = 0;
+    while (line < source->end && (in_comment || !lex_line_is_directive(line, source->end)))
+    {
+        line = lex_inactive_line_end(line, source->end, &in_comment, &lines);
+    }
+
+    if (lines)
+    {
+        lex_process->pos.line += lines;
+        lex_process->pos.col = 0;
+    }
+    source->cursor = (char *)line;
+}
+
+/**
+ * Returns true if a piece of the file may end with the line from "line_start" up to its new line
+ * at "total". A directive or a declaration must end on it outside of any brackets or braces, the
+ * preprocessor reads a macro call or a typedef from a single piece.
+ */
+static bool lex_line_ends_piece(int line_start, int total)
+{
+    struct vector *token_vec = lex_process->token_vec;
+    if (lex_process->brace_depth != 0 || lex_is_in_expression() || total - line_start < 2)
+    {
+        return false;
+    }
+
+    struct token *last = vector_at(token_vec, total - 2);
+    return token_is_symbol(vector_at(token_vec, line_start), '#') || token_is_symbol(last, ';') || token_is_symbol(last, '}');
+}
+
+bool lex_next_conditional(struct lex_process *process)
+{
+    lex_select(process);
+    bool directives_only = process->compiler->flags & COMPILE_PROCESS_DIRECTIVES_ONLY && lex_can_scan();
+    if (directives_only)
+    {
+        lex_skip_text_lines();
+    }
+
+    // Preprocessing alone also stops once a piece is large enough
+    bool in_pieces = process->compiler->flags & COMPILE_PROCESS_PREPROCESS_ONLY;
+    struct vector *token_vec = process->token_vec;
+    int line_start = vector_count(token_vec);
+    int piece_start = line_start;
+    struct token *token = read_next_token();
+    while (token)
+    {
+        vector_push(token_vec, token);
+        if (in_pieces && token->type == TOKEN_TYPE_SYMBOL)
+        {
+            process->brace_depth += token->cval == '{' ? 1 : token->cval == '}' ? -1 : 0;
+        }
+
+        // A new line after a backslash continues the line
+        int total = vector_count(token_vec);
+        if (token->type == TOKEN_TYPE_NEWLINE && !(total > 1 && token_is_symbol(vector_at(token_vec, total - 2), '\\')))
+        {
+            if (lex_line_is_conditional(line_start))
+            {
+                return true;
+            }
+
+            if (in_pieces && total - piece_start >= LEX_PIECE_TOKENS && lex_line_ends_piece(line_start, total))
+            {
+                return true;
+            }
+            line_start = total;
+            if (directives_only)
+            {
+                lex_skip_text_lines();
+            }
+        }
+        token = read_next_token();
+    }
+
+    return false;
+}
+
+size_t lex_skip_inactive(struct lex_process *process, bool to_endif)
+{
+    struct lex_source *source = &process->source;
+    if (!source->start)
+    {
+        return 0;
+    }
+
+    lex_select(process);
+    const char *line = source->cursor;
+    bool in_comment = false;
+    int depth = 0;
+    size_t lines = 0;
+    while (line < source->end)
+    {
+        int keyword = in_comment ? KEYWORD_NONE : lex_inactive_directive(line, source->end);
+        if (depth == 0 && (keyword == KEYWORD_ENDIF || (!to_endif && (keyword == KEYWORD_ELIF || keyword == KEYWORD_ELSE))))
+        {
+            break;
+        }
+
+        switch (keyword)
+        {
+        case KEYWORD_IF:
+        case KEYWORD_IFDEF:
+        case KEYWORD_IFNDEF:
+            depth++;
+            break;
+        case KEYWORD_ENDIF:
+            depth--;
+            break;
+        }
+        line = lex_inactive_line_end(line, source->end, &in_comment, &lines);
+    }
+
+    size_t skipped = line - source->cursor;
+    source->cursor = (char *)line;
+    process->pos.line += lines;
+    process->pos.col = 0;
+    return skipped;
+}
+
 struct lex_process *tokens_build_for_string(struct compile_process *compiler, const char *str)
 {
-    struct buffer *buffer = buffer_create();
-    buffer_printf(buffer, str);
-    struct lex_process *process = lex_process_create(compiler, &lexer_string_buffer_functions, buffer);
+    // Lexed in place through the source cursor, so take a writable copy
+    // that pushed back characters can be written into.
+    size_t len = strlen(str);
+    char *data = malloc(len + 1);
+    memcpy(data, str, len + 1);
+    struct lex_process *process = lex_process_create_for_source(compiler, data, len);
     if (!process)
     {
         return NULL;
@@ -2,61 +2,670 @@
 #include "helpers/hashmap.h"
 #include <stdio.h>
 #include <math.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+
+/**
+ * Usage:
+ * main input output [exec|object] [--nasm] [--time-report[=json]] [--no-peephole] [--no-ir] [--emit-ir] [--no-fold] [--no-simd] [--no-macro-cache] [--no-skip-inactive] [--token-cache=dir] [--include-cache=file] [--include-pch=file] [-v]
+ * main --emit-pch header.h output.pch
+ * main -M [-MF file] [--directives-only] [--no-skip-inactive] [--token-cache=dir] [--include-cache=file] [--include-pch=file] input1.c input2.c ...
+ * main -E [-o output] [--time-report[=json]] [--no-macro-cache] [--no-skip-inactive] [--token-cache=dir] [--include-cache=file] [--include-pch=file] input1.c input2.c ...
+ * main [-j N] [-c] [-o output] [--nasm] [--time-report[=json]] [--no-peephole] [--no-ir] [--emit-ir] [--no-fold] [--no-simd] [--no-macro-cache] [--no-skip-inactive] [--token-cache=dir] [--include-cache=file] [--include-pch=file] [-MD [-MF file]] [-v] input1.c input2.c ...
+ *
+ * The second form is used as soon as -c or -o is provided, every input is compiled and assembled
+ * by a pool of N worker processes. With -c each input becomes an object file named after it in the
+ * current directory, two inputs with the same name are rejected. Without -c the objects are written
+ * to a temporary directory, linked into the output file and removed.
+ *
+ * --time-report prints how long each compiler phase took for every file to stderr,
+ * --time-report=json prints the same as one JSON object per file.
+ *
+ * --no-peephole writes the assembly exactly as it was generated, the time report shows
+ * how many instructions each peephole rule removed otherwise.
+ *
+ * Functions are lowered to the IR and their instructions are selected from it, functions that use
+ * something the IR cannot represent yet are generated from the tree. --no-ir generates every function
+ * from the tree, --emit-ir prints the IR of every function to stdout.
+ *
+ * --no-fold keeps constant expressions and branches with constant conditions as they were written.
+ *
+ * --no-simd lexes with the scalar scanners even when the CPU supports SSE2 or AVX2.
+ *
+ * --no-macro-cache expands every macro function call, rather than reusing the expansion of an
+ * earlier call with the same arguments while the definitions have not changed.
+ *
+ * --no-skip-inactive lexes every file in one go before it is preprocessed, rather than on demand
+ * with the lines of #if groups that are not compiled skipped without being lexed.
+ *
+ * --token-cache=dir keeps the tokens of every included file in dir, an include that has not
+ * changed since it was cached is not lexed again. The directory can be shared by many compilers.
+ *
+ * --include-cache=file keeps where every include name was found, or that it was not found, in file
+ * so later runs do not search the include directories again while they are unchanged.
+ *
+ * --emit-pch lexes and preprocesses the header and writes a precompiled header to the output,
+ * --include-pch=file starts every file from it as if the header was included at the top.
+ *
+ * -M only lexes and preprocesses every input, one after the other in a worker process, and writes a make
+ * rule for each with the headers it includes to stdout, or to the file given with -MF. The target of
+ * a rule is the object file the input would be compiled to. An input that fails is reported and the
+ * rules of the others are still written. --directives-only lexes only the directive lines of every file,
+ * which is faster and gives the same headers unless a header is only included because of what a macro
+ * expands to outside of a directive.
+ *
+ * -MD writes the same rule while compiling, to a file named after the object file with a .d extension
+ * or to the file given with -MF when there is one input.
+ *
+ * -E only lexes and preprocesses every input in the same way as -M, and writes the preprocessed source
+ * with #line markers for where it came from to stdout or to the file given with -o. It is written as it
+ * is produced and a file is never held in memory whole, unless it starts with #ifndef as it may have an
+ * include guard. The output compiles like the input did, it has the same lines.
+ *
+ * -v or --verbose dumps the tree and echoes the generated assembly to stdout.
+ */
+
+struct main_job
+{
+    const char *input;
+    char asm_file[PATH_MAX];
+    char object_file[PATH_MAX];
+    // The object file named by the make rule, the object file itself unless it is a temporary one
+    char target[PATH_MAX];
+    // Where the make rule of the input is written as it compiles, empty if it is not written
+    char depend_file[PATH_MAX];
+    pid_t pid;
+};
+
+static int main_assemble(const char *asm_file, const char *object_file, int compile_flags)
+{
+    // We should invoke the NASM assembler if we are instructed to do so.
+    if (compile_flags & COMPILE_PROCESS_EXECUTE_NASM)
+    {
+        char cmd[PATH_MAX * 3];
+        sprintf(cmd, "nasm -f elf32 %s -o %s", asm_file, object_file);
+        printf("%s", cmd);
+        int res = system(cmd);
+        if (res != 0)
+        {
+            printf("Issue assembling the assembly file with NASM");
+            return -1;
+        }
+        return 0;
+    }
+
+    if (assembler_assemble_file(asm_file, object_file) < 0)
+    {
+        printf("Issue assembling the assembly file %s\n", asm_file);
+        return -1;
+    }
+    return 0;
+}
+
+static int main_compile(struct main_job *job, int compile_flags)
+{
+    depend_set_output(job->depend_file[0] ? job->depend_file : NULL, job->target);
+    if (compile_file(job->input, job->asm_file, compile_flags) != COMPILER_FILE_COMPILED_OK)
+    {
+        printf("Problem compiling file\n");
+        return -1;
+    }
+
+    return main_assemble(job->asm_file, job->object_file, compile_flags);
+}
+
+static int main_link(struct main_job *jobs, int total_jobs, const char *output_file)
+{
+    size_t len = strlen(output_file) + 32;
+    for (int i = 0; i < total_jobs; i++)
+    {
+        len += strlen(jobs[i].object_file) + 1;
+    }
+
+    char *cmd = malloc(len);
+    char *ptr = cmd + sprintf(cmd, "gcc -m32");
+    for (int i = 0; i < total_jobs; i++)
+    {
+        ptr += sprintf(ptr, " %s", jobs[i].object_file);
+    }
+    sprintf(ptr, " -o %s", output_file);
+
+    printf("%s", cmd);
+    int res = system(cmd);
+    free(cmd);
+    if (res != 0)
+    {
+        printf("Issue linking the object files with GCC");
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * Writes the name of the input file with its extension replaced into out,
+ * the directory is dropped so the file is created in the current directory.
+ */
+static void main_output_name(const char *input_file, const char *extension, char *out)
+{
+    const char *name = strrchr(input_file, '/');
+    name = name ? name + 1 : input_file;
+    const char *dot = strrchr(name, '.');
+    int len = dot ? dot - name : strlen(name);
+    snprintf(out, PATH_MAX, "%.*s%s", len, name, extension);
+}
+
+/**
+ * Writes the path with its extension replaced into out, the directory is kept
+ */
+static void main_replace_extension(const char *path, const char *extension, char *out)
+{
+    const char *name = strrchr(path, '/');
+    name = name ? name + 1 : path;
+    const char *dot = strrchr(name, '.');
+    int len = dot ? dot - path : strlen(path);
+    snprintf(out, PATH_MAX, "%.*s%s", len, path, extension);
+}
+
+/**
+ * Returns true if no two jobs name the same target, the object file of an input under -c
+ * and the name its make rule is written under with -MD.
+ */
+static bool main_targets_unique(struct main_job *jobs, int total_jobs)
+{
+    for (int i = 0; i < total_jobs; i++)
+    {
+        for (int j = 0; j < i; j++)
+        {
+            if (S_EQ(jobs[i].target, jobs[j].target))
+            {
+                fprintf(stderr, "%s and %s would both be written to %s\n", jobs[j].input, jobs[i].input, jobs[i].target);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static void main_remove_temporaries(struct main_job *jobs, int total_jobs, const char *temp_dir)
+{
+    for (int i = 0; i < total_jobs; i++)
+    {
+        unlink(jobs[i].asm_file);
+        unlink(jobs[i].object_file);
+    }
+    rmdir(temp_dir);
+}
+
+// What became of an input given to main_run_inputs
+enum
+{
+    MAIN_INPUT_NOT_RUN,
+    MAIN_INPUT_OK,
+    MAIN_INPUT_FAILED
+};
+
+/**
+ * Runs the function on every input, one after the other in a worker process so they still share
+ * what the compiler keeps in memory such as the include cache. A compiler error ends the worker,
+ * the input it was on is failed and a new worker carries on from the next one. The worker flushes
+ * what it wrote before it ends, the output of every input is in order. Returns the number of inputs
+ * that failed, each is reported with the given reason.
+ */
+static int main_run_inputs(const char **inputs, int total_inputs, int (*run)(const char *input, void *data), void *data, const char *reason)
+{
+    // The worker writes the state of every input here as it goes, the parent reads it when it ends
+    char *states = mmap(NULL, total_inputs, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (states == MAP_FAILED)
+    {
+        fprintf(stderr, "Unable to start a worker\n");
+        return total_inputs;
+    }
+    memset(states, MAIN_INPUT_NOT_RUN, total_inputs);
+
+    int next = 0;
+    while (next < total_inputs)
+    {
+        // Anything left in our buffers would be written twice otherwise
+        fflush(NULL);
+        pid_t pid = fork();
+        if (pid == 0)
+        {
+            for (int i = next; i < total_inputs; i++)
+            {
+                states[i] = run(inputs[i], data) == COMPILER_FILE_COMPILED_OK ? MAIN_INPUT_OK : MAIN_INPUT_FAILED;
+            }
+            exit(0);
+        }
+
+        if (pid < 0)
+        {
+            fprintf(stderr, "Unable to start a worker\n");
+            break;
+        }
+
+        waitpid(pid, NULL, 0);
+        while (next < total_inputs && states[next] != MAIN_INPUT_NOT_RUN)
+        {
+            next++;
+        }
+
+        // The worker ended on this input
+        if (next < total_inputs)
+        {
+            states[next++] = MAIN_INPUT_FAILED;
+        }
+    }
+
+    int failed = 0;
+    for (int i = 0; i < total_inputs; i++)
+    {
+        if (states[i] != MAIN_INPUT_OK)
+        {
+            fprintf(stderr, "%s: %s\n", inputs[i], reason);
+            failed++;
+        }
+    }
+    munmap(states, total_inputs);
+    return failed;
+}
+
+struct main_input_data
+{
+    FILE *out;
+    int compile_flags;
+};
+
+static int main_scan_input(const char *input, void *data)
+{
+    struct main_input_data *input_data = data;
+    char target[PATH_MAX];
+    main_output_name(input, ".o", target);
+    return compile_dependencies(input, target, input_data->out, input_data->compile_flags);
+}
+
+/**
+ * Writes the make rule of every input to the dependency file, stdout if there is none.
+ * Inputs are scanned one after the other so they share the include cache. Returns the number
+ * of inputs that could not be scanned, the rules of the others are still written.
+ */
+static int main_scan_dependencies(const char **inputs, int total_inputs, const char *depend_file, int compile_flags)
+{
+    FILE *out = depend_file ? fopen(depend_file, "w") : stdout;
+    if (!out)
+    {
+        fprintf(stderr, "Unable to write the dependencies to %s\n", depend_file);
+        return total_inputs;
+    }
+
+    struct main_input_data input_data = {out, compile_flags};
+    int failed = main_run_inputs(inputs, total_inputs, main_scan_input, &input_data, "scanning dependencies failed");
+    if (depend_file && fclose(out) != 0)
+    {
+        fprintf(stderr, "Unable to write the dependencies to %s\n", depend_file);
+        return total_inputs;
+    }
+    return failed;
+}
+
+static int main_preprocess_input(const char *input, void *data)
+{
+    struct main_input_data *input_data = data;
+    return compile_preprocess(input, input_data->out, input_data->compile_flags);
+}
+
+/**
+ * Writes the preprocessed source of every input to the output file, stdout if there is none.
+ * Returns the number of inputs that could not be preprocessed, the others are still written.
+ */
+static int main_preprocess(const char **inputs, int total_inputs, const char *output_file, int compile_flags)
+{
+    FILE *out = output_file ? fopen(output_file, "w") : stdout;
+    if (!out)
+    {
+        fprintf(stderr, "Unable to write the preprocessed output to %s\n", output_file);
+        return total_inputs;
+    }
+
+    struct main_input_data input_data = {out, compile_flags};
+    int failed = main_run_inputs(inputs, total_inputs, main_preprocess_input, &input_data, "preprocessing failed");
+    if (output_file && fclose(out) != 0)
+    {
+        fprintf(stderr, "Unable to write the preprocessed output to %s\n", output_file);
+        return total_inputs;
+    }
+    return failed;
+}
+
+/**
+ * Compiles every job using up to total_workers processes at once, a failing job
+ * does not stop the others. Returns the number of jobs that failed.
+ */
+static int main_run_jobs(struct main_job *jobs, int total_jobs, int total_workers, int compile_flags)
+{
+    int next = 0;
+    int running = 0;
+    int failed = 0;
+    while (next < total_jobs || running > 0)
+    {
+        while (running < total_workers && next < total_jobs)
+        {
+            struct main_job *job = &jobs[next++];
+            // Anything left in our buffers would be written twice otherwise
+            fflush(NULL);
+            job->pid = fork();
+            if (job->pid == 0)
+            {
+                exit(main_compile(job, compile_flags) == 0 ? 0 : 1);
+            }
+
+            if (job->pid < 0)
+            {
+                fprintf(stderr, "%s: could not start a worker\n", job->input);
+                failed++;
+                continue;
+            }
+            running++;
+        }
+
+        if (running == 0)
+        {
+            continue;
+        }
+
+        int status = 0;
+        pid_t pid = wait(&status);
+        if (pid < 0)
+        {
+            break;
+        }
+
+        for (int i = 0; i < next; i++)
+        {
+            if (jobs[i].pid != pid)
+            {
+                continue;
+            }
+
+            running--;
+            if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+            {
+                fprintf(stderr, "%s: compilation failed\n", jobs[i].input);
+                failed++;
+            }
+            break;
+        }
+    }
+
+    return failed;
+}
 
 int main(int argc, char **argv)
 {
-    const char *input_file = "./test.c";
-    const char *output_file = "./a.out";
-    const char *option = "exec";
-    if (argc > 1)
+    const char *positional[] = {"./test.c", "./a.out", "exec"};
+    int total_positional = 0;
+    const char **inputs = calloc(argc, sizeof(const char *));
+    int total_inputs = 0;
+    const char *output_file = NULL;
+    bool objects_only = false;
+    bool emit_pch = false;
+    bool scan_dependencies = false;
+    bool preprocess_only = false;
+    bool write_dependencies = false;
+    const char *depend_file = NULL;
+    int total_workers = 1;
+    int compile_flags = 0;
+
+    // Options start with "-" and can go anywhere, everything else is positional
+    for (int i = 1; i < argc; i++)
+    {
+        if (S_EQ(argv[i], "--nasm"))
+        {
+            // Assemble with NASM rather than the internal assembler
+            compile_flags |= COMPILE_PROCESS_EXECUTE_NASM;
+        }
+        else if (S_EQ(argv[i], "--time-report"))
+        {
+            compile_flags |= COMPILE_PROCESS_TIME_REPORT;
+        }
+        else if (S_EQ(argv[i], "--time-report=json"))
+        {
+            compile_flags |= COMPILE_PROCESS_TIME_REPORT | COMPILE_PROCESS_TIME_REPORT_JSON;
+        }
+        else if (S_EQ(argv[i], "--no-peephole"))
+        {
+            compile_flags |= COMPILE_PROCESS_NO_PEEPHOLE;
+        }
+        else if (S_EQ(argv[i], "--no-ir"))
+        {
+            compile_flags |= COMPILE_PROCESS_NO_IR;
+        }
+        else if (S_EQ(argv[i], "--emit-ir"))
+        {
+            compile_flags |= COMPILE_PROCESS_EMIT_IR;
+        }
+        else if (S_EQ(argv[i], "--no-fold"))
+        {
+            compile_flags |= COMPILE_PROCESS_NO_FOLD;
+        }
+        else if (S_EQ(argv[i], "--no-simd"))
+        {
+            compile_flags |= COMPILE_PROCESS_NO_SIMD;
+        }
+        else if (S_EQ(argv[i], "--no-macro-cache"))
+        {
+            compile_flags |= COMPILE_PROCESS_NO_MACRO_CACHE;
+        }
+        else if (S_EQ(argv[i], "--no-skip-inactive"))
+        {
+            compile_flags |= COMPILE_PROCESS_NO_SKIP_INACTIVE;
+        }
+        else if (strncmp(argv[i], "--token-cache=", 14) == 0)
+        {
+            token_cache_set_directory(argv[i] + 14);
+        }
+        else if (strncmp(argv[i], "--include-cache=", 16) == 0)
+        {
+            include_cache_set_file(argv[i] + 16);
+        }
+        else if (S_EQ(argv[i], "--emit-pch"))
+        {
+            emit_pch = true;
+        }
+        else if (strncmp(argv[i], "--include-pch=", 14) == 0)
+        {
+            pch_set_include(argv[i] + 14);
+        }
+        else if (S_EQ(argv[i], "-M"))
+        {
+            scan_dependencies = true;
+        }
+        else if (S_EQ(argv[i], "-MD"))
+        {
+            write_dependencies = true;
+        }
+        else if (S_EQ(argv[i], "-MF") && i + 1 < argc)
+        {
+            depend_file = argv[++i];
+        }
+        else if (S_EQ(argv[i], "--directives-only"))
+        {
+            compile_flags |= COMPILE_PROCESS_DIRECTIVES_ONLY;
+        }
+        else if (S_EQ(argv[i], "-E"))
+        {
+            preprocess_only = true;
+        }
+        else if (S_EQ(argv[i], "-v") || S_EQ(argv[i], "--verbose"))
+        {
+            compile_flags |= COMPILE_PROCESS_VERBOSE;
+        }
+        else if (S_EQ(argv[i], "-c"))
+        {
+            objects_only = true;
+        }
+        else if (S_EQ(argv[i], "-o") && i + 1 < argc)
+        {
+            output_file = argv[++i];
+        }
+        else if (strncmp(argv[i], "-j", 2) == 0)
+        {
+            const char *value = argv[i][2] ? &argv[i][2] : (i + 1 < argc ? argv[++i] : "");
+            total_workers = atoi(value);
+            if (total_workers <= 0)
+            {
+                fprintf(stderr, "Invalid number of jobs \"%s\"\n", value);
+                return -1;
+            }
+        }
+        else
+        {
+            inputs[total_inputs++] = argv[i];
+            if (total_positional < sizeof(positional) / sizeof(const char *))
+            {
+                positional[total_positional++] = argv[i];
+            }
+        }
+    }
+
+    if (emit_pch)
     {
-        input_file = argv[1];
+        const char *pch_file = output_file ? output_file : positional[1];
+        return compile_pch(positional[0], pch_file, compile_flags) == COMPILER_FILE_COMPILED_OK ? 0 : -1;
     }
-    if (argc > 2)
+
+    if (scan_dependencies)
     {
-        output_file = argv[2];
+        if (total_inputs == 0)
+        {
+            fprintf(stderr, "No input files\n");
+            return -1;
+        }
+
+        int failed = main_scan_dependencies(inputs, total_inputs, depend_file, compile_flags);
+        return failed ? 1 : 0;
     }
-    if (argc > 3)
+
+    if (preprocess_only)
     {
-        option = argv[3];
+        if (total_inputs == 0)
+        {
+            fprintf(stderr, "No input files\n");
+            return -1;
+        }
+
+        int failed = main_preprocess(inputs, total_inputs, output_file, compile_flags | COMPILE_PROCESS_PREPROCESS_ONLY);
+        return failed ? 1 : 0;
     }
 
-    int compile_flags = COMPILE_PROCESS_EXECUTE_NASM;
-    if (S_EQ(option, "object"))
+    // Directive lines alone are only enough to find the headers
+    compile_flags &= ~COMPILE_PROCESS_DIRECTIVES_ONLY;
+    if (!objects_only && !output_file)
     {
-        compile_flags |= COMPILE_PROCESS_EXPORT_AS_OBJECT;
+        // The original single file form, main input output [exec|object]
+        const char *input_file = positional[0];
+        output_file = positional[1];
+        if (S_EQ(positional[2], "object"))
+        {
+            compile_flags |= COMPILE_PROCESS_EXPORT_AS_OBJECT;
+        }
+
+        struct main_job job = {};
+        job.input = input_file;
+        strncpy(job.asm_file, output_file, PATH_MAX - 1);
+        snprintf(job.object_file, PATH_MAX, "%s.o", output_file);
+        strncpy(job.target, job.object_file, PATH_MAX - 1);
+        if (write_dependencies)
+        {
+            if (depend_file)
+                strncpy(job.depend_file, depend_file, PATH_MAX - 1);
+            else
+                main_replace_extension(job.object_file, ".d", job.depend_file);
+        }
+        if (main_compile(&job, compile_flags) < 0)
+        {
+            return -1;
+        }
+
+        if (!(compile_flags & COMPILE_PROCESS_EXPORT_AS_OBJECT))
+        {
+            return main_link(&job, 1, output_file);
+        }
+        return 0;
     }
 
-    if (compile_file(input_file, output_file, compile_flags) != COMPILER_FILE_COMPILED_OK)
+    if (total_inputs == 0)
     {
-        printf("Problem compiling file\n");
+        fprintf(stderr, "No input files\n");
+        return -1;
     }
 
-    // We should invoke the NASM assembler if we are instructed to do so.
-    if (compile_flags & COMPILE_PROCESS_EXECUTE_NASM)
+    if (objects_only)
     {
-        char nasm_output_file[40];
-        char nasm_cmd[512];
-        sprintf(nasm_output_file, "%s.o", output_file);
+        compile_flags |= COMPILE_PROCESS_EXPORT_AS_OBJECT;
+    }
 
-        if (compile_flags & COMPILE_PROCESS_EXPORT_AS_OBJECT)
+    // Objects that are only linked go to a directory of our own, inputs with the same name would overwrite each other
+    char temp_dir[] = "/tmp/main-XXXXXX";
+    if (!objects_only && !mkdtemp(temp_dir))
+    {
+        fprintf(stderr, "Unable to create a temporary directory\n");
+        return -1;
+    }
+
+    struct main_job *jobs = calloc(total_inputs, sizeof(struct main_job));
+    for (int i = 0; i < total_inputs; i++)
+    {
+        jobs[i].input = inputs[i];
+        main_output_name(inputs[i], ".o", jobs[i].target);
+        if (objects_only)
         {
-            sprintf(nasm_cmd, "nasm -f elf32 %s -o %s", output_file, nasm_output_file);
+            main_output_name(inputs[i], ".asm", jobs[i].asm_file);
+            strncpy(jobs[i].object_file, jobs[i].target, PATH_MAX - 1);
         }
         else
         {
-            sprintf(nasm_cmd, "nasm -f elf32 %s -o %s && gcc -m32 %s -o %s", output_file, nasm_output_file, nasm_output_file, output_file);
+            snprintf(jobs[i].asm_file, PATH_MAX, "%s/%i.asm", temp_dir, i);
+            snprintf(jobs[i].object_file, PATH_MAX, "%s/%i.o", temp_dir, i);
         }
+    }
 
-        printf("%s", nasm_cmd);
-        int res = system(nasm_cmd);
-        if (res < 0)
+    // Same as GCC, -c -o names the object file when there is only one input
+    if (objects_only && output_file && total_inputs == 1)
+    {
+        strncpy(jobs[0].object_file, output_file, PATH_MAX - 1);
+        strncpy(jobs[0].target, output_file, PATH_MAX - 1);
+    }
+
+    for (int i = 0; write_dependencies && i < total_inputs; i++)
+    {
+        if (depend_file && total_inputs == 1)
+            strncpy(jobs[i].depend_file, depend_file, PATH_MAX - 1);
+        else
+            main_replace_extension(jobs[i].target, ".d", jobs[i].depend_file);
+    }
+
+    if ((objects_only || write_dependencies) && !main_targets_unique(jobs, total_inputs))
+    {
+        if (!objects_only)
         {
-            printf("Issue assembling the assembly file with NASM and linking with GCC");
-            return res;
+            rmdir(temp_dir);
         }
+        return -1;
+    }
 
+    int failed = main_run_jobs(jobs, total_inputs, total_workers, compile_flags);
+    if (failed)
+    {
+        fprintf(stderr, "%i of %i files failed to compile\n", failed, total_inputs);
+    }
 
+    if (objects_only)
+    {
+        return failed ? 1 : 0;
     }
-    return 0;
-}
\ No newline at end of file
+
+    int res = failed ? 1 : main_link(jobs, total_inputs, output_file);
+    main_remove_temporaries(jobs, total_inputs, temp_dir);
+    return res;
+}
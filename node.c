@@ -15,6 +15,9 @@ struct token *parser_last_token = NULL;
 struct vector *node_vector = NULL;
 struct vector *node_vector_root = NULL;
 
+// Used for the time report
+static size_t total_nodes_created = 0;
+
 void node_set_vector(struct vector *vec, struct vector *root_vec)
 {
     node_vector = vec;
@@ -97,8 +100,14 @@ void node_swap(struct node **f_node, struct node **s_node)
     *s_node = tmp_node;
 }
 
+size_t node_total_created()
+{
+    return total_nodes_created;
+}
+
 struct node *node_create(struct node *_node)
 {
+    total_nodes_created++;
     struct node *node = malloc(sizeof(struct node));
     memcpy(node, _node, sizeof(struct node));
     node->binded.owner = parser_current_body;
@@ -324,15 +324,48 @@ void parser_scope_offset(struct node *node, struct history *history)
     parser_scope_offset_for_stack(node, history);
 }
 
+// Atoms for the operators of expressions the parser builds itself rather than from a token
+static const char *parser_op_array;
+static const char *parser_op_tenary;
+static const char *parser_op_comma;
+static const char *parser_op_call;
+
+/**
+ * Replaces every operator in the precedence table with its atom, so operator
+ * lookups are pointer compares. Only the first call does any work.
+ */
+static void parser_intern_operator_precedence()
+{
+    static bool interned = false;
+    if (interned)
+    {
+        return;
+    }
+
+    for (int i = 0; i < TOTAL_OPERATOR_GROUPS; i++)
+    {
+        for (int b = 0; op_precedence[i].operators[b]; b++)
+        {
+            op_precedence[i].operators[b] = (char *)atom(op_precedence[i].operators[b]);
+        }
+    }
+    parser_op_array = atom("[]");
+    parser_op_tenary = atom("?");
+    parser_op_comma = atom(",");
+    parser_op_call = atom("()");
+    interned = true;
+}
+
 static int parser_get_precedence_for_operator(const char *op, struct op_precedence_group **group_out)
 {
+    // Operators come from tokens or the parser itself, both are atoms
     *group_out = NULL;
     for (int i = 0; i < TOTAL_OPERATOR_GROUPS; i++)
     {
         for (int b = 0; op_precedence[i].operators[b]; b++)
         {
             const char *_op = op_precedence[i].operators[b];
-            if (S_EQ(op, _op))
+            if (op == _op)
             {
                 *group_out = &op_precedence[i];
                 return i;
@@ -349,7 +382,7 @@ static bool parser_left_op_has_priority(const char *op_left, const char *op_righ
     struct op_precedence_group *group_right = NULL;
 
     // Same operator? Then they have equal priority!
-    if (S_EQ(op_left, op_right))
+    if (op_left == op_right)
         return false;
 
     int precedence_left = parser_get_precedence_for_operator(op_left, &group_left);
@@ -384,36 +417,17 @@ static bool parser_is_unary_operator(const char *op)
     return is_unary_operator(op);
 }
 
-static bool token_is_nl_or_comment_or_newline_seperator(struct token *token)
-{
-    return token->type == TOKEN_TYPE_NEWLINE ||
-           token->type == TOKEN_TYPE_COMMENT ||
-           token_is_symbol(token, '\\');
-}
-
-static void parser_ignore_nl_or_comment(struct token *next_token)
-{
-    while (next_token && token_is_nl_or_comment_or_newline_seperator(next_token))
-    {
-        // Skip the token
-        vector_peek(current_process->token_vec);
-        // The parser does not care about new lines, only the preprocessor has to care about that
-        next_token = vector_peek_no_increment(current_process->token_vec);
-    }
-}
+// The preprocessor removes new lines and comments, the parser never sees them.
 static struct token *token_next()
 {
-    struct token *next_token = vector_peek_no_increment(current_process->token_vec);
-    parser_ignore_nl_or_comment(next_token);
+    struct token *next_token = vector_peek(current_process->token_vec);
     current_process->pos = next_token->pos;
     parser_last_token = next_token;
-    return vector_peek(current_process->token_vec);
+    return next_token;
 }
 
 static struct token *token_peek_next()
 {
-    struct token *next_token = vector_peek_no_increment(current_process->token_vec);
-    parser_ignore_nl_or_comment(next_token);
     return vector_peek_no_increment(current_process->token_vec);
 }
 
@@ -490,14 +504,20 @@ void token_read_dots(size_t total)
     }
 }
 
-static bool is_keyword_variable_modifier(const char *val)
+static bool is_keyword_variable_modifier(int keyword)
 {
-    return S_EQ(val, "unsigned") ||
-           S_EQ(val, "signed") ||
-           S_EQ(val, "static") ||
-           S_EQ(val, "const") ||
-           S_EQ(val, "extern") ||
-           S_EQ(val, "__ignore_typecheck__");
+    switch (keyword)
+    {
+    case KEYWORD_UNSIGNED:
+    case KEYWORD_SIGNED:
+    case KEYWORD_STATIC:
+    case KEYWORD_CONST:
+    case KEYWORD_EXTERN:
+    case KEYWORD_IGNORE_TYPECHECK:
+        return true;
+    }
+
+    return false;
 }
 
 void parse_single_token_to_node()
@@ -1388,7 +1408,7 @@ void parse_keyword(struct history *history)
 {
     struct token *token = token_peek_next();
 
-    if (S_EQ(token->sval, "sizeof"))
+    if (token->keyword == KEYWORD_SIZEOF)
     {
         // This should be in the preprocessor but its not advacned enough
         // I hope we can get away with it here in the parser, time will tell
@@ -1400,64 +1420,45 @@ void parse_keyword(struct history *history)
     // Therefore variable declarations will be the appropaite action
     // if all other keywords are not present.
     // This will be changed soon
-    if (is_keyword_variable_modifier(token->sval) || keyword_is_datatype(token->sval))
+    if (is_keyword_variable_modifier(token->keyword) || keyword_id_is_datatype(token->keyword))
     {
         parse_variable_function_or_struct_union(history);
         return;
     }
 
-    if (S_EQ(token->sval, "return"))
+    switch (token->keyword)
     {
+    case KEYWORD_RETURN:
         parse_keyword_return(history);
         return;
-    }
-    else if (S_EQ(token->sval, "if"))
-    {
+    case KEYWORD_IF:
         parse_if(history);
         return;
-    }
-    else if (S_EQ(token->sval, "while"))
-    {
+    case KEYWORD_WHILE:
         parse_while(history);
         return;
-    }
-    else if (S_EQ(token->sval, "for"))
-    {
+    case KEYWORD_FOR:
         parse_for(history);
         return;
-    }
-    else if (S_EQ(token->sval, "do"))
-    {
+    case KEYWORD_DO:
         parse_do_while(history);
         return;
-    }
-    else if (S_EQ(token->sval, "break"))
-    {
+    case KEYWORD_BREAK:
         parse_break(history);
         return;
-    }
-    else if (S_EQ(token->sval, "continue"))
-    {
+    case KEYWORD_CONTINUE:
         parse_continue(history);
         return;
-    }
-    else if (S_EQ(token->sval, "switch"))
-    {
+    case KEYWORD_SWITCH:
         parse_switch(history);
         return;
-    }
-    else if (S_EQ(token->sval, "case"))
-    {
+    case KEYWORD_CASE:
         parse_case(history);
         return;
-    }
-    else if (S_EQ(token->sval, "default"))
-    {
+    case KEYWORD_DEFAULT:
         parse_default(history);
         return;
-    }
-    else if (S_EQ(token->sval, "goto"))
-    {
+    case KEYWORD_GOTO:
         parse_goto(history);
         return;
     }
@@ -1563,7 +1564,7 @@ void parse_for_array(struct history *history)
         // Ok we do so we must create an expression node, whose left node is the left node
         // and whose right node is the array bracket node
         struct node *bracket_node = node_pop();
-        make_exp_node(left_node, bracket_node, "[]");
+        make_exp_node(left_node, bracket_node, parser_op_array);
     }
 }
 
@@ -1591,7 +1592,7 @@ void parse_for_tenary(struct history *history)
     // We may need to make this into an expression node later on..
     // Not sure how this is going to turn out.. lets try and make an expression
     struct node *tenary_node = node_pop();
-    make_exp_node(condition_operand, tenary_node, "?");
+    make_exp_node(condition_operand, tenary_node, parser_op_tenary);
 }
 
 void parse_for_comma(struct history *history)
@@ -1604,7 +1605,7 @@ void parse_for_comma(struct history *history)
     parse_expressionable_root(history);
 
     struct node *node_right = node_pop();
-    make_exp_node(node_left, node_right, ",");
+    make_exp_node(node_left, node_right, parser_op_comma);
 }
 
 int parse_exp(struct history *history)
@@ -1857,7 +1858,7 @@ void parse_for_parentheses(struct history *history)
         // Ok we do so we must create an expression node, whose left node is the left node
         // and whose right node is the parentheses node
         struct node *parentheses_node = node_pop();
-        make_exp_node(left_node, parentheses_node, "()");
+        make_exp_node(left_node, parentheses_node, parser_op_call);
     }
 
     // We got anything else?
@@ -1874,34 +1875,31 @@ void parse_datatype_modifiers(struct datatype *datatype)
     // Datatypes can have many modifiers.
     while (token && token->type == TOKEN_TYPE_KEYWORD)
     {
-        if (!is_keyword_variable_modifier(token->sval))
+        if (!is_keyword_variable_modifier(token->keyword))
         {
             break;
         }
 
-        if (S_EQ(token->sval, "signed"))
+        switch (token->keyword)
         {
+        case KEYWORD_SIGNED:
             datatype->flags |= DATATYPE_FLAG_IS_SIGNED;
-        }
-        else if (S_EQ(token->sval, "unsigned"))
-        {
+            break;
+        case KEYWORD_UNSIGNED:
             datatype->flags &= ~DATATYPE_FLAG_IS_SIGNED;
-        }
-        else if (S_EQ(token->sval, "static"))
-        {
+            break;
+        case KEYWORD_STATIC:
             datatype->flags |= DATATYPE_FLAG_IS_STATIC;
-        }
-        else if (S_EQ(token->sval, "const"))
-        {
+            break;
+        case KEYWORD_CONST:
             datatype->flags |= DATATYPE_FLAG_IS_CONST;
-        }
-        else if (S_EQ(token->sval, "extern"))
-        {
+            break;
+        case KEYWORD_EXTERN:
             datatype->flags |= DATATYPE_FLAG_IS_EXTERN;
-        }
-        else if (S_EQ(token->sval, "__ignore_typecheck__"))
-        {
+            break;
+        case KEYWORD_IGNORE_TYPECHECK:
             datatype->flags |= DATATYPE_FLAG_IGNORE_TYPE_CHECKING;
+            break;
         }
 
         // We dealt with this modifier token, move along.
@@ -2666,6 +2664,7 @@ int parse(struct compile_process *process)
     // This scope will help us generate static offsets to be used during compile time.
     scope_create_root(process);
     current_process = process;
+    parser_intern_operator_precedence();
     parser_blank_node = node_create(&(struct node){.type = NODE_TYPE_BLANK});
     parser_fixup_sys = fixup_sys_new();
 
@@ -0,0 +1,572 @@
+#include "compiler.h"
+#include "helpers/vector.h"
+#include <ctype.h>
+#include <stdarg.h>
+
+/**
+ * A rule looks at the instruction at the index and the ones that follow it,
+ * returns how many instructions it removed, zero if it did not match
+ */
+typedef int (*PEEPHOLE_RULE_APPLY)(struct peephole *peephole, int index);
+
+struct peephole_rule
+{
+    const char *name;
+    PEEPHOLE_RULE_APPLY apply;
+};
+
+static const char *peephole_directives[] = {"global", "extern", "section", "db", "dw", "dd", "dq", "times", NULL};
+
+// Registers that share bits are in the same family, writing to al changes eax
+static const char *peephole_register_families[][4] = {
+    {"eax", "ax", "al", "ah"},
+    {"ebx", "bx", "bl", "bh"},
+    {"ecx", "cx", "cl", "ch"},
+    {"edx", "dx", "dl", "dh"},
+    {"esi", "si"},
+    {"edi", "di"},
+    {"ebp", "bp"},
+    {"esp", "sp"}};
+
+#define PEEPHOLE_TOTAL_REGISTER_FAMILIES (sizeof(peephole_register_families) / sizeof(peephole_register_families[0]))
+
+// Condition codes and the condition code that is true when they are false
+static const char *peephole_conditions[][2] = {
+    {"e", "ne"},
+    {"z", "nz"},
+    {"l", "ge"},
+    {"g", "le"},
+    {"b", "ae"},
+    {"a", "be"}};
+
+#define PEEPHOLE_TOTAL_CONDITIONS (sizeof(peephole_conditions) / sizeof(peephole_conditions[0]))
+
+static struct peephole_instruction *peephole_at(struct peephole *peephole, int index)
+{
+    return vector_at(peephole->instructions, index);
+}
+
+/**
+ * Returns the index of the next line that is not a comment or removed, -1 if there is none
+ */
+static int peephole_next(struct peephole *peephole, int index)
+{
+    for (int i = index + 1; i < vector_count(peephole->instructions); i++)
+    {
+        struct peephole_instruction *instruction = peephole_at(peephole, i);
+        if (!instruction->removed && instruction->type != PEEPHOLE_LINE_TYPE_COMMENT)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static struct peephole_instruction *peephole_next_instruction(struct peephole *peephole, int index)
+{
+    int next = peephole_next(peephole, index);
+    return next != -1 ? peephole_at(peephole, next) : NULL;
+}
+
+static bool peephole_is(struct peephole_instruction *instruction, const char *mnemonic, int total_operands)
+{
+    return instruction &&
+           instruction->type == PEEPHOLE_LINE_TYPE_INSTRUCTION &&
+           instruction->total_operands == total_operands &&
+           S_EQ(instruction->mnemonic, mnemonic);
+}
+
+static bool peephole_is_jump(struct peephole_instruction *instruction)
+{
+    return instruction->type == PEEPHOLE_LINE_TYPE_INSTRUCTION &&
+           instruction->mnemonic[0] == 'j' &&
+           instruction->total_operands == 1;
+}
+
+static int peephole_register_family(const char *name)
+{
+    for (int i = 0; i < PEEPHOLE_TOTAL_REGISTER_FAMILIES; i++)
+    {
+        for (int j = 0; j < 4 && peephole_register_families[i][j]; j++)
+        {
+            if (S_EQ(peephole_register_families[i][j], name))
+            {
+                return i;
+            }
+        }
+    }
+    return -1;
+}
+
+static bool peephole_operand_is_register(const char *operand)
+{
+    return peephole_register_family(operand) != -1;
+}
+
+/**
+ * Returns true if any register in the operand, i.e the base of "dword [eax+4]", shares bits with the register
+ */
+static bool peephole_operand_uses_register(const char *operand, const char *reg)
+{
+    int family = peephole_register_family(reg);
+    char word[CODEGEN_LINE_MAX];
+    while (*operand)
+    {
+        if (!isalnum(*operand))
+        {
+            operand++;
+            continue;
+        }
+
+        int len = 0;
+        while (isalnum(*operand))
+        {
+            word[len++] = *operand++;
+        }
+        word[len] = 0;
+        if (family != -1 && peephole_register_family(word) == family)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static char *peephole_trim(char *str)
+{
+    while (isspace(*str))
+    {
+        str++;
+    }
+
+    char *end = str + strlen(str);
+    while (end > str && isspace(end[-1]))
+    {
+        *--end = 0;
+    }
+    return str;
+}
+
+/**
+ * Splits the parts of the instruction into its mnemonic and operands
+ */
+static void peephole_parse(struct peephole_instruction *instruction)
+{
+    instruction->type = PEEPHOLE_LINE_TYPE_INSTRUCTION;
+    instruction->mnemonic = "";
+    instruction->total_operands = 0;
+
+    char *ptr = peephole_trim(instruction->parts);
+    if (*ptr == 0 || *ptr == ';')
+    {
+        instruction->type = PEEPHOLE_LINE_TYPE_COMMENT;
+        return;
+    }
+
+    char *end = ptr;
+    while (*end && !isspace(*end))
+    {
+        end++;
+    }
+
+    char *operands = *end ? end + 1 : end;
+    *end = 0;
+    instruction->mnemonic = ptr;
+    if (end[-1] == ':')
+    {
+        // The mnemonic of a label is its name
+        end[-1] = 0;
+        instruction->type = PEEPHOLE_LINE_TYPE_LABEL;
+        return;
+    }
+
+    for (int i = 0; peephole_directives[i]; i++)
+    {
+        if (S_EQ(ptr, peephole_directives[i]))
+        {
+            instruction->type = PEEPHOLE_LINE_TYPE_DIRECTIVE;
+            return;
+        }
+    }
+
+    operands = peephole_trim(operands);
+    if (*operands == 0)
+    {
+        return;
+    }
+
+    // Operands are separated by commas that are not inside brackets or quotes
+    int depth = 0;
+    char quote = 0;
+    char *start = operands;
+    for (char *c = operands;; c++)
+    {
+        if (quote && *c)
+        {
+            quote = *c == quote ? 0 : quote;
+            continue;
+        }
+
+        if (*c == '\'' || *c == '"')
+        {
+            quote = *c;
+        }
+        else if (*c == '[')
+        {
+            depth++;
+        }
+        else if (*c == ']')
+        {
+            depth--;
+        }
+        else if ((*c == ',' && depth == 0) || *c == 0)
+        {
+            if (instruction->total_operands == PEEPHOLE_MAX_OPERANDS)
+            {
+                // Nothing we know about, no rule will touch it
+                instruction->type = PEEPHOLE_LINE_TYPE_DIRECTIVE;
+                return;
+            }
+
+            bool last = *c == 0;
+            *c = 0;
+            instruction->operands[instruction->total_operands++] = peephole_trim(start);
+            start = c + 1;
+            if (last)
+            {
+                break;
+            }
+        }
+    }
+}
+
+static void peephole_set_line(struct peephole_instruction *instruction, const char *line)
+{
+    free(instruction->line);
+    free(instruction->parts);
+    instruction->line = strdup(line);
+    instruction->parts = strdup(line);
+    peephole_parse(instruction);
+}
+
+static void peephole_replace(struct peephole_instruction *instruction, const char *fmt, ...)
+{
+    char line[CODEGEN_LINE_MAX * 2];
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(line, sizeof(line), fmt, args);
+    va_end(args);
+    peephole_set_line(instruction, line);
+}
+
+static void peephole_remove(struct peephole_instruction *instruction)
+{
+    instruction->removed = true;
+}
+
+/**
+ * push a
+ * pop b
+ *
+ * Becomes "mov b, a", or nothing at all when a and b are the same.
+ */
+static int peephole_rule_push_pop(struct peephole *peephole, int index)
+{
+    struct peephole_instruction *push = peephole_at(peephole, index);
+    struct peephole_instruction *pop = peephole_next_instruction(peephole, index);
+    if (!peephole_is(push, "push", 1) || !peephole_is(pop, "pop", 1))
+    {
+        return 0;
+    }
+
+    const char *source = push->operands[0];
+    const char *destination = pop->operands[0];
+    if (strstr(source, "esp") || strstr(destination, "esp"))
+    {
+        return 0;
+    }
+
+    if (S_EQ(source, destination))
+    {
+        peephole_remove(push);
+        peephole_remove(pop);
+        return 2;
+    }
+
+    // Memory to memory cannot be moved and an immediate needs a register to size it
+    if (!peephole_operand_is_register(source) && !peephole_operand_is_register(destination))
+    {
+        return 0;
+    }
+
+    peephole_replace(push, "mov %s, %s", destination, source);
+    peephole_remove(pop);
+    return 1;
+}
+
+/**
+ * mov a, b
+ * mov b, a
+ *
+ * The second move changes nothing, i.e storing a register and loading it straight back.
+ */
+static int peephole_rule_redundant_move(struct peephole *peephole, int index)
+{
+    struct peephole_instruction *first = peephole_at(peephole, index);
+    struct peephole_instruction *second = peephole_next_instruction(peephole, index);
+    if (!peephole_is(first, "mov", 2) || !peephole_is(second, "mov", 2))
+    {
+        return 0;
+    }
+
+    if (!S_EQ(first->operands[0], second->operands[1]) || !S_EQ(first->operands[1], second->operands[0]))
+    {
+        return 0;
+    }
+
+    // mov eax, [eax] moves the address, storing eax back would write somewhere else
+    if (peephole_operand_is_register(first->operands[0]) && peephole_operand_uses_register(first->operands[1], first->operands[0]))
+    {
+        return 0;
+    }
+
+    peephole_remove(second);
+    return 1;
+}
+
+/**
+ * mov a, a
+ */
+static int peephole_rule_self_move(struct peephole *peephole, int index)
+{
+    struct peephole_instruction *instruction = peephole_at(peephole, index);
+    if (!peephole_is(instruction, "mov", 2) ||
+        !peephole_operand_is_register(instruction->operands[0]) ||
+        !S_EQ(instruction->operands[0], instruction->operands[1]))
+    {
+        return 0;
+    }
+
+    peephole_remove(instruction);
+    return 1;
+}
+
+/**
+ * setl al
+ * movzx eax, al
+ * cmp eax, 0
+ * je label
+ *
+ * The flags the set instruction used are still there, jump on them directly with "jge label".
+ * eax is still set in case anything reads it.
+ */
+static int peephole_rule_compare_after_set(struct peephole *peephole, int index)
+{
+    struct peephole_instruction *set = peephole_at(peephole, index);
+    if (set->type != PEEPHOLE_LINE_TYPE_INSTRUCTION || set->total_operands != 1 || strncmp(set->mnemonic, "set", 3) != 0)
+    {
+        return 0;
+    }
+
+    int movzx_index = peephole_next(peephole, index);
+    struct peephole_instruction *movzx = peephole_next_instruction(peephole, index);
+    if (!peephole_is(movzx, "movzx", 2) || !S_EQ(movzx->operands[1], set->operands[0]))
+    {
+        return 0;
+    }
+
+    int cmp_index = peephole_next(peephole, movzx_index);
+    struct peephole_instruction *cmp = peephole_next_instruction(peephole, movzx_index);
+    if (!peephole_is(cmp, "cmp", 2) || !S_EQ(cmp->operands[0], movzx->operands[0]) || !S_EQ(cmp->operands[1], "0"))
+    {
+        return 0;
+    }
+
+    struct peephole_instruction *jump = peephole_next_instruction(peephole, cmp_index);
+    if (!jump || (!peephole_is(jump, "je", 1) && !peephole_is(jump, "jne", 1)))
+    {
+        return 0;
+    }
+
+    const char *condition = &set->mnemonic[3];
+    const char *jump_condition = NULL;
+    for (int i = 0; i < PEEPHOLE_TOTAL_CONDITIONS; i++)
+    {
+        for (int j = 0; j < 2; j++)
+        {
+            if (S_EQ(peephole_conditions[i][j], condition))
+            {
+                // jne jumps when the value was set, je when it was not
+                jump_condition = S_EQ(jump->mnemonic, "jne") ? condition : peephole_conditions[i][!j];
+            }
+        }
+    }
+
+    if (!jump_condition)
+    {
+        return 0;
+    }
+
+    peephole_replace(jump, "j%s %s", jump_condition, jump->operands[0]);
+    peephole_remove(cmp);
+    return 1;
+}
+
+/**
+ * jmp label
+ * label:
+ */
+static int peephole_rule_jump_to_next(struct peephole *peephole, int index)
+{
+    struct peephole_instruction *jump = peephole_at(peephole, index);
+    if (!peephole_is_jump(jump))
+    {
+        return 0;
+    }
+
+    for (int i = peephole_next(peephole, index); i != -1; i = peephole_next(peephole, i))
+    {
+        struct peephole_instruction *label = peephole_at(peephole, i);
+        if (label->type != PEEPHOLE_LINE_TYPE_LABEL)
+        {
+            break;
+        }
+
+        if (S_EQ(label->mnemonic, jump->operands[0]))
+        {
+            peephole_remove(jump);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * Instructions after a jmp or ret can only run if something jumps to them, which needs a label
+ */
+static int peephole_rule_unreachable(struct peephole *peephole, int index)
+{
+    struct peephole_instruction *instruction = peephole_at(peephole, index);
+    if (!peephole_is(instruction, "jmp", 1) && !peephole_is(instruction, "ret", 0))
+    {
+        return 0;
+    }
+
+    int removed = 0;
+    for (int i = peephole_next(peephole, index); i != -1; i = peephole_next(peephole, i))
+    {
+        struct peephole_instruction *unreachable = peephole_at(peephole, i);
+        if (unreachable->type != PEEPHOLE_LINE_TYPE_INSTRUCTION)
+        {
+            break;
+        }
+
+        peephole_remove(unreachable);
+        removed++;
+    }
+    return removed;
+}
+
+static struct peephole_rule peephole_rules[PEEPHOLE_TOTAL_RULES] = {
+    [PEEPHOLE_RULE_PUSH_POP] = {"push-pop", peephole_rule_push_pop},
+    [PEEPHOLE_RULE_REDUNDANT_MOVE] = {"redundant-move", peephole_rule_redundant_move},
+    [PEEPHOLE_RULE_SELF_MOVE] = {"self-move", peephole_rule_self_move},
+    [PEEPHOLE_RULE_COMPARE_AFTER_SET] = {"compare-after-set", peephole_rule_compare_after_set},
+    [PEEPHOLE_RULE_JUMP_TO_NEXT] = {"jump-to-next", peephole_rule_jump_to_next},
+    [PEEPHOLE_RULE_UNREACHABLE] = {"unreachable", peephole_rule_unreachable}};
+
+const char *peephole_rule_name(int rule)
+{
+    return peephole_rules[rule].name;
+}
+
+void peephole_begin(struct peephole *peephole)
+{
+    peephole->instructions = vector_create(sizeof(struct peephole_instruction));
+    peephole->line_len = 0;
+}
+
+static void peephole_end_line(struct peephole *peephole)
+{
+    peephole->line[peephole->line_len] = 0;
+    peephole->line_len = 0;
+
+    struct peephole_instruction instruction = {};
+    peephole_set_line(&instruction, peephole->line);
+    if (instruction.type == PEEPHOLE_LINE_TYPE_INSTRUCTION)
+    {
+        peephole->total_instructions++;
+    }
+    vector_push(peephole->instructions, &instruction);
+}
+
+bool peephole_write(struct peephole *peephole, const char *text)
+{
+    for (; *text; text++)
+    {
+        if (*text == '\n')
+        {
+            peephole_end_line(peephole);
+            continue;
+        }
+
+        if (peephole->line_len >= sizeof(peephole->line) - 1)
+        {
+            return false;
+        }
+        peephole->line[peephole->line_len++] = *text;
+    }
+    return true;
+}
+
+static void peephole_optimise(struct peephole *peephole)
+{
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        for (int i = 0; i < vector_count(peephole->instructions); i++)
+        {
+            for (int rule = 0; rule < PEEPHOLE_TOTAL_RULES; rule++)
+            {
+                struct peephole_instruction *instruction = peephole_at(peephole, i);
+                if (instruction->removed || instruction->type != PEEPHOLE_LINE_TYPE_INSTRUCTION)
+                {
+                    break;
+                }
+
+                int removed = peephole_rules[rule].apply(peephole, i);
+                if (removed)
+                {
+                    peephole->removed[rule] += removed;
+                    changed = true;
+                }
+            }
+        }
+    }
+}
+
+void peephole_end(struct peephole *peephole, PEEPHOLE_WRITE_LINE write_line)
+{
+    if (peephole->line_len)
+    {
+        peephole_end_line(peephole);
+    }
+
+    peephole_optimise(peephole);
+
+    // We are no longer capturing, the lines we write must go straight to the output
+    struct vector *instructions = peephole->instructions;
+    peephole->instructions = NULL;
+    for (int i = 0; i < vector_count(instructions); i++)
+    {
+        struct peephole_instruction *instruction = vector_at(instructions, i);
+        if (!instruction->removed)
+        {
+            write_line(instruction->line);
+        }
+        free(instruction->line);
+        free(instruction->parts);
+    }
+    vector_free(instructions);
+}
@@ -0,0 +1,561 @@
+#include "compiler.h"
+#include "helpers/vector.h"
+#include <string.h>
+
+/**
+ * Evaluation of #if and #elif conditions. The tokens of the condition are read to the
+ * end of the line, defined is resolved, what is left is expanded like the rest of the
+ * source and the value is computed straight from the expanded tokens by precedence
+ * climbing. No nodes are built, the token vectors are reused from one condition to the
+ * next.
+ *
+ * As in C, a name left once the condition is expanded is zero and a condition holds when
+ * its value is not zero. Values are long long, unsigned arithmetic is not tracked.
+ *
+ * Errors are reported at the #if or #elif, the tokens being computed may come from the
+ * body of a macro defined anywhere.
+ *
+ * Evaluated conditions are cached by a hash of their tokens along with every name they
+ * looked up and the definition each name had. A condition written again, in the same
+ * header or any other, holds or fails as before while none of those names have been
+ * defined or undefined since. Conditions that reach a native definition such as
+ * __LINE__ are never cached.
+ */
+
+struct preprocessor_condition_dependency
+{
+    const char *name;
+    // NULL if the name was not defined
+    struct preprocessor_definition *definition;
+};
+
+struct preprocessor_condition_slot
+{
+    // Zero for an empty slot
+    uint64_t hash;
+    int total_tokens;
+    bool result;
+
+    // The names the condition looked up in the dependency vector
+    int first_dependency;
+    int total_dependencies;
+};
+
+struct preprocessor_condition_parser
+{
+    struct compile_process *compiler;
+    // Position of the directive the condition belongs to
+    struct pos pos;
+    struct token *tokens;
+    int total;
+    int index;
+};
+
+enum
+{
+    PREPROCESSOR_CONDITION_PRECEDENCE_NONE,
+    PREPROCESSOR_CONDITION_PRECEDENCE_COMMA,
+    PREPROCESSOR_CONDITION_PRECEDENCE_CONDITIONAL,
+    PREPROCESSOR_CONDITION_PRECEDENCE_LOGICAL_OR,
+    PREPROCESSOR_CONDITION_PRECEDENCE_LOGICAL_AND,
+    PREPROCESSOR_CONDITION_PRECEDENCE_BITWISE_OR,
+    PREPROCESSOR_CONDITION_PRECEDENCE_BITWISE_XOR,
+    PREPROCESSOR_CONDITION_PRECEDENCE_BITWISE_AND,
+    PREPROCESSOR_CONDITION_PRECEDENCE_EQUALITY,
+    PREPROCESSOR_CONDITION_PRECEDENCE_RELATIONAL,
+    PREPROCESSOR_CONDITION_PRECEDENCE_SHIFT,
+    PREPROCESSOR_CONDITION_PRECEDENCE_ADDITIVE,
+    PREPROCESSOR_CONDITION_PRECEDENCE_MULTIPLICATIVE
+};
+
+static long long preprocessor_condition_parse(struct preprocessor_condition_parser *parser, int min_precedence, bool evaluate);
+
+static struct token *preprocessor_condition_peek(struct preprocessor_condition_parser *parser)
+{
+    return parser->index < parser->total ? &parser->tokens[parser->index] : NULL;
+}
+
+static struct token *preprocessor_condition_next(struct preprocessor_condition_parser *parser)
+{
+    struct token *token = preprocessor_condition_peek(parser);
+    if (token)
+    {
+        parser->index++;
+    }
+    return token;
+}
+
+static void preprocessor_condition_expect_symbol(struct preprocessor_condition_parser *parser, char c)
+{
+    struct token *token = preprocessor_condition_next(parser);
+    if (!token || !token_is_symbol(token, c))
+    {
+        compiler_pos_error(&parser->pos, "Expecting %c in the condition", c);
+    }
+}
+
+/**
+ * Returns the precedence of the token as a binary operator, PREPROCESSOR_CONDITION_PRECEDENCE_NONE
+ * if it is not one. Operators are atoms but the lexer also gives operators such as += that
+ * have no place in a condition, so the characters are checked.
+ */
+static int preprocessor_condition_precedence(struct token *token)
+{
+    if (!token || token->type != TOKEN_TYPE_OPERATOR)
+    {
+        return PREPROCESSOR_CONDITION_PRECEDENCE_NONE;
+    }
+
+    const char *op = token->sval;
+    switch (op[0])
+    {
+    case ',':
+        return !op[1] ? PREPROCESSOR_CONDITION_PRECEDENCE_COMMA : PREPROCESSOR_CONDITION_PRECEDENCE_NONE;
+    case '?':
+        return !op[1] ? PREPROCESSOR_CONDITION_PRECEDENCE_CONDITIONAL : PREPROCESSOR_CONDITION_PRECEDENCE_NONE;
+    case '*':
+    case '/':
+    case '%':
+        return !op[1] ? PREPROCESSOR_CONDITION_PRECEDENCE_MULTIPLICATIVE : PREPROCESSOR_CONDITION_PRECEDENCE_NONE;
+    case '+':
+    case '-':
+        return !op[1] ? PREPROCESSOR_CONDITION_PRECEDENCE_ADDITIVE : PREPROCESSOR_CONDITION_PRECEDENCE_NONE;
+    case '<':
+    case '>':
+        if (op[1] == op[0])
+        {
+            return !op[2] ? PREPROCESSOR_CONDITION_PRECEDENCE_SHIFT : PREPROCESSOR_CONDITION_PRECEDENCE_NONE;
+        }
+        return !op[1] || (op[1] == '=' && !op[2]) ? PREPROCESSOR_CONDITION_PRECEDENCE_RELATIONAL : PREPROCESSOR_CONDITION_PRECEDENCE_NONE;
+    case '=':
+    case '!':
+        return op[1] == '=' && !op[2] ? PREPROCESSOR_CONDITION_PRECEDENCE_EQUALITY : PREPROCESSOR_CONDITION_PRECEDENCE_NONE;
+    case '&':
+        if (op[1] == '&')
+        {
+            return !op[2] ? PREPROCESSOR_CONDITION_PRECEDENCE_LOGICAL_AND : PREPROCESSOR_CONDITION_PRECEDENCE_NONE;
+        }
+        return !op[1] ? PREPROCESSOR_CONDITION_PRECEDENCE_BITWISE_AND : PREPROCESSOR_CONDITION_PRECEDENCE_NONE;
+    case '^':
+        return !op[1] ? PREPROCESSOR_CONDITION_PRECEDENCE_BITWISE_XOR : PREPROCESSOR_CONDITION_PRECEDENCE_NONE;
+    case '|':
+        if (op[1] == '|')
+        {
+            return !op[2] ? PREPROCESSOR_CONDITION_PRECEDENCE_LOGICAL_OR : PREPROCESSOR_CONDITION_PRECEDENCE_NONE;
+        }
+        return !op[1] ? PREPROCESSOR_CONDITION_PRECEDENCE_BITWISE_OR : PREPROCESSOR_CONDITION_PRECEDENCE_NONE;
+    }
+
+    return PREPROCESSOR_CONDITION_PRECEDENCE_NONE;
+}
+
+static long long preprocessor_condition_binary(struct preprocessor_condition_parser *parser, const char *op, long long left, long long right, bool evaluate)
+{
+    if ((op[0] == '/' || op[0] == '%') && right == 0)
+    {
+        // Only an error in a part of the condition that is evaluated, e.g not in 0 && 1 / 0
+        if (evaluate)
+        {
+            compiler_pos_error(&parser->pos, "Division by zero in the condition");
+        }
+        return 0;
+    }
+
+    switch (op[0])
+    {
+    case ',':
+        return right;
+    case '*':
+        return left * right;
+    case '/':
+        return left / right;
+    case '%':
+        return left % right;
+    case '+':
+        return left + right;
+    case '-':
+        return left - right;
+    case '<':
+        if (op[1] == '<')
+        {
+            return left << right;
+        }
+        return op[1] == '=' ? left <= right : left < right;
+    case '>':
+        if (op[1] == '>')
+        {
+            return left >> right;
+        }
+        return op[1] == '=' ? left >= right : left > right;
+    case '=':
+        return left == right;
+    case '!':
+        return left != right;
+    case '&':
+        return left & right;
+    case '^':
+        return left ^ right;
+    case '|':
+        return left | right;
+    }
+
+    return 0;
+}
+
+static long long preprocessor_condition_parse_unary(struct preprocessor_condition_parser *parser, bool evaluate)
+{
+    struct token *token = preprocessor_condition_next(parser);
+    if (!token)
+    {
+        compiler_pos_error(&parser->pos, "Expecting a value at the end of the condition");
+    }
+
+    switch (token->type)
+    {
+    case TOKEN_TYPE_NUMBER:
+        return token->llnum;
+
+    case TOKEN_TYPE_IDENTIFIER:
+    case TOKEN_TYPE_KEYWORD:
+        // A name that is still here once the condition is expanded is not defined
+        return 0;
+
+    case TOKEN_TYPE_OPERATOR:
+        if (S_EQ(token->sval, "("))
+        {
+            long long value = preprocessor_condition_parse(parser, PREPROCESSOR_CONDITION_PRECEDENCE_COMMA, evaluate);
+            preprocessor_condition_expect_symbol(parser, ')');
+            return value;
+        }
+
+        if (!token->sval[1])
+        {
+            switch (token->sval[0])
+            {
+            case '+':
+                return preprocessor_condition_parse_unary(parser, evaluate);
+            case '-':
+                return -preprocessor_condition_parse_unary(parser, evaluate);
+            case '!':
+                return !preprocessor_condition_parse_unary(parser, evaluate);
+            case '~':
+                return ~preprocessor_condition_parse_unary(parser, evaluate);
+            }
+        }
+        break;
+    }
+
+    compiler_pos_error(&parser->pos, "Unexpected token in the condition");
+    return 0;
+}
+
+/**
+ * Parses and computes the expression made of the operators that bind at least as tight as
+ * the given precedence. Nothing is computed in a part that is not evaluated, i.e the right
+ * of && and || and the branch of ?: that is not taken, but it is still parsed.
+ */
+static long long preprocessor_condition_parse(struct preprocessor_condition_parser *parser, int min_precedence, bool evaluate)
+{
+    long long left = preprocessor_condition_parse_unary(parser, evaluate);
+    int precedence = preprocessor_condition_precedence(preprocessor_condition_peek(parser));
+    while (precedence != PREPROCESSOR_CONDITION_PRECEDENCE_NONE && precedence >= min_precedence)
+    {
+        const char *op = preprocessor_condition_next(parser)->sval;
+        switch (precedence)
+        {
+        case PREPROCESSOR_CONDITION_PRECEDENCE_CONDITIONAL:
+        {
+            long long true_value = preprocessor_condition_parse(parser, PREPROCESSOR_CONDITION_PRECEDENCE_COMMA, evaluate && left);
+            preprocessor_condition_expect_symbol(parser, ':');
+            // Right associative, a ? b : c ? d : e is a ? b : (c ? d : e)
+            long long false_value = preprocessor_condition_parse(parser, PREPROCESSOR_CONDITION_PRECEDENCE_CONDITIONAL, evaluate && !left);
+            left = left ? true_value : false_value;
+        }
+        break;
+
+        case PREPROCESSOR_CONDITION_PRECEDENCE_LOGICAL_AND:
+        {
+            long long right = preprocessor_condition_parse(parser, precedence + 1, evaluate && left);
+            left = left && right;
+        }
+        break;
+
+        case PREPROCESSOR_CONDITION_PRECEDENCE_LOGICAL_OR:
+        {
+            long long right = preprocessor_condition_parse(parser, precedence + 1, evaluate && !left);
+            left = left || right;
+        }
+        break;
+
+        default:
+        {
+            long long right = preprocessor_condition_parse(parser, precedence + 1, evaluate);
+            left = preprocessor_condition_binary(parser, op, left, right, evaluate);
+        }
+        }
+        precedence = preprocessor_condition_precedence(preprocessor_condition_peek(parser));
+    }
+
+    return left;
+}
+
+static long long preprocessor_condition_value(struct compile_process *compiler, struct token *directive, struct vector *expanded)
+{
+    struct preprocessor_condition_parser parser = {};
+    parser.compiler = compiler;
+    parser.pos = directive->pos;
+    parser.total = vector_count(expanded);
+    parser.tokens = parser.total ? vector_at(expanded, 0) : NULL;
+    if (!parser.total)
+    {
+        // Nothing left, e.g #if EMPTY where EMPTY is defined as nothing
+        return 0;
+    }
+
+    long long value = preprocessor_condition_parse(&parser, PREPROCESSOR_CONDITION_PRECEDENCE_COMMA, true);
+    if (parser.index < parser.total)
+    {
+        compiler_pos_error(&parser.pos, "Unexpected token in the condition");
+    }
+    return value;
+}
+
+/**
+ * Copies the tokens of the condition into the line vector, continued lines included. The
+ * new line that ends the condition is left to be read next.
+ */
+static void preprocessor_condition_read_line(struct compile_process *compiler, struct vector *line)
+{
+    struct vector *token_vec = compiler->token_vec_original;
+    vector_clear(line);
+    struct token *token = vector_peek_no_increment(token_vec);
+    while (token && token->type != TOKEN_TYPE_NEWLINE)
+    {
+        vector_peek(token_vec);
+        if (token_is_symbol(token, '\\'))
+        {
+            struct token *next_token = vector_peek_no_increment(token_vec);
+            if (next_token && next_token->type == TOKEN_TYPE_NEWLINE)
+            {
+                vector_peek(token_vec);
+            }
+        }
+        else if (token->type != TOKEN_TYPE_COMMENT)
+        {
+            vector_push(line, token);
+        }
+        token = vector_peek_no_increment(token_vec);
+    }
+}
+
+/**
+ * Replaces every defined X and defined(X) in the line with 1 or 0, before the line is
+ * expanded so X stays as written
+ */
+static void preprocessor_condition_resolve_defined(struct compile_process *compiler, struct vector *line)
+{
+    int total = vector_count(line);
+    struct token *tokens = total ? vector_at(line, 0) : NULL;
+    int kept = 0;
+    for (int i = 0; i < total; i++)
+    {
+        struct token *token = &tokens[i];
+        if (token->type != TOKEN_TYPE_IDENTIFIER || token->keyword != KEYWORD_DEFINED)
+        {
+            tokens[kept++] = *token;
+            continue;
+        }
+
+        bool brackets = i + 1 < total && token_is_operator(&tokens[i + 1], "(");
+        int name_index = i + 1 + brackets;
+        if (name_index >= total || (tokens[name_index].type != TOKEN_TYPE_IDENTIFIER && tokens[name_index].type != TOKEN_TYPE_KEYWORD))
+        {
+            compiler_pos_error(&token->pos, "Expecting a name after defined");
+        }
+        if (brackets && (name_index + 1 >= total || !token_is_symbol(&tokens[name_index + 1], ')')))
+        {
+            compiler_pos_error(&token->pos, "Expecting ) after the name given to defined");
+        }
+
+        const char *name = tokens[name_index].sval;
+        struct preprocessor_definition *definition = preprocessor_get_definition(compiler->preprocessor, name);
+        preprocessor_condition_depends_on(compiler->preprocessor, name, definition);
+
+        struct token result = *token;
+        result.type = TOKEN_TYPE_NUMBER;
+        result.keyword = KEYWORD_NONE;
+        result.llnum = definition != NULL;
+        result.num.type = NUMBER_TYPE_NORMAL;
+        tokens[kept++] = result;
+        i = name_index + brackets;
+    }
+
+    while (vector_count(line) > kept)
+    {
+        vector_pop(line);
+    }
+}
+
+void preprocessor_condition_depends_on(struct preprocessor *preprocessor, const char *name, struct preprocessor_definition *definition)
+{
+    struct preprocessor_conditions *conditions = &preprocessor->conditions;
+    // A condition rarely looks up more than a handful of names, a name is recorded once
+    for (int i = conditions->recording_from; i < vector_count(conditions->dependencies); i++)
+    {
+        struct preprocessor_condition_dependency *dependency = vector_at(conditions->dependencies, i);
+        if (dependency->name == name || S_EQ(dependency->name, name))
+        {
+            return;
+        }
+    }
+
+    struct preprocessor_condition_dependency dependency = {name, definition};
+    vector_push(conditions->dependencies, &dependency);
+}
+
+static struct preprocessor_condition_slot *preprocessor_condition_slot(struct preprocessor_conditions *conditions, uint64_t hash)
+{
+    size_t index = hash & (conditions->size - 1);
+    while (conditions->slots[index].hash && conditions->slots[index].hash != hash)
+    {
+        index = (index + 1) & (conditions->size - 1);
+    }
+    return &conditions->slots[index];
+}
+
+static void preprocessor_condition_grow(struct preprocessor_conditions *conditions)
+{
+    struct preprocessor_condition_slot *old_slots = conditions->slots;
+    size_t old_size = conditions->size;
+    conditions->size = old_size ? old_size * 2 : 256;
+    conditions->slots = calloc(conditions->size, sizeof(struct preprocessor_condition_slot));
+    for (size_t i = 0; i < old_size; i++)
+    {
+        if (old_slots[i].hash)
+        {
+            *preprocessor_condition_slot(conditions, old_slots[i].hash) = old_slots[i];
+        }
+    }
+    free(old_slots);
+}
+
+/**
+ * Returns the slot of the condition, an empty slot if it has not been cached
+ */
+static struct preprocessor_condition_slot *preprocessor_condition_lookup(struct preprocessor_conditions *conditions, uint64_t hash)
+{
+    // Kept at most half full so probes stay short
+    if ((conditions->count + 1) * 2 > conditions->size)
+    {
+        preprocessor_condition_grow(conditions);
+    }
+    return preprocessor_condition_slot(conditions, hash);
+}
+
+/**
+ * True if every name the cached condition looked up still has the definition it had
+ */
+static bool preprocessor_condition_dependencies_hold(struct preprocessor *preprocessor, struct preprocessor_condition_slot *slot)
+{
+    for (int i = 0; i < slot->total_dependencies; i++)
+    {
+        struct preprocessor_condition_dependency *dependency = vector_at(preprocessor->conditions.dependencies, slot->first_dependency + i);
+        if (preprocessor_get_definition(preprocessor, dependency->name) != dependency->definition)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Caches the result with the dependencies recorded from recording_from on. A condition
+ * cached before reuses the space of its old dependencies when they fit.
+ */
+static void preprocessor_condition_store(struct preprocessor_conditions *conditions, struct preprocessor_condition_slot *slot, uint64_t hash, int total_tokens, bool result)
+{
+    int first_dependency = conditions->recording_from;
+    int total_dependencies = vector_count(conditions->dependencies) - first_dependency;
+    if (!slot->hash)
+    {
+        conditions->count++;
+    }
+    else if (slot->total_dependencies >= total_dependencies)
+    {
+        for (int i = 0; i < total_dependencies; i++)
+        {
+            memcpy(vector_at(conditions->dependencies, slot->first_dependency + i), vector_at(conditions->dependencies, first_dependency + i), sizeof(struct preprocessor_condition_dependency));
+        }
+        while (vector_count(conditions->dependencies) > first_dependency)
+        {
+            vector_pop(conditions->dependencies);
+        }
+        first_dependency = slot->first_dependency;
+    }
+
+    slot->hash = hash;
+    slot->total_tokens = total_tokens;
+    slot->result = result;
+    slot->first_dependency = first_dependency;
+    slot->total_dependencies = total_dependencies;
+}
+
+bool preprocessor_condition_evaluate(struct compile_process *compiler, struct token *directive)
+{
+    struct preprocessor *preprocessor = compiler->preprocessor;
+    struct preprocessor_conditions *conditions = &preprocessor->conditions;
+    if (!conditions->line)
+    {
+        conditions->line = vector_create(sizeof(struct token));
+        conditions->expanded = vector_create(sizeof(struct token));
+        conditions->dependencies = vector_create(sizeof(struct preprocessor_condition_dependency));
+    }
+
+    size_t allocations = vector_total_allocations();
+    conditions->evaluated++;
+    preprocessor_condition_read_line(compiler, conditions->line);
+    int total_tokens = vector_count(conditions->line);
+    uint64_t hash = tokens_hash(total_tokens ? vector_at(conditions->line, 0) : NULL, total_tokens, 0);
+    // Zero marks an empty slot
+    hash = hash ? hash : 1;
+
+    // Two conditions can share a hash, they have the same number of tokens but for a
+    // one in 2^64 chance
+    struct preprocessor_condition_slot *slot = preprocessor_condition_lookup(conditions, hash);
+    if (slot->hash && slot->total_tokens == total_tokens && preprocessor_condition_dependencies_hold(preprocessor, slot))
+    {
+        conditions->hits++;
+        conditions->allocations += vector_total_allocations() - allocations;
+        return slot->result;
+    }
+
+    conditions->recording_from = vector_count(conditions->dependencies);
+    conditions->recording = true;
+    bool outer_uncacheable = preprocessor->expansion_cache.uncacheable;
+    preprocessor->expansion_cache.uncacheable = false;
+
+    preprocessor_condition_resolve_defined(compiler, conditions->line);
+    vector_clear(conditions->expanded);
+    int total = vector_count(conditions->line);
+    preprocessor_expand_tokens(compiler, total ? vector_at(conditions->line, 0) : NULL, total, conditions->expanded);
+
+    conditions->recording = false;
+    bool cacheable = !preprocessor->expansion_cache.uncacheable;
+    preprocessor->expansion_cache.uncacheable = outer_uncacheable;
+
+    bool result = preprocessor_condition_value(compiler, directive, conditions->expanded) != 0;
+    if (cacheable)
+    {
+        preprocessor_condition_store(conditions, slot, hash, total_tokens, result);
+    }
+    else
+    {
+        while (vector_count(conditions->dependencies) > conditions->recording_from)
+        {
+            vector_pop(conditions->dependencies);
+        }
+    }
+
+    conditions->allocations += vector_total_allocations() - allocations;
+    return result;
+}
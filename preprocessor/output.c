@@ -0,0 +1,264 @@
+#include "compiler.h"
+#include "helpers/vector.h"
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * The output of preprocessing alone, -E. After each token read from the source has been
+ * handled the tokens it produced are written as text and dropped, so neither the output
+ * nor, see preprocessor_trim_original(), the source is ever kept whole.
+ *
+ * Tokens are written on the line of the source token they came from. A token of the same
+ * file on a later line, such as the arguments of a macro call written over several lines,
+ * moves the output down to its line. Tokens of an expansion that were written elsewhere
+ * stay on the line being written. Blank lines keep the output in step with the source
+ * over small gaps, a #line marker is written when a file is entered or left, the output
+ * would have to go back or the gap is larger.
+ */
+
+// The most blank lines written rather than a #line marker
+#define PREPROCESSOR_OUTPUT_MAX_BLANK_LINES 8
+
+// The output being written, its last line is ended if an error exits before it is
+static struct preprocessor_output *preprocessor_output_current = NULL;
+
+static void preprocessor_output_exit(void)
+{
+    struct preprocessor_output *output = preprocessor_output_current;
+    if (output && !output->line_empty)
+    {
+        // The output of the next input starts with a #line marker that must be on a line of its own
+        fputc('\n', output->fp);
+        fflush(output->fp);
+    }
+}
+
+void preprocessor_output_begin(struct preprocessor *preprocessor, FILE *out)
+{
+    static bool registered = false;
+    if (!registered)
+    {
+        atexit(preprocessor_output_exit);
+        registered = true;
+    }
+
+    memset(&preprocessor->output, 0, sizeof(preprocessor->output));
+    preprocessor->output.fp = out;
+    preprocessor->output.line_empty = true;
+    preprocessor_output_current = &preprocessor->output;
+}
+
+void preprocessor_output_file_changed(struct preprocessor *preprocessor)
+{
+    preprocessor->output.started = false;
+}
+
+/**
+ * Writes the string quoted with the escapes the lexer understands
+ */
+static void preprocessor_output_string(FILE *fp, const char *str)
+{
+    fputc('"', fp);
+    for (const char *ptr = str; *ptr; ptr++)
+    {
+        switch (*ptr)
+        {
+        case '\n':
+            fputs("\\n", fp);
+            break;
+        case '\t':
+            fputs("\\t", fp);
+            break;
+        case '\\':
+        case '"':
+            fputc('\\', fp);
+            fputc(*ptr, fp);
+            break;
+        default:
+            fputc(*ptr, fp);
+        }
+    }
+    fputc('"', fp);
+}
+
+static void preprocessor_output_marker(struct preprocessor_output *output, struct pos pos)
+{
+    if (!output->line_empty)
+    {
+        fputc('\n', output->fp);
+    }
+
+    const char *filename = compiler_file_name(pos.file);
+    fprintf(output->fp, "#line %i ", pos.line);
+    preprocessor_output_string(output->fp, filename ? filename : "");
+    fputc('\n', output->fp);
+
+    output->started = true;
+    output->file = pos.file;
+    output->line = pos.line;
+    output->line_empty = true;
+}
+
+/**
+ * Moves the output to the line of the source at pos
+ */
+static void preprocessor_output_move(struct preprocessor_output *output, struct pos pos)
+{
+    if (!output->started || pos.file != output->file || pos.line < output->line ||
+        pos.line - output->line > PREPROCESSOR_OUTPUT_MAX_BLANK_LINES)
+    {
+        preprocessor_output_marker(output, pos);
+        return;
+    }
+
+    while (output->line < pos.line)
+    {
+        fputc('\n', output->fp);
+        output->line++;
+        output->line_empty = true;
+    }
+}
+
+static bool preprocessor_output_is_word(int type)
+{
+    return type == TOKEN_TYPE_IDENTIFIER || type == TOKEN_TYPE_KEYWORD || type == TOKEN_TYPE_NUMBER;
+}
+
+/**
+ * Returns true if the token would run into the last one written without a space between them,
+ * two words would become one and two operators could be read as another operator
+ */
+static bool preprocessor_output_needs_space(struct preprocessor_output *output, struct token *token)
+{
+    if (output->last_whitespace || (preprocessor_output_is_word(output->last_type) && preprocessor_output_is_word(token->type)))
+    {
+        return true;
+    }
+
+    // The lexer reads . and * on their own, what follows them is never joined on so
+    // ... and *= are written as they were
+    if (output->last_char == '.' || output->last_char == '*')
+    {
+        return false;
+    }
+
+    char first = token->type == TOKEN_TYPE_OPERATOR ? token->sval[0] : token->type == TOKEN_TYPE_SYMBOL ? token->cval : 0;
+    const char *joining = "+-*/%<>=!&|^.#:";
+    return first && output->last_char && strchr(joining, first) && strchr(joining, output->last_char);
+}
+
+static void preprocessor_output_token(struct preprocessor_output *output, struct token *token)
+{
+    if (!output->line_empty && preprocessor_output_needs_space(output, token))
+    {
+        fputc(' ', output->fp);
+    }
+
+    output->last_char = 0;
+    switch (token->type)
+    {
+    case TOKEN_TYPE_IDENTIFIER:
+    case TOKEN_TYPE_KEYWORD:
+        fputs(token->sval, output->fp);
+        break;
+
+    case TOKEN_TYPE_OPERATOR:
+        fputs(token->sval, output->fp);
+        output->last_char = token->sval[strlen(token->sval) - 1];
+        break;
+
+    case TOKEN_TYPE_SYMBOL:
+        fputc(token->cval, output->fp);
+        output->last_char = token->cval;
+        break;
+
+    case TOKEN_TYPE_NUMBER:
+        // Characters are numbers to the lexer, they are written as their value
+        fprintf(output->fp, "%llu", token->llnum);
+        if (token->num.type == NUMBER_TYPE_LONG)
+        {
+            fputc('L', output->fp);
+        }
+        else if (token->num.type == NUMBER_TYPE_FLOAT)
+        {
+            fputc('f', output->fp);
+        }
+        break;
+
+    case TOKEN_TYPE_STRING:
+        preprocessor_output_string(output->fp, token->sval);
+        break;
+    }
+
+    output->last_type = token->type;
+    output->last_whitespace = token->whitespace;
+    output->line_empty = false;
+    output->tokens++;
+}
+
+void preprocessor_output_write(struct compile_process *compiler, struct pos pos)
+{
+    struct preprocessor_output *output = &compiler->preprocessor->output;
+    struct vector *token_vec = compiler->token_vec;
+    bool moved = false;
+    for (int i = 0; i < vector_count(token_vec); i++)
+    {
+        struct token *token = vector_at(token_vec, i);
+        if (preprocessor_token_is_trivia(token))
+        {
+            continue;
+        }
+
+        // Directives produce nothing, the output only moves for what is written
+        if (!moved)
+        {
+            preprocessor_output_move(output, pos);
+            moved = true;
+        }
+
+        if (token->pos.file == output->file && token->pos.line > output->line)
+        {
+            preprocessor_output_move(output, token->pos);
+        }
+        preprocessor_output_token(output, token);
+    }
+
+    vector_clear(token_vec);
+}
+
+void preprocessor_output_write_restored(struct compile_process *compiler)
+{
+    struct preprocessor_output *output = &compiler->preprocessor->output;
+    struct vector *token_vec = compiler->token_vec;
+    for (int i = 0; i < vector_count(token_vec); i++)
+    {
+        struct token *token = vector_at(token_vec, i);
+        if (preprocessor_token_is_trivia(token))
+        {
+            continue;
+        }
+
+        // Where the call of an expansion was is not kept, its tokens stay on the line being written
+        bool from_expansion = token->flags & TOKEN_FLAG_FROM_EXPANSION;
+        if (!from_expansion || (token->pos.file == output->file && token->pos.line > output->line))
+        {
+            preprocessor_output_move(output, token->pos);
+        }
+        preprocessor_output_token(output, token);
+    }
+
+    vector_clear(token_vec);
+}
+
+int preprocessor_output_end(struct preprocessor *preprocessor)
+{
+    struct preprocessor_output *output = &preprocessor->output;
+    preprocessor_output_current = NULL;
+    if (!output->line_empty)
+    {
+        fputc('\n', output->fp);
+        output->line_empty = true;
+    }
+
+    return fflush(output->fp) == 0 && !ferror(output->fp) ? 0 : -1;
+}
@@ -0,0 +1,488 @@
+#include "compiler.h"
+#include "helpers/vector.h"
+#include "helpers/buffer.h"
+#include "helpers/hashmap.h"
+#include <string.h>
+#include <sys/stat.h>
+
+/**
+ * Precompiled headers. A precompiled header is a snapshot of the preprocessor once a
+ * header has been preprocessed: its definitions, typedefs and included files, and the
+ * tokens the header produced. Restoring it into a new compile process is the same as
+ * having preprocessed the header at the top of the file, without lexing or
+ * preprocessing anything.
+ *
+ * Every file that went into the header is recorded with its size and modification
+ * time, a precompiled header is refused once any of them has changed.
+ *
+ * Every string is written once to a table at the start of the file and referred to by
+ * its index, so restoring interns each name once rather than once per token. Tokens
+ * are written as fixed size records.
+ */
+
+#define PCH_MAGIC "DCPC"
+#define PCH_VERSION 2
+// Written in place of the index of a NULL string
+#define PCH_NULL_STRING 0xffffffff
+
+static const char *pch_include_file = NULL;
+
+void pch_set_include(const char *filename)
+{
+    pch_include_file = filename;
+}
+
+struct pch_token
+{
+    uint8_t type;
+    uint8_t flags;
+    uint8_t keyword;
+    uint8_t whitespace;
+    uint8_t num_type;
+    int32_t line;
+    uint16_t col;
+    // Index into the file names of the precompiled header
+    uint16_t file;
+    // Index of the string for tokens with a string value, the value itself otherwise
+    uint64_t value;
+};
+
+struct pch_writer
+{
+    struct buffer *body;
+    // Index + 1 of every string written so far, indexed by the string
+    struct hashmap *string_ids;
+    // Vector of const char*, the string table
+    struct vector *strings;
+};
+
+struct pch_reader
+{
+    char *ptr;
+    char *end;
+    // Set once a read went past the end, every read after that returns zero
+    bool failed;
+
+    // The string table, every string is an atom
+    const char **strings;
+    uint32_t total_strings;
+
+    // The file id of this process for every file id in the precompiled header
+    uint16_t *file_ids;
+    uint32_t total_file_ids;
+};
+
+static void pch_write_u32(struct buffer *buffer, uint32_t value)
+{
+    buffer_write_bytes(buffer, (const char *)&value, sizeof(value));
+}
+
+static void pch_write_u64(struct buffer *buffer, uint64_t value)
+{
+    buffer_write_bytes(buffer, (const char *)&value, sizeof(value));
+}
+
+static uint32_t pch_string_id(struct pch_writer *writer, const char *str)
+{
+    if (!str)
+    {
+        return PCH_NULL_STRING;
+    }
+
+    uintptr_t id = (uintptr_t)hashmap_data(writer->string_ids, str);
+    if (!id)
+    {
+        vector_push(writer->strings, &str);
+        id = vector_count(writer->strings);
+        hashmap_insert(writer->string_ids, str, (void *)id);
+    }
+    return id - 1;
+}
+
+static void pch_write_string(struct pch_writer *writer, const char *str)
+{
+    pch_write_u32(writer->body, pch_string_id(writer, str));
+}
+
+static bool pch_read(struct pch_reader *reader, void *out, size_t size)
+{
+    if (reader->failed || reader->end - reader->ptr < size)
+    {
+        reader->failed = true;
+        memset(out, 0, size);
+        return false;
+    }
+
+    memcpy(out, reader->ptr, size);
+    reader->ptr += size;
+    return true;
+}
+
+static uint32_t pch_read_u32(struct pch_reader *reader)
+{
+    uint32_t value;
+    pch_read(reader, &value, sizeof(value));
+    return value;
+}
+
+static uint64_t pch_read_u64(struct pch_reader *reader)
+{
+    uint64_t value;
+    pch_read(reader, &value, sizeof(value));
+    return value;
+}
+
+static const char *pch_read_string(struct pch_reader *reader)
+{
+    uint32_t id = pch_read_u32(reader);
+    if (id >= reader->total_strings)
+    {
+        reader->failed = reader->failed || id != PCH_NULL_STRING;
+        return NULL;
+    }
+    return reader->strings[id];
+}
+
+static void pch_read_strings(struct pch_reader *reader)
+{
+    reader->total_strings = pch_read_u32(reader);
+    reader->strings = calloc(reader->total_strings + 1, sizeof(const char *));
+    for (uint32_t i = 0; i < reader->total_strings && !reader->failed; i++)
+    {
+        uint32_t len = pch_read_u32(reader);
+        if (reader->end - reader->ptr < len)
+        {
+            reader->failed = true;
+            break;
+        }
+        reader->strings[i] = atom_n(reader->ptr, len);
+        reader->ptr += len;
+    }
+}
+
+static bool pch_token_has_string(int type)
+{
+    switch (type)
+    {
+    case TOKEN_TYPE_IDENTIFIER:
+    case TOKEN_TYPE_KEYWORD:
+    case TOKEN_TYPE_OPERATOR:
+    case TOKEN_TYPE_STRING:
+    case TOKEN_TYPE_COMMENT:
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * Writes the names of every file id handed out so far, file ids are only meaningful
+ * to the process that handed them out. The reader maps them to its own ids.
+ */
+static void pch_write_file_names(struct pch_writer *writer)
+{
+    uint32_t total = 0;
+    while (compiler_file_name(total))
+    {
+        total++;
+    }
+
+    pch_write_u32(writer->body, total);
+    for (uint32_t i = 0; i < total; i++)
+    {
+        pch_write_string(writer, compiler_file_name(i));
+    }
+}
+
+static void pch_read_file_names(struct pch_reader *reader)
+{
+    reader->total_file_ids = pch_read_u32(reader);
+    reader->file_ids = calloc(reader->total_file_ids + 1, sizeof(uint16_t));
+    for (uint32_t i = 0; i < reader->total_file_ids && !reader->failed; i++)
+    {
+        const char *filename = pch_read_string(reader);
+        reader->file_ids[i] = filename ? compiler_file_id(filename) : 0;
+    }
+}
+
+static void pch_write_tokens(struct pch_writer *writer, struct vector *token_vec)
+{
+    pch_write_u32(writer->body, token_vec ? vector_count(token_vec) : 0);
+    for (int i = 0; token_vec && i < vector_count(token_vec); i++)
+    {
+        struct token *token = vector_at(token_vec, i);
+        struct pch_token record = {};
+        record.type = token->type;
+        record.flags = token->flags;
+        record.keyword = token->keyword;
+        record.whitespace = token->whitespace;
+        record.num_type = token->num.type;
+        record.line = token->pos.line;
+        record.col = token->pos.col;
+        record.file = token->pos.file;
+        record.value = pch_token_has_string(token->type) ? pch_string_id(writer, token->sval) : token->llnum;
+        buffer_write_bytes(writer->body, (const char *)&record, sizeof(record));
+    }
+}
+
+/**
+ * Reads tokens written by pch_write_tokens onto the end of the vector
+ */
+static void pch_read_tokens(struct pch_reader *reader, struct vector *token_vec)
+{
+    uint32_t total = pch_read_u32(reader);
+    if (reader->failed || reader->end - reader->ptr < (uint64_t)total * sizeof(struct pch_token))
+    {
+        reader->failed = true;
+        return;
+    }
+
+    for (uint32_t i = 0; i < total; i++)
+    {
+        struct pch_token record;
+        pch_read(reader, &record, sizeof(record));
+
+        struct token token = {};
+        token.type = record.type;
+        token.flags = record.flags;
+        token.keyword = record.keyword;
+        token.whitespace = record.whitespace;
+        token.num.type = record.num_type;
+        token.pos.line = record.line;
+        token.pos.col = record.col;
+        token.pos.file = record.file < reader->total_file_ids ? reader->file_ids[record.file] : 0;
+        token.llnum = record.value;
+        if (pch_token_has_string(token.type))
+        {
+            token.sval = record.value < reader->total_strings ? reader->strings[record.value] : NULL;
+        }
+        vector_push(token_vec, &token);
+    }
+}
+
+static void pch_write_definition(struct pch_writer *writer, struct preprocessor_definition *definition)
+{
+    pch_write_u32(writer->body, definition->type);
+    pch_write_string(writer, definition->name);
+    if (definition->type == PREPROCESSOR_DEFINITION_TYPEDEF)
+    {
+        pch_write_tokens(writer, definition->_typedef.value);
+        return;
+    }
+
+    struct vector *arguments = definition->standard.arguments;
+    pch_write_u32(writer->body, arguments ? vector_count(arguments) : 0);
+    for (int i = 0; arguments && i < vector_count(arguments); i++)
+    {
+        pch_write_string(writer, *(const char **)vector_at(arguments, i));
+    }
+    pch_write_tokens(writer, definition->standard.value);
+}
+
+static void pch_read_definition(struct pch_reader *reader, struct preprocessor *preprocessor)
+{
+    int type = pch_read_u32(reader);
+    const char *name = pch_read_string(reader);
+    struct vector *value_vec = vector_create(sizeof(struct token));
+    if (type == PREPROCESSOR_DEFINITION_TYPEDEF)
+    {
+        pch_read_tokens(reader, value_vec);
+        if (!reader->failed)
+        {
+            preprocessor_definition_create_typedef(name, value_vec, preprocessor);
+        }
+        return;
+    }
+
+    uint32_t total_arguments = pch_read_u32(reader);
+    struct vector *arguments = vector_create(sizeof(const char *));
+    for (uint32_t i = 0; i < total_arguments && !reader->failed; i++)
+    {
+        const char *argument = pch_read_string(reader);
+        vector_push(arguments, &argument);
+    }
+    pch_read_tokens(reader, value_vec);
+    if (!reader->failed)
+    {
+        preprocessor_definition_create(name, value_vec, arguments, preprocessor);
+    }
+}
+
+static void pch_write_included_file(struct pch_writer *writer, struct preprocessor_included_file *included_file)
+{
+    struct stat st;
+    bool is_file = stat(included_file->filename, &st) == 0;
+    pch_write_string(writer, included_file->filename);
+    pch_write_string(writer, included_file->guard);
+    buffer_write(writer->body, included_file->once);
+    // Static includes live in the compiler and can never change
+    buffer_write(writer->body, is_file);
+    pch_write_u64(writer->body, is_file ? st.st_size : 0);
+    pch_write_u64(writer->body, is_file ? st.st_mtim.tv_sec : 0);
+    pch_write_u64(writer->body, is_file ? st.st_mtim.tv_nsec : 0);
+}
+
+static void pch_read_included_file(struct compile_process *process, struct pch_reader *reader, const char *pch_filename)
+{
+    const char *filename = pch_read_string(reader);
+    const char *guard = pch_read_string(reader);
+    uint8_t flags[2];
+    pch_read(reader, flags, sizeof(flags));
+    uint64_t size = pch_read_u64(reader);
+    uint64_t mtime_sec = pch_read_u64(reader);
+    uint64_t mtime_nsec = pch_read_u64(reader);
+    if (reader->failed || !filename)
+    {
+        reader->failed = true;
+        return;
+    }
+
+    bool is_file = flags[1];
+    if (is_file)
+    {
+        struct stat st;
+        if (stat(filename, &st) != 0 || st.st_size != size || st.st_mtim.tv_sec != mtime_sec || st.st_mtim.tv_nsec != mtime_nsec)
+        {
+            compiler_error(process, "The precompiled header %s is out of date, %s has changed since it was made", pch_filename, filename);
+        }
+    }
+
+    struct preprocessor *preprocessor = process->preprocessor;
+    struct preprocessor_included_file *included_file = preprocessor_add_included_file(preprocessor, filename);
+    included_file->guard = guard;
+    included_file->once = flags[0];
+
+    PREPROCESSOR_STATIC_INCLUDE_HANDLER_POST_CREATION handler = is_file ? NULL : preprocessor_static_include_handler_for(filename);
+    if (handler)
+    {
+        // Brings back the native definitions the static include made
+        handler(preprocessor, included_file);
+    }
+}
+
+int pch_write(struct compile_process *process, const char *filename)
+{
+    struct preprocessor *preprocessor = process->preprocessor;
+    struct pch_writer writer = {};
+    writer.body = buffer_create();
+    writer.string_ids = hashmap_create(HASHMAP_DEFAULT_SIZE);
+    writer.strings = vector_create(sizeof(const char *));
+
+    pch_write_file_names(&writer);
+
+    pch_write_u32(writer.body, preprocessor->includes->count);
+    for (size_t i = 0; i < preprocessor->includes->size; i++)
+    {
+        for (struct hashmap_data *data = preprocessor->includes->data[i]; data; data = data->next)
+        {
+            pch_write_included_file(&writer, data->value);
+        }
+    }
+
+    // Native definitions are created again by the preprocessor and the static includes
+    struct vector *definitions = vector_create(sizeof(struct preprocessor_definition *));
+    for (size_t i = 0; i < preprocessor->definitions->size; i++)
+    {
+        for (struct hashmap_data *data = preprocessor->definitions->data[i]; data; data = data->next)
+        {
+            struct preprocessor_definition *definition = data->value;
+            if (definition->type != PREPROCESSOR_DEFINITION_NATIVE_CALLBACK)
+            {
+                vector_push(definitions, &definition);
+            }
+        }
+    }
+    pch_write_u32(writer.body, vector_count(definitions));
+    for (int i = 0; i < vector_count(definitions); i++)
+    {
+        pch_write_definition(&writer, *(struct preprocessor_definition **)vector_at(definitions, i));
+    }
+
+    pch_write_tokens(&writer, process->token_vec);
+
+    // The string table goes first so the reader has every string before it needs one
+    struct buffer *head = buffer_create();
+    buffer_write_bytes(head, PCH_MAGIC, 4);
+    pch_write_u32(head, PCH_VERSION);
+    pch_write_u32(head, vector_count(writer.strings));
+    for (int i = 0; i < vector_count(writer.strings); i++)
+    {
+        const char *str = *(const char **)vector_at(writer.strings, i);
+        pch_write_u32(head, strlen(str));
+        buffer_write_bytes(head, str, strlen(str));
+    }
+
+    int res = 0;
+    FILE *fp = fopen(filename, "wb");
+    if (!fp || fwrite(buffer_ptr(head), 1, head->len, fp) != head->len ||
+        fwrite(buffer_ptr(writer.body), 1, writer.body->len, fp) != writer.body->len)
+    {
+        res = -1;
+    }
+    if (fp && fclose(fp) != 0)
+    {
+        res = -1;
+    }
+
+    vector_free(definitions);
+    vector_free(writer.strings);
+    hashmap_free(writer.string_ids);
+    buffer_free(writer.body);
+    buffer_free(head);
+    return res;
+}
+
+int pch_restore(struct compile_process *process)
+{
+    if (!pch_include_file)
+    {
+        return 0;
+    }
+
+    FILE *fp = fopen(pch_include_file, "rb");
+    if (!fp)
+    {
+        compiler_error(process, "Unable to open the precompiled header %s", pch_include_file);
+    }
+
+    fseek(fp, 0, SEEK_END);
+    long size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    char *data = malloc(size > 0 ? size : 1);
+    size_t total_read = fread(data, 1, size, fp);
+    fclose(fp);
+
+    struct pch_reader reader = {.ptr = data, .end = data + total_read};
+    char magic[4];
+    pch_read(&reader, magic, sizeof(magic));
+    if (memcmp(magic, PCH_MAGIC, sizeof(magic)) != 0 || pch_read_u32(&reader) != PCH_VERSION)
+    {
+        compiler_error(process, "%s is not a precompiled header made by this compiler", pch_include_file);
+    }
+    pch_read_strings(&reader);
+    pch_read_file_names(&reader);
+
+    uint32_t total_includes = pch_read_u32(&reader);
+    for (uint32_t i = 0; i < total_includes && !reader.failed; i++)
+    {
+        pch_read_included_file(process, &reader, pch_include_file);
+    }
+
+    uint32_t total_definitions = pch_read_u32(&reader);
+    for (uint32_t i = 0; i < total_definitions && !reader.failed; i++)
+    {
+        pch_read_definition(&reader, process->preprocessor);
+    }
+
+    // The header's tokens come first, the file's own tokens follow them
+    pch_read_tokens(&reader, process->token_vec);
+    if (reader.failed)
+    {
+        compiler_error(process, "The precompiled header %s is truncated", pch_include_file);
+    }
+
+    free(reader.strings);
+    free(reader.file_ids);
+    free(data);
+    return 0;
+}
@@ -2,6 +2,7 @@
 #include "misc.h"
 #include "helpers/vector.h"
 #include "helpers/buffer.h"
+#include "helpers/hashmap.h"
 
 enum
 {
@@ -22,96 +23,14 @@ struct typedef_type
     } structure;
 };
 
-enum
-{
-    PREPROCESSOR_FLAG_EVALUATE_MODE = 0b00000001
-};
-
-enum
-{
-    PREPROCESSOR_NUMBER_NODE,
-    PREPROCESSOR_IDENTIFIER_NODE,
-    PREPROCESSOR_KEYWORD_NODE,
-    PREPROCESSOR_UNARY_NODE,
-    PREPROCESSOR_EXPRESSION_NODE,
-    PREPROCESSOR_PARENTHESES_NODE,
-    PREPROCESSOR_JOINED_NODE,
-    PREPROCESSOR_TENARY_NODE,
-};
-
-struct preprocessor_node
-{
-    int type;
-    struct preprocessor_const_val
-    {
-        union
-        {
-            char cval;
-            unsigned int inum;
-            long lnum;
-            long long llnum;
-            unsigned long ulnum;
-            unsigned long long ullnum;
-        };
-    } const_val;
-
-    union
-    {
-        struct preprocessor_exp_node
-        {
-            struct preprocessor_node *left;
-            struct preprocessor_node *right;
-            const char *op;
-        } exp;
-
-        struct preprocessor_unary_node
-        {
-            struct preprocessor_node *operand_node;
-            const char *op;
-            struct preprocessor_unary_indirection
-            {
-                int depth;
-            } indirection;
-        } unary_node;
-
-        /**
-         * Represents a parenthesis expression i.e (50+20) (EXP)
-         */
-        struct preprocessor_parenthesis
-        {
-            // The expression between the brackets ()
-            struct preprocessor_node *exp;
-        } parenthesis;
-
-        struct preprocessor_joined_node
-        {
-            struct preprocessor_node *left;
-            struct preprocessor_node *right;
-        } joined;
-
-        struct preprocessor_tenary_node
-        {
-            struct preprocessor_node *true_node;
-            struct preprocessor_node *false_node;
-        } tenary;
-    };
-
-    const char *sval;
-};
-
 int preprocessor_handle_identifier(struct compile_process *compiler, struct token *token);
 int preprocessor_handle_identifier_for_token_vector(struct compile_process *compiler, struct vector *src_vec, struct vector *dst_vec, struct token *token);
-int preprocessor_macro_function_execute(struct compile_process *compiler, const char *function_name, struct preprocessor_function_arguments *arguments, int flags);
-int preprocessor_evaluate(struct compile_process *compiler, struct preprocessor_node *root_node);
-int preprocessor_parse_evaluate_token(struct compile_process *compiler, struct token *token);
-void preprocessor_handle_elif_token(struct compile_process *compiler, bool previous_if_result);
+void preprocessor_handle_elif_token(struct compile_process *compiler, struct token *directive, bool previous_if_result);
 bool preprocessor_token_is_typedef(struct token *token);
 void preprocessor_handle_typedef_token(struct compile_process *compiler, struct vector *src_vec, bool overflow_use_token_vec);
 struct token *preprocessor_next_token_skip_nl(struct compile_process *compiler);
 struct preprocessor_definition *preprocessor_get_definition(struct preprocessor *preprocessor, const char *name);
 struct vector *preprocessor_definition_value(struct preprocessor_definition *definition);
-int preprocessor_macro_function_push_argument(struct compile_process *compiler, struct preprocessor_definition *definition, struct preprocessor_function_arguments *arguments, const char *arg_name, struct vector *definition_token_vec, struct vector *value_vec_target);
-void preprocessor_macro_function_push_something(struct compile_process *compiler, struct preprocessor_definition *definition, struct preprocessor_function_arguments *arguments, struct token *arg_token, struct vector *definition_token_vec, struct vector *value_vec_target);
 struct token *preprocessor_peek_next_token_skip_nl(struct compile_process *compiler);
 
 void preprocessor_execute_warning(struct compile_process *compiler, const char *msg)
@@ -124,23 +43,59 @@ void preprocessor_execute_error(struct compile_process *compiler, const char *ms
     compiler_error(compiler, "#error %s", msg);
 }
 
+struct preprocessor_included_file *preprocessor_get_included_file(struct preprocessor *preprocessor, const char *filename)
+{
+    return hashmap_data(preprocessor->includes, filename);
+}
+
 struct preprocessor_included_file *preprocessor_add_included_file(struct preprocessor *preprocessor, const char *filename)
 {
-    struct preprocessor_included_file *included_file = calloc(sizeof(struct preprocessor_included_file), 1);
-    strncpy(included_file->filename, filename, sizeof(included_file->filename));
-    vector_push(preprocessor->includes, &included_file);
+    // Included again? Then we keep what we already know about the file
+    struct preprocessor_included_file *included_file = preprocessor_get_included_file(preprocessor, filename);
+    if (included_file)
+    {
+        return included_file;
+    }
+
+    included_file = calloc(sizeof(struct preprocessor_included_file), 1);
+    strncpy(included_file->filename, filename, sizeof(included_file->filename) - 1);
+    hashmap_insert(preprocessor->includes, included_file->filename, included_file);
+    vector_push(preprocessor->include_order, &included_file);
     return included_file;
 }
 
+/**
+ * Returns true if including the given file again would produce no tokens, this is the case
+ * when the file used #pragma once or its include guard macro is still defined.
+ */
+bool preprocessor_included_file_is_skippable(struct preprocessor *preprocessor, const char *filename)
+{
+    struct preprocessor_included_file *included_file = preprocessor_get_included_file(preprocessor, filename);
+    if (!included_file)
+    {
+        return false;
+    }
+
+    if (included_file->once)
+    {
+        return true;
+    }
+
+    return included_file->guard && preprocessor_get_definition(preprocessor, included_file->guard);
+}
+
 void preprocessor_create_static_include(struct preprocessor *preprocessor, const char *filename, PREPROCESSOR_STATIC_INCLUDE_HANDLER_POST_CREATION creation_handler)
 {
     struct preprocessor_included_file *included_file = preprocessor_add_included_file(preprocessor, filename);
     creation_handler(preprocessor, included_file);
 }
 
-bool preprocessor_is_keyword(const char *type)
+/**
+ * Returns the KEYWORD_* for a word given to us by the lexer
+ */
+static int preprocessor_keyword_for_string(const char *str)
 {
-    return S_EQ(type, "defined");
+    return keyword_lookup(str, strlen(str));
 }
 struct vector *preprocessor_build_value_vector_for_integer(int value)
 {
@@ -157,20 +112,15 @@ void preprocessor_token_vec_push_keyword_and_identifier(struct vector *token_vec
     struct token t1 = {};
     t1.type = TOKEN_TYPE_KEYWORD;
     t1.sval = keyword;
+    t1.keyword = preprocessor_keyword_for_string(keyword);
     struct token t2 = {};
     t2.type = TOKEN_TYPE_IDENTIFIER;
     t2.sval = identifier;
+    t2.keyword = preprocessor_keyword_for_string(identifier);
 
     vector_push(token_vec, &t1);
     vector_push(token_vec, &t2);
 }
-void *preprocessor_node_create(struct preprocessor_node *node)
-{
-    struct preprocessor_node *result = calloc(sizeof(struct preprocessor_node), 1);
-    memcpy(result, node, sizeof(struct preprocessor_node));
-    return result;
-}
-
 /**
  * Returns the index of the argument or -1 if not found.
  */
@@ -178,10 +128,10 @@ int preprocessor_definition_argument_exists(struct preprocessor_definition *defi
 {
     vector_set_peek_pointer(definition->standard.arguments, 0);
     int i = 0;
-    const char *current = vector_peek(definition->standard.arguments);
+    const char **current = vector_peek(definition->standard.arguments);
     while (current)
     {
-        if (S_EQ(current, name))
+        if (S_EQ(*current, name))
             return i;
 
         i++;
@@ -197,52 +147,6 @@ struct preprocessor_function_argument *preprocessor_function_argument_at(struct
     return argument;
 }
 
-void preprocessor_token_push_to_function_arguments(struct preprocessor_function_arguments *arguments, struct token *token)
-{
-    struct preprocessor_function_argument arg = {};
-    arg.tokens = vector_create(sizeof(struct token));
-    vector_push(arg.tokens, token);
-    vector_push(arguments->arguments, &arg);
-}
-
-void preprocessor_number_push_to_function_arguments(struct preprocessor_function_arguments *arguments, int64_t number)
-{
-    struct token t;
-    t.type = TOKEN_TYPE_NUMBER;
-    t.llnum = number;
-    preprocessor_token_push_to_function_arguments(arguments, &t);
-}
-
-void preprocessor_function_argument_push_to_vec(struct preprocessor_function_argument *argument, struct vector *vector_out)
-{
-    vector_set_peek_pointer(argument->tokens, 0);
-    struct token *token = vector_peek(argument->tokens);
-    while (token)
-    {
-        vector_push(vector_out, token);
-        token = vector_peek(argument->tokens);
-    }
-}
-
-void *preprocessor_handle_number_token(struct expressionable *expressionable)
-{
-    struct token *token = expressionable_token_next(expressionable);
-    return preprocessor_node_create(&(struct preprocessor_node){.type = PREPROCESSOR_NUMBER_NODE, .const_val.llnum = token->llnum});
-}
-
-void *preprocessor_handle_identifier_token(struct expressionable *expressionable)
-{
-    struct token *token = expressionable_token_next(expressionable);
-    bool is_preprocessor_keyword = preprocessor_is_keyword(token->sval);
-    int type = PREPROCESSOR_IDENTIFIER_NODE;
-    if (is_preprocessor_keyword)
-    {
-        type = PREPROCESSOR_KEYWORD_NODE;
-    }
-
-    return preprocessor_node_create(&(struct preprocessor_node){.type = type, .sval = token->sval});
-}
-
 /**
  * Will read the next token from the provided token vector "priority_token_vec".
  * If theirs no more tokens then this function will read the next token in the compiler->token_vec_original token vector as long as the
@@ -270,164 +174,8 @@ struct token *preprocessor_peek_next_token_with_vector_no_increment(struct compi
     return token;
 }
 
-void preprocessor_make_expression_node(struct expressionable *expressionable, void *left_node_ptr, void *right_node_ptr, const char *op)
-{
-    struct preprocessor_node exp_node;
-    exp_node.type = PREPROCESSOR_EXPRESSION_NODE;
-    exp_node.exp.left = left_node_ptr;
-    exp_node.exp.right = right_node_ptr;
-    exp_node.exp.op = op;
-
-    expressionable_node_push(expressionable, preprocessor_node_create(&exp_node));
-}
-
-void preprocessor_make_parentheses_node(struct expressionable *expressionable, void *node_ptr)
-{
-    struct preprocessor_node *node = node_ptr;
-    struct preprocessor_node parentheses_node;
-    parentheses_node.type = PREPROCESSOR_PARENTHESES_NODE;
-    parentheses_node.parenthesis.exp = node_ptr;
-    expressionable_node_push(expressionable, preprocessor_node_create(&parentheses_node));
-}
-
-void *preprocessor_get_left_node(struct expressionable *expressionable, void *target_node)
-{
-    struct preprocessor_node *node = target_node;
-    return node->exp.left;
-}
-
-void *preprocessor_get_right_node(struct expressionable *expressionable, void *target_node)
-{
-    struct preprocessor_node *node = target_node;
-    return node->exp.right;
-}
-
-int preprocessor_get_node_type(struct expressionable *expressionable, void *node)
-{
-    int generic_type = EXPRESSIONABLE_GENERIC_TYPE_NON_GENERIC;
-    struct preprocessor_node *preprocessor_node = node;
-    switch (preprocessor_node->type)
-    {
-    case PREPROCESSOR_NUMBER_NODE:
-        generic_type = EXPRESSIONABLE_GENERIC_TYPE_NUMBER;
-        break;
-
-    case PREPROCESSOR_IDENTIFIER_NODE:
-    case PREPROCESSOR_KEYWORD_NODE:
-        generic_type = EXPRESSIONABLE_GENERIC_TYPE_IDENTIFIER;
-        break;
-
-    case PREPROCESSOR_UNARY_NODE:
-        generic_type = EXPRESSIONABLE_GENERIC_TYPE_UNARY;
-        break;
-    case PREPROCESSOR_EXPRESSION_NODE:
-        generic_type = EXPRESSIONABLE_GENERIC_TYPE_EXPRESSION;
-        break;
-
-    case PREPROCESSOR_PARENTHESES_NODE:
-        generic_type = EXPRESSIONABLE_GENERIC_TYPE_PARENTHESES;
-        break;
-    }
-    return generic_type;
-}
-
-const char *preprocessor_get_node_operator(struct expressionable *expressionable, void *target_node)
-{
-    struct preprocessor_node *preprocessor_node = target_node;
-    return preprocessor_node->exp.op;
-}
-
-void **preprocessor_get_left_node_address(struct expressionable *expressionable, void *target_node)
-{
-    return (void **)&((struct preprocessor_node *)(target_node))->exp.left;
-}
-
-void **preprocessor_get_right_node_address(struct expressionable *expressionable, void *target_node)
-{
-    return (void **)&((struct preprocessor_node *)(target_node))->exp.right;
-}
-
-void preprocessor_set_expression_node(struct expressionable *expressionable, void *node, void *left_node, void *right_node, const char *op)
-{
-    struct preprocessor_node *preprocessor_node = node;
-    preprocessor_node->exp.left = left_node;
-    preprocessor_node->exp.right = right_node;
-    preprocessor_node->exp.op = op;
-}
-
-void preprocessor_make_unary_node(struct expressionable *expressionable, const char *op, void *right_operand_node_ptr)
-{
-    struct preprocessor_node *right_operand_node = right_operand_node_ptr;
-    void *unary_node = preprocessor_node_create(&(struct preprocessor_node){.type = PREPROCESSOR_UNARY_NODE, .unary_node.op = op, .unary_node.operand_node = right_operand_node_ptr});
-    expressionable_node_push(expressionable, unary_node);
-}
-
-void preprocessor_make_unary_indirection_node(struct expressionable *expressionable, int depth, void *right_operand_node_ptr)
-{
-    struct preprocessor_node *right_operand_node = right_operand_node_ptr;
-    void *unary_node = preprocessor_node_create(&(struct preprocessor_node){.type = PREPROCESSOR_UNARY_NODE, .unary_node.op = "*", .unary_node.operand_node = right_operand_node_ptr, .unary_node.indirection.depth = depth});
-    expressionable_node_push(expressionable, unary_node);
-}
-
-bool preprocessor_expecting_additional_node(struct expressionable *expressionable, void *node_ptr)
-{
-    struct preprocessor_node *node = node_ptr;
-    return node->type == PREPROCESSOR_KEYWORD_NODE && S_EQ(node->sval, "defined");
-}
-
-bool preprocessor_is_custom_operator(struct expressionable *expressionable, struct token *token)
-{
-    return false;
-}
-
-bool preprocessor_should_join_nodes(struct expressionable *expressionable, void *previous_node_ptr, void *node_ptr)
-{
-    return true;
-}
-
-void *preprocessor_join_nodes(struct expressionable *expressionable, void *previous_node_ptr, void *node_ptr)
-{
-    struct preprocessor_node *previous_node = previous_node_ptr;
-    struct preprocessor_node *node = node_ptr;
-
-    return preprocessor_node_create(&(struct preprocessor_node){.type = PREPROCESSOR_JOINED_NODE, .joined.left = previous_node, .joined.right = node});
-}
-
-void preprocessor_make_tenary_node(struct expressionable *expressionable, void *true_result_node_ptr, void *false_result_node_ptr)
-{
-    struct preprocessor_node *true_result_node = true_result_node_ptr;
-    struct preprocessor_node *false_result_node = false_result_node_ptr;
-
-    expressionable_node_push(expressionable, preprocessor_node_create(&(struct preprocessor_node){.type = PREPROCESSOR_TENARY_NODE, .tenary.true_node = true_result_node, .tenary.false_node = false_result_node}));
-}
-struct expressionable_config preprocessor_expressionable_config =
-    {
-        .callbacks.handle_number_callback = preprocessor_handle_number_token,
-        .callbacks.handle_identifier_callback = preprocessor_handle_identifier_token,
-        .callbacks.make_unary_node = preprocessor_make_unary_node,
-        .callbacks.make_expression_node = preprocessor_make_expression_node,
-        .callbacks.make_parentheses_node = preprocessor_make_parentheses_node,
-        .callbacks.make_tenary_node = preprocessor_make_tenary_node,
-        .callbacks.get_node_type = preprocessor_get_node_type,
-        .callbacks.get_left_node = preprocessor_get_left_node,
-        .callbacks.get_right_node = preprocessor_get_right_node,
-        .callbacks.get_node_operator = preprocessor_get_node_operator,
-        .callbacks.get_left_node_address = preprocessor_get_left_node_address,
-        .callbacks.get_right_node_address = preprocessor_get_right_node_address,
-        .callbacks.set_exp_node = preprocessor_set_expression_node,
-        .callbacks.should_join_nodes = preprocessor_should_join_nodes,
-        .callbacks.join_nodes = preprocessor_join_nodes,
-        .callbacks.expecting_additional_node = preprocessor_expecting_additional_node,
-        .callbacks.is_custom_operator = preprocessor_is_custom_operator};
-
 void preprocessor_handle_token(struct compile_process *compiler, struct token *token);
-
-struct preprocessor_function_arguments *preprocessor_function_arguments_create()
-{
-    struct preprocessor_function_arguments *args = calloc(sizeof(struct preprocessor_function_arguments), 1);
-    args->arguments = vector_create(sizeof(struct preprocessor_function_argument));
-    return args;
-}
+static void preprocessor_handle_source_token(struct compile_process *compiler, struct token *token);
 
 int preprocessor_function_arguments_count(struct preprocessor_function_arguments *arguments)
 {
@@ -439,48 +187,44 @@ int preprocessor_function_arguments_count(struct preprocessor_function_arguments
     return vector_count(arguments->arguments);
 }
 
-struct vector *preprocessor_function_arguments_vector(struct preprocessor_function_arguments *arguments)
+struct preprocessor *compiler_preprocessor(struct compile_process *compiler)
 {
-    return arguments->arguments;
+    return compiler->preprocessor;
 }
 
-void preprocessor_function_argument_free(struct preprocessor_function_argument *argument)
+struct token *preprocessor_previous_token(struct compile_process *compiler)
 {
-    vector_free(argument->tokens);
+    return vector_peek_at(compiler->token_vec_original, compiler->token_vec_original->pindex - 1);
 }
-
-void preprocessor_function_arguments_free(struct preprocessor_function_arguments *arguments)
+/**
+ * Lexes the next piece of a file that is lexed on demand, returns false if the whole file has been lexed
+ */
+static bool preprocessor_lex_more(struct compile_process *compiler)
 {
-    vector_set_peek_pointer(arguments->arguments, 0);
-    struct preprocessor_function_argument *argument = vector_peek(arguments->arguments);
-    while (argument)
+    struct lex_process *lex_process = compiler->lex_process;
+    if (!lex_process)
     {
-        preprocessor_function_argument_free(argument);
-        argument = vector_peek(arguments->arguments);
+        return false;
     }
 
-    free(arguments);
-}
-
-void preprocessor_function_argument_push(struct preprocessor_function_arguments *arguments, struct vector *value_vec)
-{
-    struct preprocessor_function_argument arg;
-    arg.tokens = vector_clone(value_vec);
-    vector_push(arguments->arguments, &arg);
-}
-
-struct preprocessor *compiler_preprocessor(struct compile_process *compiler)
-{
-    return compiler->preprocessor;
+    int total = vector_count(compiler->token_vec_original);
+    compile_timing_begin(compiler, COMPILE_PHASE_LEX);
+    if (!lex_next_conditional(lex_process))
+    {
+        compiler->lex_process = NULL;
+    }
+    compile_timing_end(compiler, vector_count(compiler->token_vec_original) - total);
+    return true;
 }
 
-struct token *preprocessor_previous_token(struct compile_process *compiler)
-{
-    return vector_peek_at(compiler->token_vec_original, compiler->token_vec_original->pindex - 1);
-}
 struct token *preprocessor_next_token(struct compile_process *compiler)
 {
-    return vector_peek(compiler->token_vec_original);
+    struct token *token = vector_peek(compiler->token_vec_original);
+    while (!token && preprocessor_lex_more(compiler))
+    {
+        token = vector_peek(compiler->token_vec_original);
+    }
+    return token;
 }
 
 
@@ -497,7 +241,12 @@ struct token *preprocessor_next_token_skip_nl(struct compile_process *compiler)
 
 struct token *preprocessor_next_token_no_increment(struct compile_process *compiler)
 {
-    return vector_peek_no_increment(compiler->token_vec_original);
+    struct token *token = vector_peek_no_increment(compiler->token_vec_original);
+    while (!token && preprocessor_lex_more(compiler))
+    {
+        token = vector_peek_no_increment(compiler->token_vec_original);
+    }
+    return token;
 }
 
 struct token *preprocessor_peek_next_token_skip_nl(struct compile_process *compiler)
@@ -558,72 +307,6 @@ void preprocessor_token_vec_push_src_token(struct compile_process *compiler, str
     vector_push(compiler->token_vec, token);
 }
 
-void preprocessor_handle_concat_part(struct compile_process *compiler, struct preprocessor_definition *definition, struct preprocessor_function_arguments *arguments, struct token *token, struct vector *definition_token_vec, struct vector *value_vec_target)
-{
-    preprocessor_macro_function_push_something(compiler, definition, arguments, token, definition_token_vec, value_vec_target);
-}
-
-void preprocessor_handle_concat_finalize(struct compile_process *compiler, struct vector *tmp_vec, struct vector *value_vec_target)
-{
-    // Join our vector as we have the arguments resolved
-    struct vector *joined_vec = tokens_join_vector(compiler, tmp_vec);
-
-    // Now write it out
-    vector_insert(value_vec_target, joined_vec, 0);
-}
-void preprocessor_handle_concat(struct compile_process *compiler, struct preprocessor_definition *definition, struct preprocessor_function_arguments *arguments, struct token *arg_token, struct vector *definition_token_vec, struct vector *value_vec_target)
-{
-
-    // Let's skip the ##
-    vector_peek(definition_token_vec);
-    vector_peek(definition_token_vec);
-
-    // Now lets get the right operand
-    struct token *right_token = vector_peek(definition_token_vec);
-    if (!right_token)
-    {
-        compiler_error(compiler, "No right operand provided for concat preprocessor operator ##");
-    }
-
-    struct vector *tmp_vec = vector_create(sizeof(struct token));
-    preprocessor_handle_concat_part(compiler, definition, arguments, arg_token, definition_token_vec, tmp_vec);
-    preprocessor_handle_concat_part(compiler, definition, arguments, right_token, definition_token_vec, tmp_vec);
-    preprocessor_handle_concat_finalize(compiler, tmp_vec, value_vec_target);
-}
-
-void preprocessor_handle_function_argument_to_string(struct compile_process *compiler, struct vector *src_vec, struct vector *value_vec_target, struct preprocessor_definition *definition, struct preprocessor_function_arguments *arguments)
-{
-    // Next token is the identifier that must become a string
-    struct token *next_token = vector_peek(src_vec);
-
-    if (!next_token || next_token->type != TOKEN_TYPE_IDENTIFIER)
-    {
-        compiler_error(compiler, "No macro function argument was provided to convert to a string");
-    }
-
-    int argument_index = preprocessor_definition_argument_exists(definition, next_token->sval);
-    if (argument_index == -1)
-    {
-        compiler_error(compiler, "Unexpected macro function argument %s", next_token->sval);
-    }
-
-    struct preprocessor_function_argument *argument = preprocessor_function_argument_at(arguments, argument_index);
-    if (!argument)
-    {
-        FAIL_ERR("BUG: Argument exists but failed to pull");
-    }
-
-    // Okay let's convert the argument into a string
-    // Get the first token
-
-    struct token *first_token_for_argument = vector_peek_at(argument->tokens, 0);
-    // Let's create a string token
-    struct token str_token = {};
-    str_token.type = TOKEN_TYPE_STRING;
-    str_token.sval = first_token_for_argument->sval;
-    vector_push(value_vec_target, &str_token);
-}
-
 void preprocessor_token_vec_push_src_resolve_definition(struct compile_process *compiler, struct vector *src_vec, struct vector *dst_vec, struct token *token)
 {
     // I am pretty sure typedef is the only other thing we need to care for in this situation
@@ -641,292 +324,331 @@ void preprocessor_token_vec_push_src_resolve_definition(struct compile_process *
     preprocessor_token_vec_push_src_token_to_dst(compiler, token, dst_vec);
 }
 
-void preprocessor_token_vec_push_src_resolve_definitions(struct compile_process *compiler, struct vector *src_vec, struct vector *dst_vec)
+bool preprocessor_is_preprocessor_keyword(int keyword)
 {
-    assert(src_vec != compiler->token_vec);
-    vector_set_peek_pointer(src_vec, 0);
-    struct token *token = vector_peek(src_vec);
-    while (token)
+    switch (keyword)
     {
-        preprocessor_token_vec_push_src_resolve_definition(compiler, src_vec, dst_vec, token);
-        token = vector_peek(src_vec);
+    case KEYWORD_DEFINE:
+    case KEYWORD_UNDEF:
+    case KEYWORD_WARNING:
+    case KEYWORD_ERROR:
+    case KEYWORD_IF:
+    case KEYWORD_ELIF:
+    case KEYWORD_IFDEF:
+    case KEYWORD_IFNDEF:
+    case KEYWORD_ENDIF:
+    case KEYWORD_INCLUDE:
+    case KEYWORD_PRAGMA:
+    case KEYWORD_LINE:
+    case KEYWORD_TYPEDEF:
+        return true;
     }
-}
 
-bool preprocessor_is_preprocessor_keyword(const char *value)
-{
-    return S_EQ(value, "define") ||
-           S_EQ(value, "undef") ||
-           S_EQ(value, "warning") ||
-           S_EQ(value, "error") ||
-           S_EQ(value, "if") ||
-           S_EQ(value, "elif") ||
-           S_EQ(value, "ifdef") ||
-           S_EQ(value, "ifndef") ||
-           S_EQ(value, "endif") ||
-           S_EQ(value, "include") ||
-           S_EQ(value, "typedef");
-}
-
-bool preprocessor_token_is_preprocessor_keyword(struct token *token)
-{
-    return token->type == TOKEN_TYPE_IDENTIFIER || token->type == TOKEN_TYPE_KEYWORD && preprocessor_is_preprocessor_keyword(token->sval);
+    return false;
 }
 
-bool preprocessor_token_is_include(struct token *token)
+/**
+ * Returns the directive the given token names, i.e KEYWORD_DEFINE for "define".
+ * KEYWORD_NONE if the token is not a preprocessor keyword
+ */
+static int preprocessor_token_keyword(struct token *token)
 {
-    if (!preprocessor_token_is_preprocessor_keyword(token))
+    if (token->type != TOKEN_TYPE_IDENTIFIER && token->type != TOKEN_TYPE_KEYWORD)
     {
-        return false;
+        return KEYWORD_NONE;
     }
-    return S_EQ(token->sval, "include");
+
+    return preprocessor_is_preprocessor_keyword(token->keyword) ? token->keyword : KEYWORD_NONE;
 }
 
 bool preprocessor_token_is_typedef(struct token *token)
 {
-    if (!preprocessor_token_is_preprocessor_keyword(token))
-    {
-        return false;
-    }
+    return preprocessor_token_keyword(token) == KEYWORD_TYPEDEF;
+}
 
-    return S_EQ(token->sval, "typedef");
+struct compile_process *preprocessor_compiler(struct preprocessor *preprocessor)
+{
+    return preprocessor->compiler;
 }
 
-bool preprocessor_token_is_define(struct token *token)
+struct vector *preprocessor_definition_value_for_standard(struct preprocessor_definition *definition)
 {
-    if (!preprocessor_token_is_preprocessor_keyword(token))
-    {
-        return false;
-    }
+    return definition->standard.value;
+}
 
-    return (S_EQ(token->sval, "define"));
+struct vector *preprocessor_definition_value_for_native(struct preprocessor_definition *definition, struct preprocessor_function_arguments *arguments)
+{
+    return definition->native.value(definition, arguments);
 }
 
-bool preprocessor_token_is_undef(struct token *token)
+struct vector *preprocessor_definition_value_recursive_for_typedef_or_other(struct preprocessor_definition *definition, const char *last_type_str)
 {
-    if (!preprocessor_token_is_preprocessor_keyword(token))
+    if (definition->type != PREPROCESSOR_DEFINITION_TYPEDEF)
     {
-        return false;
+        // Not a typedef then what are we doing here?
+        return preprocessor_definition_value(definition);
     }
 
-    return (S_EQ(token->sval, "undef"));
+    return definition->_typedef.value;
 }
-bool preprocessor_token_is_warning(struct token *token)
+struct vector *preprocessor_definition_value_for_typedef(struct preprocessor_definition *definition)
 {
-    if (!preprocessor_token_is_preprocessor_keyword(token))
-    {
-        return false;
-    }
-
-    return (S_EQ(token->sval, "warning"));
+    return preprocessor_definition_value_recursive_for_typedef_or_other(definition, NULL);
 }
 
-bool preprocessor_token_is_error(struct token *token)
+struct vector *preprocessor_definition_value_with_arguments(struct preprocessor_definition *definition, struct preprocessor_function_arguments *arguments)
 {
-    if (!preprocessor_token_is_preprocessor_keyword(token))
+    if (definition->type == PREPROCESSOR_DEFINITION_NATIVE_CALLBACK)
     {
-        return false;
+        return preprocessor_definition_value_for_native(definition, arguments);
+    }
+    else if (definition->type == PREPROCESSOR_DEFINITION_TYPEDEF)
+    {
+        return preprocessor_definition_value_for_typedef(definition);
     }
 
-    return (S_EQ(token->sval, "error"));
+    return preprocessor_definition_value_for_standard(definition);
 }
-
 /**
- * Many many functions, maybe better for an array if valid keywords
+ * Returns the token value vector for this given definition
  */
-bool preprocessor_token_is_ifdef(struct token *token)
+struct vector *preprocessor_definition_value(struct preprocessor_definition *definition)
 {
-    if (!preprocessor_token_is_preprocessor_keyword(token))
-    {
-        return false;
-    }
-
-    return (S_EQ(token->sval, "ifdef"));
+    return preprocessor_definition_value_with_arguments(definition, NULL);
 }
 
-bool preprocessor_token_is_ifndef(struct token *token)
+/**
+ * Searches for a hashtag symbol along with the given identifier.
+ * If found the hashtag token and identifier token are both popped from the stack
+ * Only the target identifier token representing the KEYWORD_* "keyword" is returned.
+ * 
+ * NO match return null.
+ */
+struct token *preprocessor_hashtag_and_identifier(struct compile_process *compiler, int keyword)
 {
-    if (!preprocessor_token_is_preprocessor_keyword(token))
+    // No token then how can we continue?
+    if (!preprocessor_next_token_no_increment(compiler))
+        return NULL;
+
+    if (!token_is_symbol(preprocessor_next_token_no_increment(compiler), '#'))
     {
-        return false;
+        return NULL;
     }
 
-    return (S_EQ(token->sval, "ifndef"));
-}
+    vector_save(compiler->token_vec_original);
+    // Ok skip the hashtag symbol
+    preprocessor_next_token(compiler);
 
-bool preprocessor_token_is_if(struct token *token)
-{
-    if (!preprocessor_token_is_preprocessor_keyword(token))
+    struct token *target_token = preprocessor_next_token_no_increment(compiler);
+    // Preprocessor always has priority even if we define what is
+    // a C keyword.
+    if (target_token &&
+        (target_token->type == TOKEN_TYPE_IDENTIFIER || target_token->type == TOKEN_TYPE_KEYWORD) &&
+        target_token->keyword == keyword)
     {
-        return false;
+        // Pop off the target token
+        preprocessor_next_token(compiler);
+        // Purge the vector save
+        vector_save_purge(compiler->token_vec_original);
+        return target_token;
     }
 
-    return (S_EQ(token->sval, "if"));
-}
+    vector_restore(compiler->token_vec_original);
 
-bool preprocessor_token_is_elif(struct token *token)
-{
-    if (!preprocessor_token_is_preprocessor_keyword(token))
-    {
-        return false;
-    }
-    return (S_EQ(token->sval, "elif"));
+    return NULL;
 }
 
-struct compile_process *preprocessor_compiler(struct preprocessor *preprocessor)
+/**
+ * The expansion cache holds the tokens that a macro function call written in the source
+ * expanded to. Such an expansion depends on nothing but the definitions and the tokens
+ * between the brackets of the call, so while the definitions stay the same an identical
+ * call expands to the same tokens and takes a copy of them.
+ *
+ * Calls are found by a hash of the definition and the call in an open addressed table.
+ * Most calls are only ever written once, their expansions are not copied until a call
+ * is written a second time.
+ */
+struct preprocessor_expansion_cache_entry
 {
-    return preprocessor->compiler;
-}
+    struct preprocessor_definition *definition;
 
-struct vector *preprocessor_definition_value_for_standard(struct preprocessor_definition *definition)
+    // The tokens between the brackets of the call
+    struct token *call;
+    int total_call;
+
+    struct token *expanded;
+    int total_expanded;
+};
+
+struct preprocessor_expansion_cache_slot
 {
-    return definition->standard.value;
-}
+    // Zero for an empty slot
+    uint64_t hash;
+    // NULL while the call has only been seen once
+    struct preprocessor_expansion_cache_entry *entry;
+};
 
-struct vector *preprocessor_definition_value_for_native(struct preprocessor_definition *definition, struct preprocessor_function_arguments *arguments)
+static void preprocessor_expansion_cache_entry_free(struct preprocessor_expansion_cache_entry *entry)
 {
-    return definition->native.value(definition, arguments);
+    free(entry->call);
+    free(entry->expanded);
+    free(entry);
 }
 
-struct vector *preprocessor_definition_value_recursive_for_typedef_or_other(struct preprocessor_definition *definition, const char *last_type_str)
+/**
+ * Empties the cache, any definition that is added or removed can change what a cached call expands to
+ */
+static void preprocessor_expansion_cache_clear(struct preprocessor *preprocessor)
 {
-    if (definition->type != PREPROCESSOR_DEFINITION_TYPEDEF)
+    struct preprocessor_expansion_cache *cache = &preprocessor->expansion_cache;
+    if (cache->count == 0)
     {
-        // Not a typedef then what are we doing here?
-        return preprocessor_definition_value(definition);
+        return;
     }
 
-    return definition->_typedef.value;
-}
-struct vector *preprocessor_definition_value_for_typedef(struct preprocessor_definition *definition)
-{
-    return preprocessor_definition_value_recursive_for_typedef_or_other(definition, NULL);
+    for (size_t i = 0; i < cache->size; i++)
+    {
+        if (cache->slots[i].entry)
+        {
+            preprocessor_expansion_cache_entry_free(cache->slots[i].entry);
+        }
+    }
+    memset(cache->slots, 0, sizeof(struct preprocessor_expansion_cache_slot) * cache->size);
+    cache->count = 0;
 }
 
-struct vector *preprocessor_definition_value_with_arguments(struct preprocessor_definition *definition, struct preprocessor_function_arguments *arguments)
+static bool preprocessor_expansion_cache_token_equal(struct token *a, struct token *b)
 {
-    if (definition->type == PREPROCESSOR_DEFINITION_NATIVE_CALLBACK)
+    if (a->type != b->type || a->whitespace != b->whitespace)
     {
-        return preprocessor_definition_value_for_native(definition, arguments);
+        return false;
     }
-    else if (definition->type == PREPROCESSOR_DEFINITION_TYPEDEF)
+
+    switch (a->type)
     {
-        return preprocessor_definition_value_for_typedef(definition);
+    case TOKEN_TYPE_IDENTIFIER:
+    case TOKEN_TYPE_KEYWORD:
+    case TOKEN_TYPE_OPERATOR:
+    case TOKEN_TYPE_STRING:
+    case TOKEN_TYPE_COMMENT:
+        return S_EQ(a->sval, b->sval);
+
+    case TOKEN_TYPE_NUMBER:
+        return a->llnum == b->llnum && a->num.type == b->num.type;
+
+    case TOKEN_TYPE_SYMBOL:
+        return a->cval == b->cval;
     }
 
-    return preprocessor_definition_value_for_standard(definition);
+    return true;
 }
+
 /**
- * Returns the token value vector for this given definition
+ * Hashes the definition and the tokens between the brackets of the call, equal strings
+ * at different addresses only cost a miss
  */
-struct vector *preprocessor_definition_value(struct preprocessor_definition *definition)
+static uint64_t preprocessor_expansion_cache_hash(struct preprocessor_definition *definition, struct token *tokens, int total)
 {
-    return preprocessor_definition_value_with_arguments(definition, NULL);
+    uint64_t hash = tokens_hash(tokens, total, (uintptr_t)definition);
+    // Zero marks an empty slot
+    return hash ? hash : 1;
 }
 
-int preprocessor_definition_evaluated_value_for_standard(struct preprocessor_definition *definition)
+static struct preprocessor_expansion_cache_slot *preprocessor_expansion_cache_slot(struct preprocessor_expansion_cache *cache, uint64_t hash)
 {
-    struct token *token = vector_back(definition->standard.value);
-    if (token->type == TOKEN_TYPE_IDENTIFIER)
+    size_t index = hash & (cache->size - 1);
+    while (cache->slots[index].hash && cache->slots[index].hash != hash)
     {
-        // We have a definition value of identifier
-        // therefore we are pointing to another definition i.e
-        // #define CBA 50
-        // #define ABC CBA
-
-        return preprocessor_parse_evaluate_token(definition->preprocessor->compiler, token);
+        index = (index + 1) & (cache->size - 1);
     }
+    return &cache->slots[index];
+}
 
-    if (token->type != TOKEN_TYPE_NUMBER)
+static void preprocessor_expansion_cache_grow(struct preprocessor_expansion_cache *cache)
+{
+    struct preprocessor_expansion_cache_slot *old_slots = cache->slots;
+    size_t old_size = cache->size;
+    cache->size = old_size ? old_size * 2 : 1024;
+    cache->slots = calloc(cache->size, sizeof(struct preprocessor_expansion_cache_slot));
+    for (size_t i = 0; i < old_size; i++)
     {
-        compiler_error(preprocessor_compiler(definition->preprocessor), "The definition %s must hold a number value, unable to use macro IF", definition->name);
+        if (old_slots[i].hash)
+        {
+            *preprocessor_expansion_cache_slot(cache, old_slots[i].hash) = old_slots[i];
+        }
     }
-    return token->llnum;
+    free(old_slots);
 }
 
-int preprocessor_definition_evaluated_value_for_native(struct preprocessor_definition *definition, struct preprocessor_function_arguments *arguments)
+/**
+ * Returns the slot of the call, an empty slot if the cache has not seen it
+ */
+static struct preprocessor_expansion_cache_slot *preprocessor_expansion_cache_lookup(struct preprocessor *preprocessor, uint64_t hash)
 {
-    return definition->native.evaluate(definition, arguments);
+    struct preprocessor_expansion_cache *cache = &preprocessor->expansion_cache;
+    // Kept at most half full so probes stay short
+    if ((cache->count + 1) * 2 > cache->size)
+    {
+        preprocessor_expansion_cache_grow(cache);
+    }
+    return preprocessor_expansion_cache_slot(cache, hash);
 }
 
-int preprocessor_definition_evaluated_value(struct preprocessor_definition *definition, struct preprocessor_function_arguments *arguments)
+static bool preprocessor_expansion_cache_entry_matches(struct preprocessor_expansion_cache_entry *entry, struct preprocessor_definition *definition, struct token *tokens, int total)
 {
-    if (definition->type == PREPROCESSOR_DEFINITION_STANDARD)
+    if (entry->definition != definition || entry->total_call != total)
     {
-        return preprocessor_definition_evaluated_value_for_standard(definition);
+        return false;
     }
-    else if (definition->type == PREPROCESSOR_DEFINITION_NATIVE_CALLBACK)
+
+    // Two calls can share a hash, the tokens decide
+    for (int i = 0; i < total; i++)
     {
-        return preprocessor_definition_evaluated_value_for_native(definition, arguments);
+        if (!preprocessor_expansion_cache_token_equal(&entry->call[i], &tokens[i]))
+        {
+            return false;
+        }
     }
-
-    compiler_error(preprocessor_compiler(definition->preprocessor), "The definition %s cannot be evaluated into a number");
+    return true;
 }
 
-/**
- * Searches for a hashtag symbol along with the given identifier.
- * If found the hashtag token and identifier token are both popped from the stack
- * Only the target identifier token representing "str" is returned.
- * 
- * NO match return null.
- */
-struct token *preprocessor_hashtag_and_identifier(struct compile_process *compiler, const char *str)
+static void preprocessor_expansion_cache_store(struct preprocessor_expansion_cache_slot *slot, struct preprocessor_definition *definition, struct token *call, int total_call, struct token *expanded, int total_expanded)
 {
-    // No token then how can we continue?
-    if (!preprocessor_next_token_no_increment(compiler))
-        return NULL;
-
-    if (!token_is_symbol(preprocessor_next_token_no_increment(compiler), '#'))
-    {
-        return NULL;
-    }
-
-    vector_save(compiler->token_vec_original);
-    // Ok skip the hashtag symbol
-    preprocessor_next_token(compiler);
+    struct preprocessor_expansion_cache_entry *entry = calloc(1, sizeof(struct preprocessor_expansion_cache_entry));
+    entry->definition = definition;
+    entry->call = malloc(sizeof(struct token) * (total_call + 1));
+    memcpy(entry->call, call, sizeof(struct token) * total_call);
+    entry->total_call = total_call;
+    entry->expanded = malloc(sizeof(struct token) * (total_expanded + 1));
+    memcpy(entry->expanded, expanded, sizeof(struct token) * total_expanded);
+    entry->total_expanded = total_expanded;
 
-    struct token *target_token = preprocessor_next_token_no_increment(compiler);
-    // Preprocessor always has priority even if we define what is
-    // a C keyword.
-    if (token_is_identifier(target_token, str) ||
-        token_is_keyword(target_token, str))
+    // A call that shares the hash of the one cached before it takes its place
+    if (slot->entry)
     {
-        // Pop off the target token
-        preprocessor_next_token(compiler);
-        // Purge the vector save
-        vector_save_purge(compiler->token_vec_original);
-        return target_token;
+        preprocessor_expansion_cache_entry_free(slot->entry);
     }
-
-    vector_restore(compiler->token_vec_original);
-
-    return NULL;
+    slot->entry = entry;
 }
 
 struct preprocessor_definition *preprocessor_get_definition(struct preprocessor *preprocessor, const char *name)
 {
-    vector_set_peek_pointer(preprocessor->definitions, 0);
-    struct preprocessor_definition *definition = vector_peek_ptr(preprocessor->definitions);
-    while (definition)
-    {
-        if (S_EQ(definition->name, name))
-        {
-            break;
-        }
-        definition = vector_peek_ptr(preprocessor->definitions);
-    }
-
-    return definition;
+    return hashmap_data(preprocessor->definitions, name);
 }
 
 bool preprocessor_remove_definition(struct preprocessor *preprocessor, const char *name)
 {
-    struct preprocessor_definition *definition = preprocessor_get_definition(preprocessor, name);
-    if (!definition)
-        return false;
+    preprocessor_expansion_cache_clear(preprocessor);
+    return hashmap_remove(preprocessor->definitions, name);
+}
 
-    vector_pop_value(preprocessor->definitions, definition);
-    return true;
+/**
+ * Adds the definition to the definition table, an existing definition with the same name is replaced.
+ */
+static void preprocessor_definition_register(struct preprocessor *preprocessor, struct preprocessor_definition *definition)
+{
+    preprocessor_expansion_cache_clear(preprocessor);
+    hashmap_insert(preprocessor->definitions, definition->name, definition);
 }
 
 bool preprocessor_token_is_definition_identifier(struct compile_process *compiler, struct token *token)
@@ -951,7 +673,7 @@ struct preprocessor_definition *preprocessor_definition_create_native(const char
     definition->native.value = value;
     definition->preprocessor = preprocessor;
 
-    vector_push(preprocessor->definitions, &definition);
+    preprocessor_definition_register(preprocessor, definition);
     return definition;
 }
 
@@ -963,30 +685,13 @@ struct preprocessor_definition *preprocessor_definition_create_typedef(const cha
     definition->_typedef.value = value_vec;
     definition->preprocessor = preprocessor;
 
-    vector_push(preprocessor->definitions, &definition);
+    preprocessor_definition_register(preprocessor, definition);
     return definition;
 }
 
-void preprocessor_definition_remove(struct preprocessor *preprocessor, const char *name)
-{
-    vector_set_peek_pointer(preprocessor->definitions, 0);
-    struct preprocessor_definition *current_definition = vector_peek_ptr(preprocessor->definitions);
-    while (current_definition)
-    {
-        if (S_EQ(current_definition->name, name))
-        {
-            // We found the definition to remove, pop it.
-            vector_pop_last_peek(preprocessor->definitions);
-        }
-        current_definition = vector_peek_ptr(preprocessor->definitions);
-    }
-}
-
 struct preprocessor_definition *preprocessor_definition_create(const char *name, struct vector *value_vec, struct vector *arguments, struct preprocessor *preprocessor)
 {
-    // Unset the definition if it already exists
-    preprocessor_definition_remove(preprocessor, name);
-
+    // A redefinition replaces the existing definition in the table
     struct preprocessor_definition *definition = calloc(sizeof(struct preprocessor_definition), 1);
     definition->type = PREPROCESSOR_DEFINITION_STANDARD;
     definition->name = name;
@@ -999,7 +704,7 @@ struct preprocessor_definition *preprocessor_definition_create(const char *name,
         definition->type = PREPROCESSOR_DEFINITION_MACRO_FUNCTION;
     }
 
-    vector_push(preprocessor->definitions, &definition);
+    preprocessor_definition_register(preprocessor, definition);
     return definition;
 }
 
@@ -1090,7 +795,7 @@ void preprocessor_parse_macro_argument_declaration(struct compile_process *compi
             }
 
             // Save the argument for later.
-            vector_push(arguments, (void *)next_token->sval);
+            vector_push(arguments, &next_token->sval);
 
             next_token = preprocessor_next_token(compiler);
             if (!token_is_operator(next_token, ",") && !token_is_symbol(next_token, ')'))
@@ -1158,7 +863,18 @@ void preprocessor_handle_include_token(struct compile_process *compiler)
     }
     // Theirs a chance no string provided, check for this later i.e include <abc.h> no quotes ""
     // Alright lets load and compile the given file
-    struct compile_process *new_compile_process = compile_include(file_path_token->sval, compiler);
+    struct compile_process *new_compile_process = NULL;
+    char path[PATH_MAX];
+    if (compile_include_resolve(file_path_token->sval, compiler, path))
+    {
+        // Already included and guarded? Then it has nothing more to give us
+        if (preprocessor_included_file_is_skippable(compiler->preprocessor, path))
+        {
+            return;
+        }
+        new_compile_process = compile_include_path(path, compiler);
+    }
+
     if (!new_compile_process)
     {
         // File does not exist? Do we have a static handler for this
@@ -1172,12 +888,38 @@ void preprocessor_handle_include_token(struct compile_process *compiler)
             return;
         }
 
-        compiler_error(compiler, "The file does not exist %s unable to include", file_path_token->sval);
+        compiler_pos_error(&file_path_token->pos, "The file does not exist %s unable to include", file_path_token->sval);
     }
     // Now that we have the new compile process we must merge the tokens with our own
     preprocessor_token_vec_push_src(compiler, new_compile_process->token_vec);
 }
 
+void preprocessor_handle_pragma_token(struct compile_process *compiler)
+{
+    struct token *token = preprocessor_next_token(compiler);
+    if (token && token_is_identifier(token, "once"))
+    {
+        preprocessor_add_included_file(compiler->preprocessor, compiler->cfile.abs_path)->once = true;
+        token = preprocessor_next_token(compiler);
+    }
+
+    // Pragmas we do not know about are ignored
+    while (token && token->type != TOKEN_TYPE_NEWLINE)
+    {
+        token = preprocessor_next_token(compiler);
+    }
+}
+
+void preprocessor_handle_line_token(struct compile_process *compiler)
+{
+    // The lexer already numbered the lines after it, as the output of -E has them
+    struct token *token = preprocessor_next_token(compiler);
+    while (token && token->type != TOKEN_TYPE_NEWLINE)
+    {
+        token = preprocessor_next_token(compiler);
+    }
+}
+
 void preprocessor_handle_typedef_body_for_brackets(struct compile_process *compiler, struct vector *token_vec, struct vector *src_vec, bool overflow_use_token_vec)
 {
     struct token *token = preprocessor_next_token_with_vector(compiler, src_vec, overflow_use_token_vec);
@@ -1329,9 +1071,55 @@ void preprocessor_handle_typedef_token(struct compile_process *compiler, struct
  */
 bool preprocessor_is_hashtag_and_any_starting_if(struct compile_process *compiler)
 {
-    return preprocessor_hashtag_and_identifier(compiler, "if") ||
-           preprocessor_hashtag_and_identifier(compiler, "ifdef") ||
-           preprocessor_hashtag_and_identifier(compiler, "ifndef");
+    return preprocessor_hashtag_and_identifier(compiler, KEYWORD_IF) ||
+           preprocessor_hashtag_and_identifier(compiler, KEYWORD_IFDEF) ||
+           preprocessor_hashtag_and_identifier(compiler, KEYWORD_IFNDEF);
+}
+
+/**
+ * Skips the lines of a group that is not compiled without lexing them, when the file is lexed
+ * on demand and nothing has been lexed past the line of the directive that started the group.
+ * The directive that ends the group is the next line to be lexed. Otherwise the group is left to
+ * be skipped token by token.
+ */
+static void preprocessor_skip_inactive(struct compile_process *compiler, bool to_endif)
+{
+    if (!compiler->lex_process)
+    {
+        return;
+    }
+
+    // What is left of the tokens must all be on the line of the directive
+    struct vector *token_vec = compiler->token_vec_original;
+    int total = vector_count(token_vec);
+    for (int i = token_vec->pindex; i < total - 1; i++)
+    {
+        struct token *token = vector_at(token_vec, i);
+        if (token->type == TOKEN_TYPE_NEWLINE && !(i > 0 && token_is_symbol(vector_at(token_vec, i - 1), '\\')))
+        {
+            return;
+        }
+    }
+
+    size_t skipped = lex_skip_inactive(compiler->lex_process, to_endif);
+    compiler->preprocessor->inactive.groups++;
+    compiler->preprocessor->inactive.bytes += skipped;
+}
+
+/**
+ * Skips the rest of a line of a group that is not compiled, with the lines it is continued on.
+ * A # only starts a directive at the start of a line, as it does when the lines are skipped
+ * without being lexed.
+ */
+static void preprocessor_skip_inactive_line(struct compile_process *compiler)
+{
+    bool continued = false;
+    struct token *token = preprocessor_next_token(compiler);
+    while (token && (token->type != TOKEN_TYPE_NEWLINE || continued))
+    {
+        continued = token_is_symbol(token, '\\');
+        token = preprocessor_next_token(compiler);
+    }
 }
 
 /**
@@ -1340,7 +1128,8 @@ bool preprocessor_is_hashtag_and_any_starting_if(struct compile_process *compile
  */
 void preprocessor_skip_to_endif(struct compile_process *compiler)
 {
-    while (!preprocessor_hashtag_and_identifier(compiler, "endif"))
+    preprocessor_skip_inactive(compiler, true);
+    while (!preprocessor_hashtag_and_identifier(compiler, KEYWORD_ENDIF))
     {
         if (preprocessor_is_hashtag_and_any_starting_if(compiler))
         {
@@ -1349,36 +1138,43 @@ void preprocessor_skip_to_endif(struct compile_process *compiler)
             continue;
         }
 
-        preprocessor_next_token(compiler);
+        preprocessor_skip_inactive_line(compiler);
     }
 }
 
 void preprocessor_read_to_end_if(struct compile_process *compiler, bool true_clause)
 {
+    if (!true_clause)
+    {
+        preprocessor_skip_inactive(compiler, false);
+    }
+
     // We have this definition we can proceed with the rest of the body, until
     // an #endif is discovered
-    while (preprocessor_next_token_no_increment(compiler) && !preprocessor_hashtag_and_identifier(compiler, "endif"))
+    while (preprocessor_next_token_no_increment(compiler) && !preprocessor_hashtag_and_identifier(compiler, KEYWORD_ENDIF))
     {
         // Read the else statement.
-        if (preprocessor_hashtag_and_identifier(compiler, "else"))
+        if (preprocessor_hashtag_and_identifier(compiler, KEYWORD_ELSE))
         {
             preprocessor_read_to_end_if(compiler, !true_clause);
             break;
         }
-        else if (preprocessor_hashtag_and_identifier(compiler, "elif"))
+
+        struct token *elif_token = preprocessor_hashtag_and_identifier(compiler, KEYWORD_ELIF);
+        if (elif_token)
         {
-            preprocessor_handle_elif_token(compiler, true_clause);
+            preprocessor_handle_elif_token(compiler, elif_token, true_clause);
             break;
         }
 
         if (true_clause)
         {
-            preprocessor_handle_token(compiler, preprocessor_next_token(compiler));
+            preprocessor_handle_source_token(compiler, preprocessor_next_token(compiler));
             continue;
         }
 
-        // Skip the unexpected token
-        preprocessor_next_token(compiler);
+        // Skip the unexpected line
+        preprocessor_skip_inactive_line(compiler);
 
         // We just skipped something as it wasent true, if we have
         // an if or ifdef statement we should now skip the entire thing
@@ -1417,507 +1213,528 @@ void preprocessor_handle_ifndef_token(struct compile_process *compiler)
     preprocessor_read_to_end_if(compiler, definition == NULL);
 }
 
-int preprocessor_evaluate_number(struct preprocessor_node *node)
+void preprocessor_handle_if_token(struct compile_process *compiler, struct token *directive)
 {
-    return node->const_val.llnum;
+    preprocessor_read_to_end_if(compiler, preprocessor_condition_evaluate(compiler, directive));
 }
 
-int preprocessor_parse_evaluate(struct compile_process *compiler, struct vector *token_vec)
+void preprocessor_handle_elif_token(struct compile_process *compiler, struct token *directive, bool previous_if_result)
 {
-    struct vector *node_vector = vector_create(sizeof(struct preprocessor_node *));
-    struct expressionable *expressionable = expressionable_create(&preprocessor_expressionable_config, token_vec, node_vector, 0);
-    expressionable_parse(expressionable);
-    struct preprocessor_node *root_node = expressionable_node_pop(expressionable);
-    return preprocessor_evaluate(compiler, root_node);
+    // Have we not yet resolved an IF statement? Then this else if is still valid
+    // evaluate it.
+    if (!previous_if_result)
+    {
+        preprocessor_read_to_end_if(compiler, preprocessor_condition_evaluate(compiler, directive));
+        return;
+    }
+
+    // Already a positive result? Then skip to endif
+    preprocessor_skip_to_endif(compiler);
 }
 
-int preprocessor_parse_evaluate_token(struct compile_process *compiler, struct token *token)
+static bool preprocessor_is_macro_function(struct preprocessor_definition *definition)
 {
-    struct vector *token_vec = vector_create(sizeof(struct token));
-    vector_push(token_vec, token);
-    return preprocessor_parse_evaluate(compiler, token_vec);
+    return definition->type == PREPROCESSOR_DEFINITION_MACRO_FUNCTION || definition->type == PREPROCESSOR_DEFINITION_NATIVE_CALLBACK;
 }
 
-int preprocessor_evaluate(struct compile_process *compiler, struct preprocessor_node *root_node);
-
-int preprocessor_evaluate_identifier(struct compile_process *compiler, struct preprocessor_node *node)
+/**
+ * A macro that is being expanded. Expansions live on the stack and point to the one
+ * they were started from, so following parent gives every macro being expanded right now.
+ *
+ * Expansion never copies a macro body or a call argument, they are read as spans of the
+ * tokens they already live in, and tokens are only copied into the output vector.
+ */
+struct preprocessor_expansion
 {
-    struct preprocessor *preprocessor = compiler_preprocessor(compiler);
-    struct preprocessor_definition *definition = preprocessor_get_definition(preprocessor, node->sval);
-    if (!definition)
-    {
-        // For some reason C returns true for evaluation if a given definition does not exist. Strange..
-        return true;
-    }
-
-    if (vector_count(preprocessor_definition_value(definition)) > 1)
-    {
-        // Multiple value definition? OKay then the entire value must be evaluated
-        struct vector *node_vector = vector_create(sizeof(struct preprocessor_node *));
-        struct expressionable *expressionable = expressionable_create(&preprocessor_expressionable_config, preprocessor_definition_value(definition), node_vector, EXPRESSIONABLE_FLAG_IS_PREPROCESSOR_EXPRESSION);
-        expressionable_parse(expressionable);
-        struct preprocessor_node *node = expressionable_node_pop(expressionable);
-        int val = preprocessor_evaluate(compiler, node);
+    struct preprocessor_definition *definition;
+    // Arguments of a macro function call, NULL for a plain definition
+    struct preprocessor_function_arguments *arguments;
+    struct preprocessor_expansion *parent;
+};
 
-        return val;
-    }
+static void preprocessor_expand_span(struct compile_process *compiler, struct token *tokens, int total, struct preprocessor_expansion *expansion, struct vector *dst_vec);
 
-    if (vector_count(preprocessor_definition_value(definition)) == 0)
+static bool preprocessor_expansion_is_active(struct preprocessor_expansion *expansion, struct preprocessor_definition *definition)
+{
+    for (; expansion; expansion = expansion->parent)
     {
-        return false;
+        if (expansion->definition == definition)
+        {
+            return true;
+        }
     }
 
-    return preprocessor_definition_evaluated_value(definition, NULL);
+    return false;
 }
 
-int preprocessor_arithmetic(struct compile_process *compiler, long left_operand, long right_operand, const char *op)
+/**
+ * Returns the argument the identifier names if the tokens are the body of a macro
+ * function, otherwise NULL
+ */
+static struct preprocessor_function_argument *preprocessor_expansion_argument(struct preprocessor_expansion *expansion, struct token *token)
 {
-    bool success = false;
-    long result = arithmetic(compiler, left_operand, right_operand, op, &success);
+    if (!expansion || !expansion->arguments || token->type != TOKEN_TYPE_IDENTIFIER)
+    {
+        return NULL;
+    }
 
-    if (!success)
+    int index = preprocessor_definition_argument_exists(expansion->definition, token->sval);
+    if (index == -1)
     {
-        compiler_error(compiler, "We do not support the operator %s for preprocessor arithmetic", op);
+        return NULL;
     }
-    return result;
-}
 
-int preprocessor_evaluate(struct compile_process *compiler, struct preprocessor_node *root_node);
+    return preprocessor_function_argument_at(expansion->arguments, index);
+}
 
 /**
- * Returns true if the given preprocessor node is a function call expression.
- * I.e ABC(50, 20, 40)
+ * Argument vectors are handed out in stack order, calls nest, so the vectors of
+ * finished calls are kept and reused rather than allocated for every call.
  */
-bool preprocessor_exp_is_macro_function_call(struct preprocessor_node *node)
-{
-    return node->type == PREPROCESSOR_EXPRESSION_NODE && S_EQ(node->exp.op, "()") && node->exp.left->type == PREPROCESSOR_IDENTIFIER_NODE;
-}
-
-void preprocessor_evaluate_function_call_argument(struct compile_process *compiler, struct preprocessor_node *node, struct preprocessor_function_arguments *arguments)
+static struct vector *preprocessor_argument_vector_take(struct preprocessor *preprocessor)
 {
-    if (node->type == PREPROCESSOR_EXPRESSION_NODE && S_EQ(node->exp.op, ","))
+    if (!preprocessor->argument_vectors)
     {
-        preprocessor_evaluate_function_call_argument(compiler, node->exp.left, arguments);
-        preprocessor_evaluate_function_call_argument(compiler, node->exp.right, arguments);
-        return;
+        preprocessor->argument_vectors = vector_create(sizeof(struct vector *));
     }
-    else if (node->type == PREPROCESSOR_EXPRESSION_NODE)
+
+    if (vector_empty(preprocessor->argument_vectors))
     {
-        preprocessor_evaluate_function_call_argument(compiler, node->parenthesis.exp, arguments);
-        return;
+        return vector_create(sizeof(struct preprocessor_function_argument));
     }
 
-    // Evaluate the node for this function argument and push it to the arguments vector
-    preprocessor_number_push_to_function_arguments(arguments, preprocessor_evaluate(compiler, node));
+    struct vector *arguments = *(struct vector **)vector_back(preprocessor->argument_vectors);
+    vector_pop(preprocessor->argument_vectors);
+    vector_clear(arguments);
+    return arguments;
 }
 
-void preprocessor_evaluate_function_call_arguments(struct compile_process *compiler, struct preprocessor_node *node, struct preprocessor_function_arguments *arguments)
+static void preprocessor_argument_vector_give_back(struct preprocessor *preprocessor, struct vector *arguments)
 {
-    preprocessor_evaluate_function_call_argument(compiler, node, arguments);
+    vector_push(preprocessor->argument_vectors, &arguments);
 }
 
-int preprocessor_evaluate_function_call(struct compile_process *compiler, struct preprocessor_node *node)
+static void preprocessor_function_argument_push_span(struct preprocessor_function_arguments *arguments, struct token *tokens, int total, struct preprocessor_expansion *expansion)
 {
-    const char *macro_func_name = node->exp.left->sval;
-    struct preprocessor_node *call_arguments = node->exp.right->parenthesis.exp;
-    struct preprocessor_function_arguments *arguments = preprocessor_function_arguments_create();
-
-    // Evaluate all the preprocessor arguments
-
-    preprocessor_evaluate_function_call_arguments(compiler, call_arguments, arguments);
-    return preprocessor_macro_function_execute(compiler, macro_func_name, arguments, PREPROCESSOR_FLAG_EVALUATE_MODE);
+    struct preprocessor_function_argument argument = {.tokens = tokens, .total = total, .expansion = expansion};
+    vector_push(arguments->arguments, &argument);
 }
 
-int preprocessor_evaluate_exp(struct compile_process *compiler, struct preprocessor_node *node)
+/**
+ * Reads the arguments of the macro call whose left bracket is tokens[0]. Each argument
+ * is a span of the tokens, nothing is copied. Returns how many tokens the call took,
+ * brackets included.
+ */
+static int preprocessor_read_call_arguments(struct compile_process *compiler, struct token *tokens, int total, struct preprocessor_expansion *expansion, struct preprocessor_function_arguments *arguments)
 {
-    if (preprocessor_exp_is_macro_function_call(node))
+    int depth = 0;
+    int start = 1;
+    for (int i = 1; i < total; i++)
     {
-        return preprocessor_evaluate_function_call(compiler, node);
-    }
-
-    long left_operand = preprocessor_evaluate(compiler, node->exp.left);
-    if (node->exp.right->type == PREPROCESSOR_TENARY_NODE)
-    {
-        // Okay we have a tenary this must be processed a little differently.
-        // In memory we have this: CONDITION ? TRUE_RESULT : FALSE RESULT
-        // THe condition value is stored in the left_operand we just calculated
-        // now we must calculate the true result or the false result, depending on the evaluation
-        // of the left operand
-        if (left_operand)
+        struct token *token = &tokens[i];
+        if (token_is_operator(token, "("))
         {
-            // A true result?
-            return preprocessor_evaluate(compiler, node->exp.right->tenary.true_node);
+            depth++;
         }
-        else
+        else if (token_is_symbol(token, ')') && depth > 0)
+        {
+            depth--;
+        }
+        else if (token_is_symbol(token, ')'))
+        {
+            preprocessor_function_argument_push_span(arguments, &tokens[start], i - start, expansion);
+            return i + 1;
+        }
+        else if (depth == 0 && token_is_operator(token, ","))
         {
-            // False result.
-            return preprocessor_evaluate(compiler, node->exp.right->tenary.false_node);
+            preprocessor_function_argument_push_span(arguments, &tokens[start], i - start, expansion);
+            start = i + 1;
         }
     }
 
-    long right_operand = preprocessor_evaluate(compiler, node->exp.right);
-    return preprocessor_arithmetic(compiler, left_operand, right_operand, node->exp.op);
+    compiler_error(compiler, "You did not end your parentheses expecting a )");
+    return total;
 }
 
-int preprocessor_evaluate_unary(struct compile_process *compiler, struct preprocessor_node *node)
+/**
+ * Writes the tokens of the argument as they were written in the call, for the operands
+ * of # and ## which are not expanded
+ */
+static void preprocessor_push_argument_unexpanded(struct preprocessor_function_argument *argument, struct vector *dst_vec)
 {
-    int res = 0;
-    const char *op = node->unary_node.op;
-    struct preprocessor_node *right_operand = node->unary_node.operand_node;
-    if (S_EQ(op, "!"))
-    {
-        res = !preprocessor_evaluate(compiler, right_operand);
-    }
-    else if (S_EQ(op, "~"))
+    for (int i = 0; i < argument->total; i++)
     {
-        res = ~preprocessor_evaluate(compiler, right_operand);
-    }
-    else if (S_EQ(op, "-"))
-    {
-        res - preprocessor_evaluate(compiler, right_operand);
-    }
-    else
-    {
-        compiler_error(compiler, "The given operator %s is not supported for unary evaluation in the preprocessor", op);
+        struct token *token = &argument->tokens[i];
+        // The call was itself in a macro body? Then its arguments are replaced first
+        struct preprocessor_function_argument *outer_argument = preprocessor_expansion_argument(argument->expansion, token);
+        if (outer_argument)
+        {
+            preprocessor_push_argument_unexpanded(outer_argument, dst_vec);
+            continue;
+        }
+        vector_push(dst_vec, token);
     }
 }
 
-int preprocessor_evaluate_parentheses(struct compile_process *compiler, struct preprocessor_node *node)
-{
-    return preprocessor_evaluate(compiler, node->parenthesis.exp);
-}
-
-const char *preprocessor_pull_string_from(struct preprocessor_node *root_node)
+static void preprocessor_expand_to_string(struct compile_process *compiler, struct token *token, struct preprocessor_expansion *expansion, struct vector *dst_vec)
 {
-    const char *result = NULL;
-    switch (root_node->type)
+    // Next token is the identifier that must become a string
+    struct preprocessor_function_argument *argument = token ? preprocessor_expansion_argument(expansion, token) : NULL;
+    if (!argument)
     {
-    case PREPROCESSOR_PARENTHESES_NODE:
-        result = preprocessor_pull_string_from(root_node->parenthesis.exp);
-        break;
-    case PREPROCESSOR_KEYWORD_NODE:
-    case PREPROCESSOR_IDENTIFIER_NODE:
-        result = root_node->sval;
-        break;
-
-    case PREPROCESSOR_EXPRESSION_NODE:
-        result = preprocessor_pull_string_from(root_node->exp.left);
-        break;
+        compiler_error(compiler, "No macro function argument was provided to convert to a string");
     }
 
-    return result;
+    struct token str_token = {};
+    str_token.type = TOKEN_TYPE_STRING;
+    str_token.sval = argument->total ? argument->tokens[0].sval : "";
+    vector_push(dst_vec, &str_token);
 }
-const char *preprocessor_pull_defined_value(struct compile_process *compiler, struct preprocessor_node *joined_node)
+
+/**
+ * Joins the tokens from index start of the output vector into the token they spell
+ */
+static void preprocessor_concat_join(struct compile_process *compiler, struct vector *dst_vec, int start)
 {
-    const char *val = preprocessor_pull_string_from(joined_node->joined.right);
-    if (!val)
+    int total = vector_count(dst_vec) - start;
+    if (total <= 1)
     {
-        compiler_error(compiler, "Expecting an identifier node for defined keyword right operand");
+        return;
     }
 
-    return val;
-}
+    // Pasting names and numbers onto a name is nearly every use of ##, the result is
+    // a name and does not have to be lexed again.
+    char name[256];
+    size_t length = 0;
+    struct token *tokens = vector_at(dst_vec, start);
+    bool is_name = tokens[0].type == TOKEN_TYPE_IDENTIFIER || tokens[0].type == TOKEN_TYPE_KEYWORD;
+    for (int i = 0; i < total && is_name; i++)
+    {
+        struct token *token = &tokens[i];
+        int written = 0;
+        if (token->type == TOKEN_TYPE_IDENTIFIER || token->type == TOKEN_TYPE_KEYWORD)
+        {
+            written = snprintf(name + length, sizeof(name) - length, "%s", token->sval);
+        }
+        else if (token->type == TOKEN_TYPE_NUMBER && token->llnum >= 0)
+        {
+            written = snprintf(name + length, sizeof(name) - length, "%lld", token->llnum);
+        }
+        else
+        {
+            is_name = false;
+        }
 
-int preprocessor_evaluate_joined_node_defined(struct compile_process *compiler, struct preprocessor_node *node)
-{
-    const char *right_val = preprocessor_pull_defined_value(compiler, node);
-    return preprocessor_get_definition(compiler_preprocessor(compiler), right_val) != NULL;
-}
+        length += written;
+        is_name &= length < sizeof(name);
+    }
 
-int preprocessor_evaluate_joined_node(struct compile_process *compiler, struct preprocessor_node *node)
-{
-    if (node->joined.left->type != PREPROCESSOR_KEYWORD_NODE)
+    if (is_name)
     {
-        return 0;
+        struct token joined = tokens[0];
+        int keyword = keyword_lookup(name, length);
+        joined.type = keyword_is_c_keyword(keyword) ? TOKEN_TYPE_KEYWORD : TOKEN_TYPE_IDENTIFIER;
+        joined.keyword = keyword;
+        joined.sval = atom_n(name, length);
+        while (vector_count(dst_vec) > start)
+        {
+            vector_pop(dst_vec);
+        }
+        vector_push(dst_vec, &joined);
+        return;
     }
 
-    int res = 0;
-    if (S_EQ(node->joined.left->sval, "defined"))
+    struct vector *joined_vec = tokens_join(compiler, tokens, total);
+    while (vector_count(dst_vec) > start)
     {
-        res = preprocessor_evaluate_joined_node_defined(compiler, node);
+        vector_pop(dst_vec);
     }
-
-    return res;
-}
-
-int preprocessor_evaluate(struct compile_process *compiler, struct preprocessor_node *root_node)
-{
-    struct preprocessor_node *current = root_node;
-    int result = 0;
-    switch (current->type)
+    for (int i = 0; i < vector_count(joined_vec); i++)
     {
-    case PREPROCESSOR_NUMBER_NODE:
-        result = preprocessor_evaluate_number(current);
-        break;
-
-    case PREPROCESSOR_IDENTIFIER_NODE:
-        result = preprocessor_evaluate_identifier(compiler, current);
-        break;
-
-    case PREPROCESSOR_UNARY_NODE:
-        result = preprocessor_evaluate_unary(compiler, current);
-        break;
-
-    case PREPROCESSOR_EXPRESSION_NODE:
-        result = preprocessor_evaluate_exp(compiler, current);
-        break;
-
-    case PREPROCESSOR_PARENTHESES_NODE:
-        result = preprocessor_evaluate_parentheses(compiler, current);
-        break;
-
-    case PREPROCESSOR_JOINED_NODE:
-        result = preprocessor_evaluate_joined_node(compiler, current);
-        break;
+        vector_push(dst_vec, vector_at(joined_vec, i));
     }
-    return result;
-}
-void preprocessor_handle_if_token(struct compile_process *compiler)
-{
-    int result = preprocessor_parse_evaluate(compiler, compiler->token_vec_original);
-    preprocessor_read_to_end_if(compiler, result > 0);
 }
 
-void preprocessor_handle_elif_token(struct compile_process *compiler, bool previous_if_result)
+static void preprocessor_expand_concat_operand(struct token *token, struct preprocessor_expansion *expansion, struct vector *dst_vec)
 {
-    // Have we not yet resolved an IF statement? Then this else if is still valid
-    // evaluate it.
-    if (!previous_if_result)
+    struct preprocessor_function_argument *argument = preprocessor_expansion_argument(expansion, token);
+    if (argument)
     {
-        int result = preprocessor_parse_evaluate(compiler, compiler->token_vec_original);
-        preprocessor_read_to_end_if(compiler, result > 0);
+        preprocessor_push_argument_unexpanded(argument, dst_vec);
         return;
     }
 
-    // Already a positive result? Then skip to endif
-    preprocessor_skip_to_endif(compiler);
+    vector_push(dst_vec, token);
 }
 
-void preprocessor_handle_identifier_macro_call_argument(struct preprocessor_function_arguments *arguments, struct vector *token_vec)
+static bool preprocessor_is_double_hash(struct token *tokens, int total, int index)
 {
-    preprocessor_function_argument_push(arguments, token_vec);
+    return index + 1 < total && token_is_symbol(&tokens[index], '#') && token_is_symbol(&tokens[index + 1], '#');
 }
 
-struct token *preprocessor_handle_identifier_macro_call_argument_parse_parentheses(struct compile_process *compiler, struct vector *src_vec, struct vector *value_vec, struct preprocessor_function_arguments *arguments, struct token *left_bracket_token)
+/**
+ * Pastes tokens[index] and the operands of the ## operators that follow it together,
+ * the result is written to the output. Returns the index of the last operand.
+ */
+static int preprocessor_expand_concat(struct compile_process *compiler, struct token *tokens, int total, int index, struct preprocessor_expansion *expansion, struct vector *dst_vec)
 {
-    // We must push the left bracket token to the value stack
-    vector_push(value_vec, left_bracket_token);
-    // Now we need to push everything to the value vector until we find ")"
-    struct token *next_token = vector_peek(src_vec);
-    while (next_token && !token_is_symbol(next_token, ')'))
+    int start = vector_count(dst_vec);
+    preprocessor_expand_concat_operand(&tokens[index], expansion, dst_vec);
+    while (preprocessor_is_double_hash(tokens, total, index + 1))
     {
-        if (token_is_operator(next_token, "("))
+        index += 3;
+        if (index >= total)
         {
-            next_token = preprocessor_handle_identifier_macro_call_argument_parse_parentheses(compiler, src_vec, value_vec, arguments, next_token);
+            compiler_error(compiler, "No right operand provided for concat preprocessor operator ##");
         }
-        vector_push(value_vec, next_token);
-        next_token = vector_peek(src_vec);
+        preprocessor_expand_concat_operand(&tokens[index], expansion, dst_vec);
     }
 
-    if (!next_token)
-    {
-        compiler_error(compiler, "You did not end your parentheses expecting a )");
-    }
-
-    // We must now push the right bracket token to the value vec
-    vector_push(value_vec, next_token);
-
-    // Let's now return the next token ready for next iteraton
-    return vector_peek(src_vec);
+    preprocessor_concat_join(compiler, dst_vec, start);
+    return index;
 }
-struct token *preprocessor_handle_identifier_macro_call_argument_parse(struct compile_process *compiler, struct vector *src_vec, struct vector *value_vec, struct preprocessor_function_arguments *arguments, struct token *token)
-{
 
-    if (token_is_operator(token, "("))
+/**
+ * Expands the call of a macro function, the call arguments are already read
+ */
+static void preprocessor_expand_macro_function(struct compile_process *compiler, struct preprocessor_definition *definition, struct preprocessor_function_arguments *arguments, struct preprocessor_expansion *parent, struct vector *dst_vec)
+{
+    if (definition->type == PREPROCESSOR_DEFINITION_NATIVE_CALLBACK)
     {
-        return preprocessor_handle_identifier_macro_call_argument_parse_parentheses(compiler, src_vec, value_vec, arguments, token);
+        // What a native definition expands to can depend on where it is called
+        compiler->preprocessor->expansion_cache.uncacheable = true;
+        preprocessor_token_vec_push_src_to_dst(compiler, definition->native.value(definition, arguments), dst_vec);
+        return;
     }
-    if (token_is_symbol(token, ')'))
+
+    // FOO() is a call with no arguments rather than one empty argument
+    if (vector_count(definition->standard.arguments) == 0 && preprocessor_function_arguments_count(arguments) == 1 &&
+        preprocessor_function_argument_at(arguments, 0)->total == 0)
     {
-        // We are done handle the call argument
-        preprocessor_handle_identifier_macro_call_argument(arguments, value_vec);
-        return NULL;
+        vector_clear(arguments->arguments);
     }
 
-    if (token_is_operator(token, ","))
+    if (vector_count(definition->standard.arguments) != preprocessor_function_arguments_count(arguments))
     {
-        preprocessor_handle_identifier_macro_call_argument(arguments, value_vec);
-        // Clear the value vector ready for the next argument
-        vector_clear(value_vec);
-        token = vector_peek(src_vec);
-        return token;
+        compiler_error(compiler, "The macro function %s expects %i arguments but %i were provided", definition->name,
+                       vector_count(definition->standard.arguments), preprocessor_function_arguments_count(arguments));
     }
 
-    // OK this token is important push it to the value vector
-    vector_push(value_vec, token);
-
-    token = vector_peek(src_vec);
-    return token;
+    struct preprocessor_expansion expansion = {.definition = definition, .arguments = arguments, .parent = parent};
+    struct vector *value = definition->standard.value;
+    preprocessor_expand_span(compiler, vector_count(value) ? vector_at(value, 0) : NULL, vector_count(value), &expansion, dst_vec);
 }
 
-static bool preprocessor_is_macro_function(struct preprocessor_definition *definition)
+/**
+ * Expands a call of the macro function written in the source, call holds the tokens of the
+ * call from its left bracket to its right bracket. The expansion is taken from the cache when
+ * the same call was expanded before, otherwise it is cached unless it reached something that
+ * depends on more than the definitions. Cached tokens keep the positions of the call that
+ * filled the entry.
+ */
+static void preprocessor_expand_macro_function_cached(struct compile_process *compiler, struct preprocessor_definition *definition, struct preprocessor_function_arguments *arguments, struct token *call, int total_call, struct vector *dst_vec)
 {
-    return definition->type == PREPROCESSOR_DEFINITION_MACRO_FUNCTION || definition->type == PREPROCESSOR_DEFINITION_NATIVE_CALLBACK;
-}
+    struct preprocessor *preprocessor = compiler->preprocessor;
+    struct preprocessor_expansion_cache *cache = &preprocessor->expansion_cache;
+    struct token *tokens = &call[1];
+    int total = total_call - 2;
+    uint64_t hash = preprocessor_expansion_cache_hash(definition, tokens, total);
 
-int preprocessor_macro_function_push_argument(struct compile_process *compiler, struct preprocessor_definition *definition, struct preprocessor_function_arguments *arguments, const char *arg_name, struct vector *definition_token_vec, struct vector *value_vec_target)
-{
-    // Let's check if we have a function argument in the definition
-    // if so this needs replacing
-    int argument_index = preprocessor_definition_argument_exists(definition, arg_name);
-    if (argument_index != -1)
+    struct preprocessor_expansion_cache_slot *slot = preprocessor_expansion_cache_lookup(preprocessor, hash);
+    struct preprocessor_expansion_cache_entry *entry = slot->entry;
+    if (entry && preprocessor_expansion_cache_entry_matches(entry, definition, tokens, total))
     {
-        // Ok we have an argument, we need to populate the output vector
-        // a little differently.
-        preprocessor_function_argument_push_to_vec(preprocessor_function_argument_at(arguments, argument_index), value_vec_target);
+        cache->hits++;
+        for (int i = 0; i < entry->total_expanded; i++)
+        {
+            vector_push(dst_vec, &entry->expanded[i]);
+        }
+        return;
     }
-    return argument_index;
+
+    cache->misses++;
+    bool seen = slot->hash != 0;
+    bool outer_uncacheable = cache->uncacheable;
+    cache->uncacheable = false;
+    int start = vector_count(dst_vec);
+    preprocessor_expand_macro_function(compiler, definition, arguments, NULL, dst_vec);
+    if (!cache->uncacheable)
+    {
+        // Calls in the arguments may have filled in or grown the table, the slot is found again
+        slot = preprocessor_expansion_cache_lookup(preprocessor, hash);
+        if (!slot->hash)
+        {
+            slot->hash = hash;
+            cache->count++;
+        }
+        else if (seen)
+        {
+            int total_expanded = vector_count(dst_vec) - start;
+            preprocessor_expansion_cache_store(slot, definition, tokens, total, total_expanded ? vector_at(dst_vec, start) : NULL, total_expanded);
+        }
+    }
+    cache->uncacheable |= outer_uncacheable;
 }
 
-bool preprocessor_is_next_double_hash(struct vector *definition_token_vec)
+/**
+ * Expands the identifier if it names a definition, next holds the tokens that follow it
+ * so a macro call can read its arguments. Returns how many of those tokens were used.
+ */
+static int preprocessor_expand_identifier(struct compile_process *compiler, struct token *token, struct token *next, int total_next, struct preprocessor_expansion *expansion, struct vector *dst_vec)
 {
-    bool is_double_hash = true;
-    vector_save(definition_token_vec);
-    struct token *next_token = vector_peek(definition_token_vec);
-    if (!token_is_symbol(next_token, '#'))
+    struct preprocessor *preprocessor = compiler->preprocessor;
+    struct preprocessor_definition *definition = preprocessor_get_definition(preprocessor, token->sval);
+    if (preprocessor->conditions.recording)
     {
-        is_double_hash = false;
-        goto out;
+        preprocessor_condition_depends_on(preprocessor, token->sval, definition);
     }
 
-    next_token = vector_peek(definition_token_vec);
-    if (!token_is_symbol(next_token, '#'))
+    if (!definition || preprocessor_expansion_is_active(expansion, definition))
     {
-        is_double_hash = false;
-        goto out;
+        // Not a definition, or one that is already being expanded and would never end
+        vector_push(dst_vec, token);
+        return 0;
     }
-out:
-    vector_restore(definition_token_vec);
-    return is_double_hash;
-}
 
-int preprocessor_macro_function_push_something_definition(struct compile_process *compiler, struct preprocessor_definition *definition, struct preprocessor_function_arguments *arguments, struct token *arg_token, struct vector *definition_token_vec, struct vector *value_vec_target)
-{
-    // What we going to do with this..
-    if (arg_token->type != TOKEN_TYPE_IDENTIFIER)
+    if (definition->type == PREPROCESSOR_DEFINITION_TYPEDEF)
     {
-        return -1;
+        preprocessor_token_vec_push_src_to_dst(compiler, preprocessor_definition_value(definition), dst_vec);
+        return 0;
     }
 
-    // Okay this may be a function argument.
-    const char *arg_name = arg_token->sval;
-    int res = preprocessor_macro_function_push_argument(compiler, definition, arguments, arg_name, definition_token_vec, value_vec_target);
-    if (res != -1)
+    if (!preprocessor_is_macro_function(definition))
     {
+        struct preprocessor_expansion object = {.definition = definition, .parent = expansion};
+        struct vector *value = definition->standard.value;
+        preprocessor_expand_span(compiler, vector_count(value) ? vector_at(value, 0) : NULL, vector_count(value), &object, dst_vec);
         return 0;
     }
 
-    // What no argument? Then do we have a definition
-    struct preprocessor_definition *arg_definition = preprocessor_get_definition(compiler->preprocessor, arg_name);
-    if (arg_definition)
+    if (total_next == 0 || !token_is_operator(next, "("))
     {
-        preprocessor_token_vec_push_src_resolve_definitions(compiler, preprocessor_definition_value(arg_definition), compiler->token_vec);
+        if (definition->type == PREPROCESSOR_DEFINITION_NATIVE_CALLBACK)
+        {
+            // Natives such as __LINE__ are written without brackets, they get no arguments
+            preprocessor_expand_macro_function(compiler, definition, NULL, expansion, dst_vec);
+            return 0;
+        }
+
+        // A macro function named without being called is just a name
+        vector_push(dst_vec, token);
         return 0;
     }
 
-    // Still nothing? Sad day
-    return -1;
-}
-void preprocessor_macro_function_push_something(struct compile_process *compiler, struct preprocessor_definition *definition, struct preprocessor_function_arguments *arguments, struct token *arg_token, struct vector *definition_token_vec, struct vector *value_vec_target)
-{
-    if (preprocessor_is_next_double_hash(definition_token_vec))
+    struct preprocessor_function_arguments arguments = {.arguments = preprocessor_argument_vector_take(preprocessor)};
+    int used = preprocessor_read_call_arguments(compiler, next, total_next, expansion, &arguments);
+    // Only a call written in the source expands the same way every time, one in a macro body
+    // depends on the arguments of the macro it is in and on the macros being expanded.
+    // A condition being evaluated must see every definition the call looks up, it is expanded.
+    if (!expansion && definition->type == PREPROCESSOR_DEFINITION_MACRO_FUNCTION && !preprocessor->conditions.recording &&
+        !(compiler->flags & COMPILE_PROCESS_NO_MACRO_CACHE))
     {
-        // Double hash? okay... Let's deal with concat
-        preprocessor_handle_concat(compiler, definition, arguments, arg_token, definition_token_vec, value_vec_target);
-        return;
+        preprocessor_expand_macro_function_cached(compiler, definition, &arguments, next, used, dst_vec);
     }
-    int res = preprocessor_macro_function_push_something_definition(compiler, definition, arguments, arg_token, definition_token_vec, value_vec_target);
-    if (res == -1)
+    else
     {
-        // Normal token? push it
-        vector_push(value_vec_target, arg_token);
+        preprocessor_expand_macro_function(compiler, definition, &arguments, expansion, dst_vec);
     }
+    preprocessor_argument_vector_give_back(preprocessor, arguments.arguments);
+    return used;
 }
 
-int preprocessor_macro_function_execute(struct compile_process *compiler, const char *function_name, struct preprocessor_function_arguments *arguments, int flags)
+/**
+ * The typedef reader works on a vector, a typedef inside a macro is rare enough to
+ * copy the rest of the tokens into one. Returns how many tokens the typedef took.
+ */
+static int preprocessor_expand_typedef(struct compile_process *compiler, struct token *tokens, int total)
 {
-    struct preprocessor *preprocessor = compiler_preprocessor(compiler);
-    struct preprocessor_definition *definition = preprocessor_get_definition(preprocessor, function_name);
-    if (!definition)
+    // The typedef is defined as it is expanded, an expansion that only pushed its tokens would lose it
+    compiler->preprocessor->expansion_cache.uncacheable = true;
+    struct vector *rest = vector_create(sizeof(struct token));
+    for (int i = 0; i < total; i++)
     {
-        FAIL_ERR("Definition was not found");
+        vector_push(rest, &tokens[i]);
     }
 
-    if (!preprocessor_is_macro_function(definition))
-    {
-        FAIL_ERR("This definition is not a macro function");
-    }
+    vector_set_peek_pointer(rest, 0);
+    preprocessor_handle_typedef_token(compiler, rest, true);
+    int used = rest->pindex;
+    vector_free(rest);
+    return used;
+}
 
-    if (vector_count(definition->standard.arguments) != preprocessor_function_arguments_count(arguments) && definition->type != PREPROCESSOR_DEFINITION_NATIVE_CALLBACK)
+/**
+ * Expands every definition in the span of tokens into the output vector. The tokens
+ * are the body of the expansion if it is given, its arguments replace their names.
+ */
+static void preprocessor_expand_span(struct compile_process *compiler, struct token *tokens, int total, struct preprocessor_expansion *expansion, struct vector *dst_vec)
+{
+    bool is_macro_function_body = expansion && expansion->arguments;
+    for (int i = 0; i < total; i++)
     {
-        FAIL_ERR("You passed too many arguments to this macro functon, expecting %i arguments");
-    }
+        struct token *token = &tokens[i];
+        if (is_macro_function_body && preprocessor_is_double_hash(tokens, total, i + 1))
+        {
+            i = preprocessor_expand_concat(compiler, tokens, total, i, expansion, dst_vec);
+            continue;
+        }
 
-    // Let's create a special vector for this value as its being injected with function arugments
-    struct vector *value_vec_target = vector_create(sizeof(struct token));
-    struct vector *definition_token_vec = preprocessor_definition_value_with_arguments(definition, arguments);
-    vector_set_peek_pointer(definition_token_vec, 0);
-    struct token *token = vector_peek(definition_token_vec);
-    while (token)
-    {
-        if (token_is_symbol(token, '#'))
+        if (is_macro_function_body && token_is_symbol(token, '#'))
         {
-            // We have argument to string
-            // Deal with it
-            preprocessor_handle_function_argument_to_string(compiler, definition_token_vec, value_vec_target, definition, arguments);
-            token = vector_peek(definition_token_vec);
+            i++;
+            preprocessor_expand_to_string(compiler, i < total ? &tokens[i] : NULL, expansion, dst_vec);
             continue;
         }
 
-        preprocessor_macro_function_push_something(compiler, definition, arguments, token, definition_token_vec, value_vec_target);
-        token = vector_peek(definition_token_vec);
-    }
+        struct preprocessor_function_argument *argument = preprocessor_expansion_argument(expansion, token);
+        if (argument)
+        {
+            // Arguments are expanded where they were written, before they are put in the body
+            preprocessor_expand_span(compiler, argument->tokens, argument->total, argument->expansion, dst_vec);
+            continue;
+        }
 
-    if (flags & PREPROCESSOR_FLAG_EVALUATE_MODE)
-    {
-        // Evaluation mode is active, therefore we want to evaluate
-        // and not push to any kind of stack
-        return preprocessor_parse_evaluate(compiler, value_vec_target);
-    }
+        if (preprocessor_token_is_typedef(token))
+        {
+            i += preprocessor_expand_typedef(compiler, &tokens[i + 1], total - i - 1);
+            continue;
+        }
 
-    // We have our target vector, lets inject it into the output vector.
-    preprocessor_token_vec_push_src(compiler, value_vec_target);
-    // vector_free(value_vec_target);
+        if (token->type == TOKEN_TYPE_IDENTIFIER)
+        {
+            i += preprocessor_expand_identifier(compiler, token, &tokens[i + 1], total - i - 1, expansion, dst_vec);
+            continue;
+        }
 
-    return 0;
+        vector_push(dst_vec, token);
+    }
 }
-struct preprocessor_function_arguments *preprocessor_handle_identifier_macro_call_arguments(struct compile_process *compiler, struct vector *src_vec)
-{
-    // Skip the left bracket
-    vector_peek(src_vec);
 
-    // We need room to store these arguments
-    struct preprocessor_function_arguments *arguments = preprocessor_function_arguments_create();
+void preprocessor_expand_tokens(struct compile_process *compiler, struct token *tokens, int total, struct vector *dst_vec)
+{
+    preprocessor_expand_span(compiler, tokens, total, NULL, dst_vec);
+}
 
-    // Ok lets loop through all the values to form a function call argument vector
-    struct token *token = vector_peek(src_vec);
-    struct vector *value_vec = vector_create(sizeof(struct token));
-    while (token)
+static int preprocessor_handle_definition_for_token_vector(struct compile_process *compiler, struct vector *src_vec, struct vector *dst_vec, struct token *token)
+{
+    // The rest of the source vector is read as a span, a macro call takes its arguments from it
+    int index = src_vec->pindex;
+    int total = vector_count(src_vec) - index;
+    struct token *next = total > 0 ? vector_at(src_vec, index) : NULL;
+    int used = preprocessor_expand_identifier(compiler, token, next, total, NULL, dst_vec);
+    if (used)
     {
-        token = preprocessor_handle_identifier_macro_call_argument_parse(compiler, src_vec, value_vec, arguments, token);
+        // A typedef in the definition may have read on through the source itself,
+        // the peek pointer only moves past the call arguments.
+        vector_set_peek_pointer(src_vec, index + used);
     }
-
-    // Free the now unused value vector
-    vector_free(value_vec);
-    return arguments;
+    return 0;
 }
 
 int preprocessor_handle_identifier_for_token_vector(struct compile_process *compiler, struct vector *src_vec, struct vector *dst_vec, struct token *token)
 {
-    // We have an identifier, it could represent a variable or a definition
-    // lets check if its a definition if so we have to handle it.
-
-    struct preprocessor_definition *definition = preprocessor_get_definition(compiler->preprocessor, token->sval);
+    struct preprocessor *preprocessor = compiler->preprocessor;
+    struct preprocessor_definition *definition = preprocessor_get_definition(preprocessor, token->sval);
     if (!definition)
     {
         // Not our token then it belongs on the destination token vector.
@@ -1925,30 +1742,22 @@ int preprocessor_handle_identifier_for_token_vector(struct compile_process *comp
         return -1;
     }
 
-    // This is a typedef definition? Then just push the entire thing.
-    if (definition->type == PREPROCESSOR_DEFINITION_TYPEDEF)
+    size_t allocations = vector_total_allocations();
+    int start = vector_count(dst_vec);
+    preprocessor->expansion_depth++;
+    int res = preprocessor_handle_definition_for_token_vector(compiler, src_vec, dst_vec, token);
+    preprocessor->expansion_depth--;
+    if (preprocessor->expansion_depth == 0)
     {
-        preprocessor_token_vec_push_src_to_dst(compiler, preprocessor_definition_value(definition), dst_vec);
-        return 0;
+        preprocessor->expansion_stats.expansions++;
+        preprocessor->expansion_stats.allocations += vector_total_allocations() - allocations;
     }
 
-    // We have a normal defintion, is this a function call macro
-    if (token_is_operator(vector_peek_no_increment(src_vec), "("))
+    for (int i = start; i < vector_count(dst_vec); i++)
     {
-        // Let's create a vector for these arguments
-        struct preprocessor_function_arguments *arguments = preprocessor_handle_identifier_macro_call_arguments(compiler, src_vec);
-        const char *function_name = token->sval;
-        // Let's execute the macro function
-        preprocessor_macro_function_execute(compiler, function_name, arguments, 0);
-        // preprocessor_function_arguments_free(arguments);
-        return 0;
+        ((struct token *)vector_at(dst_vec, i))->flags |= TOKEN_FLAG_FROM_EXPANSION;
     }
-
-    struct vector *definition_val = preprocessor_definition_value(definition);
-    // Before we can push the definition to the result vector, we must also preprocess it
-
-    preprocessor_token_vec_push_src_resolve_definitions(compiler, preprocessor_definition_value(definition), dst_vec);
-    return 0;
+    return res;
 }
 
 int preprocessor_handle_identifier(struct compile_process *compiler, struct token *token)
@@ -1958,47 +1767,43 @@ int preprocessor_handle_identifier(struct compile_process *compiler, struct toke
 
 int preprocessor_handle_hashtag_token(struct compile_process *compiler, struct token *token)
 {
-    bool is_preprocessed = false;
+    bool is_preprocessed = true;
     struct token *next_token = preprocessor_next_token(compiler);
-    if (preprocessor_token_is_define(next_token))
+    switch (preprocessor_token_keyword(next_token))
     {
+    case KEYWORD_DEFINE:
         preprocessor_handle_definition_token(compiler);
-        is_preprocessed = true;
-    }
-    else if (preprocessor_token_is_undef(next_token))
-    {
+        break;
+    case KEYWORD_UNDEF:
         preprocessor_handle_undef_token(compiler);
-        is_preprocessed = true;
-    }
-    else if (preprocessor_token_is_warning(next_token))
-    {
+        break;
+    case KEYWORD_WARNING:
         preprocessor_handle_warning_token(compiler);
-        is_preprocessed = true;
-    }
-    else if (preprocessor_token_is_error(next_token))
-    {
+        break;
+    case KEYWORD_ERROR:
         preprocessor_handle_error_token(compiler);
-        is_preprocessed = true;
-    }
-    else if (preprocessor_token_is_ifdef(next_token))
-    {
+        break;
+    case KEYWORD_IFDEF:
         preprocessor_handle_ifdef_token(compiler);
-        is_preprocessed = true;
-    }
-    else if (preprocessor_token_is_ifndef(next_token))
-    {
+        break;
+    case KEYWORD_IFNDEF:
         preprocessor_handle_ifndef_token(compiler);
-        is_preprocessed = true;
-    }
-    else if (preprocessor_token_is_if(next_token))
-    {
-        preprocessor_handle_if_token(compiler);
-        is_preprocessed = true;
-    }
-    else if (preprocessor_token_is_include(next_token))
-    {
+        break;
+    case KEYWORD_IF:
+        preprocessor_handle_if_token(compiler, next_token);
+        break;
+    case KEYWORD_INCLUDE:
         preprocessor_handle_include_token(compiler);
-        is_preprocessed = true;
+        break;
+    case KEYWORD_PRAGMA:
+        preprocessor_handle_pragma_token(compiler);
+        break;
+    case KEYWORD_LINE:
+        preprocessor_handle_line_token(compiler);
+        break;
+    default:
+        is_preprocessed = false;
+        break;
     }
 
     return is_preprocessed;
@@ -2062,8 +1867,9 @@ void preprocessor_handle_token(struct compile_process *compiler, struct token *t
 void preprocessor_initialize(struct vector *token_vec, struct preprocessor *preprocessor)
 {
     memset(preprocessor, 0, sizeof(struct preprocessor));
-    preprocessor->definitions = vector_create(sizeof(struct preprocessor_definition *));
-    preprocessor->includes = vector_create(sizeof(struct preprocessor_included_file *));
+    preprocessor->definitions = hashmap_create(HASHMAP_DEFAULT_SIZE);
+    preprocessor->includes = hashmap_create(HASHMAP_DEFAULT_SIZE);
+    preprocessor->include_order = vector_create(sizeof(struct preprocessor_included_file *));
     preprocessor_create_definitions(preprocessor);
 }
 
@@ -2076,19 +1882,226 @@ struct preprocessor *preprocessor_create(struct compile_process *compiler)
     return preprocessor;
 }
 
+/**
+ * Returns the next token at or after *index that is not a new line or a comment, NULL if there is none.
+ * *index is left pointing at the returned token
+ */
+static struct token *preprocessor_guard_token(struct vector *token_vec, int *index)
+{
+    while (*index < vector_count(token_vec))
+    {
+        struct token *token = vector_at(token_vec, *index);
+        if (token->type != TOKEN_TYPE_NEWLINE && token->type != TOKEN_TYPE_COMMENT)
+        {
+            return token;
+        }
+        *index += 1;
+    }
+
+    return NULL;
+}
+
+/**
+ * Returns the directive name token if a hashtag starts at *index, *index is moved past the directive name.
+ */
+static struct token *preprocessor_guard_directive(struct vector *token_vec, int *index)
+{
+    struct token *token = preprocessor_guard_token(token_vec, index);
+    if (!token || !token_is_symbol(token, '#'))
+    {
+        return NULL;
+    }
+
+    *index += 1;
+    struct token *directive = preprocessor_guard_token(token_vec, index);
+    if (!directive || (directive->type != TOKEN_TYPE_IDENTIFIER && directive->type != TOKEN_TYPE_KEYWORD))
+    {
+        return NULL;
+    }
+    *index += 1;
+    return directive;
+}
+
+/**
+ * Looks for an include guard wrapping the whole file. The file must start with #ifndef X followed
+ * by #define X and end with the #endif that closes the #ifndef, nothing may come after it.
+ * Returns the macro name or NULL if the file is not guarded like this.
+ */
+const char *preprocessor_include_guard(struct vector *token_vec)
+{
+    int index = 0;
+    struct token *directive = preprocessor_guard_directive(token_vec, &index);
+    if (!directive || directive->keyword != KEYWORD_IFNDEF)
+    {
+        return NULL;
+    }
+
+    struct token *guard = preprocessor_guard_token(token_vec, &index);
+    if (!guard || guard->type != TOKEN_TYPE_IDENTIFIER)
+    {
+        return NULL;
+    }
+    index++;
+
+    directive = preprocessor_guard_directive(token_vec, &index);
+    struct token *name = directive ? preprocessor_guard_token(token_vec, &index) : NULL;
+    if (!directive || directive->keyword != KEYWORD_DEFINE || !name || !token_is_identifier(name, guard->sval))
+    {
+        return NULL;
+    }
+
+    // Find the #endif that closes our #ifndef, an #else or #elif means the file has content outside of the guard
+    int depth = 1;
+    while (depth > 0 && preprocessor_guard_token(token_vec, &index))
+    {
+        directive = preprocessor_guard_directive(token_vec, &index);
+        if (!directive)
+        {
+            index++;
+            continue;
+        }
+
+        switch (directive->keyword)
+        {
+        case KEYWORD_IF:
+        case KEYWORD_IFDEF:
+        case KEYWORD_IFNDEF:
+            depth++;
+            break;
+        case KEYWORD_ENDIF:
+            depth--;
+            break;
+        case KEYWORD_ELSE:
+        case KEYWORD_ELIF:
+            if (depth == 1)
+            {
+                return NULL;
+            }
+            break;
+        }
+    }
+
+    if (depth != 0 || preprocessor_guard_token(token_vec, &index))
+    {
+        return NULL;
+    }
+
+    return guard->sval;
+}
+
+/**
+ * Returns true for tokens only the preprocessor cares about, new lines, comments
+ * and the line continuation symbol.
+ */
+bool preprocessor_token_is_trivia(struct token *token)
+{
+    return token->type == TOKEN_TYPE_NEWLINE ||
+           token->type == TOKEN_TYPE_COMMENT ||
+           token_is_symbol(token, '\\');
+}
+
+/**
+ * Removes the trivia from the preprocessed token vector in place,
+ * so the parser never has to step over it.
+ */
+static void preprocessor_remove_trivia(struct vector *token_vec)
+{
+    int total = vector_count(token_vec);
+    int kept = 0;
+    for (int i = 0; i < total; i++)
+    {
+        struct token *token = vector_at(token_vec, i);
+        if (preprocessor_token_is_trivia(token))
+        {
+            continue;
+        }
+
+        if (kept != i)
+        {
+            memcpy(vector_at(token_vec, kept), token, sizeof(struct token));
+        }
+        kept++;
+    }
+
+    while (vector_count(token_vec) > kept)
+    {
+        vector_pop(token_vec);
+    }
+}
+
+/**
+ * Drops the tokens of the file that have been preprocessed, so a file that is only preprocessed
+ * is never all in memory. The last token read stays, it is looked back at. A file that starts
+ * with #ifndef is kept whole as the include guard it may have is looked for at the end.
+ */
+static void preprocessor_trim_original(struct compile_process *compiler)
+{
+    struct vector *token_vec = compiler->token_vec_original;
+    int used = token_vec->pindex - 1;
+    // Once more has been used than is left, so each token is moved a bounded number of times
+    if (used <= vector_count(token_vec) - token_vec->pindex || (token_vec->saves && !vector_empty(token_vec->saves)))
+    {
+        return;
+    }
+
+    if (!compiler->token_vec_original_trimmed)
+    {
+        int index = 0;
+        if (!preprocessor_guard_token(token_vec, &index))
+        {
+            return;
+        }
+
+        struct token *directive = preprocessor_guard_directive(token_vec, &index);
+        if (directive && directive->keyword == KEYWORD_IFNDEF)
+        {
+            return;
+        }
+    }
+
+    vector_pop_front(token_vec, used);
+    compiler->token_vec_original_trimmed = true;
+}
+
+/**
+ * Handles a token read from the file, when only preprocessing what it produced is written out right away
+ */
+static void preprocessor_handle_source_token(struct compile_process *compiler, struct token *token)
+{
+    // The token moves if more of the file is lexed
+    struct pos pos = token->pos;
+    preprocessor_handle_token(compiler, token);
+    if (compiler->preprocessor->output.fp)
+    {
+        preprocessor_output_write(compiler, pos);
+        preprocessor_trim_original(compiler);
+    }
+}
+
 int preprocessor_run(struct compile_process *compiler)
 {
     preprocessor_add_included_file(compiler->preprocessor, compiler->cfile.abs_path);
+    preprocessor_output_file_changed(compiler->preprocessor);
 
     vector_set_peek_pointer(compiler->token_vec_original, 0);
     struct token *token = preprocessor_next_token(compiler);
     while (token)
     {
-        preprocessor_handle_token(compiler, token);
+        preprocessor_handle_source_token(compiler, token);
         token = preprocessor_next_token(compiler);
     }
 
-    // We are done? great we dont need the original token vector anymore, lets swap it out
-    // for our one
+    // A file lexed on demand is only all there once it has been preprocessed. The groups
+    // skipped without being lexed had their #if and #endif balanced, the guard is found the same.
+    struct preprocessor_included_file *included_file = preprocessor_get_included_file(compiler->preprocessor, compiler->cfile.abs_path);
+    included_file->guard = compiler->token_vec_original_trimmed ? NULL : preprocessor_include_guard(compiler->token_vec_original);
+    // What follows is written in the file that included this one
+    preprocessor_output_file_changed(compiler->preprocessor);
+
+    // We are done? great we dont need the original token vector anymore,
+    // only the trivia free output is kept for the parser.
+    preprocessor_remove_trivia(compiler->token_vec);
+    vector_free(compiler->token_vec_original);
+    compiler->token_vec_original = NULL;
     return 0;
 }
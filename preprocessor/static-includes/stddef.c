@@ -22,16 +22,15 @@ int preprocessor_stddef_includeof_get_offsetof_type(struct token *token)
 int preprocessor_stddef_include_offsetof_pull_struct_or_union(struct compile_process *compiler, struct preprocessor_function_argument *argument, const char **name_out)
 {
     int type = -1;
-    vector_set_peek_pointer(argument->tokens, 0);
-    if (vector_count(argument->tokens) != 2)
+    if (argument->total != 2)
     {
         compiler_error(compiler, "Expecting either \"struct name\" or \"union name\"");
     }
 
-    struct token *arg_type = vector_peek(argument->tokens);
+    struct token *arg_type = &argument->tokens[0];
     type = preprocessor_stddef_includeof_get_offsetof_type(arg_type);
 
-    struct token *arg_name = vector_peek(argument->tokens);
+    struct token *arg_name = &argument->tokens[1];
     if (arg_name->type != TOKEN_TYPE_IDENTIFIER)
     {
         compiler_error(compiler, "Expecting the offsetof structure/union to have a name, but something else was provided");
@@ -43,9 +42,8 @@ int preprocessor_stddef_include_offsetof_pull_struct_or_union(struct compile_pro
 
 int preprocessor_stddef_include_offsetof_pull_member_name(struct compile_process *compiler, struct preprocessor_function_argument *argument, const char **member_name_out)
 {
-    vector_set_peek_pointer(argument->tokens, 0);
-    struct token *token = vector_peek(argument->tokens);
-    if (token->type != TOKEN_TYPE_IDENTIFIER)
+    struct token *token = argument->total ? &argument->tokens[0] : NULL;
+    if (!token || token->type != TOKEN_TYPE_IDENTIFIER)
     {
         compiler_error(compiler, "Expecting an identifier for the offsetof member to search for");
     }
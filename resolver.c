@@ -346,7 +346,7 @@ struct resolver_entity *resolver_create_new_entity_for_var_node_custom_scope(str
     entity->dtype = var_node->var.type;
     entity->var_data.dtype = var_node->var.type;
     entity->node = var_node;
-    entity->name = var_node->var.name;
+    entity->name = atom(var_node->var.name);
     entity->offset = offset;
     return entity;
 }
@@ -429,7 +429,7 @@ struct resolver_entity *resolver_register_function(struct resolver_process *proc
     if (!entity)
         return NULL;
 
-    entity->name = func_node->func.name;
+    entity->name = atom(func_node->func.name);
     entity->node = func_node;
     entity->dtype = func_node->func.rtype;
     entity->scope = resolver_process_scope_current(process);
@@ -464,7 +464,8 @@ struct resolver_entity *resolver_get_entity_in_scope_with_entity_type(struct res
     }
 
     // Ok this is not a structure variable, lets search the scopes
-    // until we can identify this entity
+    // until we can identify this entity, entity names are atoms.
+    entity_name = atom(entity_name);
     vector_set_peek_pointer_end(scope->entities);
     vector_set_flag(scope->entities, VECTOR_FLAG_PEEK_DECREMENT);
     struct resolver_entity *current = vector_peek_ptr(scope->entities);
@@ -477,7 +478,7 @@ struct resolver_entity *resolver_get_entity_in_scope_with_entity_type(struct res
             continue;
         }
 
-        if (S_EQ(current->name, entity_name))
+        if (current->name && current->name == entity_name)
         {
             break;
         }
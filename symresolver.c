@@ -40,13 +40,15 @@ void symresolver_end_table(struct compile_process* compiler)
 
 struct symbol* symresolver_get_symbol(struct compile_process* process, const char* name)
 {    
+    // Symbol names are atoms so once the name is interned a pointer compare is enough.
+    name = atom(name);
     vector_set_peek_pointer(process->symbols.table, 0);
 
     struct symbol* symbol = vector_peek_ptr(process->symbols.table);
     while(symbol)
     {
 
-        if (S_EQ(symbol->name, name))
+        if (symbol->name && symbol->name == name)
         {
             break;
         }
@@ -79,7 +81,7 @@ struct symbol* symresolver_register_symbol(struct compile_process* process, cons
     }
     
     struct symbol* sym = calloc(sizeof(struct symbol), 1);
-    sym->name = sym_name;
+    sym->name = atom(sym_name);
     sym->type = type;
     sym->data = data;
     symresolver_push_symbol(process, sym);
@@ -0,0 +1,39 @@
+#/usr/bin/bash
+
+# Differential test for the internal assembler
+# Every unit is compiled once, the assembly is then assembled by the internal
+# assembler and by NASM. The disassembly, relocations and data of both object files must match.
+mkdir -p ./build/asm_diff
+res_code=0
+
+for unit in ./units/*.c; do
+    name=$(basename $unit .c)
+    output=./build/asm_diff/$name
+    ../main $unit $output object > /dev/null
+    if [ $? -ne 0 ]; then
+        echo -e "$name failed to compile"
+        res_code=1
+        continue
+    fi
+
+    nasm -f elf32 $output -o $output.nasm.o
+    if [ $? -ne 0 ]; then
+        echo -e "$name failed to assemble with NASM"
+        res_code=1
+        continue
+    fi
+
+    # Skip the objdump header as it contains the file name
+    objdump -d -r -M intel -s -j .text -j .data -j .rodata $output.o | tail -n +3 > $output.internal.txt
+    objdump -d -r -M intel -s -j .text -j .data -j .rodata $output.nasm.o | tail -n +3 > $output.nasm.txt
+    diff $output.nasm.txt $output.internal.txt > $output.diff
+    if [ $? -ne 0 ]; then
+        echo -e "$name differs from NASM, see $output.diff"
+        res_code=1
+    else
+        echo -e "$name matches NASM"
+    fi
+done
+
+echo -e "Assembler differential test finished"
+exit $res_code
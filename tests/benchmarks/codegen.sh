@@ -0,0 +1,29 @@
+#/usr/bin/bash
+
+# Code generation benchmark
+# Generates a file with many functions full of arithmetic and prints the codegen phase from the time report.
+total=${1:-2000}
+mkdir -p ./build/benchmarks
+output=./build/benchmarks/codegen.c
+
+{
+    for ((i = 0; i < total; i++)); do
+        echo "int function_$i(int a, int b)"
+        echo "{"
+        echo "    int x;"
+        echo "    x = a * 50 + b / 20 - $i;"
+        echo "    if (x > 100)"
+        echo "    {"
+        echo "        x = x - a * b;"
+        echo "    }"
+        echo "    return x + a + b + $i;"
+        echo "}"
+    done
+
+    echo "int main()"
+    echo "{"
+    echo "    return function_0(1, 2);"
+    echo "}"
+} > $output
+
+../../main $output ./build/benchmarks/codegen object --time-report 2>&1 >/dev/null | grep -E "^(phase|codegen|total)"
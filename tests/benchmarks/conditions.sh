@@ -0,0 +1,37 @@
+#/usr/bin/bash
+
+# Conditional compilation benchmark
+# Generates a file with many #if and #elif conditions that use defined, macro calls and most
+# operators. Half of them change with the definitions made between them, the other half are
+# written the same every time and depend on definitions that never change. Prints the preprocess
+# phase and the conditions line from the time report.
+total=${1:-5000}
+mkdir -p ./build/benchmarks
+output=./build/benchmarks/conditions.c
+
+{
+    echo "#define LIMIT 100"
+    echo "#define SCALE(x) ((x) * 3)"
+    echo "#define SUM3(a, b, c) ((a) + (b) + (c))"
+
+    for ((i = 0; i < total; i++)); do
+        echo "#define FEATURE_$i $((i % 5))"
+        echo "#if defined(FEATURE_$i) && FEATURE_$i > 2 || (LIMIT * 3 + 1) >> 1 == 5"
+        echo "int condition_a_$i = 1;"
+        echo "#elif SUM3(FEATURE_$i, 1, 2) >= 4 && !defined(MISSING)"
+        echo "int condition_a_$i = 2;"
+        echo "#else"
+        echo "int condition_a_$i = 3;"
+        echo "#endif"
+        echo "#if defined(MISSING) || (defined LIMIT && LIMIT >= 100 && (SCALE(LIMIT) ^ 7) != 0)"
+        echo "int condition_b_$i = 1;"
+        echo "#endif"
+    done
+
+    echo "int main()"
+    echo "{"
+    echo "    return 0;"
+    echo "}"
+} > $output
+
+../../main $output ./build/benchmarks/conditions object --time-report 2>&1 >/dev/null | grep -E "^(preprocess|conditions)"
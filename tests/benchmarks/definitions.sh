@@ -0,0 +1,35 @@
+#/usr/bin/bash
+
+# Preprocessor definition table benchmark
+# Generates a file with 50000 macros, every macro is used, every tenth macro is redefined
+# and every hundredth is undefined. Prints the preprocess phase from the time report.
+total=${1:-50000}
+mkdir -p ./build/benchmarks
+output=./build/benchmarks/definitions.c
+
+{
+    for ((i = 0; i < total; i++)); do
+        echo "#define MACRO_$i $i"
+    done
+
+    for ((i = 0; i < total; i += 10)); do
+        echo "#define MACRO_$i 1"
+    done
+
+    for ((i = 0; i < total; i += 100)); do
+        echo "#undef MACRO_$i"
+        echo "#define MACRO_$i 2"
+    done
+
+    echo "int main()"
+    echo "{"
+    echo "    int x;"
+    echo "    x = 0;"
+    for ((i = 0; i < total; i += 7)); do
+        echo "    x = MACRO_$i;"
+    done
+    echo "    return x;"
+    echo "}"
+} > $output
+
+../../main $output ./build/benchmarks/definitions object --time-report 2>&1 >/dev/null | grep -E "^(phase|lex|preprocess|total)"
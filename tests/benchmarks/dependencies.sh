@@ -0,0 +1,51 @@
+#/usr/bin/bash
+
+# Dependency scan benchmark
+# Generates source files that include stdio.h and headers of their own, with macros and
+# declarations in the headers and functions in the sources. Prints the wall time of
+# compiling them all, of scanning their dependencies and of scanning only the directives.
+total=${1:-20}
+functions=${2:-200}
+mkdir -p ./build/benchmarks/dependencies
+dir=$(pwd)/build/benchmarks/dependencies
+
+for ((h = 0; h < 5; h++)); do
+    {
+        echo "#ifndef DEPENDENCIES_HEADER_$h"
+        echo "#define DEPENDENCIES_HEADER_$h"
+        echo "#include \"$dir/header_$(((h + 1) % 5)).h\""
+        for ((i = 0; i < functions; i++)); do
+            echo "#define HEADER_${h}_SCALE_$i(x) ((x) * $i + $h)"
+            echo "int header_${h}_function_$i(int a, int b);"
+        done
+        echo "#endif"
+    } > $dir/header_$h.h
+done
+
+inputs=""
+for ((f = 0; f < total; f++)); do
+    {
+        echo "#include <stdio.h>"
+        echo "#include \"$dir/header_$((f % 5)).h\""
+        for ((i = 0; i < functions; i++)); do
+            echo "int source_${f}_function_$i(int a, int b)"
+            echo "{"
+            echo "    int c = HEADER_$((f % 5))_SCALE_$i(a) + b;"
+            echo "    return c * 2 + a;"
+            echo "}"
+        done
+    } > $dir/source_$f.c
+    inputs="$inputs $dir/source_$f.c"
+done
+
+# Run from the repository root so <stdio.h> is found in ./dc_includes
+TIMEFORMAT="%R seconds"
+cd ../..
+echo "compile"
+time ./main -c $inputs > /dev/null
+rm -f source_*.o source_*.asm
+echo "dependencies"
+time ./main -M -MF $dir/all.d $inputs
+echo "dependencies, directives only"
+time ./main -M --directives-only -MF $dir/all_directives.d $inputs
+cmp -s $dir/all.d $dir/all_directives.d || echo "the rules differ"
@@ -0,0 +1,41 @@
+#/usr/bin/bash
+
+# Inactive #if group benchmark
+# Generates a file where most of the lines are in #if groups that are not compiled, platform
+# branches for platforms other than ours and #if 0 blocks. Prints the lex and preprocess phases
+# and the inactive groups line from the time report, with the groups skipped without being
+# lexed and with every file lexed in one go.
+total=${1:-2000}
+mkdir -p ./build/benchmarks
+output=./build/benchmarks/inactive.c
+
+{
+    echo "#define PLATFORM_LINUX 1"
+
+    for ((i = 0; i < total; i++)); do
+        echo "#if defined(PLATFORM_WINDOWS)"
+        echo "int platform_call_$i(int handle, int flags) { return handle * flags + $i; }"
+        echo "int platform_close_$i(int handle) { return handle - $i; }"
+        echo "#elif defined(PLATFORM_MAC)"
+        echo "int platform_call_$i(int port, int flags) { return port | flags | $i; }"
+        echo "int platform_close_$i(int port) { return port + $i; }"
+        echo "#else"
+        echo "int platform_call_$i(int fd, int flags) { return fd + flags + $i; }"
+        echo "#endif"
+        echo "#if 0"
+        echo "/* Kept for reference, the old implementation */"
+        echo "int legacy_$i(int a, int b, int c) { return (a * b) / (c + 1) + $i; }"
+        echo "int legacy_helper_$i(int a) { return legacy_$i(a, a, a); }"
+        echo "#endif"
+    done
+
+    echo "int main()"
+    echo "{"
+    echo "    return 0;"
+    echo "}"
+} > $output
+
+for flags in "" "--no-skip-inactive"; do
+    echo "inactive ${flags:-skipped}"
+    ../../main $output ./build/benchmarks/inactive object --time-report $flags 2>&1 >/dev/null | grep -E "^(lex|preprocess|inactive)"
+done
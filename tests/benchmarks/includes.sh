@@ -0,0 +1,27 @@
+#/usr/bin/bash
+
+# Multiple include benchmark
+# Generates a file that includes stdio.h and a #pragma once header many times.
+# Prints the lex and preprocess phases from the time report.
+total=${1:-2000}
+mkdir -p ./build/benchmarks
+output=./build/benchmarks/includes.c
+
+echo "#pragma once" > ./build/benchmarks/includes_once.h
+echo "int includes_once(int x);" >> ./build/benchmarks/includes_once.h
+
+{
+    for ((i = 0; i < total; i++)); do
+        echo "#include <stdio.h>"
+        echo "#include \"$(pwd)/build/benchmarks/includes_once.h\""
+    done
+
+    echo "int main()"
+    echo "{"
+    echo "    return 0;"
+    echo "}"
+} > $output
+
+# Run from the repository root so <stdio.h> is found in ./dc_includes
+dir=$(pwd)
+cd ../.. && ./main $dir/$output $dir/build/benchmarks/includes object --time-report 2>&1 >/dev/null | grep -E "^(phase|lex|preprocess|total|include cache)"
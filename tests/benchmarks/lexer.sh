@@ -0,0 +1,36 @@
+#/usr/bin/bash
+
+# Lexer throughput benchmark
+# Generates a large file of indented code with long identifiers, block comments and
+# string literals, then lexes it with the SIMD scanners and with --no-simd.
+# Prints the lex phase from the time report and the throughput in MB/s.
+total=${1:-4000}
+mkdir -p ./build/benchmarks
+output=./build/benchmarks/lexer.c
+
+{
+    for ((i = 0; i < total; i++)); do
+        echo "/*"
+        echo " * lexer_benchmark_function_$i returns the sum of its two arguments, this comment"
+        echo " * is here so the lexer has a long block comment to skip over for every function."
+        echo " */"
+        echo "int lexer_benchmark_function_$i(int lexer_benchmark_argument_one, int lexer_benchmark_argument_two)"
+        echo "{"
+        echo "                const char* lexer_benchmark_message = \"lexer benchmark message for function number $i\";"
+        echo "                // Add the two arguments together and return the result to the caller"
+        echo "                return lexer_benchmark_argument_one + lexer_benchmark_argument_two;"
+        echo "}"
+    done
+
+    echo "int main()"
+    echo "{"
+    echo "    return 0;"
+    echo "}"
+} > $output
+
+size=$(wc -c < $output)
+for flags in "" "--no-simd"; do
+    echo "lexer ${flags:-simd}"
+    ../../main $output ./build/benchmarks/lexer object --time-report $flags 2>&1 >/dev/null | grep -E "^lex " |
+        awk -v size=$size '{ printf "%s %.1f MB/s\n", $0, size / ($2 / 1000) / 1000000 }'
+done
@@ -0,0 +1,44 @@
+#/usr/bin/bash
+
+# Macro expansion benchmark
+# Generates a file that calls function like macros many times, with plain arguments, with
+# arguments that are macros themselves and with the same arguments on every line. Prints the
+# preprocess phase and the macro expansion lines from the time report, with the expansion
+# cache and without it.
+total=${1:-5000}
+mkdir -p ./build/benchmarks
+output=./build/benchmarks/macros.c
+
+{
+    echo "#define LIMIT 100"
+    echo "#define SCALE(x) ((x) * 3)"
+    echo "#define SUM3(a, b, c) ((a) + (b) + (c))"
+    echo "#define NAME(a, b) a ## b"
+    echo "#define NESTED(a, b) SUM3(SCALE(a), SCALE(b), LIMIT)"
+
+    for ((i = 0; i < total; i++)); do
+        echo "int NAME(macro_plain_, $i) = SUM3($i, $i, 2) + SCALE($i);"
+    done
+
+    if [ "$2" != "plain" ]; then
+        for ((i = 0; i < total; i++)); do
+            echo "int NAME(macro_nested_, $i) = NESTED(SCALE($i), SUM3(1, LIMIT, $i));"
+        done
+    fi
+
+    if [ "$2" != "plain" ]; then
+        for ((i = 0; i < total; i++)); do
+            echo "int macro_repeated_$i = NESTED(4, 5) + SUM3(1, 2, LIMIT) + SCALE(7);"
+        done
+    fi
+
+    echo "int main()"
+    echo "{"
+    echo "    return SUM3(1, 2, 3);"
+    echo "}"
+} > $output
+
+for flags in "" "--no-macro-cache"; do
+    echo "macros ${flags:-cached}"
+    ../../main $output ./build/benchmarks/macros object --time-report $flags 2>&1 >/dev/null | grep -E "^(preprocess|macro)"
+done
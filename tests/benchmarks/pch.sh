@@ -0,0 +1,39 @@
+#/usr/bin/bash
+
+# Precompiled header benchmark
+# Generates a guarded header full of definitions, macro functions, typedefs and
+# prototypes and a file that includes it. The file is compiled once normally and once
+# from a precompiled header of the header.
+# Prints the lex and preprocess phases from the time report.
+total=${1:-2000}
+mkdir -p ./build/benchmarks
+header=./build/benchmarks/pch.h
+output=./build/benchmarks/pch.c
+
+{
+    echo "#ifndef PCH_BENCHMARK_H"
+    echo "#define PCH_BENCHMARK_H"
+    echo "#include <stdio.h>"
+    for ((i = 0; i < total; i++)); do
+        echo "#define PCH_VALUE_$i ($i * 2 + 1)"
+        echo "#define PCH_ADD_$i(a, b) ((a) + (b) + $i)"
+        echo "typedef int pch_int_$i;"
+        echo "int pch_function_$i(pch_int_$i a, int b);"
+    done
+    echo "#endif"
+} > $header
+
+echo "#include \"$(pwd)/$header\"" > $output
+echo "int main()" >> $output
+echo "{" >> $output
+echo "    return PCH_ADD_7(3, 1) + PCH_VALUE_3;" >> $output
+echo "}" >> $output
+
+# Run from the repository root so <stdio.h> is found in ./dc_includes
+dir=$(pwd)
+cd ../..
+./main --emit-pch $dir/$header $dir/build/benchmarks/pch.pch
+echo "without pch"
+./main $dir/$output $dir/build/benchmarks/pch object --time-report 2>&1 >/dev/null | grep -E "^(lex|preprocess|total)"
+echo "with pch"
+./main $dir/$output $dir/build/benchmarks/pch object --time-report --include-pch=$dir/build/benchmarks/pch.pch 2>&1 >/dev/null | grep -E "^(lex|preprocess|total)"
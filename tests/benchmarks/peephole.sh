@@ -0,0 +1,13 @@
+#/usr/bin/bash
+
+# Peephole benchmark
+# Compiles every program in test_programs and prints how many instructions the peephole rules removed.
+mkdir -p ./build/benchmarks
+dir=$(pwd)
+
+# Run from the repository root so <stdio.h> is found in ./dc_includes
+cd ../..
+for file in ./test_programs/*.c; do
+    echo "$file"
+    ./main $file $dir/build/benchmarks/peephole object --time-report 2>&1 >/dev/null | grep -A 7 "^peephole rule"
+done
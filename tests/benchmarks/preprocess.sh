@@ -0,0 +1,60 @@
+#/usr/bin/bash
+
+# Preprocess only benchmark
+# Generates a source file with macros, typedefs and functions and one four times its size.
+# Prints the wall time and the peak memory of writing the preprocessed output of each with -E,
+# the peak memory should grow only with the names and strings that are new in the larger file,
+# not with its size. Checks the output compiles to the same assembly.
+functions=${1:-20000}
+mkdir -p ./build/benchmarks/preprocess
+dir=$(pwd)/build/benchmarks/preprocess
+
+generate()
+{
+    echo "#include <stdio.h>"
+    echo "#define SCALE(x, y) ((x) * (y) + 1)"
+    echo "#define LIMIT 64"
+    echo "typedef unsigned int count_t;"
+    for ((i = 0; i < $1; i++)); do
+        echo "/* function $i */"
+        echo "int function_$i(int a, int b)"
+        echo "{"
+        echo "    count_t c = SCALE(a,"
+        echo "                      $i);"
+        echo "    const char *s = \"text $i\";"
+        echo "    return c + s[$((i % 4))] + LIMIT;"
+        echo "}"
+    done
+}
+
+generate $functions > $dir/small.c
+generate $((functions * 4)) > $dir/large.c
+
+# Peak memory of the command in kilobytes, polled from /proc while it runs. Only anonymous
+# memory is counted, the source file is mapped and its pages are not held by the compiler.
+peak()
+{
+    "$@" &
+    local pid=$! max=0 rss
+    while kill -0 $pid 2> /dev/null; do
+        rss=$(awk '/RssAnon/ { print $2 }' /proc/$pid/status 2> /dev/null)
+        [ -n "$rss" ] && [ "$rss" -gt "$max" ] && max=$rss
+        sleep 0.01
+    done
+    wait $pid
+    echo "$max KB peak memory"
+}
+
+# Run from the repository root so <stdio.h> is found in ./dc_includes
+TIMEFORMAT="%R seconds"
+cd ../..
+for name in small large; do
+    echo "$name, $(wc -c < $dir/$name.c) bytes"
+    time ./main -E $dir/$name.c -o $dir/$name.i
+    peak ./main -E $dir/$name.c -o $dir/$name.i
+done
+
+cp $dir/small.i $dir/small_preprocessed.c
+./main $dir/small.c $dir/small.asm object > /dev/null
+./main $dir/small_preprocessed.c $dir/small_preprocessed.asm object > /dev/null
+cmp -s $dir/small.asm $dir/small_preprocessed.asm || echo "the preprocessed output compiles differently"
@@ -0,0 +1,32 @@
+#/usr/bin/bash
+
+# Token cache benchmark
+# Generates a large header and a file that includes it, then compiles the file twice
+# with a fresh token cache. The first compile lexes the header and fills the cache,
+# the second loads the header's tokens from it.
+# Prints the lex phase and the include table from the time report.
+total=${1:-4000}
+mkdir -p ./build/benchmarks
+header=./build/benchmarks/token_cache.h
+output=./build/benchmarks/token_cache.c
+cache=./build/benchmarks/token_cache_dir
+
+{
+    for ((i = 0; i < total; i++)); do
+        echo "/* token_cache_function_$i takes two arguments and returns an int */"
+        echo "int token_cache_function_$i(int first_argument, int second_argument);"
+        echo "#define TOKEN_CACHE_$i ($i + 1)"
+    done
+} > $header
+
+echo "#include \"$(pwd)/$header\"" > $output
+echo "int main()" >> $output
+echo "{" >> $output
+echo "    return 0;" >> $output
+echo "}" >> $output
+
+rm -rf $cache
+for run in cold warm; do
+    echo "token cache $run"
+    ../../main $output ./build/benchmarks/token_cache object --time-report --token-cache=$cache 2>&1 >/dev/null | grep -E "^(lex|[0-9]+ )"
+done
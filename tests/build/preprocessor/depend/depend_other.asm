@@ -0,0 +1,6 @@
+section .data
+; int depend_other
+depend_other: dd 2
+section .text
+section .data
+section .rodata
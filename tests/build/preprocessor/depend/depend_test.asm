@@ -0,0 +1,14 @@
+section .data
+section .text
+global main
+; main function
+main:
+push ebp
+mov ebp, esp
+.bb0:
+mov eax, 6
+.exit:
+pop ebp
+ret
+section .data
+section .rodata
@@ -0,0 +1,2 @@
+#pragma once
+#define INCLUDE_CACHE_VALUE 1
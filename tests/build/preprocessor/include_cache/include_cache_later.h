@@ -0,0 +1 @@
+#define INCLUDE_CACHE_LATER 3
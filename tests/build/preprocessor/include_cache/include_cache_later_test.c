@@ -0,0 +1,7 @@
+// Not found until the header is written, which the cache must notice
+#include "include_cache_later.h"
+
+int main()
+{
+    return INCLUDE_CACHE_LATER;
+}
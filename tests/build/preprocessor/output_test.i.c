@@ -0,0 +1,32 @@
+#line 1 "/root/repo/tests/preprocessor/output/output_nested.h"
+int output_nested;
+#line 4 "/root/repo/tests/preprocessor/output/output_header.h"
+int output_header(int value, ...);
+#line 2 "/root/repo/tests/preprocessor/output/output_twice.h"
+int output_twice(int value);
+#line 2 "/root/repo/tests/preprocessor/output/output_twice.h"
+int output_twice(int value);
+#line 7 "/root/repo/tests/preprocessor/output/output_test.c"
+struct output_point
+{
+int x;
+};
+
+int output_variadic(const char *format, ...);
+
+int output_test(struct output_point *point)
+{
+int value = ((point->x) + (3))
+;
+value *= 2;
+value <<= 1;
+value = (value >= 0 && -value < 0) + ~value;
+const char *text = "tab\there \"quoted\"\n";
+char c = 97;
+
+
+
+value = value + c + text[0];
+#line 35 "/root/repo/tests/preprocessor/output/output_test.c"
+return value + 100L;
+}
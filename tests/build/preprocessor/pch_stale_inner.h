@@ -0,0 +1,4 @@
+#pragma once
+#define PCH_INNER 7
+typedef int pch_number;
+#define PCH_CHANGED
@@ -0,0 +1,26 @@
+#ifndef TOKEN_CACHE_TEST_H
+#define TOKEN_CACHE_TEST_H
+// Every kind of token the lexer writes to the cache
+#define POINT_X 0x1f
+#define POINT_Y 0b101
+#define SCALE(a) ((a) * 3 \
+    + 1)
+#define TOKEN_CACHE_STAMP 2
+
+struct point
+{
+    int x;
+    int y;
+};
+
+/* Comments and new lines are kept in the cache too */
+const char *token_cache_name = "cached \"header\"\n";
+char token_cache_char = 'c';
+long token_cache_long = 100L;
+
+#if POINT_X > 16
+int token_cache_active = 1;
+#else
+int token_cache_inactive = 1;
+#endif
+#endif
@@ -0,0 +1,79 @@
+// Every condition that is evaluated as it should be leaves a pass_ declaration
+#define ONE 1
+#define TWO 2
+#define EMPTY
+#define EXPRESSION (ONE + TWO * 3)
+#define ADD(a, b) ((a) + (b))
+
+#if 1 + 2 * 3 == 7 && (1 + 2) * 3 == 9
+int pass_precedence;
+#endif
+
+#if -1 < 0 && !0 && ~0 == -1 && +3 == 3 && - -2 == 2
+int pass_unary;
+#endif
+
+#if 7 / 2 == 3 && 7 % 4 == 3 && 1 << 4 == 16 && 256 >> 4 == 16
+int pass_multiplicative_and_shift;
+#endif
+
+#if (6 & 3) == 2 && (6 | 3) == 7 && (6 ^ 3) == 5 && 2 <= 2 && 3 >= 2 && 1 != 2
+int pass_bitwise_and_relational;
+#endif
+
+#if 0x1f == 31 && 0b101 == 5 && 'a' == 97
+int pass_literals;
+#endif
+
+#if EXPRESSION == 7 && ADD(ONE, TWO) == 3
+int pass_expanded;
+#endif
+
+#if defined ONE && defined(TWO) && !defined THREE && !defined(THREE)
+int pass_defined;
+#endif
+
+#if UNDEFINED_NAME == 0 && !UNDEFINED_NAME
+int pass_undefined_is_zero;
+#endif
+
+#if EMPTY
+int fail_empty;
+#else
+int pass_empty;
+#endif
+
+// Not evaluated, the division is never made
+#if 0 && 1 / 0
+int fail_and;
+#elif 1 || 1 / 0
+int pass_short_circuit;
+#endif
+
+#if 1 ? 0 ? 1 : 2 : 3 / 0
+#if (0 ? 1 : 2) == 2 && (1, 2) == 2
+int pass_conditional;
+#endif
+#endif
+
+#if 0
+int fail_if;
+#elif TWO == 1
+int fail_elif;
+#elif TWO == 2
+int pass_elif;
+#else
+int fail_else;
+#endif
+
+// The same condition again after what it depends on changed
+#if ONE == 1
+int pass_cached_before;
+#endif
+#undef ONE
+#define ONE 2
+#if ONE == 1
+int fail_cached_after;
+#else
+int pass_cached_after;
+#endif
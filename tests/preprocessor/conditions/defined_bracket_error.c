@@ -0,0 +1,4 @@
+// The error is reported at the directive
+int before;
+#if defined(ONE
+#endif
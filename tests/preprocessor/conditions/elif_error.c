@@ -0,0 +1,5 @@
+// The error is reported at the #elif, not at the #if
+int before;
+#if 0
+#elif 1 +
+#endif
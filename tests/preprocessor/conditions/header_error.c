@@ -0,0 +1,3 @@
+// The error is reported in the header that has it
+int before;
+#include "preprocessor/conditions/header_error.h"
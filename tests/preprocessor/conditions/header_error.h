@@ -0,0 +1,4 @@
+// Included by header_error.c
+
+#if 1 / 0
+#endif
@@ -0,0 +1,4 @@
+#ifndef DEPEND_A
+#define DEPEND_A 1
+#include "preprocessor/depend/depend_b.h"
+#endif
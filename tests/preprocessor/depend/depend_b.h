@@ -0,0 +1,3 @@
+#ifndef DEPEND_B
+#define DEPEND_B 2
+#endif
@@ -0,0 +1,2 @@
+#include "preprocessor/depend/depend_b.h"
+#include "preprocessor/depend/depend_missing.h"
@@ -0,0 +1,3 @@
+#include "preprocessor/depend/depend_b.h"
+
+int depend_other = DEPEND_B;
@@ -0,0 +1,15 @@
+// Lists depend_a.h, and depend_b.h once though it is included twice
+#include "preprocessor/depend/depend_a.h"
+#include "preprocessor/depend/depend_b.h"
+#include "stddef-internal.h"
+
+#ifdef DEPEND_A
+#include "preprocessor/depend/depend_c.h"
+#else
+#include "preprocessor/depend/depend_not_included.h"
+#endif
+
+int main()
+{
+    return DEPEND_A + DEPEND_B + DEPEND_C;
+}
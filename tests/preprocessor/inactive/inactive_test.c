@@ -0,0 +1,54 @@
+// The groups that are not compiled hold what a skipper could take for a directive
+#include "preprocessor/inactive/inactive_test.h"
+
+#if 0
+/* A comment that holds
+#endif
+is still a comment */
+int fail_comment;
+#endif
+
+#if 0
+const char *fail_string = "#endif";
+#define FAIL_CONTINUED 1 \
+#endif
+int fail_continued;
+#endif
+
+#if 0
+#if 1
+int fail_nested;
+#else
+int fail_nested_else;
+#endif
+#ifdef ANYTHING
+#elif 1
+#endif
+int fail_after_nested;
+#endif
+
+#if 0
+  #  endif
+int pass_spaced = __LINE__;
+
+#ifndef INACTIVE_DEFINED
+#define INACTIVE_DEFINED
+int pass_ifndef = __LINE__;
+#elif 1 / 0
+int fail_elif;
+#else
+int fail_else;
+#endif
+
+#if 1
+int pass_taken = __LINE__;
+#elif 1 / 0
+int fail_taken_elif;
+#else
+int fail_taken_else;
+#endif
+
+int main()
+{
+    return pass_header + pass_spaced + pass_ifndef + pass_taken + __LINE__;
+}
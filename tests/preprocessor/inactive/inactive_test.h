@@ -0,0 +1,8 @@
+#ifndef INACTIVE_TEST_H
+#define INACTIVE_TEST_H
+#ifdef INACTIVE_NOT_DEFINED
+int fail_header;
+#else
+int pass_header = 1;
+#endif
+#endif
@@ -0,0 +1,6 @@
+// Text that could not be lexed, it is skipped without being lexed
+#if 0
+It's text with an unbalanced ' and "
+int fail_text;
+#endif
+int pass_text = __LINE__;
@@ -0,0 +1,8 @@
+// Resolved against the working directory until a dc_includes directory shadows it
+#include "include_cache_found.h"
+#include "include_cache_found.h"
+
+int main()
+{
+    return INCLUDE_CACHE_VALUE;
+}
@@ -0,0 +1,44 @@
+#define SQUARE(x) ((x) * (x))
+#define ADD(a, b) ((a) + (b))
+#define SCALE 2
+#define SCALED(x) ((x) * SCALE)
+#define LINE_OF(x) (__LINE__ + (x) - __LINE__)
+#define NAME(x) #x
+#define JOIN(a, b) a##b
+
+int macro_cache_ab = 1;
+
+int main()
+{
+    int total = 0;
+    const char *name = NAME(abc);
+    // A call is cached the second time it is seen, the third is taken from the cache
+    total = total + SQUARE(2);
+    total = total + SQUARE(2);
+    total = total + SQUARE(2);
+
+    // Calls in the arguments
+    total = total + ADD(SQUARE(1), SQUARE(1));
+    total = total + ADD(SQUARE(1), SQUARE(1));
+    total = total + ADD(SQUARE(1), SQUARE(1));
+
+    // A definition the expansion looks up changes
+    total = total + SCALED(3);
+    total = total + SCALED(3);
+    total = total + SCALED(3);
+#undef SCALE
+#define SCALE 3
+    total = total + SCALED(3);
+
+    // The macro itself is defined again
+#undef SQUARE
+#define SQUARE(x) ((x) + (x))
+    total = total + SQUARE(2);
+
+    // Natives expand to where they are called, they are never cached
+    total = total + LINE_OF(1) + LINE_OF(1) + LINE_OF(1);
+
+    total = total + JOIN(macro_cache_, ab) + JOIN(macro_cache_, ab) + JOIN(macro_cache_, ab);
+    total = total + name[1] - 'a';
+    return total;
+}
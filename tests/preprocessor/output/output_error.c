@@ -0,0 +1,2 @@
+int output_before_error;
+#include "preprocessor/output/output_missing.h"
@@ -0,0 +1,4 @@
+#pragma once
+#include "preprocessor/output/output_nested.h"
+#define OUTPUT_SCALE 3
+int output_header(int value, ...);
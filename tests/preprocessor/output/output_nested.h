@@ -0,0 +1 @@
+int output_nested;
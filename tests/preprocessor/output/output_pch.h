@@ -0,0 +1,6 @@
+#include "preprocessor/output/output_header.h"
+#define OUTPUT_PCH(x) ((x) * OUTPUT_SCALE)
+int output_pch(int x)
+{
+    return OUTPUT_PCH(x) + output_nested;
+}
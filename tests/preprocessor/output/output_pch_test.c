@@ -0,0 +1,5 @@
+// Starts from output_pch.h, written with its own lines before this file
+int main()
+{
+    return output_pch(1);
+}
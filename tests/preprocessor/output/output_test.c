@@ -0,0 +1,36 @@
+// What -E writes for this file is compared with output_test.expected
+#include "preprocessor/output/output_header.h"
+#include "preprocessor/output/output_twice.h"
+#include "preprocessor/output/output_twice.h"
+#define ADD(a, b) ((a) + (b))
+
+struct output_point
+{
+    int x;
+};
+
+int output_variadic(const char *format, ...);
+
+int output_test(struct output_point *point)
+{
+    int value = ADD(point->x,
+                    OUTPUT_SCALE);
+    value *= 2;
+    value <<= 1;
+    value = (value >= 0 && -value < 0) + ~value;
+    const char *text = "tab\there \"quoted\"\n";
+    char c = 'a';
+
+
+
+    value = value + c + text[0];
+
+
+
+
+
+
+
+
+    return value + 100L;
+}
@@ -0,0 +1,2 @@
+// No guard, every inclusion is written
+int output_twice(int value);
@@ -0,0 +1,3 @@
+#pragma once
+#define PCH_INNER 7
+typedef int pch_number;
@@ -0,0 +1,9 @@
+// Everything it uses comes from the precompiled header
+int main()
+{
+    struct pch_pair pair;
+    const char *name = PCH_NAME;
+    pair.a = PCH_TWICE(PCH_INNER);
+    pair.b = sizeof(struct pch_pair) + name[0];
+    return pch_sum(&pair) + pch_global;
+}
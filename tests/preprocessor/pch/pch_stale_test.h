@@ -0,0 +1,2 @@
+// Made from a copy of pch_inner.h that is then changed
+#include "build/preprocessor/pch_stale_inner.h"
@@ -0,0 +1,12 @@
+// Included again after the precompiled header, the guard keeps it out
+#include "preprocessor/pch/pch_test.h"
+#include "preprocessor/pch/pch_inner.h"
+
+int main()
+{
+    struct pch_pair pair;
+    const char *name = PCH_NAME;
+    pair.a = PCH_TWICE(PCH_INNER);
+    pair.b = sizeof(struct pch_pair) + name[0];
+    return pch_sum(&pair) + pch_global;
+}
@@ -0,0 +1,22 @@
+#ifndef PCH_TEST_H
+#define PCH_TEST_H
+#include "preprocessor/pch/pch_inner.h"
+#include "preprocessor/pch/pch_inner.h"
+#include "stddef-internal.h"
+
+#define PCH_TWICE(x) ((x) + (x))
+#define PCH_NAME "precompiled"
+
+struct pch_pair
+{
+    pch_number a;
+    pch_number b;
+};
+
+pch_number pch_global = PCH_TWICE(PCH_INNER);
+
+int pch_sum(struct pch_pair *pair)
+{
+    return pair->a + pair->b;
+}
+#endif
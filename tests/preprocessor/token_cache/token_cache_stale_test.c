@@ -0,0 +1,6 @@
+#include "build/preprocessor/token_cache_stale_test.h"
+
+int main()
+{
+    return SCALE(POINT_Y) + TOKEN_CACHE_STAMP;
+}
@@ -0,0 +1,9 @@
+#include "preprocessor/token_cache/token_cache_test.h"
+
+int main()
+{
+    struct point p;
+    p.x = POINT_X;
+    p.y = SCALE(POINT_Y);
+    return p.x + p.y + TOKEN_CACHE_STAMP + token_cache_char;
+}
@@ -622,6 +622,254 @@ else
     echo -e "Macro string test passed"
 fi
 
+echo -e "Include once test"
+./build/preprocessor_include_once_test
+if [ $? -ne 1 ]; then
+    echo -e "Include once test failed"
+    res_code=1
+else
+    echo -e "Include once test passed"
+fi
+
+echo -e "Register pressure test"
+./build/register_pressure_test
+if [ $? -ne 125 ]; then
+    echo -e "Register pressure test failed"
+    res_code=1
+else
+    echo -e "Register pressure test passed"
+fi
+
+echo -e "Peephole test"
+./build/peephole_test
+if [ $? -ne 27 ]; then
+    echo -e "Peephole test failed"
+    res_code=1
+else
+    echo -e "Peephole test passed"
+fi
+
+./build/ir_test
+if [ $? -ne 104 ]; then
+    echo -e "IR test failed"
+    res_code=1
+else
+    echo -e "IR test passed"
+fi
+
+./build/fold_test
+if [ $? -ne 85 ]; then
+    echo -e "Fold test failed"
+    res_code=1
+else
+    echo -e "Fold test passed"
+fi
+
+./build/truncate_store_test
+if [ $? -ne 196 ]; then
+    echo -e "Truncate store test failed"
+    res_code=1
+else
+    echo -e "Truncate store test passed"
+fi
+
+
+# The preprocessor tests compile or preprocess the fixtures in ./preprocessor with a feature
+# on and off and compare what the compiler writes, or compare it with an expected file
+mkdir -p ./build/preprocessor
+
+# Reports the test as passed if the last command succeeded
+preprocessor_result()
+{
+    if [ $? -ne 0 ]; then
+        echo -e "$1 failed"
+        res_code=1
+    else
+        echo -e "$1 passed"
+    fi
+}
+
+# Compiles the unit with the first flags and then with the second,
+# both must succeed and generate the same assembly
+preprocessor_compile_same()
+{
+    local output=./build/preprocessor/$(basename $1 .c)
+    rm -f $output.first $output.second
+    ../main $1 $output.first object $2 > /dev/null &&
+        ../main $1 $output.second object $3 > /dev/null &&
+        cmp $output.first $output.second
+}
+
+# Runs the command, what it writes to stdout and stderr and its exit code must be the expected
+# file. Paths in this directory are written relative to it.
+preprocessor_output_same()
+{
+    local expected=$1
+    local actual=./build/preprocessor/$(basename $expected)
+    shift
+    "$@" > $actual.stdout 2> $actual.stderr
+    local code=$?
+    {
+        cat $actual.stdout
+        echo "--- stderr"
+        cat $actual.stderr
+        echo "--- exit $code"
+    } | sed "s|$PWD/|./|g" > $actual
+    diff $expected $actual
+}
+
+echo -e "Running token cache tests"
+rm -rf ./build/preprocessor/token_cache
+preprocessor_compile_same ./preprocessor/token_cache/token_cache_test.c "" "--token-cache=./build/preprocessor/token_cache"
+preprocessor_result "Token cache store test"
+
+preprocessor_compile_same ./preprocessor/token_cache/token_cache_test.c "" "--token-cache=./build/preprocessor/token_cache"
+preprocessor_result "Token cache load test"
+
+../main ./preprocessor/token_cache/token_cache_test.c ./build/preprocessor/token_cache_test object --token-cache=./build/preprocessor/token_cache --time-report 2>&1 > /dev/null | grep " hit .*/token_cache_test.h$" > /dev/null
+preprocessor_result "Token cache hit test"
+
+# The header changes without changing size, the cached tokens must not be used
+cp ./preprocessor/token_cache/token_cache_test.h ./build/preprocessor/token_cache_stale_test.h
+preprocessor_compile_same ./preprocessor/token_cache/token_cache_stale_test.c "" "--token-cache=./build/preprocessor/token_cache" &&
+    cp ./build/preprocessor/token_cache_stale_test.second ./build/preprocessor/token_cache_stale_test.before
+sed -i "s/TOKEN_CACHE_STAMP 1/TOKEN_CACHE_STAMP 2/" ./build/preprocessor/token_cache_stale_test.h
+preprocessor_compile_same ./preprocessor/token_cache/token_cache_stale_test.c "" "--token-cache=./build/preprocessor/token_cache" &&
+    ! cmp -s ./build/preprocessor/token_cache_stale_test.before ./build/preprocessor/token_cache_stale_test.second
+preprocessor_result "Token cache stale test"
+
+echo -e "Running precompiled header tests"
+../main --emit-pch ./preprocessor/pch/pch_test.h ./build/preprocessor/pch_test.pch &&
+    preprocessor_compile_same ./preprocessor/pch/pch_test.c "" "--include-pch=./build/preprocessor/pch_test.pch"
+preprocessor_result "Precompiled header round trip test"
+
+../main ./preprocessor/pch/pch_only_test.c ./build/preprocessor/pch_only_test object --include-pch=./build/preprocessor/pch_test.pch > /dev/null &&
+    cmp ./build/preprocessor/pch_only_test ./build/preprocessor/pch_test.first
+preprocessor_result "Precompiled header without include test"
+
+cp ./preprocessor/pch/pch_inner.h ./build/preprocessor/pch_stale_inner.h
+../main --emit-pch ./preprocessor/pch/pch_stale_test.h ./build/preprocessor/pch_stale_test.pch
+echo "#define PCH_CHANGED" >> ./build/preprocessor/pch_stale_inner.h
+preprocessor_output_same ./preprocessor/pch/pch_stale_test.expected ../main ./preprocessor/pch/pch_test.c ./build/preprocessor/pch_stale_test object --include-pch=./build/preprocessor/pch_stale_test.pch
+preprocessor_result "Precompiled header stale test"
+
+head -c 40 ./build/preprocessor/pch_test.pch > ./build/preprocessor/pch_truncated_test.pch
+preprocessor_output_same ./preprocessor/pch/pch_truncated_test.expected ../main ./preprocessor/pch/pch_test.c ./build/preprocessor/pch_truncated_test object --include-pch=./build/preprocessor/pch_truncated_test.pch
+preprocessor_result "Precompiled header truncated test"
+echo -e "Running include cache tests"
+# Quoted includes are found relative to the working directory, the tests run in a copy of the fixtures
+rm -rf ./build/preprocessor/include_cache
+mkdir -p ./build/preprocessor/include_cache
+cp ./preprocessor/include_cache/* ./build/preprocessor/include_cache
+cd ./build/preprocessor/include_cache
+
+../../../../main include_cache_test.c uncached object > /dev/null &&
+    ../../../../main include_cache_test.c cached object --include-cache=include.cache > /dev/null &&
+    cmp uncached cached
+preprocessor_result "Include cache store test"
+
+../../../../main include_cache_test.c cached object --include-cache=include.cache --time-report 2>&1 > /dev/null | grep "^include cache  *[1-9][0-9]* hits 0 misses" > /dev/null &&
+    cmp uncached cached
+preprocessor_result "Include cache hit test"
+
+# A header added to a directory searched first must be found instead of the cached one
+cp cached before
+mkdir dc_includes
+cp include_cache_shadow.h dc_includes/include_cache_found.h
+../../../../main include_cache_test.c uncached object > /dev/null &&
+    ../../../../main include_cache_test.c cached object --include-cache=include.cache > /dev/null &&
+    cmp uncached cached && ! cmp -s cached before
+preprocessor_result "Include cache invalidation test"
+
+# A header that was not found is cached as missing until it is written
+../../../../main include_cache_later_test.c later object --include-cache=include.cache > /dev/null 2>&1
+test $? -ne 0 && cp include_cache_later.h.in include_cache_later.h &&
+    ../../../../main include_cache_later_test.c later object --include-cache=include.cache > /dev/null
+preprocessor_result "Include cache missing header test"
+cd ../../..
+echo -e "Running macro cache tests"
+preprocessor_compile_same ./preprocessor/macro_cache/macro_cache_test.c "" "--no-macro-cache"
+preprocessor_result "Macro cache compile test"
+
+../main -E ./preprocessor/macro_cache/macro_cache_test.c -o ./build/preprocessor/macro_cache_test.cached &&
+    ../main -E ./preprocessor/macro_cache/macro_cache_test.c -o ./build/preprocessor/macro_cache_test.uncached --no-macro-cache &&
+    cmp ./build/preprocessor/macro_cache_test.cached ./build/preprocessor/macro_cache_test.uncached
+preprocessor_result "Macro cache preprocess test"
+
+../main ./preprocessor/macro_cache/macro_cache_test.c ./build/preprocessor/macro_cache_test object --time-report 2>&1 > /dev/null | grep "^macro cache  *[1-9][0-9]* hits" > /dev/null
+preprocessor_result "Macro cache hit test"
+echo -e "Running condition tests"
+preprocessor_output_same ./preprocessor/conditions/conditions_test.expected ../main -E ./preprocessor/conditions/conditions_test.c
+preprocessor_result "Condition evaluation test"
+
+# Every error names the line of the #if or #elif that has it
+for unit in ./preprocessor/conditions/*_error.c; do
+    preprocessor_output_same ${unit%.c}.expected ../main -E $unit
+    preprocessor_result "Condition $(basename $unit .c) test"
+done
+echo -e "Running inactive group tests"
+preprocessor_compile_same ./preprocessor/inactive/inactive_test.c "" "--no-skip-inactive"
+preprocessor_result "Inactive group compile test"
+
+../main -E ./preprocessor/inactive/inactive_test.c -o ./build/preprocessor/inactive_test.skipped &&
+    ../main -E ./preprocessor/inactive/inactive_test.c -o ./build/preprocessor/inactive_test.lexed --no-skip-inactive &&
+    cmp ./build/preprocessor/inactive_test.skipped ./build/preprocessor/inactive_test.lexed
+preprocessor_result "Inactive group preprocess test"
+
+../main ./preprocessor/inactive/inactive_test.c ./build/preprocessor/inactive_test object --time-report 2>&1 > /dev/null | grep "^inactive groups  *[1-9][0-9]* skipped" > /dev/null
+preprocessor_result "Inactive group skipped test"
+
+# Only a group that is skipped without being lexed can hold text the lexer does not understand
+preprocessor_output_same ./preprocessor/inactive/inactive_text_test.expected ../main -E ./preprocessor/inactive/inactive_text_test.c
+preprocessor_result "Inactive group text test"
+echo -e "Running dependency tests"
+# Every way of writing the rules must write the same ones
+depend_inputs="./preprocessor/depend/depend_test.c ./preprocessor/depend/depend_other.c"
+preprocessor_output_same ./preprocessor/depend/depend_test.expected ../main -M $depend_inputs
+preprocessor_result "Dependency -M test"
+
+preprocessor_output_same ./preprocessor/depend/depend_test.expected ../main -M --directives-only $depend_inputs
+preprocessor_result "Dependency directives only test"
+
+preprocessor_output_same ./preprocessor/depend/depend_test.expected ../main -M --no-skip-inactive $depend_inputs
+preprocessor_result "Dependency without skipping test"
+
+../main -M -MF ./build/preprocessor/depend_test.d $depend_inputs > ./build/preprocessor/depend_test.stdout &&
+    test ! -s ./build/preprocessor/depend_test.stdout &&
+    preprocessor_output_same ./preprocessor/depend/depend_test.expected cat ./build/preprocessor/depend_test.d
+preprocessor_result "Dependency -MF test"
+
+# -c writes the objects to the working directory, the fixtures are reached through a link
+rm -rf ./build/preprocessor/depend
+mkdir -p ./build/preprocessor/depend
+ln -s ../../../preprocessor ./build/preprocessor/depend/preprocessor
+cd ./build/preprocessor/depend
+../../../../main -c -MD preprocessor/depend/depend_test.c preprocessor/depend/depend_other.c > /dev/null
+cd ../../..
+preprocessor_output_same ./preprocessor/depend/depend_test.expected cat ./build/preprocessor/depend/depend_test.d ./build/preprocessor/depend/depend_other.d
+preprocessor_result "Dependency -MD test"
+
+# The rules of the inputs that can be scanned are still written
+preprocessor_output_same ./preprocessor/depend/depend_missing_test.expected ../main -M ./preprocessor/depend/depend_test.c ./preprocessor/depend/depend_missing.c ./preprocessor/depend/depend_other.c
+preprocessor_result "Dependency missing header test"
+echo -e "Running preprocessed output tests"
+preprocessor_output_same ./preprocessor/output/output_test.expected ../main -E ./preprocessor/output/output_test.c
+preprocessor_result "Preprocessed output test"
+
+../main --emit-pch ./preprocessor/output/output_pch.h ./build/preprocessor/output_pch.pch &&
+    preprocessor_output_same ./preprocessor/output/output_pch_test.expected ../main -E ./preprocessor/output/output_pch_test.c --include-pch=./build/preprocessor/output_pch.pch
+preprocessor_result "Preprocessed output precompiled header test"
+
+# The input that fails keeps what it wrote, the output of the next starts on a line of its own
+preprocessor_output_same ./preprocessor/output/output_error_test.expected ../main -E ./preprocessor/output/output_other.c ./preprocessor/output/output_error.c ./preprocessor/output/output_other.c
+preprocessor_result "Preprocessed output error test"
+
+# The output compiles to the same assembly as the source it came from
+../main -E ./preprocessor/output/output_test.c -o ./build/preprocessor/output_test.i.c &&
+    ../main ./preprocessor/output/output_test.c ./build/preprocessor/output_test.source object > /dev/null &&
+    ../main ./build/preprocessor/output_test.i.c ./build/preprocessor/output_test.preprocessed object > /dev/null &&
+    cmp ./build/preprocessor/output_test.source ./build/preprocessor/output_test.preprocessed
+preprocessor_result "Preprocessed output compile test"
 
 echo -e "All tests finished"
 exit $res_code
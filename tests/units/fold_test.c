@@ -0,0 +1,38 @@
+int calls;
+
+int touch()
+{
+    calls = calls + 1;
+    return 1;
+}
+
+int main()
+{
+    int x;
+    int total;
+    x = 5;
+    total = (x * 1) + ((x + 0) + (0 + x));
+    total = total + ((x * 0) + ((char)300));
+    total = total + ((~0 & 7) + ((17 % 5) + ((1 << 3) - 3)));
+    if (0)
+    {
+        total = 0;
+    }
+    else if (1)
+    {
+        total = total + 1;
+    }
+
+    while (0)
+    {
+        total = 0;
+    }
+
+    total = total + (1 ? 10 : touch());
+    if (0 && touch())
+    {
+        total = 0;
+    }
+    total = total + ((touch() * 0) + calls);
+    return total;
+}
@@ -0,0 +1,44 @@
+int calls;
+
+int square(int x)
+{
+    calls++;
+    return x * x;
+}
+
+char wrap(int x)
+{
+    char c;
+    c = x;
+    return c;
+}
+
+int main()
+{
+    int i;
+    int total;
+    unsigned int u;
+    total = 0;
+    for (i = 0; i < 10; i++)
+    {
+        if (i == 7)
+        {
+            break;
+        }
+
+        if ((i % 2) == 1 && i > 2)
+        {
+            continue;
+        }
+        total += square(i);
+    }
+
+    u = 100;
+    do
+    {
+        u = u / 3;
+    } while (u > 5);
+
+    total = total + (wrap(300) + ((calls > 3) ? u : 50));
+    return total;
+}
@@ -0,0 +1,34 @@
+int compare(int a, int b)
+{
+    if (a < b)
+    {
+        return 1;
+    }
+
+    if (a > b)
+    {
+        return 2;
+    }
+    return 4;
+}
+
+int main()
+{
+    int i;
+    int total;
+    total = 0;
+    i = 0;
+    while (i != 10)
+    {
+        if (i <= 3)
+        {
+            total = total + compare(i, 3);
+        }
+        else if (i >= 8)
+        {
+            total = total + 10;
+        }
+        i = i + 1;
+    }
+    return total;
+}
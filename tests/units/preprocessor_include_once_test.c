@@ -0,0 +1,9 @@
+#include <stdio.h>
+#include <stdio.h>
+#include "units/preprocessor_include_once_test.h"
+#include "units/preprocessor_include_once_test.h"
+
+int main()
+{
+    return INCLUDE_ONCE_COUNT;
+}
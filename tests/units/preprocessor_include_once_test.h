@@ -0,0 +1,7 @@
+#pragma once
+#ifdef INCLUDE_ONCE_COUNT
+#undef INCLUDE_ONCE_COUNT
+#define INCLUDE_ONCE_COUNT 2
+#else
+#define INCLUDE_ONCE_COUNT 1
+#endif
@@ -0,0 +1,14 @@
+int f(int a, int b)
+{
+    return a * 3 - b;
+}
+int main()
+{
+    int a;
+    int b;
+    int c;
+    a = 2;
+    b = 3;
+    c = 4;
+    return (a + (b * (c + (a * (b + (c * (a + f(b, c + f(a, b)))))))) - (c - (b - a))) % 256;
+}
@@ -0,0 +1,13 @@
+char gc;
+char gn;
+short gs;
+
+int main()
+{
+    char c = 300;
+    short s = 70000;
+    gc = 300;
+    gn = 200;
+    gs = 70000;
+    return gc + c + (gs - s) + (gs - 4400) + gn + 100;
+}
@@ -0,0 +1,316 @@
+#include "compiler.h"
+#include <time.h>
+
+// Phases shorter than this took too little time for a rate to mean anything, none is reported
+#define COMPILE_TIMING_MIN_RATE_SECONDS 0.00001
+
+struct compile_phase_info
+{
+    const char *name;
+    // What the items of this phase are
+    const char *unit;
+};
+
+static const struct compile_phase_info phase_info[COMPILE_TOTAL_PHASES] = {
+    {"lex", "tokens"},
+    {"preprocess", "tokens"},
+    {"parse", "nodes"},
+    {"validate", "nodes"},
+    {"fold", "nodes"},
+    {"codegen", "nodes"}};
+
+double compile_timing_now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1000000000.0;
+}
+
+struct compile_timing *compile_timing_create()
+{
+    struct compile_timing *timing = calloc(1, sizeof(struct compile_timing));
+    timing->includes = vector_create(sizeof(struct compile_include_timing));
+    return timing;
+}
+
+void compile_timing_free(struct compile_timing *timing)
+{
+    vector_free(timing->includes);
+    free(timing);
+}
+
+void compile_timing_begin(struct compile_process *process, int phase)
+{
+    struct compile_timing *timing = process->timing;
+    if (!timing)
+    {
+        return;
+    }
+
+    if (timing->depth >= COMPILE_TIMING_MAX_DEPTH)
+    {
+        compiler_error(process, "Phases are nested too deeply to be timed");
+    }
+
+    struct compile_timing_frame *frame = &timing->stack[timing->depth++];
+    frame->phase = phase;
+    frame->nested = 0;
+    frame->start = compile_timing_now();
+}
+
+void compile_timing_end(struct compile_process *process, size_t items)
+{
+    struct compile_timing *timing = process->timing;
+    if (!timing)
+    {
+        return;
+    }
+
+    assert(timing->depth > 0);
+    struct compile_timing_frame *frame = &timing->stack[--timing->depth];
+    double elapsed = compile_timing_now() - frame->start;
+    timing->phases[frame->phase].seconds += elapsed - frame->nested;
+    timing->phases[frame->phase].items += items;
+
+    // The phase that started us must not count our time as its own
+    if (timing->depth > 0)
+    {
+        timing->stack[timing->depth - 1].nested += elapsed;
+    }
+}
+
+void compile_timing_include(struct compile_process *process, const char *filename, double start, size_t tokens, bool cached)
+{
+    struct compile_timing *timing = process->timing;
+    if (!timing)
+    {
+        return;
+    }
+
+    struct compile_include_timing include = {};
+    include.filename = filename;
+    include.seconds = compile_timing_now() - start;
+    include.tokens = tokens;
+    // We are called from the preprocess phase of the file that included us
+    include.depth = timing->depth - 1;
+    include.cached = cached;
+    vector_push(timing->includes, &include);
+}
+
+static double compile_timing_total(struct compile_timing *timing)
+{
+    double total = 0;
+    for (int i = 0; i < COMPILE_TOTAL_PHASES; i++)
+    {
+        total += timing->phases[i].seconds;
+    }
+    return total;
+}
+
+/**
+ * Returns true if the phase took long enough for its items per second to be reported,
+ * at least COMPILE_TIMING_MIN_RATE_SECONDS and more than the resolution of the clock.
+ */
+static bool compile_timing_has_rate(double seconds)
+{
+    static double min_seconds = 0;
+    if (!min_seconds)
+    {
+        struct timespec res;
+        clock_getres(CLOCK_MONOTONIC, &res);
+        min_seconds = res.tv_sec + res.tv_nsec / 1000000000.0;
+        if (min_seconds < COMPILE_TIMING_MIN_RATE_SECONDS)
+        {
+            min_seconds = COMPILE_TIMING_MIN_RATE_SECONDS;
+        }
+    }
+    return seconds >= min_seconds;
+}
+
+static double compile_timing_per_second(size_t items, double seconds)
+{
+    return items / seconds;
+}
+
+static void compile_timing_json_string(FILE *out, const char *str)
+{
+    fputc('"', out);
+    for (; *str; str++)
+    {
+        if (*str == '"' || *str == '\\')
+        {
+            fputc('\\', out);
+        }
+        fputc(*str, out);
+    }
+    fputc('"', out);
+}
+
+static void compile_timing_report_json(struct compile_process *process, FILE *out)
+{
+    struct compile_timing *timing = process->timing;
+    fprintf(out, "{\"file\": ");
+    compile_timing_json_string(out, process->cfile.abs_path);
+    fprintf(out, ", \"total_seconds\": %.9f, \"phases\": [", compile_timing_total(timing));
+    for (int i = 0; i < COMPILE_TOTAL_PHASES; i++)
+    {
+        struct compile_phase_timing *phase = &timing->phases[i];
+        fprintf(out, "%s{\"name\": \"%s\", \"seconds\": %.9f, \"items\": %zu, \"unit\": \"%s\", \"items_per_second\": ",
+                i ? ", " : "", phase_info[i].name, phase->seconds, phase->items, phase_info[i].unit);
+        if (compile_timing_has_rate(phase->seconds))
+        {
+            fprintf(out, "%.1f}", compile_timing_per_second(phase->items, phase->seconds));
+        }
+        else
+        {
+            fprintf(out, "null}");
+        }
+    }
+
+    fprintf(out, "], \"includes\": [");
+    for (int i = 0; i < vector_count(timing->includes); i++)
+    {
+        struct compile_include_timing *include = vector_at(timing->includes, i);
+        fprintf(out, "%s{\"file\": ", i ? ", " : "");
+        compile_timing_json_string(out, include->filename);
+        fprintf(out, ", \"seconds\": %.9f, \"tokens\": %zu, \"depth\": %i, \"cached\": %s}", include->seconds, include->tokens, include->depth,
+                include->cached ? "true" : "false");
+    }
+    fprintf(out, "], \"peephole\": {\"instructions\": %zu, \"removed\": {", process->generator->peephole.total_instructions);
+    for (int i = 0; i < PEEPHOLE_TOTAL_RULES; i++)
+    {
+        fprintf(out, "%s\"%s\": %zu", i ? ", " : "", peephole_rule_name(i), process->generator->peephole.removed[i]);
+    }
+    struct include_cache_stats *include_cache = include_cache_stats();
+    struct preprocessor_expansion_stats *macros = &process->preprocessor->expansion_stats;
+    struct preprocessor_expansion_cache *macro_cache = &process->preprocessor->expansion_cache;
+    fprintf(out, "}}, \"macros\": {\"expansions\": %zu, \"allocations\": %zu, \"cache_hits\": %zu, \"cache_misses\": %zu}",
+            macros->expansions, macros->allocations, macro_cache->hits, macro_cache->misses);
+    struct preprocessor_conditions *conditions = &process->preprocessor->conditions;
+    fprintf(out, ", \"conditions\": {\"evaluated\": %zu, \"cache_hits\": %zu, \"allocations\": %zu}",
+            conditions->evaluated, conditions->hits, conditions->allocations);
+    struct preprocessor_inactive_stats *inactive = &process->preprocessor->inactive;
+    fprintf(out, ", \"inactive\": {\"groups\": %zu, \"bytes\": %zu}", inactive->groups, inactive->bytes);
+    fprintf(out, ", \"include_cache\": {\"hits\": %zu, \"misses\": %zu, \"calls_saved\": %zu, \"directory_checks\": %zu}}\n",
+            include_cache->hits, include_cache->misses, include_cache->calls_saved, include_cache->directory_checks);
+}
+
+static void compile_timing_report_peephole(struct compile_process *process, FILE *out)
+{
+    struct peephole *peephole = &process->generator->peephole;
+    if (peephole->total_instructions == 0)
+    {
+        return;
+    }
+
+    size_t total_removed = 0;
+    fprintf(out, "\n%-20s %12s\n", "peephole rule", "removed");
+    for (int i = 0; i < PEEPHOLE_TOTAL_RULES; i++)
+    {
+        fprintf(out, "%-20s %12zu\n", peephole_rule_name(i), peephole->removed[i]);
+        total_removed += peephole->removed[i];
+    }
+    fprintf(out, "%-20s %12zu of %zu instructions\n", "total", total_removed, peephole->total_instructions);
+}
+
+static void compile_timing_report_macros(struct compile_process *process, FILE *out)
+{
+    struct preprocessor_expansion_stats *stats = &process->preprocessor->expansion_stats;
+    if (stats->expansions == 0)
+    {
+        return;
+    }
+
+    fprintf(out, "\n%-20s %12zu expansions, %zu vector allocations, %.2f per expansion\n", "macros",
+            stats->expansions, stats->allocations, (double)stats->allocations / stats->expansions);
+
+    struct preprocessor_expansion_cache *cache = &process->preprocessor->expansion_cache;
+    size_t total_calls = cache->hits + cache->misses;
+    if (total_calls)
+    {
+        fprintf(out, "%-20s %12zu hits %zu misses, %.1f%% hit rate\n", "macro cache",
+                cache->hits, cache->misses, 100.0 * cache->hits / total_calls);
+    }
+}
+
+static void compile_timing_report_conditions(struct compile_process *process, FILE *out)
+{
+    struct preprocessor_conditions *conditions = &process->preprocessor->conditions;
+    struct preprocessor_inactive_stats *inactive = &process->preprocessor->inactive;
+    if (conditions->evaluated == 0 && inactive->groups == 0)
+    {
+        return;
+    }
+
+    fprintf(out, "\n%-20s %12zu evaluated, %zu cache hits, %zu vector allocations\n", "conditions",
+            conditions->evaluated, conditions->hits, conditions->allocations);
+    if (inactive->groups)
+    {
+        fprintf(out, "%-20s %12zu skipped, %zu bytes never lexed\n", "inactive groups",
+                inactive->groups, inactive->bytes);
+    }
+}
+
+static void compile_timing_report_include_cache(FILE *out)
+{
+    struct include_cache_stats *stats = include_cache_stats();
+    if (stats->hits + stats->misses == 0)
+    {
+        return;
+    }
+
+    fprintf(out, "\n%-20s %12zu hits %zu misses, %zu filesystem calls saved, %zu directory checks\n", "include cache",
+            stats->hits, stats->misses, stats->calls_saved, stats->directory_checks);
+}
+
+void compile_timing_report(struct compile_process *process, FILE *out)
+{
+    struct compile_timing *timing = process->timing;
+    if (!timing)
+    {
+        return;
+    }
+
+    if (process->flags & COMPILE_PROCESS_TIME_REPORT_JSON)
+    {
+        compile_timing_report_json(process, out);
+        return;
+    }
+
+    double total = compile_timing_total(timing);
+    fprintf(out, "Time report for %s\n", process->cfile.abs_path);
+    fprintf(out, "%-12s %12s %8s %12s %-7s %14s\n", "phase", "wall (ms)", "%", "items", "", "items/s");
+    for (int i = 0; i < COMPILE_TOTAL_PHASES; i++)
+    {
+        struct compile_phase_timing *phase = &timing->phases[i];
+        fprintf(out, "%-12s %12.3f %7.1f%% %12zu %-7s ", phase_info[i].name, phase->seconds * 1000,
+                total > 0 ? phase->seconds / total * 100 : 0, phase->items, phase_info[i].unit);
+        if (compile_timing_has_rate(phase->seconds))
+        {
+            fprintf(out, "%14.0f\n", compile_timing_per_second(phase->items, phase->seconds));
+        }
+        else
+        {
+            fprintf(out, "%14s\n", "-");
+        }
+    }
+    fprintf(out, "%-12s %12.3f\n", "total", total * 1000);
+    compile_timing_report_peephole(process, out);
+    compile_timing_report_macros(process, out);
+    compile_timing_report_conditions(process, out);
+    compile_timing_report_include_cache(out);
+
+    if (vector_count(timing->includes) == 0)
+    {
+        return;
+    }
+
+    // Include times overlap the lex and preprocess phases above, they are shown for where the time went.
+    fprintf(out, "\n%-12s %12s %12s %-6s  %s\n", "include", "wall (ms)", "tokens", "cache", "file");
+    for (int i = 0; i < vector_count(timing->includes); i++)
+    {
+        struct compile_include_timing *include = vector_at(timing->includes, i);
+        fprintf(out, "%-12i %12.3f %12zu %-6s  %*s%s\n", include->depth, include->seconds * 1000, include->tokens, include->cached ? "hit" : "",
+                include->depth * 2, "", include->filename);
+    }
+}
@@ -2,11 +2,6 @@
 #include "helpers/buffer.h"
 #include <stdbool.h>
 
-#define PRIMITIVE_TYPES_TOTAL 7
-const char* primitive_types[PRIMITIVE_TYPES_TOTAL] = {
-    "void", "char", "short", "int", "long", "float", "double"
-};
-
 void tokens_join_buffer_write_token(struct buffer *fmt_buf, struct token *token)
 {
 
@@ -40,14 +35,18 @@ void tokens_join_buffer_write_token(struct buffer *fmt_buf, struct token *token)
 
 struct vector *tokens_join_vector(struct compile_process *compiler, struct vector *token_vec)
 {
-    struct buffer *buf = buffer_create();
-    vector_set_peek_pointer(token_vec, 0);
-    struct token *token = vector_peek(token_vec);
+    return tokens_join(compiler, vector_count(token_vec) ? vector_at(token_vec, 0) : NULL, vector_count(token_vec));
+}
 
-    while (token)
+/**
+ * Writes the tokens out as source and lexes it again, returns the tokens that come out
+ */
+struct vector *tokens_join(struct compile_process *compiler, struct token *tokens, int total)
+{
+    struct buffer *buf = buffer_create();
+    for (int i = 0; i < total; i++)
     {
-        tokens_join_buffer_write_token(buf, token);
-        token = vector_peek(token_vec);
+        tokens_join_buffer_write_token(buf, &tokens[i]);
     }
 
     // Finished ? Then lets lex it
@@ -56,6 +55,45 @@ struct vector *tokens_join_vector(struct compile_process *compiler, struct vecto
     return lex_process->token_vec;
 }
 
+/**
+ * Hashes the tokens, starting from the seed. Names are atoms and are hashed by their
+ * address, equal strings at different addresses hash differently.
+ */
+uint64_t tokens_hash(struct token *tokens, int total, uint64_t seed)
+{
+    uint64_t hash = 14695981039346656037ULL ^ seed;
+    for (int i = 0; i < total; i++)
+    {
+        struct token *token = &tokens[i];
+        uint64_t value = token->type | token->whitespace << 8;
+        switch (token->type)
+        {
+        case TOKEN_TYPE_IDENTIFIER:
+        case TOKEN_TYPE_KEYWORD:
+        case TOKEN_TYPE_OPERATOR:
+        case TOKEN_TYPE_STRING:
+        case TOKEN_TYPE_COMMENT:
+            value ^= (uint64_t)(uintptr_t)token->sval << 16;
+            break;
+
+        case TOKEN_TYPE_NUMBER:
+            value ^= (token->llnum << 16) ^ token->num.type << 12;
+            break;
+
+        case TOKEN_TYPE_SYMBOL:
+            value ^= (unsigned char)token->cval << 16;
+            break;
+        }
+        hash = (hash ^ value) * 1099511628211ULL;
+    }
+
+    // Hashes are often used to index tables by their low bits, mix the high bits down into them
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    return hash;
+}
+
 bool token_is_operator(struct token *token, const char *op)
 {
     return token && token->type == TOKEN_TYPE_OPERATOR && S_EQ(token->sval, op);
@@ -70,11 +108,17 @@ bool token_is_primitive_keyword(struct token* token)
 {
     if (token->type != TOKEN_TYPE_KEYWORD)
         return false;
-    
-    for (int i = 0; i < PRIMITIVE_TYPES_TOTAL; i++)
+
+    switch (token->keyword)
     {
-        if (S_EQ(primitive_types[i], token->sval))
-            return true;
+    case KEYWORD_VOID:
+    case KEYWORD_CHAR:
+    case KEYWORD_SHORT:
+    case KEYWORD_INT:
+    case KEYWORD_LONG:
+    case KEYWORD_FLOAT:
+    case KEYWORD_DOUBLE:
+        return true;
     }
 
     return false;
@@ -0,0 +1,269 @@
+#include "compiler.h"
+#include "helpers/buffer.h"
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/**
+ * On disk cache of the tokens lexed from included files, so a header that has not
+ * changed is never lexed twice, not even by a later run of the compiler.
+ *
+ * Every file gets one cache file in the cache directory named after a hash of its
+ * absolute path. The cache file holds the size, modification time and a hash of the
+ * contents of the source it was lexed from, followed by the tokens and then a table
+ * of the strings the tokens point to. Strings are stored as offsets into the table so
+ * the file can be mapped anywhere. Cache files are written under a temporary name and
+ * renamed into place, processes sharing the directory only ever see complete files.
+ */
+
+#define TOKEN_CACHE_MAGIC "DCTK"
+#define TOKEN_CACHE_VERSION 2
+
+struct token_cache_header
+{
+    char magic[4];
+    uint32_t version;
+    // The source the tokens were lexed from
+    uint64_t source_size;
+    int64_t source_mtime_sec;
+    int64_t source_mtime_nsec;
+    uint64_t source_hash;
+
+    uint32_t total_tokens;
+    uint32_t strings_size;
+};
+
+struct token_cache_record
+{
+    uint8_t type;
+    uint8_t flags;
+    uint8_t keyword;
+    uint8_t whitespace;
+    uint8_t num_type;
+    int32_t line;
+    uint16_t col;
+    // Offset into the string table for tokens with a string value, the value itself otherwise
+    uint64_t value;
+};
+
+static const char *token_cache_directory = NULL;
+
+void token_cache_set_directory(const char *directory)
+{
+    token_cache_directory = directory;
+    mkdir(directory, 0755);
+}
+
+const char *token_cache_get_directory()
+{
+    return token_cache_directory;
+}
+
+static uint64_t token_cache_hash(const char *data, size_t size)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < size; i++)
+    {
+        hash ^= (unsigned char)data[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+static void token_cache_path(struct compile_process *process, char *path_out)
+{
+    const char *abs_path = process->cfile.abs_path;
+    snprintf(path_out, PATH_MAX, "%s/%016llx.tok", token_cache_directory,
+             (unsigned long long)token_cache_hash(abs_path, strlen(abs_path)));
+}
+
+static bool token_cache_has_string(struct token *token)
+{
+    switch (token->type)
+    {
+    case TOKEN_TYPE_IDENTIFIER:
+    case TOKEN_TYPE_KEYWORD:
+    case TOKEN_TYPE_OPERATOR:
+    case TOKEN_TYPE_STRING:
+    case TOKEN_TYPE_COMMENT:
+        return token->sval != NULL;
+    }
+
+    return false;
+}
+
+/**
+ * Fills in the header for the source the given process has loaded, false if
+ * the source cannot be stat'ed
+ */
+static bool token_cache_header_for_source(struct compile_process *process, struct token_cache_header *header)
+{
+    struct stat st;
+    if (fstat(fileno(process->cfile.fp), &st) != 0)
+    {
+        return false;
+    }
+
+    memset(header, 0, sizeof(struct token_cache_header));
+    memcpy(header->magic, TOKEN_CACHE_MAGIC, sizeof(header->magic));
+    header->version = TOKEN_CACHE_VERSION;
+    header->source_size = process->cfile.size;
+    header->source_mtime_sec = st.st_mtim.tv_sec;
+    header->source_mtime_nsec = st.st_mtim.tv_nsec;
+    header->source_hash = token_cache_hash(process->cfile.data, process->cfile.size);
+    return true;
+}
+
+static struct vector *token_cache_read_tokens(struct compile_process *process, char *data, struct token_cache_header *header)
+{
+    struct token_cache_record *records = (struct token_cache_record *)(data + sizeof(struct token_cache_header));
+    char *strings = (char *)(records + header->total_tokens);
+    uint16_t file = compiler_file_id(process->cfile.abs_path);
+
+    struct vector *token_vec = vector_create(sizeof(struct token));
+    for (uint32_t i = 0; i < header->total_tokens; i++)
+    {
+        struct token_cache_record *record = &records[i];
+        struct token token = {};
+        token.type = record->type;
+        token.flags = record->flags;
+        token.keyword = record->keyword;
+        token.whitespace = record->whitespace;
+        token.num.type = record->num_type;
+        token.pos.line = record->line;
+        token.pos.col = record->col;
+        token.pos.file = file;
+        token.llnum = record->value;
+
+        switch (token.type)
+        {
+        case TOKEN_TYPE_IDENTIFIER:
+        case TOKEN_TYPE_KEYWORD:
+        case TOKEN_TYPE_OPERATOR:
+            // Names are compared by pointer, they must be atoms again.
+            token.sval = atom(strings + record->value);
+            break;
+
+        case TOKEN_TYPE_STRING:
+        case TOKEN_TYPE_COMMENT:
+            // The mapping is private and never unmapped, the string can stay in it.
+            token.sval = strings + record->value;
+            break;
+        }
+        vector_push(token_vec, &token);
+    }
+
+    return token_vec;
+}
+
+struct vector *token_cache_load(struct compile_process *process)
+{
+    if (!token_cache_directory)
+    {
+        return NULL;
+    }
+
+    char path[PATH_MAX];
+    token_cache_path(process, path);
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        return NULL;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < sizeof(struct token_cache_header))
+    {
+        close(fd);
+        return NULL;
+    }
+
+    char *data = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+    {
+        return NULL;
+    }
+
+    struct token_cache_header expected;
+    struct token_cache_header *header = (struct token_cache_header *)data;
+    bool valid = token_cache_header_for_source(process, &expected) &&
+                 memcmp(header->magic, expected.magic, sizeof(header->magic)) == 0 &&
+                 header->version == expected.version &&
+                 header->source_size == expected.source_size &&
+                 header->source_mtime_sec == expected.source_mtime_sec &&
+                 header->source_mtime_nsec == expected.source_mtime_nsec &&
+                 header->source_hash == expected.source_hash &&
+                 st.st_size == sizeof(struct token_cache_header) + (uint64_t)header->total_tokens * sizeof(struct token_cache_record) + header->strings_size;
+    if (!valid)
+    {
+        munmap(data, st.st_size);
+        return NULL;
+    }
+
+    return token_cache_read_tokens(process, data, header);
+}
+
+void token_cache_store(struct compile_process *process, struct vector *token_vec)
+{
+    if (!token_cache_directory)
+    {
+        return;
+    }
+
+    struct token_cache_header header;
+    if (!token_cache_header_for_source(process, &header))
+    {
+        return;
+    }
+
+    size_t total_tokens = vector_count(token_vec);
+    struct token_cache_record *records = calloc(total_tokens, sizeof(struct token_cache_record));
+    struct buffer *strings = buffer_create();
+    for (size_t i = 0; i < total_tokens; i++)
+    {
+        struct token *token = vector_at(token_vec, i);
+        struct token_cache_record *record = &records[i];
+        record->type = token->type;
+        record->flags = token->flags;
+        record->keyword = token->keyword;
+        record->whitespace = token->whitespace;
+        record->num_type = token->num.type;
+        record->line = token->pos.line;
+        record->col = token->pos.col;
+        record->value = token->llnum;
+        if (token_cache_has_string(token))
+        {
+            record->value = strings->len;
+            buffer_write_bytes(strings, token->sval, strlen(token->sval) + 1);
+        }
+    }
+    header.total_tokens = total_tokens;
+    header.strings_size = strings->len;
+
+    char path[PATH_MAX];
+    char tmp_path[PATH_MAX + 32];
+    token_cache_path(process, path);
+    snprintf(tmp_path, sizeof(tmp_path), "%s.%i.tmp", path, getpid());
+    FILE *fp = fopen(tmp_path, "wb");
+    if (fp)
+    {
+        bool written = fwrite(&header, sizeof(header), 1, fp) == 1 &&
+                       fwrite(records, sizeof(struct token_cache_record), total_tokens, fp) == total_tokens &&
+                       fwrite(buffer_ptr(strings), 1, strings->len, fp) == strings->len;
+        written = fclose(fp) == 0 && written;
+
+        // Readers never see a partly written file, only the old one or the new one.
+        if (!written || rename(tmp_path, path) != 0)
+        {
+            unlink(tmp_path);
+        }
+    }
+
+    buffer_free(strings);
+    free(records);
+}